@@ -95,7 +95,10 @@ VOID CuCmd_PsTrafficPeriod(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 
 VOID CuCmd_ShowStatistics(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ShowTxStatistics(THandle hCuCmd, ConParm_t parm[], U16 nParms);
+VOID CuCmd_ShowTxLatency(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ShowAdvancedParams(THandle hCuCmd, ConParm_t parm[], U16 nParms);
+VOID CuCmd_ShowRecoveryStats(THandle hCuCmd, ConParm_t parm[], U16 nParms);
+VOID CuCmd_ShowContextStats(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 
 VOID CuCmd_ScanAppGlobalConfig(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ScanAppChannelConfig(THandle hCuCmd, ConParm_t parm[], U16 nParms);
@@ -180,6 +183,7 @@ VOID CuCmd_SetReport(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_AddReport(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ClearReport(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ReportSeverityLevel(THandle hCuCmd, ConParm_t parm[], U16 nParms);
+VOID CuCmd_TraceRingDump(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_SetReportLevelCLI(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 
 VOID CuCmd_PrintDriverDebug(THandle hCuCmd, ConParm_t parm[], U16 nParms);
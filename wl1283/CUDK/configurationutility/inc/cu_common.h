@@ -60,6 +60,9 @@ S32 CuCommon_GetU8(THandle hCuCommon, U32 PrivateIoctlId, PU8 pData);
 S32 CuCommon_SetBuffer(THandle hCuCommon, U32 PrivateIoctlId, PVOID pBuffer, U32 len);
 S32 CuCommon_GetBuffer(THandle hCuCommon, U32 PrivateIoctlId, PVOID pBuffer, U32 len);
 S32 CuCommon_GetSetBuffer(THandle hCuCommon, U32 PrivateIoctlId, PVOID pBuffer, U32 len);
+S32 CuCommon_ExecBatch(THandle hCuCommon, ti_private_cmd_t* pCmds, U32 NumCmds, PU32 pRetCodes);
+S32 CuCommon_SubmitBatch(THandle hCuCommon, ti_private_cmd_t* pCmds, U32 NumCmds, PU32 pBatchId);
+S32 CuCommon_GetBatchResult(THandle hCuCommon, ti_private_cmd_t* pCmds, U32 NumCmds, PU32 pRetCodes);
 
 S32 CuCommon_Start_Scan(THandle hCuCommon, PVOID scanParams, U32 sizeOfScanParams);
 S32 CuCommon_Get_BssidList_Size(THandle hCuCommon, PU32 pSizeOfBssiList);
@@ -67,6 +70,7 @@ S32 CuCommon_GetRssi(THandle hCuCommon, PS8 pdRssi, PS8 pbRssi);
 S32 CuCommon_GetSnr(THandle hCuCommon, PU32 pdSnr, PU32 pbSnr);
 S32 CuCommon_GetdesiredPreambleType(THandle hCuCommon, PU32 pDesiredPreambleType);
 S32 CuCommon_GetTxStatistics(THandle hCuCommon, TIWLN_TX_STATISTICS* pTxCounters, U32 doReset); 
+S32 CuCommon_GetTxLatencyStatistics(THandle hCuCommon, TIWLN_TX_LATENCY_STATISTICS* pTxLatency, U32 doReset);
 
 S32 CuCommon_Radio_Test(THandle hCuCommon,TTestCmd* data);
 
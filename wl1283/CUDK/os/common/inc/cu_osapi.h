@@ -104,6 +104,8 @@ S32 os_getFileSize (PVOID file);
 PS8 os_fgets (PS8 s, S32 size, PVOID stream);
 S32 os_fread (PVOID ptr, S32 size, S32 nmemb, PVOID stream);
 S32 os_fwrite (PVOID ptr, S32 size, S32 nmemb, PVOID stream);
+PVOID os_mapFile (const PS8 path, U32 uSize);
+VOID os_unmapFile (PVOID pMap, U32 uSize);
 
 /****************************************************************************************
  *                      OS String API                                                   *
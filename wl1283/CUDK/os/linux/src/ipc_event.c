@@ -301,6 +301,9 @@ static VOID IpcEvent_PrintEvent(IpcEvent_Child_t* pIpcEventChild, U32 EventId, T
             case IPC_EVENT_GWSI:
                 os_error_printf(CU_MSG_ERROR, (PS8)"IpcEvent_PrintEvent - received IPC_EVENT_GWSI\n");
                 break;
+            case IPC_EVENT_CMD_BATCH_DONE:
+                os_error_printf(CU_MSG_ERROR, (PS8)"IpcEvent_PrintEvent - received IPC_EVENT_CMD_BATCH_DONE (batch %d)\n", *(PU32)pData);
+                break;
         case IPC_EVENT_LOGGER:
 #ifdef ETH_SUPPORT
                ProcessLoggerMessage(pData, (U16)DataLen);
@@ -38,6 +38,8 @@
 #include <unistd.h>
 #include <signal.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include "cu_os.h"
 #include "cu_osapi.h"
 
@@ -505,6 +507,49 @@ S32 os_fwrite (PVOID ptr, S32 size, S32 nmemb, PVOID stream)
     return fwrite (ptr, size, nmemb, stream);
 }
 
+/************************************************************************
+ *                        os_mapFile                      *
+ ************************************************************************
+DESCRIPTION: map the first uSize bytes of a device (or file) shared with
+             the driver, for read and write (e.g. the driver trace rings)
+
+CONTEXT:  
+************************************************************************/
+PVOID os_mapFile (const PS8 path, U32 uSize)
+{
+    S32   fd;
+    PVOID pMap;
+
+    fd = open ((char*)path, O_RDWR);
+    if (fd < 0)
+    {
+        os_error_printf (CU_MSG_ERROR, (PS8)"Cannot open %s (errno %d)\n", path, errno);
+        return NULL;
+    }
+
+    pMap = mmap (NULL, uSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close (fd);
+    if (pMap == MAP_FAILED)
+    {
+        os_error_printf (CU_MSG_ERROR, (PS8)"Cannot map %s (errno %d)\n", path, errno);
+        return NULL;
+    }
+
+    return pMap;
+}
+
+/************************************************************************
+ *                        os_unmapFile                      *
+ ************************************************************************
+DESCRIPTION: unmap a buffer mapped by os_mapFile
+
+CONTEXT:  
+************************************************************************/
+VOID os_unmapFile (PVOID pMap, U32 uSize)
+{
+    munmap (pMap, uSize);
+}
+
 /************************************************************************
  *                        os_fclose                     *
  ************************************************************************
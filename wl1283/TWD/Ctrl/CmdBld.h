@@ -51,7 +51,10 @@ TI_STATUS cmdBld_Config                 (TI_HANDLE  hCmdBld,
                                          TI_HANDLE  hCmdQueue,
                                          TI_HANDLE  hTwIf,
                                          TI_HANDLE  hTxHwQueue);
-TI_STATUS cmdBld_ConfigFw               (TI_HANDLE hCmdBld, void *fConfigFwCb, TI_HANDLE hConfigFwCb);
+TI_STATUS cmdBld_ConfigFw               (TI_HANDLE hCmdBld, TI_BOOL bRecovery, void *fConfigFwCb, TI_HANDLE hConfigFwCb);
+void      cmdBld_SetRecoveryJournal     (TI_HANDLE hCmdBld, TI_BOOL bEnable);
+void      cmdBld_GetConfigFwStats       (TI_HANDLE hCmdBld, TConfigFwStats *pStats);
+TI_BOOL   cmdBld_JournalSkipStep        (TI_HANDLE hCmdBld, TI_UINT32 uStep);
 TI_STATUS cmdBld_CheckMboxCb            (TI_HANDLE hCmdBld, void *fFailureEvCb, TI_HANDLE hFailureEv);
 TI_STATUS cmdBld_GetParam               (TI_HANDLE hCmdBld, TTwdParamInfo *pParamInfo);
 TI_STATUS cmdBld_ReadMib                (TI_HANDLE hCmdBld, TI_HANDLE hCb, void* fCb, void* pCb);
@@ -200,14 +203,25 @@ typedef void (*InitSeqCB) (TI_HANDLE handle);
 #define CMD_IS_INVALID  0
 #define CMD_IS_VALID    1
 
+/* 
+ * The configuration journal - a bit per init sequence step, set when the step setting is changed 
+ *     from the FW default (see cmdBld_JournalSkipStep). 
+ */
+#define CMD_BLD_JOURNAL_WORDS           ((MAX_NUM_OF_CMDS_IN_SEQUENCE + 31) / 32)
+#define CMD_BLD_JOURNAL_SET(aBits, uStep)   (aBits)[(uStep) >> 5] |= (1U << ((uStep) & 31))
+#define CMD_BLD_JOURNAL_CLR(aBits, uStep)   (aBits)[(uStep) >> 5] &= ~(1U << ((uStep) & 31))
+#define CMD_BLD_JOURNAL_TST(aBits, uStep)   ((aBits)[(uStep) >> 5] & (1U << ((uStep) & 31)))
+
 #define CMD_BLD_MARK_INIT_SEQUENCE_CMD_AS_VALID(hCmdBld, cmdIdx) \
 ((TCmdBld*)hCmdBld)->aInitSeqCmdsStatus[cmdIdx] = CMD_IS_VALID; \
+CMD_BLD_JOURNAL_SET(((TCmdBld*)hCmdBld)->aConfigJournal, (cmdIdx));
 
 #define CMD_BLD_MARK_INIT_SEQUENCE_CMD_AS_INVALID(hCmdBld, cmdIdx) \
-((TCmdBld*)hCmdBld)->aInitSeqCmdsStatus[cmdIdx] = CMD_IS_INVALID;
+((TCmdBld*)hCmdBld)->aInitSeqCmdsStatus[cmdIdx] = CMD_IS_INVALID; \
+CMD_BLD_JOURNAL_CLR(((TCmdBld*)hCmdBld)->aConfigJournal, (cmdIdx));
 
 #define CMD_BLD_IS_INIT_SEQUENCE_CMD_INVALID(hCmdBld, cmdIdx) \
-(((TCmdBld*)hCmdBld)->aInitSeqCmdsStatus[cmdIdx] == CMD_IS_INVALID) ? TI_TRUE : TI_FALSE
+((((TCmdBld*)hCmdBld)->aInitSeqCmdsStatus[cmdIdx] == CMD_IS_INVALID) || cmdBld_JournalSkipStep (hCmdBld, cmdIdx))
 
 typedef enum
 {
@@ -347,9 +361,18 @@ typedef struct
     TI_HANDLE                  hJoinCmpltOriginalCbHndl;
 
     TI_UINT32                  uIniSeq;         /* Init sequence counter */
+    TI_UINT32                  uIniSeqPending;  /* Init sequence steps waiting for completion */
     void                       *fInitSeqCB;     /* CB function pointer */
     TI_BOOL                    bReconfigInProgress;
 
+    TI_UINT32                  aConfigJournal[CMD_BLD_JOURNAL_WORDS];   /* Steps changed from the FW default */
+    TI_UINT32                  aJournalSteps[CMD_BLD_JOURNAL_WORDS];    /* Steps that are replayed only if journaled */
+    TI_BOOL                    bRecoveryJournal;    /* Replay only the journaled steps on recovery (ini) */
+    TI_BOOL                    bJournalReplay;      /* The current sequence replays only the journaled steps */
+    TI_UINT32                  uConfigStartTime;    /* The current sequence start time (msec) */
+    TI_UINT32                  uJoinStartTime;      /* The start/join command time (msec), 0 if not sent */
+    TConfigFwStats             tConfigFwStats;      /* The last sequence statistics */
+
     TI_UINT32                  uLastElpCtrlMode;/* Init sleep mode */
 
 #ifdef TI_DBG
@@ -2023,7 +2023,7 @@ static void autoDetectCb(TI_HANDLE hCmdBld, TI_UINT16 status, void *pItrBuf)
 {
     TCmdBld *pCmdBld = (TCmdBld *)hCmdBld;
 
-    uint8 uFemIndexResult = ((TTestCmd *)((uint32)pItrBuf))->testCmd_u.IniFileGeneralParams.TXBiPFEMManufacturer;
+    uint8 uFemIndexResult = ((TTestCmd *)pItrBuf)->testCmd_u.IniFileGeneralParams.TXBiPFEMManufacturer;
 
     /* If valid, update DB according to result from FW */
     if (uFemIndexResult < NUMBER_OF_FEM_TYPES_E)
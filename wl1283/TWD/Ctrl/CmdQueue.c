@@ -61,6 +61,7 @@ static TI_STATUS    cmdQueue_Push (TI_HANDLE  hCmdQueue,
                                    void       *fCb, 
                                    TI_HANDLE  hCb, 
                                    void       *pCb);
+static TI_UINT32    cmdQueue_PackConfigCmds (TCmdQueue *pCmdQueue);
 #ifdef TI_DBG
 static void         cmdQueue_PrintQueue(TCmdQueue  *pCmdQueue);
 #ifdef REPORT_LOG
@@ -161,6 +162,8 @@ TI_STATUS cmdQueue_Init   (TI_HANDLE hCmdQueue,
     pCmdQueue->bErrorFlag = TI_FALSE;
     pCmdQueue->bMboxEnabled = TI_FALSE;
     pCmdQueue->bAwake = TI_FALSE;
+    pCmdQueue->bMultiIe = TI_FALSE;
+    pCmdQueue->uNumOfSentNodes = 0;
 
     /* Configure Command Mailbox */
     cmdMbox_Init (hCmdMbox, hReport, hTwIf,
@@ -207,6 +210,7 @@ static TI_STATUS cmdQueue_SM (TI_HANDLE hCmdQueue, ECmdQueueSmEvents eCmdQueueEv
                         pCmdQueue->state = CMDQUEUE_STATE_WAIT_FOR_COMPLETION;
 
                         pHead = &pCmdQueue->aCmdQueue[pCmdQueue->head];
+                        pCmdQueue->uNumOfSentNodes = 1;
 
                         #ifdef CMDQUEUE_DEBUG_PRINT
                         TRACE4(pCmdQueue->hReport, REPORT_SEVERITY_CONSOLE, "cmdQueue_SM: Send Cmd: CmdType = %d(%d) Len = %d, NumOfCmd = %d", pHead->cmdType, (pHead->aParamsBuf) ?  *(TI_UINT16 *)pHead->aParamsBuf:0, pHead->uParamsLen, pCmdQueue->uNumberOfCommandInQueue);
@@ -254,12 +258,35 @@ static TI_STATUS cmdQueue_SM (TI_HANDLE hCmdQueue, ECmdQueueSmEvents eCmdQueueEv
                             uReadLen = 0;
 
                         }
-                        /* send the command to TNET */
-                        rc = cmdMbox_SendCommand (pCmdQueue->hCmdMBox, 
-                                              pHead->cmdType, 
-                                              pHead->aParamsBuf, 
-                                              uWriteLen,
-                                              uReadLen);
+
+                        /* Pack the following configure commands with this one if the FW supports it */
+                        if ((pHead->cmdType == CMD_CONFIGURE) && pCmdQueue->bMultiIe)
+                        {
+                            uWriteLen = cmdQueue_PackConfigCmds (pCmdQueue);
+                        }
+
+                        if (pCmdQueue->uNumOfSentNodes > 1)
+                        {
+                            #ifdef TI_DBG
+                                pCmdQueue->uMultiIeCmdCounter++;
+                            #endif
+
+                            /* send the packed commands to TNET, and read back the status of each IE */
+                            rc = cmdMbox_SendCommand (pCmdQueue->hCmdMBox, 
+                                                  CMD_CONFIGURE_MULTI, 
+                                                  pCmdQueue->aMultiIeBuf, 
+                                                  uWriteLen,
+                                                  pCmdQueue->uNumOfSentNodes * sizeof(TI_UINT16));
+                        }
+                        else
+                        {
+                            /* send the command to TNET */
+                            rc = cmdMbox_SendCommand (pCmdQueue->hCmdMBox, 
+                                                  pHead->cmdType, 
+                                                  pHead->aParamsBuf, 
+                                                  uWriteLen,
+                                                  uReadLen);
+                        }
 
                         bBreakWhile = TI_TRUE;
 
@@ -290,73 +317,94 @@ static TI_STATUS cmdQueue_SM (TI_HANDLE hCmdQueue, ECmdQueueSmEvents eCmdQueueEv
                             TI_UINT16        uParam;
                             void *fCb, *hCb, *pCb;
                             CommandStatus_e cmdStatus;
+                            TI_UINT32 uNumOfNodes = pCmdQueue->uNumOfSentNodes;
+                            TI_UINT32 uNode;
+
+                            /* A multi-IE command returns the status of each IE in place of its parameters */
+                            if (uNumOfNodes > 1)
+                            {
+                                cmdMbox_GetCmdParams (pCmdQueue->hCmdMBox, (TI_UINT8 *)pCmdQueue->aMultiIeStatus);
+                            }
 
-                            pHead = &pCmdQueue->aCmdQueue[pCmdQueue->head];
+                            /* Complete the sent commands in order (stop if the queue is restarted by a callback) */
+                            for (uNode = 0; (uNode < uNumOfNodes) && (pCmdQueue->uNumOfSentNodes > 0); uNode++)
+                            {
+                                pHead = &pCmdQueue->aCmdQueue[pCmdQueue->head];
             
-                            /* Keep callback parameters in temporary variables */
-                            cmdType = pHead->cmdType;
-                            uParam  = *(TI_UINT16 *)pHead->aParamsBuf;
-                            fCb = pHead->fCb;
-                            hCb = pHead->hCb;
-                            pCb = pHead->pInterrogateBuf;
+                                /* Keep callback parameters in temporary variables */
+                                cmdType = pHead->cmdType;
+                                uParam  = *(TI_UINT16 *)pHead->aParamsBuf;
+                                fCb = pHead->fCb;
+                                hCb = pHead->hCb;
+                                pCb = pHead->pInterrogateBuf;
                             
-                            /* 
-                             * Delete the command from the queue before calling a callback 
-                             * because there may be nested calls inside a callback
-                             */
-                            pCmdQueue->head ++;
-                            if (pCmdQueue->head >= CMDQUEUE_QUEUE_DEPTH)
-                                pCmdQueue->head = 0;                
-                            pCmdQueue->uNumberOfCommandInQueue --;                
+                                /* 
+                                 * Delete the command from the queue before calling a callback 
+                                 * because there may be nested calls inside a callback
+                                 */
+                                pCmdQueue->head ++;
+                                if (pCmdQueue->head >= CMDQUEUE_QUEUE_DEPTH)
+                                    pCmdQueue->head = 0;                
+                                pCmdQueue->uNumberOfCommandInQueue --;                
+                                pCmdQueue->uNumOfSentNodes --;
                 
-                        #ifdef TI_DBG
-                            pCmdQueue->uCmdCompltCounter++;
-                        #endif 
+                            #ifdef TI_DBG
+                                pCmdQueue->uCmdCompltCounter++;
+                            #endif 
 
-                            /* Read the latest command return status */
-                            status = cmdMbox_GetStatus (pCmdQueue->hCmdMBox, &cmdStatus);
-                            if (status != TI_OK)
-                            {
-                                if (cmdStatus == CMD_STATUS_REJECT_MEAS_SG_ACTIVE)
+                                /* Read the latest command return status (or this IE status for a multi-IE command) */
+                                if (uNumOfNodes > 1)
                                 {
-                                    /* return reject status in the callback */
-                                    status = SG_REJECT_MEAS_SG_ACTIVE;
-                                    pCmdQueue->bErrorFlag = TI_FALSE;
+                                    cmdStatus = ENDIAN_HANDLE_WORD(pCmdQueue->aMultiIeStatus[uNode]);
+                                    status = (cmdStatus == CMD_STATUS_SUCCESS) ? TI_OK : TI_NOK;
                                 }
                                 else
                                 {
-                                    WLAN_OS_REPORT(("cmdQueue_SM: ** ERROR **  Mbox status error %d, set bErrorFlag !!!!!\n", cmdStatus));
-                                    TRACE1(pCmdQueue->hReport, REPORT_SEVERITY_ERROR, "cmdQueue_SM: ** ERROR **  Mbox status error %d, set bErrorFlag !!!!!\n", cmdStatus);
-                                    pCmdQueue->bErrorFlag = TI_TRUE;
+                                    status = cmdMbox_GetStatus (pCmdQueue->hCmdMBox, &cmdStatus);
                                 }
-                            }
-                            else
-                            {
-                                pCmdQueue->bErrorFlag = TI_FALSE;
-                            }
-
-                            /* If the command had a CB, then call it with the proper results buffer */
-                            if (fCb)
-                            {   
-                                if (pCb)
+                                if (status != TI_OK)
                                 {
-                                    /* If pInterrogateBuf isn't NULL we need to copy the results */
-                                    cmdMbox_GetCmdParams(pCmdQueue->hCmdMBox, pCb);
-                                    /* Call the CB with the result buffer and the returned status */
-                                    ((TCmdQueueInterrogateCb)fCb) (hCb, status, pCb); 
+                                    if (cmdStatus == CMD_STATUS_REJECT_MEAS_SG_ACTIVE)
+                                    {
+                                        /* return reject status in the callback */
+                                        status = SG_REJECT_MEAS_SG_ACTIVE;
+                                        pCmdQueue->bErrorFlag = TI_FALSE;
+                                    }
+                                    else
+                                    {
+                                        WLAN_OS_REPORT(("cmdQueue_SM: ** ERROR **  Mbox status error %d, set bErrorFlag !!!!!\n", cmdStatus));
+                                        TRACE1(pCmdQueue->hReport, REPORT_SEVERITY_ERROR, "cmdQueue_SM: ** ERROR **  Mbox status error %d, set bErrorFlag !!!!!\n", cmdStatus);
+                                        pCmdQueue->bErrorFlag = TI_TRUE;
+                                    }
                                 }
                                 else
                                 {
-                                    /* Call the CB with only the returned status */
-                                    ((TCmdQueueCb)fCb) (hCb, status);
+                                    pCmdQueue->bErrorFlag = TI_FALSE;
                                 }
-                            }
-                            else
-                            {
-                                /* Call the generic callback */
-                                if (pCmdQueue->fCmdCompleteCb)
+
+                                /* If the command had a CB, then call it with the proper results buffer */
+                                if (fCb)
+                                {   
+                                    if (pCb)
+                                    {
+                                        /* If pInterrogateBuf isn't NULL we need to copy the results */
+                                        cmdMbox_GetCmdParams(pCmdQueue->hCmdMBox, pCb);
+                                        /* Call the CB with the result buffer and the returned status */
+                                        ((TCmdQueueInterrogateCb)fCb) (hCb, status, pCb); 
+                                    }
+                                    else
+                                    {
+                                        /* Call the CB with only the returned status */
+                                        ((TCmdQueueCb)fCb) (hCb, status);
+                                    }
+                                }
+                                else
                                 {
-                                    pCmdQueue->fCmdCompleteCb (pCmdQueue->hCmdCompleteCb, cmdType, uParam, status);
+                                    /* Call the generic callback */
+                                    if (pCmdQueue->fCmdCompleteCb)
+                                    {
+                                        pCmdQueue->fCmdCompleteCb (pCmdQueue->hCmdCompleteCb, cmdType, uParam, status);
+                                    }
                                 }
                             }
 
@@ -534,6 +582,66 @@ static TI_STATUS cmdQueue_Push (TI_HANDLE  hCmdQueue,
 }
 
 
+/*
+ * \brief	Pack the configure commands at the queue head to one multi-IE command
+ * 
+ * \param  pCmdQueue - Pointer to TCmdQueue
+ * \return The multi-IE command parameters length (if more than one command was packed)
+ * 
+ * \par Description
+ * Copies the consecutive CMD_CONFIGURE nodes from the queue head, each padded to 32 bit, 
+ * after the ConfigureMulti_t header in aMultiIeBuf (as long as they fit in the mailbox).
+ * If more than one node was packed, uNumOfSentNodes is updated to the number of packed nodes.
+ * 
+ * \sa cmdQueue_SM
+ */
+static TI_UINT32 cmdQueue_PackConfigCmds (TCmdQueue *pCmdQueue)
+{
+    ConfigureMulti_t *pMultiHdr = (ConfigureMulti_t *)pCmdQueue->aMultiIeBuf;
+    TCmdQueueNode    *pNode;
+    TI_UINT32         uIndex = pCmdQueue->head;
+    TI_UINT32         uLen = sizeof(ConfigureMulti_t);
+    TI_UINT32         uIeLen;
+    TI_UINT32         uNodes;
+
+    /* A single command is sent as is */
+    if (pCmdQueue->uNumberOfCommandInQueue < 2)
+    {
+        return 0;
+    }
+
+    for (uNodes = 0; uNodes < pCmdQueue->uNumberOfCommandInQueue; uNodes++)
+    {
+        pNode  = &pCmdQueue->aCmdQueue[uIndex];
+        uIeLen = (pNode->uParamsLen + 3) & ~3;
+
+        if ((pNode->cmdType != CMD_CONFIGURE) || (pNode->pInterrogateBuf != NULL) || (uLen + uIeLen > MAX_CMD_PARAMS))
+        {
+            break;
+        }
+
+        os_memoryCopy (pCmdQueue->hOs, &pCmdQueue->aMultiIeBuf[uLen], pNode->aParamsBuf, pNode->uParamsLen);
+        os_memoryZero (pCmdQueue->hOs, &pCmdQueue->aMultiIeBuf[uLen + pNode->uParamsLen], uIeLen - pNode->uParamsLen);
+        uLen += uIeLen;
+
+        uIndex++;
+        if (uIndex == CMDQUEUE_QUEUE_DEPTH)
+            uIndex = 0;
+    }
+
+    if (uNodes < 2)
+    {
+        return 0;
+    }
+
+    pMultiHdr->numOfIEs = ENDIAN_HANDLE_WORD((TI_UINT16)uNodes);
+    pMultiHdr->reserved = 0;
+    pCmdQueue->uNumOfSentNodes = uNodes;
+
+    return uLen;
+}
+
+
 /*
  * \brief	Notify the CmdQueue SM on the result received.
  * 
@@ -578,6 +686,7 @@ TI_STATUS cmdQueue_Restart (TI_HANDLE hCmdQueue)
     */
     pCmdQueue->state = CMDQUEUE_STATE_IDLE;
     pCmdQueue->bAwake = TI_FALSE;
+    pCmdQueue->uNumOfSentNodes = 0;
 
 TRACE0(pCmdQueue->hReport, REPORT_SEVERITY_INFORMATION, "cmdQueue_Clean: Cleaning aCmdQueue Queue");
     
@@ -756,6 +865,89 @@ TI_STATUS cmdQueue_DisableMbox (TI_HANDLE hCmdQueue)
 }
 
 
+/*
+ * \brief	Enables or disables packing consecutive configure commands
+ * 
+ * \param  hCmdQueue - Handle to CmdQueue
+ * \param  bMultiIe - TI_TRUE if the FW supports CMD_CONFIGURE_MULTI
+ * \return void
+ * 
+ * \par Description
+ * When enabled, the CMD_CONFIGURE commands waiting in the queue are sent together
+ * in one CMD_CONFIGURE_MULTI mailbox command, and each one is completed with its IE status.
+ * 
+ * \sa cmdQueue_CanPackConfig
+ */
+void cmdQueue_SetMultiIe (TI_HANDLE hCmdQueue, TI_BOOL bMultiIe)
+{
+    TCmdQueue* pCmdQueue = (TCmdQueue*)hCmdQueue;
+
+    pCmdQueue->bMultiIe = bMultiIe;
+}
+
+
+/*
+ * \brief	Check if configure commands can be queued to be packed together
+ * 
+ * \param  hCmdQueue - Handle to CmdQueue
+ * \return TI_TRUE if more configure commands may be queued without waiting
+ * 
+ * \par Description
+ * Returns TI_TRUE if the multi-IE mode and the mailbox are enabled, only configure commands 
+ * are queued and at least CMDQUEUE_BURST_MIN_FREE queue nodes are free.
+ * Used by the FW configuration sequence to queue its configure steps back to back.
+ * 
+ * \sa cmdQueue_SetMultiIe
+ */
+TI_BOOL cmdQueue_CanPackConfig (TI_HANDLE hCmdQueue)
+{
+    TCmdQueue* pCmdQueue = (TCmdQueue*)hCmdQueue;
+    TI_UINT32  uIndex = pCmdQueue->head;
+    TI_UINT32  i;
+
+    if (!pCmdQueue->bMultiIe || !pCmdQueue->bMboxEnabled || 
+        (pCmdQueue->uNumberOfCommandInQueue + CMDQUEUE_BURST_MIN_FREE > CMDQUEUE_QUEUE_DEPTH))
+    {
+        return TI_FALSE;
+    }
+
+    for (i = 0; i < pCmdQueue->uNumberOfCommandInQueue; i++)
+    {
+        if (pCmdQueue->aCmdQueue[uIndex].cmdType != CMD_CONFIGURE)
+        {
+            return TI_FALSE;
+        }
+
+        uIndex++;
+        if (uIndex == CMDQUEUE_QUEUE_DEPTH)
+            uIndex = 0;
+    }
+
+    return TI_TRUE;
+}
+
+
+/*
+ * \brief	Check if commands can be queued as a burst
+ * 
+ * \param  hCmdQueue - Handle to CmdQueue
+ * \return TI_TRUE if more commands may be queued without waiting
+ * 
+ * \par Description
+ * Returns TI_TRUE if the mailbox is enabled and at least CMDQUEUE_BURST_MIN_FREE queue nodes are free.
+ * Used by the FW configuration sequence to replay its steps back to back on recovery.
+ * 
+ * \sa cmdQueue_CanPackConfig
+ */
+TI_BOOL cmdQueue_CanQueueBurst (TI_HANDLE hCmdQueue)
+{
+    TCmdQueue* pCmdQueue = (TCmdQueue*)hCmdQueue;
+
+    return pCmdQueue->bMboxEnabled && 
+           (pCmdQueue->uNumberOfCommandInQueue + CMDQUEUE_BURST_MIN_FREE <= CMDQUEUE_QUEUE_DEPTH);
+}
+
+
 /*
  * \brief	Called when a command timeout occur
  * 
@@ -879,6 +1071,8 @@ void cmdQueue_Print (TI_HANDLE hCmdQueue)
                         pCmdQueue->uCmdSendCounter));
     WLAN_OS_REPORT(("cmdQueue_Print:The Total number of Cmd Completed interrupt= %d\n",
                         pCmdQueue->uCmdCompltCounter));
+    WLAN_OS_REPORT(("cmdQueue_Print:The Total number of multi-IE Cmd send from Queue= %d\n",
+                        pCmdQueue->uMultiIeCmdCounter));
 
     cmdQueue_PrintQueue (pCmdQueue);
 }
@@ -50,6 +50,7 @@
 #define CMDQUEUE_QUEUE_DEPTH          30
 #define CMDQUEUE_HISTORY_DEPTH        5
 #define CMDQUEUE_INFO_ELEM_HEADER_LEN 4
+#define CMDQUEUE_BURST_MIN_FREE       (CMDQUEUE_QUEUE_DEPTH / 2)   /* Free nodes kept when queuing commands without waiting */
 
 
 #define RC_CONVERT(rc) \
@@ -137,6 +138,9 @@ typedef struct
     /* Queues */
     TCmdQueueNode           aCmdQueue [CMDQUEUE_QUEUE_DEPTH]; 
     TCmdQueueRecoveryNode   aRecoveryQueue [CMDQUEUE_QUEUE_DEPTH];
+    /* Multi-IE command (consecutive configure commands packed to one CMD_CONFIGURE_MULTI) */
+    TI_UINT8                aMultiIeBuf [MAX_CMD_PARAMS];
+    TI_UINT16               aMultiIeStatus [CMDQUEUE_QUEUE_DEPTH];
 
     /* Indexes & counters */
     TI_UINT32               head;
@@ -144,9 +148,11 @@ typedef struct
     TI_UINT32               uNumberOfCommandInQueue;
     TI_UINT32               uMaxNumberOfCommandInQueue;
     TI_UINT32               uNumberOfRecoveryNodes;  
+    TI_UINT32               uNumOfSentNodes;    /* Queue nodes sent in the current mailbox command */
     #ifdef TI_DBG
         TI_UINT32               uCmdSendCounter;
         TI_UINT32               uCmdCompltCounter;
+        TI_UINT32               uMultiIeCmdCounter;
     #endif
 
     /* Error handling */
@@ -155,6 +161,8 @@ typedef struct
     TI_BOOL                 bMboxEnabled;
     /* Notify that we have already awaken the chip */
     TI_BOOL                 bAwake;
+    /* Pack consecutive configure commands (supported by the FW) */
+    TI_BOOL                 bMultiIe;
 
 } TCmdQueue; 
 
@@ -49,9 +49,9 @@
 
 /************************ static definition declaration *****************************/
 
-#define RX_QUEUE_ARRAY_SIZE		                            8
-#define RX_QUEUE_ARRAY_SIZE_BIT_MASK                        0x7 /* RX_QUEUE_ARRAY_SIZE -1 */
-#define RX_QUEUE_WIN_SIZE		                            RX_QUEUE_ARRAY_SIZE
+#define RX_QUEUE_ARRAY_SIZE		                            64  /* The reorder window bitmap width (TI_UINT64) */
+#define RX_QUEUE_ARRAY_SIZE_BIT_MASK                        0x3F /* RX_QUEUE_ARRAY_SIZE -1 */
+#define RX_QUEUE_WIN_SIZE		                            8   /* The ADDBA responder window set by the driver and FW (see qosMngr.h) */
 #define BA_SESSION_TIME_TO_SLEEP		                    (50)
 
 
@@ -60,6 +60,10 @@
 #define SEQ_NUM_WRAP                                        0x1000
 #define SEQ_NUM_MASK                                        0xFFF
 
+/* The window bitmap of the first uNum entries, and the window bitmap shifted by uNum entries (uNum may exceed the bitmap) */
+#define RX_QUEUE_WIN_MAP(uNum)                              (((uNum) >= RX_QUEUE_ARRAY_SIZE) ? ~(TI_UINT64)0 : (((TI_UINT64)1 << (uNum)) - 1))
+#define RX_QUEUE_SHIFT_MAP(uMap, uNum)                      (((uNum) >= RX_QUEUE_ARRAY_SIZE) ? 0 : ((uMap) >> (uNum)))
+
 
 /************************ static structures declaration *****************************/
 
@@ -71,19 +75,38 @@ typedef struct
     TI_UINT16           uFrameSn;
 } TRxQueuePacketEntry;	
 
+/* Reorder statistics of one TID */
+typedef struct
+{
+    TI_UINT32           uStoredPkts;                /* Packets stored for reorder (received out of order) */
+    TI_UINT32           uMaxDepth;                  /* Max packets stored at once */
+    TI_UINT32           uHoles;                     /* Missing SNs skipped (by a later SN beyond the window, a BAR or a timeout) */
+    TI_UINT32           uTimeoutFlushes;            /* Reorder timeouts that released stored packets */
+    TI_UINT32           uReleasedRuns;              /* In-order packet chains passed to the upper layer */
+    TI_UINT32           uDuplicates;                /* Stored SNs received again (discarded) */
+} TRxQueueTidStats;
+
 /* structure describe set of data that one Tid, also including the arras himself */
 typedef struct 
 {
-    /* array packets Entries */
+    /* array packets Entries - the packet with sequence number SN is saved at index (SN % RX_QUEUE_ARRAY_SIZE) */
     TRxQueuePacketEntry aPaketsQueue [RX_QUEUE_ARRAY_SIZE];	
+    /* bit i is set if the packet with SN = ESN + i is saved */
+    TI_UINT64           uStoredMap;
+    /* number of saved packets */
+    TI_UINT32           uNumStored;
     /* TID BA state */
     TI_BOOL	            aTidBaEstablished;	              
-    /* index that winStar point on */
-    TI_UINT32 	        aWinStartArrayInex;	                    
     /* windows size */
     TI_UINT32	        aTidWinSize;
 	/* expected sequence number (ESN) */ 
     TI_UINT16	        aTidExpectedSn;
+    /* reorder timeout - runs while packets are saved, so a lost packet doesn't hold the window */
+    TI_HANDLE           hTimer;
+    TI_BOOL             bTimerRunning;
+    /* the RxQueue object (for the timer callback) */
+    TI_HANDLE           hRxQueue;
+    TRxQueueTidStats    tStats;
 } TRxQueueTidDataBase;	
 
 /* structure describe set of data that assist of manage one SA RxQueue arrays */
@@ -92,32 +115,32 @@ typedef struct
     TRxQueueTidDataBase tSa1ArrayMng [MAX_NUM_OF_802_1d_TAGS];
 } TRxQueueArraysMng;	
 
-typedef struct
-{
-    TI_BOOL             bPacketMiss;                /* True - Wait for missing packets start timer
-                                                       False - all packets received in order */ 
-    TI_UINT16           aPacketsStored;             /* Represent the number of packets in Queue, 0 - Queue is empty */
-    TI_UINT8            aFrameTid;                  /* save the TID of the missing packet */
-} TPacketTimeout;
-
 
 /* main RxQueue structure in order to management the packets disordered array. */
 typedef struct 
 {
     TI_HANDLE           hOs;                        /* OS handler */
     TI_HANDLE           hReport;                    /* Report handler */
-	TI_HANDLE           hTimer;                     /* Timer Handle */
     TRxQueueArraysMng   tRxQueueArraysMng;          /* manage each Source Address RxQueue arrays */
     TPacketReceiveCb    tReceivePacketCB;           /* Receive packets CB address */
     TI_HANDLE           hReceivePacketCB_handle;    /* Receive packets CB handler */
-	TPacketTimeout      tPacketTimeout;             /* save information about the missing packet */
+    TPacketReceiveListCb tReceivePacketListCB;      /* Receive packets chain CB address (optional) */
+    TI_HANDLE           hReceivePacketListCB_handle;/* Receive packets chain CB handler */
+    void               *aRunPackets[RX_QUEUE_ARRAY_SIZE + 1]; /* The in-order packets chain to pass up */
+    TI_UINT32           uRunLen;                    /* The number of packets in aRunPackets */
 } TRxQueue;	
 
 
 /************************ static function declaration *****************************/
 
 static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, const void *pBuffer);
-static void RxQueue_PacketTimeOut (TI_HANDLE hRxQueue, TI_BOOL bTwdInitOccured);
+static void RxQueue_PreparePacket (TRxQueue *pRxQueue, TI_STATUS tStatus, const void *pBuffer);
+static void RxQueue_AddToRun (TRxQueue *pRxQueue, const void *pBuffer, TI_STATUS tStatus);
+static void RxQueue_PassRun (TRxQueue *pRxQueue, TRxQueueTidDataBase *pTidDataBase);
+static void RxQueue_MoveWindow (TRxQueue *pRxQueue, TRxQueueTidDataBase *pTidDataBase, TI_UINT16 uNewWinStartSn);
+static void RxQueue_UpdateTimer (TRxQueueTidDataBase *pTidDataBase, TI_BOOL bWinStartMoved);
+static TI_UINT32 RxQueue_TrailingOnes (TI_UINT64 uMap);
+static void RxQueue_PacketTimeOut (TI_HANDLE hTidDataBase, TI_BOOL bTwdInitOccured);
 
 
 /** 
@@ -164,15 +187,21 @@ TI_HANDLE RxQueue_Create (TI_HANDLE hOs)
 TI_STATUS RxQueue_Destroy (TI_HANDLE hRxQueue)
 {
     TRxQueue *pRxQueue;
+    TI_UINT32 uTid;
     
     if (hRxQueue)
     {
         pRxQueue = (TRxQueue *)hRxQueue;
 
-        if (pRxQueue->hTimer) 
+        for (uTid = 0; uTid < MAX_NUM_OF_802_1d_TAGS; uTid++)
         {
-            tmr_DestroyTimer (pRxQueue->hTimer);
-            pRxQueue->hTimer = NULL;
+            TRxQueueTidDataBase *pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uTid]);
+
+            if (pTidDataBase->hTimer) 
+            {
+                tmr_DestroyTimer (pTidDataBase->hTimer);
+                pTidDataBase->hTimer = NULL;
+            }
         }
 
         /* free module object */
@@ -189,21 +218,35 @@ TI_STATUS RxQueue_Destroy (TI_HANDLE hRxQueue)
  * \fn     RxQueue_Init() 
  * \brief  Init required handles 
  * 
- * Init required handles and module variables.
+ * Init required handles and module variables, and create the TIDs reorder timers.
  * 
  * \note    
  * \param  hRxQueue - The module object
  * \param  hReport - Report module Handles
+ * \param  hTimerModule - Timer module Handles
  * \return TI_OK on success or TI_NOK on failure  
  * \sa     
  */ 
 TI_STATUS RxQueue_Init (TI_HANDLE hRxQueue, TI_HANDLE hReport, TI_HANDLE hTimerModule)
 {
 	TRxQueue *pRxQueue = (TRxQueue *)hRxQueue;
+    TI_UINT32 uTid;
 
 
     pRxQueue->hReport = hReport;
-	pRxQueue->hTimer  = tmr_CreateTimer (hTimerModule);
+
+    for (uTid = 0; uTid < MAX_NUM_OF_802_1d_TAGS; uTid++)
+    {
+        TRxQueueTidDataBase *pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uTid]);
+
+        pTidDataBase->hRxQueue = hRxQueue;
+        pTidDataBase->hTimer   = tmr_CreateTimer (hTimerModule);
+        if (pTidDataBase->hTimer == NULL)
+        {
+            TRACE1(pRxQueue->hReport, REPORT_SEVERITY_ERROR , "RxQueue_Init: Failed to create timer for TID %d\n", uTid);
+            return TI_NOK;
+        }
+    }
 
 	return TI_OK;
 }
@@ -213,7 +256,8 @@ TI_STATUS RxQueue_Init (TI_HANDLE hRxQueue, TI_HANDLE hReport, TI_HANDLE hTimerM
  * \fn     RxQueue_Register_CB()
  * \brief  Register the function to be called for received Rx.
  * 
- * \note   
+ * \note   If TWD_INT_RECEIVE_PACKET_LIST is registered, the in-order packets chains released 
+ *         from the reorder window are passed to it in one call.
  * \param  hRxQueue - The module object
  * \param  CallBackID - event ID
  * \param  CBFunc - function address.
@@ -234,6 +278,11 @@ void RxQueue_Register_CB (TI_HANDLE hRxQueue, TI_UINT32 uCallBackID, void *CBFun
         pRxQueue->hReceivePacketCB_handle = CBObj;
         break;
 
+    case TWD_INT_RECEIVE_PACKET_LIST:
+        pRxQueue->tReceivePacketListCB = (TPacketReceiveListCb)CBFunc;
+        pRxQueue->hReceivePacketListCB_handle = CBObj;
+        break;
+
     default:
         TRACE0(pRxQueue->hReport, REPORT_SEVERITY_ERROR , "RxQueue_Register_CB: Illegal value\n");
         break;
@@ -253,13 +302,10 @@ void RxQueue_Register_CB (TI_HANDLE hRxQueue, TI_UINT32 uCallBackID, void *CBFun
  */ 
 void RxQueue_CloseBaSession(TI_HANDLE hRxQueue, TI_UINT8 uFrameTid)
 {
-    TRxQueue   *pRxQueue = (TRxQueue *)hRxQueue;
-    TI_UINT32   i;
-
+    TRxQueue            *pRxQueue = (TRxQueue *)hRxQueue;
+    TRxQueueTidDataBase *pTidDataBase;
+    TI_UINT32            uHoles;
 
-    /* Set the SA Tid pointer */
-    TRxQueueTidDataBase *pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uFrameTid]);
-    
     /* TID illegal value ? */
     if (uFrameTid >= MAX_NUM_OF_802_1d_TAGS)
     {
@@ -268,58 +314,40 @@ void RxQueue_CloseBaSession(TI_HANDLE hRxQueue, TI_UINT8 uFrameTid)
         return;
     }
 
+    /* Set the SA Tid pointer */
+    pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uFrameTid]);
+
     if(pTidDataBase->aTidBaEstablished == TI_TRUE)
     {
         /* Clean BA session */
         pTidDataBase->aTidBaEstablished = TI_FALSE;
 
-        /* Pass all valid entries at the array */ 
-        for (i = 0; (i < RX_QUEUE_ARRAY_SIZE) && (i < RX_QUEUE_WIN_SIZE); i++)
-        {
-            if (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)
-            {
-                RxQueue_PassPacket (pRxQueue, 
-                                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
-
-                pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-
-                pRxQueue->tPacketTimeout.aPacketsStored--;
-            }
-
-            pTidDataBase->aWinStartArrayInex ++;
-
-            /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-            pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-        }
+        /* Pass all saved packets in order (the window is moved beyond the last one) */ 
+        /* The session is closed, so the missing packets are not counted as holes */
+        uHoles = pTidDataBase->tStats.uHoles;
+        RxQueue_MoveWindow (pRxQueue, pTidDataBase, (TI_UINT16)((pTidDataBase->aTidExpectedSn + RX_QUEUE_ARRAY_SIZE) & SEQ_NUM_MASK));
+        RxQueue_PassRun (pRxQueue, pTidDataBase);
+        pTidDataBase->tStats.uHoles = uHoles;
 
         /* If timer is started - stop it */
-        if (pRxQueue->tPacketTimeout.bPacketMiss) 
-        {
-                tmr_StopTimer (pRxQueue->hTimer);
-                pRxQueue->tPacketTimeout.bPacketMiss = TI_FALSE;
-        }
+        RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
     }
 }
 
 
 /** 
- * \fn     RxQueue_PassPacket()
- * \brief  Responsible on decode packet parameters and pass it to upper layer.
+ * \fn     RxQueue_PreparePacket()
+ * \brief  Decode packet parameters before passing it to upper layer.
  *
  * \note   
- * \param  hRxQueue  - RxQueue handle.
+ * \param  pRxQueue  - RxQueue handle.
  * \param  aStatus   - RxXfer status that indicate if the upper layer should free the packet or use it.
- * \param  pFrame    - paket address of the packet
- * \param  pRxParams - address to structure of the Rx Descriptor received by FW.
- * \return TI_OK on success or TI_NOK on failure 
- * \sa     
+ * \param  pBuffer   - paket address of the packet
+ * \return void
+ * \sa     RxQueue_PassPacket
  */ 
-static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, const void *pBuffer)
+static void RxQueue_PreparePacket (TRxQueue *pRxQueue, TI_STATUS tStatus, const void *pBuffer)
 {
-    TRxQueue *pRxQueue = (TRxQueue *)hRxQueue;
-
-
     if (tStatus == TI_OK)
     {
         /* Get the mac header location in the packet Buffer */
@@ -338,6 +366,27 @@ static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, cons
         pRxParams->status &= ~RX_DESC_STATUS_MASK;
         pRxParams->status |= RX_DESC_STATUS_DRIVER_RX_Q_FAIL;
     }
+}
+
+
+/** 
+ * \fn     RxQueue_PassPacket()
+ * \brief  Responsible on decode packet parameters and pass it to upper layer.
+ *
+ * \note   
+ * \param  hRxQueue  - RxQueue handle.
+ * \param  aStatus   - RxXfer status that indicate if the upper layer should free the packet or use it.
+ * \param  pFrame    - paket address of the packet
+ * \param  pRxParams - address to structure of the Rx Descriptor received by FW.
+ * \return TI_OK on success or TI_NOK on failure 
+ * \sa     
+ */ 
+static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, const void *pBuffer)
+{
+    TRxQueue *pRxQueue = (TRxQueue *)hRxQueue;
+
+
+    RxQueue_PreparePacket (pRxQueue, tStatus, pBuffer);
 
     TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION , "RxQueue_PassPacket: call TWD_OWNER_RX_QUEUE CB. In std rxData_ReceivePacket()\n");
   
@@ -350,42 +399,221 @@ static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, cons
 }
 
 
+/** 
+ * \fn     RxQueue_AddToRun()
+ * \brief  Add a packet to the in-order packets chain
+ *
+ * The chain is passed to the upper layer by RxQueue_PassRun.
+ *
+ * \note   
+ * \param  pRxQueue     - RxQueue handle.
+ * \param  pBuffer      - paket address of the packet
+ * \param  aStatus      - RxXfer status that indicate if the upper layer should free the packet or use it.
+ * \return void
+ * \sa     RxQueue_PassRun
+ */ 
+static void RxQueue_AddToRun (TRxQueue *pRxQueue, const void *pBuffer, TI_STATUS tStatus)
+{
+    RxQueue_PreparePacket (pRxQueue, tStatus, pBuffer);
+
+    pRxQueue->aRunPackets[pRxQueue->uRunLen++] = (void *)pBuffer;
+}
+
+
+/** 
+ * \fn     RxQueue_PassRun()
+ * \brief  Pass the in-order packets chain to the upper layer
+ *
+ * Release the window head run of saved packets (found by the trailing ones of the window bitmap),
+ *     and pass it with any packets added before in one call.
+ *
+ * \note   If the packets chain CB is not registered, the packets are passed one by one
+ * \param  pRxQueue     - RxQueue handle.
+ * \param  pTidDataBase - The TID
+ * \return void
+ * \sa     RxQueue_AddToRun
+ */ 
+static void RxQueue_PassRun (TRxQueue *pRxQueue, TRxQueueTidDataBase *pTidDataBase)
+{
+    TI_UINT32 uRun = RxQueue_TrailingOnes (pTidDataBase->uStoredMap);
+    TI_UINT32 uNumPkts;
+    TI_UINT32 i;
+
+    /* Release the saved packets run at the window head */
+    for (i = 0; i < uRun; i++)
+    {
+        TRxQueuePacketEntry *pEntry = &pTidDataBase->aPaketsQueue[(pTidDataBase->aTidExpectedSn + i) & RX_QUEUE_ARRAY_SIZE_BIT_MASK];
+
+        RxQueue_AddToRun (pRxQueue, pEntry->pPacket, pEntry->tStatus);
+        pEntry->pPacket = NULL;
+    }
+    pTidDataBase->uStoredMap      = RX_QUEUE_SHIFT_MAP (pTidDataBase->uStoredMap, uRun);
+    pTidDataBase->uNumStored     -= uRun;
+    pTidDataBase->aTidExpectedSn  = (pTidDataBase->aTidExpectedSn + uRun) & SEQ_NUM_MASK;
+
+    uNumPkts = pRxQueue->uRunLen;
+    if (uNumPkts == 0)
+    {
+        return;
+    }
+    pRxQueue->uRunLen = 0;
+    pTidDataBase->tStats.uReleasedRuns++;
+
+    TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_PassRun: pass %d packets, aTidExpectedSn = %d\n", uNumPkts, pTidDataBase->aTidExpectedSn);
+
+    /* if the packet status not success it will be discarded */
+    if ((uNumPkts > 1) && (pRxQueue->tReceivePacketListCB != NULL))
+    {
+        pRxQueue->tReceivePacketListCB (pRxQueue->hReceivePacketListCB_handle, pRxQueue->aRunPackets, uNumPkts);
+    }
+    else
+    {
+        for (i = 0; i < uNumPkts; i++)
+        {
+            pRxQueue->tReceivePacketCB (pRxQueue->hReceivePacketCB_handle, pRxQueue->aRunPackets[i]);
+        }
+    }
+}
+
+
+/** 
+ * \fn     RxQueue_MoveWindow()
+ * \brief  Move the window start forward, and add the saved packets before it to the in-order chain
+ *
+ * The missing packets before the new window start are counted as holes.
+ *
+ * \note   The chain is passed by RxQueue_PassRun (with the run at the new window start)
+ * \param  pRxQueue       - RxQueue handle.
+ * \param  pTidDataBase   - The TID
+ * \param  uNewWinStartSn - The new window start (higher than the ESN)
+ * \return void
+ * \sa     RxQueue_PassRun
+ */ 
+static void RxQueue_MoveWindow (TRxQueue *pRxQueue, TRxQueueTidDataBase *pTidDataBase, TI_UINT16 uNewWinStartSn)
+{
+    TI_UINT32 uDelta = (uNewWinStartSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK;
+    TI_UINT64 uMap   = pTidDataBase->uStoredMap & RX_QUEUE_WIN_MAP(uDelta);
+    TI_UINT32 uNumPkts = 0;
+
+    /* Add the saved packets before the new window start in order (their offsets are the set bits) */
+    while (uMap)
+    {
+        TI_UINT32 uOffset = RxQueue_TrailingOnes (~uMap);
+        TRxQueuePacketEntry *pEntry = &pTidDataBase->aPaketsQueue[(pTidDataBase->aTidExpectedSn + uOffset) & RX_QUEUE_ARRAY_SIZE_BIT_MASK];
+
+        RxQueue_AddToRun (pRxQueue, pEntry->pPacket, pEntry->tStatus);
+        pEntry->pPacket = NULL;
+        uMap &= uMap - 1;
+        uNumPkts++;
+    }
+
+    /* The holes within the window (a BAR may move the window much further) */
+    pTidDataBase->tStats.uHoles  += ((uDelta < pTidDataBase->aTidWinSize) ? uDelta : pTidDataBase->aTidWinSize) - uNumPkts;
+
+    pTidDataBase->uStoredMap      = RX_QUEUE_SHIFT_MAP (pTidDataBase->uStoredMap, uDelta);
+    pTidDataBase->uNumStored     -= uNumPkts;
+    pTidDataBase->aTidExpectedSn  = uNewWinStartSn;
+}
+
+
+/** 
+ * \fn     RxQueue_UpdateTimer()
+ * \brief  Start, restart or stop the TID reorder timer
+ *
+ * The timer runs while packets are saved. It is restarted when the window start moves.
+ *
+ * \note   
+ * \param  pTidDataBase   - The TID
+ * \param  bWinStartMoved - TI_TRUE if the window start moved since the timer was started
+ * \return void
+ * \sa     RxQueue_PacketTimeOut
+ */ 
+static void RxQueue_UpdateTimer (TRxQueueTidDataBase *pTidDataBase, TI_BOOL bWinStartMoved)
+{
+    if (pTidDataBase->uStoredMap == 0)
+    {
+        if (pTidDataBase->bTimerRunning)
+        {
+            tmr_StopTimer (pTidDataBase->hTimer);
+            pTidDataBase->bTimerRunning = TI_FALSE;
+        }
+    }
+    else if (!pTidDataBase->bTimerRunning || bWinStartMoved)
+    {
+        if (pTidDataBase->bTimerRunning)
+        {
+            tmr_StopTimer (pTidDataBase->hTimer);
+        }
+        tmr_StartTimer (pTidDataBase->hTimer, RxQueue_PacketTimeOut, (TI_HANDLE)pTidDataBase, BA_SESSION_TIME_TO_SLEEP, TI_FALSE);
+        pTidDataBase->bTimerRunning = TI_TRUE;
+    }
+}
+
+
+/** 
+ * \fn     RxQueue_TrailingOnes()
+ * \brief  Count the trailing (least significant) set bits of a window bitmap
+ *
+ * \note   For the trailing zeros use the inverted bitmap
+ * \param  uMap - The bitmap
+ * \return The number of consecutive set bits from bit 0 (0 - 64)
+ * \sa     
+ */ 
+static TI_UINT32 RxQueue_TrailingOnes (TI_UINT64 uMap)
+{
+#if defined(__GNUC__)
+    return (~uMap) ? (TI_UINT32)__builtin_ctzll (~uMap) : RX_QUEUE_ARRAY_SIZE;
+#else
+    /* The trailing ones of each 4 bits value */
+    static const TI_UINT8 aTrailingOnes[16] = { 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0, 4 };
+    TI_UINT32 uCount = 0;
+
+    while (((uMap & 0xF) == 0xF) && (uCount < RX_QUEUE_ARRAY_SIZE))
+    {
+        uMap >>= 4;
+        uCount += 4;
+    }
+    return (uCount < RX_QUEUE_ARRAY_SIZE) ? uCount + aTrailingOnes[uMap & 0xF] : uCount;
+#endif
+}
+
+
 /** 
  * \fn     RxQueue_ReceivePacket()
  * \brief  Main function of the RxQueue module. 
  * Responsible on reorder of the packets from the RxXfer to the RX module.
  * Call from RxXfer in order to pass packet to uppers layers.
  * In order to save disordered packets the module use array of structures per TID 
- * that each entry describe a packet. The array elements is sorted in the way that 
- * the winStart array index represent always the winStart packet and the lowest SN. 
- * Each increment index represent index at the BA window. Array index winEnd  always 
- * represent winEnd packet. The indexes of winStart and winEnd handled in cyclic manner.
+ * that each entry describe a packet. The packet with sequence number SN is saved at 
+ * array index (SN % RX_QUEUE_ARRAY_SIZE), and a 64 bits bitmap per TID holds the saved
+ * packets relative to the window start (bit 0 is the expected SN). The in-order run at the
+ * window start is the bitmap trailing ones, and it is passed to the upper layers as one chain.
  *
  * SN range      :  0 - 4095
- * winStart range:  0 - 7       [0 - (RX_QUEUE_ARRAY_SIZE - 1)]
- * winSize       :  Determined by the BA session. We limit it to maximum 8 [RX_QUEUE_ARRAY_SIZE]
+ * winSize       :  Determined by the BA session. We limit it to maximum 8 [RX_QUEUE_WIN_SIZE]
  * winEnd        :  = winStart + winSize - 1
  *
  * The function functionality devided to parts:
  *   Part 1: 
  * In case the module received a packet with SN equal to the expected SN: 
- * "	pass it to upper layers
- * "	increases winStart and array index winStart
- * "	validate that all sequential queue packet are pass to the upper layers.
+ * "	pass it to upper layers with all sequential saved packets, and move winStart after them.
  *   Part 2: 
  * In case the module received a packet with SN between winStart to winEnd: 
- * "	Save it sorted at the array at index: Save index = ((SN - winStart) + index array winStart) % arraySize.
+ * "	Save it at the array and set its bit.
  *   Part 3: 
  * In case the module received a packet with SN higher than winEnd: 
  * "	Update winStart and WinEnd. 
- * "	Save it sorted at the array in index winEnd index.
- * "	Pass to the upper layers all packets at the array indexes from old winStart index to the updated winStart index.
+ * "	Pass to the upper layers all packets saved before the updated winStart.
+ * "	Save it at winEnd and pass the sequential saved packets from the updated winStart.
  *   Part 4 + 5: 
  * In case the module received a BA event packet: [Remember: This is an Rx module - We expect BAR and not BA (as well as ADDBE / DELBA]
  * "	Update winStart and WinEnd 
- * "	Pass to the upper layers all packets at the array indexes from old winStart index to the updated winStart index.
+ * "	Pass to the upper layers all packets saved before the updated winStart.
  * "	Free BA event packet via pass it to upper layers with error status.
  *
+ * If packets are saved for BA_SESSION_TIME_TO_SLEEP msec without the window start moving,
+ *     the TID timer skips the missing packets and passes the next run (see RxQueue_PacketTimeOut).
+ *
  * \note   
  * \param  hRxQueue - RxQueue handle.
  * \param  aStatus - RxXfer status that indicate if the upper layer should free the packet or use it.
@@ -505,76 +733,20 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
          */
 
 
+
         /* Part 1 - Received Frame Sequence Number is the expected one ? */
         if (uFrameSn == pTidDataBase->aTidExpectedSn)
         {
             TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: frame Sequence Number == expected one Sequence Number.\n");
 
+            /* Pass the packet with all saved queue consecutive packets with SN higher than the expected one */
+            RxQueue_AddToRun (pRxQueue, pBuffer, tStatus);
+            pTidDataBase->aTidExpectedSn = (pTidDataBase->aTidExpectedSn + 1) & SEQ_NUM_MASK;
+            pTidDataBase->uStoredMap >>= 1;
+            RxQueue_PassRun (pRxQueue, pTidDataBase);
 
-            /* 
-               If the expected SN received and timer was running - Stop the timer.
-
-               If we wait for more than one packet we should not stop the timer - This is why we are checking after the while loop, if we have 
-               more packets stored, and if we have, we start the timer again.
-            */
-            if (pRxQueue->tPacketTimeout.bPacketMiss)
-            {
-                tmr_StopTimer (pRxQueue->hTimer);
-                pRxQueue->tPacketTimeout.bPacketMiss = TI_FALSE;
-            }
-
-
-            /* Pass the packet */
-            RxQueue_PassPacket (pRxQueue, TI_OK, pBuffer);
-
-            /* Increase expected SN to the next */
-            pTidDataBase->aTidExpectedSn++;
-            pTidDataBase->aTidExpectedSn &= 0xfff;  /* SN is 12 bits long */
-
-            /* Increase the ArrayInex to the next */
-            pTidDataBase->aWinStartArrayInex++;
-
-            /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-            pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-
-
-            /* Pass all saved queue consecutive packets with SN higher than the expected one */
-            while (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)
-            {
-                TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Pass all saved queue packets with SN higher than the expected one that was just received.");
-                TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aTidExpectedSn = 0x%x(%d)", pTidDataBase->aTidExpectedSn, pTidDataBase->aTidExpectedSn);
-                TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aWinStartArrayInex = 0x%x(%d)", pTidDataBase->aWinStartArrayInex, pTidDataBase->aWinStartArrayInex);
-
-                RxQueue_PassPacket (pRxQueue, 
-                                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
-
-                pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-
-                pTidDataBase->aWinStartArrayInex++;
-
-                /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-                pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-
-                 pTidDataBase->aTidExpectedSn++;
-				 pTidDataBase->aTidExpectedSn &= 0xfff; /* SN is 12 bits long */
-
-				 /* Decrease the packets in queue */
-                pRxQueue->tPacketTimeout.aPacketsStored--;
-            }
-
-
-            /* aTidExpectedSn % 0xfff in order to tack care of wrap around */
-            pTidDataBase->aTidExpectedSn &= 0xfff; 
-
-            /* If there are still packets stored in the queue - start timer */
-			if (pRxQueue->tPacketTimeout.aPacketsStored)
-            {
-                tmr_StartTimer (pRxQueue->hTimer, RxQueue_PacketTimeOut, pRxQueue, BA_SESSION_TIME_TO_SLEEP, TI_FALSE);
-
-                pRxQueue->tPacketTimeout.bPacketMiss = TI_TRUE;
-                pRxQueue->tPacketTimeout.aFrameTid   = uFrameTid;
-            }
+            /* If there are still packets stored in the queue - restart the timer, else stop it */
+            RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
 
             return;
         }
@@ -593,46 +765,43 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
 
 
         /* Part 2 - Frame Sequence Number between winStart and winEnd ? */
-        if ((BA_SESSION_IS_A_BIGGER_THAN_B (uFrameSn, pTidDataBase->aTidExpectedSn)) &&
-            /* mean: uFrameSn <= pTidDataBase->aTidExpectedSn + pTidDataBase->aTidWinSize) */
-            ( ! BA_SESSION_IS_A_BIGGER_THAN_B (uFrameSn,(pTidDataBase->aTidExpectedSn + pTidDataBase->aTidWinSize - 1))))
+        /* mean: uFrameSn <= pTidDataBase->aTidExpectedSn + pTidDataBase->aTidWinSize - 1) [the offset handles the SN wrap around] */
+        if (((uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK) < pTidDataBase->aTidWinSize)
         {
-            TI_UINT16 uSaveIndex = pTidDataBase->aWinStartArrayInex + (TI_UINT16)((uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK);
-        
-            /* uSaveIndex % RX_QUEUE_ARRAY_SIZE */
-            uSaveIndex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK; 
+            TI_UINT32 uOffset    = (uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK;
+            TI_UINT64 uBit       = (TI_UINT64)1 << uOffset;
+            TI_UINT32 uSaveIndex = uFrameSn & RX_QUEUE_ARRAY_SIZE_BIT_MASK;
 
             TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: frame Sequence Number between winStart and winEnd.\n");
             TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: uSaveIndex = 0x%x(%d)",uSaveIndex,uSaveIndex);
 
             /* Before storing packet in queue, make sure the place in the queue is vacant */
-			if (pTidDataBase->aPaketsQueue[uSaveIndex].pPacket == NULL)
-			{
-                TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Enter packet to Reorder Queue");
-                
-                /* Store the packet in the queue */
-                pTidDataBase->aPaketsQueue[uSaveIndex].tStatus  = tStatus;
-                pTidDataBase->aPaketsQueue[uSaveIndex].pPacket  = (void *)pBuffer;
-                pTidDataBase->aPaketsQueue[uSaveIndex].uFrameSn = uFrameSn;
+            if (pTidDataBase->uStoredMap & uBit)
+            {
+                TRACE1(pRxQueue->hReport, REPORT_SEVERITY_ERROR, "RxQueue_ReceivePacket: frame Sequence has already saved. uFrameSn = %d\n", uFrameSn);
+
+                pTidDataBase->tStats.uDuplicates++;
+                RxQueue_PassPacket (pRxQueue, TI_NOK, pBuffer);
+                return;
+            }
+
+            TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Enter packet to Reorder Queue");
 
-				pRxQueue->tPacketTimeout.aPacketsStored++;
+            /* Store the packet in the queue */
+            pTidDataBase->aPaketsQueue[uSaveIndex].tStatus  = tStatus;
+            pTidDataBase->aPaketsQueue[uSaveIndex].pPacket  = (void *)pBuffer;
+            pTidDataBase->aPaketsQueue[uSaveIndex].uFrameSn = uFrameSn;
+            pTidDataBase->uStoredMap |= uBit;
+            pTidDataBase->uNumStored++;
 
-           
-				/* Start Timer [only if timer is not already started - according to bPacketMiss] */
-                if(pRxQueue->tPacketTimeout.bPacketMiss == TI_FALSE)
-                {     
-				    tmr_StartTimer (pRxQueue->hTimer, RxQueue_PacketTimeOut, pRxQueue, BA_SESSION_TIME_TO_SLEEP, TI_FALSE);
-				    pRxQueue->tPacketTimeout.bPacketMiss = TI_TRUE;
-				    pRxQueue->tPacketTimeout.aFrameTid   = uFrameTid;
-			    }
+            pTidDataBase->tStats.uStoredPkts++;
+            if (pTidDataBase->uNumStored > pTidDataBase->tStats.uMaxDepth)
+            {
+                pTidDataBase->tStats.uMaxDepth = pTidDataBase->uNumStored;
             }
-			else
-			{
- 				 TRACE1(pRxQueue->hReport, REPORT_SEVERITY_ERROR, "RxQueue_ReceivePacket: frame Sequence has already saved. uFrameSn = %d\n", uFrameSn);
 
-				 RxQueue_PassPacket (pRxQueue, TI_NOK, pBuffer);
-				 return;
-			}
+            /* Start Timer [only if timer is not already started] */
+            RxQueue_UpdateTimer (pTidDataBase, TI_FALSE);
 
             return;
         }
@@ -641,144 +810,47 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
         /* 
         Part 3 - Frame Sequence Number higher than winEnd ? 
         */
-        if ( BA_SESSION_IS_A_BIGGER_THAN_B (uFrameSn, (pTidDataBase->aTidExpectedSn + pTidDataBase->aTidWinSize - 1)) )
         {
-            TI_UINT32 i;
             TI_UINT16 uNewWinStartSn = (uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidWinSize + 1) & SEQ_NUM_MASK;
-            TI_UINT16 uSaveIndex;
-            
-            
-			TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: frame Sequence Number higher than winEnd.\n");
-            TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: uNewWinStartSn = 0x%x(%d) STOP TIMER",uNewWinStartSn,uNewWinStartSn);
-
-            /* If timer is on - stop it */
-			if (pRxQueue->tPacketTimeout.bPacketMiss) 
-            {
-                tmr_StopTimer (pRxQueue->hTimer);
-                pRxQueue->tPacketTimeout.bPacketMiss = TI_FALSE;
-            }
-
-            /* Increase the ArrayInex to the next */
-            pTidDataBase->aWinStartArrayInex++;
-
-            /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-            pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
+            TI_UINT32 uSaveIndex     = uFrameSn & RX_QUEUE_ARRAY_SIZE_BIT_MASK;
 
-            /* Update the Expected SN since the current one is lost */
-            pTidDataBase->aTidExpectedSn++;
-            pTidDataBase->aTidExpectedSn &= 0xFFF;
+            TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: frame Sequence Number higher than winEnd.\n");
+            TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: uNewWinStartSn = 0x%x(%d)",uNewWinStartSn,uNewWinStartSn);
 
-            /* Pass all saved queue packets with SN lower than the new win start */
-            for (i = 0;
-                 BA_SESSION_IS_A_BIGGER_THAN_B(uNewWinStartSn,pTidDataBase->aTidExpectedSn) && 
-                  (i < RX_QUEUE_ARRAY_SIZE) && 
-                  (i < pTidDataBase->aTidWinSize);
-                 i++)
-            {
-                TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aTidExpectedSn = 0x%x(%d)",pTidDataBase->aTidExpectedSn,pTidDataBase->aTidExpectedSn);
-                TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aWinStartArrayInex = 0x%x(%d)",pTidDataBase->aWinStartArrayInex,pTidDataBase->aWinStartArrayInex);
-
-                if (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)
-                {
-                    TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Send Packet to Upper layer");
-                    RxQueue_PassPacket (pRxQueue, 
-                                        pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                        pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
-
-                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-
-					pRxQueue->tPacketTimeout.aPacketsStored--;
-                }
-
-                pTidDataBase->aWinStartArrayInex++;
-
-                /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-                pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-
-                pTidDataBase->aTidExpectedSn++;
-                pTidDataBase->aTidExpectedSn &= 0xFFF;
+            /* Pass all saved queue packets with SN lower than the new win start (the missing ones are lost) */
+            RxQueue_MoveWindow (pRxQueue, pTidDataBase, uNewWinStartSn);
 
-            }
-
-            TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aTidExpectedSn = 0x%x(%d)",pTidDataBase->aTidExpectedSn,pTidDataBase->aTidExpectedSn);
-            TRACE1(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: i = %d",i);
-
-            /* Calculate the new Expected SN */
-            if (i == pTidDataBase->aTidWinSize)
+            if (pTidDataBase->aTidExpectedSn == uFrameSn)
             {
-                TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Set aTidExpectedSn to uNewWinStartSn");
-                pTidDataBase->aTidExpectedSn = uNewWinStartSn;
+                /* Window of one packet - pass the current packet */
+                RxQueue_AddToRun (pRxQueue, pBuffer, tStatus);
+                pTidDataBase->aTidExpectedSn = (pTidDataBase->aTidExpectedSn + 1) & SEQ_NUM_MASK;
             }
             else
             {
-                TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Send all saved packets");
-                /* In case the uWinStartDelta lower than aTidWinSize - check if there are packets stored in Array */
- 
-                while (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL) 
-                {
-                    TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Send packet with SN = 0x%x(%d)",pTidDataBase->aTidExpectedSn,pTidDataBase->aTidExpectedSn);
-                
-                    RxQueue_PassPacket ( pRxQueue, 
-                                         pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                         pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket
-                                       );
-    
-                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-    
-                    pTidDataBase->aWinStartArrayInex++;
-    
-                    /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-                    pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-    
-                    pTidDataBase->aTidExpectedSn++;
-                    pTidDataBase->aTidExpectedSn &= 0xFFF;
+                TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Enter current packet to Reorder Queue, uSaveIndex = 0x%x(%d)", uSaveIndex, uSaveIndex);
 
+                /* Save the packet in the last entry of the window */
+                pTidDataBase->aPaketsQueue[uSaveIndex].tStatus  = tStatus;
+                pTidDataBase->aPaketsQueue[uSaveIndex].pPacket  = (void *)pBuffer;
+                pTidDataBase->aPaketsQueue[uSaveIndex].uFrameSn = uFrameSn;
+                pTidDataBase->uStoredMap |= (TI_UINT64)1 << (pTidDataBase->aTidWinSize - 1);
+                pTidDataBase->uNumStored++;
 
-                    pRxQueue->tPacketTimeout.aPacketsStored--;
+                pTidDataBase->tStats.uStoredPkts++;
+                if (pTidDataBase->uNumStored > pTidDataBase->tStats.uMaxDepth)
+                {
+                    pTidDataBase->tStats.uMaxDepth = pTidDataBase->uNumStored;
                 }
             }
 
-            TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aTidExpectedSn = 0x%x(%d)",pTidDataBase->aTidExpectedSn,pTidDataBase->aTidExpectedSn);
-
-            if(pTidDataBase->aTidExpectedSn == uFrameSn)
-            {
-                TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Send current packet to uper layer");
-                /* pass the packet */
-                RxQueue_PassPacket (pRxQueue, tStatus, pBuffer);
-
-                pTidDataBase->aTidExpectedSn++;
-				pTidDataBase->aTidExpectedSn &= 0xfff; 
-            }
-            else
-            {
-                uSaveIndex = pTidDataBase->aWinStartArrayInex + (TI_UINT16)((uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK);  
-
-                TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Enter current packet to Reorder Queue");
-                TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: uSaveIndex = 0x%x(%d)", uSaveIndex, uSaveIndex);
-
-				/* uSaveIndex % RX_QUEUE_ARRAY_SIZE */
-				uSaveIndex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK; 
-
-				/* Save the packet in the last entry of the queue */
-				pTidDataBase->aPaketsQueue[uSaveIndex].tStatus = tStatus;
-				pTidDataBase->aPaketsQueue[uSaveIndex].pPacket = (void *)pBuffer;
-				pTidDataBase->aPaketsQueue[uSaveIndex].pPacket = (void *)pBuffer;
-
-               pRxQueue->tPacketTimeout.aPacketsStored++;
-            }
-
+            /* Pass the packets before the new win start with the saved run at it */
+            RxQueue_PassRun (pRxQueue, pTidDataBase);
 
+            TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aTidExpectedSn = 0x%x(%d)",pTidDataBase->aTidExpectedSn,pTidDataBase->aTidExpectedSn);
 
-            /* aTidExpectedSn % 0xfff in order to take care of wrap around */
-            pTidDataBase->aTidExpectedSn &= 0xfff; 
-
-            /* If there are still packets stored in the queue - start timer */
-			if (pRxQueue->tPacketTimeout.aPacketsStored) 
-            {
-                tmr_StartTimer (pRxQueue->hTimer, RxQueue_PacketTimeOut, pRxQueue, BA_SESSION_TIME_TO_SLEEP, TI_FALSE);
-                pRxQueue->tPacketTimeout.bPacketMiss = TI_TRUE;
-                pRxQueue->tPacketTimeout.aFrameTid   = uFrameTid;
-            }
+            /* If there are still packets stored in the queue - restart the timer, else stop it */
+            RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
 
             return;
         }
@@ -798,11 +870,9 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
         TI_UINT16           ufc;
         TI_UINT8            uFrameTid;
         TI_UINT16           uStartingSequenceNumber;
-        TI_UINT16           uWinStartDelta;
         TI_UINT16           uBarControlField;
         TI_UINT16           uBaStartingSequenceControlField;
         TI_UINT16           uBAParameterField;         
-        TI_UINT32           i;
 
         
         /* Get the frame's sub type from its header */
@@ -855,48 +925,12 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
             /* Starting Sequence Number is higher than Expcted SN ? */
             if ( BA_SESSION_IS_A_BIGGER_THAN_B (uStartingSequenceNumber, pTidDataBase->aTidExpectedSn) )
             {
-                uWinStartDelta = uStartingSequenceNumber - pTidDataBase->aTidExpectedSn;
-                
-                /* If timer is on - stop it. Later on we may start it again [in case we still have packets stored] */
-                if (pRxQueue->tPacketTimeout.bPacketMiss) 
-                {
-                    tmr_StopTimer (pRxQueue->hTimer);
-                    pRxQueue->tPacketTimeout.bPacketMiss = TI_FALSE;
-                }
-
-                /* Pass all saved queue packets with SN lower than the new win start */
-                for (i = 0;
-                     ((i < uWinStartDelta) || (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)) &&
-                      (i < RX_QUEUE_ARRAY_SIZE) && 
-                      (i < RX_QUEUE_WIN_SIZE);
-                     i++)
-                {
-                    if (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)
-                    {
-                        RxQueue_PassPacket (pRxQueue, 
-                                            pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                            pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
-
-                        pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-                        pRxQueue->tPacketTimeout.aPacketsStored--;
-                    }
-
-                    pTidDataBase->aWinStartArrayInex++;
-
-                    /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-                    pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-                }
-
-                /* If there are still packets stored - start the timer */
-                if (pRxQueue->tPacketTimeout.aPacketsStored) 
-                {
-                    tmr_StartTimer (pRxQueue->hTimer, RxQueue_PacketTimeOut, pRxQueue, BA_SESSION_TIME_TO_SLEEP, TI_FALSE);
-                    pRxQueue->tPacketTimeout.bPacketMiss = TI_TRUE;
-                    pRxQueue->tPacketTimeout.aFrameTid   = uFrameTid;
-                }
-
+                /* Pass all saved queue packets with SN lower than the new win start, and the saved run at it */
+                RxQueue_MoveWindow (pRxQueue, pTidDataBase, uStartingSequenceNumber);
+                RxQueue_PassRun (pRxQueue, pTidDataBase);
 
-                pTidDataBase->aTidExpectedSn = uStartingSequenceNumber;
+                /* If there are still packets stored - restart the timer, else stop it */
+                RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
             }
             break;
 
@@ -943,13 +977,14 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
                     return;
                 }
 
+                /* get winSize from ADDBA action frame */
                 /* get winSize from ADDBA action frame */
                 pTidDataBase->aTidWinSize = (uBAParameterField & DOT11_BA_PARAMETER_SET_FIELD_WINSIZE_BITS) >> 6; 
 
                 /* winSize illegal value ? */ 
-                if (pTidDataBase->aTidWinSize > RX_QUEUE_WIN_SIZE)
+                if ((pTidDataBase->aTidWinSize > RX_QUEUE_WIN_SIZE) || (pTidDataBase->aTidWinSize == 0))
                 {
-                    /* In case the win Size is higher than 8 the driver and the FW set it to 8 and inform the AP in ADDBA respond */
+                    /* In case the win Size is higher than 8 (or not set) the driver and the FW set it to 8 and inform the AP in ADDBA respond */
                     pTidDataBase->aTidWinSize = RX_QUEUE_WIN_SIZE;
                 }
 
@@ -961,7 +996,8 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
                 pDataFrameBody = pDataFrameBody + 4;
                 COPY_WLAN_WORD (&uStartingSequenceNumber, (TI_UINT16 *)pDataFrameBody); /* copy with endianess handling. */
                 pTidDataBase->aTidExpectedSn = (uStartingSequenceNumber & DOT11_SC_SEQ_NUM_MASK) >> 4;
-                pTidDataBase->aWinStartArrayInex = 0;
+                pTidDataBase->uStoredMap = 0;
+                pTidDataBase->uNumStored = 0;
                 os_memoryZero (pRxQueue->hOs, pTidDataBase->aPaketsQueue, sizeof (TRxQueuePacketEntry) * RX_QUEUE_ARRAY_SIZE);
 
                 break;
@@ -1031,68 +1067,95 @@ Function Name : RxQueue_PacketTimeOut
 
 Description   : This function sends all consecutive old packets stored in a specific TID queue to the upper layer.
 
-                This function is called on timer wake up. 
-                [The timer is started when we have stored packets in the RxQueue].
+                This function is called on the TID timer wake up. 
+                [The timer is started when we have stored packets in the TID queue].
+                The missing packets before the first stored one are considered lost (counted as holes).
                 
 
-Parameters    : hRxQueue        - A handle to the RxQueue structure.
+Parameters    : hTidDataBase    - A handle to the TID queue structure.
                 bTwdInitOccured - Not used.
 
 Returned Value: void
 */
-static void RxQueue_PacketTimeOut (TI_HANDLE hRxQueue, TI_BOOL bTwdInitOccured)
+static void RxQueue_PacketTimeOut (TI_HANDLE hTidDataBase, TI_BOOL bTwdInitOccured)
 {
-    TRxQueue            *pRxQueue   = (TRxQueue *)hRxQueue;
-    TRxQueueTidDataBase *pTidDataBase;
+    TRxQueueTidDataBase *pTidDataBase = (TRxQueueTidDataBase *)hTidDataBase;
+    TRxQueue            *pRxQueue     = (TRxQueue *)pTidDataBase->hRxQueue;
+    TI_UINT32            uNumMissing;
 
-    pRxQueue->tPacketTimeout.bPacketMiss = TI_FALSE;
+    pTidDataBase->bTimerRunning = TI_FALSE;
 
-    /* Set the SA Tid pointer */
-    pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[pRxQueue->tPacketTimeout.aFrameTid]);
-
-
-    if (pRxQueue->tPacketTimeout.aPacketsStored) 
+    if (pTidDataBase->uStoredMap) 
     {
+        /* Skip to the first stored packet */
+        uNumMissing = RxQueue_TrailingOnes (~pTidDataBase->uStoredMap);
+        pTidDataBase->uStoredMap    >>= uNumMissing;
+        pTidDataBase->aTidExpectedSn  = (pTidDataBase->aTidExpectedSn + uNumMissing) & SEQ_NUM_MASK;
+        pTidDataBase->tStats.uHoles  += uNumMissing;
+        pTidDataBase->tStats.uTimeoutFlushes++;
 
-        /* Find the first stored packet */
-        while (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket == NULL) 
-        {
-            pTidDataBase->aWinStartArrayInex++;
-    
-            /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-            pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-        
-            pTidDataBase->aTidExpectedSn++;
-            pTidDataBase->aTidExpectedSn &= 0xFFF;
-        }
+        TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_PacketTimeOut: skipped %d missing packets, aTidExpectedSn = %d\n", uNumMissing, pTidDataBase->aTidExpectedSn);
 
+        /* Send all consecutive packets in order */
+        RxQueue_PassRun (pRxQueue, pTidDataBase);
+    }
 
-        /* Send all packets in order */
-        while ((pRxQueue->tPacketTimeout.aPacketsStored > 0) && (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)) 
-        {
+    /* If there are still packets stored in the queue - restart the timer */
+    RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
+}
 
-            RxQueue_PassPacket (pRxQueue, 
-                                pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
-    
-            pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
 
-            pTidDataBase->aWinStartArrayInex++;
+#ifdef TI_DBG
+/** 
+ * \fn     RxQueue_PrintStats
+ * \brief  Print the reorder statistics of the TIDs with BA session
+ * 
+ * \note   
+ * \param  hRxQueue - The module object
+ * \return void
+ * \sa     RxQueue_ClearStats
+ */ 
+void RxQueue_PrintStats (TI_HANDLE hRxQueue)
+{
+#ifdef REPORT_LOG
+    TRxQueue  *pRxQueue = (TRxQueue *)hRxQueue;
+    TI_UINT32  uTid;
 
-            /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-            pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
+    WLAN_OS_REPORT(("Print RX Reorder Statistics\n"));
+    WLAN_OS_REPORT(("===========================\n"));
+    WLAN_OS_REPORT(("TID BA WinSize ESN  Stored Queued MaxDepth Holes  Timeouts Runs   Duplicates\n"));
 
-            pTidDataBase->aTidExpectedSn++;
-            pTidDataBase->aTidExpectedSn &= 0xFFF;
+    for (uTid = 0; uTid < MAX_NUM_OF_802_1d_TAGS; uTid++)
+    {
+        TRxQueueTidDataBase *pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uTid]);
+        TRxQueueTidStats    *pStats       = &pTidDataBase->tStats;
 
-            pRxQueue->tPacketTimeout.aPacketsStored--;
-            
-        }
+        WLAN_OS_REPORT(("%-3d %-2d %-7d %-4d %-6d %-6d %-8d %-6d %-8d %-6d %d\n", 
+                        uTid, pTidDataBase->aTidBaEstablished, pTidDataBase->aTidWinSize, pTidDataBase->aTidExpectedSn,
+                        pStats->uStoredPkts, pTidDataBase->uNumStored, pStats->uMaxDepth, pStats->uHoles,
+                        pStats->uTimeoutFlushes, pStats->uReleasedRuns, pStats->uDuplicates));
     }
+#endif
+}
+
+
+/** 
+ * \fn     RxQueue_ClearStats
+ * \brief  Clear the reorder statistics
+ * 
+ * \note   
+ * \param  hRxQueue - The module object
+ * \return void
+ * \sa     RxQueue_PrintStats
+ */ 
+void RxQueue_ClearStats (TI_HANDLE hRxQueue)
+{
+    TRxQueue  *pRxQueue = (TRxQueue *)hRxQueue;
+    TI_UINT32  uTid;
 
-    if (pRxQueue->tPacketTimeout.aPacketsStored) 
+    for (uTid = 0; uTid < MAX_NUM_OF_802_1d_TAGS; uTid++)
     {
-        tmr_StartTimer (pRxQueue->hTimer, RxQueue_PacketTimeOut, pRxQueue, BA_SESSION_TIME_TO_SLEEP, TI_FALSE);
-        pRxQueue->tPacketTimeout.bPacketMiss = TI_TRUE;
+        os_memoryZero (pRxQueue->hOs, &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uTid].tStats), sizeof(TRxQueueTidStats));
     }
 }
+#endif /* TI_DBG */
@@ -242,6 +242,65 @@ void txCtrlBlk_Free (TI_HANDLE hTxCtrlBlk, TTxCtrlBlk *pCurrentEntry)
 }
 
 
+/****************************************************************************
+ *					txCtrlBlk_FreeList()
+ ****************************************************************************
+ * DESCRIPTION:
+	Free a list of entries (e.g. upon Tx-complete of multiple packets).
+	The entries are chained in the given order outside the critical section,
+	  and the chain is linked after entry 0 with one lock.
+ ****************************************************************************/
+void txCtrlBlk_FreeList (TI_HANDLE hTxCtrlBlk, TTxCtrlBlk **apEntries, TI_UINT32 uNumEntries)
+{
+    TTxCtrlBlkObj   *pTxCtrlBlk = (TTxCtrlBlkObj *)hTxCtrlBlk;
+    TTxCtrlBlk *pFirstFreeEntry = &(pTxCtrlBlk->aTxCtrlBlkTbl[0]);
+    TTxCtrlBlk *pChainHead = NULL;
+    TTxCtrlBlk *pChainTail = NULL;
+    TI_UINT32   i;
+
+    if (!pTxCtrlBlk)
+    {
+        return;
+    }
+
+    for (i = 0; i < uNumEntries; i++)
+    {
+#ifdef TI_DBG
+        /* If the pointed entry is already free, print error and skip it (not expected to happen). */
+        if (apEntries[i]->pNextFreeEntry != 0)
+        {
+            TRACE2(pTxCtrlBlk->hReport, REPORT_SEVERITY_ERROR, "txCtrlBlk_FreeList(): Entry %d alredy free, UsedEntries=%d\n", apEntries[i]->tTxDescriptor.descID, pTxCtrlBlk->uNumUsedEntries);
+            continue;
+        }
+        pTxCtrlBlk->uNumUsedEntries--;
+#endif
+        if (pChainTail)
+        {
+            pChainTail->pNextFreeEntry = apEntries[i];
+        }
+        else
+        {
+            pChainHead = apEntries[i];
+        }
+        pChainTail = apEntries[i];
+    }
+
+    if (!pChainHead)
+    {
+        return;
+    }
+
+    /* Protect block freeing from preemption (may be called from external context) */
+    context_EnterCriticalSection (pTxCtrlBlk->hContext);
+
+    /* Link the freed chain between entry 0 and the next free entry. */
+    pChainTail->pNextFreeEntry      = pFirstFreeEntry->pNextFreeEntry;
+    pFirstFreeEntry->pNextFreeEntry = pChainHead;
+
+    context_LeaveCriticalSection (pTxCtrlBlk->hContext);
+}
+
+
 /****************************************************************************
  *					txCtrlBlk_GetPointer()
  ****************************************************************************
@@ -311,32 +311,17 @@ TI_STATUS txHwQueue_Restart (TI_HANDLE hTxHwQueue)
 
 
 /****************************************************************************
- *                  txHwQueue_AllocResources()
+ *                  txHwQueue_CalcPktBlks()
  ****************************************************************************
  * DESCRIPTION:
    ============
-    1.  Estimate required HW-blocks number.
-    2.  If the required blocks are not available or no free descriptor,
-            return  STOP_CURRENT  (to stop current queue and requeue the packet).
-    3.  Resources are available so update allocated blocks and descriptors counters.
-    4.  If no resources for another similar packet, return STOP_NEXT (to stop current queue).
-        Else, return SUCCESS
+    Estimate the HW-blocks number required for the given packet.
  ****************************************************************************/
-ETxHwQueStatus txHwQueue_AllocResources (TI_HANDLE hTxHwQueue, TTxCtrlBlk *pTxCtrlBlk)
+static inline TI_UINT32 txHwQueue_CalcPktBlks (TTxHwQueue *pTxHwQueue, TTxCtrlBlk *pTxCtrlBlk)
 {
-    TTxHwQueue *pTxHwQueue = (TTxHwQueue *)hTxHwQueue;
     TI_UINT32 uTotalLength;    /* The current packet length plus overhead due to header translation */
     TI_UINT32 uNumBlksToAlloc; /* The number of blocks required for the current packet. */
     TI_UINT32 uExcludedLength; /* The data length not included in the rough blocks calculation */
-    TI_UINT32 uAvailableBlks;  /* Max blocks that are currently available for this queue. */
-    TI_UINT32 uReservedBlks;   /* How many blocks are reserved for this queue before this allocation. */
-    TI_UINT32 uQueueId = WMEQosTagToACTable[pTxCtrlBlk->tTxDescriptor.tid];
-    TTxHwQueueInfo *pQueueInfo = &(pTxHwQueue->aTxHwQueueInfo[uQueueId]);
-
-
-    /***********************************************************************/
-    /*  Calculate packet required HW blocks.                               */
-    /***********************************************************************/
 
     uTotalLength = pTxCtrlBlk->tTxDescriptor.length + 20 + MAX_HEADER_SIZE - ETHERNET_HDR_LEN;
 #ifdef TNETW1283
@@ -362,42 +347,50 @@ ETxHwQueStatus txHwQueue_AllocResources (TI_HANDLE hTxHwQueue, TTxCtrlBlk *pTxCt
     /* Add extra blocks needed in case of fragmentation */
     uNumBlksToAlloc += pTxHwQueue->uExtraHwBlocks;
 
-    /***********************************************************************/
-    /*            Check if the required resources are available            */
-    /***********************************************************************/
-
-    /* Find max available blocks for this queue (0 could indicate no descriptors). */
-    uAvailableBlks = txHwQueue_CheckResources (pTxHwQueue, pQueueInfo);
-
-    /* If we need more blocks than available, return  STOP_CURRENT (stop current queue and requeue packet). */
-    if (uNumBlksToAlloc > uAvailableBlks)
-    {
-        TRACE6(pTxHwQueue->hReport, REPORT_SEVERITY_INFORMATION, ": No resources, Queue=%d, ReqBlks=%d, FreeBlks=%d, UsedBlks=%d, AvailBlks=%d, UsedPkts=%d\n", uQueueId, uNumBlksToAlloc, pTxHwQueue->uNumTotalBlksFree, pQueueInfo->uNumBlksUsed, uAvailableBlks, pTxHwQueue->uNumUsedDescriptors);
-        pQueueInfo->uNumBlksCausedBusy = uNumBlksToAlloc;
-        pQueueInfo->bQueueBusy = TI_TRUE;
-
-        return TX_HW_QUE_STATUS_STOP_CURRENT;  /**** Exit! (we should stop queue and requeue packet) ****/
-    }
+    return uNumBlksToAlloc;
+}
 
-    /***********************************************************************/
-    /*                    Allocate required resources                      */
-    /***********************************************************************/
 
-    /* Update blocks numbers in Tx descriptor */
+/****************************************************************************
+ *                  txHwQueue_SetPktBlks()
+ ****************************************************************************
+ * DESCRIPTION:
+   ============
+    Update the packet's allocated blocks number in its Tx descriptor.
+ ****************************************************************************/
+static inline void txHwQueue_SetPktBlks (TTxHwQueue *pTxHwQueue, TTxCtrlBlk *pTxCtrlBlk, TI_UINT32 uNumBlks)
+{
 #ifdef TNETW1283
     /* in 1283, no need of extra mem blocks setting to the hardware */
     /* set total blocks in the extra blocks field, FW will deliver only total blocks */
 
     /* !!!!!!!!!!!!!just for test - swap fields - OK for HW, fw will have the value on other field */
-    pTxCtrlBlk->tTxDescriptor.totalMemBlks = uNumBlksToAlloc;
+    pTxCtrlBlk->tTxDescriptor.totalMemBlks = uNumBlks;
 #else
     pTxCtrlBlk->tTxDescriptor.extraMemBlks = pTxHwQueue->uExtraHwBlocks;
-    pTxCtrlBlk->tTxDescriptor.totalMemBlks = uNumBlksToAlloc;
+    pTxCtrlBlk->tTxDescriptor.totalMemBlks = uNumBlks;
 #endif
+}
+
+
+/****************************************************************************
+ *                  txHwQueue_AllocBlks()
+ ****************************************************************************
+ * DESCRIPTION:
+   ============
+    Update the allocated blocks and descriptors counters for uNumPkts packets 
+        of the given queue, that use together uNumBlksToAlloc blocks.
+ ****************************************************************************/
+static void txHwQueue_AllocBlks (TTxHwQueue     *pTxHwQueue, 
+                                 TTxHwQueueInfo *pQueueInfo, 
+                                 TI_UINT32       uNumBlksToAlloc, 
+                                 TI_UINT32       uNumPkts)
+{
+    TI_UINT32 uReservedBlks;   /* How many blocks are reserved for this queue before this allocation. */
 
     /* Update packet allocation info:  */
-    pTxHwQueue->uNumUsedDescriptors++; /* Update number of packets in FW (for descriptors allocation check). */
-    pTxHwQueue->uDrvTxPacketsCntr++;
+    pTxHwQueue->uNumUsedDescriptors += uNumPkts; /* Update number of packets in FW (for descriptors allocation check). */
+    pTxHwQueue->uDrvTxPacketsCntr += uNumPkts;
     pQueueInfo->uAllocatedBlksCntr += uNumBlksToAlloc; /* For FW counter coordination. */
     uReservedBlks = pQueueInfo->uNumBlksReserved;
 
@@ -446,6 +439,61 @@ ETxHwQueStatus txHwQueue_AllocResources (TI_HANDLE hTxHwQueue, TTxCtrlBlk *pTxCt
     /* Update total free blocks and Queue used blocks with the allocated blocks number. */
     pTxHwQueue->uNumTotalBlksFree -= uNumBlksToAlloc;
     pQueueInfo->uNumBlksUsed += uNumBlksToAlloc;
+}
+
+
+/****************************************************************************
+ *                  txHwQueue_AllocResources()
+ ****************************************************************************
+ * DESCRIPTION:
+   ============
+    1.  Estimate required HW-blocks number.
+    2.  If the required blocks are not available or no free descriptor,
+            return  STOP_CURRENT  (to stop current queue and requeue the packet).
+    3.  Resources are available so update allocated blocks and descriptors counters.
+    4.  If no resources for another similar packet, return STOP_NEXT (to stop current queue).
+        Else, return SUCCESS
+ ****************************************************************************/
+ETxHwQueStatus txHwQueue_AllocResources (TI_HANDLE hTxHwQueue, TTxCtrlBlk *pTxCtrlBlk)
+{
+    TTxHwQueue *pTxHwQueue = (TTxHwQueue *)hTxHwQueue;
+    TI_UINT32 uNumBlksToAlloc; /* The number of blocks required for the current packet. */
+    TI_UINT32 uAvailableBlks;  /* Max blocks that are currently available for this queue. */
+    TI_UINT32 uQueueId = WMEQosTagToACTable[pTxCtrlBlk->tTxDescriptor.tid];
+    TTxHwQueueInfo *pQueueInfo = &(pTxHwQueue->aTxHwQueueInfo[uQueueId]);
+
+
+    /***********************************************************************/
+    /*  Calculate packet required HW blocks.                               */
+    /***********************************************************************/
+
+    uNumBlksToAlloc = txHwQueue_CalcPktBlks (pTxHwQueue, pTxCtrlBlk);
+
+    /***********************************************************************/
+    /*            Check if the required resources are available            */
+    /***********************************************************************/
+
+    /* Find max available blocks for this queue (0 could indicate no descriptors). */
+    uAvailableBlks = txHwQueue_CheckResources (pTxHwQueue, pQueueInfo);
+
+    /* If we need more blocks than available, return  STOP_CURRENT (stop current queue and requeue packet). */
+    if (uNumBlksToAlloc > uAvailableBlks)
+    {
+        TRACE6(pTxHwQueue->hReport, REPORT_SEVERITY_INFORMATION, ": No resources, Queue=%d, ReqBlks=%d, FreeBlks=%d, UsedBlks=%d, AvailBlks=%d, UsedPkts=%d\n", uQueueId, uNumBlksToAlloc, pTxHwQueue->uNumTotalBlksFree, pQueueInfo->uNumBlksUsed, uAvailableBlks, pTxHwQueue->uNumUsedDescriptors);
+        pQueueInfo->uNumBlksCausedBusy = uNumBlksToAlloc;
+        pQueueInfo->bQueueBusy = TI_TRUE;
+
+        return TX_HW_QUE_STATUS_STOP_CURRENT;  /**** Exit! (we should stop queue and requeue packet) ****/
+    }
+
+    /***********************************************************************/
+    /*                    Allocate required resources                      */
+    /***********************************************************************/
+
+    /* Update blocks numbers in Tx descriptor */
+    txHwQueue_SetPktBlks (pTxHwQueue, pTxCtrlBlk, uNumBlksToAlloc);
+
+    txHwQueue_AllocBlks (pTxHwQueue, pQueueInfo, uNumBlksToAlloc, 1);
 
     TRACE6(pTxHwQueue->hReport, REPORT_SEVERITY_INFORMATION, ": SUCCESS,  Queue=%d, Req-blks=%d , Free=%d, Used=%d, Reserved=%d, Accumulated=%d\n", uQueueId, uNumBlksToAlloc, pTxHwQueue->uNumTotalBlksFree, pQueueInfo->uNumBlksUsed, pQueueInfo->uNumBlksReserved, pQueueInfo->uAllocatedBlksCntr);
 
@@ -462,6 +510,90 @@ ETxHwQueStatus txHwQueue_AllocResources (TI_HANDLE hTxHwQueue, TTxCtrlBlk *pTxCt
     /* Return SUCCESS (resources are available). */
     return TX_HW_QUE_STATUS_SUCCESS;
 }
+
+
+/****************************************************************************
+ *                  txHwQueue_AllocResourcesBurst()
+ ****************************************************************************
+ * DESCRIPTION:
+   ============
+    Allocate HW resources for a burst of packets of the same queue in one 
+        reservation (the queue is taken from the first packet).
+    1.  Get the queue's available blocks and descriptors once, and estimate 
+            each packet's blocks until the burst doesn't fit in them.
+    2.  Update the allocated blocks and descriptors counters once for all the
+            packets that fit.
+    3.  Return the number of packets that got resources in *pNumAllocated, and:
+            STOP_CURRENT - if not all packets fit (stop queue and requeue the rest).
+            STOP_NEXT    - if no resources for another packet like the last one.
+            SUCCESS      - otherwise.
+ ****************************************************************************/
+ETxHwQueStatus txHwQueue_AllocResourcesBurst (TI_HANDLE   hTxHwQueue, 
+                                              TTxCtrlBlk *aPktsCtrlBlk[], 
+                                              TI_UINT32   uNumPkts, 
+                                              TI_UINT32  *pNumAllocated)
+{
+    TTxHwQueue *pTxHwQueue = (TTxHwQueue *)hTxHwQueue;
+    TI_UINT32 uQueueId = WMEQosTagToACTable[aPktsCtrlBlk[0]->tTxDescriptor.tid];
+    TTxHwQueueInfo *pQueueInfo = &(pTxHwQueue->aTxHwQueueInfo[uQueueId]);
+    TI_UINT32 uAvailableBlks;  /* Max blocks that are currently available for this queue. */
+    TI_UINT32 uMaxPkts;        /* The packets that can get a descriptor. */
+    TI_UINT32 uNumBlksToAlloc = 0; /* The number of blocks required for the allocated packets. */
+    TI_UINT32 uPktBlks = 0;    /* The number of blocks required for the current packet. */
+    TI_UINT32 uPkt;
+
+    /* Find max available blocks for this queue and the free descriptors for the whole burst. */
+    uAvailableBlks = txHwQueue_CheckResources (pTxHwQueue, pQueueInfo);
+    uMaxPkts = NUM_TX_DESCRIPTORS - pTxHwQueue->uNumUsedDescriptors;
+    if (uMaxPkts > uNumPkts)
+    {
+        uMaxPkts = uNumPkts;
+    }
+
+    /* Estimate the packets blocks until the burst exceeds the available blocks or descriptors. */
+    for (uPkt = 0; uPkt < uMaxPkts; uPkt++)
+    {
+        uPktBlks = txHwQueue_CalcPktBlks (pTxHwQueue, aPktsCtrlBlk[uPkt]);
+
+        if (uNumBlksToAlloc + uPktBlks > uAvailableBlks)
+        {
+            break;
+        }
+
+        txHwQueue_SetPktBlks (pTxHwQueue, aPktsCtrlBlk[uPkt], uPktBlks);
+        uNumBlksToAlloc += uPktBlks;
+    }
+
+    /* Allocate the resources of all packets that fit, at once. */
+    if (uPkt > 0)
+    {
+        txHwQueue_AllocBlks (pTxHwQueue, pQueueInfo, uNumBlksToAlloc, uPkt);
+    }
+
+    *pNumAllocated = uPkt;
+
+    TRACE6(pTxHwQueue->hReport, REPORT_SEVERITY_INFORMATION, ": Burst, Queue=%d, Pkts=%d, Allocated=%d, Req-blks=%d, Free=%d, Reserved=%d\n", uQueueId, uNumPkts, uPkt, uNumBlksToAlloc, pTxHwQueue->uNumTotalBlksFree, pQueueInfo->uNumBlksReserved);
+
+    /* If the burst didn't fit (blocks or descriptors), return STOP_CURRENT (stop queue and requeue the rest). */
+    if (uPkt < uNumPkts)
+    {
+        pQueueInfo->uNumBlksCausedBusy = txHwQueue_CalcPktBlks (pTxHwQueue, aPktsCtrlBlk[uPkt]);
+        pQueueInfo->bQueueBusy = TI_TRUE;
+        return TX_HW_QUE_STATUS_STOP_CURRENT;
+    }
+
+    /* If no resources for another packet like the last one, return STOP_NEXT (to stop current queue). */
+    if (uNumBlksToAlloc + uPktBlks > uAvailableBlks)
+    {
+        pQueueInfo->uNumBlksCausedBusy = uPktBlks;
+        pQueueInfo->bQueueBusy = TI_TRUE;
+        return TX_HW_QUE_STATUS_STOP_NEXT;
+    }
+
+    return TX_HW_QUE_STATUS_SUCCESS;
+}
+
+
 /****************************************************************************
  *                  txHwQueue_SetSecureMode()
  ****************************************************************************
@@ -68,6 +68,7 @@ TI_STATUS hwInit_Init   (TI_HANDLE hHwInit,
                          TEndOfHwInitCb fInitHwCb);
 TI_STATUS hwInit_SetNvsImage (TI_HANDLE hHwInit, TI_UINT8 *pbuf, TI_UINT32 length);
 TI_STATUS hwInit_SetFwImage (TI_HANDLE hHwInit, TFileInfo *pFileInfo);
+void      hwInit_SetBusParams (TI_HANDLE hHwInit, TI_UINT32 uDmaBufLen);
 TI_STATUS hwInit_Destroy (TI_HANDLE hHwInit);
 TI_STATUS hwInit_Boot (TI_HANDLE hHwInit);
 TI_STATUS hwInit_LoadFw (TI_HANDLE hHwInit);
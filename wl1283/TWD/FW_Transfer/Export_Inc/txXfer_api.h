@@ -175,6 +175,27 @@ void txXfer_RegisterCb (TI_HANDLE hTxXfer, TI_UINT32 CallBackID, void *CBFunc, T
 ETxnStatus txXfer_SendPacket (TI_HANDLE hTxXfer, TTxCtrlBlk *pPktCtrlBlk);
 
 
+/** 
+ * \fn     txXfer_SendPacketBurst
+ * \brief  Send a burst of Tx packets to the FW
+ * 
+ * Called by the Tx upper layers to send a burst of new Tx packets to the FW (after FW resources 
+ *     were allocated for all of them).
+ * Chain the whole burst into the current aggregation in one pass, and forward the aggregation 
+ *     to the FW only when it reaches its packets or length limit.
+ * 
+ * \note   If aggregation is disabled each packet is sent separately, and the burst is stopped 
+ *          on the first failed packet, whose index is returned in *pNumSent.
+ * \param  hTxXfer      - Module handle
+ * \param  aPktsCtrlBlk - The new packets to send
+ * \param  uNumPkts     - Number of packets in aPktsCtrlBlk
+ * \param  pNumSent     - Returns the number of packets sent (all of them unless ERROR is returned)
+ * \return COMPLETE if completed in this context, PENDING if not, ERROR if failed
+ * \sa     txXfer_SendPacket
+ */ 
+ETxnStatus txXfer_SendPacketBurst (TI_HANDLE hTxXfer, TTxCtrlBlk *aPktsCtrlBlk[], TI_UINT32 uNumPkts, TI_UINT32 *pNumSent);
+
+
 /** 
  * \fn     txXfer_EndOfBurst
  * \brief  Indicates that current packets burst stopped
@@ -274,6 +274,8 @@ TI_STATUS fwEvent_Init (TI_HANDLE hFwEvent, TI_HANDLE hTWD)
                            TI_FALSE,
                            "FW_EVENT",
                            sizeof("FW_EVENT"));
+    /* FW events (Rx, Tx-complete) serve the data path, so invoke them before the management clients */
+    context_SetClientPriority (pFwEvent->hContext, pFwEvent->uContextId, CONTEXT_PRIORITY_HIGH);
 
     return TI_OK;
 }
@@ -116,7 +116,7 @@ typedef struct
     TI_UINT32           uCountPktsForward;
     TI_UINT32           uCountBufPend;
     TI_UINT32           uCountBufNoMem;
-    TI_UINT32           uCountPktAggreg[MAX_XFER_BUFS];
+    TI_UINT32           uCountPktAggreg[MAX_XFER_EXT_BUFS];  /* Histogram of the number of packets per read transaction */
 
 } TRxXferDbgStat;
 #endif
@@ -157,7 +157,7 @@ typedef struct
     TI_UINT32           uCurrTxnIndex;                          /* The current Txn structures index to use */
     TI_UINT32           uAvailableTxn;                          /* Number of Txn structures currently available */
     TRegTxn             aSlaveRegTxn[MAX_CONSECUTIVE_READ_TXN]; /* Txn structures for writing mem-block address reg */
-    TTxnStruct          aTxnStruct[MAX_CONSECUTIVE_READ_TXN];   /* Txn structures for reading the Rx packets */
+    TTxnStructExt       aTxnStruct[MAX_CONSECUTIVE_READ_TXN];   /* Extended Txn structures for reading the Rx packets (up to MAX_XFER_EXT_BUFS) */
 #ifndef TNETW1283
     TCounterTxn         aCounterTxn[MAX_CONSECUTIVE_READ_TXN];  /* Txn structures for writing the driver counter workaround */
 #endif
@@ -312,6 +312,16 @@ void rxXfer_SetDefaults (TI_HANDLE hRxXfer, TTwdInitParams *pInitParams)
     TRxXfer *pRxXfer = (TRxXfer *)hRxXfer;
 
     pRxXfer->uMaxAggregPkts = pInitParams->tGeneral.uRxAggregPktsLimit;
+
+    /* The aggregation is limited by the Txn buffers list length (0 also means no aggregation) */
+    if (pRxXfer->uMaxAggregPkts > MAX_XFER_EXT_BUFS)
+    {
+        pRxXfer->uMaxAggregPkts = MAX_XFER_EXT_BUFS;
+    }
+    else if (pRxXfer->uMaxAggregPkts == 0)
+    {
+        pRxXfer->uMaxAggregPkts = 1;
+    }
 #ifndef TNETW1283
     pRxXfer->uFlags         = 0;
 #endif
@@ -422,17 +432,20 @@ static void rxXfer_ForwardPacket (TRxXfer *pRxXfer, TTxnStruct *pTxn)
 #endif
 
     /* Go over all occupied Txn buffers and forward their Rx packets upward */
-    for (uBufNum = 0; uBufNum < MAX_XFER_BUFS; uBufNum++)
+    for (uBufNum = 0; uBufNum < TXN_MAX_BUFS(pTxn); uBufNum++)
     {
+        TI_UINT8  *pBuf = TXN_BUF_PTR(pTxn, uBufNum);
+        TI_UINT32  uLen = TXN_BUF_LEN(pTxn, uBufNum);
+
         /* If no more buffers, exit the loop */
-        if (pTxn->aLen[uBufNum] == 0)
+        if (uLen == 0)
         {
             break;
         }
 
 #ifdef TI_DBG   /* Packet sanity check */
         /* Get length from RxInfo, handle endianess and convert to length in bytes */
-        pRxInfo = (RxIfDescriptor_t*)(pTxn->aBuf[uBufNum]);
+        pRxInfo = (RxIfDescriptor_t*)pBuf;
         uLenFromRxInfo = ENDIAN_HANDLE_WORD(pRxInfo->length) << 2;
 
 #ifdef TNETW1283
@@ -442,13 +455,13 @@ static void rxXfer_ForwardPacket (TRxXfer *pRxXfer, TTxnStruct *pTxn)
         ADD_DBG_TRACE(50, 999, uLenFromRxInfo);
 #endif
         /* If the length in the RxInfo is different than in the short descriptor, set error status */
-        if (pTxn->aLen[uBufNum] != uLenFromRxInfo)
+        if (uLen != uLenFromRxInfo)
         {
-            ADD_DBG_TRACE(55, pTxn->aLen[uBufNum], uLenFromRxInfo);
+            ADD_DBG_TRACE(55, uLen, uLenFromRxInfo);
 #ifdef TNETW1283
-            TRACE4(pRxXfer->hReport, REPORT_SEVERITY_ERROR , "rxXfer_ForwardPacket: Bad Length!! RxInfoLength=%d, ShortDescLen=%d, RxInfoStatus=0x%x, uRxDesc=0x%x\n", uLenFromRxInfo, pTxn->aLen[uBufNum], pRxInfo->status, ((TI_UINT32 *)pTxn->aWspiPad)[0]);
+            TRACE4(pRxXfer->hReport, REPORT_SEVERITY_ERROR , "rxXfer_ForwardPacket: Bad Length!! RxInfoLength=%d, ShortDescLen=%d, RxInfoStatus=0x%x, uRxDesc=0x%x\n", uLenFromRxInfo, uLen, pRxInfo->status, ((TI_UINT32 *)pTxn->aWspiPad)[0]);
 #else
-            TRACE3(pRxXfer->hReport, REPORT_SEVERITY_ERROR , "rxXfer_ForwardPacket: Bad Length!! RxInfoLength=%d, ShortDescLen=%d, RxInfoStatus=0x%x\n", uLenFromRxInfo, pTxn->aLen[uBufNum], pRxInfo->status);
+            TRACE3(pRxXfer->hReport, REPORT_SEVERITY_ERROR , "rxXfer_ForwardPacket: Bad Length!! RxInfoLength=%d, ShortDescLen=%d, RxInfoStatus=0x%x\n", uLenFromRxInfo, uLen, pRxInfo->status);
 #endif
 #ifdef DEBUG_GPIO
             debug_gpio_set_dataout();
@@ -457,7 +470,7 @@ static void rxXfer_ForwardPacket (TRxXfer *pRxXfer, TTxnStruct *pTxn)
 
             pRxInfo->status &= ~RX_DESC_STATUS_MASK;
             pRxInfo->status |= RX_DESC_STATUS_DRIVER_RX_Q_FAIL;
-            pRxInfo->length = ENDIAN_HANDLE_WORD(pTxn->aLen[uBufNum] >> 2);
+            pRxInfo->length = ENDIAN_HANDLE_WORD(uLen >> 2);
 
             /* If error CB available, trigger recovery !! */
             if (pRxXfer->fErrCb)
@@ -473,13 +486,14 @@ static void rxXfer_ForwardPacket (TRxXfer *pRxXfer, TTxnStruct *pTxn)
 #endif
 
         /* This is the last packet in the Burst so mark its EndOfBurst flag */
-        if (TXN_PARAM_GET_END_OF_BURST(pTxn) && (uBufNum == (MAX_XFER_BUFS - 1) || pTxn->aLen[uBufNum + 1] == 0))
+        if (TXN_PARAM_GET_END_OF_BURST(pTxn) && (uBufNum == (TXN_MAX_BUFS(pTxn) - 1) || TXN_BUF_LEN(pTxn, uBufNum + 1) == 0))
         {
+            pRxInfo = (RxIfDescriptor_t*)pBuf;
             TXN_PARAM_SET_END_OF_BURST(pTxn, 0);
             pRxInfo->driverFlags |= DRV_RX_FLAG_END_OF_BURST;
         }
         /* Forward received packet to the upper layers */
-        RxQueue_ReceivePacket (pRxXfer->hRxQueue, (const void *)pTxn->aBuf[uBufNum]);
+        RxQueue_ReceivePacket (pRxXfer->hRxQueue, (const void *)pBuf);
     }
 
     /* reset the aBuf field for clean on recovery purpose */
@@ -507,7 +521,6 @@ ETxnStatus rxXfer_RxEvent (TI_HANDLE hRxXfer, FwStatus_t *pFwStatus)
     TI_UINT32      uTempCounters;
     FwStatCntrs_t  *pFwStatusCounters;
     TI_UINT32       i;
-    TI_STATUS   rc;
     CL_TRACE_START_L2();
 
     uTempCounters = ENDIAN_HANDLE_LONG (pFwStatus->counters);
@@ -536,7 +549,7 @@ ETxnStatus rxXfer_RxEvent (TI_HANDLE hRxXfer, FwStatus_t *pFwStatus)
     }
 
     /* Handle all new Rx packets */
-    rc = rxXfer_Handle (pRxXfer);
+    rxXfer_Handle (pRxXfer);
 
     CL_TRACE_END_L2("tiwlan_drv.ko", "CONTEXT", "RX", "");
     return TXN_STATUS_COMPLETE;
@@ -627,13 +640,15 @@ static TI_STATUS rxXfer_Handle(TI_HANDLE hRxXfer)
                 /* new reminder means that all packets till now should be checked again */
                 for (uPktIndex=0; uPktIndex<uAggregPktsNum; uPktIndex++)
                 {
-                    uIncrementLen += pTxn->aLen[uPktIndex];
+                    uIncrementLen += TXN_BUF_LEN(pTxn, uPktIndex);
 
 
                     if ((uIncrementLen > uRemainder) && (((uIncrementLen-uRemainder) & uBlockMask) < 16))
                     {
                         ADD_DBG_TRACE(22, uIncrementLen, uRemainder);
+#ifdef TI_DBG
                         pRxXfer->uRxFifoWa++;
+#endif
                         bIssueTxn = TI_TRUE;
                         break;
                     }
@@ -653,25 +668,24 @@ static TI_STATUS rxXfer_Handle(TI_HANDLE hRxXfer)
                 eBufStatus = pRxXfer->RequestForBufferCB(pRxXfer->RequestForBufferCB_handle,
                              (void**)&pHostBuf,
                              uBuffSize,
-                             (TI_UINT32)NULL,
+                             0,
                              eRxPacketType);
 
                 TRACE6(pRxXfer->hReport, REPORT_SEVERITY_INFORMATION , "rxXfer_Handle: Index=%d, RxDesc=0x%x, DrvCntr=%d, FwCntr=%d, BufStatus=%d, BuffSize=%d\n", uDrvIndex, uRxDesc, pRxXfer->uDrvRxCntr, pRxXfer->uFwRxCntr, eBufStatus, uBuffSize);
 
-                /* If buffer allocated, add it to current Txn (up to 4 packets aggregation) */
+                /* If buffer allocated, add it to current Txn (up to uMaxAggregPkts packets aggregation) */
                 if (eBufStatus == RX_BUF_ALLOC_COMPLETE)
                 {
                     /* If first aggregated packet prepare the next Txn struct */
                     if (uAggregPktsNum == 0)
                     {
-                        pTxn = (TTxnStruct*)&(pRxXfer->aTxnStruct[pRxXfer->uCurrTxnIndex]);
+                        pTxn = &(pRxXfer->aTxnStruct[pRxXfer->uCurrTxnIndex].tTxnStruct);
                         pTxn->uHwAddr = SLV_MEM_DATA;
 
                         /* Save first mem-block of first aggregated packet! */
                         uFirstMemBlkAddr = SLV_MEM_CP_VALUE(uRxDesc, pRxXfer->uPacketMemoryPoolStart);
                     }
-                    pTxn->aBuf[uAggregPktsNum] = pHostBuf + ALIGNMENT_SIZE(uRxDesc);
-                    pTxn->aLen[uAggregPktsNum] = uBuffSize;
+                    TXN_SET_BUF(pTxn, uAggregPktsNum, pHostBuf + ALIGNMENT_SIZE(uRxDesc), uBuffSize);
                     uAggregPktsNum++;
                     uTotalAggregLen += uBuffSize;
                     if (uAggregPktsNum >= pRxXfer->uMaxAggregPkts)
@@ -730,10 +744,10 @@ static TI_STATUS rxXfer_Handle(TI_HANDLE hRxXfer)
             {
                 TXN_PARAM_SET_END_OF_BURST(pTxn, 1);
             }
-            /* If not all 4 Txn buffers are used, reset first unused buffer length for indication */
-            if (uAggregPktsNum < MAX_XFER_BUFS)
+            /* If not all Txn buffers are used, reset first unused buffer length for indication */
+            if (uAggregPktsNum < MAX_XFER_EXT_BUFS)
             {
-                pTxn->aLen[uAggregPktsNum] = 0;
+                TXN_SET_BUF(pTxn, uAggregPktsNum, NULL, 0);
             }
 
             ADD_DBG_TRACE(25, uAggregPktsNum, uTotalAggregLen);
@@ -772,7 +786,7 @@ static TI_STATUS rxXfer_Handle(TI_HANDLE hRxXfer)
 
             /* Read packet to dummy buffer and ignore it (no callback needed) */
             uFirstMemBlkAddr = SLV_MEM_CP_VALUE(uRxDesc, pRxXfer->uPacketMemoryPoolStart);
-            pTxn = (TTxnStruct*)&pRxXfer->aTxnStruct[pRxXfer->uCurrTxnIndex];
+            pTxn = &pRxXfer->aTxnStruct[pRxXfer->uCurrTxnIndex].tTxnStruct;
             BUILD_TTxnStruct(pTxn, SLV_MEM_DATA, pRxXfer->aTempBuffer, uBuffSize, (TTxnDoneCb)rxXfer_PktDropTxnDoneCb, hRxXfer)
             eTxnStatus = rxXfer_IssueTxn (pRxXfer, uRxDesc, uFirstMemBlkAddr);
             if (eTxnStatus == TXN_STATUS_PENDING)
@@ -835,7 +849,7 @@ static ETxnStatus rxXfer_IssueTxn (TI_HANDLE hRxXfer, TI_UINT32 uRxDesc,TI_UINT3
 #endif
 
     /* Issue the packet(s) read transaction (prepared in rxXfer_Handle) */
-    pTxn = &pRxXfer->aTxnStruct[uIndex];
+    pTxn = &pRxXfer->aTxnStruct[uIndex].tTxnStruct;
 #ifdef TNETW1283
     /* save uRxDesc for print on bad length error, use aWspiPad field only for debug  */
     ((TI_UINT32 *)pTxn->aWspiPad)[0] = uRxDesc;
@@ -967,7 +981,7 @@ void rxXfer_Restart(TI_HANDLE hRxXfer)
     /* Scan all transaction array and release only pending transaction */
     for (i = 0; i < MAX_CONSECUTIVE_READ_TXN; i++)
     {
-        pTxn = &(pRxXfer->aTxnStruct[i]);
+        pTxn = &(pRxXfer->aTxnStruct[i].tTxnStruct);
 
         /* Check if buffer allocated and not the dummy one (has a different callback) */
         if ((pTxn->aBuf[0] != 0) && (pTxn->fTxnDoneCb == (TTxnDoneCb)rxXfer_TxnDoneCb))
@@ -976,15 +990,15 @@ void rxXfer_Restart(TI_HANDLE hRxXfer)
             RxIfDescriptor_t *pRxParams;
 
             /* Go over the Txn occupied  buffers and mark them as TAG_CLASS_UNKNOWN to be freed */
-            for (uBufNum = 0; uBufNum < MAX_XFER_BUFS; uBufNum++)
+            for (uBufNum = 0; uBufNum < TXN_MAX_BUFS(pTxn); uBufNum++)
             {
                 /* If no more buffers, exit the loop */
-                if (pTxn->aLen[uBufNum] == 0)
+                if (TXN_BUF_LEN(pTxn, uBufNum) == 0)
                 {
                     break;
                 }
 
-                pRxParams = (RxIfDescriptor_t *)(pTxn->aBuf[uBufNum]);
+                pRxParams = (RxIfDescriptor_t *)TXN_BUF_PTR(pTxn, uBufNum);
                 pRxParams->packet_class_tag = TAG_CLASS_UNKNOWN;
             }
 
@@ -1001,9 +1015,10 @@ void rxXfer_Restart(TI_HANDLE hRxXfer)
         TXN_PARAM_SET(pTxn, TXN_LOW_PRIORITY, TXN_FUNC_ID_WLAN, TXN_DIRECTION_WRITE, TXN_INC_ADDR)
         BUILD_TTxnStruct(pTxn, SLV_REG_DATA, &pRxXfer->aSlaveRegTxn[i].uRegData, REGISTER_SIZE*2, NULL, NULL)
 
-        /* The packet(s) read transaction */
-        pTxn = &(pRxXfer->aTxnStruct[i]);
+        /* The packet(s) read transaction (with an extended buffers list for deep aggregation) */
+        pTxn = &(pRxXfer->aTxnStruct[i].tTxnStruct);
         TXN_PARAM_SET(pTxn, TXN_LOW_PRIORITY, TXN_FUNC_ID_WLAN, TXN_DIRECTION_READ, TXN_FIXED_ADDR)
+        TXN_PARAM_SET_EXT_BUFS(pTxn, 1);
         pTxn->fTxnDoneCb = (TTxnDoneCb)rxXfer_TxnDoneCb;
         pTxn->hCbHandle  = hRxXfer;
 
@@ -1091,10 +1106,26 @@ void rxXfer_PrintStats (TI_HANDLE hRxXfer)
     WLAN_OS_REPORT(("uCountPktsForward  = %d\n", pRxXfer->tDbgStat.uCountPktsForward));
     WLAN_OS_REPORT(("uCountBufPend      = %d\n", pRxXfer->tDbgStat.uCountBufPend));
     WLAN_OS_REPORT(("uCountBufNoMem     = %d\n", pRxXfer->tDbgStat.uCountBufNoMem));
-    WLAN_OS_REPORT(("uCountPktAggreg-1  = %d\n", pRxXfer->tDbgStat.uCountPktAggreg[0]));
-    WLAN_OS_REPORT(("uCountPktAggreg-2  = %d\n", pRxXfer->tDbgStat.uCountPktAggreg[1]));
-    WLAN_OS_REPORT(("uCountPktAggreg-3  = %d\n", pRxXfer->tDbgStat.uCountPktAggreg[2]));
-    WLAN_OS_REPORT(("uCountPktAggreg-4  = %d\n", pRxXfer->tDbgStat.uCountPktAggreg[3]));
+    {
+        TI_UINT32 uDepth;
+        TI_UINT32 uNumTxns = 0;
+        TI_UINT32 uNumPkts = 0;
+
+        /* Print the aggregation depth histogram (up to the configured limit, or any higher depth counted before) */
+        for (uDepth = 1; uDepth <= MAX_XFER_EXT_BUFS; uDepth++)
+        {
+            if ((uDepth <= pRxXfer->uMaxAggregPkts) || pRxXfer->tDbgStat.uCountPktAggreg[uDepth - 1])
+            {
+                WLAN_OS_REPORT(("uCountPktAggreg-%-2d = %d\n", uDepth, pRxXfer->tDbgStat.uCountPktAggreg[uDepth - 1]));
+            }
+            uNumTxns += pRxXfer->tDbgStat.uCountPktAggreg[uDepth - 1];
+            uNumPkts += pRxXfer->tDbgStat.uCountPktAggreg[uDepth - 1] * uDepth;
+        }
+        if (uNumTxns)
+        {
+            WLAN_OS_REPORT(("Avg aggreg depth   = %d.%02d\n", uNumPkts / uNumTxns, ((uNumPkts % uNumTxns) * 100) / uNumTxns));
+        }
+    }
     WLAN_OS_REPORT(("uRxFifoWa          = %d\n", pRxXfer->uRxFifoWa));
 #ifdef DBG_TRACE
     {
@@ -299,6 +299,64 @@ ETxnStatus txXfer_SendPacket (TI_HANDLE hTxXfer, TTxCtrlBlk *pPktCtrlBlk)
 }
 
 
+ETxnStatus txXfer_SendPacketBurst (TI_HANDLE hTxXfer, TTxCtrlBlk *aPktsCtrlBlk[], TI_UINT32 uNumPkts, TI_UINT32 *pNumSent)
+{
+    TTxXferObj   *pTxXfer = (TTxXferObj *)hTxXfer;
+    TTxCtrlBlk   *pPktCtrlBlk;
+    TI_UINT32    uPktLen;
+    TI_UINT32    uPkt;
+    ETxnStatus   eStatus = TXN_STATUS_PENDING; 
+
+    /* If aggregation is disabled, send each packet separately and stop on failure. */
+    if (pTxXfer->uAggregMaxPkts <= 1)
+    {
+        for (uPkt = 0; uPkt < uNumPkts; uPkt++)
+        {
+            eStatus = txXfer_SendPacket (hTxXfer, aPktsCtrlBlk[uPkt]);
+            if (eStatus == TXN_STATUS_ERROR)
+            {
+                break;
+            }
+        }
+        *pNumSent = uPkt;
+        return eStatus;
+    }
+
+    /* Chain the burst to the current aggregation, and send it each time it reaches its limits. */
+    for (uPkt = 0; uPkt < uNumPkts; uPkt++)
+    {
+        pPktCtrlBlk = aPktsCtrlBlk[uPkt];
+        uPktLen = ENDIAN_HANDLE_WORD(pPktCtrlBlk->tTxDescriptor.length << 2); /* swap back for endianess if needed */
+
+        if ((pTxXfer->uAggregPktsNum != 0)  && 
+            ((pTxXfer->uAggregPktsNum + 1 > pTxXfer->uAggregMaxPkts) || 
+             (pTxXfer->uAggregPktsLen + uPktLen > pTxXfer->uAggregMaxLen)))
+        {
+            txXfer_SendAggregatedPkts (pTxXfer, TI_FALSE);
+            pTxXfer->uAggregPktsNum = 0;
+        }
+
+        if (pTxXfer->uAggregPktsNum == 0)
+        {
+            pTxXfer->uAggregPktsLen  = 0;
+            pTxXfer->pAggregFirstPkt = pPktCtrlBlk;
+        }
+        else
+        {
+            pTxXfer->pAggregLastPkt->pNextAggregEntry = pPktCtrlBlk;  /* Link new packet to last */
+        }
+        pTxXfer->uAggregPktsNum++;
+        pTxXfer->uAggregPktsLen += uPktLen;
+        pTxXfer->pAggregLastPkt = pPktCtrlBlk;                    /* Save new packet as last */
+        pPktCtrlBlk->pNextAggregEntry = pTxXfer->pAggregFirstPkt; /* Point from last to first */
+    }
+
+    /* The last aggregation is sent on the next packets or on EndOfBurst, so return Pending. */
+    *pNumSent = uNumPkts;
+    return eStatus;
+}
+
+
 void txXfer_EndOfBurst (TI_HANDLE hTxXfer)
 {
     TTxXferObj   *pTxXfer = (TTxXferObj *)hTxXfer;
@@ -336,7 +394,6 @@ static ETxnStatus txXfer_SendAggregatedPkts (TTxXferObj *pTxXfer, TI_BOOL bLastP
 {
     TTxCtrlBlk   *pCurrPkt;
     TTxnStruct   *pTxn; 
-    TPktsCntrTxn *pPktsCntrTxn; 
     ETxnStatus   eStatus = TXN_STATUS_COMPLETE; 
     TI_UINT32    i;
 
@@ -384,12 +441,13 @@ static ETxnStatus txXfer_SendAggregatedPkts (TTxXferObj *pTxXfer, TI_BOOL bLastP
     {
         pTxXfer->uPktsCntrTxnIndex = 0;
     }
-    pPktsCntrTxn = &(pTxXfer->aPktsCntrTxn[pTxXfer->uPktsCntrTxnIndex]);
 #if defined(TNETW1283) //|| defined(TNETW1273_FPGA)
         /* Skip EOT and Rx counter workarounds */
 #else
     if (pTxXfer->uFlags & TXXFER_FLAG_EOT_WORKAROUND)
     {
+        TPktsCntrTxn *pPktsCntrTxn = &(pTxXfer->aPktsCntrTxn[pTxXfer->uPktsCntrTxnIndex]);
+
         pPktsCntrTxn->uPktsCntr = ENDIAN_HANDLE_LONG(pTxXfer->uPktsCntr);
         pPktsCntrTxn->tTxnStruct.uHwAddr = HOST_WR_ACCESS_REG;
         twIf_Transact(pTxXfer->hTwIf, &pPktsCntrTxn->tTxnStruct);
@@ -502,6 +502,7 @@ TI_STATUS TWD_InitHw (TI_HANDLE hTWD,
     /* Provide bus related parameters to Xfer modules before any usage of the bus! */
     rxXfer_SetBusParams (pTWD->hRxXfer, uRxDmaBufLen);
     txXfer_SetBusParams (pTWD->hTxXfer, uTxDmaBufLen);
+    hwInit_SetBusParams (pTWD->hHwInit, uTxDmaBufLen);
 
     hwInit_SetNvsImage (pTWD->hHwInit, pbuf, length);
 
@@ -802,6 +803,8 @@ TI_STATUS TWD_SetDefaults (TI_HANDLE hTWD, TTwdInitParams *pInitParams)
     rxXfer_SetDefaults (pTWD->hRxXfer, pInitParams);
     txXfer_SetDefaults (pTWD->hTxXfer, pInitParams);
     txHwQueue_Config (pTWD->hTxHwQueue, pInitParams);
+    cmdQueue_SetMultiIe (pTWD->hCmdQueue, pInitParams->tGeneral.bCmdMboxMultiIe);
+    cmdBld_SetRecoveryJournal (pTWD->hCmdBld, pInitParams->tGeneral.bRecoveryConfigJournal);
     /* Configure the rxXfer module */
     rxXfer_Config (pTWD->hRxXfer, pInitParams);
 
@@ -897,16 +900,16 @@ static void fwAssertCb(TI_HANDLE hTWD)
 }
 #endif
 
-TI_STATUS TWD_ConfigFw (TI_HANDLE hTWD)
+TI_STATUS TWD_ConfigFw (TI_HANDLE hTWD, TI_BOOL bRecovery)
 {
     TTwd *pTWD = (TTwd *)hTWD;
 
-    TRACE0(pTWD->hReport, REPORT_SEVERITY_INIT , "TWD_ConfigFw: called\n");
+    TRACE1(pTWD->hReport, REPORT_SEVERITY_INIT , "TWD_ConfigFw: called, bRecovery=%d\n", bRecovery);
 
     /*
      * Configure the WLAN firmware after config all the hardware objects
      */
-    if (cmdBld_ConfigFw (pTWD->hCmdBld, (void *)TWD_ConfigFwCb, hTWD) != TI_OK)
+    if (cmdBld_ConfigFw (pTWD->hCmdBld, bRecovery, (void *)TWD_ConfigFwCb, hTWD) != TI_OK)
     {
         return TI_NOK;
     }
@@ -922,6 +925,13 @@ TI_STATUS TWD_ConfigFw (TI_HANDLE hTWD)
     return TI_OK;
 }
 
+void TWD_GetConfigFwStats (TI_HANDLE hTWD, TConfigFwStats *pStats)
+{
+    TTwd *pTWD = (TTwd *)hTWD;
+
+    cmdBld_GetConfigFwStats (pTWD->hCmdBld, pStats);
+}
+
 void TWD_FinalizeDownload (TI_HANDLE hTWD)
 {
     TTwd *pTWD = (TTwd *)hTWD;
@@ -1659,12 +1669,6 @@ TI_STATUS TWD_WriteMib (TI_HANDLE hTWD, TMib *pMib)
 
     case MIB_dot11GroupAddressesTable:
     {
-        if (NULL == pMib->aData.GroupAddressTable.aGroupTable)
-        {
-            TRACE0(pTWD->hReport, REPORT_SEVERITY_ERROR, "TWD_WriteMib(MIB_dot11GroupAddressesTable) :GroupTable = NULL !!\n");
-            return PARAM_VALUE_NOT_VALID;
-        }
-
         return TWD_CfgGroupAddressTable (hTWD,
                                          pMib->aData.GroupAddressTable.nNumberOfAddresses,
                                          pMib->aData.GroupAddressTable.aGroupTable,
@@ -303,13 +303,23 @@
 /* Rx aggregation packets number limit (max packets in one aggregation) */
 #define TWD_RX_AGGREG_PKTS_LIMIT_DEF    5
 #define TWD_RX_AGGREG_PKTS_LIMIT_MIN    0
-#define TWD_RX_AGGREG_PKTS_LIMIT_MAX    5
+#define TWD_RX_AGGREG_PKTS_LIMIT_MAX    32  /* The Rx Txn buffers list length (MAX_XFER_EXT_BUFS) */
 
 /* Tx aggregation packets number limit (max packets in one aggregation) */
 #define TWD_TX_AGGREG_PKTS_LIMIT_DEF    8
 #define TWD_TX_AGGREG_PKTS_LIMIT_MIN    0
 #define TWD_TX_AGGREG_PKTS_LIMIT_MAX    32
 
+/* Pack consecutive configure commands to one multi-IE mailbox command (if supported by the FW) */
+#define TWD_CMD_MBOX_MULTI_IE_DEF       TI_FALSE
+#define TWD_CMD_MBOX_MULTI_IE_MIN       TI_FALSE
+#define TWD_CMD_MBOX_MULTI_IE_MAX       TI_TRUE
+
+/* On recovery, replay only the journaled configuration (the settings changed at runtime) */
+#define TWD_RECOVERY_CONFIG_JOURNAL_DEF TI_TRUE
+#define TWD_RECOVERY_CONFIG_JOURNAL_MIN TI_FALSE
+#define TWD_RECOVERY_CONFIG_JOURNAL_MAX TI_TRUE
+
 /*
  * Tx power level
  */
@@ -678,10 +688,12 @@ typedef enum
     TWD_INT_SEND_PACKET_COMPLETE                , 	/**< 	Tx Data Path Complete Callback 	*/
     TWD_INT_UPDATE_BUSY_MAP                     , 	/**< 	Tx Data Path Update-Busy-Map Callback 	*/
     TWD_INT_UPDATE_PRIORITY_QUEUE_MAP               ,   /**< 	Tx Data Path Update-Full-Queue-Map Callback 	*/
+    TWD_INT_SEND_PACKET_COMPLETE_LIST           , 	/**< 	Tx Data Path Complete Results List Callback 	*/
 
     /* Rx Data Path Callbacks */
     TWD_INT_RECEIVE_PACKET              =  0x10 ,	/**< 	Rx Data Path Receive Packet Callback 	   	*/
     TWD_INT_REQUEST_FOR_BUFFER                  , 	/**< 	Rx Data Path Request for buffer Callback  	*/
+    TWD_INT_RECEIVE_PACKET_LIST                 , 	/**< 	Rx Data Path Receive Packets Chain Callback 	*/
 
     /* TWD Callbacks */
     TWD_INT_COMMAND_COMPLETE            =  0x20 , 	/**< 	TWD internal Command Complete Callback  	*/
@@ -761,10 +773,12 @@ typedef enum
     TWD_EVENT_TX_RESULT_SEND_PKT_COMPLETE	=  TWD_OWNER_TX_RESULT | TWD_INT_SEND_PACKET_COMPLETE,      /**< 	TX Data Path Send Packet Complete Event ID 	*/
     TWD_EVENT_TX_HW_QUEUE_UPDATE_BUSY_MAP   =  TWD_OWNER_TX_HW_QUEUE | TWD_INT_UPDATE_BUSY_MAP,         /**< 	TX Data Path Update-Busy-Map Event ID 	*/
     TWD_EVENT_TX_HW_QUEUE_UPDATE_FULL_QUEUE_MAP   =  TWD_OWNER_TX_HW_QUEUE | TWD_INT_UPDATE_PRIORITY_QUEUE_MAP,
+    TWD_EVENT_TX_RESULT_SEND_PKT_COMPLETE_LIST	=  TWD_OWNER_TX_RESULT | TWD_INT_SEND_PACKET_COMPLETE_LIST,	/**< 	TX Data Path Send Packets Complete List Event ID 	*/
 
     /* Rx Data Path Callbacks */
     TWD_EVENT_RX_REQUEST_FOR_BUFFER     	=  TWD_OWNER_RX_XFER | TWD_INT_REQUEST_FOR_BUFFER,         	/**< 	RX Data Path Request for Buffer Internal Event ID 	*/
-    TWD_EVENT_RX_RECEIVE_PACKET         	=  TWD_OWNER_RX_QUEUE | TWD_INT_RECEIVE_PACKET             	/**< 	RX Data Path Receive Packet Internal Event ID  	*/
+    TWD_EVENT_RX_RECEIVE_PACKET         	=  TWD_OWNER_RX_QUEUE | TWD_INT_RECEIVE_PACKET,            	/**< 	RX Data Path Receive Packet Internal Event ID  	*/
+    TWD_EVENT_RX_RECEIVE_PACKET_LIST    	=  TWD_OWNER_RX_QUEUE | TWD_INT_RECEIVE_PACKET_LIST        	/**< 	RX Data Path Receive Packets Chain Internal Event ID  	*/
 
 } ETwdEventId;
 
@@ -2125,6 +2139,26 @@ typedef struct
  */
 typedef TConfigCmdCbParams TInterrogateCmdCbParams;
 
+/** \struct TConfigFwStats
+ * \brief FW Configuration Sequence Statistics
+ *
+ * \par Description
+ * Statistics of the last FW configuration sequence (init or recovery)
+ *
+ * \sa	TWD_GetConfigFwStats
+ */
+typedef struct
+{
+    TI_BOOL                             bJournalReplay;	/**< TI_TRUE if only the journaled settings were replayed (recovery)	*/
+    TI_BOOL                             bJoin;			/**< TI_TRUE if the sequence included the start/join command			*/
+    TI_UINT32                           uJournalSteps;	/**< Number of journaled steps (settings changed at runtime)			*/
+    TI_UINT32                           uSteps;			/**< Number of issued sequence steps									*/
+    TI_UINT32                           uSkippedSteps;	/**< Number of steps skipped because they were not journaled			*/
+    TI_UINT32                           uConfigTime;	/**< Sequence duration in msec											*/
+    TI_UINT32                           uJoinTime;		/**< Duration from the start/join command to the sequence end in msec	*/
+
+} TConfigFwStats;
+
 /** \struct TRxTimeOut
  * \brief RX Time Out
  *
@@ -2659,6 +2693,8 @@ typedef struct
 
     TI_UINT32                           uRxAggregPktsLimit;					/**< */
     TI_UINT32                           uTxAggregPktsLimit;					/**< */
+    TI_BOOL                             bCmdMboxMultiIe;					/**< */
+    TI_BOOL                             bRecoveryConfigJournal;				/**< */
     TI_UINT8                            hwAccessMethod;						/**< */
     TI_UINT8                            maxSitesFragCollect;				/**< */
     TI_UINT8                            packetDetectionThreshold;			/**< */
@@ -2905,6 +2941,23 @@ typedef ERxBufferStatus (*TRequestForBufferCb) (TI_HANDLE hObj, void **pRxBuffer
  */
 typedef void (*TPacketReceiveCb) (TI_HANDLE 	hObj,
            const void 	*pBuffer);
+/** @ingroup Control
+ * \brief Receive Packets Chain CB
+ *
+ * \param  hObj        	- object handle
+ * \param  apBuffers	    - Array of the Received buffers, in order
+ * \param  uNumBuffers	- Number of buffers in apBuffers
+ * \return void
+ *
+ * \par Description
+ * This function CB will be called when RX Queue releases an in-order chain of packets from the BA reorder window
+ * User may register this CB in addition to the single packet one (which is used if it is not registered)
+ *
+ * \sa	TWD_RegisterCb
+ */
+typedef void (*TPacketReceiveListCb) (TI_HANDLE 	hObj,
+           void 	**apBuffers,
+           TI_UINT32 	uNumBuffers);
 /** @ingroup Control
  * \brief Failure Event CB
  *
@@ -2935,6 +2988,7 @@ typedef union
     TSendPacketDebugCb		sendPacketDbgCB;	/**< Transfer-Done Debug callback	*/
     TRequestForBufferCb		requestBufferCB;	/**< Transfer-Done Debug callback	*/
     TPacketReceiveCb		recvPacketCB;		/**< RX Buffer Request callback		*/
+    TPacketReceiveListCb	recvPacketListCB;	/**< RX Packets Chain callback		*/
     TFailureEventCb			failureEventCB;		/**< Failure Event callback			*/
 } TTwdCB;
 
@@ -3230,14 +3284,29 @@ void TWD_FinalizeOnFailure (TI_HANDLE hTWD);
  * \brief Perform FW Configuration
  *
  * \param  hTWD         - TWD module object handle
+ * \param  bRecovery    - TI_TRUE if the FW is configured after a recovery FW reload
  * \return TI_OK on success or TI_NOK on failure
  *
  * \par Description
- * Configure the FW from the TWD DB - after configuring all HW objects
+ * Configure the FW from the TWD DB - after configuring all HW objects.
+ * On recovery, only the journaled settings may be replayed (see bRecoveryConfigJournal)
  *
- * \sa
+ * \sa TWD_GetConfigFwStats
+ */
+TI_STATUS TWD_ConfigFw (TI_HANDLE hTWD, TI_BOOL bRecovery);
+/** @ingroup Control
+ * \brief Get FW Configuration Statistics
+ *
+ * \param  hTWD         - TWD module object handle
+ * \param  pStats       - Pointer to output statistics
+ * \return void
+ *
+ * \par Description
+ * Return the statistics of the last FW configuration sequence
+ *
+ * \sa TWD_ConfigFw
  */
-TI_STATUS TWD_ConfigFw (TI_HANDLE hTWD);
+void TWD_GetConfigFwStats (TI_HANDLE hTWD, TConfigFwStats *pStats);
 /** @ingroup Control
  * \brief Handle FW interrupt from ISR context
  *
@@ -4558,6 +4627,20 @@ TTxCtrlBlk *TWD_txCtrlBlk_Alloc (TI_HANDLE hTWD);
  * \sa
  */
 void TWD_txCtrlBlk_Free (TI_HANDLE hTWD, TTxCtrlBlk *pCurrentEntry);
+/** @ingroup Data_Path
+ * \brief  TWD TX Control Blocks List Free
+ *
+ * \param  hTWD   			- TWD module object handle
+ * \param  apEntries   		- The TX Control Block Entries to Free
+ * \param  uNumEntries   	- Number of entries
+ * \return void
+ *
+ * \par Description
+ * Use this function for Free multiple Control-Blocks (e.g. upon Tx-complete of a results list) with one lock
+ *
+ * \sa	TWD_txCtrlBlk_Free
+ */
+void TWD_txCtrlBlk_FreeList (TI_HANDLE hTWD, TTxCtrlBlk **apEntries, TI_UINT32 uNumEntries);
 /** @ingroup Data_Path
  * \brief  TWD TX Control Get Pointer
  *
@@ -4586,6 +4669,23 @@ TTxCtrlBlk *TWD_txCtrlBlk_GetPointer (TI_HANDLE hTWD, TI_UINT8 descId);
  */
 ETxHwQueStatus TWD_txHwQueue_AllocResources (TI_HANDLE hTWD, TTxCtrlBlk *pTxCtrlBlk);
 
+/** @ingroup Data_Path
+ * \brief  Allocate Resources for a burst of TX packets
+ *
+ * \param  hTWD   			- TWD module object handle
+ * \param  aPktsCtrlBlk  	- The Tx packets control blocks (all mapped to the same AC)
+ * \param  uNumPkts  		- Number of packets in aPktsCtrlBlk
+ * \param  pNumAllocated  	- Returns the number of packets that got resources
+ * \return see - ETxHwQueStatus
+ *
+ * \par Description
+ * Reserves the HW blocks and descriptors of all the packets that fit in the 
+ * queue's available resources at once
+ *
+ * \sa	TWD_txHwQueue_AllocResources
+ */
+ETxHwQueStatus TWD_txHwQueue_AllocResourcesBurst (TI_HANDLE hTWD, TTxCtrlBlk *aPktsCtrlBlk[], TI_UINT32 uNumPkts, TI_UINT32 *pNumAllocated);
+
 /** @ingroup Data_Path
  * \brief  TX Xfer Send Packet
  *
@@ -4600,6 +4700,22 @@ ETxHwQueStatus TWD_txHwQueue_AllocResources (TI_HANDLE hTWD, TTxCtrlBlk *pTxCtrl
  */
 ETxnStatus TWD_txXfer_SendPacket (TI_HANDLE hTWD, TTxCtrlBlk *pPktCtrlBlk);
 
+/** @ingroup Data_Path
+ * \brief  TX Xfer Send Packets Burst
+ *
+ * \param  hTWD   			- TWD module object handle
+ * \param  aPktsCtrlBlk  	- The Tx packets control blocks
+ * \param  uNumPkts  		- Number of packets in aPktsCtrlBlk
+ * \param  pNumSent  		- Returns the number of packets sent (the failed one on ERROR)
+ * \return see ETxnStatus
+ *
+ * \par Description
+ * Chain a burst of packets into the TX Xfer aggregation in one call
+ *
+ * \sa	TWD_txXfer_SendPacket
+ */
+ETxnStatus TWD_txXfer_SendPacketBurst (TI_HANDLE hTWD, TTxCtrlBlk *aPktsCtrlBlk[], TI_UINT32 uNumPkts, TI_UINT32 *pNumSent);
+
 /** @ingroup Data_Path
  * \brief  Indicates that current packets burst stopped
  *
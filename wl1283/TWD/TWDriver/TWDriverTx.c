@@ -74,6 +74,13 @@ void TWD_txCtrlBlk_Free (TI_HANDLE hTWD, TTxCtrlBlk *pCurrentEntry)
     txCtrlBlk_Free (pTWD->hTxCtrlBlk, pCurrentEntry);
 }
 
+void TWD_txCtrlBlk_FreeList (TI_HANDLE hTWD, TTxCtrlBlk **apEntries, TI_UINT32 uNumEntries)
+{
+    TTwd *pTWD = (TTwd *)hTWD;
+
+    txCtrlBlk_FreeList (pTWD->hTxCtrlBlk, apEntries, uNumEntries);
+}
+
 TTxCtrlBlk *TWD_txCtrlBlk_GetPointer (TI_HANDLE hTWD, TI_UINT8 descId)
 {
     TTwd *pTWD = (TTwd *)hTWD;
@@ -93,6 +100,13 @@ ETxHwQueStatus TWD_txHwQueue_AllocResources (TI_HANDLE hTWD, TTxCtrlBlk *pTxCtrl
     return txHwQueue_AllocResources (pTWD->hTxHwQueue, pTxCtrlBlk);
 }
 
+ETxHwQueStatus TWD_txHwQueue_AllocResourcesBurst (TI_HANDLE hTWD, TTxCtrlBlk *aPktsCtrlBlk[], TI_UINT32 uNumPkts, TI_UINT32 *pNumAllocated)
+{
+    TTwd *pTWD = (TTwd *)hTWD;
+
+    return txHwQueue_AllocResourcesBurst (pTWD->hTxHwQueue, aPktsCtrlBlk, uNumPkts, pNumAllocated);
+}
+
 /****************************************************************************
  *                          Tx Xfer API functions                           *
  ****************************************************************************/
@@ -104,6 +118,13 @@ ETxnStatus TWD_txXfer_SendPacket (TI_HANDLE hTWD, TTxCtrlBlk *pPktCtrlBlk)
     return txXfer_SendPacket (pTWD->hTxXfer, pPktCtrlBlk);
 }
 
+ETxnStatus TWD_txXfer_SendPacketBurst (TI_HANDLE hTWD, TTxCtrlBlk *aPktsCtrlBlk[], TI_UINT32 uNumPkts, TI_UINT32 *pNumSent)
+{
+    TTwd *pTWD = (TTwd *)hTWD;
+
+    return txXfer_SendPacketBurst (pTWD->hTxXfer, aPktsCtrlBlk, uNumPkts, pNumSent);
+}
+
 void TWD_txXfer_EndOfBurst (TI_HANDLE hTWD)
 {
     TTwd *pTWD = (TTwd *)hTWD;
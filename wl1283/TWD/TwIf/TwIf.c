@@ -332,6 +332,8 @@ void twIf_Init (TI_HANDLE hTwIf,
                                                 TI_TRUE,
                                                 "TWIF",
                                                 sizeof("TWIF"));
+    /* Bus Txn completions serve the data path, so invoke them before the management clients */
+    context_SetClientPriority (pTwIf->hContext, pTwIf->uContextId, CONTEXT_PRIORITY_HIGH);
 
 	/* Allocate timer */
 	pTwIf->hPendRestartTimer = tmr_CreateTimer (hTimer);
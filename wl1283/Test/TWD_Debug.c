@@ -34,6 +34,7 @@
 #include "tidef.h"
 #include "TWDriver.h"
 #include "rxXfer_api.h"
+#include "RxQueue_api.h"
 #include "report.h"
 #include "osApi.h"
 #include "eventMbox_api.h"
@@ -876,10 +877,12 @@ TI_STATUS TWD_Debug (TI_HANDLE hTWD, TI_UINT32 funcType, void *pParam)
 #ifdef TI_DBG
     case TWD_PRINT_RX_INFO:
 		rxXfer_PrintStats (pTWD->hRxXfer);  
+		RxQueue_PrintStats (pTWD->hRxQueue);  
         break;
 
 	case TWD_CLEAR_RX_INFO:
 		rxXfer_ClearStats (pTWD->hRxXfer);  
+		RxQueue_ClearStats (pTWD->hRxQueue);  
         break;
 
 #endif /* TI_DBG */
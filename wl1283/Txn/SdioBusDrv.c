@@ -369,9 +369,9 @@ static TI_BOOL busDrv_PrepareTxnParts (TBusDrvObj *pBusDrv, TTxnStruct *pTxn)
     TI_UINT32 uRemainderLen;
 
     /* Go over the transaction buffers */
-    for (uBufNum = 0; uBufNum < MAX_XFER_BUFS; uBufNum++) 
+    for (uBufNum = 0; uBufNum < TXN_MAX_BUFS(pTxn); uBufNum++) 
     {
-        uBufLen = pTxn->aLen[uBufNum];
+        uBufLen = TXN_BUF_LEN(pTxn, uBufNum);
 
         /* If no more buffers, exit the loop */
         if (uBufLen == 0)
@@ -382,7 +382,7 @@ static TI_BOOL busDrv_PrepareTxnParts (TBusDrvObj *pBusDrv, TTxnStruct *pTxn)
         /* For write transaction, copy the data to the DMA buffer */
         if (bWrite) 
         {
-            os_memoryCopy (pBusDrv->hOs, pHostBuf + pBusDrv->uTxnLength, pTxn->aBuf[uBufNum], uBufLen);
+            os_memoryCopy (pBusDrv->hOs, pHostBuf + pBusDrv->uTxnLength, TXN_BUF_PTR(pTxn, uBufNum), uBufLen);
         }
 
         /* Add buffer length to total transaction length */
@@ -567,9 +567,9 @@ static void busDrv_SendTxnParts (TBusDrvObj *pBusDrv)
         TI_UINT32 uBufLen;
         TI_UINT8 *pDmaBuf = pBusDrv->pRxDmaBuf; /* After the read transaction the data is in the Rx DMA buffer */
 
-        for (uBufNum = 0; uBufNum < MAX_XFER_BUFS; uBufNum++) 
+        for (uBufNum = 0; uBufNum < TXN_MAX_BUFS(pTxn); uBufNum++) 
         {
-            uBufLen = pTxn->aLen[uBufNum];
+            uBufLen = TXN_BUF_LEN(pTxn, uBufNum);
     
             /* If no more buffers, exit the loop */
             if (uBufLen == 0)
@@ -577,7 +577,7 @@ static void busDrv_SendTxnParts (TBusDrvObj *pBusDrv)
                 break;
             }
     
-            os_memoryCopy (pBusDrv->hOs, pTxn->aBuf[uBufNum], pDmaBuf, uBufLen);
+            os_memoryCopy (pBusDrv->hOs, TXN_BUF_PTR(pTxn, uBufNum), pDmaBuf, uBufLen);
             pDmaBuf += uBufLen;
         }
     }
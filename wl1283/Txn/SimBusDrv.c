@@ -0,0 +1,413 @@
+/*
+ * SimBusDrv.c
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+ 
+/** \file   SimBusDrv.c 
+ *  \brief  Simulated bus driver for the host simulation build (no WL1283 device).
+ *          Introduces the generic bus-independent API upwards, and passes the 
+ *          transactions to the firmware stand-in.
+ *          Like the SDIO bus driver, all data passes through DMA-able buffers 
+ *          and Tx aggregations are accumulated and sent as a single transaction, 
+ *          so the driver's copy and aggregation costs are preserved.
+ *          By default all transactions are completed synchronously. Optionally, the driver 
+ *          queues transactions as a bus adapter with a request queue, and completes them 
+ *          in order when the main loop calls busDrv_SimCompleteTxns().
+ *  
+ *  \see    BusDrv.h, FwSim.h, FwSim.c
+ */
+
+#define __FILE_ID__  FILE_ID_141
+#include "tidef.h"
+#include "report.h"
+#include "osApi.h"
+#include "TxnDefs.h"
+#include "BusDrv.h"
+#include "FwSim.h"
+
+
+
+/************************************************************************
+ * Defines
+ ************************************************************************/
+#define SIM_DMA_BUF_LEN     8192    /* As the SDIO adapter's DMA buffers (MAX_BUS_TXN_SIZE) */
+#define SIM_MAX_PEND_TXNS   16      /* Max transactions queued for completion */
+
+
+/************************************************************************
+ * Types
+ ************************************************************************/
+
+/* The busDrv module Object */
+typedef struct _TBusDrvObj
+{
+    TI_HANDLE	     hOs;		   	 
+    TI_HANDLE	     hReport;
+
+	TBusDrvTxnDoneCb fTxnDoneCb;         /* The callback to call upon full transaction completion (if queued) */
+	TI_HANDLE        hCbHandle;          /* The callback handle */
+    TI_UINT8 *       pRxDmaBuf;          /* The Rx DMA-able buffer for buffering all read transactions */
+    TI_UINT8 *       pTxDmaBuf;          /* The Tx DMA-able buffer for buffering all write transactions */
+    TI_UINT32        uTxnLength;         /* The current transaction accumulated length (including Tx aggregation case) */
+    TI_UINT32        uQueueDepth;        /* Max transactions queued for completion (0 = all completed synchronously) */
+    TTxnStruct *     aPendTxns[SIM_MAX_PEND_TXNS]; /* Transactions queued for completion (cyclic) */
+    TI_UINT32        uPendFirst;         /* The oldest queued transaction index */
+    TI_UINT32        uNumPendTxns;       /* Number of queued transactions */
+
+} TBusDrvObj;
+
+
+/* The bus driver object (single instance) for the main loop completion calls */
+static TBusDrvObj *pSimBusDrv = NULL;
+
+
+
+/************************************************************************
+ *
+ *   Module functions implementation
+ *
+ ************************************************************************/
+
+/** 
+ * \fn     busDrv_Create 
+ * \brief  Create the module
+ * 
+ * Create and clear the bus driver's object.
+ * 
+ * \note   
+ * \param  hOs - Handle to Os Abstraction Layer
+ * \return Handle of the allocated object, NULL if allocation failed 
+ * \sa     busDrv_Destroy
+ */ 
+TI_HANDLE busDrv_Create (TI_HANDLE hOs)
+{
+    TBusDrvObj *pBusDrv;
+
+    pBusDrv = (TBusDrvObj *)os_memoryAlloc (hOs, sizeof(TBusDrvObj));
+    if (pBusDrv == NULL)
+    {
+        return NULL;
+    }
+
+    os_memoryZero (hOs, pBusDrv, sizeof(TBusDrvObj));
+    
+    pBusDrv->hOs = hOs;
+    pSimBusDrv   = pBusDrv;
+
+    return (TI_HANDLE)pBusDrv;
+}
+
+
+/** 
+ * \fn     busDrv_Destroy
+ * \brief  Destroy the module. 
+ * 
+ * Free the DMA buffers and the module's object.
+ * 
+ * \note   
+ * \param  The module's object
+ * \return TI_OK on success or TI_NOK on failure 
+ * \sa     busDrv_Create
+ */ 
+TI_STATUS busDrv_Destroy (TI_HANDLE hBusDrv)
+{
+    TBusDrvObj *pBusDrv = (TBusDrvObj*)hBusDrv;
+
+    if (pBusDrv)
+    {
+        busDrv_DisconnectBus (hBusDrv);
+        pSimBusDrv = NULL;
+        os_memoryFree (pBusDrv->hOs, pBusDrv, sizeof(TBusDrvObj));     
+    }
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     busDrv_Init
+ * \brief  Init bus driver 
+ * 
+ * Init module parameters.
+
+ * \note   
+ * \param  hBusDrv - The module's handle
+ * \param  hReport - report module handle
+ * \return void
+ * \sa     
+ */ 
+void busDrv_Init (TI_HANDLE hBusDrv, TI_HANDLE hReport)
+{
+    TBusDrvObj *pBusDrv = (TBusDrvObj*) hBusDrv;
+
+    pBusDrv->hReport = hReport;
+}
+
+
+/** 
+ * \fn     busDrv_ConnectBus
+ * \brief  Configure bus driver
+ * 
+ * Called by TxnQ.
+ * Allocate the DMA buffers. The bus configuration is not relevant for the simulated bus.
+ * 
+ * \note   
+ * \param  hBusDrv    - The module's object
+ * \param  pBusDrvCfg - A union used for per-bus specific configuration (not used). 
+ * \param  fCbFunc    - CB function for Async transaction completion (if queueing is enabled).
+ * \param  hCbArg     - The CB function handle
+ * \param  fConnectCbFunc - The CB function for the connect bus competion (not used)
+ * \param  pRxDmaBufLen - The Rx DMA buffer length in bytes (needed as a limit of the Tx/Rx aggregation length)
+ * \param  pTxDmaBufLen - The Tx DMA buffer length in bytes (needed as a limit of the Tx/Rx aggregation length)
+ * \return TI_OK / TI_NOK
+ * \sa     
+ */ 
+TI_STATUS busDrv_ConnectBus (TI_HANDLE        hBusDrv, 
+                             TBusDrvCfg       *pBusDrvCfg,
+                             TBusDrvTxnDoneCb fCbFunc,
+                             TI_HANDLE        hCbArg,
+                             TBusDrvTxnDoneCb fConnectCbFunc,
+                             TI_UINT32        *pRxDmaBufLen,
+                             TI_UINT32        *pTxDmaBufLen)
+{
+    TBusDrvObj *pBusDrv = (TBusDrvObj*)hBusDrv;
+
+    pBusDrv->fTxnDoneCb = fCbFunc;
+    pBusDrv->hCbHandle  = hCbArg;
+    pBusDrv->uTxnLength = 0;
+
+    if (pBusDrv->pRxDmaBuf == NULL)
+    {
+        pBusDrv->pRxDmaBuf = (TI_UINT8 *)os_memoryAlloc (pBusDrv->hOs, SIM_DMA_BUF_LEN);
+        pBusDrv->pTxDmaBuf = (TI_UINT8 *)os_memoryAlloc (pBusDrv->hOs, SIM_DMA_BUF_LEN);
+    }
+
+    if ((pBusDrv->pRxDmaBuf == NULL) || (pBusDrv->pTxDmaBuf == NULL))
+    {
+        TRACE0(pBusDrv->hReport, REPORT_SEVERITY_ERROR, "busDrv_ConnectBus: DMA buffers allocation failed!!");
+        return TI_NOK;
+    }
+
+    *pRxDmaBufLen = SIM_DMA_BUF_LEN;
+    *pTxDmaBufLen = SIM_DMA_BUF_LEN;
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     busDrv_DisconnectBus
+ * \brief  Disconnect the bus
+ * 
+ * Called by TxnQ. Free the DMA buffers.
+ *  
+ * \note   
+ * \param  hBusDrv - The module's object
+ * \return TI_OK
+ * \sa     
+ */ 
+TI_STATUS busDrv_DisconnectBus (TI_HANDLE hBusDrv)
+{
+    TBusDrvObj *pBusDrv = (TBusDrvObj*)hBusDrv;
+
+    if (pBusDrv->pRxDmaBuf)
+    {
+        os_memoryFree (pBusDrv->hOs, pBusDrv->pRxDmaBuf, SIM_DMA_BUF_LEN);
+        pBusDrv->pRxDmaBuf = NULL;
+    }
+    if (pBusDrv->pTxDmaBuf)
+    {
+        os_memoryFree (pBusDrv->hOs, pBusDrv->pTxDmaBuf, SIM_DMA_BUF_LEN);
+        pBusDrv->pTxDmaBuf = NULL;
+    }
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     busDrv_Transact
+ * \brief  Process transaction 
+ * 
+ * Called by the TxnQueue module to initiate a new transaction.
+ * For write, copy the data to the Tx DMA buffer, and if not within aggregation 
+ *     pass the accumulated data to the FW stand-in.
+ * For read, read the data from the FW stand-in into the Rx DMA buffer and copy it
+ *     to the host buffers.
+ * 
+ * If queueing is enabled (see busDrv_SimSetQueueDepth), the completed transaction is queued 
+ *     and PENDING is returned (except Tx aggregation parts, which are only accumulated).
+ * 
+ * \note   The data is transferred in order of calls, so queued transactions are completed in order.
+ * \param  hBusDrv - The module's object
+ * \param  pTxn    - The transaction object 
+ * \return COMPLETE if Txn completed, PENDING if queued for completion, ERROR if failed
+ * \sa     
+ */ 
+ETxnStatus busDrv_Transact (TI_HANDLE hBusDrv, TTxnStruct *pTxn)
+{
+    TBusDrvObj *pBusDrv    = (TBusDrvObj*)hBusDrv;
+    TI_BOOL     bWrite     = (TXN_PARAM_GET_DIRECTION(pTxn) == TXN_DIRECTION_WRITE) ? TI_TRUE : TI_FALSE;
+    TI_BOOL     bFixedAddr = (TXN_PARAM_GET_FIXED_ADDR(pTxn) == TXN_FIXED_ADDR) ? TI_TRUE : TI_FALSE;
+    TI_UINT32   uTxnLen    = 0;
+    TI_UINT32   uBufNum;
+    TI_UINT32   uOffset;
+
+    /* Set status OK in Txn struct */
+    TXN_PARAM_SET_STATUS(pTxn, TXN_PARAM_STATUS_OK);
+
+    for (uBufNum = 0; uBufNum < TXN_MAX_BUFS(pTxn); uBufNum++) 
+    {
+        if (TXN_BUF_LEN(pTxn, uBufNum) == 0)
+        {
+            break;
+        }
+        uTxnLen += TXN_BUF_LEN(pTxn, uBufNum);
+    }
+
+    if (bWrite)
+    {
+        if (pBusDrv->uTxnLength + uTxnLen > SIM_DMA_BUF_LEN)
+        {
+            TRACE2(pBusDrv->hReport, REPORT_SEVERITY_ERROR, "busDrv_Transact: Write length %d exceeds DMA buffer (accumulated %d)\n", uTxnLen, pBusDrv->uTxnLength);
+            pBusDrv->uTxnLength = 0;
+            TXN_PARAM_SET_STATUS(pTxn, TXN_PARAM_STATUS_ERROR);
+            return TXN_STATUS_ERROR;
+        }
+
+        /* Copy the data to the DMA buffer */
+        for (uBufNum = 0; uBufNum < TXN_MAX_BUFS(pTxn) && TXN_BUF_LEN(pTxn, uBufNum); uBufNum++) 
+        {
+            os_memoryCopy (pBusDrv->hOs, pBusDrv->pTxDmaBuf + pBusDrv->uTxnLength, TXN_BUF_PTR(pTxn, uBufNum), TXN_BUF_LEN(pTxn, uBufNum));
+            pBusDrv->uTxnLength += TXN_BUF_LEN(pTxn, uBufNum);
+        }
+
+        /* If in a Tx aggregation, accumulate all parts before sending the transaction */
+        if (TXN_PARAM_GET_AGGREGATE(pTxn) == TXN_AGGREGATE_ON)
+        {
+            return TXN_STATUS_COMPLETE;
+        }
+
+        fwSim_Write (pTxn->uHwAddr, pBusDrv->pTxDmaBuf, pBusDrv->uTxnLength, bFixedAddr);
+        pBusDrv->uTxnLength = 0;
+    }
+    else
+    {
+        if (uTxnLen > SIM_DMA_BUF_LEN)
+        {
+            TRACE1(pBusDrv->hReport, REPORT_SEVERITY_ERROR, "busDrv_Transact: Read length %d exceeds DMA buffer\n", uTxnLen);
+            TXN_PARAM_SET_STATUS(pTxn, TXN_PARAM_STATUS_ERROR);
+            return TXN_STATUS_ERROR;
+        }
+
+        fwSim_Read (pTxn->uHwAddr, pBusDrv->pRxDmaBuf, uTxnLen, bFixedAddr);
+
+        /* Copy the data from the DMA buffer to the host buffers */
+        for (uBufNum = 0, uOffset = 0; uBufNum < TXN_MAX_BUFS(pTxn) && TXN_BUF_LEN(pTxn, uBufNum); uBufNum++) 
+        {
+            os_memoryCopy (pBusDrv->hOs, TXN_BUF_PTR(pTxn, uBufNum), pBusDrv->pRxDmaBuf + uOffset, TXN_BUF_LEN(pTxn, uBufNum));
+            uOffset += TXN_BUF_LEN(pTxn, uBufNum);
+        }
+    }
+
+    /* If queueing is enabled and not full, queue the Txn for completion from the main loop */
+    if (pBusDrv->uNumPendTxns < pBusDrv->uQueueDepth)
+    {
+        pBusDrv->aPendTxns[(pBusDrv->uPendFirst + pBusDrv->uNumPendTxns) % SIM_MAX_PEND_TXNS] = pTxn;
+        pBusDrv->uNumPendTxns++;
+        return TXN_STATUS_PENDING;
+    }
+
+    return TXN_STATUS_COMPLETE;
+}
+
+
+/** 
+ * \fn     busDrv_SimSetQueueDepth
+ * \brief  Set the transactions queue depth
+ * 
+ * Emulate a bus adapter with a request queue: up to uQueueDepth transactions are 
+ *     returned as PENDING, and completed upon busDrv_SimCompleteTxns().
+ * 
+ * \note   The TxnQ should be allowed the same number of transactions in flight.
+ * \param  uQueueDepth - Max queued transactions (0 = all completed synchronously)
+ * \return TI_OK, or TI_NOK if too deep
+ * \sa     busDrv_SimCompleteTxns, txnQ_SetMaxTxnsInFlight
+ */ 
+TI_STATUS busDrv_SimSetQueueDepth (TI_UINT32 uQueueDepth)
+{
+    if ((pSimBusDrv == NULL) || (uQueueDepth > SIM_MAX_PEND_TXNS))
+    {
+        return TI_NOK;
+    }
+
+    pSimBusDrv->uQueueDepth = uQueueDepth;
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     busDrv_SimCompleteTxns
+ * \brief  Complete the queued transactions
+ * 
+ * Called from the main loop (replaces the bus adapter completion interrupt).
+ * Call the TxnDone CB for the transactions queued so far, in order.
+ * 
+ * \note   Transactions queued by the CBs are completed on the next call.
+ * \return The number of completed transactions
+ * \sa     busDrv_SimSetQueueDepth
+ */ 
+TI_UINT32 busDrv_SimCompleteTxns (void)
+{
+    TBusDrvObj *pBusDrv = pSimBusDrv;
+    TI_UINT32   uNumTxns;
+    TI_UINT32   i;
+    TTxnStruct *pTxn;
+
+    if (pBusDrv == NULL)
+    {
+        return 0;
+    }
+
+    uNumTxns = pBusDrv->uNumPendTxns;
+
+    for (i = 0; i < uNumTxns; i++)
+    {
+        pTxn = pBusDrv->aPendTxns[pBusDrv->uPendFirst];
+        pBusDrv->uPendFirst = (pBusDrv->uPendFirst + 1) % SIM_MAX_PEND_TXNS;
+        pBusDrv->uNumPendTxns--;
+
+        pBusDrv->fTxnDoneCb (pBusDrv->hCbHandle, pTxn);
+    }
+
+    return uNumTxns;
+}
@@ -74,6 +74,23 @@
 #define MAX_PRIORITY        2   /* Maximum 2 prioritys per functional driver */
 #define TXN_QUE_SIZE        QUE_UNLIMITED_SIZE
 #define TXN_DONE_QUE_SIZE   QUE_UNLIMITED_SIZE
+#define TXN_LAT_HIST_BUCKETS 16 /* Latency histogram buckets: 0 usec, and then powers of 2 up to 16 msec and above */
+
+
+/************************************************************************
+ * Macros
+ ************************************************************************/
+/* The ready bitmaps hold a bit per function (see txnQ_SelectTxn) */
+#define TXNQ_FUNC_BIT(uFuncId)      (1 << (uFuncId))
+#define TXNQ_FIRST_FUNC(uMap)       (aFirstFuncInMap[uMap])
+
+#ifdef TI_DBG
+#define TXNQ_STAMP_TXN(pTxnQ, pTxn)             (pTxn)->uTimeStampUs = os_timeStampUs ((pTxnQ)->hOs)
+#define TXNQ_RECORD_LATENCY(pTxnQ, aHist, pTxn) txnQ_RecordLatency (pTxnQ, (pTxnQ)->aHist, pTxn)
+#else
+#define TXNQ_STAMP_TXN(pTxnQ, pTxn)
+#define TXNQ_RECORD_LATENCY(pTxnQ, aHist, pTxn)
+#endif
 
 
 /************************************************************************
@@ -97,9 +114,22 @@ typedef struct
 	TTxnQueueDoneCb fTxnQueueDoneCb;    /* The CB called by the TxnQueue upon full transaction completion. */
 	TI_HANDLE       hCbHandle;          /* The callback handle */
     TTxnStruct *    pSingleStep;        /* A single step transaction waiting to be sent */
+    TI_UINT32       uTxnsInFlight;      /* The function's Txns passed to the bus driver and not completed yet */
 
 } TFuncInfo;
 
+#ifdef TI_DBG
+/* Latency histogram per function and priority */
+typedef struct
+{
+    TI_UINT32       aBuckets[TXN_LAT_HIST_BUCKETS]; /* Bucket N (N > 0) counts 2^(N-1) to 2^N-1 usec, the last one also above */
+    TI_UINT32       uCount;
+    TI_UINT64       uSumUs;
+    TI_UINT32       uMaxUs;
+
+} TTxnLatHist;
+#endif
+
 
 /* The TxnQueue module Object */
 typedef struct _TTxnQObj
@@ -112,9 +142,11 @@ typedef struct _TTxnQObj
     TFuncInfo       aFuncInfo[MAX_FUNCTIONS];  /* Registered functional drivers - see above */
     TI_HANDLE       aTxnQueues[MAX_FUNCTIONS][MAX_PRIORITY];  /* Handle of the Transactions-Queue */
     TI_HANDLE       hTxnDoneQueue;      /* Queue for completed transactions not reported to yet to the upper layer */
-    TTxnStruct *    pCurrTxn;           /* The transaction currently processed in the bus driver (NULL if none) */
-    TI_UINT32       uMinFuncId;         /* The minimal function ID actually registered (through txnQ_Open) */
-    TI_UINT32       uMaxFuncId;         /* The maximal function ID actually registered (through txnQ_Open) */
+    TI_UINT32       aReadyMap[MAX_PRIORITY]; /* Per priority, a bit per function with a non empty queue */
+    TI_UINT32       uRunningMap;        /* A bit per function in RUNNING state */
+    TI_UINT32       uSingleStepMap;     /* A bit per function with a single step Txn waiting */
+    TI_UINT32       uTxnsInFlight;      /* Transactions passed to the bus driver and not completed yet */
+    TI_UINT32       uMaxTxnsInFlight;   /* Max transactions in flight (1 unless the bus driver queues them) */
     TI_BOOL         bSchedulerBusy;     /* If set, the scheduler is currently running so it shouldn't be reentered */
     TI_BOOL         bSchedulerPend;     /* If set, a call to the scheduler was postponed because it was busy */
 
@@ -124,6 +156,9 @@ typedef struct _TTxnQObj
 
 #ifdef TI_DBG
     TI_HANDLE       pAggregQueue;       /* While Tx aggregation in progress, saves its queue pointer to ensure continuity */
+    TI_UINT32       uTxnsInFlightMax;   /* Max uTxnsInFlight value (high mark) */
+    TTxnLatHist     aQueueLat[MAX_FUNCTIONS][MAX_PRIORITY]; /* From txnQ_Transact until passed to the bus driver */
+    TTxnLatHist     aDoneLat[MAX_FUNCTIONS][MAX_PRIORITY];  /* From passed to the bus driver until completed */
 #endif
 
 } TTxnQObj;
@@ -136,7 +171,19 @@ static void         txnQ_TxnDoneCb    (TI_HANDLE hTxnQ, void *hTxn);
 static ETxnStatus   txnQ_RunScheduler (TTxnQObj *pTxnQ, TTxnStruct *pInputTxn);
 static ETxnStatus   txnQ_Scheduler    (TTxnQObj *pTxnQ, TTxnStruct *pInputTxn);
 static TTxnStruct  *txnQ_SelectTxn    (TTxnQObj *pTxnQ);
+static void         txnQ_SetFuncState (TTxnQObj *pTxnQ, TI_UINT32 uFuncId, EFuncState eState);
 static void         txnQ_ConnectCB    (TI_HANDLE hTxnQ, void *hTxn);
+#ifdef TI_DBG
+static void         txnQ_RecordLatency (TTxnQObj *pTxnQ, TTxnLatHist aHist[][MAX_PRIORITY], TTxnStruct *pTxn);
+static void         txnQ_PrintLatency  (TTxnQObj *pTxnQ, TTxnLatHist aHist[][MAX_PRIORITY], char *pTitle);
+#endif
+
+
+/************************************************************************
+ * Local data
+ ************************************************************************/
+/* The lowest function ID in a ready bitmap (find-first-set) */
+static const TI_UINT8 aFirstFuncInMap[1 << MAX_FUNCTIONS] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
 
 
 
@@ -161,9 +208,8 @@ TI_HANDLE txnQ_Create (TI_HANDLE hOs)
     os_memoryZero(hOs, hTxnQ, sizeof(TTxnQObj));
     
     pTxnQ->hOs             = hOs;
-    pTxnQ->pCurrTxn        = NULL;
-    pTxnQ->uMinFuncId      = MAX_FUNCTIONS; /* Start at maximum and save minimal value in txnQ_Open */
-    pTxnQ->uMaxFuncId      = 0;             /* Start at minimum and save maximal value in txnQ_Open */
+    pTxnQ->uTxnsInFlight   = 0;
+    pTxnQ->uMaxTxnsInFlight = 1;            /* A single Txn in flight unless the bus driver queues Txns */
 #ifdef TI_DBG
     pTxnQ->pAggregQueue    = NULL;
 #endif
@@ -173,6 +219,7 @@ TI_HANDLE txnQ_Create (TI_HANDLE hOs)
         pTxnQ->aFuncInfo[i].eState          = FUNC_STATE_NONE;
         pTxnQ->aFuncInfo[i].uNumPrios       = 0;
         pTxnQ->aFuncInfo[i].pSingleStep     = NULL;
+        pTxnQ->aFuncInfo[i].uTxnsInFlight   = 0;
         pTxnQ->aFuncInfo[i].fTxnQueueDoneCb = NULL;
         pTxnQ->aFuncInfo[i].hCbHandle       = NULL;
     }
@@ -274,7 +321,7 @@ TI_STATUS txnQ_Open (TI_HANDLE       hTxnQ,
     pTxnQ->aFuncInfo[uFuncId].uNumPrios       = uNumPrios;
     pTxnQ->aFuncInfo[uFuncId].fTxnQueueDoneCb = fTxnQueueDoneCb;
     pTxnQ->aFuncInfo[uFuncId].hCbHandle       = hCbHandle;
-    pTxnQ->aFuncInfo[uFuncId].eState          = FUNC_STATE_STOPPED;
+    txnQ_SetFuncState (pTxnQ, uFuncId, FUNC_STATE_STOPPED);
     
     /* Create the functional driver's queues. */
     uNodeHeaderOffset = TI_FIELD_OFFSET(TTxnStruct, tTxnQNode); 
@@ -289,16 +336,6 @@ TI_STATUS txnQ_Open (TI_HANDLE       hTxnQ,
         }
     }
 
-    /* Update functions actual range (to optimize Txn selection loops - see txnQ_SelectTxn) */
-    if (uFuncId < pTxnQ->uMinFuncId) 
-    {
-        pTxnQ->uMinFuncId = uFuncId;
-    }
-    if (uFuncId > pTxnQ->uMaxFuncId) 
-    {
-        pTxnQ->uMaxFuncId = uFuncId;
-    }
-
     context_LeaveCriticalSection (pTxnQ->hContext);
 
     TRACE2(pTxnQ->hReport, REPORT_SEVERITY_INFORMATION, ": Function %d registered successfully, uNumPrios = %d\n", uFuncId, uNumPrios);
@@ -323,24 +360,14 @@ void txnQ_Close (TI_HANDLE  hTxnQ, TI_UINT32 uFuncId)
     pTxnQ->aFuncInfo[uFuncId].uNumPrios       = 0;
     pTxnQ->aFuncInfo[uFuncId].fTxnQueueDoneCb = NULL;
     pTxnQ->aFuncInfo[uFuncId].hCbHandle       = NULL;
-    pTxnQ->aFuncInfo[uFuncId].eState          = FUNC_STATE_NONE;
-    
-    /* Update functions actual range (to optimize Txn selection loops - see txnQ_SelectTxn) */
-    pTxnQ->uMinFuncId      = MAX_FUNCTIONS; 
-    pTxnQ->uMaxFuncId      = 0;             
-    for (i = 0; i < MAX_FUNCTIONS; i++) 
+    pTxnQ->aFuncInfo[uFuncId].pSingleStep     = NULL;
+    txnQ_SetFuncState (pTxnQ, uFuncId, FUNC_STATE_NONE);
+
+    /* Remove the function from the ready bitmaps (see txnQ_SelectTxn) */
+    pTxnQ->uSingleStepMap &= ~TXNQ_FUNC_BIT(uFuncId);
+    for (i = 0; i < MAX_PRIORITY; i++)
     {
-        if (pTxnQ->aFuncInfo[i].eState != FUNC_STATE_NONE) 
-        {
-            if (i < pTxnQ->uMinFuncId) 
-            {
-                pTxnQ->uMinFuncId = i;
-            }
-            if (i > pTxnQ->uMaxFuncId) 
-            {
-                pTxnQ->uMaxFuncId = i;
-            }
-        }
+        pTxnQ->aReadyMap[i] &= ~TXNQ_FUNC_BIT(uFuncId);
     }
 
     context_LeaveCriticalSection (pTxnQ->hContext);
@@ -356,20 +383,17 @@ ETxnStatus txnQ_Restart (TI_HANDLE hTxnQ, TI_UINT32 uFuncId)
 
     context_EnterCriticalSection (pTxnQ->hContext);
 
-    /* If a Txn from the calling function is in progress, set state to RESTART return PENDING */
-    if (pTxnQ->pCurrTxn) 
+    /* If Txns from the calling function are in progress, set state to RESTART return PENDING */
+    if (pTxnQ->aFuncInfo[uFuncId].uTxnsInFlight > 0) 
     {
-        if (TXN_PARAM_GET_FUNC_ID(pTxnQ->pCurrTxn) == uFuncId)
-        {
-            pTxnQ->aFuncInfo[uFuncId].eState = FUNC_STATE_RESTART;
+        txnQ_SetFuncState (pTxnQ, uFuncId, FUNC_STATE_RESTART);
 
-            context_LeaveCriticalSection (pTxnQ->hContext);
+        context_LeaveCriticalSection (pTxnQ->hContext);
 
-            TRACE0(pTxnQ->hReport, REPORT_SEVERITY_INFORMATION, "txnQ_Restart(): pCurrTxn pending\n");
+        TRACE1(pTxnQ->hReport, REPORT_SEVERITY_INFORMATION, "txnQ_Restart(): %d Txns pending\n", pTxnQ->aFuncInfo[uFuncId].uTxnsInFlight);
 
-            /* Return PENDING to indicate that the restart will be completed later (in TxnDone) */
-            return TXN_STATUS_PENDING;
-        }
+        /* Return PENDING to indicate that the restart will be completed later (in TxnDone) */
+        return TXN_STATUS_PENDING;
     }
 
     context_LeaveCriticalSection (pTxnQ->hContext);
@@ -394,7 +418,9 @@ void txnQ_Run (TI_HANDLE hTxnQ, TI_UINT32 uFuncId)
 #endif
 
     /* Enable function's queues */
-    pTxnQ->aFuncInfo[uFuncId].eState = FUNC_STATE_RUNNING;
+    context_EnterCriticalSection (pTxnQ->hContext);
+    txnQ_SetFuncState (pTxnQ, uFuncId, FUNC_STATE_RUNNING);
+    context_LeaveCriticalSection (pTxnQ->hContext);
 
     /* Send queued transactions as possible */
     txnQ_RunScheduler (pTxnQ, NULL); 
@@ -412,8 +438,10 @@ void txnQ_Stop (TI_HANDLE hTxnQ, TI_UINT32 uFuncId)
     }
 #endif
 
-    /* Enable function's queues */
-    pTxnQ->aFuncInfo[uFuncId].eState = FUNC_STATE_STOPPED;
+    /* Disable function's queues */
+    context_EnterCriticalSection (pTxnQ->hContext);
+    txnQ_SetFuncState (pTxnQ, uFuncId, FUNC_STATE_STOPPED);
+    context_LeaveCriticalSection (pTxnQ->hContext);
 }
 
 ETxnStatus txnQ_Transact (TI_HANDLE hTxnQ, TTxnStruct *pTxn)
@@ -422,17 +450,27 @@ ETxnStatus txnQ_Transact (TI_HANDLE hTxnQ, TTxnStruct *pTxn)
     TI_UINT32    uFuncId = TXN_PARAM_GET_FUNC_ID(pTxn);
     ETxnStatus   rc;
 
+    TXNQ_STAMP_TXN(pTxnQ, pTxn);
+
     if (TXN_PARAM_GET_SINGLE_STEP(pTxn)) 
     {
+        context_EnterCriticalSection (pTxnQ->hContext);
         pTxnQ->aFuncInfo[uFuncId].pSingleStep = pTxn;
+        pTxnQ->uSingleStepMap |= TXNQ_FUNC_BIT(uFuncId);
+        context_LeaveCriticalSection (pTxnQ->hContext);
         TRACE0(pTxnQ->hReport, REPORT_SEVERITY_INFORMATION, "txnQ_Transact(): Single step Txn\n");
     }
     else 
     {
         TI_STATUS eStatus;
-        TI_HANDLE hQueue = pTxnQ->aTxnQueues[uFuncId][TXN_PARAM_GET_PRIORITY(pTxn)];
+        TI_UINT32 uPrio  = TXN_PARAM_GET_PRIORITY(pTxn);
+        TI_HANDLE hQueue = pTxnQ->aTxnQueues[uFuncId][uPrio];
         context_EnterCriticalSection (pTxnQ->hContext);
         eStatus = que_Enqueue (hQueue, (TI_HANDLE)pTxn);
+        if (eStatus == TI_OK)
+        {
+            pTxnQ->aReadyMap[uPrio] |= TXNQ_FUNC_BIT(uFuncId);
+        }
         context_LeaveCriticalSection (pTxnQ->hContext);
         if (eStatus != TI_OK)
         {
@@ -448,6 +486,25 @@ ETxnStatus txnQ_Transact (TI_HANDLE hTxnQ, TTxnStruct *pTxn)
     return rc;
 }
 
+TI_STATUS txnQ_SetMaxTxnsInFlight (TI_HANDLE hTxnQ, TI_UINT32 uMaxTxns)
+{
+    TTxnQObj *pTxnQ = (TTxnQObj*)hTxnQ;
+
+    if ((uMaxTxns == 0) || (uMaxTxns > TXN_MAX_TXNS_IN_FLIGHT))
+    {
+        TRACE1(pTxnQ->hReport, REPORT_SEVERITY_ERROR, "txnQ_SetMaxTxnsInFlight(): Invalid value %d\n", uMaxTxns);
+        return TI_NOK;
+    }
+
+    context_EnterCriticalSection (pTxnQ->hContext);
+    pTxnQ->uMaxTxnsInFlight = uMaxTxns;
+    context_LeaveCriticalSection (pTxnQ->hContext);
+
+    TRACE1(pTxnQ->hReport, REPORT_SEVERITY_INIT, "txnQ_SetMaxTxnsInFlight(): %d Txns in flight\n", uMaxTxns);
+
+    return TI_OK;
+}
+
 
 /** 
  * \fn     txnQ_ConnectCB
@@ -488,22 +545,33 @@ static void txnQ_TxnDoneCb (TI_HANDLE hTxnQ, void *hTxn)
     TTxnQObj   *pTxnQ   = (TTxnQObj*)hTxnQ;
     TTxnStruct *pTxn    = (TTxnStruct *)hTxn;
     TI_UINT32   uFuncId = TXN_PARAM_GET_FUNC_ID(pTxn);
+    TI_UINT32   uFuncTxnsInFlight;
 
 #ifdef TI_DBG
     TRACE0(pTxnQ->hReport, REPORT_SEVERITY_INFORMATION, "txnQ_TxnDoneCb()\n");
-    if (pTxn != pTxnQ->pCurrTxn) 
+    if (pTxnQ->aFuncInfo[uFuncId].uTxnsInFlight == 0) 
     {
-        TRACE2(pTxnQ->hReport, REPORT_SEVERITY_ERROR, "txnQ_TxnDoneCb(): CB returned pTxn 0x%x  while pCurrTxn is 0x%x !!\n", pTxn, pTxnQ->pCurrTxn);
+        TRACE2(pTxnQ->hReport, REPORT_SEVERITY_ERROR, "txnQ_TxnDoneCb(): CB returned pTxn 0x%x while func %d has no Txn in flight !!\n", pTxn, uFuncId);
     }
 #endif
 
+    /* Indicate that the transaction is no longer processed in the bus-driver */
+    context_EnterCriticalSection (pTxnQ->hContext);
+    pTxnQ->uTxnsInFlight--;
+    uFuncTxnsInFlight = --pTxnQ->aFuncInfo[uFuncId].uTxnsInFlight;
+    TXNQ_RECORD_LATENCY(pTxnQ, aDoneLat, pTxn);
+    context_LeaveCriticalSection (pTxnQ->hContext);
+
     /* If the function of the completed Txn is waiting for restart */
     if (pTxnQ->aFuncInfo[uFuncId].eState == FUNC_STATE_RESTART) 
     {
         TRACE0(pTxnQ->hReport, REPORT_SEVERITY_INFORMATION, "txnQ_TxnDoneCb(): Handling restart\n");
 
-        /* First, Clear the restarted function queues  */
-        txnQ_ClearQueues (hTxnQ, uFuncId);
+        /* First, if it was the function's last Txn in flight, Clear the restarted function queues  */
+        if (uFuncTxnsInFlight == 0)
+        {
+            txnQ_ClearQueues (hTxnQ, uFuncId);
+        }
 
         /* Call function CB for current Txn with restart indication */
         TXN_PARAM_SET_STATUS(pTxn, TXN_PARAM_STATUS_RECOVERY);
@@ -524,9 +592,6 @@ static void txnQ_TxnDoneCb (TI_HANDLE hTxnQ, void *hTxn)
         context_LeaveCriticalSection (pTxnQ->hContext);
     }
 
-    /* Indicate that no transaction is currently processed in the bus-driver */
-    pTxnQ->pCurrTxn = NULL;
-
     /* Send queued transactions as possible (TRUE indicates we are in external context) */
     txnQ_RunScheduler (pTxnQ, NULL); 
 }
@@ -544,7 +609,7 @@ static void txnQ_TxnDoneCb (TI_HANDLE hTxnQ, void *hTxn)
  * \note   
  * \param  pTxnQ     - The module's object
  * \param  pInputTxn - The transaction inserted in the current context (NULL if none)
- * \return COMPLETE if pCurrTxn completed in this context, PENDING if not, ERROR if failed
+ * \return COMPLETE if pInputTxn completed in this context, PENDING if not, ERROR if failed
  * \sa     
  */ 
 static ETxnStatus txnQ_RunScheduler (TTxnQObj *pTxnQ, TTxnStruct *pInputTxn)
@@ -610,7 +675,8 @@ static ETxnStatus txnQ_RunScheduler (TTxnQObj *pTxnQ, TTxnStruct *pInputTxn)
  * \fn     txnQ_Scheduler
  * \brief  Send queued transactions
  * 
- * Issue transactions as long as they are available and the bus is not occupied.
+ * Issue transactions as long as they are available and the bus driver can take them
+ *     (up to uMaxTxnsInFlight transactions not completed yet).
  * Call CBs of completed transactions, except completion of pInputTxn (covered by the return value).
  * Note that this function is called from either internal or external (TxnDone) context.
  * However, the txnQ_RunScheduler which calls it, prevents scheduler reentry.
@@ -628,30 +694,44 @@ static ETxnStatus txnQ_Scheduler (TTxnQObj *pTxnQ, TTxnStruct *pInputTxn)
     /* Use as return value the status of the input transaction (PENDING unless sent and completed here) */
     eInputTxnStatus = TXN_STATUS_PENDING;  
 
-    /* if a previous transaction is in progress, return PENDING */
-    if (pTxnQ->pCurrTxn)
-    {
-        TRACE1(pTxnQ->hReport, REPORT_SEVERITY_INFORMATION, "txnQ_Scheduler(): pCurrTxn isn't null (0x%x) so exit\n", pTxnQ->pCurrTxn);
-        return TXN_STATUS_PENDING;
-    }
-
     /* Loop while transactions are available and can be sent to bus driver */
     while (1)
     {
         TTxnStruct   *pSelectedTxn;
         ETxnStatus    eStatus;
+        TI_UINT32     uFuncId;
 
-        /* Get next enabled transaction by priority. If none, exit loop. */
         context_EnterCriticalSection (pTxnQ->hContext);
+
+        /* If the bus driver is occupied, exit loop (the scheduler is called again upon TxnDone) */
+        if (pTxnQ->uTxnsInFlight >= pTxnQ->uMaxTxnsInFlight)
+        {
+            context_LeaveCriticalSection (pTxnQ->hContext);
+            TRACE1(pTxnQ->hReport, REPORT_SEVERITY_INFORMATION, "txnQ_Scheduler(): %d Txns in flight so exit\n", pTxnQ->uTxnsInFlight);
+            break;
+        }
+
+        /* Get next enabled transaction by priority. If none, exit loop. */
         pSelectedTxn = txnQ_SelectTxn (pTxnQ);
-        context_LeaveCriticalSection (pTxnQ->hContext);
         if (pSelectedTxn == NULL)
         {
+            context_LeaveCriticalSection (pTxnQ->hContext);
             break;
         }
 
-        /* Save transaction in case it will be async (to indicate that the bus driver is busy) */
-        pTxnQ->pCurrTxn = pSelectedTxn;
+        /* Count the transaction until completed (to indicate that the bus driver is busy) */
+        uFuncId = TXN_PARAM_GET_FUNC_ID(pSelectedTxn);
+        pTxnQ->uTxnsInFlight++;
+        pTxnQ->aFuncInfo[uFuncId].uTxnsInFlight++;
+#ifdef TI_DBG
+        if (pTxnQ->uTxnsInFlight > pTxnQ->uTxnsInFlightMax)
+        {
+            pTxnQ->uTxnsInFlightMax = pTxnQ->uTxnsInFlight;
+        }
+#endif
+        TXNQ_RECORD_LATENCY(pTxnQ, aQueueLat, pSelectedTxn);
+
+        context_LeaveCriticalSection (pTxnQ->hContext);
 
         /* Send selected transaction to bus driver */
         eStatus = busDrv_Transact (pTxnQ->hBusDrv, pSelectedTxn);
@@ -667,28 +747,27 @@ static ETxnStatus txnQ_Scheduler (TTxnQObj *pTxnQ, TTxnStruct *pInputTxn)
         /* If transaction completed */
         if (eStatus != TXN_STATUS_PENDING)
         {
-            pTxnQ->pCurrTxn = NULL;
+            TI_STATUS eQueStatus = TI_OK;
+
+            context_EnterCriticalSection (pTxnQ->hContext);
+            pTxnQ->uTxnsInFlight--;
+            pTxnQ->aFuncInfo[uFuncId].uTxnsInFlight--;
+            TXNQ_RECORD_LATENCY(pTxnQ, aDoneLat, pSelectedTxn);
 
             /* If it's not the input transaction, enqueue it in TxnDone queue */
             if (pSelectedTxn != pInputTxn)
             {
-                TI_STATUS eStatus;
+                eQueStatus = que_Enqueue (pTxnQ->hTxnDoneQueue, (TI_HANDLE)pSelectedTxn);
+            }
+            context_LeaveCriticalSection (pTxnQ->hContext);
 
-                context_EnterCriticalSection (pTxnQ->hContext);
-                eStatus = que_Enqueue (pTxnQ->hTxnDoneQueue, (TI_HANDLE)pSelectedTxn);
-                if (eStatus != TI_OK)
-                {
-                    TRACE3(pTxnQ->hReport, REPORT_SEVERITY_ERROR, "txnQ_Scheduler(): Enqueue failed, pTxn=0x%x, HwAddr=0x%x, Len0=%d\n", pSelectedTxn, pSelectedTxn->uHwAddr, pSelectedTxn->aLen[0]);
-                }
-                context_LeaveCriticalSection (pTxnQ->hContext);
+            if (eQueStatus != TI_OK)
+            {
+                TRACE3(pTxnQ->hReport, REPORT_SEVERITY_ERROR, "txnQ_Scheduler(): Enqueue failed, pTxn=0x%x, HwAddr=0x%x, Len0=%d\n", pSelectedTxn, pSelectedTxn->uHwAddr, pSelectedTxn->aLen[0]);
             }
         }
 
-        /* If pending Exit loop! */
-        else 
-        {
-            break;
-        }
+        /* If pending, continue while more transactions may be in flight (checked above) */
     }
 
     /* Dequeue completed transactions and call their functional driver CB */
@@ -726,6 +805,8 @@ static ETxnStatus txnQ_Scheduler (TTxnQObj *pTxnQ, TTxnStruct *pInputTxn)
  * 
  * Called from txnQ_RunScheduler() which is protected in critical section.
  * Select the next enabled transaction by priority.
+ * Instead of polling all queues, a bitmap per priority holds the functions with queued Txns,
+ *     so with the running functions bitmap the selection is a find-first-set.
  * 
  * \note   
  * \param  pTxnQ - The module's object
@@ -737,6 +818,7 @@ static TTxnStruct *txnQ_SelectTxn (TTxnQObj *pTxnQ)
     TTxnStruct *pSelectedTxn;
     TI_UINT32   uFunc;
     TI_UINT32   uPrio;
+    TI_UINT32   uMap;
 
 #ifdef TI_DBG
     /* If within Tx aggregation, dequeue Txn from same queue, and if not NULL return it */
@@ -745,6 +827,12 @@ static TTxnStruct *txnQ_SelectTxn (TTxnQObj *pTxnQ)
         pSelectedTxn = (TTxnStruct *) que_Dequeue (pTxnQ->pAggregQueue);
         if (pSelectedTxn != NULL)
         {
+            if (que_Size (pTxnQ->pAggregQueue) == 0)
+            {
+                uPrio = TXN_PARAM_GET_PRIORITY(pSelectedTxn);
+                pTxnQ->aReadyMap[uPrio] &= ~TXNQ_FUNC_BIT(TXN_PARAM_GET_FUNC_ID(pSelectedTxn));
+            }
+
             /* If aggregation ended, reset the aggregation-queue pointer */
             if (TXN_PARAM_GET_AGGREGATE(pSelectedTxn) == TXN_AGGREGATE_OFF) 
             {
@@ -761,41 +849,42 @@ static TTxnStruct *txnQ_SelectTxn (TTxnQObj *pTxnQ)
     }
 #endif
 
-    /* For all functions, if single-step Txn waiting, return it (sent even if function is stopped) */
-    for (uFunc = pTxnQ->uMinFuncId; uFunc <= pTxnQ->uMaxFuncId; uFunc++)
+    /* If single-step Txn waiting in any function, return it (sent even if function is stopped) */
+    if (pTxnQ->uSingleStepMap)
     {
+        uFunc = TXNQ_FIRST_FUNC(pTxnQ->uSingleStepMap);
         pSelectedTxn = pTxnQ->aFuncInfo[uFunc].pSingleStep;
-        if (pSelectedTxn != NULL)
-        {
-            pTxnQ->aFuncInfo[uFunc].pSingleStep = NULL;
-            return pSelectedTxn;
-        }
+        pTxnQ->aFuncInfo[uFunc].pSingleStep = NULL;
+        pTxnQ->uSingleStepMap &= ~TXNQ_FUNC_BIT(uFunc);
+        return pSelectedTxn;
     }
 
     /* For all priorities from high to low */
     for (uPrio = 0; uPrio < MAX_PRIORITY; uPrio++)
     {
-        /* For all functions */
-        for (uFunc = pTxnQ->uMinFuncId; uFunc <= pTxnQ->uMaxFuncId; uFunc++)
+        /* Take the lowest running function with a non empty queue of this priority */
+        uMap = pTxnQ->aReadyMap[uPrio] & pTxnQ->uRunningMap;
+        if (uMap == 0)
+        {
+            continue;
+        }
+        uFunc = TXNQ_FIRST_FUNC(uMap);
+
+        pSelectedTxn = (TTxnStruct *) que_Dequeue (pTxnQ->aTxnQueues[uFunc][uPrio]);
+        if (que_Size (pTxnQ->aTxnQueues[uFunc][uPrio]) == 0)
+        {
+            pTxnQ->aReadyMap[uPrio] &= ~TXNQ_FUNC_BIT(uFunc);
+        }
+        if (pSelectedTxn != NULL)
         {
-            /* If function running and uses this priority */
-            if (pTxnQ->aFuncInfo[uFunc].eState == FUNC_STATE_RUNNING  &&
-                pTxnQ->aFuncInfo[uFunc].uNumPrios > uPrio)
-            {
-                /* Dequeue Txn from current func and priority queue, and if not NULL return it */
-                pSelectedTxn = (TTxnStruct *) que_Dequeue (pTxnQ->aTxnQueues[uFunc][uPrio]);
-                if (pSelectedTxn != NULL)
-                {
 #ifdef TI_DBG
-                    /* If aggregation begins, save the aggregation-queue pointer to ensure continuity */
-                    if (TXN_PARAM_GET_AGGREGATE(pSelectedTxn) == TXN_AGGREGATE_ON) 
-                    {
-                        pTxnQ->pAggregQueue = pTxnQ->aTxnQueues[uFunc][uPrio];
-                    }
-#endif
-                    return pSelectedTxn;
-                }
+            /* If aggregation begins, save the aggregation-queue pointer to ensure continuity */
+            if (TXN_PARAM_GET_AGGREGATE(pSelectedTxn) == TXN_AGGREGATE_ON) 
+            {
+                pTxnQ->pAggregQueue = pTxnQ->aTxnQueues[uFunc][uPrio];
             }
+#endif
+            return pSelectedTxn;
         }
     }
 
@@ -804,6 +893,34 @@ static TTxnStruct *txnQ_SelectTxn (TTxnQObj *pTxnQ)
 }
 
 
+/** 
+ * \fn     txnQ_SetFuncState
+ * \brief  Set function state
+ * 
+ * Set the function's SM state, and update the running functions bitmap accordingly.
+ * 
+ * \note   Called in critical section.
+ * \param  pTxnQ   - The module's object
+ * \param  uFuncId - The function ID
+ * \param  eState  - The new state
+ * \return void
+ * \sa     txnQ_SelectTxn
+ */ 
+static void txnQ_SetFuncState (TTxnQObj *pTxnQ, TI_UINT32 uFuncId, EFuncState eState)
+{
+    pTxnQ->aFuncInfo[uFuncId].eState = eState;
+
+    if (eState == FUNC_STATE_RUNNING)
+    {
+        pTxnQ->uRunningMap |= TXNQ_FUNC_BIT(uFuncId);
+    }
+    else
+    {
+        pTxnQ->uRunningMap &= ~TXNQ_FUNC_BIT(uFuncId);
+    }
+}
+
+
 void txnQ_ClearQueues (TI_HANDLE hTxnQ, TI_UINT32 uFuncId)
 {
     TTxnQObj        *pTxnQ = (TTxnQObj*)hTxnQ;
@@ -813,6 +930,7 @@ void txnQ_ClearQueues (TI_HANDLE hTxnQ, TI_UINT32 uFuncId)
     context_EnterCriticalSection (pTxnQ->hContext);
 
     pTxnQ->aFuncInfo[uFuncId].pSingleStep = NULL;
+    pTxnQ->uSingleStepMap &= ~TXNQ_FUNC_BIT(uFuncId);
 
     /* For all function priorities */
     for (uPrio = 0; uPrio < pTxnQ->aFuncInfo[uFuncId].uNumPrios; uPrio++)
@@ -829,10 +947,12 @@ void txnQ_ClearQueues (TI_HANDLE hTxnQ, TI_UINT32 uFuncId)
              * do not call fTxnQueueDoneCb (hCbHandle, pTxn) callback 
              */
         } while (pTxn != NULL);
+
+        pTxnQ->aReadyMap[uPrio] &= ~TXNQ_FUNC_BIT(uFuncId);
     }
 
     /* Clear state - for restart (doesn't call txnQ_Open) */
-    pTxnQ->aFuncInfo[uFuncId].eState = FUNC_STATE_RUNNING;
+    txnQ_SetFuncState (pTxnQ, uFuncId, FUNC_STATE_RUNNING);
 
     context_LeaveCriticalSection (pTxnQ->hContext);
 }
@@ -846,6 +966,109 @@ void txnQ_PrintQueues (TI_HANDLE hTxnQ)
     WLAN_OS_REPORT(("================\n"));
     que_Print(pTxnQ->aTxnQueues[TXN_FUNC_ID_WLAN][TXN_LOW_PRIORITY]);
     que_Print(pTxnQ->aTxnQueues[TXN_FUNC_ID_WLAN][TXN_HIGH_PRIORITY]);
+
+    WLAN_OS_REPORT(("Txns in flight: %d, max %d, limit %d\n", pTxnQ->uTxnsInFlight, pTxnQ->uTxnsInFlightMax, pTxnQ->uMaxTxnsInFlight));
+    WLAN_OS_REPORT(("Ready bitmaps: high 0x%x, low 0x%x, running 0x%x, single-step 0x%x\n", 
+                    pTxnQ->aReadyMap[TXN_HIGH_PRIORITY], pTxnQ->aReadyMap[TXN_LOW_PRIORITY], 
+                    pTxnQ->uRunningMap, pTxnQ->uSingleStepMap));
+    txnQ_PrintLatency (pTxnQ, pTxnQ->aQueueLat, "Queued (Transact to bus driver)");
+    txnQ_PrintLatency (pTxnQ, pTxnQ->aDoneLat, "Done (bus driver to TxnDone)");
+}
+
+void txnQ_ResetStats (TI_HANDLE hTxnQ)
+{
+    TTxnQObj    *pTxnQ   = (TTxnQObj*)hTxnQ;
+
+    context_EnterCriticalSection (pTxnQ->hContext);
+    os_memoryZero (pTxnQ->hOs, pTxnQ->aQueueLat, sizeof(pTxnQ->aQueueLat));
+    os_memoryZero (pTxnQ->hOs, pTxnQ->aDoneLat, sizeof(pTxnQ->aDoneLat));
+    pTxnQ->uTxnsInFlightMax = pTxnQ->uTxnsInFlight;
+    context_LeaveCriticalSection (pTxnQ->hContext);
+}
+
+
+/** 
+ * \fn     txnQ_RecordLatency
+ * \brief  Add a Txn latency to its histogram
+ * 
+ * Add the time since the Txn time-stamp to the Txn's function and priority histogram, 
+ *     and restart the time-stamp (for the next Txn phase).
+ * 
+ * \note   Called in critical section.
+ * \param  pTxnQ - The module's object
+ * \param  aHist - The histograms of the Txn phase (queued or done)
+ * \param  pTxn  - The transaction
+ * \return void
+ * \sa     txnQ_PrintLatency
+ */ 
+static void txnQ_RecordLatency (TTxnQObj *pTxnQ, TTxnLatHist aHist[][MAX_PRIORITY], TTxnStruct *pTxn)
+{
+    TTxnLatHist *pHist = &aHist[TXN_PARAM_GET_FUNC_ID(pTxn)][TXN_PARAM_GET_PRIORITY(pTxn)];
+    TI_UINT32    uTimeUs = os_timeStampUs (pTxnQ->hOs);
+    TI_UINT32    uLatencyUs = uTimeUs - pTxn->uTimeStampUs;
+    TI_UINT32    uBucket;
+
+    /* The bucket is the latency bits number (0 for 0 usec, 1 for 1 usec, 2 for 2-3 usec etc.) */
+    for (uBucket = 0; (uBucket < TXN_LAT_HIST_BUCKETS - 1) && (uLatencyUs >> uBucket); uBucket++);
+
+    pHist->aBuckets[uBucket]++;
+    pHist->uCount++;
+    pHist->uSumUs += uLatencyUs;
+    if (uLatencyUs > pHist->uMaxUs)
+    {
+        pHist->uMaxUs = uLatencyUs;
+    }
+
+    pTxn->uTimeStampUs = uTimeUs;
+}
+
+
+/** 
+ * \fn     txnQ_PrintLatency
+ * \brief  Print the latency histograms of a Txn phase
+ * 
+ * Print a line per function and priority that had transactions.
+ * 
+ * \note   
+ * \param  pTxnQ  - The module's object
+ * \param  aHist  - The histograms of the Txn phase (queued or done)
+ * \param  pTitle - The Txn phase name
+ * \return void
+ * \sa     txnQ_PrintQueues
+ */ 
+static void txnQ_PrintLatency (TTxnQObj *pTxnQ, TTxnLatHist aHist[][MAX_PRIORITY], char *pTitle)
+{
+    TI_UINT32 uFunc;
+    TI_UINT32 uPrio;
+    TI_UINT32 uBucket;
+
+    WLAN_OS_REPORT(("%s latency [usec]:\n", pTitle));
+    WLAN_OS_REPORT(("Func Prio    Count    Avg    Max |"));
+    for (uBucket = 0; uBucket < TXN_LAT_HIST_BUCKETS; uBucket++)
+    {
+        WLAN_OS_REPORT((" %6d", uBucket ? (1 << (uBucket - 1)) : 0));
+    }
+    WLAN_OS_REPORT(("+\n"));
+
+    for (uFunc = 0; uFunc < MAX_FUNCTIONS; uFunc++)
+    {
+        for (uPrio = 0; uPrio < MAX_PRIORITY; uPrio++)
+        {
+            TTxnLatHist *pHist = &aHist[uFunc][uPrio];
+
+            if (pHist->uCount == 0)
+            {
+                continue;
+            }
+            WLAN_OS_REPORT(("%4d %4d %8d %6d %6d |", uFunc, uPrio, pHist->uCount, 
+                            (TI_UINT32)(pHist->uSumUs / pHist->uCount), pHist->uMaxUs));
+            for (uBucket = 0; uBucket < TXN_LAT_HIST_BUCKETS; uBucket++)
+            {
+                WLAN_OS_REPORT((" %6d", pHist->aBuckets[uBucket]));
+            }
+            WLAN_OS_REPORT(("\n"));
+        }
+    }
 }
 #endif /* TI_DBG */
 
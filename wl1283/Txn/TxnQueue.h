@@ -50,6 +50,7 @@
 /************************************************************************
  * Defines
  ************************************************************************/
+#define TXN_MAX_TXNS_IN_FLIGHT      8   /* Max transactions passed to a queueing bus driver before the first completes */
 
 
 /************************************************************************
@@ -240,6 +241,22 @@ void        txnQ_Stop (TI_HANDLE hTxnQ, TI_UINT32 uFuncId);
  */ 
 ETxnStatus  txnQ_Transact (TI_HANDLE hTxnQ, TTxnStruct *pTxn);
 
+/** \brief	Set the number of transactions in flight
+ * 
+ * \param  hTxnQ    - The module's object
+ * \param  uMaxTxns - Max transactions passed to the bus driver and not completed yet (1 to TXN_MAX_TXNS_IN_FLIGHT)
+ * \return TI_OK / TI_NOK if out of range
+ * 
+ * \par Description
+ * By default a single transaction is in flight, as required by bus drivers that handle one
+ * transaction at a time (SDIO, WSPI). A bus driver that queues transactions internally and
+ * completes them in order may accept more, so the next transactions are issued without
+ * waiting for the previous completion.
+ * 
+ * \sa
+ */ 
+TI_STATUS   txnQ_SetMaxTxnsInFlight (TI_HANDLE hTxnQ, TI_UINT32 uMaxTxns);
+
 /** 
  * \fn     txnQ_ClearQueues
  * \brief  Clear the function queues
@@ -262,10 +279,23 @@ void        txnQ_ClearQueues (TI_HANDLE hTxnQ, TI_UINT32 uFuncId);
  * \return void
  * 
  * \par Description
+ * Print the WLAN queues, and the queueing (Transact to bus driver) and completion
+ * (bus driver to TxnDone) latency histograms per function and priority.
  * 
- * \sa
+ * \sa	txnQ_ResetStats
  */ 
 void txnQ_PrintQueues (TI_HANDLE hTxnQ);
+
+/** \brief	Reset the latency histograms
+ * 
+ * \param  hTxnQ - The module's object
+ * \return void
+ * 
+ * \par Description
+ * 
+ * \sa	txnQ_PrintQueues
+ */ 
+void txnQ_ResetStats (TI_HANDLE hTxnQ);
 #endif
 
 
@@ -0,0 +1,945 @@
+/*
+ * FwSim.c
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+ 
+/** \file   FwSim.c 
+ *  \brief  Firmware stand-in for running the driver data path on a host (no WL1283 device).
+ *
+ *  Emulates the device side of the host-slave interface as seen through the work partition:
+ *    - The partition and ELP control registers.
+ *    - The interrupt status/mask registers and the level interrupt line.
+ *    - The FwStatus_t area: Rx packets counter and short descriptors ring, Tx-results counter
+ *        and the per AC released Tx memory blocks counters.
+ *    - The Tx FIFO (SLV_MEM_DATA writes), parsed into packets by their TxIfDescriptor_t.
+ *    - The Tx-Result interface (results queue and host counter).
+ *    - The Rx FIFO (SLV_MEM_DATA reads), fed by fwSim_InjectRxPacket().
+ *    - The command mailbox, where every command (and each IE of a multi-IE command) is completed successfully.
+ *  All other chip addresses inside the work partition are backed by plain memory.
+ *
+ *  \see    FwSim.h, SimBusDrv.c
+ */
+
+#include <string.h>
+#include <time.h>
+#include "tidef.h"
+#include "TWDriver.h"
+#include "TWDriverInternal.h"
+#include "public_host_int.h"
+#include "public_descriptors.h"
+#include "FwSim.h"
+
+
+/************************************************************************
+ * Defines
+ ************************************************************************/
+
+/* Bus addresses handled outside the partition translation (see TwIf.c) */
+#define FW_SIM_PART_REGS_ADDR       0x1FFC0     /* Partition registers (4 couples of address & size) */
+#define FW_SIM_PART_REGS_NUM        7
+#define FW_SIM_ELP_CTRL_ADDR        0x1FFFC     /* ELP control register */
+#define FW_SIM_ELP_CTRL_AWAKE       1
+
+/* Chip memory and registers backed by the stand-in (the work partition regions, see HwInit.c) */
+#define FW_SIM_MEM_ADDR             0x40000
+#define FW_SIM_MEM_SIZE             0x14FC0
+#define FW_SIM_REG_ADDR             REGISTERS_BASE
+#define FW_SIM_REG_SIZE             0xA000
+
+/* FW memory layout */
+#define FW_SIM_FW_STATUS_ADDR       0x40404     /* FwStatus_t (without intrStatus), mapped by partition 4 */
+#define FW_SIM_CMD_MBOX_ADDR        CMD_MBOX_ADDRESS
+#define FW_SIM_EVENT_MBOX_ADDR      0x42000
+#define FW_SIM_TX_RESULT_ADDR       0x43000
+#define FW_SIM_PKT_POOL_ADDR        0x44000
+
+#define FW_SIM_CMD_MAX_IES          (MAX_CMD_PARAMS / sizeof(EleHdrStruct))   /* IEs in a multi-IE command */
+#define FW_SIM_TX_PEND_SIZE         64          /* Tx packets in FW (must exceed NUM_TX_DESCRIPTORS) */
+#define FW_SIM_RX_FIFO_SIZE         0x10000     /* Rx FIFO bytes (power of 2) */
+#define FW_SIM_RX_FIFO_MASK         (FW_SIM_RX_FIFO_SIZE - 1)
+
+#define FW_SIM_RX_RATE              1           /* Reported Rx rate index */
+#define FW_SIM_RX_CHANNEL           1
+#define FW_SIM_RX_LEVEL             (-45)
+#define FW_SIM_RX_SNR               30
+
+
+/************************************************************************
+ * Types
+ ************************************************************************/
+
+/* A Tx packet held by the FW from its transfer until its Tx-Result is posted */
+typedef struct
+{
+    TI_UINT8        uDescId;
+    TI_UINT8        uAc;
+    TI_UINT8        uMemBlks;
+    TI_UINT32       uXferTime;          /* FW time (usec) when the packet was written to the FW */
+} TFwSimTxPkt;
+
+/* The firmware stand-in object */
+typedef struct
+{
+    TFwSimCfg       tCfg;
+    TFwSimStats     tStats;
+    TFwSimIrqCb     fIrqCb;             /* Interrupt line callback */
+    TI_HANDLE       hIrqCbHndl;
+
+    TI_UINT32       aPartRegs[FW_SIM_PART_REGS_NUM];
+    TI_BOOL         bAwake;             /* ELP state */
+    TI_UINT32       uIntrPending;       /* Interrupt status (cleared upon FwStatus read) */
+    TI_UINT32       uIntrMask;          /* HINT_MASK register value (1 = masked) */
+    TI_BOOL         bIrqEnabled;        /* FALSE from signaling the host until it serviced the interrupt */
+
+    /* Tx path */
+    TI_UINT8        aTxHdr[sizeof(TxIfDescriptor_t)]; /* Descriptor of current Tx FIFO packet */
+    TI_UINT32       uTxHdrLen;          /* Descriptor bytes received so far */
+    TI_UINT32       uTxPktRemain;       /* Bytes left to receive for current packet (after descriptor) */
+    TFwSimTxPkt     aTxPkts[FW_SIM_TX_PEND_SIZE];
+    TI_UINT32       uTxPktsIn;          /* Packets written by the host */
+    TI_UINT32       uTxPktsDone;        /* Packets transmitted (blocks released) */
+    TI_UINT32       uTxPktsPosted;      /* Packets with a Tx-Result posted to the host */
+    TI_UINT32       uTxBlksUsed;        /* Tx memory blocks currently held by the FW */
+    TI_UINT32       aTxReleasedBlks[NUM_TX_QUEUES];
+
+    /* Rx path */
+    TI_UINT8        aRxFifo[FW_SIM_RX_FIFO_SIZE];
+    TI_UINT32       uRxFifoIn;          /* Bytes written to the Rx FIFO (free running) */
+    TI_UINT32       uRxFifoOut;         /* Bytes read by the host (free running) */
+    TI_UINT32       aRxPktEnd[NUM_RX_PKT_DESC]; /* FIFO end offset of each pending Rx packet */
+    TI_UINT32       uRxPktsIn;          /* Rx packets injected (the FwStatus fwRxCntr) */
+    TI_UINT32       uRxPktsOut;         /* Rx packets fully read by the host */
+
+    /* Backing store of the work partition regions */
+    TI_UINT8        aMem[FW_SIM_MEM_SIZE];
+    TI_UINT8        aReg[FW_SIM_REG_SIZE];
+
+} TFwSim;
+
+
+/************************************************************************
+ * Internal functions prototypes
+ ************************************************************************/
+static TI_UINT32    fwSim_BusToChip     (TI_UINT32 uBusAddr, TI_UINT32 *pChipAddr);
+static TI_UINT8 *   fwSim_ChipPtr       (TI_UINT32 uChipAddr, TI_UINT32 uLen);
+static void         fwSim_ChipWrite     (TI_UINT32 uChipAddr, TI_UINT8 *pBuf, TI_UINT32 uLen);
+static void         fwSim_ChipRead      (TI_UINT32 uChipAddr, TI_UINT8 *pBuf, TI_UINT32 uLen);
+static void         fwSim_CmdReceived   (void);
+static void         fwSim_TxFifoWrite   (TI_UINT8 *pBuf, TI_UINT32 uLen);
+static void         fwSim_TxPktReceived (TxIfDescriptor_t *pDesc);
+static TI_UINT32    fwSim_PostTxResults (void);
+static void         fwSim_RxFifoRead    (TI_UINT8 *pBuf, TI_UINT32 uLen);
+static void         fwSim_UpdateStatus  (void);
+static void         fwSim_RaiseIntr     (TI_UINT32 uIntr);
+static void         fwSim_UpdateIrq     (void);
+static TI_UINT32    fwSim_TimeUs        (void);
+
+
+/* The FW AC per TID (same as the host WMEQosTagToACTable) */
+static const TI_UINT8 aTidToAc[MAX_NUM_OF_802_1d_TAGS] = 
+    {QOS_AC_BE, QOS_AC_BK, QOS_AC_BK, QOS_AC_BE, QOS_AC_VI, QOS_AC_VI, QOS_AC_VO, QOS_AC_VO};
+
+static TFwSim tFwSim;
+
+
+
+/************************************************************************
+ *
+ *   Module functions implementation
+ *
+ ************************************************************************/
+
+/** 
+ * \fn     fwSim_Init 
+ * \brief  Reset the firmware stand-in
+ * 
+ * Reset all FW state to its after-boot values and save the interrupt line callback.
+ * 
+ * \note   The host should set the work partition before any other access.
+ * \param  pCfg       - The FW configuration
+ * \param  fIrqCb     - Called upon interrupt line assertion (as the platform IRQ handler)
+ * \param  hIrqCbHndl - The callback handle
+ * \return void
+ * \sa     fwSim_InterruptServiced
+ */ 
+void fwSim_Init (TFwSimCfg *pCfg, TFwSimIrqCb fIrqCb, TI_HANDLE hIrqCbHndl)
+{
+    TI_UINT32 *pReg;
+
+    memset (&tFwSim, 0, sizeof(tFwSim));
+
+    tFwSim.tCfg        = *pCfg;
+    tFwSim.fIrqCb      = fIrqCb;
+    tFwSim.hIrqCbHndl  = hIrqCbHndl;
+    tFwSim.bAwake      = TI_TRUE;
+    tFwSim.uIntrMask   = ACX_INTR_ALL;
+    tFwSim.bIrqEnabled = TI_TRUE;
+
+    if (tFwSim.tCfg.uRxPendingMax == 0 || tFwSim.tCfg.uRxPendingMax >= NUM_RX_PKT_DESC)
+    {
+        /* A full descriptors ring can't be distinguished from an empty one */
+        tFwSim.tCfg.uRxPendingMax = NUM_RX_PKT_DESC - 1;
+    }
+
+    /* Provide the mailboxes addresses as the FW does after boot */
+    pReg  = (TI_UINT32 *)fwSim_ChipPtr (REG_COMMAND_MAILBOX_PTR, REGISTER_SIZE);
+    *pReg = ENDIAN_HANDLE_LONG(FW_SIM_CMD_MBOX_ADDR);
+    pReg  = (TI_UINT32 *)fwSim_ChipPtr (REG_EVENT_MAILBOX_PTR, REGISTER_SIZE);
+    *pReg = ENDIAN_HANDLE_LONG(FW_SIM_EVENT_MBOX_ADDR);
+
+    fwSim_UpdateStatus ();
+}
+
+
+/** 
+ * \fn     fwSim_GetDmaParams 
+ * \brief  Provide the FW memory configuration
+ * 
+ * Provide the information normally retrieved from the FW by the memory map interrogation.
+ * 
+ * \note   
+ * \param  pDmaParams - The DMA parameters to fill
+ * \return void
+ * \sa     
+ */ 
+void fwSim_GetDmaParams (TDmaParams *pDmaParams)
+{
+    pDmaParams->NumTxBlocks           = tFwSim.tCfg.uNumTxBlocks;
+    pDmaParams->NumRxBlocks           = FW_SIM_RX_FIFO_SIZE >> 8;
+    pDmaParams->fwTxResultInterface   = (void *)(unsigned long)FW_SIM_TX_RESULT_ADDR;
+    pDmaParams->PacketMemoryPoolStart = FW_SIM_PKT_POOL_ADDR;
+}
+
+
+/** 
+ * \fn     fwSim_Write 
+ * \brief  Bus write transaction
+ * 
+ * Translate the bus address through the current partition and write to the FW.
+ * 
+ * \note   
+ * \param  uBusAddr   - The bus address (as translated by TwIf)
+ * \param  pBuf       - The data
+ * \param  uLen       - The data length in bytes
+ * \param  bFixedAddr - If TRUE, all data is written to the same address
+ * \return void
+ * \sa     fwSim_Read
+ */ 
+void fwSim_Write (TI_UINT32 uBusAddr, TI_UINT8 *pBuf, TI_UINT32 uLen, TI_BOOL bFixedAddr)
+{
+    TI_UINT32 uChipAddr;
+    TI_UINT32 uPartLen;
+
+    /* ELP control register */
+    if (uBusAddr == FW_SIM_ELP_CTRL_ADDR)
+    {
+        if (pBuf[0] == FW_SIM_ELP_CTRL_AWAKE)
+        {
+            tFwSim.tStats.uElpWakeups++;
+            if (!tFwSim.bAwake)
+            {
+                tFwSim.bAwake = TI_TRUE;
+                fwSim_RaiseIntr (ACX_INTR_HW_AVAILABLE);
+            }
+        }
+        else
+        {
+            tFwSim.bAwake = TI_FALSE;
+        }
+        return;
+    }
+
+    /* Partition registers */
+    if (uBusAddr >= FW_SIM_PART_REGS_ADDR)
+    {
+        TI_UINT32 uIndex = (uBusAddr - FW_SIM_PART_REGS_ADDR) >> 2;
+
+        if (uLen != REGISTER_SIZE || uIndex >= FW_SIM_PART_REGS_NUM)
+        {
+            tFwSim.tStats.uErrors++;
+            return;
+        }
+        tFwSim.aPartRegs[uIndex] = ENDIAN_HANDLE_LONG(*(TI_UINT32 *)pBuf);
+        return;
+    }
+
+    if (!tFwSim.bAwake)
+    {
+        tFwSim.tStats.uErrors++;
+    }
+
+    if (bFixedAddr)
+    {
+        fwSim_BusToChip (uBusAddr, &uChipAddr);
+        fwSim_ChipWrite (uChipAddr, pBuf, uLen);
+        return;
+    }
+
+    /* Split the access between the partition regions it spans */
+    while (uLen > 0)
+    {
+        uPartLen = fwSim_BusToChip (uBusAddr, &uChipAddr);
+        if (uPartLen > uLen)
+        {
+            uPartLen = uLen;
+        }
+        fwSim_ChipWrite (uChipAddr, pBuf, uPartLen);
+        uBusAddr += uPartLen;
+        pBuf     += uPartLen;
+        uLen     -= uPartLen;
+    }
+}
+
+
+/** 
+ * \fn     fwSim_Read 
+ * \brief  Bus read transaction
+ * 
+ * Translate the bus address through the current partition and read from the FW.
+ * 
+ * \note   
+ * \param  uBusAddr   - The bus address (as translated by TwIf)
+ * \param  pBuf       - The buffer to read into
+ * \param  uLen       - The data length in bytes
+ * \param  bFixedAddr - If TRUE, all data is read from the same address
+ * \return void
+ * \sa     fwSim_Write
+ */ 
+void fwSim_Read (TI_UINT32 uBusAddr, TI_UINT8 *pBuf, TI_UINT32 uLen, TI_BOOL bFixedAddr)
+{
+    TI_UINT32 uChipAddr;
+    TI_UINT32 uPartLen;
+
+    if (uBusAddr >= FW_SIM_PART_REGS_ADDR)
+    {
+        memset (pBuf, 0, uLen);
+        return;
+    }
+
+    if (!tFwSim.bAwake)
+    {
+        tFwSim.tStats.uErrors++;
+    }
+
+    if (bFixedAddr)
+    {
+        fwSim_BusToChip (uBusAddr, &uChipAddr);
+        fwSim_ChipRead (uChipAddr, pBuf, uLen);
+        return;
+    }
+
+    while (uLen > 0)
+    {
+        uPartLen = fwSim_BusToChip (uBusAddr, &uChipAddr);
+        if (uPartLen > uLen)
+        {
+            uPartLen = uLen;
+        }
+        fwSim_ChipRead (uChipAddr, pBuf, uPartLen);
+        uBusAddr += uPartLen;
+        pBuf     += uPartLen;
+        uLen     -= uPartLen;
+    }
+}
+
+
+/** 
+ * \fn     fwSim_InterruptServiced 
+ * \brief  Re-enable the interrupt line
+ * 
+ * Called when the host finished handling an interrupt (os_InterruptServiced).
+ * Since the line is level triggered, signal again if unmasked interrupts are still pending.
+ * 
+ * \note   
+ * \return void
+ * \sa     
+ */ 
+void fwSim_InterruptServiced (void)
+{
+    tFwSim.bIrqEnabled = TI_TRUE;
+    fwSim_UpdateIrq ();
+}
+
+
+/** 
+ * \fn     fwSim_InjectRxPacket 
+ * \brief  Receive a packet from the air
+ * 
+ * Add the packet with its Rx descriptor to the Rx FIFO, indicate it in the FwStatus 
+ *   descriptors ring and raise the DATA interrupt.
+ * 
+ * \note   
+ * \param  pFrame    - The 802.11 frame (header and body)
+ * \param  uLen      - The frame length in bytes
+ * \param  eClassTag - The FW packet classification
+ * \return TI_OK if accepted, TI_NOK if no room in the FW (retry after the host reads pending packets)
+ * \sa     
+ */ 
+TI_STATUS fwSim_InjectRxPacket (TI_UINT8 *pFrame, TI_UINT32 uLen, PacketClassTag_e eClassTag)
+{
+    RxIfDescriptor_t tDesc;
+    TI_UINT32        uPktLen   = sizeof(RxIfDescriptor_t) + uLen;
+    TI_UINT32        uWords    = (uPktLen + 3) >> 2;
+    TI_UINT32        uFifoFree = FW_SIM_RX_FIFO_SIZE - (tFwSim.uRxFifoIn - tFwSim.uRxFifoOut);
+    TI_UINT32        uRxDesc   = 0;
+    TI_UINT32        i;
+    TI_UINT8        *pSrc;
+
+    if ((tFwSim.uRxPktsIn - tFwSim.uRxPktsOut >= tFwSim.tCfg.uRxPendingMax) || 
+        (uFifoFree < (uWords << 2))                                        ||
+        (uWords > 0xFFF))
+    {
+        tFwSim.tStats.uRxRejected++;
+        return TI_NOK;
+    }
+
+    memset (&tDesc, 0, sizeof(tDesc));
+    tDesc.length           = ENDIAN_HANDLE_WORD(uWords);
+    tDesc.status           = RX_DESC_STATUS_SUCCESS;
+    tDesc.flags            = RX_DESC_BAND_BG;
+    tDesc.rate             = FW_SIM_RX_RATE;
+    tDesc.channel          = FW_SIM_RX_CHANNEL;
+    tDesc.rx_level         = FW_SIM_RX_LEVEL;
+    tDesc.rx_snr           = FW_SIM_RX_SNR;
+    tDesc.timestamp        = ENDIAN_HANDLE_LONG(fwSim_TimeUs ());
+    tDesc.packet_class_tag = eClassTag;
+    tDesc.extraBytes       = (uWords << 2) - uPktLen;
+
+    /* Copy descriptor, frame and padding to the Rx FIFO */
+    for (i = 0, pSrc = (TI_UINT8 *)&tDesc; i < (uWords << 2); i++)
+    {
+        TI_UINT8 uByte;
+
+        if (i < sizeof(RxIfDescriptor_t))
+        {
+            uByte = pSrc[i];
+        }
+        else if (i < uPktLen)
+        {
+            uByte = pFrame[i - sizeof(RxIfDescriptor_t)];
+        }
+        else
+        {
+            uByte = 0;
+        }
+        tFwSim.aRxFifo[(tFwSim.uRxFifoIn + i) & FW_SIM_RX_FIFO_MASK] = uByte;
+    }
+    tFwSim.uRxFifoIn += uWords << 2;
+    tFwSim.aRxPktEnd[tFwSim.uRxPktsIn % NUM_RX_PKT_DESC] = tFwSim.uRxFifoIn;
+
+    /* Indicate the packet in the FwStatus descriptors ring */
+    RX_DESC_SET_MEM_BLK(uRxDesc, ((tFwSim.uRxFifoIn >> 8) & 0xFF));
+    RX_DESC_SET_LENGTH(uRxDesc, uWords);
+    uRxDesc |= ((TI_UINT32)eClassTag) << 24;
+    ((FwStatus_t *)(fwSim_ChipPtr (FW_SIM_FW_STATUS_ADDR, 0) - REGISTER_SIZE))->rxPktsDesc[tFwSim.uRxPktsIn % NUM_RX_PKT_DESC] = 
+        ENDIAN_HANDLE_LONG(uRxDesc);
+    tFwSim.uRxPktsIn++;
+    tFwSim.tStats.uRxPkts++;
+
+    fwSim_UpdateStatus ();
+    fwSim_RaiseIntr (ACX_INTR_DATA);
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     fwSim_TxComplete 
+ * \brief  Complete transmission of pending Tx packets
+ * 
+ * Release the Tx memory blocks of up to uMaxPkts packets held by the FW, and post their 
+ *   Tx-Results as far as the results queue allows.
+ * Called internally upon Tx FIFO write if bTxCmpltImmediate is configured.
+ * 
+ * \note   
+ * \param  uMaxPkts - Max number of packets to complete
+ * \return Number of completed packets
+ * \sa     
+ */ 
+TI_UINT32 fwSim_TxComplete (TI_UINT32 uMaxPkts)
+{
+    TI_UINT32 uNumPkts = 0;
+
+    while ((uNumPkts < uMaxPkts) && (tFwSim.uTxPktsDone != tFwSim.uTxPktsIn))
+    {
+        TFwSimTxPkt *pPkt = &tFwSim.aTxPkts[tFwSim.uTxPktsDone % FW_SIM_TX_PEND_SIZE];
+
+        tFwSim.aTxReleasedBlks[pPkt->uAc] += pPkt->uMemBlks;
+        tFwSim.uTxBlksUsed -= pPkt->uMemBlks;
+        tFwSim.uTxPktsDone++;
+        uNumPkts++;
+    }
+
+    if (uNumPkts > 0)
+    {
+        fwSim_PostTxResults ();
+        fwSim_UpdateStatus ();
+        fwSim_RaiseIntr (ACX_INTR_DATA);
+    }
+
+    return uNumPkts;
+}
+
+
+/** 
+ * \fn     fwSim_GetStats 
+ * \brief  Get the FW statistics
+ * 
+ * \note   
+ * \param  pStats - The statistics to fill
+ * \return void
+ * \sa     
+ */ 
+void fwSim_GetStats (TFwSimStats *pStats)
+{
+    *pStats = tFwSim.tStats;
+}
+
+
+
+/************************************************************************
+ *
+ *   Internal functions implementation
+ *
+ ************************************************************************/
+
+/* Translate a bus address to a chip address. Return the bytes left in the partition region. */
+static TI_UINT32 fwSim_BusToChip (TI_UINT32 uBusAddr, TI_UINT32 *pChipAddr)
+{
+    TI_UINT32 uMemSize1 = tFwSim.aPartRegs[0];
+    TI_UINT32 uMemSize2 = tFwSim.aPartRegs[2];
+    TI_UINT32 uMemSize3 = tFwSim.aPartRegs[4];
+
+    if (uBusAddr < uMemSize1)
+    {
+        *pChipAddr = tFwSim.aPartRegs[1] + uBusAddr;
+        return uMemSize1 - uBusAddr;
+    }
+    uBusAddr -= uMemSize1;
+
+    if (uBusAddr < uMemSize2)
+    {
+        *pChipAddr = tFwSim.aPartRegs[3] + uBusAddr;
+        return uMemSize2 - uBusAddr;
+    }
+    uBusAddr -= uMemSize2;
+
+    if (uBusAddr < uMemSize3)
+    {
+        *pChipAddr = tFwSim.aPartRegs[5] + uBusAddr;
+        return uMemSize3 - uBusAddr;
+    }
+    uBusAddr -= uMemSize3;
+
+    /* The fourth region extends up to the partition registers */
+    *pChipAddr = tFwSim.aPartRegs[6] + uBusAddr;
+    return FW_SIM_PART_REGS_ADDR - (uMemSize1 + uMemSize2 + uMemSize3 + uBusAddr);
+}
+
+
+/* Get the backing store of a chip address range (NULL if not backed) */
+static TI_UINT8 *fwSim_ChipPtr (TI_UINT32 uChipAddr, TI_UINT32 uLen)
+{
+    if ((uChipAddr >= FW_SIM_MEM_ADDR) && (uChipAddr + uLen <= FW_SIM_MEM_ADDR + FW_SIM_MEM_SIZE))
+    {
+        return &tFwSim.aMem[uChipAddr - FW_SIM_MEM_ADDR];
+    }
+    if ((uChipAddr >= FW_SIM_REG_ADDR) && (uChipAddr + uLen <= FW_SIM_REG_ADDR + FW_SIM_REG_SIZE))
+    {
+        return &tFwSim.aReg[uChipAddr - FW_SIM_REG_ADDR];
+    }
+    return NULL;
+}
+
+
+static void fwSim_ChipWrite (TI_UINT32 uChipAddr, TI_UINT8 *pBuf, TI_UINT32 uLen)
+{
+    TI_UINT8  *pMem;
+    TI_UINT32  uHostCntrAddr = FW_SIM_TX_RESULT_ADDR + TI_FIELD_OFFSET(TxResultControl_t, TxResultHostCounter);
+
+    switch (uChipAddr)
+    {
+    case SLV_MEM_DATA:
+        fwSim_TxFifoWrite (pBuf, uLen);
+        return;
+
+    case ACX_REG_INTERRUPT_TRIG:
+        if (ENDIAN_HANDLE_LONG(*(TI_UINT32 *)pBuf) & INTR_TRIG_CMD)
+        {
+            fwSim_CmdReceived ();
+            fwSim_RaiseIntr (ACX_INTR_CMD_COMPLETE);
+        }
+        return;
+
+    case ACX_REG_INTERRUPT_MASK:
+        tFwSim.uIntrMask = ENDIAN_HANDLE_LONG(*(TI_UINT32 *)pBuf);
+        fwSim_UpdateIrq ();
+        return;
+
+    default:
+        break;
+    }
+
+    pMem = fwSim_ChipPtr (uChipAddr, uLen);
+    if (pMem == NULL)
+    {
+        tFwSim.tStats.uErrors++;
+        return;
+    }
+    memcpy (pMem, pBuf, uLen);
+
+    /* The host read new Tx-Results, so post held ones if any */
+    if ((uChipAddr <= uHostCntrAddr) && (uChipAddr + uLen > uHostCntrAddr))
+    {
+        if (fwSim_PostTxResults () > 0)
+        {
+            fwSim_UpdateStatus ();
+            fwSim_RaiseIntr (ACX_INTR_DATA);
+        }
+    }
+}
+
+
+static void fwSim_ChipRead (TI_UINT32 uChipAddr, TI_UINT8 *pBuf, TI_UINT32 uLen)
+{
+    TI_UINT8 *pMem;
+
+    switch (uChipAddr)
+    {
+    case SLV_MEM_DATA:
+        fwSim_RxFifoRead (pBuf, uLen);
+        return;
+
+    case ACX_REG_INTERRUPT_CLEAR:
+        /* Clear on read (read only as part of the FwStatus) */
+        *(TI_UINT32 *)pBuf = ENDIAN_HANDLE_LONG(tFwSim.uIntrPending);
+        tFwSim.uIntrPending = 0;
+        tFwSim.tStats.uFwStatusReads++;
+        return;
+
+    case ACX_REG_INTERRUPT_NO_CLEAR:
+        *(TI_UINT32 *)pBuf = ENDIAN_HANDLE_LONG(tFwSim.uIntrPending);
+        return;
+
+    case FW_SIM_FW_STATUS_ADDR:
+        ((FwStatus_t *)(fwSim_ChipPtr (FW_SIM_FW_STATUS_ADDR, 0) - REGISTER_SIZE))->fwLocalTime = 
+            ENDIAN_HANDLE_LONG(fwSim_TimeUs ());
+        break;
+
+    default:
+        break;
+    }
+
+    pMem = fwSim_ChipPtr (uChipAddr, uLen);
+    if (pMem == NULL)
+    {
+        tFwSim.tStats.uErrors++;
+        memset (pBuf, 0, uLen);
+        return;
+    }
+    memcpy (pBuf, pMem, uLen);
+}
+
+
+/* Parse the Tx FIFO stream: each packet starts with its TxIfDescriptor_t holding its length in words */
+static void fwSim_TxFifoWrite (TI_UINT8 *pBuf, TI_UINT32 uLen)
+{
+    TxIfDescriptor_t *pDesc = (TxIfDescriptor_t *)tFwSim.aTxHdr;
+    TI_UINT32         uCopy;
+
+    tFwSim.tStats.uTxXfers++;
+
+    while (uLen > 0)
+    {
+        /* Collect the descriptor */
+        if (tFwSim.uTxHdrLen < sizeof(TxIfDescriptor_t))
+        {
+            uCopy = sizeof(TxIfDescriptor_t) - tFwSim.uTxHdrLen;
+            if (uCopy > uLen)
+            {
+                uCopy = uLen;
+            }
+            memcpy (&tFwSim.aTxHdr[tFwSim.uTxHdrLen], pBuf, uCopy);
+            tFwSim.uTxHdrLen += uCopy;
+            pBuf += uCopy;
+            uLen -= uCopy;
+
+            if (tFwSim.uTxHdrLen < sizeof(TxIfDescriptor_t))
+            {
+                return;
+            }
+
+            if ((TI_UINT32)(ENDIAN_HANDLE_WORD(pDesc->length) << 2) < sizeof(TxIfDescriptor_t))
+            {
+                /* Malformed descriptor - resync on next write */
+                tFwSim.tStats.uErrors++;
+                tFwSim.uTxHdrLen = 0;
+                return;
+            }
+            tFwSim.uTxPktRemain = (ENDIAN_HANDLE_WORD(pDesc->length) << 2) - sizeof(TxIfDescriptor_t);
+        }
+
+        /* Skip the packet body */
+        uCopy = (tFwSim.uTxPktRemain < uLen) ? tFwSim.uTxPktRemain : uLen;
+        tFwSim.uTxPktRemain -= uCopy;
+        pBuf += uCopy;
+        uLen -= uCopy;
+
+        if (tFwSim.uTxPktRemain == 0)
+        {
+            fwSim_TxPktReceived (pDesc);
+            tFwSim.uTxHdrLen = 0;
+        }
+    }
+}
+
+
+/* 
+ * Complete the command in the mailbox. The command parameters and success status are already there, 
+ *     except for a multi-IE command, which returns the status of each IE in place of its parameters.
+ */
+static void fwSim_CmdReceived (void)
+{
+    Command_t        *pCmd = (Command_t *)fwSim_ChipPtr (FW_SIM_CMD_MBOX_ADDR, sizeof(Command_t));
+    ConfigureMulti_t *pMultiHdr = (ConfigureMulti_t *)pCmd->parameters;
+    TI_UINT16        *pIeStatus = (TI_UINT16 *)pCmd->parameters;
+    TI_UINT32         uNumIes, uOffset, uIeLen, i;
+    TI_UINT16         aStatus[FW_SIM_CMD_MAX_IES];
+    CommandStatus_e   eCmdStatus = CMD_STATUS_SUCCESS;
+
+    tFwSim.tStats.uCmds++;
+
+    if (ENDIAN_HANDLE_WORD(pCmd->cmdID) != CMD_CONFIGURE_MULTI)
+    {
+        return;
+    }
+
+    /* Parse all IEs before writing their status over them */
+    uNumIes = ENDIAN_HANDLE_WORD(pMultiHdr->numOfIEs);
+    uOffset = sizeof(ConfigureMulti_t);
+    for (i = 0; i < uNumIes && i < FW_SIM_CMD_MAX_IES; i++)
+    {
+        EleHdrStruct *pIe = (EleHdrStruct *)(pCmd->parameters + uOffset);
+
+        aStatus[i] = CMD_STATUS_SUCCESS;
+        if (uOffset + sizeof(EleHdrStruct) > MAX_CMD_PARAMS)
+        {
+            aStatus[i] = CMD_STATUS_INVALID_PARAM;
+        }
+        else
+        {
+            uIeLen = (sizeof(EleHdrStruct) + ENDIAN_HANDLE_WORD(pIe->len) + 3) & ~3;
+            if (uOffset + uIeLen > MAX_CMD_PARAMS)
+            {
+                aStatus[i] = CMD_STATUS_INVALID_PARAM;
+            }
+            uOffset += uIeLen;
+        }
+
+        if ((aStatus[i] != CMD_STATUS_SUCCESS) && (eCmdStatus == CMD_STATUS_SUCCESS))
+        {
+            eCmdStatus = aStatus[i];
+            tFwSim.tStats.uErrors++;
+        }
+    }
+
+    if ((uNumIes == 0) || (uNumIes > FW_SIM_CMD_MAX_IES))
+    {
+        pCmd->cmdStatus = ENDIAN_HANDLE_WORD(CMD_STATUS_INVALID_PARAM);
+        tFwSim.tStats.uErrors++;
+        return;
+    }
+
+    for (i = 0; i < uNumIes; i++)
+    {
+        pIeStatus[i] = ENDIAN_HANDLE_WORD(aStatus[i]);
+    }
+    pCmd->cmdStatus = ENDIAN_HANDLE_WORD(eCmdStatus);
+
+    tFwSim.tStats.uCmdsMultiIe++;
+    tFwSim.tStats.uCmdIes += uNumIes;
+}
+
+
+/* Hold a new Tx packet in the FW until it is transmitted */
+static void fwSim_TxPktReceived (TxIfDescriptor_t *pDesc)
+{
+    TFwSimTxPkt *pPkt;
+
+    tFwSim.tStats.uTxPkts++;
+    tFwSim.tStats.uTxBytes += ENDIAN_HANDLE_WORD(pDesc->length) << 2;
+
+    if ((tFwSim.uTxPktsIn - tFwSim.uTxPktsPosted >= FW_SIM_TX_PEND_SIZE) ||
+        (pDesc->tid >= MAX_NUM_OF_802_1d_TAGS))
+    {
+        tFwSim.tStats.uErrors++;
+        return;
+    }
+
+    pPkt = &tFwSim.aTxPkts[tFwSim.uTxPktsIn % FW_SIM_TX_PEND_SIZE];
+    pPkt->uDescId   = pDesc->descID;
+    pPkt->uAc       = aTidToAc[pDesc->tid];
+    pPkt->uMemBlks  = pDesc->totalMemBlks;
+    pPkt->uXferTime = fwSim_TimeUs ();
+    tFwSim.uTxPktsIn++;
+
+    /* The host must not use more blocks than the FW provided */
+    tFwSim.uTxBlksUsed += pPkt->uMemBlks;
+    if (tFwSim.uTxBlksUsed > tFwSim.tCfg.uNumTxBlocks)
+    {
+        tFwSim.tStats.uErrors++;
+    }
+
+    if (tFwSim.tCfg.bTxCmpltImmediate)
+    {
+        fwSim_TxComplete (1);
+    }
+}
+
+
+/* Post Tx-Results of transmitted packets while the results queue isn't full. Return number posted. */
+static TI_UINT32 fwSim_PostTxResults (void)
+{
+    TxResultInterface_t *pResIf = (TxResultInterface_t *)fwSim_ChipPtr (FW_SIM_TX_RESULT_ADDR, sizeof(TxResultInterface_t));
+    TI_UINT32            uHostCntr = ENDIAN_HANDLE_LONG(pResIf->TxResultControl.TxResultHostCounter);
+    TI_UINT32            uFwCntr   = ENDIAN_HANDLE_LONG(pResIf->TxResultControl.TxResultFwCounter);
+    TI_UINT32            uTime     = fwSim_TimeUs ();
+    TI_UINT32            uNumPosted = 0;
+
+    while (tFwSim.uTxPktsPosted != tFwSim.uTxPktsDone)
+    {
+        TFwSimTxPkt          *pPkt = &tFwSim.aTxPkts[tFwSim.uTxPktsPosted % FW_SIM_TX_PEND_SIZE];
+        TxResultDescriptor_t *pRes;
+
+        if (uFwCntr - uHostCntr >= TRQ_DEPTH)
+        {
+            tFwSim.tStats.uTxResultsHeld++;
+            break;
+        }
+
+        pRes = &pResIf->TxResultQueue[uFwCntr % TRQ_DEPTH];
+        memset (pRes, 0, sizeof(*pRes));
+        pRes->descID      = pPkt->uDescId;
+        pRes->status      = TX_SUCCESS;
+        pRes->totalDelay  = ENDIAN_HANDLE_LONG(uTime - pPkt->uXferTime);
+        pRes->rate        = FW_SIM_RX_RATE;
+
+        uFwCntr++;
+        uNumPosted++;
+        tFwSim.uTxPktsPosted++;
+        tFwSim.tStats.uTxResults++;
+    }
+
+    pResIf->TxResultControl.TxResultFwCounter = ENDIAN_HANDLE_LONG(uFwCntr);
+
+    return uNumPosted;
+}
+
+
+/* Pop data from the Rx FIFO and release the packets fully read */
+static void fwSim_RxFifoRead (TI_UINT8 *pBuf, TI_UINT32 uLen)
+{
+    TI_UINT32 i;
+
+    tFwSim.tStats.uRxXfers++;
+
+    if (uLen > tFwSim.uRxFifoIn - tFwSim.uRxFifoOut)
+    {
+        /* Host reads more than indicated */
+        tFwSim.tStats.uErrors++;
+        memset (pBuf, 0, uLen);
+        uLen = tFwSim.uRxFifoIn - tFwSim.uRxFifoOut;
+    }
+
+    for (i = 0; i < uLen; i++)
+    {
+        pBuf[i] = tFwSim.aRxFifo[(tFwSim.uRxFifoOut + i) & FW_SIM_RX_FIFO_MASK];
+    }
+    tFwSim.uRxFifoOut += uLen;
+    tFwSim.tStats.uRxBytes += uLen;
+
+    while ((tFwSim.uRxPktsOut != tFwSim.uRxPktsIn) && 
+           ((TI_INT32)(tFwSim.uRxFifoOut - tFwSim.aRxPktEnd[tFwSim.uRxPktsOut % NUM_RX_PKT_DESC]) >= 0))
+    {
+        tFwSim.uRxPktsOut++;
+    }
+}
+
+
+/* Update the FwStatus counters in FW memory */
+static void fwSim_UpdateStatus (void)
+{
+    FwStatus_t    *pStatus = (FwStatus_t *)(fwSim_ChipPtr (FW_SIM_FW_STATUS_ADDR, 0) - REGISTER_SIZE);
+    TxResultInterface_t *pResIf = (TxResultInterface_t *)fwSim_ChipPtr (FW_SIM_TX_RESULT_ADDR, sizeof(TxResultInterface_t));
+    FwStatCntrs_t  tCntrs;
+    TI_UINT32      i;
+
+    tCntrs.fwRxCntr      = (TI_UINT8)tFwSim.uRxPktsIn;
+    tCntrs.drvRxCntr     = (TI_UINT8)tFwSim.uRxPktsOut;
+    tCntrs.reserved      = 0;
+    tCntrs.txResultsCntr = (TI_UINT8)ENDIAN_HANDLE_LONG(pResIf->TxResultControl.TxResultFwCounter);
+    pStatus->counters    = ENDIAN_HANDLE_LONG(*(TI_UINT32 *)&tCntrs);
+
+    for (i = 0; i < NUM_TX_QUEUES; i++)
+    {
+        pStatus->txReleasedBlks[i] = ENDIAN_HANDLE_LONG(tFwSim.aTxReleasedBlks[i]);
+    }
+    pStatus->txTotal = (TI_UINT8)tFwSim.tCfg.uNumTxBlocks;
+}
+
+
+static void fwSim_RaiseIntr (TI_UINT32 uIntr)
+{
+    tFwSim.uIntrPending |= uIntr;
+    fwSim_UpdateIrq ();
+}
+
+
+/* Signal the host if the level interrupt line is asserted and the host IRQ is enabled */
+static void fwSim_UpdateIrq (void)
+{
+    if (tFwSim.bIrqEnabled && (tFwSim.uIntrPending & ~tFwSim.uIntrMask) && tFwSim.fIrqCb)
+    {
+        tFwSim.bIrqEnabled = TI_FALSE;
+        tFwSim.tStats.uInterrupts++;
+        tFwSim.fIrqCb (tFwSim.hIrqCbHndl);
+    }
+}
+
+
+static TI_UINT32 fwSim_TimeUs (void)
+{
+    struct timespec tTime;
+
+    clock_gettime (CLOCK_MONOTONIC, &tTime);
+    return (TI_UINT32)(tTime.tv_sec * 1000000 + tTime.tv_nsec / 1000);
+}
@@ -0,0 +1,110 @@
+/*
+ * FwSim.h
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file   FwSim.h 
+ *  \brief  Firmware stand-in API definition (host simulation only)
+ *
+ *  \see    FwSim.c, SimBusDrv.c
+ */
+
+#ifndef __FW_SIM_API_H__
+#define __FW_SIM_API_H__
+
+
+#include "tidef.h"
+#include "TWDriver.h"
+
+
+/************************************************************************
+ * Defines
+ ************************************************************************/
+#define FW_SIM_DEF_NUM_TX_BLOCKS    200     /* Tx memory blocks reported to the host (must fit in FwStatus txTotal) */
+#define FW_SIM_DEF_RX_PENDING_MAX   (NUM_RX_PKT_DESC - 1) /* Rx packets the FW may hold before the host reads them */
+
+
+/************************************************************************
+ * Types
+ ************************************************************************/
+/* The interrupt line callback (replaces the platform IRQ handler) */
+typedef void (*TFwSimIrqCb)(TI_HANDLE hCbHndl);
+
+/* The firmware stand-in configuration */
+typedef struct
+{
+    TI_UINT32       uNumTxBlocks;       /* Number of Tx memory blocks owned by the host */
+    TI_UINT32       uRxPendingMax;      /* Max Rx packets indicated in FwStatus and not yet read by the host */
+    TI_BOOL         bTxCmpltImmediate;  /* If TRUE, Tx-complete is issued as soon as a packet is written,
+                                           otherwise only upon fwSim_TxComplete() */
+} TFwSimCfg;
+
+/* The firmware stand-in statistics */
+typedef struct
+{
+    TI_UINT32       uTxPkts;            /* Tx packets parsed from the Tx FIFO */
+    TI_UINT32       uTxBytes;           /* Tx bytes (including descriptors and padding) */
+    TI_UINT32       uTxXfers;           /* Bus writes to the Tx FIFO (one per aggregation) */
+    TI_UINT32       uTxResults;         /* Tx results posted to the Tx-Result queue */
+    TI_UINT32       uTxResultsHeld;     /* Tx results delayed due to a full Tx-Result queue */
+    TI_UINT32       uRxPkts;            /* Rx packets injected */
+    TI_UINT32       uRxBytes;           /* Rx bytes read by the host */
+    TI_UINT32       uRxXfers;           /* Bus reads from the Rx FIFO (one per aggregation) */
+    TI_UINT32       uRxRejected;        /* Rx injections refused since the Rx descriptors ring was full */
+    TI_UINT32       uFwStatusReads;     /* FW status reads (one per handled interrupt) */
+    TI_UINT32       uInterrupts;        /* Interrupts signaled to the host */
+    TI_UINT32       uCmds;              /* Commands completed through the command mailbox */
+    TI_UINT32       uCmdsMultiIe;       /* Multi-IE commands (CMD_CONFIGURE_MULTI) among them */
+    TI_UINT32       uCmdIes;            /* Information elements configured by the multi-IE commands */
+    TI_UINT32       uElpWakeups;        /* ELP wakeup requests from the host */
+    TI_UINT32       uErrors;            /* Malformed host accesses (see FwSim.c) */
+} TFwSimStats;
+
+
+/************************************************************************
+ * Functions
+ ************************************************************************/
+void        fwSim_Init              (TFwSimCfg *pCfg, TFwSimIrqCb fIrqCb, TI_HANDLE hIrqCbHndl);
+void        fwSim_GetDmaParams      (TDmaParams *pDmaParams);
+void        fwSim_Write             (TI_UINT32 uBusAddr, TI_UINT8 *pBuf, TI_UINT32 uLen, TI_BOOL bFixedAddr);
+void        fwSim_Read              (TI_UINT32 uBusAddr, TI_UINT8 *pBuf, TI_UINT32 uLen, TI_BOOL bFixedAddr);
+void        fwSim_InterruptServiced (void);
+TI_STATUS   fwSim_InjectRxPacket    (TI_UINT8 *pFrame, TI_UINT32 uLen, PacketClassTag_e eClassTag);
+TI_UINT32   fwSim_TxComplete        (TI_UINT32 uMaxPkts);
+void        fwSim_GetStats          (TFwSimStats *pStats);
+
+/* The simulated bus driver (see SimBusDrv.c) */
+TI_STATUS   busDrv_SimSetQueueDepth (TI_UINT32 uQueueDepth);
+TI_UINT32   busDrv_SimCompleteTxns  (void);
+
+
+#endif /*__FW_SIM_API_H__*/
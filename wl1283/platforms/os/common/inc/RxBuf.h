@@ -50,6 +50,13 @@
 #define WSPI_PAD_BYTES          	16     /* Add padding before data buffer for WSPI overhead */
 #define PAYLOAD_ALIGN_PAD_BYTES   	4      /* Add an extra word for alignment the MAC payload in case of QoS MSDU */
 
+/* Rx buffers pool size classes (the max requested length served by each class) */
+#define RX_BUF_POOL_NUM_CLASSES     3
+#define RX_BUF_POOL_SMALL_LEN       512    /* Control, ACKs and short data packets */
+#define RX_BUF_POOL_MEDIUM_LEN      1664   /* Full size MSDUs */
+#define RX_BUF_POOL_LARGE_LEN       4096   /* A-MSDUs */
+#define RX_BUF_POOL_NO_CLASS        0xFF   /* Buffer not owned by the pool (larger than all classes) */
+
 
 
 /**
@@ -77,12 +84,13 @@ typedef void BUF, *PBUF;
  * \def RX_ETH_PKT_DATA
  * \brief Macro which gets a pointer to BUF packet header and returns the pointer to the start address of the ETH packet's data
  */
-#define RX_ETH_PKT_DATA(pBuf)   *((void **)(((TI_UINT32)pBuf + sizeof(RxIfDescriptor_t) + 2) & ~3))
+#define RX_ETH_PKT_DATA(pBuf)   *((void **)(((uintptr_t)pBuf + sizeof(RxIfDescriptor_t) + 2) & ~3))
 /**
  * \def RX_ETH_PKT_LEN
  * \brief Macro which gets a pointer to BUF packet header and returns the buffer length (without Rx Descriptor) of the ETH packet
+ * \note  Placed right after the RX_ETH_PKT_DATA pointer, so it doesn't overlap it on 64 bit hosts
  */
-#define RX_ETH_PKT_LEN(pBuf)    *((TI_UINT32 *)(((TI_UINT32)pBuf + sizeof(RxIfDescriptor_t) + 6) & ~3))
+#define RX_ETH_PKT_LEN(pBuf)    *((TI_UINT32 *)(((uintptr_t)pBuf + sizeof(RxIfDescriptor_t) + 2 + sizeof(void *)) & ~3))
 
 
 /** \brief BUF Allocation
@@ -127,5 +135,93 @@ void  RxBufFree          (TI_HANDLE hOs, void* pBuf);
  */ 
 void  RxBufReserve       (TI_HANDLE hOs, void* pBuf, TI_UINT32 len); 
 
+
+/** \brief BUF Attach Reference
+ * 
+ * \param  hOs		- OS module object handle
+ * \param  pBuf		- Pointer to BUF which was previously allocated by RxBufAlloc
+ * \param  pParentBuf	- Pointer to the BUF whose memory is referenced by pBuf
+ * \return TI_OK on success, TI_NOK if the reference could not be allocated
+ * 
+ * \par Description
+ * Make pBuf hold a reference to the parent BUF memory, so its ETH packet (RX_ETH_PKT_DATA) 
+ *     may point into the parent data instead of being copied to pBuf.
+ * The parent memory is freed only after the parent and all referencing BUFs are freed 
+ *     or consumed by the network stack. Used for zero-copy A-MSDU de-aggregation.
+ * 
+ * \sa
+ */ 
+TI_STATUS RxBufAttachRef    (TI_HANDLE hOs, void* pBuf, void* pParentBuf);
+
+
+/** \brief Rx Buffers Pool Create
+ * 
+ * \param  hOs		- OS module object handle
+ * \param  aNumBufs	- Number of buffers to keep in each size class free list (0 disables the class)
+ * \return TI_OK on success, TI_NOK if the pool could not be allocated
+ * 
+ * \par Description
+ * Create the driver-owned Rx buffers pool and prefill its free lists.
+ * Once created, RxBufAlloc draws buffers from the pool, and RxBufFree returns 
+ *     unconsumed buffers to it instead of freeing them.
+ * 
+ * \sa
+ */ 
+TI_STATUS RxBufPoolCreate   (TI_HANDLE hOs, TI_UINT32 aNumBufs[RX_BUF_POOL_NUM_CLASSES]);
+
+
+/** \brief Rx Buffers Pool Destroy
+ * 
+ * \param  hOs		- OS module object handle
+ * \return void
+ * 
+ * \par Description
+ * Free all pooled buffers and the pool object. 
+ * Buffers still held by the driver are freed normally when released.
+ * 
+ * \sa
+ */ 
+void  RxBufPoolDestroy      (TI_HANDLE hOs);
+
+
+/** \brief Rx Buffers Pool Refill
+ * 
+ * \param  hOs		- OS module object handle
+ * \return void
+ * 
+ * \par Description
+ * Allocate buffers until each size class free list reaches its configured size.
+ * Called from the driver task, so the Rx path itself only allocates on pool misses.
+ * 
+ * \sa
+ */ 
+void  RxBufPoolRefill       (TI_HANDLE hOs);
+
+
+/** \brief Rx Buffers Pool Is Low
+ * 
+ * \param  hOs		- OS module object handle
+ * \return TI_TRUE if any size class free list is below half of its configured size
+ * 
+ * \par Description
+ * Used by the Rx path to decide when to schedule a pool refill.
+ * 
+ * \sa
+ */ 
+TI_BOOL RxBufPoolIsLow      (TI_HANDLE hOs);
+
+
+/** \brief Rx Buffers Pool Print Statistics
+ * 
+ * \param  hOs		- OS module object handle
+ * \return void
+ * 
+ * \par Description
+ * Print the pool hit, miss, refill and recycle counters of each size class.
+ * 
+ * \sa
+ */ 
+void  RxBufPoolPrintStats   (TI_HANDLE hOs);
+
 #endif
 
@@ -0,0 +1,134 @@
+/*
+ * osTraceRing.h
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+/** \file  osTraceRing.h 
+ * \brief Binary trace ring layout	\n
+ * The driver traces (os_Trace) are written as fixed size records into one ring per CPU.
+ * All rings are in one buffer, which is mapped to user space through the trace ring device,
+ *   so a user space reader can consume the records without any IPC or copy by the driver.
+ * The record holds only the file ID, line and parameters. The reader decodes the file name
+ *   by the same file ID table used for the report module table (see report.h).
+ */
+
+#ifndef __OS_TRACE_RING_H__
+#define __OS_TRACE_RING_H__
+
+#include <stdarg.h>
+#include "tidef.h"
+
+#define TRACE_RING_DEV_NAME         "tiwlan_trace"
+#define TRACE_RING_DEV_PATH         "/dev/" TRACE_RING_DEV_NAME
+
+#define TRACE_RING_MAGIC            0x54524e47  /* "TRNG" */
+#define TRACE_RING_VERSION          2
+
+#define TRACE_RING_RECS             1024        /* Records per CPU ring, must be a power of 2 */
+#define TRACE_RING_MAX_PARAMS       11          /* Parameters kept per record (the rest are truncated) */
+#define TRACE_RING_CACHE_LINE       64
+
+
+/** \struct TTraceRingRec
+ * \brief Trace record (fixed size, 64 bytes)
+ * 
+ * \par Description
+ * The writer fills the record and then sets uSeq to the record's ring index + 1,
+ *   so the reader knows the record is complete (a reserved record may be written out of order
+ *   if a trace interrupts another trace on the same CPU).
+ */ 
+typedef struct 
+{
+    TI_UINT32   uSeq;                               /**< Ring index + 1, written last */
+    TI_UINT16   uFileId;                            /**< Source file ID (__FILE_ID__) */
+    TI_UINT16   uLineNum;                           /**< Source line number */
+    TI_UINT64   uTimeStamp;                         /**< Time stamp in usec (64 bit, so it doesn't wrap) */
+    TI_UINT8    uLevel;                             /**< Severity level */
+    TI_UINT8    uParamsNum;                         /**< Number of parameters kept in aParams */
+    TI_UINT8    uParamsTotal;                       /**< Number of parameters passed by the trace */
+    TI_UINT8    uReserved;
+    TI_UINT32   aParams[TRACE_RING_MAX_PARAMS];     /**< The trace parameters */
+} TTraceRingRec;
+
+/** \struct TTraceRingHdr
+ * \brief Per CPU ring header
+ * 
+ * \par Description
+ * The producer line is written only by the driver and the consumer line only by the reader.
+ * A record is dropped (and counted) when the ring is full, so unread records are never overwritten.
+ * The driver addresses the records only by the ring index bits of uHead, and clamps uTail to
+ *   [uHead - uRingRecs, uHead], so a reader that corrupts them can only lose traces.
+ */ 
+typedef struct 
+{
+    /* Producer cache line */
+    TI_UINT32   uHead;                              /**< Next ring index to reserve (free running) */
+    TI_UINT32   uDrops;                             /**< Records dropped because the ring was full */
+    TI_UINT8    aPad0[TRACE_RING_CACHE_LINE - 2 * sizeof(TI_UINT32)];
+    /* Consumer cache line */
+    TI_UINT32   uTail;                              /**< Next ring index to read (free running) */
+    TI_UINT8    aPad1[TRACE_RING_CACHE_LINE - sizeof(TI_UINT32)];
+} TTraceRingHdr;
+
+/** \struct TTraceRingMapHdr
+ * \brief Header of the mapped trace buffer
+ * 
+ * \par Description
+ * Ring i header is at offset (uRingOffset + i * uRingSize), and its records follow it.
+ * The header describes the layout to the reader only. The driver never reads it back,
+ *   since the reader may write the mapped buffer.
+ */ 
+typedef struct 
+{
+    TI_UINT32   uMagic;                             /**< TRACE_RING_MAGIC */
+    TI_UINT32   uVersion;                           /**< TRACE_RING_VERSION */
+    TI_UINT32   uNumRings;                          /**< Number of rings (one per CPU) */
+    TI_UINT32   uRingRecs;                          /**< Records per ring (power of 2) */
+    TI_UINT32   uRecSize;                           /**< sizeof(TTraceRingRec) */
+    TI_UINT32   uRingOffset;                        /**< Offset of the first ring header */
+    TI_UINT32   uRingSize;                          /**< Ring header and records size */
+    TI_UINT32   uTotalSize;                         /**< The whole mapped buffer size */
+    TI_UINT8    aPad[TRACE_RING_CACHE_LINE - 8 * sizeof(TI_UINT32)];
+} TTraceRingMapHdr;
+
+#define TRACE_RING_HDR(pMap, uRing)   \
+    ((TTraceRingHdr *)((TI_UINT8 *)(pMap) + (pMap)->uRingOffset + (uRing) * (pMap)->uRingSize))
+#define TRACE_RING_REC(pRing, uIndex, uRingRecs)  \
+    ((TTraceRingRec *)((TI_UINT8 *)(pRing) + sizeof(TTraceRingHdr)) + ((uIndex) & ((uRingRecs) - 1)))
+
+
+int  osTraceRing_Init (void);
+void osTraceRing_Destroy (void);
+void osTraceRing_Write (TI_UINT32 uLevel, TI_UINT32 uFileId, TI_UINT32 uLineNum, TI_UINT32 uParamsNum, va_list list);
+
+#endif /* __OS_TRACE_RING_H__ */
@@ -140,6 +140,8 @@ NDIS_STRING STRRxInterruptTimeout           = NDIS_STRING_CONST( "RxInterruptTim
 
 NDIS_STRING STRRxAggregationPktsLimit       = NDIS_STRING_CONST( "RxAggregationPktsLimit" );
 NDIS_STRING STRTxAggregationPktsLimit       = NDIS_STRING_CONST( "TxAggregationPktsLimit" );
+NDIS_STRING STRCmdMboxMultiIe               = NDIS_STRING_CONST( "CmdMboxMultiIe" );
+NDIS_STRING STRRecoveryConfigJournal        = NDIS_STRING_CONST( "RecoveryConfigJournal" );
 
 NDIS_STRING STRdot11FragThreshold           = NDIS_STRING_CONST( "dot11FragmentationThreshold" );
 NDIS_STRING STRdot11MaxTxMSDULifetime       = NDIS_STRING_CONST( "dot11MaxTransmitMSDULifetime" );
@@ -206,6 +208,7 @@ NDIS_STRING STRConnSelfTimeout              = NDIS_STRING_CONST( "ConnSelfTimeou
 
 NDIS_STRING STRCreditCalcTimout             = NDIS_STRING_CONST( "CreditCalcTimout" );
 NDIS_STRING STRCreditCalcTimerEnabled       = NDIS_STRING_CONST( "CreditCalcTimerEnabled" );
+NDIS_STRING STRTxLatencyStats               = NDIS_STRING_CONST( "TxLatencyStats" );
 
 NDIS_STRING STRTrafficAdmControlTimeout     = NDIS_STRING_CONST("TrafficAdmControlTimeout");
 NDIS_STRING STRTrafficAdmControlUseFixedMsduSize = NDIS_STRING_CONST("TrafficAdmCtrlUseFixedMsduSize");
@@ -487,6 +490,7 @@ NDIS_STRING STRTrafficIntensityThresLow         = NDIS_STRING_CONST("TrafficInte
 NDIS_STRING STRTrafficIntensityTestInterval     = NDIS_STRING_CONST("TrafficIntensityTestInterval");
 NDIS_STRING STRTrafficIntensityThresholdEnabled = NDIS_STRING_CONST("TrafficIntensityThresholdEnabled");
 NDIS_STRING STRTrafficMonitorMinIntervalPercentage = NDIS_STRING_CONST("TrafficMonitorMinIntervalPercent");
+NDIS_STRING STRTrafficMonitorBatch              = NDIS_STRING_CONST("TrafficMonitorBatch");
 
 /* Packet Burst parameters */
 NDIS_STRING STRQOSPacketBurstEnable             = NDIS_STRING_CONST("QOS_PacketBurstEnable");
@@ -652,6 +656,11 @@ NDIS_STRING STRRxDataFiltersFilter4Pattern      = NDIS_STRING_CONST("RxDataFilte
 
 NDIS_STRING STRReAuthActiveTimeout				= NDIS_STRING_CONST( "ReAuthActiveTimeout" );
 
+NDIS_STRING STRRxBufPoolSmallBufs               = NDIS_STRING_CONST( "RxBufPoolSmallBufs" );
+NDIS_STRING STRRxBufPoolMediumBufs              = NDIS_STRING_CONST( "RxBufPoolMediumBufs" );
+NDIS_STRING STRRxBufPoolLargeBufs               = NDIS_STRING_CONST( "RxBufPoolLargeBufs" );
+NDIS_STRING STRRxAmsduZeroCopy                  = NDIS_STRING_CONST( "RxAmsduZeroCopy" );
+
 /*---------------------------
     Measurement parameters
 -----------------------------*/
@@ -696,6 +705,7 @@ NDIS_STRING STRNumOfNoScanCompleteToRecovery     = NDIS_STRING_CONST( "NumberOfN
 NDIS_STRING STRSplitScanTimeOut                  = NDIS_STRING_CONST( "SplitScanTimeOut" );
 
 NDIS_STRING STRParseWSCInBeacons      = NDIS_STRING_CONST( "ParseWSCInBeacons" );
+NDIS_STRING STRMlmeLightweightParse  = NDIS_STRING_CONST( "MlmeLightweightParse" );
 
 /*-----------------------------------*/
 /*      Current BSS parameters       */
@@ -1657,6 +1667,21 @@ regFillInitTable(
                             sizeof p->twdInitParams.tGeneral.uTxAggregPktsLimit, 
                             (TI_UINT8*)&(p->twdInitParams.tGeneral.uTxAggregPktsLimit));
 
+    /* The Tx scheduler bursts are sized to fill one Tx aggregation */
+    p->txDataInitParams.uTxBurstPktsLimit = p->twdInitParams.tGeneral.uTxAggregPktsLimit;
+
+    regReadIntegerParameter(pAdapter, &STRCmdMboxMultiIe,
+                            TWD_CMD_MBOX_MULTI_IE_DEF, TWD_CMD_MBOX_MULTI_IE_MIN,
+                            TWD_CMD_MBOX_MULTI_IE_MAX,
+                            sizeof p->twdInitParams.tGeneral.bCmdMboxMultiIe, 
+                            (TI_UINT8*)&(p->twdInitParams.tGeneral.bCmdMboxMultiIe));
+
+    regReadIntegerParameter(pAdapter, &STRRecoveryConfigJournal,
+                            TWD_RECOVERY_CONFIG_JOURNAL_DEF, TWD_RECOVERY_CONFIG_JOURNAL_MIN,
+                            TWD_RECOVERY_CONFIG_JOURNAL_MAX,
+                            sizeof p->twdInitParams.tGeneral.bRecoveryConfigJournal, 
+                            (TI_UINT8*)&(p->twdInitParams.tGeneral.bRecoveryConfigJournal));
+
     regReadIntegerParameter(pAdapter, &STRdot11DesiredChannel,
                         SITE_MGR_CHANNEL_DEF, SITE_MGR_CHANNEL_MIN, SITE_MGR_CHANNEL_MAX,
                         sizeof p->siteMgrInitParams.siteMgrDesiredChannel, 
@@ -1876,6 +1901,26 @@ regFillInitTable(
                             sizeof p->rxDataInitParams.reAuthActiveTimeout,
 							(TI_UINT8*)&p->rxDataInitParams.reAuthActiveTimeout);
 
+    regReadIntegerParameter(pAdapter, &STRRxBufPoolSmallBufs,
+                            RX_DATA_BUF_POOL_SMALL_BUFS_DEF, RX_DATA_BUF_POOL_BUFS_MIN, RX_DATA_BUF_POOL_BUFS_MAX,
+                            sizeof p->rxDataInitParams.uRxBufPoolSmallBufs,
+                            (TI_UINT8*)&p->rxDataInitParams.uRxBufPoolSmallBufs);
+
+    regReadIntegerParameter(pAdapter, &STRRxBufPoolMediumBufs,
+                            RX_DATA_BUF_POOL_MEDIUM_BUFS_DEF, RX_DATA_BUF_POOL_BUFS_MIN, RX_DATA_BUF_POOL_BUFS_MAX,
+                            sizeof p->rxDataInitParams.uRxBufPoolMediumBufs,
+                            (TI_UINT8*)&p->rxDataInitParams.uRxBufPoolMediumBufs);
+
+    regReadIntegerParameter(pAdapter, &STRRxBufPoolLargeBufs,
+                            RX_DATA_BUF_POOL_LARGE_BUFS_DEF, RX_DATA_BUF_POOL_BUFS_MIN, RX_DATA_BUF_POOL_BUFS_MAX,
+                            sizeof p->rxDataInitParams.uRxBufPoolLargeBufs,
+                            (TI_UINT8*)&p->rxDataInitParams.uRxBufPoolLargeBufs);
+
+    regReadIntegerParameter(pAdapter, &STRRxAmsduZeroCopy,
+                            RX_DATA_AMSDU_ZERO_COPY_DEF, RX_DATA_AMSDU_ZERO_COPY_MIN, RX_DATA_AMSDU_ZERO_COPY_MAX,
+                            sizeof p->rxDataInitParams.bAmsduZeroCopy,
+                            (TI_UINT8*)&p->rxDataInitParams.bAmsduZeroCopy);
+
     regReadIntegerParameter(pAdapter, &STRCreditCalcTimout,
                             TX_DATA_CREDIT_CALC_TIMOEUT_DEF, TX_DATA_CREDIT_CALC_TIMOEUT_MIN,
                             TX_DATA_CREDIT_CALC_TIMOEUT_MAX,
@@ -1887,6 +1932,11 @@ regFillInitTable(
 							sizeof p->txDataInitParams.bCreditCalcTimerEnabled,
 							(TI_UINT8*)&p->txDataInitParams.bCreditCalcTimerEnabled);
 
+    regReadIntegerParameter(pAdapter, &STRTxLatencyStats,
+                            TX_DATA_LATENCY_STATS_DEF, TX_DATA_LATENCY_STATS_MIN, TX_DATA_LATENCY_STATS_MAX,
+                            sizeof p->txDataInitParams.bTxLatencyStats,
+                            (TI_UINT8*)&p->txDataInitParams.bTxLatencyStats);
+
     regReadIntegerParameter(pAdapter, &STRTrafficAdmControlTimeout,
                     TRAFFIC_ADM_CONTROL_TIMEOUT_DEF, TRAFFIC_ADM_CONTROL_TIMEOUT_MIN,
                     TRAFFIC_ADM_CONTROL_TIMEOUT_MAX,
@@ -3639,6 +3689,13 @@ regReadIntegerParameter(pAdapter, &STRSettings,
                             sizeof p->trafficMonitorMinIntervalPercentage,
                             (TI_UINT8*)&p->trafficMonitorMinIntervalPercentage);
 
+    regReadIntegerParameter(pAdapter, &STRTrafficMonitorBatch,
+                            TRAFFIC_MONITOR_BATCH_DEF,
+                            TRAFFIC_MONITOR_BATCH_MIN,
+                            TRAFFIC_MONITOR_BATCH_MAX,
+                            sizeof p->bTrafficMonitorBatch,
+                            (TI_UINT8*)&p->bTrafficMonitorBatch);
+
     regReadIntegerParameter(pAdapter, &STRWMEEnable,
                             WME_ENABLED_DEF, WME_ENABLED_MIN,
                             WME_ENABLED_MAX,
@@ -4159,6 +4216,14 @@ regReadIntegerParameter(pAdapter, &STRSettings,
                              sizeof p->tMlmeInitParams.parseWSCInBeacons,
                              (TI_UINT8*)&p->tMlmeInitParams.parseWSCInBeacons );
 
+/*----------------------------------
+ MLME
+------------------------------------*/
+    regReadIntegerParameter( pAdapter, &STRMlmeLightweightParse,
+                             MLME_LIGHTWEIGHT_PARSE_DEF, MLME_LIGHTWEIGHT_PARSE_MIN, MLME_LIGHTWEIGHT_PARSE_MAX,
+                             sizeof p->tMlmeInitParams.lightweightParse,
+                             (TI_UINT8*)&p->tMlmeInitParams.lightweightParse );
+
 /*----------------------------------
  Current BSS
 ------------------------------------*/
@@ -45,6 +45,9 @@
 typedef struct _rx_head_
 {
   struct sk_buff *skb;
+  void           *pool;        /* The Rx buffers pool the skb was allocated for (NULL if none) */
+  TI_UINT32       pool_class;  /* The pool size class, or RX_BUF_POOL_NO_CLASS */
+  struct sk_buff *ref_skb;     /* Clone of a parent skb whose data is referenced (see RxBufAttachRef), or NULL */
 } rx_head_t;
 
 #define RX_HEAD_LEN_ALIGNED ((sizeof(rx_head_t) + 0x3) & ~0x3)
@@ -110,6 +110,7 @@ typedef struct
     spinlock_t               lock;      /* The OS spinlock handle. */
     unsigned long            flags;     /* For saving the cpu flags during spinlock */
     TI_HANDLE                hPollTimer;/* Polling timer for working without interrupts (debug) */
+    TI_HANDLE                hRxBufPool;/* Preallocated Rx buffers pool (see RxBuf.c) */
     struct net_device_stats  stats;     /* The driver's statistics for OS reports. */
     struct sock             *wl_sock;   /* The OS socket used for sending it the driver events */
     struct net_device       *netdev;    /* The OS handle for the driver interface. */
@@ -124,6 +125,8 @@ typedef struct
     EExternalParam           eSuspendCmd; /* command to issue upon suspend request */
     EExternalParam           eResumeCmd;  /* command to issue upon resume request */
     TI_BOOL                  bSuspendInProgress; /* true if driver currently suspending/suspended; false if suspend not started or already resumed */
+    TI_HANDLE                hAsyncBatch; /* The async commands batch pending or awaiting its results fetch (see WlanDrvWext.c) */
+    TI_UINT32                uBatchId;    /* The last async commands batch ID */
 } TWlanDrvIfObj, *TWlanDrvIfObjPtr;
 
 
@@ -43,7 +43,16 @@
 #define __OSTITYPE_H__
 
 #ifdef __KERNEL__
+#include <linux/types.h>	/* uintptr_t */
+#include <linux/version.h>
 #include <linux/compiler.h>	/* likely()/unlikely() */
+#if LINUX_VERSION_CODE < KERNEL_VERSION(3,4,0)
+#include <asm/system.h>		/* smp_mb()/smp_rmb()/smp_wmb() */
+#else
+#include <asm/barrier.h>	/* smp_mb()/smp_rmb()/smp_wmb() - asm/system.h was removed in 3.4 */
+#endif
+#else
+#include <stdint.h>			/* uintptr_t */
 #endif
 
 typedef char                TI_CHAR;
@@ -63,6 +72,17 @@ typedef unsigned long long  TI_UINT64;
 
 #define INLINE              inline
 
+/* Memory barriers for data shared between contexts without a lock (e.g. ringQueue.c) */
+#ifdef __KERNEL__
+#define TI_SMP_MB()         smp_mb()
+#define TI_SMP_RMB()        smp_rmb()
+#define TI_SMP_WMB()        smp_wmb()
+#else
+#define TI_SMP_MB()         __sync_synchronize()
+#define TI_SMP_RMB()        __sync_synchronize()
+#define TI_SMP_WMB()        __sync_synchronize()
+#endif
+
 #endif /* __OSTITYPE_H__*/
 
 
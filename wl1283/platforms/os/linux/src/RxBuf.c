@@ -39,14 +39,47 @@
  */
 
 #include "tidef.h"
+#include "osApi.h"
 #include "RxBuf_linux.h"
+#include "WlanDrvIf.h"
 #include <linux/netdevice.h>
+
+
+/* A pool size class: free list of ready skbs (reserved and with their rx_head set) */
+typedef struct
+{
+    struct sk_buff_head tFreeList;
+    TI_UINT32           uMaxLen;     /* The max requested length served by this class */
+    TI_UINT32           uNumBufs;    /* The configured free list size (0 = class disabled) */
+
+    /* Statistics */
+    TI_UINT32           uHits;       /* Allocations served from the free list */
+    TI_UINT32           uMisses;     /* Allocations done in the Rx path since the free list was empty */
+    TI_UINT32           uRefills;    /* Buffers allocated by RxBufPoolRefill */
+    TI_UINT32           uRecycles;   /* Unconsumed buffers returned to the free list */
+    TI_UINT32           uFrees;      /* Unconsumed buffers freed since the free list was full */
+} TRxBufPoolClass;
+
+typedef struct
+{
+    TI_HANDLE           hOs;
+    TRxBufPoolClass     aClass[RX_BUF_POOL_NUM_CLASSES];
+} TRxBufPool;
+
+static const TI_UINT32 aRxBufPoolClassLen[RX_BUF_POOL_NUM_CLASSES] = 
+{
+    RX_BUF_POOL_SMALL_LEN,
+    RX_BUF_POOL_MEDIUM_LEN,
+    RX_BUF_POOL_LARGE_LEN
+};
+
+
 /*--------------------------------------------------------------------------------------*/
 /* 
- * Allocate BUF Rx packets.
- * Add 16 bytes before the data buffer for WSPI overhead!
+ * Allocate an skb with room for len bytes after the WSPI and alignment padding, 
+ *     and save its owner pool and class in its rx_head.
  */
-void* RxBufAlloc(TI_HANDLE hOs, TI_UINT32 len,PacketClassTag_e ePacketClassTag)
+static struct sk_buff *RxBufAllocSkb (TI_UINT32 len, TRxBufPool *pPool, TI_UINT32 uClass)
 {
     rx_head_t      *rx_head;
     TI_UINT32      alloc_len = len + WSPI_PAD_BYTES + PAYLOAD_ALIGN_PAD_BYTES + RX_HEAD_LEN_ALIGNED;
@@ -58,13 +91,71 @@ void* RxBufAlloc(TI_HANDLE hOs, TI_UINT32 len,PacketClassTag_e ePacketClassTag)
     }
 	rx_head  = (rx_head_t *)skb->head;
 
-	rx_head->skb = skb;
+	rx_head->skb        = skb;
+	rx_head->pool       = pPool;
+	rx_head->pool_class = uClass;
+	rx_head->ref_skb    = NULL;
 	skb_reserve(skb, RX_HEAD_LEN_ALIGNED+WSPI_PAD_BYTES);
+
+    return skb;
+}
+
+/* Find the smallest enabled class that serves the requested length */
+static TI_UINT32 RxBufPoolGetClass (TRxBufPool *pPool, TI_UINT32 len)
+{
+    TI_UINT32 uClass;
+
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        if (len <= pPool->aClass[uClass].uMaxLen && pPool->aClass[uClass].uNumBufs > 0)
+        {
+            return uClass;
+        }
+    }
+
+    return RX_BUF_POOL_NO_CLASS;
+}
+
+/*--------------------------------------------------------------------------------------*/
+/* 
+ * Allocate BUF Rx packets.
+ * Add 16 bytes before the data buffer for WSPI overhead!
+ * If the Rx buffers pool is enabled, take a buffer from the matching size class free list, 
+ *     and if empty allocate a class size buffer so it can be recycled later.
+ */
+void* RxBufAlloc(TI_HANDLE hOs, TI_UINT32 len,PacketClassTag_e ePacketClassTag)
+{
+    TWlanDrvIfObj  *drv   = (TWlanDrvIfObj *)hOs;
+    TRxBufPool     *pPool = (TRxBufPool *)drv->hRxBufPool;
+	struct sk_buff *skb;
+
+    if (pPool != NULL)
+    {
+        TI_UINT32 uClass = RxBufPoolGetClass (pPool, len);
+
+        if (uClass != RX_BUF_POOL_NO_CLASS)
+        {
+            TRxBufPoolClass *pClass = &pPool->aClass[uClass];
+
+            skb = skb_dequeue (&pClass->tFreeList);
+            if (skb != NULL)
+            {
+                pClass->uHits++;
+                return skb->data;
+            }
+
+            pClass->uMisses++;
+            skb = RxBufAllocSkb (pClass->uMaxLen, pPool, uClass);
+            return (skb == NULL) ? NULL : skb->data;
+        }
+    }
+
+    skb = RxBufAllocSkb (len, NULL, RX_BUF_POOL_NO_CLASS);
 /*
 	printk("-->> RxBufAlloc(len=%d)  skb=0x%x skb->data=0x%x skb->head=0x%x skb->len=%d\n",
 		   (int)len, (int)skb, (int)skb->data, (int)skb->head, (int)skb->len);
 */
-	return skb->data;
+	return (skb == NULL) ? NULL : skb->data;
     
 }
 
@@ -97,9 +188,192 @@ inline void  RxBufFree(TI_HANDLE hOs, void* pBuf)
 	printk("-->> RxBufFree()  skb=0x%x skb->data=0x%x skb->head=0x%x skb->len=%d\n",
 		   (int)skb, (int)skb->data, (int)skb->head, (int)skb->len);
 */
+    /* Release the reference to the parent skb data */
+    if (rx_head->ref_skb != NULL)
+    {
+        dev_kfree_skb(rx_head->ref_skb);
+        rx_head->ref_skb = NULL;
+    }
+
+    /* 
+     * Buffers that were not consumed by the network stack are returned to their pool 
+     *     class free list if it isn't full (the skb is reset to its state right after allocation).
+     * Buffers of a destroyed pool don't match the current pool and are just freed.
+     */
+    if (rx_head->pool != NULL && rx_head->pool == ((TWlanDrvIfObj *)hOs)->hRxBufPool)
+    {
+        TRxBufPoolClass *pClass = &((TRxBufPool *)rx_head->pool)->aClass[rx_head->pool_class];
+
+        if (!skb_cloned(skb) && !skb_shared(skb) && !skb_is_nonlinear(skb) &&
+            skb_queue_len(&pClass->tFreeList) < pClass->uNumBufs)
+        {
+            skb->data = skb->head;
+            skb_reset_tail_pointer(skb);
+            skb->len = 0;
+            skb_reserve(skb, RX_HEAD_LEN_ALIGNED+WSPI_PAD_BYTES);
+            skb_queue_tail (&pClass->tFreeList, skb);
+            pClass->uRecycles++;
+            return;
+        }
+
+        pClass->uFrees++;
+    }
+
 	dev_kfree_skb(skb);
 }
 
+/*--------------------------------------------------------------------------------------*/
+/* 
+ * Clone the parent skb (sharing its data) and keep the clone in the buffer rx_head.
+ * The clone is passed to the network stack instead of the buffer skb (see os_receivePacket), 
+ *     and the parent data is freed by the kernel after its last clone.
+ */
+TI_STATUS RxBufAttachRef(TI_HANDLE hOs, void* pBuf, void* pParentBuf)
+{
+    unsigned char  *pdata          = (unsigned char *)((TI_UINT32)pBuf & ~(TI_UINT32)0x3);
+	rx_head_t      *rx_head        = (rx_head_t *)(pdata -  WSPI_PAD_BYTES - RX_HEAD_LEN_ALIGNED);
+    unsigned char  *pparent_data   = (unsigned char *)((TI_UINT32)pParentBuf & ~(TI_UINT32)0x3);
+	rx_head_t      *parent_rx_head = (rx_head_t *)(pparent_data -  WSPI_PAD_BYTES - RX_HEAD_LEN_ALIGNED);
+	struct sk_buff *ref_skb        = skb_clone (parent_rx_head->skb, GFP_ATOMIC);
+
+    if (ref_skb == NULL)
+    {
+        printk("RxBufAttachRef(): skb_clone failed\n");
+        return TI_NOK;
+    }
+
+    rx_head->ref_skb = ref_skb;
+
+    return TI_OK;
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+TI_STATUS RxBufPoolCreate(TI_HANDLE hOs, TI_UINT32 aNumBufs[RX_BUF_POOL_NUM_CLASSES])
+{
+    TWlanDrvIfObj  *drv = (TWlanDrvIfObj *)hOs;
+    TRxBufPool     *pPool;
+    TI_UINT32       uClass;
+
+    pPool = (TRxBufPool *)os_memoryAlloc (hOs, sizeof(TRxBufPool));
+    if (pPool == NULL)
+    {
+        printk("RxBufPoolCreate(): pool allocation failed\n");
+        return TI_NOK;
+    }
+    os_memoryZero (hOs, pPool, sizeof(TRxBufPool));
+
+    pPool->hOs = hOs;
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        skb_queue_head_init (&pPool->aClass[uClass].tFreeList);
+        pPool->aClass[uClass].uMaxLen  = aRxBufPoolClassLen[uClass];
+        pPool->aClass[uClass].uNumBufs = aNumBufs[uClass];
+    }
+
+    drv->hRxBufPool = (TI_HANDLE)pPool;
+
+    RxBufPoolRefill (hOs);
+
+    return TI_OK;
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+void RxBufPoolDestroy(TI_HANDLE hOs)
+{
+    TWlanDrvIfObj  *drv   = (TWlanDrvIfObj *)hOs;
+    TRxBufPool     *pPool = (TRxBufPool *)drv->hRxBufPool;
+    TI_UINT32       uClass;
+
+    if (pPool == NULL)
+    {
+        return;
+    }
+
+    drv->hRxBufPool = NULL;
+
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        skb_queue_purge (&pPool->aClass[uClass].tFreeList);
+    }
+
+    os_memoryFree (hOs, pPool, sizeof(TRxBufPool));
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+void RxBufPoolRefill(TI_HANDLE hOs)
+{
+    TRxBufPool     *pPool = (TRxBufPool *)((TWlanDrvIfObj *)hOs)->hRxBufPool;
+	struct sk_buff *skb;
+    TI_UINT32       uClass;
+
+    if (pPool == NULL)
+    {
+        return;
+    }
+
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        TRxBufPoolClass *pClass = &pPool->aClass[uClass];
+
+        while (skb_queue_len(&pClass->tFreeList) < pClass->uNumBufs)
+        {
+            skb = RxBufAllocSkb (pClass->uMaxLen, pPool, uClass);
+            if (skb == NULL)
+            {
+                return;
+            }
+            skb_queue_tail (&pClass->tFreeList, skb);
+            pClass->uRefills++;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------------*/
 
+TI_BOOL RxBufPoolIsLow(TI_HANDLE hOs)
+{
+    TRxBufPool     *pPool = (TRxBufPool *)((TWlanDrvIfObj *)hOs)->hRxBufPool;
+    TI_UINT32       uClass;
 
+    if (pPool == NULL)
+    {
+        return TI_FALSE;
+    }
 
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        if (skb_queue_len(&pPool->aClass[uClass].tFreeList) < (pPool->aClass[uClass].uNumBufs >> 1))
+        {
+            return TI_TRUE;
+        }
+    }
+
+    return TI_FALSE;
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+void RxBufPoolPrintStats(TI_HANDLE hOs)
+{
+    TRxBufPool     *pPool = (TRxBufPool *)((TWlanDrvIfObj *)hOs)->hRxBufPool;
+    TI_UINT32       uClass;
+
+    if (pPool == NULL)
+    {
+        printk("Rx buffers pool disabled\n");
+        return;
+    }
+
+    printk("Rx buffers pool:  MaxLen   Size   Free       Hits     Misses    Refills   Recycles      Frees\n");
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        TRxBufPoolClass *pClass = &pPool->aClass[uClass];
+
+        printk("                  %6d %6d %6d %10d %10d %10d %10d %10d\n",
+               pClass->uMaxLen, pClass->uNumBufs, skb_queue_len(&pClass->tFreeList), pClass->uHits, 
+               pClass->uMisses, pClass->uRefills, pClass->uRecycles, pClass->uFrees);
+    }
+}
@@ -73,6 +73,7 @@
 #include <linux/netdevice.h>
 #include <linux/inetdevice.h>
 #include "pwrState_Types.h"
+#include "osTraceRing.h"
 
 #ifdef TI_DBG
 #include "tracebuf_api.h"
@@ -828,6 +829,8 @@ static int wlanDrvIf_Create (void)
 #ifdef TI_DBG
 	tb_init(TB_OPTION_NONE);
 #endif
+    /* The trace rings are not mandatory, so a failure is only reported */
+    osTraceRing_Init ();
     pDrvStaticHandle = drv;  /* save for module destroy */
     #ifdef TI_MEM_ALLOC_TRACE
       os_printf ("MTT:%s:%d ::kmalloc(%lu, %x) : %lu\n", __FUNCTION__, __LINE__, sizeof(TWlanDrvIfObj), GFP_KERNEL, sizeof(TWlanDrvIfObj));
@@ -946,6 +949,7 @@ drv_create_end_2:
     }
 
 drv_create_end_1:
+    osTraceRing_Destroy ();
 	kfree (drv);
 	printk ("%s: Fail, rc = %d\n", __func__, rc);
 	return rc;
@@ -1003,6 +1007,9 @@ static void wlanDrvIf_Destroy (TWlanDrvIfObj *drv)
         drvMain_Destroy (drv->tCommon.hDrvMain);
     }
 
+    /* Free the async commands batch if its results were not fetched */
+    wlanDrvWext_DestroyBatch (drv);
+
     /* close the ipc_kernel socket*/
     if (drv && drv->wl_sock) 
     {
@@ -1060,6 +1067,7 @@ static void wlanDrvIf_Destroy (TWlanDrvIfObj *drv)
 #ifdef TI_DBG
 	tb_destroy();
 #endif
+    osTraceRing_Destroy ();
     kfree (drv);
 }
 
@@ -41,10 +41,30 @@
 
 extern void regReadLastDbgState(TWlanDrvIfObjPtr pAdapter);
 
+/* Key index of the ini file, built once per load by ini_BuildIndex() */
+typedef struct
+{
+    char        *pKey;          /* Key text inside the ini buffer */
+    char        *pValue;        /* First char after the '=' that follows the key */
+    TI_UINT32   uKeyLen;
+    TI_UINT32   uHash;
+    TI_UINT32   uNext;          /* Next key in the same hash bucket, in file order */
+} TIniKey;
+
+#define INI_KEY_NONE    0xFFFFFFFF
+
 static char *init_file     = NULL;
 static int init_file_length= 0;
 static PNDIS_CONFIGURATION_PARAMETER pNdisParm;
 
+static TIniKey   *ini_keys        = NULL;
+static TI_UINT32 *ini_buckets     = NULL;
+static TI_UINT32  ini_keys_num    = 0;
+static TI_UINT32  ini_buckets_num = 0;
+
+static void ini_BuildIndex (TI_HANDLE hOs);
+static void ini_FreeIndex (TI_HANDLE hOs);
+
 int osInitTable_IniFile (TI_HANDLE hOs, TInitTable *InitTable, char *file_buf, int file_length)
 {
     TI_STATUS eStatus;
@@ -56,6 +76,8 @@ int osInitTable_IniFile (TI_HANDLE hOs, TInitTable *InitTable, char *file_buf, i
     init_file_length  = file_length;
     pNdisParm = &vNdisParm;
     
+    /* Tokenize the file once so every parameter read below is a hash lookup */
+    ini_BuildIndex (hOs);
 
     eStatus =  regFillInitTable (drv, InitTable);
     if(eStatus == TI_OK)
@@ -64,6 +86,8 @@ int osInitTable_IniFile (TI_HANDLE hOs, TInitTable *InitTable, char *file_buf, i
         regReadLastDbgState(drv);
 #endif
     }
+
+    ini_FreeIndex (hOs);
     return eStatus;
 }
 
@@ -119,11 +143,180 @@ char * ltrim(char *s )
     return s;
 }
 
+/*
+ * Key delimiters: a key never contains any of these, and mem_str() cannot match across them.
+ * '#' is handled separately since it starts a remark up to the end of the line.
+ */
+#define INI_IS_DELIM(c)     ((c) == ' ' || (c) == '\t' || (c) == '=' || (c) == '\r' || (c) == '\n' || (c) == '\0')
+
+static TI_UINT32 ini_HashKey (char *key, TI_UINT32 len)
+{
+    TI_UINT32 hash = 2166136261U;   /* FNV-1a, case insensitive like mem_str() */
+    TI_UINT32 i;
+
+    for (i = 0; i < len; i++)
+    {
+        hash = (hash ^ (TI_UINT8)tolower(key[i])) * 16777619U;
+    }
+    return hash;
+}
+
+/*
+ * Walk the file once and record every "key [spaces] =" occurrence outside remarks.
+ * mem_str() also accepts a keyword that is a suffix of a key when the preceding char is not
+ * a letter (e.g. "Ctrl" in "FEM_Ctrl"), so each such suffix is recorded as a key as well.
+ * Keys are recorded in file order. Returns the number of keys, filling pKeys if not NULL.
+ */
+static TI_UINT32 ini_ScanKeys (TIniKey *pKeys)
+{
+    char *p = init_file, *end_buf = init_file + init_file_length;
+    char *key, *key_end, *s;
+    TI_UINT32 num = 0;
+
+    while (p < end_buf)
+    {
+        if (*p == '#')
+        {
+            while (p < end_buf && *p != '\n')
+                p++;
+            continue;
+        }
+        if (INI_IS_DELIM(*p))
+        {
+            p++;
+            continue;
+        }
+
+        key = p;
+        while (p < end_buf && *p != '#' && !INI_IS_DELIM(*p))
+            p++;
+        key_end = p;
+
+        s = key_end;
+        while (s < end_buf && (*s == ' ' || *s == '\t'))
+            s++;
+        if (s >= end_buf || *s != '=')
+            continue;
+
+        for (s = key; s < key_end; s++)
+        {
+            if (s != key && (tolower(*(s-1)) >= 'a') && (tolower(*(s-1)) <= 'z'))
+                continue;
+
+            if (pKeys)
+            {
+                pKeys[num].pKey    = s;
+                pKeys[num].uKeyLen = key_end - s;
+                pKeys[num].uHash   = ini_HashKey (s, key_end - s);
+                pKeys[num].pValue  = ltrim(key_end) + 1;
+            }
+            num++;
+        }
+    }
+    return num;
+}
+
+static void ini_BuildIndex (TI_HANDLE hOs)
+{
+    TI_UINT32 num, i, bucket;
+
+    ini_keys = NULL;
+    ini_buckets = NULL;
+    ini_keys_num = 0;
+    ini_buckets_num = 0;
+
+    if (!init_file || !init_file_length)
+        return;
+
+    num = ini_ScanKeys (NULL);
+    if (!num)
+        return;
+
+    ini_buckets_num = 1;
+    while (ini_buckets_num < num)
+        ini_buckets_num <<= 1;
+
+    ini_keys = os_memoryAlloc (hOs, num * sizeof(TIniKey));
+    ini_buckets = os_memoryAlloc (hOs, ini_buckets_num * sizeof(TI_UINT32));
+    if (!ini_keys || !ini_buckets)
+    {
+        /* Not fatal, NdisReadConfiguration() falls back to searching the file */
+        print_err("ini_BuildIndex(): failed to allocate index for %d keys\n", num);
+        ini_FreeIndex (hOs);
+        return;
+    }
+
+    ini_keys_num = ini_ScanKeys (ini_keys);
+    memset(ini_buckets, 0xFF, ini_buckets_num * sizeof(TI_UINT32));
+
+    /* Link in reverse so each bucket lists its keys in file order - the first occurrence wins */
+    for (i = ini_keys_num; i-- > 0; )
+    {
+        bucket = ini_keys[i].uHash & (ini_buckets_num - 1);
+        ini_keys[i].uNext = ini_buckets[bucket];
+        ini_buckets[bucket] = i;
+    }
+}
+
+static void ini_FreeIndex (TI_HANDLE hOs)
+{
+    if (ini_keys)
+        os_memoryFree (hOs, ini_keys, ini_keys_num * sizeof(TIniKey));
+    if (ini_buckets)
+        os_memoryFree (hOs, ini_buckets, ini_buckets_num * sizeof(TI_UINT32));
+
+    ini_keys = NULL;
+    ini_buckets = NULL;
+    ini_keys_num = 0;
+    ini_buckets_num = 0;
+}
+
+/* Returns the value of the first occurrence of name (right after its '='), or NULL */
+static char *ini_FindKey (char *name)
+{
+    TI_UINT32 len = strlen(name);
+    TI_UINT32 hash = ini_HashKey (name, len);
+    TI_UINT32 i, j;
+
+    for (i = ini_buckets[hash & (ini_buckets_num - 1)]; i != INI_KEY_NONE; i = ini_keys[i].uNext)
+    {
+        if (ini_keys[i].uHash != hash || ini_keys[i].uKeyLen != len)
+            continue;
+
+        for (j = 0; j < len && tolower(ini_keys[i].pKey[j]) == tolower(name[j]); j++) ;
+        if (j == len)
+            return ini_keys[i].pValue;
+    }
+    return NULL;
+}
+
+/* Search the whole file for name, used only when the index could not be allocated */
+static char *ini_SearchKey (char *name)
+{
+    char *s, *buf = init_file, *end_buf = init_file + init_file_length;
+
+    while(buf < end_buf)
+    {
+        buf = ltrim(buf);
+        s = mem_str(buf, name, end_buf);
+        if( !s )
+            break;
+
+        buf = ltrim(s + strlen(name));
+        if( *buf == '=' )
+            return buf + 1;
+
+        /*print_err("\n...init_config err: delim not found (=): ** %s **\n", buf );*/
+        buf = s + 1; /*strlen(name);*/
+    }
+    return NULL;
+}
+
 void NdisReadConfiguration( OUT PNDIS_STATUS  status, OUT PNDIS_CONFIGURATION_PARAMETER  *param_value,
     IN NDIS_HANDLE  config_handle, IN PNDIS_STRING  keyword, IN NDIS_PARAMETER_TYPE  param_type )
 {
     char *name = keyword->Buffer;
-    char *s, *buf = init_file, *end_buf = init_file + init_file_length;
+    char *s, *buf;
     static int count = 0;
 
     *status = NDIS_STATUS_FAILURE;
@@ -140,75 +333,61 @@ void NdisReadConfiguration( OUT PNDIS_STATUS  status, OUT PNDIS_CONFIGURATION_PA
 
     memset(pNdisParm, 0, sizeof(NDIS_CONFIGURATION_PARAMETER));
 
-    while(buf < end_buf)
+    /* buf points right after the '=' of the first "name =" in the file */
+    buf = ini_keys ? ini_FindKey(name) : ini_SearchKey(name);
+    if( !buf )
+        return ;
+
+    buf = ltrim(buf);
+    if( param_type == NdisParameterString )
     {
-        buf = ltrim(buf);
-        s = mem_str(buf, name, end_buf);
-        if( !s )
-            break;
+        char *remark = NULL;
 
-        buf = ltrim(s + strlen(name));
-        if( *buf == '=' )
-            buf++;
-        else {
-            /*print_err("\n...init_config err: delim not found (=): ** %s **\n", buf );*/
-            buf = s + 1; /*strlen(name);*/
-            continue;
-        }
-        buf = ltrim(buf);
-        if( param_type == NdisParameterString )
+        s = strchr(buf, '\n');
+        if( !s )
+            s = buf+strlen(buf);
+        
+        remark = memchr(buf, '#', s - buf);        /* skip remarks */
+        if( remark )
         {
-            char *remark = NULL;
-
-            s = strchr(buf, '\n');
-            if( !s )
-                s = buf+strlen(buf);
+            do {        /* remove whitespace  */
+                remark--;
+            } while( *remark == ' ' || *remark == '\t' );    
             
-            remark = memchr(buf, '#', s - buf);        /* skip remarks */
-            if( remark )
-            {
-                do {        /* remove whitespace  */
-                    remark--;
-                } while( *remark == ' ' || *remark == '\t' );    
-                
-                pNdisParm->ParameterData.StringData.Length = remark - buf + 1;
-            }
-            else
-                pNdisParm->ParameterData.StringData.Length = s - buf;
-                   
-            pNdisParm->ParameterData.StringData.Buffer = (TI_UINT8*)&pNdisParm->StringBuffer[0];
-            pNdisParm->ParameterData.StringData.MaximumLength = NDIS_MAX_STRING_LEN;
-            if( !pNdisParm->ParameterData.StringData.Length > NDIS_MAX_STRING_LEN )
-            {
-                *status = NDIS_STATUS_BUFFER_TOO_SHORT;
-                return;
-            }
-            memcpy(pNdisParm->ParameterData.StringData.Buffer, buf, pNdisParm->ParameterData.StringData.Length);
-            print_info("NdisReadConfiguration(): %s = (%d)'%s'\n", name, pNdisParm->ParameterData.StringData.Length, pNdisParm->ParameterData.StringData.Buffer);
+            pNdisParm->ParameterData.StringData.Length = remark - buf + 1;
         }
-        else if( param_type == NdisParameterInteger )
+        else
+            pNdisParm->ParameterData.StringData.Length = s - buf;
+               
+        pNdisParm->ParameterData.StringData.Buffer = (TI_UINT8*)&pNdisParm->StringBuffer[0];
+        pNdisParm->ParameterData.StringData.MaximumLength = NDIS_MAX_STRING_LEN;
+        if( !pNdisParm->ParameterData.StringData.Length > NDIS_MAX_STRING_LEN )
         {
+            *status = NDIS_STATUS_BUFFER_TOO_SHORT;
+            return;
+        }
+        memcpy(pNdisParm->ParameterData.StringData.Buffer, buf, pNdisParm->ParameterData.StringData.Length);
+        print_info("NdisReadConfiguration(): %s = (%d)'%s'\n", name, pNdisParm->ParameterData.StringData.Length, pNdisParm->ParameterData.StringData.Buffer);
+    }
+    else if( param_type == NdisParameterInteger )
+    {
 	    char *end_p;
-            pNdisParm->ParameterData.IntegerData = simple_strtol(buf, &end_p, 0);
-            if (end_p && *end_p && *end_p!=' ' && *end_p!='\n'
+        pNdisParm->ParameterData.IntegerData = simple_strtol(buf, &end_p, 0);
+        if (end_p && *end_p && *end_p!=' ' && *end_p!='\n'
 		&& *end_p!='\r' && *end_p!='\t')
-            {
-                print_err("\n...init_config: invalid int value for <%s> : %s\n", name, buf );
-                return;
-            }
-            /*print_deb(" NdisReadConfiguration(): buf = %p (%.20s)\n", buf, buf );*/
-            print_info("NdisReadConfiguration(): %s = %d\n", name, (TI_INT32) pNdisParm->ParameterData.IntegerData);
-        }
-        else
         {
-            print_err("NdisReadConfiguration(): unknow parameter type %d for %s\n", param_type, name );
+            print_err("\n...init_config: invalid int value for <%s> : %s\n", name, buf );
             return;
         }
-        *status = NDIS_STATUS_SUCCESS;
+        /*print_deb(" NdisReadConfiguration(): buf = %p (%.20s)\n", buf, buf );*/
+        print_info("NdisReadConfiguration(): %s = %d\n", name, (TI_INT32) pNdisParm->ParameterData.IntegerData);
+    }
+    else
+    {
+        print_err("NdisReadConfiguration(): unknow parameter type %d for %s\n", param_type, name );
         return;
-
     }
-    return ;
+    *status = NDIS_STATUS_SUCCESS;
 }
 
 void NdisWriteConfiguration( OUT PNDIS_STATUS  Status, 
@@ -0,0 +1,259 @@
+/*
+ * osTraceRing.c
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+/*
+ * src/osTraceRing.c
+ *
+ * Per CPU binary trace rings, written by os_Trace without locks and mapped to user space
+ *   through the trace ring misc device (see osTraceRing.h for the layout).
+ */
+
+#include "tidef.h"
+
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/miscdevice.h>
+#include <linux/vmalloc.h>
+#include <linux/smp.h>
+#include <linux/ktime.h>
+#include <stdarg.h>
+#include "osApi.h"
+#include "osTraceRing.h"
+
+
+/* The rings layout is kept by the driver, and not read from the (user writable) mapped header */
+#define TRACE_RING_SIZE             (sizeof(TTraceRingHdr) + TRACE_RING_RECS * sizeof(TTraceRingRec))
+#define TRACE_RING_TOTAL_SIZE       (sizeof(TTraceRingMapHdr) + nr_cpu_ids * TRACE_RING_SIZE)
+#define TRACE_RING_GET_HDR(pMap, uRing)   \
+    ((TTraceRingHdr *)((TI_UINT8 *)(pMap) + sizeof(TTraceRingMapHdr) + (uRing) * TRACE_RING_SIZE))
+
+static TTraceRingMapHdr *pTraceRingMap = NULL;
+
+
+/** 
+ * \fn     osTraceRing_Write
+ * \brief  Write a trace record to the current CPU ring
+ * 
+ * A ring index is reserved by compare-and-exchange on the ring head, so a trace that interrupts
+ *   (or migrates to) a CPU in the middle of another trace is still safe without a lock.
+ * The record is committed by writing its sequence last, after a write barrier.
+ * If the reader did not free room in the ring, the record is dropped and counted.
+ * The reader's tail is read once per attempt and clamped, so a bogus tail only drops traces.
+ * 
+ * \note   May be called from any context
+ * \param  uLevel     - Severity level of the trace message
+ * \param  uFileId    - Source file ID of the trace message
+ * \param  uLineNum   - Line number of the trace message
+ * \param  uParamsNum - Number of parameters in the trace message
+ * \param  list       - The trace message parameters
+ * \return void
+ * \sa     os_Trace
+ */ 
+void osTraceRing_Write (TI_UINT32 uLevel, TI_UINT32 uFileId, TI_UINT32 uLineNum, TI_UINT32 uParamsNum, va_list list)
+{
+    TTraceRingMapHdr *pMap = pTraceRingMap;
+    TTraceRingHdr    *pRing;
+    TTraceRingRec    *pRec;
+    TI_UINT32         uHead;
+    TI_UINT32         uUsed;
+    TI_UINT32         uDrops;
+    TI_UINT32         uKept;
+    TI_UINT32         i;
+
+    if (pMap == NULL)
+    {
+        return;
+    }
+
+    pRing = TRACE_RING_GET_HDR (pMap, raw_smp_processor_id() % nr_cpu_ids);
+
+    /* Reserve a record, or count a drop if the ring is full */
+    do
+    {
+        uHead = *(volatile TI_UINT32 *)&pRing->uHead;
+        uUsed = uHead - *(volatile TI_UINT32 *)&pRing->uTail;
+        if (uUsed > TRACE_RING_RECS)
+        {
+            /* A tail out of [uHead - TRACE_RING_RECS, uHead] is clamped (the ring is taken as full) */
+            uUsed = TRACE_RING_RECS;
+        }
+        if (uUsed == TRACE_RING_RECS)
+        {
+            do
+            {
+                uDrops = *(volatile TI_UINT32 *)&pRing->uDrops;
+            } while (cmpxchg (&pRing->uDrops, uDrops, uDrops + 1) != uDrops);
+            return;
+        }
+    } while (cmpxchg (&pRing->uHead, uHead, uHead + 1) != uHead);
+
+    /* Note: a successful cmpxchg is a full barrier, so the record is written only after uTail was read */
+    uKept = (uParamsNum > TRACE_RING_MAX_PARAMS) ? TRACE_RING_MAX_PARAMS : uParamsNum;
+
+    pRec = TRACE_RING_REC (pRing, uHead, TRACE_RING_RECS);
+    pRec->uTimeStamp   = (TI_UINT64)ktime_to_us (ktime_get());
+    pRec->uFileId      = (TI_UINT16)uFileId;
+    pRec->uLineNum     = (TI_UINT16)uLineNum;
+    pRec->uLevel       = (TI_UINT8)uLevel;
+    pRec->uParamsNum   = (TI_UINT8)uKept;
+    pRec->uParamsTotal = (TI_UINT8)uParamsNum;
+    for (i = 0; i < uKept; i++)
+    {
+        pRec->aParams[i] = va_arg (list, TI_UINT32);
+    }
+
+    /* Commit the record */
+    TI_SMP_WMB();
+    pRec->uSeq = uHead + 1;
+}
+
+
+/** 
+ * \fn     osTraceRing_Mmap
+ * \brief  Map the trace buffer to the reader
+ * 
+ * The whole buffer is mapped (read and write, since the reader updates the rings tail).
+ * 
+ * \note   
+ * \param  pFile - The device file
+ * \param  pVma  - The user virtual memory area
+ * \return 0 - OK, else - failure
+ * \sa     osTraceRing_Init
+ */ 
+static int osTraceRing_Mmap (struct file *pFile, struct vm_area_struct *pVma)
+{
+    if (pTraceRingMap == NULL)
+    {
+        return -ENODEV;
+    }
+    if ((pVma->vm_pgoff != 0) || 
+        ((pVma->vm_end - pVma->vm_start) > PAGE_ALIGN (TRACE_RING_TOTAL_SIZE)))
+    {
+        return -EINVAL;
+    }
+
+    return remap_vmalloc_range (pVma, pTraceRingMap, 0);
+}
+
+static const struct file_operations tTraceRingFops = 
+{
+    .owner = THIS_MODULE,
+    .mmap  = osTraceRing_Mmap,
+};
+
+static struct miscdevice tTraceRingDev = 
+{
+    .minor = MISC_DYNAMIC_MINOR,
+    .name  = TRACE_RING_DEV_NAME,
+    .fops  = &tTraceRingFops,
+};
+
+
+/** 
+ * \fn     osTraceRing_Init
+ * \brief  Allocate the trace rings and register the trace ring device
+ * 
+ * One ring of TRACE_RING_RECS records is allocated per possible CPU, in one buffer
+ *   that can be mapped to user space.
+ * 
+ * \note   A failure only disables the trace rings (the traces are then dropped)
+ * \param  void
+ * \return 0 - OK, else - failure
+ * \sa     osTraceRing_Destroy
+ */ 
+int osTraceRing_Init (void)
+{
+    TI_UINT32 uRingSize  = TRACE_RING_SIZE;
+    TI_UINT32 uNumRings  = nr_cpu_ids;
+    TI_UINT32 uTotalSize = TRACE_RING_TOTAL_SIZE;
+    TTraceRingMapHdr *pMap;
+    int rc;
+
+    /* Zeroed and allowed to be mapped to user space */
+    pMap = vmalloc_user (uTotalSize);
+    if (pMap == NULL)
+    {
+        printk (KERN_ERR "TIWLAN: trace ring allocation of %d bytes failed\n", uTotalSize);
+        return -ENOMEM;
+    }
+
+    pMap->uMagic      = TRACE_RING_MAGIC;
+    pMap->uVersion    = TRACE_RING_VERSION;
+    pMap->uNumRings   = uNumRings;
+    pMap->uRingRecs   = TRACE_RING_RECS;
+    pMap->uRecSize    = sizeof(TTraceRingRec);
+    pMap->uRingOffset = sizeof(TTraceRingMapHdr);
+    pMap->uRingSize   = uRingSize;
+    pMap->uTotalSize  = uTotalSize;
+
+    rc = misc_register (&tTraceRingDev);
+    if (rc != 0)
+    {
+        printk (KERN_ERR "TIWLAN: trace ring device registration failed (%d)\n", rc);
+        vfree (pMap);
+        return rc;
+    }
+
+    TI_SMP_WMB();
+    pTraceRingMap = pMap;
+
+    return 0;
+}
+
+
+/** 
+ * \fn     osTraceRing_Destroy
+ * \brief  Unregister the trace ring device and free the trace rings
+ * 
+ * \note   Called after the driver is stopped, so no more traces are written
+ * \param  void
+ * \return void
+ * \sa     osTraceRing_Init
+ */ 
+void osTraceRing_Destroy (void)
+{
+    TTraceRingMapHdr *pMap = pTraceRingMap;
+
+    if (pMap == NULL)
+    {
+        return;
+    }
+
+    pTraceRingMap = NULL;
+    misc_deregister (&tTraceRingDev);
+    vfree (pMap);
+}
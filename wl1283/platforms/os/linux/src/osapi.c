@@ -66,6 +66,7 @@
 #include "osApi.h"
 #include "txMgmtQueue_Api.h"
 #include "EvHandler.h"
+#include "osTraceRing.h"
 
 #ifdef ESTA_TIMER_DEBUG
 #define esta_timer_log(fmt,args...)  printk(fmt, ## args)
@@ -427,6 +428,60 @@ void os_protectUnlock (TI_HANDLE OsContext, TI_HANDLE ProtectContext)
     
     spin_unlock_irqrestore (&drv->lock, drv->flags);
 }
+
+
+/****************************************************************************************
+ *                        os_atomicSetBits()                                 
+ ****************************************************************************************
+DESCRIPTION:	Set bits in a bitmap word atomically (lock free, using the kernel set_bit).
+
+ARGUMENTS:		OsContext - our adapter context.
+				pBitmap   - the bitmap word.
+				uBits     - the bits to set.
+
+RETURN:			None
+
+NOTES:         	The driver is 32 bit only, so the bitmap word is the native bitops word.
+*****************************************************************************************/
+void os_atomicSetBits (TI_HANDLE OsContext, TI_UINT32 *pBitmap, TI_UINT32 uBits)
+{
+    unsigned long uMap = uBits;
+
+    BUILD_BUG_ON (sizeof(unsigned long) != sizeof(TI_UINT32));
+
+    while (uMap)
+    {
+        set_bit (__ffs (uMap), (volatile unsigned long *)pBitmap);
+        uMap &= uMap - 1;
+    }
+}
+
+
+/****************************************************************************************
+ *                        os_atomicClearBits()                                 
+ ****************************************************************************************
+DESCRIPTION:	Clear bits in a bitmap word atomically (lock free, using the kernel clear_bit).
+
+ARGUMENTS:		OsContext - our adapter context.
+				pBitmap   - the bitmap word.
+				uBits     - the bits to clear.
+
+RETURN:			None
+
+NOTES:         	The driver is 32 bit only, so the bitmap word is the native bitops word.
+*****************************************************************************************/
+void os_atomicClearBits (TI_HANDLE OsContext, TI_UINT32 *pBitmap, TI_UINT32 uBits)
+{
+    unsigned long uMap = uBits;
+
+    BUILD_BUG_ON (sizeof(unsigned long) != sizeof(TI_UINT32));
+
+    while (uMap)
+    {
+        clear_bit (__ffs (uMap), (volatile unsigned long *)pBitmap);
+        uMap &= uMap - 1;
+    }
+}
 /****************************************************************************************
  *                        os_receivePacket()                                 
  ****************************************************************************************
@@ -446,6 +501,9 @@ TI_BOOL os_receivePacket(TI_HANDLE OsContext, void *pRxDesc ,void *pPacket, TI_U
    rx_head_t      *rx_head = (rx_head_t *)(pdata -  WSPI_PAD_BYTES - RX_HEAD_LEN_ALIGNED);
    struct sk_buff *skb     = rx_head->skb;
    RxIfDescriptor_t *pRxInfo = (RxIfDescriptor_t*)pRxDesc;
+   unsigned char  *eth_data = RX_ETH_PKT_DATA(pPacket);
+   TI_UINT32       eth_len  = RX_ETH_PKT_LEN(pPacket);
+   TI_BOOL         end_of_burst = (pRxInfo->driverFlags & DRV_RX_FLAG_END_OF_BURST) ? TI_TRUE : TI_FALSE;
 	
 #ifdef TI_DBG
    if ((TI_UINT32)pPacket & 0x3)
@@ -472,9 +530,20 @@ TI_BOOL os_receivePacket(TI_HANDLE OsContext, void *pRxDesc ,void *pPacket, TI_U
    printk("-->> os_receivePacket() pPacket=0x%x Length=%d skb=0x%x skb->data=0x%x skb->head=0x%x skb->len=%d\n",
 		  (int)pPacket, (int)Length, (int)skb, (int)skb->data, (int)skb->head, (int)skb->len);
 */
-   skb->data = RX_ETH_PKT_DATA(pPacket);
+   /* 
+    * If the ETH packet is in a parent buffer (zero-copy A-MSDU), pass the parent clone to the stack 
+    *     and release this buffer (it only holds the Rx descriptor)
+    */
+   if (rx_head->ref_skb != NULL)
+   {
+       skb = rx_head->ref_skb;
+       rx_head->ref_skb = NULL;
+       RxBufFree (OsContext, pPacket);
+   }
+
+   skb->data = eth_data;
    skb->tail = skb->data;
-   skb_put(skb, RX_ETH_PKT_LEN(pPacket));
+   skb_put(skb, eth_len);
 /*
    printk("-->> os_receivePacket() skb=0x%x skb->data=0x%x skb->head=0x%x skb->len=%d\n",
 		  (int)skb, (int)skb->data, (int)skb->head, (int)skb->len);
@@ -496,7 +565,7 @@ TI_BOOL os_receivePacket(TI_HANDLE OsContext, void *pRxDesc ,void *pPacket, TI_U
        /* Prevent system suspend one more second after WLAN task completion (in case of more Rx packets) */
        os_wake_lock_timeout_enable(drv);
 
-	   if (pRxInfo->driverFlags & DRV_RX_FLAG_END_OF_BURST) 
+	   if (end_of_burst) 
 	   {
 	       netif_rx_ni(skb);
 	   } 
@@ -854,7 +923,11 @@ int os_SignalObjectFree (TI_HANDLE OsContext, void *signalObject)
 
 /** 
  * \fn     os_Trace
- * \brief  Prepare and send trace message to the logger.
+ * \brief  Write the trace message to the trace ring, and send it to the logger if enabled.
+ * 
+ * The trace ring is always written (see osTraceRing.c), and is read through its mapping.
+ * The logger IPC path is used only if the output was redirected to the logger, and not
+ *   when the TRACE macros print the message text (PRINTF_ROLLBACK).
  * 
  * \param  OsContext    - The OS handle
  * \param  uLevel   	- Severity level of the trace message
@@ -876,6 +949,15 @@ void os_Trace (TI_HANDLE OsContext, TI_UINT32 uLevel, TI_UINT32 uFileId, TI_UINT
 	TI_UINT8    *pMsgData = &aMsg[0] + sizeof(TTraceMsg);
 	va_list	    list;
 
+	va_start(list, uParamsNum);
+	osTraceRing_Write (uLevel, uFileId, uLineNum, uParamsNum, list);
+	va_end(list);
+
+#ifdef PRINTF_ROLLBACK
+    /* The message text was already printed by the TRACE macro (see report.h) */
+    return;
+#endif
+
     if (!bRedirectOutputToLogger)
     {
         return;
@@ -0,0 +1,96 @@
+/*
+ * SimOs.h
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+ 
+/** \file   SimOs.h 
+ *  \brief  Host simulation OS layer definitions (see osApi.h for the common OS API)
+ *
+ *  \see    osapi.c, RxBuf.c, SimBench.c
+ */
+
+#ifndef __SIM_OS_H__
+#define __SIM_OS_H__
+
+
+#include "tidef.h"
+#include "osApi.h"
+
+
+/************************************************************************
+ * Defines
+ ************************************************************************/
+#define SIM_OS_MAX_TIMERS       128         /* Max timers created concurrently */
+#define SIM_OS_ARENA_SIZE       0x20000000  /* Bytes of low (32 bit addressable) memory for all allocations */
+
+
+/************************************************************************
+ * Types
+ ************************************************************************/
+/* A host simulation timer */
+typedef struct
+{
+    fTimerFunction  fRoutine;           /* The timer expiry callback */
+    TI_HANDLE       hFuncHandle;        /* The callback handle */
+    TI_BOOL         bActive;            /* TRUE if started and not expired or stopped */
+    TI_UINT32       uExpiryMs;          /* Expiry time (os_timeStampMs) */
+    TI_BOOL         bInUse;             /* TRUE if created and not destroyed */
+} TSimTimer;
+
+/* The host simulation OS object (the OsContext handle of all OS API calls) */
+typedef struct
+{
+    TI_BOOL         bTaskPending;       /* Driver task was requested (by os_RequestSchedule) */
+    TSimTimer       aTimers[SIM_OS_MAX_TIMERS];
+    TI_UINT32       uNumTimers;         /* Timers table high mark */
+    TI_BOOL         bTraceEnable;       /* If TRUE, trace messages are printed */
+    TI_HANDLE       hRxBufPool;         /* Preallocated Rx buffers pool (see RxBuf.c) */
+
+    /* Statistics */
+    TI_UINT32       uRxPkts;            /* Packets passed to the network stack */
+    TI_UINT32       uRxBytes;
+    TI_UINT32       uMemAllocs;         /* Outstanding memory allocations */
+    TI_UINT32       uMemAllocFails;
+    TI_UINT32       uTimerExpiries;
+} TSimOs;
+
+
+/************************************************************************
+ * Functions
+ ************************************************************************/
+TI_HANDLE   simOs_Create        (void);
+void        simOs_RunTimers     (TI_HANDLE hOs);
+TI_BOOL     simOs_TaskPending   (TI_HANDLE hOs);
+void        simOs_RxBufConsume  (TI_HANDLE hOs, void *pBuf);
+
+
+#endif /*__SIM_OS_H__*/
@@ -0,0 +1,150 @@
+/*
+ * SimKernel.h
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file   SimKernel.h 
+ *  \brief  Host simulation of the few kernel services used by the trace rings (osTraceRing.c)
+ *
+ *  The headers under linux/ all include this file, so osTraceRing.c is built
+ *      unmodified for the host simulation (see the sim build Makefile).
+ *  The misc device is only recorded, and its mmap handler is called directly by the benchmark,
+ *      which gets the mapped address in the simulated vm area.
+ *
+ *  \see    SimBench.c
+ */
+
+#ifndef __SIM_KERNEL_H__
+#define __SIM_KERNEL_H__
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+
+
+/************************************************************************
+ * Defines
+ ************************************************************************/
+#define THIS_MODULE                 NULL
+#define KERN_ERR                    ""
+#define printk                      printf
+
+#define PAGE_SIZE                   4096UL
+#define PAGE_ALIGN(uSize)           (((uSize) + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1))
+#define MISC_DYNAMIC_MINOR          255
+
+/* The host simulation runs the driver on one CPU */
+#define nr_cpu_ids                  1
+#define raw_smp_processor_id()      0
+#define cmpxchg(pPtr, uOld, uNew)   __sync_val_compare_and_swap ((pPtr), (uOld), (uNew))
+
+
+/************************************************************************
+ * Types
+ ************************************************************************/
+typedef long long ktime_t;
+
+struct file;
+
+/* The simulated user mapping: remap_vmalloc_range sets pMapped instead of mapping pages */
+struct vm_area_struct
+{
+    unsigned long   vm_start;
+    unsigned long   vm_end;
+    unsigned long   vm_pgoff;
+    void           *pMapped;            /* The mapped buffer address (host simulation only) */
+};
+
+struct file_operations
+{
+    void           *owner;
+    int           (*mmap) (struct file *pFile, struct vm_area_struct *pVma);
+};
+
+struct miscdevice
+{
+    int                             minor;
+    const char                     *name;
+    const struct file_operations   *fops;
+};
+
+
+/************************************************************************
+ * Functions
+ ************************************************************************/
+/* The last registered misc device (see SimStubs.c) */
+extern struct miscdevice *pSimMiscDev;
+
+static inline int misc_register (struct miscdevice *pDev)
+{
+    pSimMiscDev = pDev;
+    return 0;
+}
+
+static inline void misc_deregister (struct miscdevice *pDev)
+{
+    if (pSimMiscDev == pDev)
+    {
+        pSimMiscDev = NULL;
+    }
+}
+
+static inline void *vmalloc_user (unsigned long uSize)
+{
+    return calloc (1, uSize);
+}
+
+static inline void vfree (const void *pAddr)
+{
+    free ((void *)pAddr);
+}
+
+static inline int remap_vmalloc_range (struct vm_area_struct *pVma, void *pAddr, unsigned long uPgOff)
+{
+    pVma->pMapped = (char *)pAddr + uPgOff * PAGE_SIZE;
+    return 0;
+}
+
+static inline ktime_t ktime_get (void)
+{
+    struct timespec tTime;
+
+    clock_gettime (CLOCK_MONOTONIC, &tTime);
+    return (ktime_t)tTime.tv_sec * 1000000000LL + tTime.tv_nsec;
+}
+
+#define ktime_to_us(tTime)          ((tTime) / 1000)
+
+
+#endif /* __SIM_KERNEL_H__ */
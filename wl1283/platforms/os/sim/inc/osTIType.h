@@ -0,0 +1,72 @@
+/*
+ * osTIType.h
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * inc/osTIType.h
+ *
+ * This module contains eSTA-DK types definitions (host simulation build)
+ *
+ */
+
+#ifndef __OSTITYPE_H__
+#define __OSTITYPE_H__
+
+#include <stdint.h>          /* uintptr_t */
+
+typedef char                TI_CHAR;
+typedef signed char         TI_INT8;
+typedef unsigned char       TI_UINT8;
+typedef signed short        TI_INT16;
+typedef unsigned short      TI_UINT16;
+typedef signed int          TI_INT32;
+typedef unsigned int        TI_UINT32;
+typedef signed long long    TI_INT64;
+typedef unsigned long long  TI_UINT64;
+
+/* The FW API types (public_types.h) must keep their 32 bit size also on 64 bit hosts */
+#define uint32              TI_UINT32
+#define int32               TI_INT32
+
+#define TI_CONST64(x)       (x##LL)
+
+#define TI_LIKELY(x)        __builtin_expect(!!(x), 1)
+#define TI_UNLIKELY(x)      __builtin_expect(!!(x), 0)
+
+#define INLINE              inline
+
+/* Memory barriers for data shared between contexts without a lock (e.g. ringQueue.c) */
+#define TI_SMP_MB()         __sync_synchronize()
+#define TI_SMP_RMB()        __sync_synchronize()
+#define TI_SMP_WMB()        __sync_synchronize()
+
+#endif /* __OSTITYPE_H__*/
@@ -0,0 +1,397 @@
+/*
+ * RxBuf.c
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+ 
+/** \file  RxBuf.c
+ *  \brief Host simulation Rx buffers implementation.
+ *
+ *  \see   RxBuf.h
+ */
+
+#include "tidef.h"
+#include "osApi.h"
+#include "RxBuf.h"
+#include "SimOs.h"
+
+
+/* Kept before the WSPI padding of each Rx buffer (as the Linux skb pointer) */
+typedef struct _TSimRxHead
+{
+    void               *pAlloc;
+    TI_UINT32           uAllocLen;
+    void               *pPool;          /* The Rx buffers pool the buffer was allocated for (NULL if none) */
+    TI_UINT32           uPoolClass;     /* The pool size class, or RX_BUF_POOL_NO_CLASS */
+    struct _TSimRxHead *pNext;          /* Pool free list link */
+    struct _TSimRxHead *pRef;           /* The parent buffer referenced by this buffer (see RxBufAttachRef), or NULL */
+    TI_UINT32           uRefCount;      /* The buffer itself and the buffers referencing it */
+    TI_BOOL             bReferenced;    /* Was referenced, so not recycled (as a cloned skb) */
+} TSimRxHead;
+
+#define SIM_RX_HEAD_LEN_ALIGNED ((sizeof(TSimRxHead) + 0x3) & ~0x3)
+
+#define SIM_RX_HEAD_TO_BUF(pHead)   ((TI_UINT8 *)(pHead) + SIM_RX_HEAD_LEN_ALIGNED + WSPI_PAD_BYTES)
+#define SIM_RX_BUF_TO_HEAD(pBuf)    ((TSimRxHead *)((TI_UINT8 *)((unsigned long)(pBuf) & ~(unsigned long)0x3) - \
+                                                    WSPI_PAD_BYTES - SIM_RX_HEAD_LEN_ALIGNED))
+
+/* A pool size class (see the Linux RxBuf.c) */
+typedef struct
+{
+    TSimRxHead         *pFreeList;
+    TI_UINT32           uFreeCount;
+    TI_UINT32           uMaxLen;
+    TI_UINT32           uNumBufs;
+
+    /* Statistics */
+    TI_UINT32           uHits;
+    TI_UINT32           uMisses;
+    TI_UINT32           uRefills;
+    TI_UINT32           uRecycles;
+    TI_UINT32           uFrees;
+} TSimRxBufPoolClass;
+
+typedef struct
+{
+    TI_HANDLE           hOs;
+    TSimRxBufPoolClass  aClass[RX_BUF_POOL_NUM_CLASSES];
+} TSimRxBufPool;
+
+static const TI_UINT32 aRxBufPoolClassLen[RX_BUF_POOL_NUM_CLASSES] = 
+{
+    RX_BUF_POOL_SMALL_LEN,
+    RX_BUF_POOL_MEDIUM_LEN,
+    RX_BUF_POOL_LARGE_LEN
+};
+
+
+/*--------------------------------------------------------------------------------------*/
+
+static TSimRxHead *RxBufAllocHead (TI_HANDLE hOs, TI_UINT32 len, TSimRxBufPool *pPool, TI_UINT32 uClass)
+{
+    TI_UINT32   alloc_len = len + WSPI_PAD_BYTES + PAYLOAD_ALIGN_PAD_BYTES + SIM_RX_HEAD_LEN_ALIGNED;
+    TSimRxHead *rx_head   = (TSimRxHead *)os_memoryAlloc (hOs, alloc_len);
+
+    if (rx_head == NULL)
+    {
+        os_printf ("RxBufAlloc(): allocation failed\n");
+        return NULL;
+    }
+
+    rx_head->pAlloc     = rx_head;
+    rx_head->uAllocLen  = alloc_len;
+    rx_head->pPool      = pPool;
+    rx_head->uPoolClass = uClass;
+    rx_head->pNext      = NULL;
+    rx_head->pRef       = NULL;
+    rx_head->uRefCount  = 1;
+    rx_head->bReferenced = TI_FALSE;
+
+    return rx_head;
+}
+
+static TI_UINT32 RxBufPoolGetClass (TSimRxBufPool *pPool, TI_UINT32 len)
+{
+    TI_UINT32 uClass;
+
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        if (len <= pPool->aClass[uClass].uMaxLen && pPool->aClass[uClass].uNumBufs > 0)
+        {
+            return uClass;
+        }
+    }
+
+    return RX_BUF_POOL_NO_CLASS;
+}
+
+/*--------------------------------------------------------------------------------------*/
+/* 
+ * Allocate BUF Rx packets.
+ * Add 16 bytes before the data buffer for WSPI overhead!
+ */
+void* RxBufAlloc(TI_HANDLE hOs, TI_UINT32 len, PacketClassTag_e ePacketClassTag)
+{
+    TSimRxBufPool *pPool = (TSimRxBufPool *)((TSimOs *)hOs)->hRxBufPool;
+    TSimRxHead    *rx_head;
+
+    if (pPool != NULL)
+    {
+        TI_UINT32 uClass = RxBufPoolGetClass (pPool, len);
+
+        if (uClass != RX_BUF_POOL_NO_CLASS)
+        {
+            TSimRxBufPoolClass *pClass = &pPool->aClass[uClass];
+
+            rx_head = pClass->pFreeList;
+            if (rx_head != NULL)
+            {
+                pClass->pFreeList = rx_head->pNext;
+                pClass->uFreeCount--;
+                pClass->uHits++;
+                return SIM_RX_HEAD_TO_BUF(rx_head);
+            }
+
+            pClass->uMisses++;
+            rx_head = RxBufAllocHead (hOs, pClass->uMaxLen, pPool, uClass);
+            return (rx_head == NULL) ? NULL : SIM_RX_HEAD_TO_BUF(rx_head);
+        }
+    }
+
+    rx_head = RxBufAllocHead (hOs, len, NULL, RX_BUF_POOL_NO_CLASS);
+
+    return (rx_head == NULL) ? NULL : SIM_RX_HEAD_TO_BUF(rx_head);
+}
+
+/*--------------------------------------------------------------------------------------*/
+/* 
+ * Drop a buffer reference, and when it's the last one free the buffer and its parent reference.
+ * If bRecycle is set, an unreferenced buffer is returned to its pool class if not full.
+ */
+static void RxBufPut (TI_HANDLE hOs, TSimRxHead *rx_head, TI_BOOL bRecycle)
+{
+    TSimRxBufPool *pPool = (TSimRxBufPool *)rx_head->pPool;
+
+    if (--rx_head->uRefCount > 0)
+    {
+        return;
+    }
+
+    if (rx_head->pRef != NULL)
+    {
+        RxBufPut (hOs, rx_head->pRef, TI_FALSE);
+        rx_head->pRef = NULL;
+    }
+
+    /* Return unconsumed buffers to their pool class if not full (hOs may be NULL in the stubs) */
+    if (bRecycle && !rx_head->bReferenced && 
+        pPool != NULL && pPool == (TSimRxBufPool *)((TSimOs *)pPool->hOs)->hRxBufPool)
+    {
+        TSimRxBufPoolClass *pClass = &pPool->aClass[rx_head->uPoolClass];
+
+        if (pClass->uFreeCount < pClass->uNumBufs)
+        {
+            rx_head->uRefCount = 1;
+            rx_head->pNext    = pClass->pFreeList;
+            pClass->pFreeList = rx_head;
+            pClass->uFreeCount++;
+            pClass->uRecycles++;
+            return;
+        }
+
+        pClass->uFrees++;
+    }
+
+    os_memoryFree (hOs, rx_head->pAlloc, rx_head->uAllocLen);
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+void RxBufFree(TI_HANDLE hOs, void* pBuf)
+{
+    RxBufPut (hOs, SIM_RX_BUF_TO_HEAD(pBuf), TI_TRUE);
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+void RxBufReserve(TI_HANDLE hOs, void* pBuf, TI_UINT32 len)
+{
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+TI_STATUS RxBufAttachRef(TI_HANDLE hOs, void* pBuf, void* pParentBuf)
+{
+    TSimRxHead *rx_head     = SIM_RX_BUF_TO_HEAD(pBuf);
+    TSimRxHead *parent_head = SIM_RX_BUF_TO_HEAD(pParentBuf);
+
+    parent_head->uRefCount++;
+    parent_head->bReferenced = TI_TRUE;
+    rx_head->pRef = parent_head;
+
+    return TI_OK;
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+TI_STATUS RxBufPoolCreate(TI_HANDLE hOs, TI_UINT32 aNumBufs[RX_BUF_POOL_NUM_CLASSES])
+{
+    TSimRxBufPool *pPool;
+    TI_UINT32      uClass;
+
+    pPool = (TSimRxBufPool *)os_memoryCAlloc (hOs, 1, sizeof(TSimRxBufPool));
+    if (pPool == NULL)
+    {
+        os_printf ("RxBufPoolCreate(): pool allocation failed\n");
+        return TI_NOK;
+    }
+
+    pPool->hOs = hOs;
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        pPool->aClass[uClass].uMaxLen  = aRxBufPoolClassLen[uClass];
+        pPool->aClass[uClass].uNumBufs = aNumBufs[uClass];
+    }
+
+    ((TSimOs *)hOs)->hRxBufPool = (TI_HANDLE)pPool;
+
+    RxBufPoolRefill (hOs);
+
+    return TI_OK;
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+void RxBufPoolDestroy(TI_HANDLE hOs)
+{
+    TSimRxBufPool *pPool = (TSimRxBufPool *)((TSimOs *)hOs)->hRxBufPool;
+    TSimRxHead    *rx_head;
+    TI_UINT32      uClass;
+
+    if (pPool == NULL)
+    {
+        return;
+    }
+
+    ((TSimOs *)hOs)->hRxBufPool = NULL;
+
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        while ((rx_head = pPool->aClass[uClass].pFreeList) != NULL)
+        {
+            pPool->aClass[uClass].pFreeList = rx_head->pNext;
+            os_memoryFree (hOs, rx_head->pAlloc, rx_head->uAllocLen);
+        }
+    }
+
+    os_memoryFree (hOs, pPool, sizeof(TSimRxBufPool));
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+void RxBufPoolRefill(TI_HANDLE hOs)
+{
+    TSimRxBufPool *pPool = (TSimRxBufPool *)((TSimOs *)hOs)->hRxBufPool;
+    TSimRxHead    *rx_head;
+    TI_UINT32      uClass;
+
+    if (pPool == NULL)
+    {
+        return;
+    }
+
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        TSimRxBufPoolClass *pClass = &pPool->aClass[uClass];
+
+        while (pClass->uFreeCount < pClass->uNumBufs)
+        {
+            rx_head = RxBufAllocHead (hOs, pClass->uMaxLen, pPool, uClass);
+            if (rx_head == NULL)
+            {
+                return;
+            }
+            rx_head->pNext    = pClass->pFreeList;
+            pClass->pFreeList = rx_head;
+            pClass->uFreeCount++;
+            pClass->uRefills++;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+TI_BOOL RxBufPoolIsLow(TI_HANDLE hOs)
+{
+    TSimRxBufPool *pPool = (TSimRxBufPool *)((TSimOs *)hOs)->hRxBufPool;
+    TI_UINT32      uClass;
+
+    if (pPool == NULL)
+    {
+        return TI_FALSE;
+    }
+
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        if (pPool->aClass[uClass].uFreeCount < (pPool->aClass[uClass].uNumBufs >> 1))
+        {
+            return TI_TRUE;
+        }
+    }
+
+    return TI_FALSE;
+}
+
+/*--------------------------------------------------------------------------------------*/
+
+void RxBufPoolPrintStats(TI_HANDLE hOs)
+{
+    TSimRxBufPool *pPool = (TSimRxBufPool *)((TSimOs *)hOs)->hRxBufPool;
+    TI_UINT32      uClass;
+
+    if (pPool == NULL)
+    {
+        os_printf ("Rx buffers pool disabled\n");
+        return;
+    }
+
+    os_printf ("Rx buffers pool:  MaxLen   Size   Free       Hits     Misses    Refills   Recycles      Frees\n");
+    for (uClass = 0; uClass < RX_BUF_POOL_NUM_CLASSES; uClass++)
+    {
+        TSimRxBufPoolClass *pClass = &pPool->aClass[uClass];
+
+        os_printf ("                  %6u %6u %6u %10u %10u %10u %10u %10u\n",
+                   pClass->uMaxLen, pClass->uNumBufs, pClass->uFreeCount, pClass->uHits, 
+                   pClass->uMisses, pClass->uRefills, pClass->uRecycles, pClass->uFrees);
+    }
+}
+
+/*--------------------------------------------------------------------------------------*/
+/* 
+ * Release a buffer consumed by the network stack (the stack frees it, so it never returns to the pool).
+ * For a buffer referencing a parent (zero-copy A-MSDU), the stack consumes the parent reference 
+ *     and the buffer itself is released as in RxBufFree (see the Linux os_receivePacket).
+ */
+void simOs_RxBufConsume (TI_HANDLE hOs, void *pBuf)
+{
+    TSimRxHead *rx_head = SIM_RX_BUF_TO_HEAD(pBuf);
+    TSimRxHead *pRef    = rx_head->pRef;
+
+    if (pRef != NULL)
+    {
+        rx_head->pRef = NULL;
+        RxBufPut (hOs, pRef, TI_FALSE);
+        RxBufPut (hOs, rx_head, TI_TRUE);
+        return;
+    }
+
+    RxBufPut (hOs, rx_head, TI_FALSE);
+}
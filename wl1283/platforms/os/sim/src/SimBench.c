@@ -0,0 +1,1508 @@
+/*
+ * SimBench.c
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+ 
+/** \file   SimBench.c 
+ *  \brief  Host simulation benchmark of the TWD and STAD data path.
+ *
+ *  Brings up the TWD and the STAD data path modules over the simulated bus (SimBusDrv.c)
+ *      and the firmware stand-in (FwSim.c), and drives Tx packets through txDataQ_InsertPacket
+ *      and Rx packets through the FW Rx FIFO (handled by the RxXfer on the Rx interrupt).
+ *  The FW download and configuration phases are skipped: the work partition, the mailboxes and
+ *      the memory map are set as done at the end of the HwInit and ConfigFw sequences.
+ *
+ *  Reported: CPU time per packet, Tx queueing latency (from txDataQ_InsertPacket until
+ *      wlanDrvIf_FreeTxPacket) and the bus aggregation ratios.
+ *  With -j the TrafficMonitor per-packet cost is measured instead (see simBench_TrafficMonRun).
+ *  With -g the data packets 802.11 header build cost is measured instead (see simBench_DataHdrRun).
+ *  With -T the driver traces are read back from the trace ring instead (see simBench_TraceRingRun).
+ *
+ *  \see    SimOs.h, FwSim.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#define __FILE_ID__  FILE_ID_143
+#include "tidef.h"
+#include "osApi.h"
+#include "report.h"
+#include "context.h"
+#include "timer.h"
+#include "paramOut.h"
+#include "DrvMainModules.h"
+#include "TxnQueue.h"
+#include "TWDriver.h"
+#include "TWDriverInternal.h"
+#include "CmdBld.h"
+#include "TwIf.h"
+#include "FwEvent_api.h"
+#include "CmdMBox_api.h"
+#include "CmdQueue_api.h"
+#include "eventMbox_api.h"
+#include "rxXfer_api.h"
+#include "txXfer_api.h"
+#include "txResult_api.h"
+#include "txHwQueue_api.h"
+#include "txCtrl_Api.h"
+#include "txDataQueue_Api.h"
+#include "txDataQueue.h"
+#include "DataCtrl_Api.h"
+#include "rx.h"
+#include "TrafficMonitor.h"
+#include "802_11Defs.h"
+#include "Ethernet.h"
+#include "RxBuf.h"
+#include "osTraceRing.h"
+#include "SimOs.h"
+#include "kernel/SimKernel.h"
+#include "FwSim.h"
+
+
+/************************************************************************
+ * Defines
+ ************************************************************************/
+#define SIM_BENCH_DEF_TX_PKTS       1000000
+#define SIM_BENCH_DEF_RX_PKTS       1000000
+#define SIM_BENCH_DEF_PKT_LEN       1500    /* Ethernet packet length (Tx and Rx) */
+#define SIM_BENCH_DEF_BURST         16      /* Packets offered to the driver per main loop iteration */
+#define SIM_BENCH_MAX_PKT_LEN       2000
+#define SIM_BENCH_MAX_AMSDU_LEN     7935    /* Max A-MSDU length (802.11n) */
+#define SIM_BENCH_TX_PAD_SPACE      512     /* Room for the padding to SDIO block added by TxCtrl */
+#define SIM_BENCH_TX_HEADROOM       2       /* As NET_IP_ALIGN - aligns the IP header to 4 bytes */
+#define SIM_BENCH_STALL_TIMEOUT_MS  2000    /* Abort if no progress for this period */
+#define SIM_BENCH_CLSFR_FLOWS       16      /* Tx flows (UDP dst ports / DSCPs) - half of them match a classifier entry */
+#define SIM_BENCH_CLSFR_PORT_BASE   5000
+#define SIM_BENCH_CLSFR_IP_ADDR     0x0A030DC4
+#define SIM_BENCH_CLSFR_HDRS_LEN    (ETHERNET_HDR_LEN + 20 + 8) /* Ethernet + IP + UDP headers */
+#define SIM_BENCH_TRACE_MACRO_RECS  3       /* Traces written by the TRACE macro (see simBench_TraceRingRun) */
+#define SIM_BENCH_TRACE_PARAMS      12      /* Parameters of the direct traces (more than a record keeps) */
+#define SIM_BENCH_TRACE_DROPS       8       /* Direct traces written beyond the ring size */
+
+/* The work partition (see HwInit.c) */
+#define SIM_BENCH_PART_ADDR1        0x40000
+#define SIM_BENCH_PART_SIZE1        0x14FC0
+#define SIM_BENCH_PART_ADDR2        REGISTERS_BASE
+#define SIM_BENCH_PART_SIZE2        0xA000
+#define SIM_BENCH_PART_ADDR3        0x3004F8
+#define SIM_BENCH_PART_SIZE3        0x4
+#define SIM_BENCH_PART_ADDR4        0x40404
+
+/* Periodic timers run during the benchmark (see -w): timer i interval is BASE + i * STEP */
+#define SIM_BENCH_MAX_TIMERS        16
+#define SIM_BENCH_TIMER_BASE_MS     20
+#define SIM_BENCH_TIMER_STEP_MS     7
+
+/* TrafficMonitor benchmark (see -j): alerts window and thresholds (frames, and bytes per frame) */
+#define SIM_BENCH_TRAFF_INTERVAL_MS 100
+#define SIM_BENCH_TRAFF_THRESHOLD   20000
+#define SIM_BENCH_TRAFF_RUN_PERIOD  1024    /* Events between driver context runs */
+
+
+/************************************************************************
+ * Types
+ ************************************************************************/
+/* A Tx packet as provided by the network stack (the data follows the header) */
+typedef struct
+{
+    TI_UINT32       uInsertTimeUs;      /* Time of passing the packet to the driver */
+    TI_UINT32       uLen;
+} TSimTxPkt;
+
+/* The benchmark object */
+typedef struct
+{
+    /* Configuration */
+    TI_UINT32       uNumTxPkts;
+    TI_UINT32       uNumRxPkts;
+    TI_UINT32       uPktLen;
+    TI_UINT32       uBurst;
+    TI_UINT8        uTxDtag;
+    TI_BOOL         bTxCmpltImmediate;
+    TI_UINT32       uRxAggregLimit;
+    TI_BOOL         bRxBufPool;
+    TI_UINT32       uRxAmsduMsdus;      /* MSDUs per injected A-MSDU (1 = no A-MSDU) */
+    TI_BOOL         bAmsduZeroCopy;
+    EClsfrType      eClsfrType;         /* Tx classifier type */
+    TI_BOOL         bConfigFw;          /* Run the FW configuration sequence */
+    TI_BOOL         bCmdMboxMultiIe;    /* Pack consecutive configure commands */
+    TI_BOOL         bRecoveryConfig;    /* Run the FW configuration sequence again as on recovery */
+    TI_UINT32       uBusQueueDepth;     /* Bus transactions in flight (0 = synchronous bus) */
+    TI_BOOL         bPrintTxnQ;         /* Print the TxnQ latency histograms */
+    TI_UINT32       uNumTimers;         /* Periodic timers run during the benchmark */
+    TI_UINT32       uTimerSlackMs;      /* The periodic timers slack (0 = own OS timer each) */
+    TI_BOOL         bTrafficMonBench;   /* Run the TrafficMonitor benchmark instead of the data path */
+    TI_BOOL         bDataHdrBench;      /* Run the data header build benchmark instead of the data path */
+    TI_BOOL         bTraceRingCheck;    /* Read the traces back from the trace ring instead of the data path */
+
+    /* Modules handles */
+    TStadHandlesList tStadHandles;
+    TInitTable      *pInitTable;
+
+    /* Tx state and statistics */
+    TI_BOOL         bTxStopped;         /* Network stack Tx is stopped by the driver */
+    TI_UINT32       uTxSent;            /* Packets passed to txDataQ_InsertPacket */
+    TI_UINT32       uTxFreed;           /* Packets released by wlanDrvIf_FreeTxPacket */
+    TI_UINT32       uTxFailed;          /* Packets released with failure status */
+    TI_UINT32       uTxNoCtrlBlk;       /* TxCtrlBlk allocation failures */
+    TI_UINT32       uTxStops;           /* Number of network stack Tx stop requests */
+    TI_UINT64       uTxLatencySumUs;
+    TI_UINT32       uTxLatencyMaxUs;
+
+    /* Rx state */
+    TI_UINT32       uRxSent;            /* Packets injected to the FW */
+    TI_UINT8        aRxFrame[SIM_BENCH_MAX_AMSDU_LEN + WLAN_HDR_LEN + WLAN_SNAP_HDR_LEN];
+    TI_UINT32       uRxFrameLen;
+
+    /* Periodic timers */
+    TI_HANDLE       aTimers[SIM_BENCH_MAX_TIMERS];
+    TI_UINT32       aTimerStartMs[SIM_BENCH_MAX_TIMERS];
+    TI_UINT32       uTimerExpiries;
+    TI_UINT32       uTimerMaxDelayMs;   /* Longest expiry delay after the timer interval */
+
+    /* TrafficMonitor benchmark */
+    TI_UINT32       uTraffAlerts;       /* Alert callbacks */
+
+    /* Driver activity */
+    TI_UINT32       uDriverTasks;       /* Driver context invocations */
+    TI_BOOL         bInitStepDone;
+
+} TSimBench;
+
+
+static TSimBench tSimBench;
+
+extern TMacAddr tSimStaMac;
+extern TMacAddr tSimBssid;
+
+
+
+/************************************************************************
+ *
+ *   Network interface (replaces WlanDrvIf.c)
+ *
+ ************************************************************************/
+
+void wlanDrvIf_FreeTxPacket (TI_HANDLE hOs, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eStatus)
+{
+    TSimTxPkt *pPkt = (TSimTxPkt *)pPktCtrlBlk->tTxPktParams.pInputPkt;
+    TI_UINT32  uLatency = os_timeStampUs (hOs) - pPkt->uInsertTimeUs;
+
+    tSimBench.uTxFreed++;
+    if (eStatus != TI_OK)
+    {
+        tSimBench.uTxFailed++;
+    }
+
+    tSimBench.uTxLatencySumUs += uLatency;
+    if (uLatency > tSimBench.uTxLatencyMaxUs)
+    {
+        tSimBench.uTxLatencyMaxUs = uLatency;
+    }
+
+    os_memoryFree (hOs, pPkt, sizeof(TSimTxPkt) + SIM_BENCH_TX_HEADROOM + pPkt->uLen + SIM_BENCH_TX_PAD_SPACE);
+}
+
+void wlanDrvIf_StopTx (TI_HANDLE hOs)
+{
+    tSimBench.bTxStopped = TI_TRUE;
+    tSimBench.uTxStops++;
+}
+
+void wlanDrvIf_ResumeTx (TI_HANDLE hOs)
+{
+    tSimBench.bTxStopped = TI_FALSE;
+}
+
+
+/** 
+ * \fn     simBench_BuildTxIpHeaders 
+ * \brief  Build the IP & UDP headers of a Tx packet
+ * 
+ * Build the headers read by the Tx classifier for the given flow.
+ * 
+ * \note   
+ * \param  pIpHdr - Pointer to the IP header (followed by the UDP header)
+ * \param  uFlow  - The flow index (0 to SIM_BENCH_CLSFR_FLOWS-1)
+ * \return void
+ * \sa     simBench_InitTable
+ */ 
+static void simBench_BuildTxIpHeaders (TI_UINT8 *pIpHdr, TI_UINT32 uFlow)
+{
+    TI_UINT8 *pUdpHdr = pIpHdr + 20;
+
+    os_memoryZero (NULL, pIpHdr, 28);
+    pIpHdr[0] = 0x45;                                       /* IPv4, 20 bytes header */
+    pIpHdr[1] = (TI_UINT8)((uFlow * 2) << 2);               /* DSCP */
+    pIpHdr[9] = 17;                                         /* UDP */
+    *(TI_UINT32 *)(pIpHdr + 12) = SIM_BENCH_CLSFR_IP_ADDR + 1;
+    *(TI_UINT32 *)(pIpHdr + 16) = SIM_BENCH_CLSFR_IP_ADDR;
+    *(TI_UINT16 *)(pUdpHdr + 0) = HTOWLANS((TI_UINT16)(SIM_BENCH_CLSFR_PORT_BASE + 1000));
+    *(TI_UINT16 *)(pUdpHdr + 2) = HTOWLANS((TI_UINT16)(SIM_BENCH_CLSFR_PORT_BASE + uFlow));
+}
+
+
+/** 
+ * \fn     simBench_Xmit 
+ * \brief  Transmit one packet
+ * 
+ * Allocate a packet and pass it to the driver, as done by wlanDrvIf_Xmit().
+ * 
+ * \note   
+ * \return TI_OK if the packet was passed to the driver, TI_NOK if no resources
+ * \sa     
+ */ 
+static TI_STATUS simBench_Xmit (void)
+{
+    TStadHandlesList *pHandles = &tSimBench.tStadHandles;
+    TI_UINT32         uLen = tSimBench.uPktLen;
+    TSimTxPkt        *pPkt;
+    TI_UINT8         *pData;
+    TEthernetHeader  *pEthHdr;
+    TTxCtrlBlk       *pPktCtrlBlk;
+
+    pPkt = (TSimTxPkt *)os_memoryAlloc (pHandles->hOs, sizeof(TSimTxPkt) + SIM_BENCH_TX_HEADROOM + uLen + SIM_BENCH_TX_PAD_SPACE);
+    if (pPkt == NULL)
+    {
+        return TI_NOK;
+    }
+    pPkt->uLen = uLen;
+    pData = (TI_UINT8 *)(pPkt + 1) + SIM_BENCH_TX_HEADROOM;
+
+    pEthHdr = (TEthernetHeader *)pData;
+    MAC_COPY (pEthHdr->dst, tSimBssid);
+    MAC_COPY (pEthHdr->src, tSimStaMac);
+    pEthHdr->type = WLANTOHS(ETHERTYPE_IP);
+    if (tSimBench.eClsfrType != D_TAG_CLSFR)
+    {
+        simBench_BuildTxIpHeaders (pData + ETHERNET_HDR_LEN, tSimBench.uTxSent % SIM_BENCH_CLSFR_FLOWS);
+    }
+
+    pPktCtrlBlk = TWD_txCtrlBlk_Alloc (pHandles->hTWD);
+    if (pPktCtrlBlk == NULL)
+    {
+        tSimBench.uTxNoCtrlBlk++;
+        os_memoryFree (pHandles->hOs, pPkt, sizeof(TSimTxPkt) + SIM_BENCH_TX_HEADROOM + uLen + SIM_BENCH_TX_PAD_SPACE);
+        return TI_NOK;
+    }
+
+    pPkt->uInsertTimeUs = os_timeStampUs (pHandles->hOs);
+    pPktCtrlBlk->tTxDescriptor.startTime    = os_timeStampMs (pHandles->hOs);
+    pPktCtrlBlk->tTxDescriptor.length       = (TI_UINT16)uLen;
+    pPktCtrlBlk->tTxPktParams.pInputPkt     = pPkt;
+
+    /* Point the first BDL buffer to the Ethernet header, and the second buffer to the rest of the packet */
+    pPktCtrlBlk->tTxnStruct.aBuf[0] = pData;
+    pPktCtrlBlk->tTxnStruct.aLen[0] = ETHERNET_HDR_LEN;
+    pPktCtrlBlk->tTxnStruct.aBuf[1] = pData + ETHERNET_HDR_LEN;
+    pPktCtrlBlk->tTxnStruct.aLen[1] = (TI_UINT16)(uLen - ETHERNET_HDR_LEN);
+    pPktCtrlBlk->tTxnStruct.aLen[2] = 0;
+
+    tSimBench.uTxSent++;
+
+    /* If failed (queue full), the packet is freed by the driver */
+    txDataQ_InsertPacket (pHandles->hTxDataQ, pPktCtrlBlk, tSimBench.uTxDtag);
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     simBench_BuildRxFrame 
+ * \brief  Prepare the Rx frame injected to the FW
+ * 
+ * An 802.11 data frame from the AP to the station, with LLC/SNAP encapsulated IP payload.
+ * If A-MSDUs are requested, a QoS data frame whose body holds uRxAmsduMsdus subframes, 
+ *     each with its 802.3 header and LLC/SNAP encapsulated IP payload, padded to 4 bytes.
+ * 
+ * \note   
+ * \return void
+ * \sa     
+ */ 
+static void simBench_BuildRxFrame (void)
+{
+    legacy_dot11_header_t *pHdr    = (legacy_dot11_header_t *)tSimBench.aRxFrame;
+    dot11_header_t        *pQosHdr = (dot11_header_t *)tSimBench.aRxFrame;
+    Wlan_LlcHeader_T      *pLlc    = (Wlan_LlcHeader_T *)(pHdr + 1);
+    TEthernetHeader       *pSubHdr;
+    TI_UINT32              uSubLen;
+    TI_UINT32              i;
+
+    pHdr->fc = ENDIAN_HANDLE_WORD(DOT11_FC_DATA | DOT11_FC_FROM_DS);
+    MAC_COPY (pHdr->address1, tSimStaMac);
+    MAC_COPY (pHdr->address2, tSimBssid);
+    MAC_COPY (pHdr->address3, tSimBssid);
+
+    if (tSimBench.uRxAmsduMsdus <= 1)
+    {
+        pLlc->DSAP    = SNAP_CHANNEL_ID;
+        pLlc->SSAP    = SNAP_CHANNEL_ID;
+        pLlc->Control = LLC_CONTROL_UNNUMBERED_INFORMATION;
+        pLlc->Type    = WLANTOHS(ETHERTYPE_IP);
+
+        /* The Ethernet header is replaced by the 802.11 header and the LLC/SNAP */
+        tSimBench.uRxFrameLen = sizeof(legacy_dot11_header_t) + sizeof(Wlan_LlcHeader_T) + 
+                                tSimBench.uPktLen - ETHERNET_HDR_LEN;
+        return;
+    }
+
+    /* A-MSDU in a QoS data frame of TID 0 */
+    pQosHdr->fc         = ENDIAN_HANDLE_WORD(DOT11_FC_DATA_QOS | DOT11_FC_FROM_DS);
+    pQosHdr->qosControl = ENDIAN_HANDLE_WORD(DOT11_QOS_CONTROL_FIELD_A_MSDU_BITS);
+
+    /* A-MSDU subframe: the 802.3 header (with the MSDU length), LLC/SNAP and payload */
+    uSubLen = ETHERNET_HDR_LEN + sizeof(Wlan_LlcHeader_T) + tSimBench.uPktLen - ETHERNET_HDR_LEN;
+    tSimBench.uRxFrameLen = sizeof(dot11_header_t);
+    for (i = 0; i < tSimBench.uRxAmsduMsdus; i++)
+    {
+        pSubHdr = (TEthernetHeader *)(tSimBench.aRxFrame + tSimBench.uRxFrameLen);
+        pLlc    = (Wlan_LlcHeader_T *)(pSubHdr + 1);
+
+        MAC_COPY (pSubHdr->dst, tSimStaMac);
+        MAC_COPY (pSubHdr->src, tSimBssid);
+        pSubHdr->type = WLANTOHS((TI_UINT16)(uSubLen - ETHERNET_HDR_LEN));
+
+        pLlc->DSAP    = SNAP_CHANNEL_ID;
+        pLlc->SSAP    = SNAP_CHANNEL_ID;
+        pLlc->Control = LLC_CONTROL_UNNUMBERED_INFORMATION;
+        os_memoryZero (NULL, pLlc->OUI, sizeof(pLlc->OUI));
+        pLlc->Type    = WLANTOHS(ETHERTYPE_IP);
+
+        /* All subframes but the last are padded to 4 bytes */
+        tSimBench.uRxFrameLen += (i + 1 < tSimBench.uRxAmsduMsdus) ? ((uSubLen + 3) & ~3) : uSubLen;
+    }
+}
+
+
+
+/************************************************************************
+ *
+ *   Driver bring-up
+ *
+ ************************************************************************/
+
+/* The interrupt line (replaces the platform IRQ handler) */
+static void simBench_Irq (TI_HANDLE hTWD)
+{
+    TWD_InterruptRequest (hTWD);
+}
+
+static void simBench_InitStepCb (TI_HANDLE hCbHndl, TI_STATUS eStatus)
+{
+    tSimBench.bInitStepDone = TI_TRUE;
+}
+
+
+/** 
+ * \fn     simBench_RunDriver 
+ * \brief  Run the driver context
+ * 
+ * Run the driver task as long as requested (replaces the driver thread), the expired timers
+ *     and the queued bus transactions completion (replaces the bus adapter interrupt).
+ * 
+ * \note   
+ * \return The number of driver task invocations
+ * \sa     
+ */ 
+static TI_UINT32 simBench_RunDriver (void)
+{
+    TStadHandlesList *pHandles = &tSimBench.tStadHandles;
+    TSimOs           *pOs = (TSimOs *)pHandles->hOs;
+    TI_UINT32         uTasks = 0;
+    TI_UINT32         uTxnsDone;
+
+    do 
+    {
+        while (simOs_TaskPending (pHandles->hOs))
+        {
+            context_DriverTask (pHandles->hContext);
+            uTasks++;
+        }
+        simOs_RunTimers (pHandles->hOs);
+        uTxnsDone = busDrv_SimCompleteTxns ();
+    } 
+    while (pOs->bTaskPending || (uTxnsDone > 0));
+
+    tSimBench.uDriverTasks += uTasks;
+
+    return uTasks;
+}
+
+
+/** 
+ * \fn     simBench_WaitInitStep 
+ * \brief  Complete an asynchronous initialization step
+ * 
+ * \note   
+ * \param  eStatus - The step status
+ * \return TI_OK if completed, TI_NOK if failed
+ * \sa     
+ */ 
+static TI_STATUS simBench_WaitInitStep (TI_STATUS eStatus)
+{
+    if (eStatus == (TI_STATUS)TXN_STATUS_PENDING)
+    {
+        simBench_RunDriver ();
+        if (!tSimBench.bInitStepDone)
+        {
+            return TI_NOK;
+        }
+    }
+    else if (eStatus != TI_OK && eStatus != (TI_STATUS)TXN_STATUS_COMPLETE)
+    {
+        return TI_NOK;
+    }
+
+    tSimBench.bInitStepDone = TI_FALSE;
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     simBench_InitTable 
+ * \brief  Set the driver default parameters (replaces the registry and ini file)
+ * 
+ * \note   
+ * \param  pInitTable - The init table (zeroed)
+ * \return void
+ * \sa     
+ */ 
+static void simBench_InitTable (TInitTable *pInitTable)
+{
+    TTwdInitParams *pTwdParams = &pInitTable->twdInitParams;
+    TI_UINT32       i;
+
+    pTwdParams->tGeneral.uRxAggregPktsLimit = tSimBench.uRxAggregLimit;
+    pTwdParams->tGeneral.uTxAggregPktsLimit = TWD_TX_AGGREG_PKTS_LIMIT_DEF;
+    pTwdParams->tGeneral.uHostIfCfgBitmap   = TWD_HOST_IF_CFG_BITMAP_DEF;
+    pTwdParams->tGeneral.bCmdMboxMultiIe    = tSimBench.bCmdMboxMultiIe;
+    pTwdParams->tGeneral.bRecoveryConfigJournal = TWD_RECOVERY_CONFIG_JOURNAL_DEF;
+    pTwdParams->tGeneral.uSdioBlkSizeShift  = SDIO_BLK_SIZE_SHIFT_DEF;
+    pTwdParams->tGeneral.TxBlocksThresholdPerAc[QOS_AC_BE] = QOS_TX_BLKS_THRESHOLD_BE_DEF;
+    pTwdParams->tGeneral.TxBlocksThresholdPerAc[QOS_AC_BK] = QOS_TX_BLKS_THRESHOLD_BK_DEF;
+    pTwdParams->tGeneral.TxBlocksThresholdPerAc[QOS_AC_VI] = QOS_TX_BLKS_THRESHOLD_VI_DEF;
+    pTwdParams->tGeneral.TxBlocksThresholdPerAc[QOS_AC_VO] = QOS_TX_BLKS_THRESHOLD_VO_DEF;
+    pTwdParams->tGeneral.halCtrlMaxTxMsduLifetime = TWD_MAX_TX_MSDU_LIFETIME_DEF;
+    pTwdParams->tGeneral.halCtrlMaxRxMsduLifetime = TWD_MAX_RX_MSDU_LIFETIME_DEF;
+    MAC_COPY (pTwdParams->tGeneral.StaMacAddress, tSimStaMac);
+
+    pInitTable->txDataInitParams.creditCalculationTimeout = TX_DATA_CREDIT_CALC_TIMOEUT_DEF;
+    pInitTable->txDataInitParams.bCreditCalcTimerEnabled  = TI_FALSE;
+    pInitTable->txDataInitParams.bTxLatencyStats          = TX_DATA_LATENCY_STATS_DEF;
+    pInitTable->txDataInitParams.bStopNetStackTx          = TI_TRUE;
+    pInitTable->txDataInitParams.uTxSendPaceThresh        = 1;
+    pInitTable->txDataInitParams.uTxBurstPktsLimit        = pTwdParams->tGeneral.uTxAggregPktsLimit;
+    pInitTable->txDataInitParams.ClsfrInitParam.eClsfrType = tSimBench.eClsfrType;
+    if (tSimBench.eClsfrType != D_TAG_CLSFR)
+    {
+        TClsfrParams *pClsfr = &pInitTable->txDataInitParams.ClsfrInitParam;
+
+        /* Every second flow of simBench_BuildTxIpHeaders matches an entry */
+        pClsfr->uNumActiveEntries = NUM_OF_CLSFR_TABLE_ENTRIES;
+        for (i = 0; i < NUM_OF_CLSFR_TABLE_ENTRIES; i++)
+        {
+            pClsfr->ClsfrTable[i].DTag = (TI_UINT8)(i % MAX_NUM_OF_802_1d_TAGS);
+            if (tSimBench.eClsfrType == DSCP_CLSFR)
+            {
+                pClsfr->ClsfrTable[i].Dscp.CodePoint = (TI_UINT8)(i * 4);
+            }
+            else if (tSimBench.eClsfrType == PORT_CLSFR)
+            {
+                pClsfr->ClsfrTable[i].Dscp.DstPortNum = (TI_UINT16)(SIM_BENCH_CLSFR_PORT_BASE + i * 2);
+            }
+            else
+            {
+                pClsfr->ClsfrTable[i].Dscp.DstIPPort.DstIPAddress = SIM_BENCH_CLSFR_IP_ADDR;
+                pClsfr->ClsfrTable[i].Dscp.DstIPPort.DstPortNum = (TI_UINT16)(SIM_BENCH_CLSFR_PORT_BASE + i * 2);
+            }
+        }
+    }
+
+    pInitTable->rxDataInitParams.rxDataFiltersEnabled        = TI_FALSE;
+    pInitTable->rxDataInitParams.rxDataFiltersDefaultAction  = FILTER_SIGNAL;
+    pInitTable->rxDataInitParams.reAuthActiveTimeout         = RX_DATA_RE_AUTH_ACTIVE_TIMEOUT_DEF;
+    pInitTable->rxDataInitParams.bAmsduZeroCopy              = tSimBench.bAmsduZeroCopy;
+    if (tSimBench.bRxBufPool)
+    {
+        pInitTable->rxDataInitParams.uRxBufPoolSmallBufs     = RX_DATA_BUF_POOL_SMALL_BUFS_DEF;
+        pInitTable->rxDataInitParams.uRxBufPoolMediumBufs    = RX_DATA_BUF_POOL_MEDIUM_BUFS_DEF;
+        pInitTable->rxDataInitParams.uRxBufPoolLargeBufs     = RX_DATA_BUF_POOL_LARGE_BUFS_DEF;
+    }
+}
+
+
+/** 
+ * \fn     simBench_ConfigFw 
+ * \brief  Run the FW configuration sequence over the firmware stand-in
+ * 
+ * As in drvMain_ConfigFw() and TWD_ConfigFw(). Prints the sequence mailbox commands and time.
+ * 
+ * \note   The memory map read at the end of the sequence is not used (see simBench_InitTwd)
+ * \param  bRecovery - Configure as after a recovery FW reload (replay the journaled settings)
+ * \return TI_OK / TI_NOK
+ * \sa     simBench_InitTwd
+ */ 
+static TI_STATUS simBench_ConfigFw (TI_BOOL bRecovery)
+{
+    TStadHandlesList  *pHandles = &tSimBench.tStadHandles;
+    TTwd              *pTWD = (TTwd *)pHandles->hTWD;
+    TFwSimStats        tStatsStart;
+    TFwSimStats        tStatsEnd;
+    TI_UINT32          uTasksStart = tSimBench.uDriverTasks;
+    TI_UINT32          uTimeStartUs = os_timeStampUs (pHandles->hOs);
+    TI_UINT32          uMboxCmds;
+    TConfigFwStats     tConfigStats;
+
+    fwSim_GetStats (&tStatsStart);
+
+    TWD_ExitFromInitMode (pHandles->hTWD);
+    cmdBld_ConfigFw (pTWD->hCmdBld, bRecovery, (void *)simBench_InitStepCb, NULL);
+    if (simBench_WaitInitStep ((TI_STATUS)TXN_STATUS_PENDING) != TI_OK)
+    {
+        return TI_NOK;
+    }
+
+    fwSim_GetStats (&tStatsEnd);
+    uMboxCmds = tStatsEnd.uCmds - tStatsStart.uCmds;
+
+    cmdBld_GetConfigFwStats (pTWD->hCmdBld, &tConfigStats);
+
+    printf ("FW config%s: %u steps (%u skipped), %u commands in %u mailbox commands (%u multi-IE), %u driver tasks, %u interrupts, %u usec\n", 
+            bRecovery ? " (recovery)" : "", tConfigStats.uSteps, tConfigStats.uSkippedSteps,
+            uMboxCmds - (tStatsEnd.uCmdsMultiIe - tStatsStart.uCmdsMultiIe) + (tStatsEnd.uCmdIes - tStatsStart.uCmdIes),
+            uMboxCmds, tStatsEnd.uCmdsMultiIe - tStatsStart.uCmdsMultiIe, 
+            tSimBench.uDriverTasks - uTasksStart, tStatsEnd.uInterrupts - tStatsStart.uInterrupts,
+            os_timeStampUs (pHandles->hOs) - uTimeStartUs);
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     simBench_InitTwd 
+ * \brief  Create and start the TWD over the firmware stand-in
+ * 
+ * Follows drvMain_Init() and the TWD_InitHw(), hwInit_FinalizeDownloadSm() and 
+ *     TWD_ConfigFwCb() sequences, without the FW download (and configuration unless requested).
+ * 
+ * \note   
+ * \param  pFwCfg - The FW stand-in configuration
+ * \return TI_OK / TI_NOK
+ * \sa     
+ */ 
+static TI_STATUS simBench_InitTwd (TFwSimCfg *pFwCfg)
+{
+    TStadHandlesList  *pHandles = &tSimBench.tStadHandles;
+    TI_HANDLE          hOs = pHandles->hOs;
+    TTwd              *pTWD;
+    TReportInitParams  tReportParams;
+    TBusDrvCfg         tBusDrvCfg;
+    TPartition         aPartition[4];
+    TI_UINT32          uRxDmaBufLen;
+    TI_UINT32          uTxDmaBufLen;
+    TDmaParams        *pDmaParams;
+    TI_STATUS          eStatus;
+
+    pHandles->hReport  = report_Create (hOs);
+    pHandles->hContext = context_Create (hOs);
+    pHandles->hTimer   = tmr_Create (hOs);
+    pHandles->hTxnQ    = txnQ_Create (hOs);
+    pHandles->hTWD     = TWD_Create (hOs);
+    tSimBench.pInitTable = (TInitTable *)os_memoryCAlloc (hOs, 1, sizeof(TInitTable));
+    if (!pHandles->hReport || !pHandles->hContext || !pHandles->hTimer || 
+        !pHandles->hTxnQ || !pHandles->hTWD || !tSimBench.pInitTable)
+    {
+        return TI_NOK;
+    }
+    pTWD = (TTwd *)pHandles->hTWD;
+
+    /* Report only errors (all files). The tables are in the ini file format ('0' or '1' per entry) */
+    os_memorySet (hOs, tReportParams.aFileEnable, '1', sizeof(tReportParams.aFileEnable));
+    os_memorySet (hOs, tReportParams.aSeverityTable, '0', sizeof(tReportParams.aSeverityTable));
+    tReportParams.aSeverityTable[REPORT_SEVERITY_ERROR]       = '1';
+    tReportParams.aSeverityTable[REPORT_SEVERITY_FATAL_ERROR] = '1';
+    report_SetDefaults (pHandles->hReport, &tReportParams);
+
+    context_Init (pHandles->hContext, hOs, pHandles->hReport);
+    tmr_Init (pHandles->hTimer, hOs, pHandles->hReport, pHandles->hContext);
+    txnQ_Init (pHandles->hTxnQ, hOs, pHandles->hReport, pHandles->hContext);
+    TWD_Init (pHandles->hTWD, pHandles->hReport, NULL, pHandles->hTimer, pHandles->hContext, 
+              pHandles->hTxnQ, NULL, NULL, NULL, NULL, NULL);
+
+    simBench_InitTable (tSimBench.pInitTable);
+    if (TWD_SetDefaults (pHandles->hTWD, &tSimBench.pInitTable->twdInitParams) != TI_OK)
+    {
+        return TI_NOK;
+    }
+
+    os_memoryZero (hOs, &tBusDrvCfg, sizeof(tBusDrvCfg));
+    if (txnQ_ConnectBus (pHandles->hTxnQ, &tBusDrvCfg, NULL, NULL, &uRxDmaBufLen, &uTxDmaBufLen) != TI_OK)
+    {
+        return TI_NOK;
+    }
+
+    /* A bus adapter with a request queue - allow the TxnQ as many transactions in flight */
+    if ((tSimBench.uBusQueueDepth > 0) &&
+        ((busDrv_SimSetQueueDepth (tSimBench.uBusQueueDepth) != TI_OK) || 
+         (txnQ_SetMaxTxnsInFlight (pHandles->hTxnQ, tSimBench.uBusQueueDepth) != TI_OK)))
+    {
+        return TI_NOK;
+    }
+
+    /* The FW is up after boot and download */
+    fwSim_Init (pFwCfg, simBench_Irq, pHandles->hTWD);
+
+    /* As in TWD_InitHw() */
+    rxXfer_SetBusParams (pTWD->hRxXfer, uRxDmaBufLen);
+    txXfer_SetBusParams (pTWD->hTxXfer, uTxDmaBufLen);
+    twIf_Awake (pTWD->hTwIf);
+    twIf_HwAvailable (pTWD->hTwIf);
+
+    /* As in hwInit_FinalizeDownloadSm() */
+    aPartition[0].uMemAdrr = SIM_BENCH_PART_ADDR1;
+    aPartition[0].uMemSize = SIM_BENCH_PART_SIZE1;
+    aPartition[1].uMemAdrr = SIM_BENCH_PART_ADDR2;
+    aPartition[1].uMemSize = SIM_BENCH_PART_SIZE2;
+    aPartition[2].uMemAdrr = SIM_BENCH_PART_ADDR3;
+    aPartition[2].uMemSize = SIM_BENCH_PART_SIZE3;
+    aPartition[3].uMemAdrr = SIM_BENCH_PART_ADDR4;
+    aPartition[3].uMemSize = 0;
+    twIf_SetPartition (pTWD->hTwIf, aPartition);
+
+    eStatus = cmdMbox_ConfigHw (pTWD->hCmdMbox, (fnotify_t)simBench_InitStepCb, NULL);
+    if (simBench_WaitInitStep (eStatus) != TI_OK)
+    {
+        return TI_NOK;
+    }
+    eStatus = eventMbox_InitMboxAddr (pTWD->hEventMbox, (fnotify_t)simBench_InitStepCb, NULL);
+    if (simBench_WaitInitStep (eStatus) != TI_OK)
+    {
+        return TI_NOK;
+    }
+    fwEvent_SetInitMask (pTWD->hFwEvent);
+
+    /* As in drvMain_InitHwCb() */
+    os_enableIrq (hOs);
+    TWD_EnableInterrupts (pHandles->hTWD);
+
+    if (tSimBench.bConfigFw && (simBench_ConfigFw (TI_FALSE) != TI_OK))
+    {
+        return TI_NOK;
+    }
+    if (tSimBench.bRecoveryConfig && (simBench_ConfigFw (TI_TRUE) != TI_OK))
+    {
+        return TI_NOK;
+    }
+
+    /* As in TWD_ConfigFwCb(), with the memory map provided directly by the FW stand-in */
+    pDmaParams = &DB_DMA(pTWD->hCmdBld);
+    fwSim_GetDmaParams (pDmaParams);
+    txResult_setHwInfo (pTWD->hTxResult, pDmaParams);
+    rxXfer_Restart (pTWD->hRxXfer);
+    txXfer_Restart (pTWD->hTxXfer);
+    rxXfer_SetRxDirectAccessParams (pTWD->hRxXfer, pDmaParams);
+    txHwQueue_SetHwInfo (pTWD->hTxHwQueue, pDmaParams);
+    cmdQueue_EndReconfig (pTWD->hCmdQueue);
+
+    /* As in drvMain_ConfigFwCb() and drvMain_EnableActivities() */
+    if (!tSimBench.bConfigFw)
+    {
+        TWD_ExitFromInitMode (pHandles->hTWD);
+    }
+    TWD_EnableExternalEvents (pHandles->hTWD);
+    tmr_UpdateDriverState (pHandles->hTimer, TI_TRUE);
+
+    simBench_RunDriver ();
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     simBench_InitDataPath 
+ * \brief  Create and start the STAD data path modules in connected state
+ * 
+ * \note   
+ * \return TI_OK / TI_NOK
+ * \sa     
+ */ 
+static TI_STATUS simBench_InitDataPath (void)
+{
+    TStadHandlesList *pHandles = &tSimBench.tStadHandles;
+    paramInfo_t       tParam;
+
+    pHandles->hTxCtrl  = txCtrl_Create (pHandles->hOs);
+    pHandles->hTxDataQ = txDataQ_Create (pHandles->hOs);
+    pHandles->hRxData  = rxData_create (pHandles->hOs);
+    if (!pHandles->hTxCtrl || !pHandles->hTxDataQ || !pHandles->hRxData)
+    {
+        return TI_NOK;
+    }
+
+    txCtrl_Init (pHandles);
+    txDataQ_Init (pHandles);
+    rxData_init (pHandles);
+
+    if ((txCtrl_SetDefaults (pHandles->hTxCtrl, tSimBench.pInitTable) != TI_OK) ||
+        (txDataQ_SetDefaults (pHandles->hTxDataQ, &tSimBench.pInitTable->txDataInitParams) != TI_OK) ||
+        (rxData_SetDefaults (pHandles->hRxData, &tSimBench.pInitTable->rxDataInitParams) != TI_OK))
+    {
+        return TI_NOK;
+    }
+
+    /* Connected to an open infrastructure BSS */
+    txCtrlParams_setBssId (pHandles->hTxCtrl, &tSimBssid);
+    txCtrlParams_setBssType (pHandles->hTxCtrl, BSS_INFRASTRUCTURE);
+    tParam.paramType = RX_DATA_EXCLUDE_UNENCRYPTED_PARAM;
+    tParam.content.rxDataExcludeUnencrypted = TI_FALSE;
+    rxData_setParam (pHandles->hRxData, &tParam);
+    tParam.paramType = RX_DATA_PORT_STATUS_PARAM;
+    tParam.content.rxDataPortStatus = OPEN;
+    rxData_setParam (pHandles->hRxData, &tParam);
+    txDataQ_WakeAll (pHandles->hTxDataQ);
+
+    simBench_RunDriver ();
+
+    return TI_OK;
+}
+
+
+
+/************************************************************************
+ *
+ *   Benchmark
+ *
+ ************************************************************************/
+
+static double simBench_TimeSec (clockid_t eClock)
+{
+    struct timespec tTime;
+
+    clock_gettime (eClock, &tTime);
+
+    return (double)tTime.tv_sec + (double)tTime.tv_nsec / 1e9;
+}
+
+
+/** 
+ * \fn     simBench_TimerExpiry / simBench_StartTimers / simBench_StopTimers
+ * \brief  The periodic timers run during the benchmark (see -w and -y)
+ * 
+ * Timer i interval is SIM_BENCH_TIMER_BASE_MS + i * SIM_BENCH_TIMER_STEP_MS. Each expiry 
+ *     records its delay after the interval.
+ * 
+ * \note   
+ * \sa     simBench_Run
+ */ 
+static void simBench_TimerExpiry (TI_HANDLE hCbHndl, TI_BOOL bTwdInitOccured)
+{
+    TI_UINT32 uIndex = (TI_UINT32)(unsigned long)hCbHndl;
+    TI_UINT32 uNowMs = os_timeStampMs (tSimBench.tStadHandles.hOs);
+    TI_UINT32 uDelay = uNowMs - tSimBench.aTimerStartMs[uIndex] - (SIM_BENCH_TIMER_BASE_MS + uIndex * SIM_BENCH_TIMER_STEP_MS);
+
+    if ((TI_INT32)uDelay > (TI_INT32)tSimBench.uTimerMaxDelayMs)
+    {
+        tSimBench.uTimerMaxDelayMs = uDelay;
+    }
+    tSimBench.aTimerStartMs[uIndex] = uNowMs;
+    tSimBench.uTimerExpiries++;
+}
+
+
+static void simBench_StartTimers (void)
+{
+    TStadHandlesList *pHandles = &tSimBench.tStadHandles;
+    TI_UINT32         i;
+
+    for (i = 0; i < tSimBench.uNumTimers; i++)
+    {
+        tSimBench.aTimers[i] = tmr_CreateTimer (pHandles->hTimer);
+        tmr_SetTimerSlack (tSimBench.aTimers[i], tSimBench.uTimerSlackMs);
+        tSimBench.aTimerStartMs[i] = os_timeStampMs (pHandles->hOs);
+        tmr_StartTimer (tSimBench.aTimers[i], simBench_TimerExpiry, (TI_HANDLE)(unsigned long)i, 
+                        SIM_BENCH_TIMER_BASE_MS + i * SIM_BENCH_TIMER_STEP_MS, TI_TRUE);
+    }
+}
+
+
+static void simBench_StopTimers (void)
+{
+    TI_UINT32 i;
+
+    for (i = 0; i < tSimBench.uNumTimers; i++)
+    {
+        tmr_StopTimer (tSimBench.aTimers[i]);
+        tmr_DestroyTimer (tSimBench.aTimers[i]);
+    }
+}
+
+
+/** 
+ * \fn     simBench_Run 
+ * \brief  The benchmark main loop
+ * 
+ * Each iteration offers a burst of Tx and Rx packets, and runs the driver context 
+ *     until it has no more pending work.
+ * 
+ * \note   
+ * \return TI_OK if all packets were handled, TI_NOK if the driver stalled
+ * \sa     
+ */ 
+static TI_STATUS simBench_Run (void)
+{
+    TStadHandlesList *pHandles = &tSimBench.tStadHandles;
+    TI_UINT32         uLastProgressMs = os_timeStampMs (pHandles->hOs);
+    TI_BOOL           bProgress;
+    TI_UINT32         i;
+
+    while ((tSimBench.uTxSent < tSimBench.uNumTxPkts) || 
+           (tSimBench.uRxSent < tSimBench.uNumRxPkts) || 
+           (tSimBench.uTxFreed < tSimBench.uTxSent))
+    {
+        bProgress = TI_FALSE;
+
+        for (i = 0; i < tSimBench.uBurst && tSimBench.uTxSent < tSimBench.uNumTxPkts && !tSimBench.bTxStopped; i++)
+        {
+            if (simBench_Xmit () != TI_OK)
+            {
+                break;
+            }
+            bProgress = TI_TRUE;
+        }
+
+        for (i = 0; i < tSimBench.uBurst && tSimBench.uRxSent < tSimBench.uNumRxPkts; i++)
+        {
+            if (fwSim_InjectRxPacket (tSimBench.aRxFrame, tSimBench.uRxFrameLen, 
+                                      (tSimBench.uRxAmsduMsdus > 1) ? TAG_CLASS_AMSDU : TAG_CLASS_DATA) != TI_OK)
+            {
+                break;
+            }
+            tSimBench.uRxSent += tSimBench.uRxAmsduMsdus;
+            bProgress = TI_TRUE;
+        }
+
+        if (!tSimBench.bTxCmpltImmediate && fwSim_TxComplete (tSimBench.uBurst) > 0)
+        {
+            bProgress = TI_TRUE;
+        }
+
+        if (simBench_RunDriver () > 0)
+        {
+            bProgress = TI_TRUE;
+        }
+
+        if (bProgress)
+        {
+            uLastProgressMs = os_timeStampMs (pHandles->hOs);
+        }
+        else if (os_timeStampMs (pHandles->hOs) - uLastProgressMs > SIM_BENCH_STALL_TIMEOUT_MS)
+        {
+            return TI_NOK;
+        }
+    }
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     simBench_TrafficMonAlert / simBench_TrafficMonBench / simBench_TrafficMonRun
+ * \brief  The TrafficMonitor per-packet cost benchmark (see -j)
+ * 
+ * Report Tx and Rx directed data events (as txCtrl and rxData) to a TrafficMonitor with 0, 8 and 32 
+ *     level alerts registered (up and down, frames and bytes), per packet and in batch mode.
+ * 
+ * \note   The driver context is run every SIM_BENCH_TRAFF_RUN_PERIOD events, for the timers
+ * \sa     TrafficMonitor_Event, TrafficMonitor_SetBatchMode
+ */ 
+static void simBench_TrafficMonAlert (TI_HANDLE hContext, TI_UINT32 uCookie)
+{
+    tSimBench.uTraffAlerts++;
+}
+
+
+static void simBench_TrafficMonBench (TI_UINT32 uNumAlerts, TI_BOOL bBatchMode)
+{
+    static const TraffEvntOptNum_t aTypes[] = {TX_RX_DIRECTED_FRAMES, TX_RX_ALL_MSDU_IN_BYTES, 
+                                               TX_RX_ALL_MSDU_FRAMES, TX_RX_DIRECTED_IN_BYTES};
+    TStadHandlesList     *pHandles = &tSimBench.tStadHandles;
+    TI_HANDLE             aAlerts[32];
+    TrafficAlertRegParm_t tAlertParm;
+    TI_UINT32             uNumEvents = tSimBench.uNumTxPkts + tSimBench.uNumRxPkts;
+    TI_UINT32             uBandwidth;
+    TI_UINT32             i;
+    double                fCpuStart, fCpuTime;
+
+    pHandles->hTrafficMon = TrafficMonitor_create (pHandles->hOs);
+    if (pHandles->hTrafficMon == NULL)
+    {
+        return;
+    }
+    TrafficMonitor_Init (pHandles, 1000);
+    TrafficMonitor_SetBatchMode (pHandles->hTrafficMon, bBatchMode);
+
+    for (i = 0; i < uNumAlerts; i++)
+    {
+        tAlertParm.CallBack       = simBench_TrafficMonAlert;
+        tAlertParm.Context        = NULL;
+        tAlertParm.Cookie         = i;
+        tAlertParm.Direction      = (i & 1) ? TRAFF_DOWN : TRAFF_UP;
+        tAlertParm.Trigger        = TRAFF_LEVEL;
+        tAlertParm.TimeIntervalMs = SIM_BENCH_TRAFF_INTERVAL_MS;
+        tAlertParm.MonitorType    = aTypes[(i >> 1) & 3];
+        tAlertParm.Threshold      = SIM_BENCH_TRAFF_THRESHOLD * (1 + i / 8);
+        if ((tAlertParm.MonitorType == TX_RX_ALL_MSDU_IN_BYTES) || (tAlertParm.MonitorType == TX_RX_DIRECTED_IN_BYTES))
+        {
+            tAlertParm.Threshold *= tSimBench.uPktLen;
+        }
+        aAlerts[i] = TrafficMonitor_RegEvent (pHandles->hTrafficMon, &tAlertParm, TI_FALSE);
+        TrafficMonitor_StartEventNotif (pHandles->hTrafficMon, aAlerts[i]);
+    }
+    TrafficMonitor_Start (pHandles->hTrafficMon);
+
+    tSimBench.uTraffAlerts = 0;
+    fCpuStart = simBench_TimeSec (CLOCK_PROCESS_CPUTIME_ID);
+    for (i = 0; i < uNumEvents; i++)
+    {
+        if (i & 1)
+        {
+            TrafficMonitor_Event (pHandles->hTrafficMon, tSimBench.uPktLen, 
+                                  RECV_OK | DIRECTED_BYTES_RECV | DIRECTED_FRAMES_RECV, RX_TRAFF_MODULE);
+        }
+        else
+        {
+            TrafficMonitor_Event (pHandles->hTrafficMon, tSimBench.uPktLen, 
+                                  XFER_OK | DIRECTED_BYTES_XFER | DIRECTED_FRAMES_XFER, TX_TRAFF_MODULE);
+        }
+        if ((i % SIM_BENCH_TRAFF_RUN_PERIOD) == 0)
+        {
+            simBench_RunDriver ();
+        }
+    }
+    uBandwidth = TrafficMonitor_GetFrameBandwidth (pHandles->hTrafficMon);
+    fCpuTime = simBench_TimeSec (CLOCK_PROCESS_CPUTIME_ID) - fCpuStart;
+
+    printf ("  %2u alerts, %-9s: %6.1f nsec/pkt, %u alerts called, BW %u frames/sec\n", 
+            uNumAlerts, bBatchMode ? "batched" : "per-pkt", uNumEvents ? fCpuTime * 1e9 / uNumEvents : 0.0, 
+            tSimBench.uTraffAlerts, uBandwidth);
+
+    TrafficMonitor_Stop (pHandles->hTrafficMon);
+    for (i = 0; i < uNumAlerts; i++)
+    {
+        TrafficMonitor_UnregEvent (pHandles->hTrafficMon, aAlerts[i]);
+    }
+    TrafficMonitor_Destroy (pHandles->hTrafficMon);
+    pHandles->hTrafficMon = NULL;
+}
+
+
+static void simBench_TrafficMonRun (void)
+{
+    static const TI_UINT32 aNumAlerts[] = {0, 8, 32};
+    TI_UINT32 i;
+
+    printf ("TrafficMonitor: %u events (Tx and Rx directed), %u bytes each\n", 
+            tSimBench.uNumTxPkts + tSimBench.uNumRxPkts, tSimBench.uPktLen);
+
+    for (i = 0; i < sizeof(aNumAlerts) / sizeof(aNumAlerts[0]); i++)
+    {
+        simBench_TrafficMonBench (aNumAlerts[i], TI_FALSE);
+        simBench_TrafficMonBench (aNumAlerts[i], TI_TRUE);
+    }
+}
+
+
+/** 
+ * \fn     simBench_DataHdrBench / simBench_DataHdrRun
+ * \brief  The data packets 802.11 header build cost benchmark (see -g)
+ * 
+ * Build the WLAN header of uNumTxPkts packets on one CtrlBlk in legacy, QoS and QoS+HT header modes:
+ *     as data packets (copied from the header template) and as EAPOL packets (built from scratch).
+ * The two headers are compared (both are unencrypted), and the data packets are measured also with 
+ *     the AES security pad.
+ * 
+ * \note   
+ * \sa     txCtrl_BuildDataPktHdr
+ */ 
+static double simBench_DataHdrBench (TTxCtrlBlk *pPktCtrlBlk, TI_UINT8 *pEthHdr, TI_UINT8 uPktType, TI_UINT32 *pHdrLen)
+{
+    TStadHandlesList *pHandles = &tSimBench.tStadHandles;
+    TI_UINT32         uNumPkts = tSimBench.uNumTxPkts;
+    TI_UINT32         i;
+    double            fCpuStart;
+
+    pPktCtrlBlk->tTxPktParams.uPktType = uPktType;
+    pPktCtrlBlk->tTxDescriptor.tid     = tSimBench.uTxDtag;
+
+    fCpuStart = simBench_TimeSec (CLOCK_PROCESS_CPUTIME_ID);
+    for (i = 0; i < uNumPkts; i++)
+    {
+        /* Restore the CtrlBlk fields updated by the header build */
+        pPktCtrlBlk->tTxnStruct.aBuf[0]    = pEthHdr;
+        pPktCtrlBlk->tTxDescriptor.length  = (TI_UINT16)tSimBench.uPktLen;
+        pPktCtrlBlk->tTxPktParams.uFlags   = 0;
+
+        txCtrl_BuildDataPktHdr (pHandles->hTxCtrl, pPktCtrlBlk, ACK_POLICY_LEGACY);
+    }
+
+    *pHdrLen = pPktCtrlBlk->tTxnStruct.aLen[0] - sizeof(TxIfDescriptor_t);
+    return uNumPkts ? (simBench_TimeSec (CLOCK_PROCESS_CPUTIME_ID) - fCpuStart) * 1e9 / uNumPkts : 0.0;
+}
+
+
+static void simBench_DataHdrRun (void)
+{
+    static const char *aModeStr[] = {"legacy", "QoS", "QoS+HT"};
+    TStadHandlesList *pHandles = &tSimBench.tStadHandles;
+    TTxCtrlBlk        tPktCtrlBlk;
+    TEthernetHeader   tEthHdr;
+    TI_UINT8          aEapolHdr[MAX_HEADER_SIZE];
+    TI_UINT8          aDataHdr[MAX_HEADER_SIZE];
+    TI_BOOL           bMatch;
+    TtxCtrlHtControl  tHtControl;
+    TI_UINT32         uHdrLen, uEapolHdrLen, uAesHdrLen;
+    double            fDataNs, fEapolNs, fAesNs;
+    TI_UINT32         uMode;
+
+    os_memoryZero (pHandles->hOs, &tPktCtrlBlk, sizeof(tPktCtrlBlk));
+    MAC_COPY (tEthHdr.dst, tSimBssid);
+    MAC_COPY (tEthHdr.src, tSimStaMac);
+    tEthHdr.type = WLANTOHS(ETHERTYPE_IP);
+    txCtrlParams_setBssId (pHandles->hTxCtrl, &tSimBssid);
+
+    printf ("Data header build: %u packets per case (nsec/pkt)\n", tSimBench.uNumTxPkts);
+
+    for (uMode = 0; uMode < sizeof(aModeStr) / sizeof(aModeStr[0]); uMode++)
+    {
+        txCtrlParams_setQosHeaderConverMode (pHandles->hTxCtrl, (uMode == 0) ? HDR_CONVERT_NONE : HDR_CONVERT_QOS);
+        tHtControl.bHtEnable = (uMode == 2) ? TI_TRUE : TI_FALSE;
+        txCtrlParams_SetHtControl (pHandles->hTxCtrl, &tHtControl);
+        txCtrlParams_setCurrentPrivacyInvokedMode (pHandles->hTxCtrl, TI_FALSE);
+        txCtrlParams_setEncryptionFieldSizes (pHandles->hTxCtrl, 0);
+
+        os_memoryZero (pHandles->hOs, tPktCtrlBlk.aPktHdr, MAX_HEADER_SIZE);
+        fEapolNs = simBench_DataHdrBench (&tPktCtrlBlk, (TI_UINT8 *)&tEthHdr, TX_PKT_TYPE_EAPOL, &uEapolHdrLen);
+        os_memoryCopy (pHandles->hOs, aEapolHdr, tPktCtrlBlk.aPktHdr, MAX_HEADER_SIZE);
+        fDataNs  = simBench_DataHdrBench (&tPktCtrlBlk, (TI_UINT8 *)&tEthHdr, TX_PKT_TYPE_ETHER, &uHdrLen);
+        os_memoryCopy (pHandles->hOs, aDataHdr, tPktCtrlBlk.aPktHdr, MAX_HEADER_SIZE);
+
+        txCtrlParams_setCurrentPrivacyInvokedMode (pHandles->hTxCtrl, TI_TRUE);
+        txCtrlParams_setEncryptionFieldSizes (pHandles->hTxCtrl, AES_AFTER_HEADER_FIELD_SIZE);
+        bMatch   = (uHdrLen == uEapolHdrLen) && (memcmp (aEapolHdr, aDataHdr, uHdrLen) == 0);
+        fAesNs   = simBench_DataHdrBench (&tPktCtrlBlk, (TI_UINT8 *)&tEthHdr, TX_PKT_TYPE_ETHER, &uAesHdrLen);
+
+        printf ("  %-7s: template %6.1f, from scratch %6.1f, template+AES %6.1f (header %u/%u bytes, %s)\n", 
+                aModeStr[uMode], fDataNs, fEapolNs, fAesNs, uHdrLen, uAesHdrLen, 
+                bMatch ? "headers match" : "HEADERS MISMATCH");
+    }
+}
+
+
+/** 
+ * \fn     simBench_TraceRingRead / simBench_TraceRingRun
+ * \brief  Read the driver traces back from the trace ring (see -T)
+ * 
+ * The ring is mapped as the CU trace dump does (the header first, and then the whole buffer).
+ * First a few traces are written by the TRACE macro (so also through os_printf in the debug build),
+ *     and then more traces than the ring holds are written by os_Trace, each with more parameters
+ *     than a record keeps.
+ * Record k of each phase has the parameters k, k+1, ... and the direct traces use k as the line number,
+ *     so each record is compared to the trace that wrote it. The traces beyond the ring size must be
+ *     dropped and counted, and not overwrite the unread records.
+ * 
+ * \note   uLineNum 0 means the record index is the expected line number
+ * \return The number of records read (simBench_TraceRingRead) / TI_OK if all the records match (simBench_TraceRingRun)
+ * \sa     osTraceRing_Write, CuCmd_TraceRingDump
+ */ 
+static TI_UINT32 simBench_TraceRingRead (TTraceRingMapHdr *pMap, TI_UINT32 uLineNum, TI_UINT32 uParamsTotal, TI_UINT32 *pMismatches)
+{
+    TTraceRingHdr *pRing = TRACE_RING_HDR (pMap, 0);
+    TI_UINT32      uTail = pRing->uTail;
+    TI_UINT32      uHead = pRing->uHead;
+    TI_UINT32      uKept = (uParamsTotal > TRACE_RING_MAX_PARAMS) ? TRACE_RING_MAX_PARAMS : uParamsTotal;
+    TI_UINT32      k, i;
+
+    for (k = 0; uTail != uHead; k++, uTail++)
+    {
+        TTraceRingRec *pRec = TRACE_RING_REC (pRing, uTail, pMap->uRingRecs);
+        TI_BOOL        bMatch;
+
+        bMatch = (pRec->uSeq == uTail + 1) && (pRec->uFileId == __FILE_ID__) && 
+                 (pRec->uLineNum == (uLineNum ? uLineNum : k)) && (pRec->uLevel == REPORT_SEVERITY_INFORMATION) && 
+                 (pRec->uParamsNum == uKept) && (pRec->uParamsTotal == uParamsTotal);
+        for (i = 0; bMatch && (i < uKept); i++)
+        {
+            bMatch = (pRec->aParams[i] == k + i);
+        }
+        if (!bMatch)
+        {
+            (*pMismatches)++;
+        }
+    }
+
+    /* Free the read records to the driver */
+    pRing->uTail = uTail;
+
+    return k;
+}
+
+static TI_STATUS simBench_TraceRingRun (void)
+{
+    TStadHandlesList      *pHandles = &tSimBench.tStadHandles;
+    TReport               *pReport = (TReport *)pHandles->hReport;
+    struct vm_area_struct  tVma;
+    TTraceRingMapHdr      *pMap;
+    TI_UINT32              uMacroLine = 0;
+    TI_UINT32              uWritten, uRead, uMismatches = 0;
+    TI_UINT32              k;
+
+    if (pSimMiscDev == NULL)
+    {
+        printf ("Trace ring: the device is not registered\n");
+        return TI_NOK;
+    }
+
+    /* Map the header first, to learn the rings layout */
+    os_memoryZero (pHandles->hOs, &tVma, sizeof(tVma));
+    tVma.vm_end = sizeof(TTraceRingMapHdr);
+    if (pSimMiscDev->fops->mmap (NULL, &tVma) != 0)
+    {
+        printf ("Trace ring: mapping the header failed\n");
+        return TI_NOK;
+    }
+    pMap = (TTraceRingMapHdr *)tVma.pMapped;
+    if ((pMap->uMagic != TRACE_RING_MAGIC) || (pMap->uVersion != TRACE_RING_VERSION) || 
+        (pMap->uRecSize != sizeof(TTraceRingRec)) || (pMap->uRingRecs != TRACE_RING_RECS))
+    {
+        printf ("Trace ring: unknown format (magic 0x%x, version %u)\n", pMap->uMagic, pMap->uVersion);
+        return TI_NOK;
+    }
+
+    /* A mapping beyond the buffer is refused */
+    tVma.vm_end = PAGE_ALIGN (pMap->uTotalSize) + PAGE_SIZE;
+    if (pSimMiscDev->fops->mmap (NULL, &tVma) == 0)
+    {
+        printf ("Trace ring: a mapping beyond the buffer was accepted\n");
+        return TI_NOK;
+    }
+    tVma.vm_end = pMap->uTotalSize;
+    if (pSimMiscDev->fops->mmap (NULL, &tVma) != 0)
+    {
+        printf ("Trace ring: mapping the buffer failed\n");
+        return TI_NOK;
+    }
+    pMap = (TTraceRingMapHdr *)tVma.pMapped;
+
+    /* Only this file's traces are enabled, and only the ring is written by the simulation os_Trace */
+    ((TSimOs *)pHandles->hOs)->bTraceEnable = TI_FALSE;
+    pReport->aSeverityTable[REPORT_SEVERITY_INFORMATION] = 1;
+    pReport->aFileEnable[__FILE_ID__] = 1;
+
+    /* Traces through the TRACE macro */
+    for (k = 0; k < SIM_BENCH_TRACE_MACRO_RECS; k++)
+    {
+        uMacroLine = __LINE__ + 1;
+        TRACE3(pHandles->hReport, REPORT_SEVERITY_INFORMATION, "simBench_TraceRingRun: record %u (%u, %u)\n", k, k + 1, k + 2);
+    }
+    uWritten = SIM_BENCH_TRACE_MACRO_RECS;
+    uRead    = simBench_TraceRingRead (pMap, uMacroLine, 3, &uMismatches);
+    if (uRead != SIM_BENCH_TRACE_MACRO_RECS)
+    {
+        printf ("Trace ring: %u TRACE macro records read, expected %u\n", uRead, SIM_BENCH_TRACE_MACRO_RECS);
+        uMismatches++;
+    }
+
+    /* Direct traces, until the ring is full and beyond */
+    for (k = 0; k < TRACE_RING_RECS + SIM_BENCH_TRACE_DROPS; k++)
+    {
+        os_Trace (pHandles->hOs, REPORT_SEVERITY_INFORMATION, __FILE_ID__, k, SIM_BENCH_TRACE_PARAMS, 
+                  k, k + 1, k + 2, k + 3, k + 4, k + 5, k + 6, k + 7, k + 8, k + 9, k + 10, k + 11);
+    }
+    uWritten += k;
+    k = simBench_TraceRingRead (pMap, 0, SIM_BENCH_TRACE_PARAMS, &uMismatches);
+    uRead += k;
+    if ((k != TRACE_RING_RECS) || (TRACE_RING_HDR (pMap, 0)->uDrops != SIM_BENCH_TRACE_DROPS))
+    {
+        printf ("Trace ring: %u direct records read (expected %u), %u dropped (expected %u)\n", 
+                k, TRACE_RING_RECS, TRACE_RING_HDR (pMap, 0)->uDrops, SIM_BENCH_TRACE_DROPS);
+        uMismatches++;
+    }
+
+    printf ("Trace ring: %u ring(s) of %u records, written %u, read %u, dropped %u, mismatches %u\n", 
+            pMap->uNumRings, pMap->uRingRecs, uWritten, uRead, TRACE_RING_HDR (pMap, 0)->uDrops, uMismatches);
+
+    return (uMismatches == 0) ? TI_OK : TI_NOK;
+}
+
+
+static void simBench_PrintContextStats (TI_HANDLE hContext)
+{
+    TContextClientStats tStats;
+    TI_UINT32 uClientId = 0;
+
+    printf ("Context clients:  Name         Prio   Requests    Invokes  AvgRun(ns) MaxRun(us) AvgLat(ns) MaxLat(us)\n");
+    tStats.uClientId = uClientId;
+    while (context_GetClientStats (hContext, &tStats) == TI_OK)
+    {
+        printf ("                  %-12s %4u %10u %10u %11u %10u %10u %10u\n",
+                tStats.sName, tStats.uPriority, tStats.uRequests, tStats.uInvokes,
+                (tStats.uInvokes) ? (TI_UINT32)(tStats.uRunTimeUs * 1000 / tStats.uInvokes) : 0, tStats.uMaxRunTimeUs,
+                (tStats.uInvokes) ? (TI_UINT32)(tStats.uLatencyUs * 1000 / tStats.uInvokes) : 0, tStats.uMaxLatencyUs);
+        tStats.uClientId = ++uClientId;
+    }
+}
+
+
+static void simBench_Usage (const char *pName)
+{
+    printf ("Usage: %s [-t TxPkts] [-r RxPkts] [-l PktLen] [-b Burst] [-p UserPriority] [-a RxAggregLimit] [-n] [-m AmsduMsdus] [-c] [-k ClsfrType] [-d] [-f] [-i] [-e] [-q BusQueueDepth] [-s] [-w Timers] [-y TimerSlackMs] [-j] [-g] [-T] [-v]\n", pName);
+    printf ("  -t  Tx packets (default %d)\n", SIM_BENCH_DEF_TX_PKTS);
+    printf ("  -r  Rx packets (default %d)\n", SIM_BENCH_DEF_RX_PKTS);
+    printf ("  -l  Ethernet packet length in bytes (default %d)\n", SIM_BENCH_DEF_PKT_LEN);
+    printf ("  -b  Packets offered per main loop iteration (default %d)\n", SIM_BENCH_DEF_BURST);
+    printf ("  -p  Tx packets user priority (default 0)\n");
+    printf ("  -a  Rx aggregation packets limit (default %d, as the RxAggregationPktsLimit ini parameter)\n", TWD_RX_AGGREG_PKTS_LIMIT_DEF);
+    printf ("  -n  Disable the Rx buffers pool (allocate each Rx buffer in the Rx path)\n");
+    printf ("  -m  Rx MSDUs per A-MSDU (default 1 = no A-MSDU)\n");
+    printf ("  -c  Copy each A-MSDU MSDU to a new buffer (default: zero-copy, as the RxAmsduZeroCopy ini parameter)\n");
+    printf ("  -k  Tx classifier type: 0 D-Tag (default), 1 DSCP, 2 Port, 3 IP&Port (%d flows, half match an entry)\n", SIM_BENCH_CLSFR_FLOWS);
+    printf ("  -d  Delay the Tx-complete until the next loop iteration (default: immediate)\n");
+    printf ("  -f  Run the FW configuration sequence before the benchmark\n");
+    printf ("  -i  Pack consecutive configure commands to multi-IE commands (as the CmdMboxMultiIe ini parameter)\n");
+    printf ("  -e  Run the FW configuration sequence again as on recovery (with -f, as the RecoveryConfigJournal ini parameter)\n");
+    printf ("  -q  Bus transactions in flight, completed from the main loop (default 0 = synchronous bus, max %d)\n", TXN_MAX_TXNS_IN_FLIGHT);
+    printf ("  -s  Print the TxnQ latency histograms (debug build)\n");
+    printf ("  -w  Periodic timers run during the benchmark (default 0, max %d, intervals %d + 7 * i msec)\n", SIM_BENCH_MAX_TIMERS, SIM_BENCH_TIMER_BASE_MS);
+    printf ("  -y  The periodic timers slack in msec (default 0 = own OS timer each, else the timer wheel)\n");
+    printf ("  -j  Measure the TrafficMonitor per-packet cost with 0, 8 and 32 alerts instead (per packet and batched)\n");
+    printf ("  -g  Measure the data packets 802.11 header build cost instead (template vs. from scratch)\n");
+    printf ("  -T  Read the driver traces back from the trace ring instead (TRACE macro and os_Trace)\n");
+    printf ("  -v  Print all driver traces\n");
+}
+
+
+int main (int argc, char **argv)
+{
+    TStadHandlesList *pHandles = &tSimBench.tStadHandles;
+    TSimOs           *pOs;
+    TFwSimCfg         tFwCfg;
+    TFwSimStats       tFwStats;
+    TTimerStats       tTimerStats;
+    TI_BOOL           bVerbose = TI_FALSE;
+    TI_STATUS         eStatus;
+    double            fCpuStart, fCpuTime, fWallStart, fWallTime;
+    TI_UINT32         uPkts;
+    int               iOpt;
+
+    tSimBench.uNumTxPkts        = SIM_BENCH_DEF_TX_PKTS;
+    tSimBench.uNumRxPkts        = SIM_BENCH_DEF_RX_PKTS;
+    tSimBench.uPktLen           = SIM_BENCH_DEF_PKT_LEN;
+    tSimBench.uBurst            = SIM_BENCH_DEF_BURST;
+    tSimBench.bTxCmpltImmediate = TI_TRUE;
+    tSimBench.uRxAggregLimit    = TWD_RX_AGGREG_PKTS_LIMIT_DEF;
+    tSimBench.bRxBufPool        = TI_TRUE;
+    tSimBench.uRxAmsduMsdus     = 1;
+    tSimBench.bAmsduZeroCopy    = RX_DATA_AMSDU_ZERO_COPY_DEF;
+
+    while ((iOpt = getopt (argc, argv, "t:r:l:b:p:a:nm:ck:dfieq:sw:y:jgTvh")) != -1)
+    {
+        switch (iOpt)
+        {
+        case 't': tSimBench.uNumTxPkts = strtoul (optarg, NULL, 0);             break;
+        case 'r': tSimBench.uNumRxPkts = strtoul (optarg, NULL, 0);             break;
+        case 'l': tSimBench.uPktLen    = strtoul (optarg, NULL, 0);             break;
+        case 'b': tSimBench.uBurst     = strtoul (optarg, NULL, 0);             break;
+        case 'p': tSimBench.uTxDtag    = (TI_UINT8)strtoul (optarg, NULL, 0);   break;
+        case 'a': tSimBench.uRxAggregLimit = strtoul (optarg, NULL, 0);         break;
+        case 'n': tSimBench.bRxBufPool = TI_FALSE;                              break;
+        case 'm': tSimBench.uRxAmsduMsdus = strtoul (optarg, NULL, 0);          break;
+        case 'c': tSimBench.bAmsduZeroCopy = TI_FALSE;                          break;
+        case 'k': tSimBench.eClsfrType = (EClsfrType)strtoul (optarg, NULL, 0); break;
+        case 'd': tSimBench.bTxCmpltImmediate = TI_FALSE;                       break;
+        case 'f': tSimBench.bConfigFw = TI_TRUE;                                break;
+        case 'i': tSimBench.bCmdMboxMultiIe = TI_TRUE;                          break;
+        case 'e': tSimBench.bRecoveryConfig = TI_TRUE;                          break;
+        case 'q': tSimBench.uBusQueueDepth = strtoul (optarg, NULL, 0);         break;
+        case 's': tSimBench.bPrintTxnQ = TI_TRUE;                               break;
+        case 'w': tSimBench.uNumTimers = strtoul (optarg, NULL, 0);             break;
+        case 'y': tSimBench.uTimerSlackMs = strtoul (optarg, NULL, 0);          break;
+        case 'j': tSimBench.bTrafficMonBench = TI_TRUE;                         break;
+        case 'g': tSimBench.bDataHdrBench = TI_TRUE;                            break;
+        case 'T': tSimBench.bTraceRingCheck = TI_TRUE;                          break;
+        case 'v': bVerbose = TI_TRUE;                                           break;
+        default:
+            simBench_Usage (argv[0]);
+            return 1;
+        }
+    }
+    if ((tSimBench.uPktLen <= ETHERNET_HDR_LEN) || (tSimBench.uPktLen > SIM_BENCH_MAX_PKT_LEN) || 
+        (tSimBench.uBurst == 0) || (tSimBench.uTxDtag >= MAX_NUM_OF_802_1d_TAGS) ||
+        (tSimBench.uRxAggregLimit > TWD_RX_AGGREG_PKTS_LIMIT_MAX) || (tSimBench.uRxAmsduMsdus == 0) ||
+        (tSimBench.eClsfrType > CLSFR_MAX_TYPE) || (tSimBench.bRecoveryConfig && !tSimBench.bConfigFw) ||
+        (tSimBench.uBusQueueDepth > TXN_MAX_TXNS_IN_FLIGHT) || (tSimBench.uNumTimers > SIM_BENCH_MAX_TIMERS) ||
+        ((tSimBench.eClsfrType != D_TAG_CLSFR) && (tSimBench.uPktLen < SIM_BENCH_CLSFR_HDRS_LEN)) ||
+        (tSimBench.uRxAmsduMsdus * ((tSimBench.uPktLen + WLAN_SNAP_HDR_LEN + 3) & ~3) > SIM_BENCH_MAX_AMSDU_LEN))
+    {
+        simBench_Usage (argv[0]);
+        return 1;
+    }
+
+    pHandles->hOs = simOs_Create ();
+    if (pHandles->hOs == NULL)
+    {
+        return 1;
+    }
+    pOs = (TSimOs *)pHandles->hOs;
+    pOs->bTraceEnable = TI_TRUE;
+
+    /* As in wlanDrvIf_Create, the trace rings are not mandatory, so a failure is only reported */
+    osTraceRing_Init ();
+
+    tFwCfg.uNumTxBlocks      = FW_SIM_DEF_NUM_TX_BLOCKS;
+    tFwCfg.uRxPendingMax     = FW_SIM_DEF_RX_PENDING_MAX;
+    tFwCfg.bTxCmpltImmediate = tSimBench.bTxCmpltImmediate;
+
+    if ((simBench_InitTwd (&tFwCfg) != TI_OK) || (simBench_InitDataPath () != TI_OK))
+    {
+        printf ("Driver initialization failed\n");
+        return 1;
+    }
+    if (bVerbose)
+    {
+        os_memorySet (pHandles->hOs, ((TReport *)pHandles->hReport)->aSeverityTable, 1, REPORT_SEVERITY_MAX);
+    }
+
+    if (tSimBench.bTrafficMonBench)
+    {
+        simBench_TrafficMonRun ();
+        return 0;
+    }
+
+    if (tSimBench.bDataHdrBench)
+    {
+        simBench_DataHdrRun ();
+        return 0;
+    }
+
+    if (tSimBench.bTraceRingCheck)
+    {
+        eStatus = simBench_TraceRingRun ();
+        osTraceRing_Destroy ();
+        return (eStatus == TI_OK) ? 0 : 1;
+    }
+
+    simBench_BuildRxFrame ();
+
+    printf ("Running: Tx=%u Rx=%u PktLen=%u Burst=%u UP=%u TxCmplt=%s\n", 
+            tSimBench.uNumTxPkts, tSimBench.uNumRxPkts, tSimBench.uPktLen, tSimBench.uBurst, 
+            tSimBench.uTxDtag, tSimBench.bTxCmpltImmediate ? "immediate" : "delayed");
+
+    simBench_StartTimers ();
+    fCpuStart  = simBench_TimeSec (CLOCK_PROCESS_CPUTIME_ID);
+    fWallStart = simBench_TimeSec (CLOCK_MONOTONIC);
+    eStatus = simBench_Run ();
+    fCpuTime   = simBench_TimeSec (CLOCK_PROCESS_CPUTIME_ID) - fCpuStart;
+    fWallTime  = simBench_TimeSec (CLOCK_MONOTONIC) - fWallStart;
+    tmr_GetStats (pHandles->hTimer, &tTimerStats);
+    simBench_StopTimers ();
+
+    fwSim_GetStats (&tFwStats);
+    uPkts = tSimBench.uTxFreed + pOs->uRxPkts;
+
+    printf ("\n");
+    if (eStatus != TI_OK)
+    {
+        printf ("*** Driver stalled! ***\n");
+    }
+    printf ("Time:      CPU %.3f sec, wall %.3f sec, %.0f pkts/sec\n", 
+            fCpuTime, fWallTime, uPkts ? (double)uPkts / fCpuTime : 0.0);
+    printf ("Per pkt:   %.0f nsec CPU, %.2f driver tasks, %.2f interrupts\n", 
+            uPkts ? fCpuTime * 1e9 / uPkts : 0.0, 
+            uPkts ? (double)tSimBench.uDriverTasks / uPkts : 0.0,
+            uPkts ? (double)tFwStats.uInterrupts / uPkts : 0.0);
+    printf ("Tx:        sent %u, completed %u, failed %u, no-CtrlBlk %u, net-stack stops %u\n", 
+            tSimBench.uTxSent, tSimBench.uTxFreed, tSimBench.uTxFailed, tSimBench.uTxNoCtrlBlk, tSimBench.uTxStops);
+    printf ("Tx latency: avg %.1f usec, max %u usec\n", 
+            tSimBench.uTxFreed ? (double)tSimBench.uTxLatencySumUs / tSimBench.uTxFreed : 0.0, 
+            tSimBench.uTxLatencyMaxUs);
+    printf ("Tx FW:     pkts %u, bytes %u, xfers %u (%.2f pkts/xfer), results %u, results held %u\n", 
+            tFwStats.uTxPkts, tFwStats.uTxBytes, tFwStats.uTxXfers, 
+            tFwStats.uTxXfers ? (double)tFwStats.uTxPkts / tFwStats.uTxXfers : 0.0,
+            tFwStats.uTxResults, tFwStats.uTxResultsHeld);
+    printf ("Rx:        injected %u, delivered %u, FIFO full %u\n", 
+            tSimBench.uRxSent, pOs->uRxPkts, tFwStats.uRxRejected);
+    printf ("Rx FW:     bytes %u, xfers %u (%.2f pkts/xfer)\n", 
+            tFwStats.uRxBytes, tFwStats.uRxXfers, 
+            tFwStats.uRxXfers ? (double)tFwStats.uRxPkts / tFwStats.uRxXfers : 0.0);
+    if (tSimBench.eClsfrType != D_TAG_CLSFR)
+    {
+        TTxDataQ *pTxDataQ = (TTxDataQ *)pHandles->hTxDataQ;
+
+        printf ("Tx clsfr:  flow cache hits %u, misses %u, mismatches %u\n", 
+                pTxDataQ->tClsfrLookup.uFlowCacheHits, pTxDataQ->tClsfrLookup.uFlowCacheMisses, 
+                pTxDataQ->uClsfrMismatchCount);
+    }
+    if (tSimBench.uRxAmsduMsdus > 1)
+    {
+        rxData_t *pRxData = (rxData_t *)pHandles->hRxData;
+
+        printf ("Rx A-MSDU: MSDU bytes copied %u, referenced in place %u\n", 
+                pRxData->rxDataDbgCounters.uAmsduBytesCopied, pRxData->rxDataDbgCounters.uAmsduBytesReferenced);
+    }
+    printf ("FW:        status reads %u, interrupts %u, commands %u, ELP wakeups %u, errors %u\n", 
+            tFwStats.uFwStatusReads, tFwStats.uInterrupts, tFwStats.uCmds, tFwStats.uElpWakeups, tFwStats.uErrors);
+    printf ("OS:        allocations %u, allocation failures %u, timer expiries %u\n", 
+            pOs->uMemAllocs, pOs->uMemAllocFails, pOs->uTimerExpiries);
+    if (tSimBench.uNumTimers)
+    {
+        printf ("Timers:    %u periodic, slack %u msec: expiries %u, max delay %u msec\n", 
+                tSimBench.uNumTimers, tSimBench.uTimerSlackMs, tSimBench.uTimerExpiries, tSimBench.uTimerMaxDelayMs);
+        printf ("           OS timer wakeups %u (own %u, wheel %u), %u/sec, wheel expiries %u (coalesced %u)\n", 
+                tTimerStats.uOsTimerWakeups + tTimerStats.uWheelWakeups, tTimerStats.uOsTimerWakeups, 
+                tTimerStats.uWheelWakeups, tTimerStats.uWakeupsPerSec, tTimerStats.uWheelExpiries, 
+                tTimerStats.uCoalescedExpiries);
+    }
+    RxBufPoolPrintStats (pOs);
+    simBench_PrintContextStats (pHandles->hContext);
+#ifdef TI_DBG
+    if (tSimBench.bPrintTxnQ)
+    {
+        txnQ_PrintQueues (pHandles->hTxnQ);
+    }
+#endif
+
+    return (eStatus == TI_OK && tFwStats.uErrors == 0) ? 0 : 1;
+}
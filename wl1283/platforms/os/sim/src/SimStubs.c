@@ -0,0 +1,183 @@
+/*
+ * SimStubs.c
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+ 
+/** \file   SimStubs.c 
+ *  \brief  Host simulation stubs of the STAD modules outside the benchmarked data path.
+ *
+ *  The host simulation links only the TWD and the STAD data path (TxDataQ, TxCtrl, RxData),
+ *      so the control modules they call are replaced here by minimal stand-ins.
+ *  The station is assumed connected to an infrastructure BSS with no QoS and no security.
+ *
+ *  \see    SimBench.c
+ */
+
+#include "tidef.h"
+#include "osApi.h"
+#include "paramOut.h"
+#include "RxBuf.h"
+#include "EvHandler.h"
+#include "DataCtrl_Api.h"
+#include "txMgmtQueue_Api.h"
+#include "siteMgrApi.h"
+#include "PowerMgr_API.h"
+#include "rsnApi.h"
+#include "qosMngr_API.h"
+#include "mlmeApi.h"
+#include "txCtrl.h"
+#include "SimOs.h"
+
+
+/* The simulated station and AP addresses (see SimBench.c) */
+TMacAddr tSimStaMac   = {0x08, 0x00, 0x28, 0x12, 0x34, 0x56};
+TMacAddr tSimBssid    = {0x00, 0x12, 0x34, 0x56, 0x78, 0x9A};
+
+/* The TID used per AC in QoS-Manager */
+const TI_UINT8 WMEQosAcToTid[MAX_NUM_OF_AC] = { 0, 2, 4, 6 };
+
+
+/************************************************************************
+ *                        Events Handler                                *
+ ************************************************************************/
+TI_UINT32 EvHandlerSendEvent (TI_HANDLE hEvHandler, TI_UINT32 EvType, TI_UINT8* pData, TI_UINT32 Length)
+{
+    return TI_OK;
+}
+
+
+/************************************************************************
+ *                        Ctrl-Data                                     *
+ ************************************************************************/
+TI_STATUS ctrlData_getParamMacAddr (TI_HANDLE hCtrlData, TMacAddr macAddr)
+{
+    MAC_COPY (macAddr, tSimStaMac);
+    return TI_OK;
+}
+
+TI_STATUS ctrlData_getParamBssid (TI_HANDLE hCtrlData, EInternalParam paramVal, TMacAddr bssid)
+{
+    MAC_COPY (bssid, tSimBssid);
+    return TI_OK;
+}
+
+void ctrlData_getCurrBssTypeAndCurrBssId (TI_HANDLE hCtrlData, TMacAddr *pCurrBssid, ScanBssType_e *pCurrBssType)
+{
+    MAC_COPY (*pCurrBssid, tSimBssid);
+    *pCurrBssType = BSS_INFRASTRUCTURE;
+}
+
+
+/************************************************************************
+ *                        Tx Mgmt-Queue                                 *
+ ************************************************************************/
+/* Management and EAPOL packets are not part of the benchmark, so they are just released */
+TI_STATUS txMgmtQ_Xmit (TI_HANDLE hTxMgmtQ, TTxCtrlBlk *pPktCtrlBlk, TI_BOOL bExternalContext)
+{
+    return TI_NOK;
+}
+
+void txMgmtQ_StopQueue (TI_HANDLE hTxMgmtQ, TI_UINT32 tidBitMap)
+{
+}
+
+void txMgmtQ_UpdateBusyMap (TI_HANDLE hTxMgmtQ, TI_UINT32 tidBitMap)
+{
+}
+
+ETxConnState txMgmtQ_GetConnState (TI_HANDLE hTxMgmtQ)
+{
+    return TX_CONN_STATE_OPEN;
+}
+
+
+/************************************************************************
+ *                        Site-Manager, Power-Manager, RSN, QoS, MLME   *
+ ************************************************************************/
+TI_STATUS siteMgr_getParam (TI_HANDLE hSiteMgr, paramInfo_t *pParam)
+{
+    switch (pParam->paramType)
+    {
+    case SITE_MGR_CURRENT_BSS_TYPE_PARAM:
+        pParam->content.siteMgrCurrentBSSType = BSS_INFRASTRUCTURE;
+        break;
+
+    case SITE_MGR_CURRENT_TSF_TIME_STAMP:
+        os_memoryZero (NULL, pParam->content.siteMgrCurrentTsfTimeStamp, TIME_STAMP_LEN);
+        break;
+
+    default:
+        return PARAM_NOT_SUPPORTED;
+    }
+
+    return TI_OK;
+}
+
+TI_STATUS powerMgr_setParam (TI_HANDLE thePowerMgrHandle, paramInfo_t *theParamP)
+{
+    return TI_OK;
+}
+
+TI_BOOL PowerMgr_getReAuthActivePriority (TI_HANDLE thePowerMgrHandle)
+{
+    return TI_FALSE;
+}
+
+TI_STATUS rsn_reportMicFailure (TI_HANDLE hRsn, TI_UINT8 *pType, TI_UINT32 Length)
+{
+    return TI_OK;
+}
+
+TI_STATUS qosMngr_getParamsActiveProtocol (TI_HANDLE hQosMngr, EQosProtocol *actProt)
+{
+    *actProt = QOS_NONE;
+    return TI_OK;
+}
+
+TI_STATUS qosMngr_MediumTimeDowngrade (TI_HANDLE hQosMngr, TI_UINT32 fromAcId, TI_UINT32 toAcId, TI_UINT32 duration)
+{
+    return TI_OK;
+}
+
+/* Management frames are not part of the benchmark, so they are just released */
+TI_STATUS mlmeParser_recv (TI_HANDLE hMlme, void *pBuffer, TRxAttr* pRxAttr)
+{
+    RxBufFree (NULL, pBuffer);
+    return TI_OK;
+}
+
+
+/************************************************************************
+ *                        Kernel (see SimKernel.h)                     *
+ ************************************************************************/
+/* The trace ring device, registered by osTraceRing_Init and mapped by the benchmark */
+struct miscdevice *pSimMiscDev = NULL;
@@ -0,0 +1,558 @@
+/*
+ * osapi.c
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+ 
+/** \file   osapi.c 
+ *  \brief  Host simulation OS layer implementation (user space, single threaded).
+ *
+ *  The driver context, interrupt and timer services are run from the host simulation main 
+ *      loop (see SimBench.c), so no locking is needed.
+ *  All memory is allocated from a low memory arena, since the driver keeps some host 
+ *      addresses in 32 bit variables.
+ *
+ *  \see    osApi.h, SimOs.h
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "tidef.h"
+#include "osApi.h"
+#include "report.h"
+#include "osTraceRing.h"
+#include "SimOs.h"
+#include "FwSim.h"
+#include "RxBuf.h"
+
+
+/************************************************************************
+ * Defines
+ ************************************************************************/
+#define SIM_MEM_MIN_CLASS_SHIFT     5       /* Smallest allocation class: 32 bytes */
+#define SIM_MEM_NUM_CLASSES         22      /* Largest allocation class: 64 MB */
+#define SIM_MEM_HDR_SIZE            16      /* Keeps the user buffers 16 bytes aligned */
+
+
+/************************************************************************
+ * Types
+ ************************************************************************/
+/* Header of an allocated block (free blocks are kept per size class) */
+typedef struct _TSimMemHdr
+{
+    struct _TSimMemHdr *pNext;          /* Next free block of the same class (valid only when free) */
+    TI_UINT32           uClass;
+} TSimMemHdr;
+
+typedef struct
+{
+    TI_UINT8       *pBase;
+    TI_UINT32       uUsed;              /* Bytes carved from the arena */
+    TSimMemHdr     *aFreeList[SIM_MEM_NUM_CLASSES];
+} TSimMem;
+
+
+static TSimMem tSimMem;
+static TI_UINT32 uSimProtectDummy;
+
+
+
+/************************************************************************
+ *
+ *   Host simulation services
+ *
+ ************************************************************************/
+
+/** 
+ * \fn     simOs_Create 
+ * \brief  Create the OS object
+ * 
+ * Map the memory arena and allocate the OS object from it.
+ * 
+ * \note   
+ * \return The OS handle, NULL if failed
+ * \sa     
+ */ 
+TI_HANDLE simOs_Create (void)
+{
+    TSimOs *pOs;
+
+    tSimMem.pBase = mmap (NULL, SIM_OS_ARENA_SIZE, PROT_READ | PROT_WRITE, 
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT | MAP_NORESERVE, -1, 0);
+    if (tSimMem.pBase == MAP_FAILED)
+    {
+        perror ("simOs_Create: mmap");
+        return NULL;
+    }
+
+    pOs = (TSimOs *)os_memoryCAlloc (NULL, 1, sizeof(TSimOs));
+
+    return (TI_HANDLE)pOs;
+}
+
+
+/** 
+ * \fn     simOs_RunTimers 
+ * \brief  Call the expired timers callbacks
+ * 
+ * \note   Called from the main loop (replaces the OS timer interrupt)
+ * \param  hOs - The OS handle
+ * \return void
+ * \sa     
+ */ 
+void simOs_RunTimers (TI_HANDLE hOs)
+{
+    TSimOs    *pOs = (TSimOs *)hOs;
+    TI_UINT32  uNow = os_timeStampMs (hOs);
+    TI_UINT32  i;
+
+    for (i = 0; i < pOs->uNumTimers; i++)
+    {
+        TSimTimer *pTimer = &pOs->aTimers[i];
+
+        if (pTimer->bActive && (TI_INT32)(uNow - pTimer->uExpiryMs) >= 0)
+        {
+            pTimer->bActive = TI_FALSE;
+            pOs->uTimerExpiries++;
+            pTimer->fRoutine (pTimer->hFuncHandle);
+        }
+    }
+}
+
+
+/** 
+ * \fn     simOs_TaskPending 
+ * \brief  Check and clear the driver task request
+ * 
+ * \note   
+ * \param  hOs - The OS handle
+ * \return TRUE if the driver task was requested since last call
+ * \sa     os_RequestSchedule
+ */ 
+TI_BOOL simOs_TaskPending (TI_HANDLE hOs)
+{
+    TSimOs  *pOs = (TSimOs *)hOs;
+    TI_BOOL  bPending = pOs->bTaskPending;
+
+    pOs->bTaskPending = TI_FALSE;
+
+    return bPending;
+}
+
+
+
+/************************************************************************
+ *
+ *   OS API implementation (see osApi.h)
+ *
+ ************************************************************************/
+
+void os_disableIrq (TI_HANDLE OsContext)
+{
+}
+
+void os_enableIrq (TI_HANDLE OsContext)
+{
+}
+
+/* The FW-Event handling is done, so the IRQ may be signaled again */
+void os_InterruptServiced (TI_HANDLE OsContext)
+{
+    fwSim_InterruptServiced ();
+}
+
+void os_setDebugMode (TI_BOOL enable)
+{
+}
+
+void os_setDebugOutputToLogger (TI_BOOL value)
+{
+}
+
+void os_printf (const char *format ,...)
+{
+    va_list ap;
+
+    va_start (ap, format);
+    vprintf (format, ap);
+    va_end (ap);
+}
+
+
+/*--------------------------------------------------------------------------------------*/
+/* Memory services - a size classes allocator over the low memory arena */
+
+void *os_memoryAlloc (TI_HANDLE OsContext, TI_UINT32 Size)
+{
+    TSimOs     *pOs = (TSimOs *)OsContext;
+    TSimMemHdr *pHdr;
+    TI_UINT32   uClass = 0;
+    TI_UINT32   uBlkSize;
+
+    while (((TI_UINT32)1 << (uClass + SIM_MEM_MIN_CLASS_SHIFT)) < Size + SIM_MEM_HDR_SIZE)
+    {
+        uClass++;
+    }
+    uBlkSize = (TI_UINT32)1 << (uClass + SIM_MEM_MIN_CLASS_SHIFT);
+
+    if (uClass >= SIM_MEM_NUM_CLASSES)
+    {
+        pHdr = NULL;
+    }
+    else if (tSimMem.aFreeList[uClass])
+    {
+        pHdr = tSimMem.aFreeList[uClass];
+        tSimMem.aFreeList[uClass] = pHdr->pNext;
+    }
+    else if (tSimMem.uUsed + uBlkSize <= SIM_OS_ARENA_SIZE)
+    {
+        pHdr = (TSimMemHdr *)(tSimMem.pBase + tSimMem.uUsed);
+        tSimMem.uUsed += uBlkSize;
+    }
+    else
+    {
+        pHdr = NULL;
+    }
+
+    if (pHdr == NULL)
+    {
+        if (pOs)
+        {
+            pOs->uMemAllocFails++;
+        }
+        return NULL;
+    }
+
+    pHdr->uClass = uClass;
+    if (pOs)
+    {
+        pOs->uMemAllocs++;
+    }
+
+    return (TI_UINT8 *)pHdr + SIM_MEM_HDR_SIZE;
+}
+
+void *os_memoryCAlloc (TI_HANDLE OsContext, TI_UINT32 Number, TI_UINT32 Size)
+{
+    void *pMem = os_memoryAlloc (OsContext, Number * Size);
+
+    if (pMem)
+    {
+        memset (pMem, 0, Number * Size);
+    }
+    return pMem;
+}
+
+void *os_memoryAlloc4HwDma (TI_HANDLE pOsContext, TI_UINT32 Size)
+{
+    return os_memoryAlloc (pOsContext, Size);
+}
+
+void os_memoryFree (TI_HANDLE OsContext, void *pMemPtr, TI_UINT32 Size)
+{
+    TSimOs     *pOs  = (TSimOs *)OsContext;
+    TSimMemHdr *pHdr = (TSimMemHdr *)((TI_UINT8 *)pMemPtr - SIM_MEM_HDR_SIZE);
+
+    if (pMemPtr == NULL)
+    {
+        return;
+    }
+
+    pHdr->pNext = tSimMem.aFreeList[pHdr->uClass];
+    tSimMem.aFreeList[pHdr->uClass] = pHdr;
+    if (pOs)
+    {
+        pOs->uMemAllocs--;
+    }
+}
+
+void os_memorySet (TI_HANDLE OsContext, void *pMemPtr, TI_INT32 Value, TI_UINT32 Length)
+{
+    memset (pMemPtr, Value, Length);
+}
+
+void os_memoryZero (TI_HANDLE OsContext, void *pMemPtr, TI_UINT32 Length)
+{
+    memset (pMemPtr, 0, Length);
+}
+
+void os_memoryCopy (TI_HANDLE OsContext, void *pDestination, void *pSource, TI_UINT32 Size)
+{
+    memcpy (pDestination, pSource, Size);
+}
+
+TI_INT32 os_memoryCompare (TI_HANDLE OsContext, TI_UINT8* Buf1, TI_UINT8* Buf2, TI_INT32 Count)
+{
+    return memcmp (Buf1, Buf2, Count);
+}
+
+int os_memoryCopyFromUser (TI_HANDLE OsContext, void *pDstPtr, void *pSrcPtr, TI_UINT32 Size)
+{
+    memcpy (pDstPtr, pSrcPtr, Size);
+    return 0;
+}
+
+int os_memoryCopyToUser (TI_HANDLE OsContext, void *pDstPtr, void *pSrcPtr, TI_UINT32 Size)
+{
+    memcpy (pDstPtr, pSrcPtr, Size);
+    return 0;
+}
+
+
+/*--------------------------------------------------------------------------------------*/
+/* Timer services - expired timers are called from the main loop (simOs_RunTimers) */
+
+TI_HANDLE os_timerCreate (TI_HANDLE OsContext, fTimerFunction pRoutine, TI_HANDLE hFuncHandle)
+{
+    TSimOs    *pOs = (TSimOs *)OsContext;
+    TI_UINT32  i;
+
+    for (i = 0; i < SIM_OS_MAX_TIMERS; i++)
+    {
+        TSimTimer *pTimer = &pOs->aTimers[i];
+
+        if (!pTimer->bInUse)
+        {
+            pTimer->bInUse      = TI_TRUE;
+            pTimer->bActive     = TI_FALSE;
+            pTimer->fRoutine    = pRoutine;
+            pTimer->hFuncHandle = hFuncHandle;
+            if (i >= pOs->uNumTimers)
+            {
+                pOs->uNumTimers = i + 1;
+            }
+            return (TI_HANDLE)pTimer;
+        }
+    }
+
+    return NULL;
+}
+
+void os_timerDestroy (TI_HANDLE OsContext, TI_HANDLE TimerHandle)
+{
+    TSimTimer *pTimer = (TSimTimer *)TimerHandle;
+
+    pTimer->bActive = TI_FALSE;
+    pTimer->bInUse  = TI_FALSE;
+}
+
+void os_timerStart (TI_HANDLE OsContext, TI_HANDLE TimerHandle, TI_UINT32 DelayMs)
+{
+    TSimTimer *pTimer = (TSimTimer *)TimerHandle;
+
+    pTimer->uExpiryMs = os_timeStampMs (OsContext) + DelayMs;
+    pTimer->bActive   = TI_TRUE;
+}
+
+void os_timerStop (TI_HANDLE OsContext, TI_HANDLE TimerHandle)
+{
+    TSimTimer *pTimer = (TSimTimer *)TimerHandle;
+
+    pTimer->bActive = TI_FALSE;
+}
+
+void os_periodicIntrTimerStart (TI_HANDLE OsContext)
+{
+}
+
+TI_UINT32 os_timeStampMs (TI_HANDLE OsContext)
+{
+    struct timespec tTime;
+
+    clock_gettime (CLOCK_MONOTONIC, &tTime);
+    return (TI_UINT32)(tTime.tv_sec * 1000 + tTime.tv_nsec / 1000000);
+}
+
+TI_UINT32 os_timeStampUs (TI_HANDLE OsContext)
+{
+    struct timespec tTime;
+
+    clock_gettime (CLOCK_MONOTONIC, &tTime);
+    return (TI_UINT32)(tTime.tv_sec * 1000000 + tTime.tv_nsec / 1000);
+}
+
+void os_StalluSec (TI_HANDLE OsContext, TI_UINT32 uSec)
+{
+    struct timespec tTime;
+
+    tTime.tv_sec  = uSec / 1000000;
+    tTime.tv_nsec = (uSec % 1000000) * 1000;
+    nanosleep (&tTime, NULL);
+}
+
+
+/*--------------------------------------------------------------------------------------*/
+/* Protection services - single threaded, so nothing to protect */
+
+TI_HANDLE os_protectCreate (TI_HANDLE OsContext)
+{
+    return (TI_HANDLE)&uSimProtectDummy;
+}
+
+void os_protectDestroy (TI_HANDLE OsContext, TI_HANDLE ProtectContext)
+{
+}
+
+void os_protectLock (TI_HANDLE OsContext, TI_HANDLE ProtectContext)
+{
+}
+
+void os_protectUnlock (TI_HANDLE OsContext, TI_HANDLE ProtectContext)
+{
+}
+
+void os_atomicSetBits (TI_HANDLE OsContext, TI_UINT32 *pBitmap, TI_UINT32 uBits)
+{
+    __sync_fetch_and_or (pBitmap, uBits);
+}
+
+void os_atomicClearBits (TI_HANDLE OsContext, TI_UINT32 *pBitmap, TI_UINT32 uBits)
+{
+    __sync_fetch_and_and (pBitmap, ~uBits);
+}
+
+int os_wake_lock (TI_HANDLE OsContext)
+{
+    return 0;
+}
+
+int os_wake_unlock (TI_HANDLE OsContext)
+{
+    return 0;
+}
+
+int os_wake_lock_timeout (TI_HANDLE OsContext)
+{
+    return 0;
+}
+
+int os_wake_lock_timeout_enable (TI_HANDLE OsContext)
+{
+    return 0;
+}
+
+void *os_SignalObjectCreate (TI_HANDLE OsContext)
+{
+    return os_memoryCAlloc (OsContext, 1, sizeof(TI_UINT32));
+}
+
+int os_SignalObjectWait (TI_HANDLE OsContext, void *ptr)
+{
+    return TI_OK;
+}
+
+int os_SignalObjectSet (TI_HANDLE OsContext, void *ptr)
+{
+    return TI_OK;
+}
+
+int os_SignalObjectFree (TI_HANDLE OsContext, void *ptr)
+{
+    os_memoryFree (OsContext, ptr, sizeof(TI_UINT32));
+    return TI_OK;
+}
+
+
+/*--------------------------------------------------------------------------------------*/
+/* Driver context services */
+
+/* The driver task is always run from the main loop (never directly in the caller context) */
+int os_RequestSchedule (TI_HANDLE OsContext, TI_BOOL *pContextSwitchRequired)
+{
+    TSimOs *pOs = (TSimOs *)OsContext;
+
+    pOs->bTaskPending = TI_TRUE;
+    *pContextSwitchRequired = TI_TRUE;
+
+    return TI_OK;
+}
+
+void os_SetDrvThreadPriority (TI_HANDLE OsContext, TI_UINT32 uWlanDrvThreadPriority)
+{
+}
+
+
+/*--------------------------------------------------------------------------------------*/
+/* Network stack and user interface */
+
+/* The network stack consumes the packet right away */
+TI_BOOL os_receivePacket (TI_HANDLE OsContext, void *pRxDesc ,void *pPacket, TI_UINT16 Length)
+{
+    TSimOs *pOs = (TSimOs *)OsContext;
+
+    pOs->uRxPkts++;
+    pOs->uRxBytes += Length;
+
+    simOs_RxBufConsume (OsContext, pPacket);
+
+    return TI_TRUE;
+}
+
+TI_INT32 os_IndicateEvent (TI_HANDLE OsContext, IPC_EV_DATA *pData)
+{
+    return TI_OK;
+}
+
+void os_Trace (TI_HANDLE OsContext, TI_UINT32 uLevel, TI_UINT32 uFileId, TI_UINT32 uLineNum, TI_UINT32 uParamsNum, ...)
+{
+    TSimOs     *pOs = (TSimOs *)OsContext;
+    TI_UINT32   i;
+    va_list     list;
+
+    /* As on the target, every trace is written to the trace ring (see osTraceRing.c) */
+    va_start (list, uParamsNum);
+    osTraceRing_Write (uLevel, uFileId, uLineNum, uParamsNum, list);
+    va_end (list);
+
+#ifdef PRINTF_ROLLBACK
+    /* The message text was already printed by the TRACE macro (see report.h) */
+    return;
+#endif
+
+    if (pOs == NULL || !pOs->bTraceEnable)
+    {
+        return;
+    }
+
+    printf ("TRACE: level=%u file=%u line=%u", uLevel, uFileId, uLineNum);
+    va_start (list, uParamsNum);
+    for (i = 0; i < uParamsNum; i++)
+    {
+        printf (" 0x%x", va_arg (list, TI_UINT32));
+    }
+    va_end (list);
+    printf ("\n");
+}
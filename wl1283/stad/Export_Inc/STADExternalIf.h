@@ -70,6 +70,8 @@
 
 #define TX_RETRY_HISTOGRAM_SIZE 			16
 
+#define TX_LATENCY_HIST_BUCKETS             21  /* log2 usec buckets: [2^i, 2^(i+1)), the last one is open ended */
+
 #define RX_DATA_FILTER_MAX_MASK_SIZE        8
 #define RX_DATA_FILTER_MAX_PATTERN_SIZE     64
 
@@ -111,6 +113,25 @@ typedef enum
     TX_DELAY_RANGES_NUM       = 9		/**< */
 } TxDelayRanges_e;
 
+/** \enum ETxLatencySegment
+ * \brief TX Latency Segments
+ * 
+ * \par Description
+ * The parts of the Tx path that are measured by the Tx latency histograms 
+ * Used as indexes in the Tx latency histograms table 
+ * 
+ * \sa TTxLatencyHist
+ */
+typedef enum
+{
+    TX_LATENCY_HOST           = 0,		/**< Host queueing - from the driver Xmit until the transfer to the FW (msec granularity) */
+    TX_LATENCY_FW_QUEUE       = 1,		/**< FW queueing - from the transfer to the FW until the first medium access (AIFS) */
+    TX_LATENCY_MEDIUM         = 2,		/**< Medium time - from the first medium access until Tx complete, including retries */
+    TX_LATENCY_TOTAL          = 3,		/**< End to end - from the driver Xmit until Tx complete */
+
+    TX_LATENCY_SEGMENTS_NUM   = 4		/**< */
+} ETxLatencySegment;
+
 /** \enum TIWLN_SIMPLE_CONFIG_MODE
  * \brief TI WLAN Simple Configuration Mode
  * 
@@ -193,6 +214,36 @@ typedef struct
     TTxDataCounters  txCounters[MAX_NUM_OF_AC];	/**< Table which holds Tx statistics of each Tx-queue */
 } TIWLN_TX_STATISTICS;
 
+/** \struct TTxLatencyHist
+ * \brief TX Latency Histogram
+ * 
+ * \par Description
+ * Tx latency histograms of successfully transmitted data packets, per Tx path segment. 
+ * Bucket i counts the packets with latency in [2^i, 2^(i+1)) usec (bucket 0 includes also 0), 
+ * and the last bucket counts all longer latencies 
+ * 
+ * \sa ETxLatencySegment
+ */
+typedef struct
+{
+    TI_UINT32      uNumPackets;				/**< Number of packets counted in each segment's histogram 	*/
+    TI_UINT32      aHist[TX_LATENCY_SEGMENTS_NUM][TX_LATENCY_HIST_BUCKETS];	/**< Histogram per Tx path segment 	*/
+} TTxLatencyHist;
+
+/** \struct TIWLN_TX_LATENCY_STATISTICS
+ * \brief TI WLAN TX Latency Statistics
+ * 
+ * \par Description
+ * Tx latency histograms of all Tx Queues 
+ * 
+ * \sa
+ */
+typedef struct
+{
+    TI_BOOL         bEnabled;				/**< Indicates if the latency histograms are updated (TxLatencyStats in registry) */
+    TTxLatencyHist  tAcHist[MAX_NUM_OF_AC];	/**< Table which holds the Tx latency histograms of each Tx-queue */
+} TIWLN_TX_LATENCY_STATISTICS;
+
 /** \struct TDfsChannelRange
  * \brief DFS Channel Range
  * 
@@ -319,6 +370,54 @@ typedef struct
 
 } TIWLN_COUNTERS;
 
+/** \struct TRecoveryStats
+ * \brief Recovery Statistics
+ * 
+ * \par Description
+ * Phases duration of the last recovery (msec) and its FW configuration journal replay
+ * 
+ * \sa
+ */
+typedef struct 
+{
+    TI_UINT32  uNumOfRecoveries;	/**< Number of completed recoveries since the driver was started						*/
+    TI_UINT32  uStopTime;			/**< Last recovery: from the recovery trigger until the driver is stopped				*/
+    TI_UINT32  uFwReloadTime;		/**< Last recovery: device power cycle, files load, HW init and FW download				*/
+    TI_UINT32  uConfigTime;			/**< Last recovery: FW configuration sequence											*/
+    TI_UINT32  uReconnectTime;		/**< Last recovery: from the start/join command until the configuration is completed	*/
+    TI_UINT32  uTotalTime;			/**< Last recovery: total duration														*/
+    TI_UINT32  uMaxTotalTime;		/**< Longest recovery total duration													*/
+    TI_UINT32  uJournalSteps;		/**< Last recovery: configuration steps journaled since the previous configuration		*/
+    TI_UINT32  uReplayedSteps;		/**< Last recovery: configuration steps issued											*/
+    TI_UINT32  uSkippedSteps;		/**< Last recovery: configuration steps skipped since not journaled					*/
+    TI_BOOL    bJournalReplay;		/**< Last recovery: TI_TRUE if only the journaled configuration was replayed			*/
+
+} TRecoveryStats;
+
+/** \struct TContextClientStats
+ * \brief Driver Context Client Statistics
+ * 
+ * \par Description
+ * Invocations, run time and schedule-to-run latency of one driver context client (e.g. TxDataQ, CmdHndlr)
+ * 
+ * \sa
+ */
+typedef struct _TContextClientStats
+{
+    TI_UINT32  uClientId;			/**< The client index (input)															*/
+    TI_UINT32  uNumClients;			/**< Number of registered clients														*/
+    char       sName[16];			/**< The client name																	*/
+    TI_UINT32  uPriority;			/**< The client dispatch priority (0 = highest)										*/
+    TI_UINT32  uRequests;			/**< Number of schedule requests														*/
+    TI_UINT32  uInvokes;			/**< Number of callback invocations from the driver task								*/
+    TI_UINT32  uMaxRunTimeUs;		/**< Longest callback run time (usec)													*/
+    TI_UINT32  uMaxLatencyUs;		/**< Longest time from the schedule request until the callback was invoked (usec)		*/
+    TI_UINT32  uReserved;			/**< Alignment																			*/
+    TI_UINT64  uRunTimeUs;			/**< Total callbacks run time (usec)													*/
+    TI_UINT64  uLatencyUs;			/**< Total schedule-to-run latency (usec)												*/
+
+} TContextClientStats;
+
 /** \struct TPowerMgr_PowerMode
  * \brief Power Mode Parameters
  * 
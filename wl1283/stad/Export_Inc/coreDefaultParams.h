@@ -701,10 +701,25 @@ IP&Port classification table  */
 #define RX_DATA_RE_AUTH_ACTIVE_TIMEOUT_MIN				500
 #define RX_DATA_RE_AUTH_ACTIVE_TIMEOUT_MAX				800
 
+/* Rx buffers pool size per size class (0 disables the class, all 0 disables the pool) */
+#define RX_DATA_BUF_POOL_SMALL_BUFS_DEF         32
+#define RX_DATA_BUF_POOL_MEDIUM_BUFS_DEF        64
+#define RX_DATA_BUF_POOL_LARGE_BUFS_DEF         8
+#define RX_DATA_BUF_POOL_BUFS_MIN               0
+#define RX_DATA_BUF_POOL_BUFS_MAX               256
+
+#define RX_DATA_AMSDU_ZERO_COPY_DEF             TI_TRUE
+#define RX_DATA_AMSDU_ZERO_COPY_MIN             TI_FALSE
+#define RX_DATA_AMSDU_ZERO_COPY_MAX             TI_TRUE
+
 #define TX_DATA_CREDIT_CALC_TIMOEUT_DEF         100
 #define TX_DATA_CREDIT_CALC_TIMOEUT_MIN         20
 #define TX_DATA_CREDIT_CALC_TIMOEUT_MAX         1000
 
+#define TX_DATA_LATENCY_STATS_DEF               TI_TRUE
+#define TX_DATA_LATENCY_STATS_MIN               TI_FALSE
+#define TX_DATA_LATENCY_STATS_MAX               TI_TRUE
+
 #define TRAFFIC_ADM_CONTROL_TIMEOUT_MIN         10
 #define TRAFFIC_ADM_CONTROL_TIMEOUT_MAX         10000
 #define TRAFFIC_ADM_CONTROL_TIMEOUT_DEF         5000
@@ -732,6 +747,10 @@ IP&Port classification table  */
 #define TRAFFIC_MONITOR_MIN_INTERVAL_PERCENT_MAX   90
 #define TRAFFIC_MONITOR_MIN_INTERVAL_PERCENT_DEF   50
 
+#define TRAFFIC_MONITOR_BATCH_MIN   TI_FALSE
+#define TRAFFIC_MONITOR_BATCH_MAX   TI_TRUE
+#define TRAFFIC_MONITOR_BATCH_DEF   TI_FALSE
+
 #define CTRL_DATA_CONT_TX_THRESHOLD_MIN  2
 #define CTRL_DATA_CONT_TX_THRESHOLD_MAX  256
 #define CTRL_DATA_CONT_TX_THRESHOLD_DEF  30
@@ -979,6 +998,11 @@ IP&Port classification table  */
 #define WSC_PARSE_IN_BEACON_MIN 0
 #define WSC_PARSE_IN_BEACON_MAX 1
 
+/* MLME - index the scan results IEs, decode only the used ones and skip unchanged frames */
+#define MLME_LIGHTWEIGHT_PARSE_DEF 1
+#define MLME_LIGHTWEIGHT_PARSE_MIN 0
+#define MLME_LIGHTWEIGHT_PARSE_MAX 1
+
 #define WSC_INCLUDE_IN_BEACON_DEF 1
 #define WSC_INCLUDE_IN_BEACON_MIN 0
 #define WSC_INCLUDE_IN_BEACON_MAX 1
@@ -600,6 +600,8 @@ typedef struct
         signal_t                			siteMgrCurrentSignal;
         TI_UINT8                			siteMgrNumberOfSites;
         TIWLN_COUNTERS          			siteMgrTiWlanCounters;
+        TRecoveryStats          			tRecoveryStats;
+        TContextClientStats     			tContextClientStats;
         TI_BOOL                 			siteMgrBuiltInTestStatus;
         TI_UINT8                			siteMgrFwVersion[FW_VERSION_LEN]; /* Firmware version - null terminated string*/
         TI_UINT32               			siteMgrDisAssocReason;
@@ -687,6 +689,7 @@ typedef struct
         /* Tx Data section */
         portStatus_e            			txDataPortStatus;
         TTxDataCounters        				*pTxDataCounters;
+        TIWLN_TX_LATENCY_STATISTICS         *pTxLatencyStats;
         TI_UINT32 							txPacketsCount;
         reportTsStatisticsReq_t 			tsMetricsCounters;
         OS_802_11_THRESHOLD_CROSS_PARAMS  	txDataMediumUsageThreshold;
@@ -998,6 +1001,7 @@ typedef struct
 typedef struct
 {
     TI_UINT8                   parseWSCInBeacons;
+    TI_UINT8                   lightweightParse;
     TI_UINT32                  authResponseTimeout;
     TI_UINT32                  authMaxRetryCount;
     TI_UINT32                  assocResponseTimeout;
@@ -1057,9 +1061,11 @@ typedef struct
     /* TxCtrl Parameters */
     TI_UINT32					creditCalculationTimeout;
     TI_BOOL					    bCreditCalcTimerEnabled;
+    TI_BOOL					    bTxLatencyStats;
     /* TxDataQueue Parameters */
     TI_BOOL					    bStopNetStackTx;
     TI_UINT32					uTxSendPaceThresh;
+    TI_UINT32					uTxBurstPktsLimit;  /* Max packets sent from a queue per scheduler turn (the Tx aggregation limit) */
     TClsfrParams				ClsfrInitParam;
 } txDataInitParams_t;
 
@@ -1191,6 +1197,10 @@ typedef struct
     filter_e            rxDataFiltersDefaultAction;
     TRxDataFilterRequest    rxDataFilterRequests[MAX_DATA_FILTERS];
     TI_UINT32				reAuthActiveTimeout;
+    TI_UINT32               uRxBufPoolSmallBufs;    /* Rx buffers pool size of each size class */
+    TI_UINT32               uRxBufPoolMediumBufs;
+    TI_UINT32               uRxBufPoolLargeBufs;
+    TI_BOOL                 bAmsduZeroCopy;         /* De-aggregate A-MSDUs in place instead of copying each MSDU */
 } rxDataInitParams_t;
 
 typedef struct
@@ -1237,6 +1247,7 @@ typedef struct
     TI_BOOL							SendINIBufferToUser;
     /* Traffic Monitor */
     TI_UINT8                        trafficMonitorMinIntervalPercentage;
+    TI_BOOL                         bTrafficMonitorBatch;
     TReportInitParams               tReport;
     TCurrBssInitParams              tCurrBssInitParams;
 
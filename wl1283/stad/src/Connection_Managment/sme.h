@@ -46,7 +46,7 @@
 #include "ScanCncn.h"
 #include "paramOut.h"
 
-#define SME_SCAN_TABLE_ENTRIES 32
+#define SME_SCAN_TABLE_ENTRIES 64
 
 typedef enum
 {
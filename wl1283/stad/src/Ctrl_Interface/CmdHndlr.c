@@ -53,6 +53,9 @@
 /* The queue may contain only one command per configuration application but set as unlimited */
 #define COMMANDS_QUE_SIZE   QUE_UNLIMITED_SIZE   
 
+/* The preallocated commands pool size (a full commands batch is handled without allocations) */
+#define COMMANDS_POOL_SIZE  PRIVATE_CMD_MAX_BATCH
+
 /* Command module internal data */
 typedef struct 
 {
@@ -65,16 +68,26 @@ typedef struct
    TI_HANDLE       hCmdQueue;       /* Handle to the commands queue */
    TI_UINT32       uContextId;      /* ID allocated to this module on registration to context module */
    TConfigCommand *pCurrCmd;        /* Pointer to the command currently being processed (if any) */
+
+   TConfigCommand *aFreeCmds[COMMANDS_POOL_SIZE]; /* The free preallocated commands (used as a stack) */
+   TI_UINT32       uNumFreeCmds;    /* Number of commands in aFreeCmds */
 } TCmdHndlrObj;
 
 /* External functions prototypes */
 extern void wlanDrvIf_CommandDone (TI_HANDLE hOs, void *pSignalObject, TI_UINT8 *CmdResp_p);
 
+/* Local functions prototypes */
+static TConfigCommand *cmdHndlr_AllocCommand (TCmdHndlrObj *pCmdHndlr);
+static void      cmdHndlr_FreeCommand (TCmdHndlrObj *pCmdHndlr, TConfigCommand *pCmd);
+static TI_STATUS cmdHndlr_WaitCommand (TCmdHndlrObj *pCmdHndlr, TConfigCommand *pCmd);
+static void      cmdHndlr_CommandDone (TCmdHndlrObj *pCmdHndlr, TConfigCommand *pCmd);
+static void      cmdHndlr_AbortCommand (TCmdHndlrObj *pCmdHndlr, TConfigCommand *pCmd);
+
 /** 
  * \fn     cmdHndlr_Create
  * \brief  Create the module
  * 
- * Create the module object
+ * Create the module object and the preallocated commands pool
  * 
  * \note   
  * \param  hOs - Handle to the Os Abstraction Layer                           
@@ -84,6 +97,7 @@ extern void wlanDrvIf_CommandDone (TI_HANDLE hOs, void *pSignalObject, TI_UINT8
 TI_HANDLE cmdHndlr_Create (TI_HANDLE hOs, TI_HANDLE hEvHandler)
 {
     TCmdHndlrObj *pCmdHndlr = (TCmdHndlrObj *) os_memoryAlloc (hOs, sizeof(TCmdHndlrObj));
+    TConfigCommand *pCmd;
 
     if (pCmdHndlr == NULL) 
     {
@@ -102,6 +116,27 @@ TI_HANDLE cmdHndlr_Create (TI_HANDLE hOs, TI_HANDLE hEvHandler)
         return NULL;
     }
 
+    /* Preallocate the commands pool, each with its own signal object (reused by all its commands) */
+    while (pCmdHndlr->uNumFreeCmds < COMMANDS_POOL_SIZE)
+    {
+        pCmd = (TConfigCommand *) os_memoryAlloc (hOs, sizeof(TConfigCommand));
+        if (pCmd == NULL)
+        {
+            cmdHndlr_Destroy ((TI_HANDLE) pCmdHndlr, (TI_HANDLE) hEvHandler);
+            return NULL;
+        }
+        os_memoryZero (hOs, (void *)pCmd, sizeof(TConfigCommand));
+        pCmd->pSignalObject = os_SignalObjectCreate (hOs);
+        if (pCmd->pSignalObject == NULL)
+        {
+            os_memoryFree (hOs, pCmd, sizeof(TConfigCommand));
+            cmdHndlr_Destroy ((TI_HANDLE) pCmdHndlr, (TI_HANDLE) hEvHandler);
+            return NULL;
+        }
+        pCmd->bPooled = TI_TRUE;
+        pCmdHndlr->aFreeCmds[pCmdHndlr->uNumFreeCmds++] = pCmd;
+    }
+
     return (TI_HANDLE) pCmdHndlr;
 }
 
@@ -110,7 +145,7 @@ TI_HANDLE cmdHndlr_Create (TI_HANDLE hOs, TI_HANDLE hEvHandler)
  * \fn     cmdHndlr_Destroy
  * \brief  Destroy the module object
  * 
- * Destroy the module object.
+ * Destroy the module object and the preallocated commands pool.
  * 
  * \note   
  * \param  hCmdHndlr - The object                                          
@@ -120,12 +155,21 @@ TI_HANDLE cmdHndlr_Create (TI_HANDLE hOs, TI_HANDLE hEvHandler)
 TI_STATUS cmdHndlr_Destroy (TI_HANDLE hCmdHndlr, TI_HANDLE hEvHandler)
 {
     TCmdHndlrObj *pCmdHndlr = (TCmdHndlrObj *)hCmdHndlr;
+    TConfigCommand *pCmd;
 
 	if (pCmdHndlr->hCmdInterpret)
 	{
 		cmdInterpret_Destroy (pCmdHndlr->hCmdInterpret, hEvHandler);
 	}
 
+	/* Free the commands pool */
+	while (pCmdHndlr->uNumFreeCmds > 0)
+	{
+		pCmd = pCmdHndlr->aFreeCmds[--pCmdHndlr->uNumFreeCmds];
+		os_SignalObjectFree (pCmdHndlr->hOs, pCmd->pSignalObject);
+		os_memoryFree (pCmdHndlr->hOs, pCmd, sizeof(TConfigCommand));
+	}
+
 
 	if (pCmdHndlr->hCmdQueue)
 	{
@@ -142,7 +186,7 @@ TI_STATUS cmdHndlr_Destroy (TI_HANDLE hCmdHndlr, TI_HANDLE hEvHandler)
  * \fn     cmdHndlr_ClearQueue
  * \brief  Clear commands queue
  * 
- * Dequeue and free all queued commands.
+ * Dequeue and abort all queued commands.
  * 
  * \note   
  * \param  hCmdHndlr - The object                                          
@@ -160,9 +204,8 @@ void cmdHndlr_ClearQueue (TI_HANDLE hCmdHndlr)
         pCurrCmd = (TConfigCommand *)que_Dequeue(pCmdHndlr->hCmdQueue);
         context_LeaveCriticalSection (pCmdHndlr->hContext);
         if (pCurrCmd != NULL) {
-        /* Just release the semaphore. The command is freed subsequently. */
-        os_SignalObjectSet (pCmdHndlr->hOs, pCurrCmd->pSignalObject);
-    }
+            cmdHndlr_AbortCommand (pCmdHndlr, pCurrCmd);
+        }
     } while (pCurrCmd != NULL);
 }
 
@@ -204,6 +247,8 @@ void cmdHndlr_Init (TStadHandlesList *pStadHandles)
                                                     TI_TRUE,
                                                     "COMMAND",
                                                     sizeof("COMMAND"));
+    /* Management commands: invoked after the data path and other clients */
+    context_SetClientPriority (pCmdHndlr->hContext, pCmdHndlr->uContextId, CONTEXT_PRIORITY_LOW);
 
 	if(pCmdHndlr->hReport != NULL)
 	{
@@ -221,7 +266,7 @@ void cmdHndlr_Init (TStadHandlesList *pStadHandles)
  * Wait on the current command's signal until its processing is completed.
  * Note that this prevents the user application from sending further commands before completion.
  * 
- * \note   
+ * \note   The command is taken from the preallocated pool (allocated only if the pool is empty).
  * \param  hCmdHndlr    - The module object
  * \param  cmd          - User request
  * \param  others       - The command flags, data and params
@@ -242,13 +287,12 @@ TI_STATUS cmdHndlr_InsertCommand (TI_HANDLE     hCmdHndlr,
 	TConfigCommand   *pNewCmd;
 	TI_STATUS         eStatus;
 
-	/* Allocated command structure */
-	pNewCmd = os_memoryAlloc (pCmdHndlr->hOs, sizeof (TConfigCommand));
+	/* Get a command structure (including its "complete-flag") */
+	pNewCmd = cmdHndlr_AllocCommand (pCmdHndlr);
 	if (pNewCmd == NULL)
 	{
 		return TI_NOK;
 	}
-    os_memoryZero (pCmdHndlr->hOs, (void *)pNewCmd, sizeof(TConfigCommand));
 
 	/* Copy user request into local structure */
 	pNewCmd->cmd = cmd;
@@ -259,16 +303,6 @@ TI_STATUS cmdHndlr_InsertCommand (TI_HANDLE     hCmdHndlr,
 	pNewCmd->buffer2_len = buffer2_len;
 	pNewCmd->param3 = param3;
 	pNewCmd->param4 = param4;
-	pNewCmd->pSignalObject = os_SignalObjectCreate (pCmdHndlr->hOs); /* initialize "complete-flag" */
-
-	/* If creating the signal object failed */
-	if (pNewCmd->pSignalObject == NULL)
-	{
-		os_printf("cmdPerform: Failed to create signalling object\n");
-		/* free allocated memory and return error */
-		os_memoryFree (pCmdHndlr->hOs, pNewCmd, sizeof (TConfigCommand));
-		return TI_NOK;
-	}
 
     /* Indicate the start of command process, from adding it to the queue until get return status form it */  
     pNewCmd->bWaitFlag = TI_TRUE;
@@ -280,11 +314,9 @@ TI_STATUS cmdHndlr_InsertCommand (TI_HANDLE     hCmdHndlr,
     eStatus = que_Enqueue (pCmdHndlr->hCmdQueue, (TI_HANDLE)pNewCmd);
     if (eStatus != TI_OK) 
 	{
-		os_printf("cmdPerform: Failed to enqueue new command\n");
-		os_SignalObjectFree (pCmdHndlr->hOs, pNewCmd->pSignalObject);
-        pNewCmd->pSignalObject = NULL;
-		os_memoryFree (pCmdHndlr->hOs, pNewCmd, sizeof (TConfigCommand));
         context_LeaveCriticalSection (pCmdHndlr->hContext);  /* Leave critical section */
+		os_printf("cmdPerform: Failed to enqueue new command\n");
+		cmdHndlr_FreeCommand (pCmdHndlr, pNewCmd);
         return TI_NOK;
     }
 
@@ -294,11 +326,250 @@ TI_STATUS cmdHndlr_InsertCommand (TI_HANDLE     hCmdHndlr,
 	/* Request driver task schedule for command handling (after we left critical section!) */
 	context_RequestSchedule (pCmdHndlr->hContext, pCmdHndlr->uContextId);
 
+	/* Wait until the command is executed, and return to calling process with command return code */
+	return cmdHndlr_WaitCommand (pCmdHndlr, pNewCmd);
+}
+
+
+/** 
+ * \fn     cmdHndlr_InsertBatch 
+ * \brief  Insert a batch of private commands to the driver
+ * 
+ * Insert all the batch commands to the commands queue at once and request a single 
+ *     driver task schedule, so they are handled one after the other in one driver-task 
+ *     pass (unless a command is completed later (Async) - the rest follow its completion).
+ * Synchronous batch (fDoneCb is NULL): wait until all commands are executed.
+ * Asynchronous batch: return after queueing the commands. Each command return code is 
+ *     saved on its completion, and fDoneCb is called after the last outstanding one is completed
+ *     or aborted (whatever its order in the batch).
+ * 
+ * \note   The commands and return codes arrays are used until the batch completion.
+ *         The batch is queued entirely or not at all (if a command can't be allocated).
+ * \param  hCmdHndlr    - The module object
+ * \param  cmd          - User request for all commands (the private commands request)
+ * \param  aPrivCmds    - The private commands (passed to the interpreter as param3)
+ * \param  uNumCmds     - Number of commands (up to PRIVATE_CMD_MAX_BATCH)
+ * \param  aRetCodes    - Output: The commands return codes
+ * \param  fDoneCb      - The async batch completion callback (NULL for a synchronous batch)
+ * \param  hDoneCb      - The callback handle
+ * \return TI_OK if the batch was queued (sync: and completed), TI_NOK if failed.  
+ * \sa     cmdHndlr_InsertCommand, cmdHndlr_HandleCommands
+ */ 
+TI_STATUS cmdHndlr_InsertBatch (TI_HANDLE         hCmdHndlr,
+                                TI_UINT32         cmd,
+                                ti_private_cmd_t *aPrivCmds,
+                                TI_UINT32         uNumCmds,
+                                TI_UINT32        *aRetCodes,
+                                TCmdHndlrDoneCb   fDoneCb,
+                                TI_HANDLE         hDoneCb)
+{
+    TCmdHndlrObj     *pCmdHndlr = (TCmdHndlrObj *)hCmdHndlr;
+    TConfigCommand   *aCmds[PRIVATE_CMD_MAX_BATCH];
+    TCmdHndlrBatch   *pBatch = NULL;
+    TI_UINT32         uNumQueued;
+    TI_UINT32         i;
+
+    if ((uNumCmds == 0) || (uNumCmds > PRIVATE_CMD_MAX_BATCH))
+    {
+        return TI_NOK;
+    }
+
+    /* Async batch: all its commands count down the same outstanding counter */
+    if (fDoneCb != NULL)
+    {
+        pBatch = (TCmdHndlrBatch *)os_memoryAlloc (pCmdHndlr->hOs, sizeof(TCmdHndlrBatch));
+        if (pBatch == NULL)
+        {
+            return TI_NOK;
+        }
+        pBatch->uOutstanding = uNumCmds;
+        pBatch->fDoneCb      = fDoneCb;
+        pBatch->hDoneCb      = hDoneCb;
+    }
+
+    /* Prepare all the commands before queueing any of them */
+    for (i = 0; i < uNumCmds; i++)
+    {
+        aCmds[i] = cmdHndlr_AllocCommand (pCmdHndlr);
+        if (aCmds[i] == NULL)
+        {
+            while (i > 0)
+            {
+                cmdHndlr_FreeCommand (pCmdHndlr, aCmds[--i]);
+            }
+            if (pBatch != NULL)
+            {
+                os_memoryFree (pCmdHndlr->hOs, pBatch, sizeof(TCmdHndlrBatch));
+            }
+            return TI_NOK;
+        }
+
+        aCmds[i]->cmd         = cmd;
+        aCmds[i]->param3      = (TI_UINT32 *)&aPrivCmds[i];
+        aCmds[i]->return_code = TI_NOK;  /* Kept if the command is aborted */
+        if (fDoneCb == NULL)
+        {
+            aCmds[i]->bWaitFlag = TI_TRUE;
+        }
+        else
+        {
+            aCmds[i]->bAsync    = TI_TRUE;
+            aCmds[i]->pRetCode  = &aRetCodes[i];
+            aCmds[i]->pBatch    = pBatch;
+        }
+    }
+
+    /* Enqueue all the commands in one critical section */
+    context_EnterCriticalSection (pCmdHndlr->hContext);
+    for (uNumQueued = 0; uNumQueued < uNumCmds; uNumQueued++)
+    {
+        if (que_Enqueue (pCmdHndlr->hCmdQueue, (TI_HANDLE)aCmds[uNumQueued]) != TI_OK)
+        {
+            break;
+        }
+    }
+    context_LeaveCriticalSection (pCmdHndlr->hContext);
+
+    /* If failed to enqueue some commands, abort them (the batch completes with the queued ones) */
+    if (uNumQueued < uNumCmds)
+    {
+        os_printf("cmdHndlr_InsertBatch: Failed to enqueue %d of %d commands\n", uNumCmds - uNumQueued, uNumCmds);
+        for (i = uNumQueued; i < uNumCmds; i++)
+        {
+            cmdHndlr_AbortCommand (pCmdHndlr, aCmds[i]);
+        }
+    }
+
+	/* Request driver task schedule for the batch handling (after we left critical section!) */
+    if (uNumQueued > 0)
+    {
+        context_RequestSchedule (pCmdHndlr->hContext, pCmdHndlr->uContextId);
+    }
+
+    /* Async batch: the return codes are saved on the commands completion */
+    if (fDoneCb != NULL)
+    {
+        return TI_OK;
+    }
+
+    /* Sync batch: wait for the commands in their execution order */
+    for (i = 0; i < uNumCmds; i++)
+    {
+        aRetCodes[i] = (TI_UINT32)cmdHndlr_WaitCommand (pCmdHndlr, aCmds[i]);
+    }
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     cmdHndlr_AllocCommand 
+ * \brief  Get a command structure
+ * 
+ * Take a command from the preallocated pool, or allocate it with its signal object if the pool is empty.
+ * 
+ * \note   Called from user context.
+ * \param  pCmdHndlr - The module object
+ * \return The zeroed command (with its signal object), NULL if failed
+ * \sa     cmdHndlr_FreeCommand
+ */ 
+static TConfigCommand *cmdHndlr_AllocCommand (TCmdHndlrObj *pCmdHndlr)
+{
+    TConfigCommand *pCmd = NULL;
+    void           *pSignalObject;
+
+    context_EnterCriticalSection (pCmdHndlr->hContext);
+    if (pCmdHndlr->uNumFreeCmds > 0)
+    {
+        pCmd = pCmdHndlr->aFreeCmds[--pCmdHndlr->uNumFreeCmds];
+    }
+    context_LeaveCriticalSection (pCmdHndlr->hContext);
+
+    if (pCmd != NULL)
+    {
+        pSignalObject = pCmd->pSignalObject;
+        os_memoryZero (pCmdHndlr->hOs, (void *)pCmd, sizeof(TConfigCommand));
+        pCmd->pSignalObject = pSignalObject;
+        pCmd->bPooled = TI_TRUE;
+        return pCmd;
+    }
+
+	/* The pool is empty, so allocate the command structure */
+	pCmd = os_memoryAlloc (pCmdHndlr->hOs, sizeof (TConfigCommand));
+	if (pCmd == NULL)
+	{
+		return NULL;
+	}
+    os_memoryZero (pCmdHndlr->hOs, (void *)pCmd, sizeof(TConfigCommand));
+
+	pCmd->pSignalObject = os_SignalObjectCreate (pCmdHndlr->hOs); /* initialize "complete-flag" */
+
+	/* If creating the signal object failed */
+	if (pCmd->pSignalObject == NULL)
+	{
+		os_printf("cmdPerform: Failed to create signalling object\n");
+		/* free allocated memory and return error */
+		os_memoryFree (pCmdHndlr->hOs, pCmd, sizeof (TConfigCommand));
+		return NULL;
+	}
+
+    return pCmd;
+}
+
+
+/** 
+ * \fn     cmdHndlr_FreeCommand 
+ * \brief  Release a command structure
+ * 
+ * Return a pooled command to the pool, or free an allocated command and its signal object.
+ * 
+ * \note   Called from user or driver context.
+ * \param  pCmdHndlr - The module object
+ * \param  pCmd      - The command
+ * \return void
+ * \sa     cmdHndlr_AllocCommand
+ */ 
+static void cmdHndlr_FreeCommand (TCmdHndlrObj *pCmdHndlr, TConfigCommand *pCmd)
+{
+    if (pCmd->bPooled)
+    {
+        context_EnterCriticalSection (pCmdHndlr->hContext);
+        pCmdHndlr->aFreeCmds[pCmdHndlr->uNumFreeCmds++] = pCmd;
+        context_LeaveCriticalSection (pCmdHndlr->hContext);
+        return;
+    }
+
+    if (pCmd->pSignalObject != NULL)
+    {
+        os_SignalObjectFree (pCmdHndlr->hOs, pCmd->pSignalObject);
+        pCmd->pSignalObject = NULL;
+    }
+    os_memoryFree (pCmdHndlr->hOs, pCmd, sizeof (TConfigCommand));
+}
+
+
+/** 
+ * \fn     cmdHndlr_WaitCommand 
+ * \brief  Wait until a queued command is executed
+ * 
+ * Wait on the command's signal, release the command and return its return code.
+ * On timeout, discard the queued commands (to prevent a panic).
+ * 
+ * \note   Called from user context.
+ * \param  pCmdHndlr - The module object
+ * \param  pCmd      - The queued command
+ * \return The command return code
+ * \sa     cmdHndlr_InsertCommand, cmdHndlr_InsertBatch
+ */ 
+static TI_STATUS cmdHndlr_WaitCommand (TCmdHndlrObj *pCmdHndlr, TConfigCommand *pCmd)
+{
+	TI_STATUS         eStatus;
+
 	/* Wait until the command is executed */
-	if(os_SignalObjectWait (pCmdHndlr->hOs, pNewCmd->pSignalObject) != TI_OK)
+	if(os_SignalObjectWait (pCmdHndlr->hOs, pCmd->pSignalObject) != TI_OK)
 	{
-		ti_private_cmd_t *pPcommand = (ti_private_cmd_t *)param3;
-		printk("!!!The timeout cmd is %d\n", cmd);
+		ti_private_cmd_t *pPcommand = (ti_private_cmd_t *)pCmd->param3;
+		printk("!!!The timeout cmd is %d\n", pCmd->cmd);
 
 		if(pPcommand)
 			printk("!!!The timeout priv cmd is %d\n", pPcommand->cmd);
@@ -308,49 +579,123 @@ TI_STATUS cmdHndlr_InsertCommand (TI_HANDLE     hCmdHndlr,
 		 */
 		{
 			TConfigCommand   *ptmpCmd;
-			context_EnterCriticalSection (pCmdHndlr->hContext);
 			do {
+				context_EnterCriticalSection (pCmdHndlr->hContext);
 				ptmpCmd = (TConfigCommand *)que_Dequeue(pCmdHndlr->hCmdQueue);
+				context_LeaveCriticalSection (pCmdHndlr->hContext);
 				if(ptmpCmd == NULL)
 				{
 					break;
 				}
-				if(ptmpCmd == pNewCmd)
+				if(ptmpCmd == pCmd)
 				{
-					os_printf("cmdHndlr_InsertCommand : %x dequeued\n",ptmpCmd );
+					os_printf("cmdHndlr_WaitCommand : %x dequeued\n",ptmpCmd );
 				}
 				else
 				{
-					os_printf("cmdHndlr_InsertCommand : %x dequeued and signal set\n", ptmpCmd);
-					os_SignalObjectSet (pCmdHndlr->hOs, ptmpCmd->pSignalObject);
+					os_printf("cmdHndlr_WaitCommand : %x dequeued and aborted\n", ptmpCmd);
+					cmdHndlr_AbortCommand (pCmdHndlr, ptmpCmd);
 				}
 			} while (ptmpCmd != NULL);
-			context_LeaveCriticalSection (pCmdHndlr->hContext);
 		} /* panic-prevention-stop */
+
+		/* A late completion may still set the signal, so don't return the command to the pool */
+		pCmd->bPooled = TI_FALSE;
 	}
 
 	/* After "wait" - the command has already been processed by the drivers' context */
     /* Indicate the end of command process, from adding it to the queue until get return status form it */  
-    pNewCmd->bWaitFlag = TI_FALSE;
+    pCmd->bWaitFlag = TI_FALSE;
 
 	/* Copy the return code */
-	eStatus = pNewCmd->return_code;
-
-	/* Free signalling object and command structure */
-	os_SignalObjectFree (pCmdHndlr->hOs, pNewCmd->pSignalObject);
-	pNewCmd->pSignalObject = NULL;
+	eStatus = pCmd->return_code;
 
-    /* If command not completed in this context (Async) don't free the command memory */
-    if(COMMAND_PENDING != pNewCmd->eCmdStatus)
+    /* If command not completed in this context (Async) don't free the command memory (freed on completion) */
+    if(COMMAND_PENDING != pCmd->eCmdStatus)
     {
-        os_memoryFree (pCmdHndlr->hOs, pNewCmd, sizeof (TConfigCommand));
+        cmdHndlr_FreeCommand (pCmdHndlr, pCmd);
+    }
+    else
+    {
+        os_SignalObjectFree (pCmdHndlr->hOs, pCmd->pSignalObject);
+        pCmd->pSignalObject = NULL;
     }
 
-	/* Return to calling process with command return code */
 	return eStatus;
 }
 
 
+/** 
+ * \fn     cmdHndlr_CommandDone 
+ * \brief  Notify a command completion
+ * 
+ * Signal the waiting user context, or for an async batch command save its return code,
+ *     release it and call the batch completion callback if it was the last outstanding one.
+ * The batch commands may complete out of their order (a command aborted while the
+ *     previous ones are still queued or pending), so the batch is counted down.
+ * 
+ * \note   The command must not be referenced after this call if it is async.
+ *         May be called from the driver context or the user context (aborted commands).
+ * \param  pCmdHndlr - The module object
+ * \param  pCmd      - The completed command
+ * \return void
+ * \sa     cmdHndlr_HandleCommands, cmdHndlr_Complete
+ */ 
+static void cmdHndlr_CommandDone (TCmdHndlrObj *pCmdHndlr, TConfigCommand *pCmd)
+{
+    TCmdHndlrBatch *pBatch;
+    TI_UINT32       uOutstanding;
+
+    if (!pCmd->bAsync)
+    {
+        wlanDrvIf_CommandDone(pCmdHndlr->hOs, pCmd->pSignalObject, pCmd->CmdRespBuffer); 
+        return;
+    }
+
+    pBatch = pCmd->pBatch;
+    *(pCmd->pRetCode) = pCmd->return_code;
+    cmdHndlr_FreeCommand (pCmdHndlr, pCmd);
+
+    context_EnterCriticalSection (pCmdHndlr->hContext);
+    uOutstanding = --pBatch->uOutstanding;
+    context_LeaveCriticalSection (pCmdHndlr->hContext);
+
+    /* The batch last outstanding command - notify its completion */
+    if (uOutstanding == 0)
+    {
+        pBatch->fDoneCb (pBatch->hDoneCb);
+        os_memoryFree (pCmdHndlr->hOs, pBatch, sizeof(TCmdHndlrBatch));
+    }
+}
+
+
+/** 
+ * \fn     cmdHndlr_AbortCommand 
+ * \brief  Abort a dequeued command without executing it
+ * 
+ * Release the waiting user context (the command is freed subsequently), or complete an 
+ *     async batch command with its initial TI_NOK return code.
+ * 
+ * \note   
+ * \param  pCmdHndlr - The module object
+ * \param  pCmd      - The dequeued command
+ * \return void
+ * \sa     cmdHndlr_ClearQueue, cmdHndlr_WaitCommand
+ */ 
+static void cmdHndlr_AbortCommand (TCmdHndlrObj *pCmdHndlr, TConfigCommand *pCmd)
+{
+    if (pCmd->bAsync)
+    {
+        cmdHndlr_CommandDone (pCmdHndlr, pCmd);
+    }
+    else
+    {
+        /* Just release the semaphore. The command is freed subsequently. */
+        os_SignalObjectSet (pCmdHndlr->hOs, pCmd->pSignalObject);
+    }
+}
+
+
 
 /** 
  * \fn     cmdHndlr_HandleCommands 
@@ -370,6 +715,7 @@ TI_STATUS cmdHndlr_InsertCommand (TI_HANDLE     hCmdHndlr,
 void cmdHndlr_HandleCommands (TI_HANDLE hCmdHndlr)
 {
     TCmdHndlrObj     *pCmdHndlr = (TCmdHndlrObj *)hCmdHndlr;
+    TConfigCommand   *pCurrCmd;
 
     while (1)
     {
@@ -412,9 +758,9 @@ void cmdHndlr_HandleCommands (TI_HANDLE hCmdHndlr)
             }
 
             /* Command was completed so free the wait signal and continue to next command */
-            wlanDrvIf_CommandDone(pCmdHndlr->hOs, pCmdHndlr->pCurrCmd->pSignalObject, pCmdHndlr->pCurrCmd->CmdRespBuffer); 
-
+            pCurrCmd = pCmdHndlr->pCurrCmd;
             pCmdHndlr->pCurrCmd = NULL;
+            cmdHndlr_CommandDone (pCmdHndlr, pCurrCmd);
 
         }
 
@@ -446,28 +792,35 @@ void cmdHndlr_HandleCommands (TI_HANDLE hCmdHndlr)
  */ 
 void cmdHndlr_Complete (TI_HANDLE hCmdHndlr)
 {
-    TCmdHndlrObj *pCmdHndlr = (TCmdHndlrObj *)hCmdHndlr;
-    TI_BOOL       bLocalWaitFlag;
+    TCmdHndlrObj   *pCmdHndlr = (TCmdHndlrObj *)hCmdHndlr;
+    TConfigCommand *pCurrCmd  = pCmdHndlr->pCurrCmd;
+    TI_BOOL         bLocalWaitFlag;
 
-    if (pCmdHndlr->pCurrCmd)
+    if (pCurrCmd)
     {
 	/* set Status to COMPLETE */
-        pCmdHndlr->pCurrCmd->eCmdStatus = TI_OK;
+        pCurrCmd->eCmdStatus = TI_OK;
+        pCmdHndlr->pCurrCmd = NULL;
+
+        /* Async batch command: save its return code and release it */
+        if (pCurrCmd->bAsync)
+        {
+            cmdHndlr_CommandDone (pCmdHndlr, pCurrCmd);
+            return;
+        }
     
         /* save the wait flag before free semaphore */
-        bLocalWaitFlag = pCmdHndlr->pCurrCmd->bWaitFlag;
+        bLocalWaitFlag = pCurrCmd->bWaitFlag;
 
-        wlanDrvIf_CommandDone(pCmdHndlr->hOs, pCmdHndlr->pCurrCmd->pSignalObject, pCmdHndlr->pCurrCmd->CmdRespBuffer); 
+        wlanDrvIf_CommandDone(pCmdHndlr->hOs, pCurrCmd->pSignalObject, pCurrCmd->CmdRespBuffer); 
 
         /* if cmdHndlr_InsertCommand() not wait to cmd complete? */
         if (TI_FALSE == bLocalWaitFlag)
         {
             /* no wait, free the command memory */
-            os_memoryFree (pCmdHndlr->hOs, pCmdHndlr->pCurrCmd, sizeof (TConfigCommand));
+            cmdHndlr_FreeCommand (pCmdHndlr, pCurrCmd);
         }
 
-        pCmdHndlr->pCurrCmd = NULL;
-
         return;
     }
 
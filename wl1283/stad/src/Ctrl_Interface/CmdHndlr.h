@@ -38,6 +38,18 @@
 #include "queue.h"
 #include "DrvMainModules.h"
 #include "WlanDrvIf.h"
+#include "privateCmd.h"
+
+/* The async commands batch completion callback (see cmdHndlr_InsertBatch) */
+typedef void (*TCmdHndlrDoneCb) (TI_HANDLE hCb);
+
+/* An async commands batch, completed when its last outstanding command is completed or aborted */
+typedef struct
+{
+    TI_UINT32       uOutstanding;                       /* Number of the batch commands not completed yet */
+    TCmdHndlrDoneCb fDoneCb;                            /* Called when all the batch commands are completed */
+    TI_HANDLE       hDoneCb;
+} TCmdHndlrBatch;
 
 /* The configuration commands structure */
 typedef struct 
@@ -63,6 +75,10 @@ typedef struct
      * For OSE the new typedef includes all "Done" typedefs in union from EMP code (H files).
      */
     TI_UINT8	CmdRespBuffer[sizeof(TCmdRespUnion)];   
+    TI_BOOL     bPooled;                                /* Taken from the preallocated commands pool */
+    TI_BOOL     bAsync;                                 /* Async batch command (not waited for) */
+    TI_UINT32  *pRetCode;                               /* Async: where to save the return code on completion */
+    TCmdHndlrBatch *pBatch;                             /* Async: the command batch */
 } TConfigCommand;
 
 
@@ -79,6 +95,13 @@ TI_STATUS cmdHndlr_InsertCommand (TI_HANDLE     hCmdHndlr,
                                   TI_UINT32     buffer2_len,
                                   TI_UINT32    *param3,
                                   TI_UINT32    *param4);
+TI_STATUS cmdHndlr_InsertBatch (TI_HANDLE         hCmdHndlr,
+                                TI_UINT32         cmd,
+                                ti_private_cmd_t *aPrivCmds,
+                                TI_UINT32         uNumCmds,
+                                TI_UINT32        *aRetCodes,
+                                TCmdHndlrDoneCb   fDoneCb,
+                                TI_HANDLE         hDoneCb);
 void      cmdHndlr_HandleCommands (TI_HANDLE hCmdHndlr);
 void      cmdHndlr_Complete (TI_HANDLE hCmdHndlr);
 void     *cmdHndlr_GetStat (TI_HANDLE hCmdHndlr);
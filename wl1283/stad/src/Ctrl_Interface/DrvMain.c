@@ -153,6 +153,9 @@ typedef struct
 	TI_HANDLE         hModuleStartedCb;  /* context for fFwInitDoneCb */
 	void (*fModuleStoppedCb)(TI_HANDLE); /* callback to invoke when this module is successfully stopped */
 	TI_HANDLE         hModuleStoppedCb;  /* context for fFwInitDoneCb */
+    TI_UINT32         uRecoveryStartTime;  /* The time (msec) the current recovery was triggered */
+    TI_UINT32         uRecoveryPhaseTime;  /* The time (msec) the current recovery phase started */
+    TRecoveryStats    tRecoveryStats;      /* The recovery phases duration and configuration replay statistics */
 
 } TDrvMain;
 
@@ -894,6 +897,7 @@ static TI_STATUS drvMain_SetDefaults (TI_HANDLE hDrvMain, TI_UINT8 *pBuf, TI_UIN
     SoftGemini_SetDefaults (pDrvMain->tStadHandles.hSoftGemini, &pInitTable->SoftGeminiInitParams);
     txDataQ_SetDefaults (pDrvMain->tStadHandles.hTxDataQ, &pInitTable->txDataInitParams);
     txCtrl_SetDefaults (pDrvMain->tStadHandles.hTxCtrl, pInitTable);
+    TrafficMonitor_SetBatchMode (pDrvMain->tStadHandles.hTrafficMon, pInitTable->bTrafficMonitorBatch);
     currBSS_SetDefaults (pDrvMain->tStadHandles.hCurrBss, &pInitTable->tCurrBssInitParams);
     mlme_SetDefaults (pDrvMain->tStadHandles.hMlme, &pInitTable->tMlmeInitParams);
 
@@ -1113,8 +1117,8 @@ static TI_STATUS drvMain_ConfigFw (TI_HANDLE hDrvMain)
      */
     TWD_ExitFromInitMode (pDrvMain->tStadHandles.hTWD);
 
-    /* Configure the FW from the TWD DB */
-    TWD_ConfigFw (pDrvMain->tStadHandles.hTWD);
+    /* Configure the FW from the TWD DB (on recovery, possibly only the journaled settings) */
+    TWD_ConfigFw (pDrvMain->tStadHandles.hTWD, pDrvMain->bRecovery);
 
     TRACE0(pDrvMain->tStadHandles.hReport, REPORT_SEVERITY_INIT , "EXIT FROM INIT\n");
 
@@ -1262,6 +1266,8 @@ TI_STATUS drvMain_Recovery (TI_HANDLE hDrvMain)
         TRACE1(pDrvMain->tStadHandles.hReport, REPORT_SEVERITY_CONSOLE,".....drvMain_Recovery, ts=%d\n", os_timeStampMs(pDrvMain->tStadHandles.hOs));
         WLAN_OS_REPORT((".....drvMain_Recovery, ts=%d\n", os_timeStampMs(pDrvMain->tStadHandles.hOs)));
         pDrvMain->bRecovery = TI_TRUE;
+        pDrvMain->uRecoveryStartTime = os_timeStampMs(pDrvMain->tStadHandles.hOs);
+        pDrvMain->uRecoveryPhaseTime = pDrvMain->uRecoveryStartTime;
         drvMain_SmEvent (hDrvMain, SM_EVENT_RECOVERY);
         return TI_OK;
     }
@@ -1289,12 +1295,53 @@ TI_STATUS drvMain_Recovery (TI_HANDLE hDrvMain)
  */ 
 static void drvMain_RecoveryNotify (TDrvMain *pDrvMain)
 {
+    TRecoveryStats *pStats = &pDrvMain->tRecoveryStats;
+    TConfigFwStats  tConfigFwStats;
+
     txCtrl_NotifyFwReset (pDrvMain->tStadHandles.hTxCtrl);
     scr_notifyFWReset (pDrvMain->tStadHandles.hSCR);
     PowerMgr_notifyFWReset (pDrvMain->tStadHandles.hPowerMgr);
 
+    /* Save the recovery statistics (the FW configuration phase is the last) */
+    TWD_GetConfigFwStats (pDrvMain->tStadHandles.hTWD, &tConfigFwStats);
+    pStats->uNumOfRecoveries++;
+    pStats->uConfigTime    = os_timeStampMs(pDrvMain->tStadHandles.hOs) - pDrvMain->uRecoveryPhaseTime;
+    pStats->uReconnectTime = tConfigFwStats.uJoinTime;
+    pStats->uTotalTime     = os_timeStampMs(pDrvMain->tStadHandles.hOs) - pDrvMain->uRecoveryStartTime;
+    pStats->uJournalSteps  = tConfigFwStats.uJournalSteps;
+    pStats->uReplayedSteps = tConfigFwStats.uSteps;
+    pStats->uSkippedSteps  = tConfigFwStats.uSkippedSteps;
+    pStats->bJournalReplay = tConfigFwStats.bJournalReplay;
+    if (pStats->uTotalTime > pStats->uMaxTotalTime)
+    {
+        pStats->uMaxTotalTime = pStats->uTotalTime;
+    }
+
     TRACE1(pDrvMain->tStadHandles.hReport, REPORT_SEVERITY_CONSOLE, ".....drvMain_RecoveryNotify: End Of Recovery, ts=%d\n", os_timeStampMs(pDrvMain->tStadHandles.hOs));
     WLAN_OS_REPORT((".....drvMain_RecoveryNotify: End Of Recovery, ts=%d\n", os_timeStampMs(pDrvMain->tStadHandles.hOs)));
+    WLAN_OS_REPORT((".....Recovery time=%d: stop=%d, reload=%d, config=%d (reconnect=%d), steps=%d, skipped=%d\n", 
+                    pStats->uTotalTime, pStats->uStopTime, pStats->uFwReloadTime, pStats->uConfigTime, 
+                    pStats->uReconnectTime, pStats->uReplayedSteps, pStats->uSkippedSteps));
+}
+
+
+/* 
+ * \fn     drvMain_GetRecoveryStats
+ * \brief  Get the recovery statistics
+ * 
+ * Return the phases duration of the last recovery and its FW configuration replay statistics.
+ * 
+ * \note   
+ * \param  hDrvMain - The DrvMain object
+ * \param  pStats   - The output statistics
+ * \return void 
+ * \sa     drvMain_Recovery
+ */ 
+void drvMain_GetRecoveryStats (TI_HANDLE hDrvMain, TRecoveryStats *pStats)
+{
+    TDrvMain *pDrvMain = (TDrvMain *) hDrvMain;
+
+    os_memoryCopy (pDrvMain->tStadHandles.hOs, (void *)pStats, (void *)&pDrvMain->tRecoveryStats, sizeof(TRecoveryStats));
 }
 
 
@@ -1552,6 +1599,12 @@ static void drvMain_Sm (TI_HANDLE hDrvMain, ESmEvent eEvent)
             {
             	invokeCallback(pDrvMain->fFwInitDoneCb, pDrvMain->hFwInitDoneCb);
             }
+            else
+            {
+                /* The recovery FW reload phase is done */
+                pDrvMain->tRecoveryStats.uFwReloadTime = os_timeStampMs(hOs) - pDrvMain->uRecoveryPhaseTime;
+                pDrvMain->uRecoveryPhaseTime = os_timeStampMs(hOs);
+            }
 
 #ifdef OMAP_LEVEL_INT
             os_enableIrq(hOs);
@@ -1640,6 +1693,10 @@ static void drvMain_Sm (TI_HANDLE hDrvMain, ESmEvent eEvent)
             hPlatform_DevicePowerOff ();
             if (pDrvMain->bRecovery) 
             {
+                /* The recovery stop phase is done */
+                pDrvMain->tRecoveryStats.uStopTime = os_timeStampMs(hOs) - pDrvMain->uRecoveryPhaseTime;
+                pDrvMain->uRecoveryPhaseTime = os_timeStampMs(hOs);
+
                 hPlatform_DevicePowerOn ();
                 pDrvMain->eSmState = SM_STATE_WAIT_NVS_FILE;
                 pDrvMain->tFileInfo.eFileType = FILE_TYPE_NVS;
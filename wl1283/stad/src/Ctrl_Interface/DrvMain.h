@@ -57,6 +57,7 @@ TI_STATUS drvMain_Create 			(TI_HANDLE  hOs,
                                      TI_HANDLE *pPwrState);
 TI_STATUS drvMain_Destroy           (TI_HANDLE  hDrvMain);
 TI_STATUS drvMain_Recovery          (TI_HANDLE  hDrvMain);
+void      drvMain_GetRecoveryStats  (TI_HANDLE  hDrvMain, TRecoveryStats *pStats);
 TI_STATUS drvMain_Start(TI_HANDLE hDrvMain, void * fFwInitDoneCb, TI_HANDLE hFwInitDoneCb, void * fDrvMainStartedCb, TI_HANDLE hDrvMainStartedCb);
 TI_STATUS drvMain_Stop(TI_HANDLE hDrvMain, void * fCb, TI_HANDLE hCb);
 
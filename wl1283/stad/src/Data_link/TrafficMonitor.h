@@ -75,6 +75,38 @@ typedef struct
 }BandWidth_t;
 
 
+/* This enum holds the event providers that are optional in the system */
+typedef enum
+{
+        TX_TRAFF_MODULE                                 = 0,
+        RX_TRAFF_MODULE                         = 1,
+    MAX_NUM_MONITORED_MODULES  /* Don't move this enum this index defines the 
+                                  number of module that can be monitored.*/                   
+}MonModuleTypes_t;
+
+
+
+/* The max number of different event masks accumulated per module in batch mode (see TrafficBatch_t) */
+#define TRAFF_BATCH_MAX_MASKS  4
+
+/* TrafficBatchEntry_t 
+	The events of one event mask, accumulated in batch mode since the last alerts evaluation */
+typedef struct
+{
+    TI_UINT16           uMask;
+    TI_UINT32           uFrames;
+    TI_UINT32           uBytes;
+}TrafficBatchEntry_t;
+
+/* TrafficBatch_t 
+	The events of one module (Tx or Rx), accumulated in batch mode since the last alerts evaluation */
+typedef struct
+{
+    TI_UINT32           uNumEntries;
+    TrafficBatchEntry_t aEntries[TRAFF_BATCH_MAX_MASKS];
+}TrafficBatch_t;
+
+
 /* The traffic manger class structure */
 typedef struct
 {
@@ -98,23 +130,23 @@ typedef struct
 
     TI_HANDLE           hTrafficMonTimer;
 
+    /* Batch mode - the Tx/Rx events are only accumulated, and the alerts are evaluated on the   *
+     * window tick, or when the accumulated events may cross an "up" alert threshold            */
+    TI_BOOL             bBatchMode;
+    TrafficBatch_t      aBatch[MAX_NUM_MONITORED_MODULES];
+    TI_UINT32           uPendingFrames;     /* Events accumulated since the last evaluation */
+    TI_UINT32           uPendingBytes;      /* Their total length */
+    TI_UINT32           uFlushFrames;       /* Evaluate when uPendingFrames reaches this limit */
+    TI_UINT32           uFlushBytes;        /* Evaluate when uPendingBytes reaches this limit */
+    TI_HANDLE           hBatchTimer;        /* The window tick timer (runs while events are pending) */
+    TI_BOOL             bBatchTimerRunning;
+
 }TrafficMonitor_t;
 
 
 /* Function definition that used for event Aggregation/filtering/etc.. */
 typedef void (*TraffActionFunc_t)(TI_HANDLE TraffElem,int Count); 
                 
-/* This enum holds the event providers that are optional in the system */
-typedef enum
-{
-        TX_TRAFF_MODULE                                 = 0,
-        RX_TRAFF_MODULE                         = 1,
-    MAX_NUM_MONITORED_MODULES  /* Don't move this enum this index defines the 
-                                  number of module that can be monitored.*/                   
-}MonModuleTypes_t;
-
-
-
 /*
  *      Alert State option enum 
  *  0.  disabled
@@ -49,127 +49,333 @@
 
 
 
+/*
+ * The classification table (tClsfrParams.ClsfrTable) remains the reference copy of the
+ * classifier entries. For the per-packet lookup it is shadowed by:
+ *  - aHash:      An open-addressing (linear probing) index of the table entries, keyed by
+ *                the code point (DSCP), the port (Port) or the IP address & port (IP&Port).
+ *                Used for O(1) conflict checks, removals and Port / IP&Port classification.
+ *  - aTosToDtag: The D-Tag of each value of the IP header TOS byte (DSCP classification).
+ *  - aFlowCache: The classification result of recently transmitted IP flows, keyed by the
+ *                5-tuple read at fixed offsets, so it is looked up before the headers are parsed.
+ *                Invalidated by incrementing uGeneration on any table change.
+ * All are updated under the context critical section, as is the packet classification.
+ */
+
+
+/** 
+ * \fn     clsfrHash
+ * \brief  Get the home slot of a classifier key in the hash
+ *
+ * \note   A local inline function!
+ * \param  uIpAddr - The IP address (0 for the DSCP and Port classifiers)
+ * \param  uPort   - The port number (or the code point for the DSCP classifier)
+ * \return The home slot index
+ * \sa     
+ */
+static inline TI_UINT32 clsfrHash (TI_UINT32 uIpAddr, TI_UINT32 uPort)
+{
+    TI_UINT32 uHash = (uIpAddr ^ (uPort << 16) ^ uPort) * 0x9E3779B1;
+
+    return (uHash >> 16) & (CLSFR_HASH_SIZE - 1);
+}
+
+
+/** 
+ * \fn     clsfrGetEntryKey
+ * \brief  Get the hash key of a classifier table entry according to the classifier type
+ *
+ * \note   A local inline function!
+ * \param  eClsfrType - The classifier type
+ * \param  pEntry     - The classifier table entry
+ * \param  pIpAddr    - Returns the entry IP address (0 if not applicable)
+ * \param  pPort      - Returns the entry port (or code point)
+ * \return void
+ * \sa     
+ */
+static inline void clsfrGetEntryKey (EClsfrType eClsfrType, TClsfrTableEntry *pEntry, TI_UINT32 *pIpAddr, TI_UINT32 *pPort)
+{
+    switch (eClsfrType)
+    {
+        case DSCP_CLSFR:
+            *pIpAddr = 0;
+            *pPort   = pEntry->Dscp.CodePoint;
+            break;
+
+        case PORT_CLSFR:
+            *pIpAddr = 0;
+            *pPort   = pEntry->Dscp.DstPortNum;
+            break;
+
+        default: /* IPPORT_CLSFR */
+            *pIpAddr = pEntry->Dscp.DstIPPort.DstIPAddress;
+            *pPort   = pEntry->Dscp.DstIPPort.DstPortNum;
+            break;
+    }
+}
+
+
+/** 
+ * \fn     clsfrHashFind
+ * \brief  Find the hash slot of a classifier key
+ *
+ * \note   
+ * \param  pTxDataQ - The object
+ * \param  uIpAddr  - The IP address (0 for the DSCP and Port classifiers)
+ * \param  uPort    - The port number (or the code point for the DSCP classifier)
+ * \return The slot index, or CLSFR_HASH_SIZE if the key is not in the table
+ * \sa     
+ */
+static TI_UINT32 clsfrHashFind (TTxDataQ *pTxDataQ, TI_UINT32 uIpAddr, TI_UINT32 uPort)
+{
+    TClsfrParams *pClsfrParams = &pTxDataQ->tClsfrParams;
+    TI_UINT8     *pHash = pTxDataQ->tClsfrLookup.aHash;
+    TI_UINT32     uSlot = clsfrHash (uIpAddr, uPort);
+    TI_UINT32     uEntryIpAddr, uEntryPort;
+    TI_UINT32     i;
+
+    for (i = 0; (i < CLSFR_HASH_SIZE) && (pHash[uSlot] != CLSFR_HASH_EMPTY); i++)
+    {
+        clsfrGetEntryKey (pClsfrParams->eClsfrType, &pClsfrParams->ClsfrTable[pHash[uSlot]], &uEntryIpAddr, &uEntryPort);
+        if ((uEntryIpAddr == uIpAddr) && (uEntryPort == uPort))
+        {
+            return uSlot;
+        }
+        uSlot = (uSlot + 1) & (CLSFR_HASH_SIZE - 1);
+    }
+
+    return CLSFR_HASH_SIZE;
+}
+
+
+/** 
+ * \fn     clsfrHashAdd
+ * \brief  Add a classifier table entry to the hash
+ *
+ * \note   The caller verifies the entry key is not already in the hash.
+ * \param  pTxDataQ - The object
+ * \param  uEntry   - The entry index in the classifier table
+ * \return void
+ * \sa     clsfrHashRemove
+ */
+static void clsfrHashAdd (TTxDataQ *pTxDataQ, TI_UINT32 uEntry)
+{
+    TClsfrParams *pClsfrParams = &pTxDataQ->tClsfrParams;
+    TI_UINT8     *pHash = pTxDataQ->tClsfrLookup.aHash;
+    TI_UINT32     uIpAddr, uPort, uSlot;
+
+    clsfrGetEntryKey (pClsfrParams->eClsfrType, &pClsfrParams->ClsfrTable[uEntry], &uIpAddr, &uPort);
+
+    /* The hash is at least twice the table size, so a free slot is always found */
+    uSlot = clsfrHash (uIpAddr, uPort);
+    while (pHash[uSlot] != CLSFR_HASH_EMPTY)
+    {
+        uSlot = (uSlot + 1) & (CLSFR_HASH_SIZE - 1);
+    }
+    pHash[uSlot] = (TI_UINT8)uEntry;
+}
+
+
+/** 
+ * \fn     clsfrHashRemove
+ * \brief  Free a hash slot
+ *
+ * Free the given slot, and move back the following entries of its probe sequence
+ *   that would otherwise become unreachable (backward shift deletion).
+ *
+ * \note   
+ * \param  pTxDataQ - The object
+ * \param  uSlot    - The slot to free
+ * \return void
+ * \sa     clsfrHashAdd
+ */
+static void clsfrHashRemove (TTxDataQ *pTxDataQ, TI_UINT32 uSlot)
+{
+    TClsfrParams *pClsfrParams = &pTxDataQ->tClsfrParams;
+    TI_UINT8     *pHash = pTxDataQ->tClsfrLookup.aHash;
+    TI_UINT32     uNext = uSlot;
+    TI_UINT32     uIpAddr, uPort, uHome;
+
+    while (1)
+    {
+        uNext = (uNext + 1) & (CLSFR_HASH_SIZE - 1);
+        if (pHash[uNext] == CLSFR_HASH_EMPTY)
+        {
+            break;
+        }
+
+        clsfrGetEntryKey (pClsfrParams->eClsfrType, &pClsfrParams->ClsfrTable[pHash[uNext]], &uIpAddr, &uPort);
+        uHome = clsfrHash (uIpAddr, uPort);
+
+        /* Move the entry to the free slot unless its home slot lies cyclically in (uSlot, uNext] */
+        if (((uNext - uHome) & (CLSFR_HASH_SIZE - 1)) >= ((uNext - uSlot) & (CLSFR_HASH_SIZE - 1)))
+        {
+            pHash[uSlot] = pHash[uNext];
+            uSlot = uNext;
+        }
+    }
+
+    pHash[uSlot] = CLSFR_HASH_EMPTY;
+}
+
+
+/** 
+ * \fn     clsfrSetTosDtag
+ * \brief  Set the D-Tag of a DSCP code point in the TOS table
+ *
+ * \note   A local inline function! Each code point covers the four values of the ECN bits.
+ * \param  pTxDataQ   - The object
+ * \param  uCodePoint - The DSCP code point
+ * \param  uDTag      - The D-Tag, or CLSFR_DTAG_NONE to clear the code point
+ * \return void
+ * \sa     
+ */
+static inline void clsfrSetTosDtag (TTxDataQ *pTxDataQ, TI_UINT32 uCodePoint, TI_UINT8 uDTag)
+{
+    TI_UINT8 *pTos;
+
+    /* Code points out of the 6 bits range can't match any packet */
+    if (uCodePoint > CLASSIFIER_CODE_POINT_MAX)
+    {
+        return;
+    }
+
+    pTos = &pTxDataQ->tClsfrLookup.aTosToDtag[uCodePoint << 2];
+    pTos[0] = pTos[1] = pTos[2] = pTos[3] = uDTag;
+}
+
+
+/** 
+ * \fn     clsfrInvalidateFlowCache
+ * \brief  Invalidate all flow cache entries
+ *
+ * \note   A local inline function!
+ * \param  pTxDataQ - The object
+ * \return void
+ * \sa     
+ */
+static inline void clsfrInvalidateFlowCache (TTxDataQ *pTxDataQ)
+{
+    /* Generation 0 marks a never filled entry */
+    if (++pTxDataQ->tClsfrLookup.uGeneration == 0)
+    {
+        pTxDataQ->tClsfrLookup.uGeneration = 1;
+        os_memoryZero (pTxDataQ->hOs, pTxDataQ->tClsfrLookup.aFlowCache, sizeof(pTxDataQ->tClsfrLookup.aFlowCache));
+    }
+}
+
+
+/** 
+ * \fn     clsfrResetLookup
+ * \brief  Empty the classifier lookup structures
+ *
+ * \note   
+ * \param  pTxDataQ - The object
+ * \return void
+ * \sa     
+ */
+static void clsfrResetLookup (TTxDataQ *pTxDataQ)
+{
+    os_memorySet (pTxDataQ->hOs, pTxDataQ->tClsfrLookup.aHash, CLSFR_HASH_EMPTY, sizeof(pTxDataQ->tClsfrLookup.aHash));
+    os_memorySet (pTxDataQ->hOs, pTxDataQ->tClsfrLookup.aTosToDtag, CLSFR_DTAG_NONE, sizeof(pTxDataQ->tClsfrLookup.aTosToDtag));
+    clsfrInvalidateFlowCache (pTxDataQ);
+}
+
+
+/** 
+ * \fn     clsfrAddEntry
+ * \brief  Append an entry to the classifier table
+ *
+ * Append the entry to the classifier table and add it to the lookup structures.
+ *
+ * \note   The caller checks the table is not full and the entry is valid.
+ * \param  pTxDataQ - The object
+ * \param  pEntry   - The new entry
+ * \return TI_OK on success, TI_NOK if the entry conflicts with an existing entry
+ * \sa     
+ */
+static TI_STATUS clsfrAddEntry (TTxDataQ *pTxDataQ, TClsfrTableEntry *pEntry)
+{
+    TClsfrParams *pClsfrParams = &pTxDataQ->tClsfrParams;
+    TI_UINT32     uIpAddr, uPort;
+    TI_UINT32     uEntry = pClsfrParams->uNumActiveEntries;
+
+    /* Detect both duplicate and conflicting entries */
+    clsfrGetEntryKey (pClsfrParams->eClsfrType, pEntry, &uIpAddr, &uPort);
+    if (clsfrHashFind (pTxDataQ, uIpAddr, uPort) != CLSFR_HASH_SIZE)
+    {
+        return TI_NOK;
+    }
+
+    pClsfrParams->ClsfrTable[uEntry] = *pEntry;
+    clsfrHashAdd (pTxDataQ, uEntry);
+    if (pClsfrParams->eClsfrType == DSCP_CLSFR)
+    {
+        clsfrSetTosDtag (pTxDataQ, pEntry->Dscp.CodePoint, pEntry->DTag);
+    }
+    clsfrInvalidateFlowCache (pTxDataQ);
+
+    pClsfrParams->uNumActiveEntries++;
+
+    return TI_OK;
+}
+
+
 /** 
  * \fn     txDataClsfr_Config 
  * \brief  Configure the classifier paramters
- * 
+ *
  * Configure the classifier parameters according to the init parameters.
  * Called from the txDataQueue configuration function.
- * 
+ *
  * \note   
  * \param  hTxDataQ     - The object handle                                         
  * \param  pClsfrInitParams - Pointer to the classifier init params
  * \return TI_OK on success or TI_NOK on failure 
  * \sa     
- */ 
+ */
 TI_STATUS txDataClsfr_Config (TI_HANDLE hTxDataQ, TClsfrParams *pClsfrInitParams)
 {
     TTxDataQ     *pTxDataQ = (TTxDataQ *)hTxDataQ;
     TClsfrParams *pParams  = &pTxDataQ->tClsfrParams; /* where to save the new params */
-    TI_UINT32     uActualEntryCount;
-    TI_UINT32     i, j;
-    TI_BOOL       bConflictFound;
-    
+    TI_UINT32     uNumInitEntries;
+    TI_UINT32     i;
+
     /* Active classification algorithm */
     pParams->eClsfrType = pClsfrInitParams->eClsfrType;
+    pParams->uNumActiveEntries = 0;
+    clsfrResetLookup (pTxDataQ);
 
-    /* the number of active entries */
+    /* the number of init entries */
     if (pClsfrInitParams->uNumActiveEntries <= NUM_OF_CLSFR_TABLE_ENTRIES)
-        pParams->uNumActiveEntries = pClsfrInitParams->uNumActiveEntries;
+        uNumInitEntries = pClsfrInitParams->uNumActiveEntries;
     else 
-        pParams->uNumActiveEntries = NUM_OF_CLSFR_TABLE_ENTRIES;
+        uNumInitEntries = NUM_OF_CLSFR_TABLE_ENTRIES;
 
     /* Initialization of the classification table */
     switch (pParams->eClsfrType)
     {
         case D_TAG_CLSFR:
-			pParams->uNumActiveEntries = 0;
-        break;
-        
-        case DSCP_CLSFR:
-            uActualEntryCount=0;
-            for (i = 0; i < pParams->uNumActiveEntries; i++)
-            {
-               bConflictFound = TI_FALSE;
-                /* check conflict */
-                for (j = 0; j < i; j++)
-                {
-                   /* Detect both duplicate and conflicting entries */
-                    if (pParams->ClsfrTable[j].Dscp.CodePoint == pClsfrInitParams->ClsfrTable[i].Dscp.CodePoint)
-                    {
-                        TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_WARNING , "ERROR: txDataClsfr_Config(): duplicate/conflicting classifier entries\n");
-                        bConflictFound = TI_TRUE;
-                    }
-                }
-                if (bConflictFound == TI_FALSE)
-                {
-                  pParams->ClsfrTable[uActualEntryCount].Dscp.CodePoint = pClsfrInitParams->ClsfrTable[i].Dscp.CodePoint;
-                  pParams->ClsfrTable[uActualEntryCount].DTag = pClsfrInitParams->ClsfrTable[i].DTag;
-                  uActualEntryCount++;
-                }
-            }
-            pParams->uNumActiveEntries = uActualEntryCount;
         break;
 
+        case DSCP_CLSFR:
         case PORT_CLSFR:
-           uActualEntryCount=0;
-            for (i = 0; (i < pParams->uNumActiveEntries) ; i++)
-            {
-				bConflictFound = TI_FALSE;
-                /* check conflict */
-                for (j = 0; j < i; j++)
-                {
-                    /* Detect both duplicate and conflicting entries */
-                    if (pParams->ClsfrTable[j].Dscp.DstPortNum == pClsfrInitParams->ClsfrTable[i].Dscp.DstPortNum)
-                    {
-                        TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_WARNING , "ERROR: txDataClsfr_Config(): classifier entries conflict\n");
-                        bConflictFound = TI_TRUE;
-                    }
-                }
-                if (bConflictFound == TI_FALSE)
-                {
-                  pParams->ClsfrTable[uActualEntryCount].Dscp.DstPortNum = pClsfrInitParams->ClsfrTable[i].Dscp.DstPortNum;
-                  pParams->ClsfrTable[uActualEntryCount].DTag = pClsfrInitParams->ClsfrTable[i].DTag;
-                  uActualEntryCount++;
-                }
-            }
-            pParams->uNumActiveEntries = uActualEntryCount;
-        break;  
-
         case IPPORT_CLSFR:
-           uActualEntryCount=0;
-            for (i=0; (i < pParams->uNumActiveEntries ) ; i++)
+            for (i = 0; i < uNumInitEntries; i++)
             {
-				bConflictFound = TI_FALSE;
-                /* check conflict */
-                for (j = 0; j < i; j++)
-                {
-                   /* Detect both duplicate and conflicting entries */
-                    if ((pParams->ClsfrTable[j].Dscp.DstIPPort.DstIPAddress == pClsfrInitParams->ClsfrTable[i].Dscp.DstIPPort.DstIPAddress)&& 
-                    (pParams->ClsfrTable[j].Dscp.DstIPPort.DstPortNum == pClsfrInitParams->ClsfrTable[i].Dscp.DstIPPort.DstPortNum))
-                    {
-                        TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_WARNING , "ERROR: txDataClsfr_Config(): classifier entries conflict\n");
-                        bConflictFound = TI_TRUE;
-                    }
-                }
-                if (bConflictFound == TI_FALSE)
+                if (clsfrAddEntry (pTxDataQ, &pClsfrInitParams->ClsfrTable[i]) != TI_OK)
                 {
-                  pParams->ClsfrTable[uActualEntryCount].Dscp.DstIPPort.DstIPAddress = pClsfrInitParams->ClsfrTable[i].Dscp.DstIPPort.DstIPAddress;
-                  pParams->ClsfrTable[uActualEntryCount].Dscp.DstIPPort.DstPortNum = pClsfrInitParams->ClsfrTable[i].Dscp.DstIPPort.DstPortNum;
-                  pParams->ClsfrTable[uActualEntryCount].DTag = pClsfrInitParams->ClsfrTable[i].DTag;
-                  uActualEntryCount++;
+                    TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_WARNING , "ERROR: txDataClsfr_Config(): duplicate/conflicting classifier entries\n");
                 }
             }
-            pParams->uNumActiveEntries = uActualEntryCount;
-        break;  
+        break;
 
         default:
             TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_WARNING , "ERROR: txDataClsfr_Config(): Classifier type -- unknown --> set to D-Tag\n");
             pParams->eClsfrType = D_TAG_CLSFR;
-			pParams->uNumActiveEntries = 0;
-        break;  
+        break;
     }
-    
+
     return TI_OK;
 }
 
@@ -177,7 +383,7 @@ TI_STATUS txDataClsfr_Config (TI_HANDLE hTxDataQ, TClsfrParams *pClsfrInitParams
 /** 
  * \fn     getIpAndUdpHeader 
  * \brief  Get IP & UDP headers addresses if exist
- * 
+ *
  * This function gets the addresses of the IP and UDP headers
  *
  * \note   A local inline function!
@@ -187,7 +393,7 @@ TI_STATUS txDataClsfr_Config (TI_HANDLE hTxDataQ, TClsfrParams *pClsfrInitParams
  * \param  pUdpHeader  - Pointer to pointer to UDP header 
  * \return TI_OK on success, TI_NOK if it's not an IP packet
  * \sa     
- */ 
+ */
 static inline TI_STATUS getIpAndUdpHeader(TTxDataQ   *pTxDataQ, 
                                           TTxCtrlBlk *pPktCtrlBlk,
                                           TI_UINT8  **pIpHeader, 
@@ -195,7 +401,7 @@ static inline TI_STATUS getIpAndUdpHeader(TTxDataQ   *pTxDataQ,
 {
     TI_UINT8 *pEthHead = pPktCtrlBlk->tTxnStruct.aBuf[0];
 	TI_UINT8  ipHeaderLen = 0;
-  
+
 	/* check if frame is IP according to ether type */
     if( ( HTOWLANS(((TEthernetHeader *)pEthHead)->type) ) != ETHERTYPE_IP)
     {
@@ -221,10 +427,137 @@ static inline TI_STATUS getIpAndUdpHeader(TTxDataQ   *pTxDataQ,
 }
 
 
+/** 
+ * \fn     clsfrFlowCacheFind
+ * \brief  Look for a packet flow in the flow cache, before parsing the packet headers
+ *
+ * Read the packet 5-tuple at the fixed offsets of an IPv4 header without options
+ *   and look for it in its flow cache entry. On a miss, the entry is invalidated and
+ *   takes the packet 5-tuple, to be completed with the classification result.
+ * Other packets (non IP, IP options or too short) are not cached.
+ *
+ * \note   A local inline function! Called within the context critical section.
+ * \param  pTxDataQ    - The object
+ * \param  pPktCtrlBlk - Pointer to the packet
+ * \param  pFlow       - Return the packet flow cache entry (NULL if the packet is not cached)
+ * \return TI_TRUE if the entry holds the packet classification result, TI_FALSE if not
+ * \sa     clsfrClassifyFlow
+ */
+static inline TI_BOOL clsfrFlowCacheFind (TTxDataQ *pTxDataQ, TTxCtrlBlk *pPktCtrlBlk, TClsfrFlowEntry **pFlow)
+{
+    TClsfrLookup    *pLookup   = &pTxDataQ->tClsfrLookup;
+    TI_UINT8        *pIpHeader = pPktCtrlBlk->tTxnStruct.aBuf[1];
+    TClsfrFlowEntry *pEntry;
+    TI_UINT32        uSrcIpAdd, uDstIpAdd, uPorts, uIdx;
+    TI_UINT8         uProtocol;
+
+    *pFlow = NULL;
+
+    if ((pPktCtrlBlk->tTxnStruct.aLen[1] < CLSFR_FLOW_KEY_LEN) ||
+        (*pIpHeader != CLSFR_FLOW_IP_VER_IHL) ||
+        (HTOWLANS(((TEthernetHeader *)pPktCtrlBlk->tTxnStruct.aBuf[0])->type) != ETHERTYPE_IP))
+    {
+        return TI_FALSE;
+    }
+
+    uSrcIpAdd = *((TI_UINT32 *)(pIpHeader + 12));
+    uDstIpAdd = *((TI_UINT32 *)(pIpHeader + 16));
+    uPorts    = *((TI_UINT32 *)(pIpHeader + CLSFR_FLOW_KEY_LEN - 4));
+    uProtocol = *(pIpHeader + 9);
+
+    uIdx  = uSrcIpAdd ^ uDstIpAdd ^ uPorts ^ uProtocol;
+    uIdx ^= (uIdx >> 16);
+    uIdx ^= (uIdx >> 8);
+    pEntry = &pLookup->aFlowCache[uIdx & (CLSFR_FLOW_CACHE_SIZE - 1)];
+    *pFlow = pEntry;
+
+    if ((pEntry->uGeneration == pLookup->uGeneration) &&
+        (pEntry->uDstIpAddr  == uDstIpAdd) &&
+        (pEntry->uPorts      == uPorts)    &&
+        (pEntry->uSrcIpAddr  == uSrcIpAdd) &&
+        (pEntry->uProtocol   == uProtocol))
+    {
+        pLookup->uFlowCacheHits++;
+        return TI_TRUE;
+    }
+    pLookup->uFlowCacheMisses++;
+
+    pEntry->uGeneration = 0;
+    pEntry->uSrcIpAddr  = uSrcIpAdd;
+    pEntry->uDstIpAddr  = uDstIpAdd;
+    pEntry->uPorts      = uPorts;
+    pEntry->uProtocol   = uProtocol;
+
+    return TI_FALSE;
+}
+
+
+/** 
+ * \fn     clsfrClassifyFlow
+ * \brief  Classify a packet by its destination port or destination IP address & port
+ *
+ * Repeated flows get their D-Tag from the flow cache, without parsing the packet headers.
+ *   Otherwise, parse the IP & UDP headers, look for the destination port (or IP address & port)
+ *   in the classifier hash and cache the result.
+ *
+ * \note   Called within the context critical section.
+ * \param  pTxDataQ    - The object
+ * \param  pPktCtrlBlk - Pointer to the packet
+ * \param  pDTag       - Return the packet D-Tag (0 if no entry matches)
+ * \return TI_OK on success, TI_NOK if it's not an IP packet
+ * \sa     txDataClsfr_ClassifyTxPacket
+ */
+static TI_STATUS clsfrClassifyFlow (TTxDataQ *pTxDataQ, TTxCtrlBlk *pPktCtrlBlk, TI_UINT8 *pDTag)
+{
+    TClsfrParams    *pClsfrParams = &pTxDataQ->tClsfrParams;
+    TClsfrLookup    *pLookup = &pTxDataQ->tClsfrLookup;
+    TClsfrFlowEntry *pFlow;
+    TI_UINT8        *pIpHeader = NULL;
+    TI_UINT8        *pUdpHeader = NULL;
+    TI_UINT16        uDstUdpPort;
+    TI_UINT32        uSlot;
+
+    if (clsfrFlowCacheFind (pTxDataQ, pPktCtrlBlk, &pFlow))
+    {
+        *pDTag = pFlow->uDTag;
+        return TI_OK;
+    }
+
+    if ((getIpAndUdpHeader (pTxDataQ, pPktCtrlBlk, &pIpHeader, &pUdpHeader) != TI_OK) ||
+        (pIpHeader == NULL) || (pUdpHeader == NULL))
+    {
+        return TI_NOK;
+    }
+
+    uDstUdpPort = *((TI_UINT16 *)(pUdpHeader + 2));
+    uDstUdpPort = HTOWLANS(uDstUdpPort);
+
+    if (pClsfrParams->eClsfrType == PORT_CLSFR)
+    {
+        uSlot = clsfrHashFind (pTxDataQ, 0, uDstUdpPort);
+    }
+    else 
+    {
+        uSlot = clsfrHashFind (pTxDataQ, *((TI_UINT32 *)(pIpHeader + 16)), uDstUdpPort);
+    }
+
+    *pDTag = (uSlot == CLSFR_HASH_SIZE) ? 0 : pClsfrParams->ClsfrTable[pLookup->aHash[uSlot]].DTag;
+
+    /* Complete the flow cache entry of a cached packet */
+    if (pFlow != NULL)
+    {
+        pFlow->uDTag       = *pDTag;
+        pFlow->uGeneration = pLookup->uGeneration;
+    }
+
+    return TI_OK;
+}
+
+
 /** 
  * \fn     txDataClsfr_ClassifyTxPacket 
  * \brief  Configure the classifier paramters
- * 
+ *
  * This function classifies the given Tx packet according to the classifier parameters. 
  * It sets the TID field with the classification result.
  * The classification is according to one of the following methods:
@@ -239,17 +572,14 @@ static inline TI_STATUS getIpAndUdpHeader(TTxDataQ   *pTxDataQ,
  * \param  uPacketDtag - The packet priority optionaly set by the OAL
  * \return TI_OK on success, PARAM_VALUE_NOT_VALID in case of input parameters problems.
  * \sa     
- */ 
+ */
 TI_STATUS txDataClsfr_ClassifyTxPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk, TI_UINT8 uPacketDtag)
 {
     TTxDataQ     *pTxDataQ = (TTxDataQ *)hTxDataQ;
     TClsfrParams *pClsfrParams = &pTxDataQ->tClsfrParams;
     TI_UINT8     *pUdpHeader = NULL;
     TI_UINT8     *pIpHeader = NULL;
-    TI_UINT8   uDscp;
-    TI_UINT16  uDstUdpPort;
-    TI_UINT32  uDstIpAdd;
-    TI_UINT32  i;
+    TI_UINT8      uDTag;
 
     pPktCtrlBlk->tTxDescriptor.tid = 0;
 
@@ -274,73 +604,37 @@ TI_STATUS txDataClsfr_ClassifyTxPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrl
 				return PARAM_VALUE_NOT_VALID; 
             }
 
-            /* DSCP to D-tag mapping */
-            uDscp =  *((TI_UINT8 *)(pIpHeader + 1)); /* Fetching the DSCP from the header */
-            uDscp = (uDscp >> 2);
-            
-            /* looking for the specific DSCP, if found, its corresponding D-tag is set to the TID */
-            for(i = 0; i < pClsfrParams->uNumActiveEntries; i++)
+            /* DSCP to D-tag mapping, indexed directly by the TOS byte (DSCP + ECN bits) */
+            uDTag = pTxDataQ->tClsfrLookup.aTosToDtag[*(pIpHeader + 1)];
+            if (uDTag != CLSFR_DTAG_NONE)
             {
-                if (pClsfrParams->ClsfrTable[i].Dscp.CodePoint == uDscp)
-				{
-                    pPktCtrlBlk->tTxDescriptor.tid = pClsfrParams->ClsfrTable[i].DTag;
-                    TRACE2(pTxDataQ->hReport, REPORT_SEVERITY_INFORMATION , "Classifier DSCP_CLSFR found match - entry %d - Tid = %d\n",i,pPktCtrlBlk->tTxDescriptor.tid);
-					break;
-				}
+                pPktCtrlBlk->tTxDescriptor.tid = uDTag;
+                TRACE1(pTxDataQ->hReport, REPORT_SEVERITY_INFORMATION , "Classifier DSCP_CLSFR found match - Tid = %d\n", uDTag);
             }
         break;
 
         case PORT_CLSFR:
-            if( (getIpAndUdpHeader(pTxDataQ, pPktCtrlBlk, &pIpHeader, &pUdpHeader) != TI_OK) ||
-                (pUdpHeader == NULL) )
+            if (clsfrClassifyFlow (pTxDataQ, pPktCtrlBlk, &uDTag) != TI_OK)
             {
                 TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_INFORMATION, " txDataClsfr_ClassifyTxPacket() : DstPort clsfr, getIpAndUdpHeader error\n");
-                return PARAM_VALUE_NOT_VALID; 
+                return PARAM_VALUE_NOT_VALID;
             }
 
-            uDstUdpPort = *((TI_UINT16 *)(pUdpHeader + 2));
-            uDstUdpPort = HTOWLANS(uDstUdpPort);
-            
-            /* Looking for the specific port number. If found, its corresponding D-tag is set to the TID. */
-            for(i = 0; i < pClsfrParams->uNumActiveEntries; i++)
-            {
-                if (pClsfrParams->ClsfrTable[i].Dscp.DstPortNum == uDstUdpPort)
-				{
-                    pPktCtrlBlk->tTxDescriptor.tid = pClsfrParams->ClsfrTable[i].DTag;
-                    TRACE2(pTxDataQ->hReport, REPORT_SEVERITY_INFORMATION , "Classifier PORT_CLSFR found match - entry %d - Tid = %d\n", i, pPktCtrlBlk->tTxDescriptor.tid);
-					break;
-				}
-            }
+            pPktCtrlBlk->tTxDescriptor.tid = uDTag;
+            TRACE1(pTxDataQ->hReport, REPORT_SEVERITY_INFORMATION , "Classifier PORT_CLSFR - Tid = %d\n", pPktCtrlBlk->tTxDescriptor.tid);
         break;
 
-        case IPPORT_CLSFR: 
-            if ( (getIpAndUdpHeader(pTxDataQ, pPktCtrlBlk, &pIpHeader, &pUdpHeader) != TI_OK) 
-                 || (pIpHeader == NULL) || (pUdpHeader == NULL) )
+        case IPPORT_CLSFR:
+            if (clsfrClassifyFlow (pTxDataQ, pPktCtrlBlk, &uDTag) != TI_OK)
             {
                 TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_INFORMATION, "txDataClsfr_ClassifyTxPacket(): Dst IP&Port clsfr, getIpAndUdpHeader error\n");
-                return PARAM_VALUE_NOT_VALID; 
+                return PARAM_VALUE_NOT_VALID;
             }
 
-            uDstUdpPort = *((TI_UINT16 *)(pUdpHeader + 2));
-            uDstUdpPort = HTOWLANS(uDstUdpPort);
-            uDstIpAdd = *((TI_UINT32 *)(pIpHeader + 16));
-            
-            /* 
-             * Looking for the specific pair of dst IP address and dst port number.
-             * If found, its corresponding D-tag is set to the TID.                                                         
-             */
-            for(i = 0; i < pClsfrParams->uNumActiveEntries; i++)
-            {
-                if ((pClsfrParams->ClsfrTable[i].Dscp.DstIPPort.DstIPAddress == uDstIpAdd) &&
-                    (pClsfrParams->ClsfrTable[i].Dscp.DstIPPort.DstPortNum == uDstUdpPort))
-				{
-                    pPktCtrlBlk->tTxDescriptor.tid = pClsfrParams->ClsfrTable[i].DTag;
-                    TRACE2(pTxDataQ->hReport, REPORT_SEVERITY_INFORMATION , "Classifier IPPORT_CLSFR found match - entry %d - Tid = %d\n", i, pPktCtrlBlk->tTxDescriptor.tid);
-					break;
-				}
-            }
+            pPktCtrlBlk->tTxDescriptor.tid = uDTag;
+            TRACE1(pTxDataQ->hReport, REPORT_SEVERITY_INFORMATION , "Classifier IPPORT_CLSFR - Tid = %d\n", pPktCtrlBlk->tTxDescriptor.tid);
         break;
-        
+
         default:
             TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "txDataClsfr_ClassifyTxPacket(): eClsfrType error\n");
     }
@@ -352,7 +646,7 @@ TI_STATUS txDataClsfr_ClassifyTxPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrl
 /** 
  * \fn     txDataClsfr_InsertClsfrEntry 
  * \brief  Insert a new entry to classifier table
- * 
+ *
  * Add a new entry to the classification table.
  * If the new entry is invalid or conflicts with existing entries, the operation is canceled.
  *
@@ -361,68 +655,45 @@ TI_STATUS txDataClsfr_ClassifyTxPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrl
  * \param  pNewEntry    - Pointer to the new entry to insert
  * \return TI_OK on success, PARAM_VALUE_NOT_VALID in case of input parameters problems.
  * \sa     txDataClsfr_RemoveClsfrEntry
- */ 
+ */
 TI_STATUS txDataClsfr_InsertClsfrEntry(TI_HANDLE hTxDataQ, TClsfrTableEntry *pNewEntry)
 {
     TTxDataQ      *pTxDataQ     = (TTxDataQ *)hTxDataQ;
     TClsfrParams  *pClsfrParams = &pTxDataQ->tClsfrParams;
-    TI_UINT32     i;
+    TI_STATUS      eStatus;
 
 	if(pNewEntry == NULL)
     {
         TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): NULL ConfigBuffer pointer Error - Aborting\n");
 		return PARAM_VALUE_NOT_VALID;
     }
-    
+
     /* If no available entries, exit */
     if (pClsfrParams->uNumActiveEntries == NUM_OF_CLSFR_TABLE_ENTRIES)
     {
         TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): Bad Number Of Entries - Aborting\n");
         return PARAM_VALUE_NOT_VALID;
     }
-    
+
     if (pClsfrParams->eClsfrType == D_TAG_CLSFR)
     {
         TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): D-Tag classifier - Aborting\n");
         return PARAM_VALUE_NOT_VALID;
     }
 
-    /* Check new entry and conflict with existing entries and if OK, insert to classifier table */
+    /* Check new entry */
     switch (pClsfrParams->eClsfrType)
     {
         case DSCP_CLSFR:
-    
-            /* Check entry */
             if ( (pNewEntry->Dscp.CodePoint > CLASSIFIER_CODE_POINT_MAX) || 
                  (pNewEntry->DTag > CLASSIFIER_DTAG_MAX) ) 
             {
                 TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): bad parameter - Aborting\n");
                 return PARAM_VALUE_NOT_VALID;
             }
-            
-            /* Check conflict*/
-            for (i = 0; i < pClsfrParams->uNumActiveEntries; i++)
-            {
-               /* Detect both duplicate and conflicting entries */
-                if (pClsfrParams->ClsfrTable[i].Dscp.CodePoint == pNewEntry->Dscp.CodePoint)
-                {
-                    TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): classifier entries conflict - Aborting\n");
-                    return PARAM_VALUE_NOT_VALID;
-                }
-            } 
-
-            /* Insert new entry to classifier table. */
-            /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
-            context_EnterCriticalSection (pTxDataQ->hContext);
-            pClsfrParams->ClsfrTable[pClsfrParams->uNumActiveEntries].Dscp.CodePoint = pNewEntry->Dscp.CodePoint;
-            pClsfrParams->ClsfrTable[pClsfrParams->uNumActiveEntries].DTag = pNewEntry->DTag;
-            context_LeaveCriticalSection (pTxDataQ->hContext);
-            
         break;
-        
-        case PORT_CLSFR:
 
-            /* Check entry */
+        case PORT_CLSFR:
             if ((pNewEntry->DTag > CLASSIFIER_DTAG_MAX) || 
                 (pNewEntry->Dscp.DstPortNum > CLASSIFIER_PORT_MAX-1) || 
                 (pNewEntry->Dscp.DstPortNum < CLASSIFIER_PORT_MIN) )
@@ -430,30 +701,9 @@ TI_STATUS txDataClsfr_InsertClsfrEntry(TI_HANDLE hTxDataQ, TClsfrTableEntry *pNe
                 TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): bad parameter - Aborting\n");
                 return PARAM_VALUE_NOT_VALID;
             }
-            
-            /* Check conflict*/
-            for (i = 0; i < pClsfrParams->uNumActiveEntries; i++)
-            {
-               /* Detect both duplicate and conflicting entries */
-                if ((pClsfrParams->ClsfrTable[i].Dscp.DstPortNum == pNewEntry->Dscp.DstPortNum))
-                {
-                    TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): classifier entries conflict - Aborting\n");
-                     return PARAM_VALUE_NOT_VALID;
-                }
-            }     
-
-            /* Insert new entry to classifier table. */            
-            /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
-            context_EnterCriticalSection (pTxDataQ->hContext);
-            pClsfrParams->ClsfrTable[pClsfrParams->uNumActiveEntries].Dscp.DstPortNum = pNewEntry->Dscp.DstPortNum;
-            pClsfrParams->ClsfrTable[pClsfrParams->uNumActiveEntries].DTag = pNewEntry->DTag;
-            context_LeaveCriticalSection (pTxDataQ->hContext);
-                                
         break;
-        
-        case IPPORT_CLSFR:
 
-            /* Check entry */
+        case IPPORT_CLSFR:
             if ( (pNewEntry->DTag > CLASSIFIER_DTAG_MAX) || 
                  (pNewEntry->Dscp.DstIPPort.DstPortNum > CLASSIFIER_PORT_MAX-1) || 
                  (pNewEntry->Dscp.DstIPPort.DstPortNum < CLASSIFIER_PORT_MIN) || 
@@ -463,36 +713,24 @@ TI_STATUS txDataClsfr_InsertClsfrEntry(TI_HANDLE hTxDataQ, TClsfrTableEntry *pNe
                 TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): bad parameter - Aborting\n");
                 return PARAM_VALUE_NOT_VALID;
             }
-
-            /* Check conflict*/
-            for (i = 0; i < pClsfrParams->uNumActiveEntries; i++)
-            {
-               /* Detect both duplicate and conflicting entries */
-                if ( (pClsfrParams->ClsfrTable[i].Dscp.DstIPPort.DstIPAddress == pNewEntry->Dscp.DstIPPort.DstIPAddress) && 
-                     (pClsfrParams->ClsfrTable[i].Dscp.DstIPPort.DstPortNum == pNewEntry->Dscp.DstIPPort.DstPortNum))
-                {
-                    TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): classifier entries conflict - Aborting\n");
-                     return PARAM_VALUE_NOT_VALID;
-                }
-            }  
-
-            /* Insert new entry to classifier table */            
-            /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
-            context_EnterCriticalSection (pTxDataQ->hContext);
-            pClsfrParams->ClsfrTable[pClsfrParams->uNumActiveEntries].Dscp.DstIPPort.DstIPAddress = pNewEntry->Dscp.DstIPPort.DstIPAddress;
-            pClsfrParams->ClsfrTable[pClsfrParams->uNumActiveEntries].Dscp.DstIPPort.DstPortNum = pNewEntry->Dscp.DstIPPort.DstPortNum;
-            pClsfrParams->ClsfrTable[pClsfrParams->uNumActiveEntries].DTag = pNewEntry->DTag;
-            context_LeaveCriticalSection (pTxDataQ->hContext);
-
         break;
 
         default:
 TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): Classifier type -- unknown - Aborting\n");
-            
-    } 
-    
-    /* Increment the number of classifier active entries */
-    pClsfrParams->uNumActiveEntries++;
+            return PARAM_VALUE_NOT_VALID;
+    }
+
+    /* Check conflict with existing entries and if OK, insert to classifier table. */
+    /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
+    context_EnterCriticalSection (pTxDataQ->hContext);
+    eStatus = clsfrAddEntry (pTxDataQ, pNewEntry);
+    context_LeaveCriticalSection (pTxDataQ->hContext);
+
+    if (eStatus != TI_OK)
+    {
+        TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry(): classifier entries conflict - Aborting\n");
+        return PARAM_VALUE_NOT_VALID;
+    }
 
     return TI_OK;
 }
@@ -501,143 +739,78 @@ TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_InsertClsfrEntry():
 /** 
  * \fn     txDataClsfr_RemoveClsfrEntry 
  * \brief  Remove an entry from classifier table
- * 
+ *
  * Remove an entry from classifier table.
+ * The last table entry is moved to the removed entry place.
  *
  * \note   
  * \param  hTxDataQ - The object handle                                         
  * \param  pRemEntry    - Pointer to the entry to remove
  * \return TI_OK on success, PARAM_VALUE_NOT_VALID in case of input parameters problems.
  * \sa     txDataClsfr_InsertClsfrEntry
- */ 
+ */
 TI_STATUS txDataClsfr_RemoveClsfrEntry(TI_HANDLE hTxDataQ, TClsfrTableEntry *pRemEntry)
 {
     TTxDataQ      *pTxDataQ     = (TTxDataQ *)hTxDataQ;
     TClsfrParams  *pClsfrParams = &pTxDataQ->tClsfrParams;
-    TI_UINT32     i, j;
+    TI_UINT8      *pHash        = pTxDataQ->tClsfrLookup.aHash;
+    TI_UINT32     uIpAddr, uPort, uSlot, uEntry, uLast;
 
 	if(pRemEntry == NULL)
     {
         TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): NULL ConfigBuffer pointer Error - Aborting\n");
 		return PARAM_VALUE_NOT_VALID;
     }
-    
+
     if (pClsfrParams->uNumActiveEntries == 0)
     {
         TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): Classifier table is empty - Aborting\n");
 		return PARAM_VALUE_NOT_VALID;
     }
-   
-    if (pClsfrParams->eClsfrType == D_TAG_CLSFR)
+
+    if ((pClsfrParams->eClsfrType != DSCP_CLSFR) &&
+        (pClsfrParams->eClsfrType != PORT_CLSFR) &&
+        (pClsfrParams->eClsfrType != IPPORT_CLSFR))
     {
-        TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): D-Tag classifier - Aborting\n");
+        TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): D-Tag or unknown classifier - Aborting\n");
         return PARAM_VALUE_NOT_VALID;
     }
 
-    /* Check conflicts with classifier table entries */
-    /* check all conflicts, if all entries are TI_OK --> insert to classifier table*/
- 
-    switch (pClsfrParams->eClsfrType)
+    /* Find the classifier entry (both its key and D-Tag should match) */
+    clsfrGetEntryKey (pClsfrParams->eClsfrType, pRemEntry, &uIpAddr, &uPort);
+    uSlot = clsfrHashFind (pTxDataQ, uIpAddr, uPort);
+    if ((uSlot == CLSFR_HASH_SIZE) || (pClsfrParams->ClsfrTable[pHash[uSlot]].DTag != pRemEntry->DTag))
     {
-        case DSCP_CLSFR:
-
-           /* Find the classifier entry */
-           i = 0;
-            while ((i < pClsfrParams->uNumActiveEntries) &&
-                  ((pClsfrParams->ClsfrTable[i].Dscp.CodePoint != pRemEntry->Dscp.CodePoint) ||
-                  (pClsfrParams->ClsfrTable[i].DTag != pRemEntry->DTag)))
-            {   
-              i++;
-            }
-
-           /* If we have reached the number of active entries, it means we couldn't find the requested entry */
-            if (i == pClsfrParams->uNumActiveEntries)
-           {
-                TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): Entry not found - Aborting\n");
-               return PARAM_VALUE_NOT_VALID;
-           }
-
-            /* Shift all entries above the removed one downward */
-            /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
-            context_EnterCriticalSection (pTxDataQ->hContext);
-            for (j = i; j < pClsfrParams->uNumActiveEntries - 1; j++)
-                {
-                   /* Move entries */
-                pClsfrParams->ClsfrTable[j].Dscp.CodePoint = pClsfrParams->ClsfrTable[j+1].Dscp.CodePoint;
-                pClsfrParams->ClsfrTable[j].DTag = pClsfrParams->ClsfrTable[j+1].DTag;
-                } 
-            context_LeaveCriticalSection (pTxDataQ->hContext);
-          
-        break;
-        
-        case PORT_CLSFR:
-
-           /* Find the classifier entry */
-           i = 0;
-            while ((i < pClsfrParams->uNumActiveEntries) &&
-                  ((pClsfrParams->ClsfrTable[i].Dscp.DstPortNum != pRemEntry->Dscp.DstPortNum) ||
-                  (pClsfrParams->ClsfrTable[i].DTag != pRemEntry->DTag)))
-            {   
-              i++;
-            }
+        TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): Entry not found - Aborting\n");
+        return PARAM_VALUE_NOT_VALID;
+    }
 
-           /* If we have reached the number of active entries, it means we couldn't find the requested entry */
-            if (i == pClsfrParams->uNumActiveEntries)
-           {
-                TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): Entry not found - Aborting\n");
-               return PARAM_VALUE_NOT_VALID;
-           }
-
-            /* Shift all entries above the removed one downward */
-            /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
-            context_EnterCriticalSection (pTxDataQ->hContext);
-			for (j = i; j < pClsfrParams->uNumActiveEntries - 1; j++)
-                {
-                pClsfrParams->ClsfrTable[j].Dscp.DstPortNum = pClsfrParams->ClsfrTable[j+1].Dscp.DstPortNum;
-                pClsfrParams->ClsfrTable[j].DTag = pClsfrParams->ClsfrTable[j+1].DTag;
-            } 
-            context_LeaveCriticalSection (pTxDataQ->hContext);
-                                
-        break;
-        
-        case IPPORT_CLSFR:
+    /* Remove the entry and move the last entry to its place. */
+    /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
+    context_EnterCriticalSection (pTxDataQ->hContext);
 
-            /* Find the classifier entry */
-            i = 0;
-            while ((i < pClsfrParams->uNumActiveEntries) &&
-                  ((pClsfrParams->ClsfrTable[i].Dscp.DstIPPort.DstIPAddress != pRemEntry->Dscp.DstIPPort.DstIPAddress) ||
-                  (pClsfrParams->ClsfrTable[i].Dscp.DstIPPort.DstPortNum != pRemEntry->Dscp.DstIPPort.DstPortNum) ||
-                  (pClsfrParams->ClsfrTable[i].DTag != pRemEntry->DTag)))
-            {   
-                i++;
-            }
+    uEntry = pHash[uSlot];
+    uLast  = pClsfrParams->uNumActiveEntries - 1;
 
-            /* If we have reached the number of active entries, it means we couldn't find the requested entry */
-            if (i == pClsfrParams->uNumActiveEntries)
-            {
-                TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): Entry not found - Aborting\n");
-                return PARAM_VALUE_NOT_VALID;
-            }
-
-            /* Shift all entries above the removed one downward. */
-            /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
-            context_EnterCriticalSection (pTxDataQ->hContext);
-			for (j = i; j < pClsfrParams->uNumActiveEntries - 1; j++)
-            {
-                pClsfrParams->ClsfrTable[j].Dscp.DstIPPort.DstIPAddress = pClsfrParams->ClsfrTable[j+1].Dscp.DstIPPort.DstIPAddress;
-                pClsfrParams->ClsfrTable[j].Dscp.DstIPPort.DstPortNum = pClsfrParams->ClsfrTable[j+1].Dscp.DstIPPort.DstPortNum;
-                pClsfrParams->ClsfrTable[j].DTag = pClsfrParams->ClsfrTable[j+1].DTag;
-            } 
-            context_LeaveCriticalSection (pTxDataQ->hContext);
+    clsfrHashRemove (pTxDataQ, uSlot);
+    if (pClsfrParams->eClsfrType == DSCP_CLSFR)
+    {
+        clsfrSetTosDtag (pTxDataQ, uPort, CLSFR_DTAG_NONE);
+    }
 
-        break;
+    if (uEntry != uLast)
+    {
+        clsfrGetEntryKey (pClsfrParams->eClsfrType, &pClsfrParams->ClsfrTable[uLast], &uIpAddr, &uPort);
+        uSlot = clsfrHashFind (pTxDataQ, uIpAddr, uPort);
+        pHash[uSlot] = (TI_UINT8)uEntry;
+        pClsfrParams->ClsfrTable[uEntry] = pClsfrParams->ClsfrTable[uLast];
+    }
 
-        default:
-TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry(): Classifier type -- unknown - Aborting\n");
-    } 
-    
     /* Decrement the number of classifier active entries */
     pClsfrParams->uNumActiveEntries--;
+    clsfrInvalidateFlowCache (pTxDataQ);
+
+    context_LeaveCriticalSection (pTxDataQ->hContext);
 
     return TI_OK;
 }
@@ -646,7 +819,7 @@ TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry():
 /** 
  * \fn     txDataClsfr_SetClsfrType & txDataClsfr_GetClsfrType 
  * \brief  Set / Get classifier type
- * 
+ *
  * Set / Get classifier type.
  * When setting type, the table is emptied!
  *
@@ -655,7 +828,7 @@ TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "classifier_RemoveClsfrEntry():
  * \param  eNewClsfrType - New type
  * \return TI_OK on success, PARAM_VALUE_NOT_VALID in case of input parameters problems.
  * \sa     
- */ 
+ */
 TI_STATUS txDataClsfr_SetClsfrType (TI_HANDLE hTxDataQ, EClsfrType eNewClsfrType)
 {
     TTxDataQ *pTxDataQ = (TTxDataQ *)hTxDataQ;
@@ -665,17 +838,18 @@ TI_STATUS txDataClsfr_SetClsfrType (TI_HANDLE hTxDataQ, EClsfrType eNewClsfrType
 TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "Classifier_setClsfrType(): classifier type exceed its MAX \n");
 		return PARAM_VALUE_NOT_VALID;
     }
-	
+
 	if (pTxDataQ->tClsfrParams.eClsfrType == eNewClsfrType)
 	{
 TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_WARNING, "Classifier_setClsfrType(): equal classifier type --> will empty classifier table \n");
     }
-	
+
 	/* Update type and empty table. */
     /* Note: Protect from txDataClsfr_ClassifyTxPacket context preemption. */
     context_EnterCriticalSection (pTxDataQ->hContext);
     pTxDataQ->tClsfrParams.eClsfrType = eNewClsfrType;
 	pTxDataQ->tClsfrParams.uNumActiveEntries = 0;
+    clsfrResetLookup (pTxDataQ);
     context_LeaveCriticalSection (pTxDataQ->hContext);
 
     return TI_OK;
@@ -59,6 +59,7 @@
 #include "DrvMainModules.h" 
 #include "bmtrace_api.h"
 #include "PowerMgr_API.h" 
+#include "context.h"
 
 
 #define EAPOL_PACKET                    0x888E
@@ -75,10 +76,19 @@
 #define PADDING_ETH_PACKET_SIZE                 2
 
 #define MSDU_DATA_LEN_LIMIT                     5000  /* some arbitrary big number to protect from buffer overflow */
+
+/* Zero-copy A-MSDU MSDU buffer: the Rx descriptor followed by the RX_ETH_PKT_DATA pointer and RX_ETH_PKT_LEN */
+#define AMSDU_MSDU_REF_BUF_LEN                  (sizeof(RxIfDescriptor_t) + PADDING_ETH_PACKET_SIZE + sizeof(void *) + sizeof(TI_UINT32))
+
+/* Packets chain (rxData_ReceivePacketList): the classes forwarded to the data dispatcher, and no rate converted yet */
+#define RX_DATA_IS_DATA_CLASS(eTag)             (((eTag) == TAG_CLASS_QOS_DATA) || ((eTag) == TAG_CLASS_DATA) || \
+                                                 ((eTag) == TAG_CLASS_AMSDU)    || ((eTag) == TAG_CLASS_EAPOL))
+#define RX_DATA_NO_HW_RATE                      0xFFFFFFFF
   
 
 /* CallBack for recieving packet from rxXfer */
 static void rxData_ReceivePacket (TI_HANDLE   hRxData,  void  *pBuffer);
+static void rxData_ReceivePacketList (TI_HANDLE   hRxData,  void  **apBuffers, TI_UINT32 uNumBuffers);
 
 static ERxBufferStatus rxData_RequestForBuffer (TI_HANDLE   hRxData, void **pBuf, TI_UINT16 aLength, TI_UINT32 uEncryptionFlag,PacketClassTag_e ePacketClassTag);
 
@@ -109,6 +119,7 @@ static void rxData_printRxThroughput(TI_HANDLE hRxData, TI_BOOL bTwdInitOccured)
 static void rxData_StartReAuthActiveTimer(TI_HANDLE hRxData);		
 static void reAuthTimeout(TI_HANDLE hRxData, TI_BOOL bTwdInitOccured);
 static void rxData_ReauthEnablePriority(TI_HANDLE hRxData);
+static void rxData_RxBufPoolRefill (TI_HANDLE hRxData);
 
 
 /*************************************************************************
@@ -179,6 +190,7 @@ void rxData_init (TStadHandlesList *pStadHandles)
     pRxData->hEvHandler = pStadHandles->hEvHandler;
     pRxData->hTimer     = pStadHandles->hTimer;
     pRxData->hPowerMgr  = pStadHandles->hPowerMgr;
+    pRxData->hContext   = pStadHandles->hContext;
     
     pRxData->rxDataExcludeUnencrypted = DEF_EXCLUDE_UNENCYPTED; 
     pRxData->rxDataExludeBroadcastUnencrypted = DEF_EXCLUDE_UNENCYPTED;
@@ -220,10 +232,25 @@ void rxData_init (TStadHandlesList *pStadHandles)
                     (void *)rxData_ReceivePacket, 
                     pStadHandles->hRxData);
 
+    TWD_RegisterCb (pRxData->hTWD,
+                    TWD_EVENT_RX_RECEIVE_PACKET_LIST,
+                    (void *)rxData_ReceivePacketList, 
+                    pStadHandles->hRxData);
+
     TWD_RegisterCb (pRxData->hTWD,
                     TWD_EVENT_RX_REQUEST_FOR_BUFFER,
                     (void*)rxData_RequestForBuffer, 
                     pStadHandles->hRxData);
+
+    /* Register to the context engine for refilling the Rx buffers pool outside the Rx path */
+    pRxData->uRxBufPoolContextId = context_RegisterClient (pRxData->hContext,
+                                                           rxData_RxBufPoolRefill,
+                                                           (TI_HANDLE)pRxData,
+                                                           TI_TRUE,
+                                                           "RX_BUF_POOL",
+                                                           sizeof("RX_BUF_POOL"));
+    /* Data path client: invoked before the management clients */
+    context_SetClientPriority (pRxData->hContext, pRxData->uRxBufPoolContextId, CONTEXT_PRIORITY_HIGH);
 }
 
 
@@ -257,6 +284,25 @@ TI_STATUS rxData_SetDefaults (TI_HANDLE hRxData, rxDataInitParams_t * rxDataInit
 
     pRxData->reAuthActiveTimeout = rxDataInitParams->reAuthActiveTimeout;
 
+    pRxData->bAmsduZeroCopy = rxDataInitParams->bAmsduZeroCopy;
+
+    /* Create and prefill the Rx buffers pool (unless disabled in all size classes) */
+    {
+        TI_UINT32 aRxBufPoolSize[RX_BUF_POOL_NUM_CLASSES];
+
+        aRxBufPoolSize[0] = rxDataInitParams->uRxBufPoolSmallBufs;
+        aRxBufPoolSize[1] = rxDataInitParams->uRxBufPoolMediumBufs;
+        aRxBufPoolSize[2] = rxDataInitParams->uRxBufPoolLargeBufs;
+
+        if (aRxBufPoolSize[0] + aRxBufPoolSize[1] + aRxBufPoolSize[2] > 0)
+        {
+            if (RxBufPoolCreate (pRxData->hOs, aRxBufPoolSize) != TI_OK)
+            {
+                TRACE0(pRxData->hReport, REPORT_SEVERITY_ERROR, "rxData_SetDefaults(): Failed to create Rx buffers pool, allocating per packet\n");
+            }
+        }
+    }
+
 	rxData_SetReAuthInProgress(pRxData, TI_FALSE);
 
   #ifdef TI_DBG
@@ -317,6 +363,8 @@ TI_STATUS rxData_unLoad(TI_HANDLE hRxData)
 		tmr_DestroyTimer (pRxData->reAuthActiveTimer);
 	}
 
+    RxBufPoolDestroy (pRxData->hOs);
+
     /* free Rx Data controll block */
     os_memoryFree(pRxData->hOs, pRxData, sizeof(rxData_t));
 
@@ -1428,7 +1476,7 @@ static TI_STATUS rxData_convertWlanToEthHeader (TI_HANDLE hRxData, void *pBuffer
     /* Setting the mac header len according to the received FrameControl field in the Mac Header */
     GET_MAX_HEADER_SIZE (dataBuf, &headerLength);
     pDot11Header = (dot11_header_t*) dataBuf;
-    pWlanSnapHeader = (Wlan_LlcHeader_T*)((TI_UINT32)dataBuf + (TI_UINT32)headerLength);
+    pWlanSnapHeader = (Wlan_LlcHeader_T*)((TI_UINT8*)dataBuf + headerLength);
     
     swapedTypeLength = WLANTOHS (pWlanSnapHeader->Type);
     *etherType = swapedTypeLength;
@@ -1564,9 +1612,22 @@ static TI_STATUS rxData_ConvertAmsduToEthPackets (TI_HANDLE hRxData, void *pBuff
             return TI_NOK;
         }
 
-        /* allocate a new buffer */
-        /* RxBufAlloc() add an extra word for alignment the MAC payload */
-        rxData_RequestForBuffer (hRxData, &pDataBuf, sizeof(RxIfDescriptor_t) + WLAN_SNAP_HDR_LEN + ETHERNET_HDR_LEN + uDataLen, 0, TAG_CLASS_AMSDU);
+        if (pRxData->bAmsduZeroCopy)
+        {
+            /* allocate a buffer for the Rx descriptor only, referencing the MSDU in the A-MSDU buffer */
+            rxData_RequestForBuffer (hRxData, &pDataBuf, AMSDU_MSDU_REF_BUF_LEN, 0, TAG_CLASS_AMSDU);
+            if ((NULL != pDataBuf) && (RxBufAttachRef (pRxData->hOs, pDataBuf, pBuffer) != TI_OK))
+            {
+                RxBufFree (pRxData->hOs, pDataBuf);
+                pDataBuf = NULL;
+            }
+        }
+        else
+        {
+            /* allocate a new buffer */
+            /* RxBufAlloc() add an extra word for alignment the MAC payload */
+            rxData_RequestForBuffer (hRxData, &pDataBuf, sizeof(RxIfDescriptor_t) + WLAN_SNAP_HDR_LEN + ETHERNET_HDR_LEN + uDataLen, 0, TAG_CLASS_AMSDU);
+        }
         if (NULL == pDataBuf)
         {
             TRACE1(pRxData->hReport, REPORT_SEVERITY_ERROR, "rxData_ConvertAmsduToEthPackets(): cannot alloc MSDU packet. length %d \n",uDataLen);
@@ -1581,30 +1642,52 @@ static TI_STATUS rxData_ConvertAmsduToEthPackets (TI_HANDLE hRxData, void *pBuff
         /* copy the RxIfDescriptor */
         os_memoryCopy (pRxData->hOs, pDataBuf, pBuffer, sizeof(RxIfDescriptor_t));
 
-        /* update length, in the RxIfDescriptor the Len in words (4B) */
-        ((RxIfDescriptor_t *)pDataBuf)->length = (sizeof(RxIfDescriptor_t) + WLAN_SNAP_HDR_LEN + ETHERNET_HDR_LEN + uDataLen) >> 2;
-        ((RxIfDescriptor_t *)pDataBuf)->extraBytes = 4 - ((sizeof(RxIfDescriptor_t) + WLAN_SNAP_HDR_LEN + ETHERNET_HDR_LEN + uDataLen) & 0x3);
+        /* Delta length for the next packet */
+        lengthDelta = ETHERNET_HDR_LEN + uDataLen;
 
-        /* Prepare the Ethernet header pointer. */ 
-        /* add padding in the start of the buffer in order to align ETH payload */
-        pEthHeader = (TEthernetHeader *)((TI_UINT8 *)(RX_BUF_DATA(pDataBuf)) + 
-                                         WLAN_SNAP_HDR_LEN + 
-                                         PADDING_ETH_PACKET_SIZE);
+        if (pRxData->bAmsduZeroCopy)
+        {
+            /* The buffer holds no MAC data, update length (in words) */
+            ((RxIfDescriptor_t *)pDataBuf)->length = sizeof(RxIfDescriptor_t) >> 2;
+            ((RxIfDescriptor_t *)pDataBuf)->extraBytes = 0;
+
+            /* 
+             * Rewrite the MSDU header in place to an Ethernet header that ends right before the payload: 
+             *     move the SA and DA over the LLC/SNAP, whose last 2 bytes are already the TYPE.
+             * The SA is moved first since the DA destination overlaps the SA source.
+             */
+            pEthHeader = (TEthernetHeader *)((TI_UINT8 *)pMsduEthHeader + WLAN_SNAP_HDR_LEN);
+            MAC_COPY (pEthHeader->src, pMsduEthHeader->src);
+            MAC_COPY (pEthHeader->dst, pMsduEthHeader->dst);
+
+            pRxData->rxDataDbgCounters.uAmsduBytesReferenced += uDataLen + ETHERNET_HDR_LEN - WLAN_SNAP_HDR_LEN;
+        }
+        else
+        {
+            /* update length, in the RxIfDescriptor the Len in words (4B) */
+            ((RxIfDescriptor_t *)pDataBuf)->length = (sizeof(RxIfDescriptor_t) + WLAN_SNAP_HDR_LEN + ETHERNET_HDR_LEN + uDataLen) >> 2;
+            ((RxIfDescriptor_t *)pDataBuf)->extraBytes = 4 - ((sizeof(RxIfDescriptor_t) + WLAN_SNAP_HDR_LEN + ETHERNET_HDR_LEN + uDataLen) & 0x3);
 
-        /* copy the Ethernet header */
-        os_memoryCopy (pRxData->hOs, pEthHeader, pMsduEthHeader, ETHERNET_HDR_LEN);
+            /* Prepare the Ethernet header pointer. */ 
+            /* add padding in the start of the buffer in order to align ETH payload */
+            pEthHeader = (TEthernetHeader *)((TI_UINT8 *)(RX_BUF_DATA(pDataBuf)) + 
+                                             WLAN_SNAP_HDR_LEN + 
+                                             PADDING_ETH_PACKET_SIZE);
 
-        /* The LEN/TYPE bytes are set to TYPE */
-        pEthHeader->type = pWlanSnapHeader->Type;
+            /* copy the Ethernet header */
+            os_memoryCopy (pRxData->hOs, pEthHeader, pMsduEthHeader, ETHERNET_HDR_LEN);
 
-        /* Delta length for the next packet */
-        lengthDelta = ETHERNET_HDR_LEN + uDataLen;
+            /* The LEN/TYPE bytes are set to TYPE */
+            pEthHeader->type = pWlanSnapHeader->Type;
+
+            /* copy the packet payload */
+            os_memoryCopy (pRxData->hOs, 
+                           (((TI_UINT8*)pEthHeader) + ETHERNET_HDR_LEN), 
+                           ((TI_UINT8*)pMsduEthHeader) + ETHERNET_HDR_LEN + WLAN_SNAP_HDR_LEN, 
+                           uDataLen - WLAN_SNAP_HDR_LEN);
 
-        /* copy the packet payload */
-        os_memoryCopy (pRxData->hOs, 
-                       (((TI_UINT8*)pEthHeader) + ETHERNET_HDR_LEN), 
-                       ((TI_UINT8*)pMsduEthHeader) + ETHERNET_HDR_LEN + WLAN_SNAP_HDR_LEN, 
-                       uDataLen - WLAN_SNAP_HDR_LEN);
+            pRxData->rxDataDbgCounters.uAmsduBytesCopied += uDataLen + ETHERNET_HDR_LEN - WLAN_SNAP_HDR_LEN;
+        }
 
         /* set the packet type */
         if (swapedTypeLength == ETHERTYPE_802_1D)
@@ -1669,6 +1752,44 @@ static TI_STATUS rxData_ConvertAmsduToEthPackets (TI_HANDLE hRxData, void *pBuff
     return TI_OK;
 }
 
+/****************************************************************************************
+ *                        rxData_SetRxAttr                                                  *
+ ****************************************************************************************
+DESCRIPTION:    Set the Rx attributes of a received packet from its RxInfo descriptor.
+                
+INPUT:          pRxParams - the packet RxInfo descriptor
+                eRate     - the packet rate, converted to the driver rate
+                pRxAttr   - the attributes to set
+
+OUTPUT:
+
+RETURN:         
+
+************************************************************************/
+static inline void rxData_SetRxAttr (rxData_t *pRxData, RxIfDescriptor_t *pRxParams, ERate eRate, TRxAttr *pRxAttr)
+{
+    pRxAttr->channel    = pRxParams->channel;
+    pRxAttr->packetInfo = pRxParams->flags;
+    pRxAttr->ePacketType= pRxParams->packet_class_tag;
+    pRxAttr->Rate       = eRate;
+    pRxAttr->Rssi       = pRxParams->rx_level;
+    pRxAttr->SNR        = pRxParams->rx_snr;
+    pRxAttr->status     = pRxParams->status & RX_DESC_STATUS_MASK;
+    /* for now J band not implemented */
+    pRxAttr->band       = ((pRxParams->flags & RX_DESC_BAND_MASK) == RX_DESC_BAND_A) ? 
+                          RADIO_BAND_5_0_GHZ : RADIO_BAND_2_4_GHZ ;
+    pRxAttr->eScanTag   = (EScanResultTag)(pRxParams->proccess_id_tag);
+
+    /* timestamp is 32 bit so do bytes copy to avoid exception in case the RxInfo is in 2 bytes offset */
+    os_memoryCopy (pRxData->hOs, 
+                   (void *)&(pRxAttr->TimeStamp), 
+                   (void *)&(pRxParams->timestamp), 
+                   sizeof(pRxParams->timestamp) );
+    pRxAttr->TimeStamp = ENDIAN_HANDLE_LONG(pRxAttr->TimeStamp);
+
+    TRACE8(pRxData->hReport, REPORT_SEVERITY_INFORMATION, "rxData_SetRxAttr: channel=%d, info=0x%x, type=%d, rate=0x%x, RSSI=%d, SNR=%d, status=%d, scan tag=%d\n", pRxAttr->channel, pRxAttr->packetInfo, pRxAttr->ePacketType, pRxAttr->Rate, pRxAttr->Rssi, pRxAttr->SNR, pRxAttr->status, pRxAttr->eScanTag);
+}
+
 /****************************************************************************************
  *                        rxData_ReceivePacket                                              *
  ****************************************************************************************
@@ -1776,26 +1897,7 @@ static void rxData_ReceivePacket (TI_HANDLE   hRxData,
         /*
          * Set rx attributes 
          */ 
-        RxAttr.channel    = pRxParams->channel;
-        RxAttr.packetInfo = pRxParams->flags;
-        RxAttr.ePacketType= pRxParams->packet_class_tag;
-        RxAttr.Rate       = appRate;
-        RxAttr.Rssi       = pRxParams->rx_level;
-        RxAttr.SNR        = pRxParams->rx_snr;
-        RxAttr.status     = pRxParams->status & RX_DESC_STATUS_MASK;
-        /* for now J band not implemented */
-        RxAttr.band       = ((pRxParams->flags & RX_DESC_BAND_MASK) == RX_DESC_BAND_A) ? 
-                            RADIO_BAND_5_0_GHZ : RADIO_BAND_2_4_GHZ ;
-        RxAttr.eScanTag   = (EScanResultTag)(pRxParams->proccess_id_tag);
-
-        /* timestamp is 32 bit so do bytes copy to avoid exception in case the RxInfo is in 2 bytes offset */
-        os_memoryCopy (pRxData->hOs, 
-                       (void *)&(RxAttr.TimeStamp), 
-                       (void *)&(pRxParams->timestamp), 
-                       sizeof(pRxParams->timestamp) );
-        RxAttr.TimeStamp = ENDIAN_HANDLE_LONG(RxAttr.TimeStamp);
-
-        TRACE8(pRxData->hReport, REPORT_SEVERITY_INFORMATION, "rxData_ReceivePacket: channel=%d, info=0x%x, type=%d, rate=0x%x, RSSI=%d, SNR=%d, status=%d, scan tag=%d\n", RxAttr.channel, RxAttr.packetInfo, RxAttr.ePacketType, RxAttr.Rate, RxAttr.Rssi, RxAttr.SNR, RxAttr.status, RxAttr.eScanTag);
+        rxData_SetRxAttr (pRxData, pRxParams, appRate, &RxAttr);
 
         rxData_receivePacketFromWlan (hRxData, pBuffer, &RxAttr);
 
@@ -1810,6 +1912,74 @@ static void rxData_ReceivePacket (TI_HANDLE   hRxData,
 }
 
 
+/****************************************************************************************
+ *                        rxData_ReceivePacketList                                          *
+ ****************************************************************************************
+DESCRIPTION:    receive packets chain CB from RxQueue.
+                The chain holds in-order data packets of one BA session, released together 
+                from the reorder window. So the Rx port is checked once for the chain, the 
+                rate is converted only when it changes, and the good data packets go straight
+                to the data dispatcher. Other packets are handled by rxData_ReceivePacket().
+                
+INPUT:          apBuffers   - the packets, in order
+                uNumBuffers - the number of packets
+
+OUTPUT:
+
+RETURN:         
+
+************************************************************************/
+static void rxData_ReceivePacketList (TI_HANDLE   hRxData,
+                                      void  **apBuffers,
+                                      TI_UINT32 uNumBuffers)
+{
+    rxData_t          *pRxData = (rxData_t *)hRxData;
+    RxIfDescriptor_t  *pRxParams;
+    TRxAttr            RxAttr;
+    ERate              appRate = DRV_RATE_AUTO;
+    TI_UINT32          uHwRate = RX_DATA_NO_HW_RATE;
+    TI_UINT32          i;
+
+    /* Packets received while the Rx data port is closed take the regular path (discarded or reported) */
+    if (pRxData->rxDataPortStatus == CLOSE)
+    {
+        for (i = 0; i < uNumBuffers; i++)
+        {
+            rxData_ReceivePacket (hRxData, apBuffers[i]);
+        }
+        return;
+    }
+
+    for (i = 0; i < uNumBuffers; i++)
+    {
+        pRxParams = (RxIfDescriptor_t *)apBuffers[i];
+
+        /* Packets with an error status or a non data class take the regular path */
+        if ((pRxParams == NULL) ||
+            ((pRxParams->status & RX_DESC_STATUS_MASK) != RX_DESC_STATUS_SUCCESS) ||
+            !RX_DATA_IS_DATA_CLASS(pRxParams->packet_class_tag))
+        {
+            rxData_ReceivePacket (hRxData, apBuffers[i]);
+            continue;
+        }
+
+        /* The chain packets are usually received in the same rate */
+        if (pRxParams->rate != uHwRate)
+        {
+            uHwRate = pRxParams->rate;
+            if (rate_PolicyToDrv ((ETxRateClassId)uHwRate, &appRate) != TI_OK)
+            {
+                TRACE1(pRxData->hReport, REPORT_SEVERITY_ERROR , "rxData_ReceivePacketList: can't convert hwRate=0x%x\n", uHwRate);
+            }
+        }
+
+        rxData_SetRxAttr (pRxData, pRxParams, appRate, &RxAttr);
+
+        rxData_dataPacketDisptcher (hRxData, apBuffers[i], &RxAttr);
+    }
+}
+
+
 /****************************************************************************************
  *                        rxData_RequestForBuffer                                              *
  ****************************************************************************************
@@ -1834,6 +2004,13 @@ static ERxBufferStatus rxData_RequestForBuffer (TI_HANDLE   hRxData,
 
     *pBuf = RxBufAlloc (pRxData->hOs, aLength, ePacketClassTag);
 
+    /* If the Rx buffers pool is running low, refill it from the driver task after the Rx handling */
+    if (!pRxData->bRxBufPoolRefillPending && RxBufPoolIsLow (pRxData->hOs))
+    {
+        pRxData->bRxBufPoolRefillPending = TI_TRUE;
+        context_RequestSchedule (pRxData->hContext, pRxData->uRxBufPoolContextId);
+    }
+
     if (*pBuf)
     {
         return RX_BUF_ALLOC_COMPLETE;
@@ -1845,6 +2022,28 @@ static ERxBufferStatus rxData_RequestForBuffer (TI_HANDLE   hRxData,
 }
 
 
+/***************************************************************************
+*                        rxData_RxBufPoolRefill                            *
+****************************************************************************
+* DESCRIPTION:  Context engine handler - refill the Rx buffers pool free 
+*               lists that were drained by the Rx path.
+*
+* INPUTS:       hRxData - the object
+*
+* OUTPUT:       
+* 
+* RETURNS:      void
+***************************************************************************/
+static void rxData_RxBufPoolRefill (TI_HANDLE hRxData)
+{
+    rxData_t *pRxData = (rxData_t *)hRxData;
+
+    pRxData->bRxBufPoolRefillPending = TI_FALSE;
+
+    RxBufPoolRefill (pRxData->hOs);
+}
+
+
 /*******************************************************************
 *                        DEBUG FUNCTIONS                           *
 *******************************************************************/
@@ -1913,6 +2112,10 @@ void rxData_printRxCounters (TI_HANDLE hRxData)
         WLAN_OS_REPORT(("rxWrongBssTypeCounter = %d\n", pRxData->rxDataDbgCounters.rxWrongBssTypeCounter));
         WLAN_OS_REPORT(("rxWrongBssIdCounter = %d\n", pRxData->rxDataDbgCounters.rxWrongBssIdCounter));
         WLAN_OS_REPORT(("rcvUnicastFrameInOpenNotify = %d\n", pRxData->rxDataDbgCounters.rcvUnicastFrameInOpenNotify));        
+        WLAN_OS_REPORT(("AmsduBytesCopied = %u\n", pRxData->rxDataDbgCounters.uAmsduBytesCopied));
+        WLAN_OS_REPORT(("AmsduBytesReferenced = %u\n", pRxData->rxDataDbgCounters.uAmsduBytesReferenced));
+
+        RxBufPoolPrintStats (pRxData->hOs);
     }
 #endif
 }
@@ -55,6 +55,8 @@ typedef struct
     TI_UINT32		rxWrongBssTypeCounter;
 	TI_UINT32		rxWrongBssIdCounter;
     TI_UINT32      rcvUnicastFrameInOpenNotify;
+    TI_UINT32      uAmsduBytesCopied;        /* A-MSDU MSDUs bytes copied to new buffers */
+    TI_UINT32      uAmsduBytesReferenced;    /* A-MSDU MSDUs bytes passed in place (zero-copy) */
 }rxDataDbgCounters_t;
 
 
@@ -94,6 +96,7 @@ typedef struct
     TI_HANDLE           RxEventDistributor;
 	TI_HANDLE           hThroughputTimer;
 	TI_HANDLE			hPowerMgr;
+    TI_HANDLE           hContext;
     TI_BOOL             rxThroughputTimerEnable;
 	TI_BOOL             rxDataExcludeUnencrypted;
     TI_BOOL             rxDataExludeBroadcastUnencrypted;
@@ -124,6 +127,11 @@ typedef struct
 
     /* Generic Ethertype support */
     TI_UINT16           genericEthertype;
+
+    /* Rx buffers pool and A-MSDU de-aggregation */
+    TI_BOOL             bAmsduZeroCopy;         /* De-aggregate A-MSDUs in place instead of copying each MSDU */
+    TI_UINT32           uRxBufPoolContextId;    /* The context engine client ID of the pool refill */
+    TI_BOOL             bRxBufPoolRefillPending;/* Pool refill was requested and not handled yet */
 }rxData_t;
 
 #endif
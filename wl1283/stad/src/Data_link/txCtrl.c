@@ -71,17 +71,27 @@
 
 
 static void   txCtrl_TxCompleteCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *pTxResultInfo);
+static void   txCtrl_TxCompleteListCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *aTxResults, TI_UINT32 uNumResults);
+static TTxCtrlBlk *txCtrl_HandleTxResult (txCtrl_t *pTxCtrl, TxResultDescriptor_t *pTxResultInfo,
+                                          TTxCmpltCounters *pCounters);
+static void   txCtrl_CommitTxCounters (txCtrl_t *pTxCtrl, TTxCmpltCounters *pCounters);
+static void   txCtrl_FreePacketBuf (txCtrl_t *pTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eStatus);
 static void   txCtrl_BuildDataPkt (txCtrl_t *pTxCtrl, TTxCtrlBlk *pPktCtrlBlk,
                                    TI_UINT32 uAc, TI_UINT32 uBackpressure);
 static void	  txCtrl_BuildMgmtPkt (txCtrl_t *pTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_UINT32 uAc);
 static void   txCtrl_UpdateHighestAdmittedAcTable (txCtrl_t *pTxCtrl);
 static void   txCtrl_UpdateAcToTidMapping (txCtrl_t *pTxCtrl);
 static void   txCtrl_UpdateBackpressure (txCtrl_t *pTxCtrl, TI_UINT32 freedAcBitmap);
+static void   txCtrl_UpdateLatencyHist (txCtrl_t *pTxCtrl,
+                                      TxResultDescriptor_t *pTxResultInfo,
+                                      TTxCtrlBlk *pPktCtrlBlk,
+                                      TI_UINT32 ac);
 static void   txCtrl_UpdateTxCounters (txCtrl_t *pTxCtrl,
                                        TxResultDescriptor_t *pTxResultInfo,
                                        TTxCtrlBlk *pPktCtrlBlk,
                                        TI_UINT32 ac,
-                                       TI_BOOL bIsDataPkt);
+                                       TI_BOOL bIsDataPkt,
+                                       TTxCmpltCounters *pCounters);
 
 static void tokensCalculation(txCtrl_t *pTxCtrl, TxResultDescriptor_t *pTxResultInfo, TI_UINT32 ac);
 
@@ -240,6 +250,7 @@ void txCtrl_Init (TStadHandlesList *pStadHandles)
     pTxCtrl->eapolEncryptionStatus = DEF_EAPOL_ENCRYPTION_STATUS;
     pTxCtrl->encryptionFieldSize = 0;
     pTxCtrl->currBssType = BSS_INFRASTRUCTURE;
+    pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
     pTxCtrl->busyAcBitmap = 0;
     pTxCtrl->dbgPktSeqNum = 0;
     pTxCtrl->bCreditCalcTimerRunning = TI_FALSE;
@@ -288,6 +299,12 @@ void txCtrl_Init (TStadHandlesList *pStadHandles)
                     (void*)txCtrl_TxCompleteCb,
                     pStadHandles->hTxCtrl);
 
+    /* Register the Tx-Complete results list callback function (used for all Tx results). */
+    TWD_RegisterCb (pTxCtrl->hTWD,
+                    TWD_EVENT_TX_RESULT_SEND_PKT_COMPLETE_LIST,
+                    (void*)txCtrl_TxCompleteListCb,
+                    pStadHandles->hTxCtrl);
+
     /* Register the Update-Busy-Map callback function. */
     TWD_RegisterCb (pTxCtrl->hTWD,
                     TWD_EVENT_TX_HW_QUEUE_UPDATE_BUSY_MAP,
@@ -324,6 +341,7 @@ TI_STATUS txCtrl_SetDefaults (TI_HANDLE hTxCtrl, TInitTable *pInitTable)
 
     pTxCtrl->creditCalculationTimeout = pInitTable->txDataInitParams.creditCalculationTimeout;
     pTxCtrl->bCreditCalcTimerEnabled  = pInitTable->txDataInitParams.bCreditCalcTimerEnabled;
+    pTxCtrl->tTxLatency.bEnabled      = pInitTable->txDataInitParams.bTxLatencyStats;
 
     /* Update queues mapping (AC/TID/Backpressure) after module init. */
     txCtrl_UpdateQueuesMapping (hTxCtrl);
@@ -480,6 +498,131 @@ EStatusXmit txCtrl_XmitData (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk)
 }
 
 
+/*******************************************************************************
+*                          txCtrl_XmitDataBurst		                           *
+********************************************************************************
+* DESCRIPTION:  Get a burst of packets from one data-queue, allocate HW resources
+*				  for all of them in one call, build their headers and descriptors,
+*				  and hand them to TxXfer in one call, which aggregates them to one 
+*				  bus transaction.
+*				The burst AC is the admitted AC of the first packet, and the burst is
+*				  cut before any packet mapped to another AC.
+*				The number of packets handled (sent or dropped) is returned in 
+*				  *pNumHandled, and the rest should be retransmitted later.
+*
+* RETURNS:      STATUS_XMIT_SUCCESS - All packets were handled.
+*				STATUS_XMIT_BUSY    - Not all packets were handled due to lack of HW 
+*									    resources, retransmit the rest later.
+********************************************************************************/
+EStatusXmit txCtrl_XmitDataBurst (TI_HANDLE   hTxCtrl, 
+                                  TTxCtrlBlk *aPktsCtrlBlk[], 
+                                  TI_UINT32   uNumPkts, 
+                                  TI_UINT32  *pNumHandled)
+{
+    txCtrl_t   *pTxCtrl = (txCtrl_t *)hTxCtrl;
+    ETxnStatus eStatus;       /* The Xfer return value (different than this function's return values). */
+    TI_UINT32  uAc;
+    TI_UINT32  uPktAc;
+    TI_UINT32  uBackpressure = 0; /* HwQueue's indication when the current queue becomes busy. */
+    TI_UINT32  uNumAllocated;
+    TI_UINT32  uNumSent;
+    TI_UINT32  uPkt;
+    ETxHwQueStatus eHwQueStatus;
+    CL_TRACE_START_L3();
+
+    /* Get the admitted AC of the burst from the first packet TID (downgrading the TID if needed). */
+    SELECT_AC_FOR_TID (pTxCtrl, aPktsCtrlBlk[0]->tTxDescriptor.tid, uAc);
+
+    /* Downgrade the other packets TIDs, and cut the burst before any packet of another AC. */
+    for (uPkt = 1; uPkt < uNumPkts; uPkt++)
+    {
+        if (pTxCtrl->highestAdmittedAc[WMEQosTagToACTable[aPktsCtrlBlk[uPkt]->tTxDescriptor.tid]] != uAc)
+        {
+            uNumPkts = uPkt;
+            break;
+        }
+        SELECT_AC_FOR_TID (pTxCtrl, aPktsCtrlBlk[uPkt]->tTxDescriptor.tid, uPktAc);
+    }
+
+    /* Call TxHwQueue for Hw resources reservation of the whole burst. */
+    {
+        CL_TRACE_START_L4();
+        eHwQueStatus = TWD_txHwQueue_AllocResourcesBurst (pTxCtrl->hTWD, aPktsCtrlBlk, uNumPkts, &uNumAllocated);
+        CL_TRACE_END_L4("tiwlan_drv.ko", "INHERIT", "TX", ".allocResources");
+    }
+
+#ifdef TI_DBG
+    TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_XmitDataBurst(): Burst Tx, AC=%d, Pkts=%d, Allocated=%d\n", uAc, uNumPkts, uNumAllocated);
+
+    pTxCtrl->dbgCounters.dbgNumPktsSent[uAc] += uNumAllocated;
+#endif
+
+    /* If the current AC can't get more packets, stop it in data-queue module. */
+    if (eHwQueStatus == TX_HW_QUE_STATUS_STOP_NEXT)
+    {
+#ifdef TI_DBG
+        pTxCtrl->dbgCounters.dbgNumPktsBackpressure[uAc]++;
+        TRACE1(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_XmitDataBurst(): Backpressure, queue = %d\n", uAc);
+#endif
+        uBackpressure = 1 << uAc;
+        pTxCtrl->busyAcBitmap |= uBackpressure; /* Set the busy bit of the current AC. */
+        txDataQ_StopQueue (pTxCtrl->hTxDataQ, pTxCtrl->admittedAcToTidMap[uAc]);
+    }
+
+    /* If the rest of the packets can't be transmitted due to lack of resources, stop the queue. */
+    else if (eHwQueStatus == TX_HW_QUE_STATUS_STOP_CURRENT)
+    {
+#ifdef TI_DBG
+        pTxCtrl->dbgCounters.dbgNumPktsBusy[uAc]++;
+        TRACE2(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_XmitDataBurst(): Queue busy - %d packets not sent, queue = %d\n", uNumPkts - uNumAllocated, uAc);
+#endif
+        txDataQ_StopQueue (pTxCtrl->hTxDataQ, pTxCtrl->admittedAcToTidMap[uAc]);
+    }
+
+    /* Prepare the allocated packets (only the last one carries the backpressure indication). */
+    {
+        CL_TRACE_START_L4();
+        for (uPkt = 0; uPkt < uNumAllocated; uPkt++)
+        {
+            txCtrl_BuildDataPkt(pTxCtrl, aPktsCtrlBlk[uPkt], uAc, (uPkt + 1 == uNumAllocated) ? uBackpressure : 0);
+        }
+        CL_TRACE_END_L4("tiwlan_drv.ko", "INHERIT", "TX", ".FillCtrlBlk");
+    }
+
+    /* Hand the prepared packets to the Tx-Xfer in one chain (it returns only on a failed packet). */
+    uPkt = 0;
+    while (uPkt < uNumAllocated)
+    {
+        {
+            CL_TRACE_START_L4();
+            eStatus = TWD_txXfer_SendPacketBurst (pTxCtrl->hTWD, &aPktsCtrlBlk[uPkt], uNumAllocated - uPkt, &uNumSent);
+            CL_TRACE_END_L4("tiwlan_drv.ko", "INHERIT", "TX", ".XferSendPacket");
+        }
+
+#ifdef TI_DBG
+        pTxCtrl->dbgCounters.dbgNumPktsSuccess[uAc] += uNumSent;
+#endif
+        uPkt += uNumSent;
+
+        if (eStatus == TXN_STATUS_ERROR)
+        {
+#ifdef TI_DBG
+            TRACE2(pTxCtrl->hReport, REPORT_SEVERITY_ERROR, "txCtrl_XmitDataBurst(): Xfer Error, queue = %d, Status = %d\n", uAc, eStatus);
+            pTxCtrl->dbgCounters.dbgNumPktsError[uAc]++;
+#endif
+            /* Free the failed packet resources (packet and CtrlBlk) and continue with the next ones */
+            txCtrl_FreePacket (pTxCtrl, aPktsCtrlBlk[uPkt], TI_NOK);
+            uPkt++;
+        }
+    }
+
+    *pNumHandled = uNumAllocated;
+
+    CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX", "");
+    return (uNumAllocated < uNumPkts) ? STATUS_XMIT_BUSY : STATUS_XMIT_SUCCESS;
+}
+
+
 /*******************************************************************************
 *                          txCtrl_XmitMgmt		                               *
 ********************************************************************************
@@ -627,6 +770,21 @@ void txCtrl_FreePacket (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eS
 {
     txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
+    /* Free the packet buffer */
+    txCtrl_FreePacketBuf (pTxCtrl, pPktCtrlBlk, eStatus);
+
+    /* Free the CtrlBlk */
+    TWD_txCtrlBlk_Free (pTxCtrl->hTWD, pPktCtrlBlk);
+}
+
+
+/***************************************************************************
+*                           txCtrl_FreePacketBuf
+****************************************************************************
+* DESCRIPTION:  Free the packet buffer (raw buffer or OS packet), but not the CtrlBlk
+***************************************************************************/
+static void txCtrl_FreePacketBuf (txCtrl_t *pTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eStatus)
+{
     TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_FreePacket(): RawBufFlag = 0x%x, pBuf = 0x%x, Len = %d\n", (pPktCtrlBlk->tTxPktParams.uFlags & TX_CTRL_FLAG_PKT_IN_RAW_BUF), pPktCtrlBlk->tTxPktParams.pInputPkt, pPktCtrlBlk->tTxPktParams.uInputPktLen);
 
     /* If the packet is in a raw buffer, free its memory */
@@ -641,9 +799,6 @@ void txCtrl_FreePacket (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eS
     {
         wlanDrvIf_FreeTxPacket (pTxCtrl->hOs, pPktCtrlBlk, eStatus);
     }
-
-    /* Free the CtrlBlk */
-    TWD_txCtrlBlk_Free (pTxCtrl->hTWD, pPktCtrlBlk);
 }
 
 
@@ -670,10 +825,107 @@ void txCtrl_FreePacket (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eS
 static void txCtrl_TxCompleteCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *pTxResultInfo)
 {
     txCtrl_t    *pTxCtrl = (txCtrl_t *)hTxCtrl;
+    TTxCtrlBlk  *pPktCtrlBlk;
+    TTxCmpltCounters tCounters;
+    CL_TRACE_START_L3();
+
+    /* Update the TKIP/AES sequence-number according to the Tx data packet security-seq-num. */
+    /* Note: The FW always provides the last used seq-num so no need to check if the current
+		packet is data and WEP is on. */
+    TWD_SetSecuritySeqNum (pTxCtrl->hTWD, pTxResultInfo->lsbSecuritySequenceNumber);
+
+    tCounters.uAcBitmap = 0;
+    tCounters.bLastHwTxRateValid = TI_FALSE;
+    pPktCtrlBlk = txCtrl_HandleTxResult (pTxCtrl, pTxResultInfo, &tCounters);
+    txCtrl_CommitTxCounters (pTxCtrl, &tCounters);
+
+    /* Free the packet resources (packet and CtrlBlk)  */
+    if (pPktCtrlBlk != NULL)
+    {
+        txCtrl_FreePacket (pTxCtrl, pPktCtrlBlk, TI_OK);
+    }
+
+    CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
+}
+
+
+/*************************************************************************
+*                        txCtrl_TxCompleteListCb		                         *
+**************************************************************************
+* DESCRIPTION:  Called by the TWD upon Tx-complete of a list of packets
+*				  (the new results, consecutive in the FW results queue).
+*				Handle the packets results as txCtrl_TxCompleteCb, except:
+*				- The security sequence number is updated once, by the last result
+*				    (the FW provides the last used one, and a list is shorter than 
+*				    its 8 LSB wrap around)
+*				- All CtrlBlks are freed together, with one lock
+*				- The counters are accumulated per AC and added once, after the list
+*				    (see txCtrl_CommitTxCounters)
+*
+* INPUT:    hTxCtrl -  The module object.
+*		    aTxResults - The packets Tx results information.
+*		    uNumResults - The number of results.
+*
+*************************************************************************/
+static void txCtrl_TxCompleteListCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *aTxResults, TI_UINT32 uNumResults)
+{
+    txCtrl_t    *pTxCtrl = (txCtrl_t *)hTxCtrl;
+    TTxCtrlBlk  *apFreeCtrlBlks[TRQ_DEPTH];
+    TTxCtrlBlk  *pPktCtrlBlk;
+    TTxCmpltCounters tCounters;
+    TI_UINT32    uNumFree = 0;
+    TI_UINT32    i;
+    CL_TRACE_START_L3();
+
+    if (uNumResults == 0)
+    {
+        CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
+        return;
+    }
+
+    TWD_SetSecuritySeqNum (pTxCtrl->hTWD, aTxResults[uNumResults - 1].lsbSecuritySequenceNumber);
+
+    tCounters.uAcBitmap = 0;
+    tCounters.bLastHwTxRateValid = TI_FALSE;
+
+    for (i = 0; i < uNumResults; i++)
+    {
+        pPktCtrlBlk = txCtrl_HandleTxResult (pTxCtrl, &aTxResults[i], &tCounters);
+        if (pPktCtrlBlk != NULL)
+        {
+            /* Free the packet now, and keep the CtrlBlk for the common free */
+            txCtrl_FreePacketBuf (pTxCtrl, pPktCtrlBlk, TI_OK);
+            apFreeCtrlBlks[uNumFree++] = pPktCtrlBlk;
+        }
+    }
+
+    txCtrl_CommitTxCounters (pTxCtrl, &tCounters);
+
+    TWD_txCtrlBlk_FreeList (pTxCtrl->hTWD, apFreeCtrlBlks, uNumFree);
+
+    CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
+}
+
+
+/*************************************************************************
+*                        txCtrl_HandleTxResult		                         *
+**************************************************************************
+* DESCRIPTION:  Handle one packet Tx result:
+*				- Update counters (statistics and medium-usage)
+*				- Update the admission control tokens and TSM delay counters
+*
+* INPUT:    pTxCtrl -  The module object.
+*		    pTxResultInfo - The packet's Tx result information.
+*		    pCounters - The list counters (committed by the caller with txCtrl_CommitTxCounters).
+*
+* RETURN:   The packet CtrlBlk to free, or NULL if it is already free (not expected).
+*************************************************************************/
+static TTxCtrlBlk *txCtrl_HandleTxResult (txCtrl_t *pTxCtrl, TxResultDescriptor_t *pTxResultInfo,
+                                          TTxCmpltCounters *pCounters)
+{
     TTxCtrlBlk  *pPktCtrlBlk;
     TI_UINT32	ac;
     TI_BOOL	    bIsDataPkt;
-    CL_TRACE_START_L3();
 
     /* Get packet ctrl-block by desc-ID. */
     pPktCtrlBlk = TWD_txCtrlBlk_GetPointer (pTxCtrl->hTWD, pTxResultInfo->descID);
@@ -683,16 +935,11 @@ static void txCtrl_TxCompleteCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *pTxRes
     /* If the pointed entry is already free, print error and exit (not expected to happen). */
     if (pPktCtrlBlk->pNextFreeEntry != NULL)
     {
-        TRACE2(pTxCtrl->hReport, REPORT_SEVERITY_ERROR, "txCtrl_TxCompleteCb(): Pkt already free!!, DescID=%d, AC=%d\n", pTxResultInfo->descID, ac);
-        CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
-        return;
+        TRACE2(pTxCtrl->hReport, REPORT_SEVERITY_ERROR, "txCtrl_HandleTxResult(): Pkt already free!!, DescID=%d, AC=%d\n", pTxResultInfo->descID, ac);
+        return NULL;
     }
-    TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_TxCompleteCb(): Pkt Tx Complete, DescID=%d, AC=%d, Status=%d\n", pTxResultInfo->descID, ac, pTxResultInfo->status);
+    TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_HandleTxResult(): Pkt Tx Complete, DescID=%d, AC=%d, Status=%d\n", pTxResultInfo->descID, ac, pTxResultInfo->status);
 #endif
-    /* Update the TKIP/AES sequence-number according to the Tx data packet security-seq-num. */
-    /* Note: The FW always provides the last used seq-num so no need to check if the current
-		packet is data and WEP is on. */
-    TWD_SetSecuritySeqNum (pTxCtrl->hTWD, pTxResultInfo->lsbSecuritySequenceNumber);
 
     bIsDataPkt = ( (pPktCtrlBlk->tTxPktParams.uPktType == TX_PKT_TYPE_ETHER) ||
                    (pPktCtrlBlk->tTxPktParams.uPktType == TX_PKT_TYPE_WLAN_DATA) );
@@ -705,99 +952,131 @@ static void txCtrl_TxCompleteCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *pTxRes
         tokensCalculation(pTxCtrl, pTxResultInfo, ac);
     }
 
+    /* Start the AC list counters on its first result */
+    if ((pCounters->uAcBitmap & (1 << ac)) == 0)
+    {
+        os_memoryZero (pTxCtrl->hOs, &pCounters->aAc[ac], sizeof(TTxCmpltAcCounters));
+        pCounters->uAcBitmap |= (1 << ac);
+    }
+
     /* Add the medium usage time for the specific queue. */
-    pTxCtrl->totalUsedTime[ac] += (TI_UINT32)ENDIAN_HANDLE_WORD(pTxResultInfo->mediumUsage);
+    pCounters->aAc[ac].uUsedTime += (TI_UINT32)ENDIAN_HANDLE_WORD(pTxResultInfo->mediumUsage);
 
     /* update TX counters for txDistributer */
     {
         CL_TRACE_START_L4();
-        txCtrl_UpdateTxCounters (pTxCtrl, pTxResultInfo, pPktCtrlBlk, ac, bIsDataPkt);
+        txCtrl_UpdateTxCounters (pTxCtrl, pTxResultInfo, pPktCtrlBlk, ac, bIsDataPkt, pCounters);
         CL_TRACE_END_L4("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", ".Cntrs");
     }
 
     if (TI_TRUE == bIsDataPkt)
     {
-        if (pTxCtrl->TSMInProgressBitmap && (0x01 << pPktCtrlBlk->tTxDescriptor.tid))
+        /* Update the Tx latency histograms of successfully transmitted packets (if enabled) */
+        if (pTxCtrl->tTxLatency.bEnabled && (pTxResultInfo->status == TX_SUCCESS))
+        {
+            txCtrl_UpdateLatencyHist (pTxCtrl, pTxResultInfo, pPktCtrlBlk, ac);
+        }
+
+        if (pTxCtrl->TSMInProgressBitmap & (0x01 << pPktCtrlBlk->tTxDescriptor.tid))
         {
             txCtrl_UpdateTSMDelayCounters(pTxCtrl, pTxResultInfo, pPktCtrlBlk->tTxDescriptor.tid);
         }
     }
 
-    /* Free the packet resources (packet and CtrlBlk)  */
-    txCtrl_FreePacket (pTxCtrl, pPktCtrlBlk, TI_OK);
+    return pPktCtrlBlk;
+}
 
-    CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
+
+/*************************************************************************
+*                        txCtrl_CommitTxCounters		                         *
+**************************************************************************
+* DESCRIPTION:  Add the counters accumulated over a Tx results list (per AC)
+*				  to the module counters, and save the last data Tx rate.
+*
+* INPUT:    pTxCtrl -  The module object.
+*		    pCounters - The list counters.
+*
+*************************************************************************/
+static void txCtrl_CommitTxCounters (txCtrl_t *pTxCtrl, TTxCmpltCounters *pCounters)
+{
+    TTxCmpltAcCounters *pAcCounters;
+    TTxDataCounters    *pDataCounters;
+    TI_UINT32           uAcBitmap = pCounters->uAcBitmap;
+    TI_UINT32           ac;
+
+    for (ac = 0; uAcBitmap != 0; ac++, uAcBitmap >>= 1)
+    {
+        if ((uAcBitmap & 1) == 0)
+        {
+            continue;
+        }
+
+        pAcCounters   = &pCounters->aAc[ac];
+        pDataCounters = &pTxCtrl->txDataCounters[ac];
+
+        pTxCtrl->totalUsedTime[ac]         += pAcCounters->uUsedTime;
+        pDataCounters->XmitOk              += pAcCounters->uXmitOk;
+        pDataCounters->DirectedFramesXmit  += pAcCounters->uDirectedFrames;
+        pDataCounters->DirectedBytesXmit   += pAcCounters->uDirectedBytes;
+        pDataCounters->MulticastFramesXmit += pAcCounters->uMulticastFrames;
+        pDataCounters->MulticastBytesXmit  += pAcCounters->uMulticastBytes;
+        pDataCounters->BroadcastFramesXmit += pAcCounters->uBroadcastFrames;
+        pDataCounters->BroadcastBytesXmit  += pAcCounters->uBroadcastBytes;
+#ifdef TI_DBG
+        pTxCtrl->dbgCounters.dbgNumTxCmplt[ac]        += pAcCounters->uDbgNumTxCmplt;
+        pTxCtrl->dbgCounters.dbgNumTxCmpltOk[ac]      += pAcCounters->uDbgNumTxCmpltOk;
+        pTxCtrl->dbgCounters.dbgNumTxCmpltError[ac]   += pAcCounters->uDbgNumTxCmpltError;
+        pTxCtrl->dbgCounters.dbgNumTxCmpltOkBytes[ac] += pAcCounters->uDbgNumTxCmpltOkBytes;
+#endif
+    }
+
+    if (pCounters->bLastHwTxRateValid)
+    {
+        rate_PolicyToDrv ((ETxRateClassId)pCounters->uLastHwTxRate, &pTxCtrl->eCurrentTxRate);
+    }
 }
 
 
 /***************************************************************************
-*                   txCtrl_BuildDataPktHdr                                 *
+*                   txCtrl_BuildDataHdrBase                                *
 ****************************************************************************
-* DESCRIPTION:  this function builds the WLAN header from ethernet format,
-*               including 802.11-MAC, LLC/SNAP, security padding, alignment padding.
+* DESCRIPTION:  Build the 802.11 header part which is common to all data packets
+*               of the BSS: alignment pad, frame control, BSSID address, and the
+*               lengths of the QoS, HT-control and security fields.
+*               The per packet fields (addresses from the Ethernet header and
+*               QoS control) are set later by txCtrl_BuildDataPktHdr.
 *
-* INPUTS:       hTxCtrl - the object
-*               pPktCtrlBlk - data packet control block (Ethernet header)
+* INPUTS:       pTxCtrl - the object
+*               pHdr - the header buffer (MAX_HEADER_SIZE bytes)
+*               bEncrypt - set the WEP bit and add the security pad
+*
+* OUTPUT:       pHdrLen - the header length up to the LLC/SNAP, including the alignment pad
 *
 * RETURNS:      uHdrAlignPad - Num of bytes (0 or 2) added at the header's beginning for 4-bytes alignment.
 ***************************************************************************/
-
-TI_UINT32 txCtrl_BuildDataPktHdr (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, AckPolicy_e eAckPolicy)
+static TI_UINT32 txCtrl_BuildDataHdrBase (txCtrl_t *pTxCtrl, TI_UINT8 *pHdr, TI_BOOL bEncrypt, TI_UINT32 *pHdrLen)
 {
-    txCtrl_t   *pTxCtrl  = (txCtrl_t *)  hTxCtrl;
-
-    TEthernetHeader     *pEthHeader;
     dot11_header_t      *pDot11Header;
-    Wlan_LlcHeader_T    *pWlanSnapHeader;
-    EHeaderConvertMode	eQosMode = pTxCtrl->headerConverMode;
     TI_UINT32			uHdrLen = 0;
     TI_UINT32			uHdrAlignPad = 0;
-    TI_UINT16			uQosControl;
     TI_UINT16			fc = 0;
-    TI_UINT16           typeLength;
 
-
-    /*
-     * Handle encryption if needed, for data or EAPOL (decision was done at RSN):
-     *   - Set WEP bit in header.
-     *   - Add padding for FW security overhead: 4 bytes for TKIP, 8 for AES.
-     */
-
-    if ( ( (pPktCtrlBlk->tTxPktParams.uPktType != TX_PKT_TYPE_EAPOL)
-            &&
-            pTxCtrl->currentPrivacyInvokedMode
-         )
-
-            ||
-
-            ( (pPktCtrlBlk->tTxPktParams.uPktType == TX_PKT_TYPE_EAPOL)
-              &&
-              pTxCtrl->eapolEncryptionStatus
-              &&
-              (txMgmtQ_GetConnState(pTxCtrl->hTxMgmtQ) == TX_CONN_STATE_OPEN)
-            )                                                                   /* - Encrypt Eapols only when eapolEncryptionStatus is true
-                                                                                  and station is connected (during re-key).
-                                                                                - In connection and roaming do not encrypt Eapols.
-                                                                                - This condition will cost us an extra clock tick in
-                                                                                  the Data Path ONLY in case of an Eapol.
-                                                                                  This is not the common case in the Data Path.
-                                                                              */
-       )
+    /* Set WEP bit in header and add padding for FW security overhead: 4 bytes for TKIP, 8 for AES. */
+    if (bEncrypt)
     {
         fc |= DOT11_FC_WEP;
         uHdrLen += pTxCtrl->encryptionFieldSize;
         uHdrAlignPad = pTxCtrl->encryptionFieldSize % 4;
     }
 
-
     /*
      * Handle QoS if needed:
      */
-    if (eQosMode == HDR_CONVERT_QOS)
+    if (pTxCtrl->headerConverMode == HDR_CONVERT_QOS)
     {
         uHdrAlignPad = (uHdrAlignPad + HEADER_PAD_SIZE) % 4; /* Add 2 bytes pad at the header beginning for 4 bytes alignment. */
-        pDot11Header = (dot11_header_t *)&(pPktCtrlBlk->aPktHdr[uHdrAlignPad]);
         uHdrLen += WLAN_QOS_HDR_LEN;
+        fc |= DOT11_FC_DATA_QOS;
 
         /* add empty 4Byte for HT control field set via the FW */
         if (pTxCtrl->tTxCtrlHtControl.bHtEnable == TI_TRUE)
@@ -805,20 +1084,102 @@ TI_UINT32 txCtrl_BuildDataPktHdr (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, Ac
             uHdrLen += WLAN_QOS_HT_CONTROL_FIELD_LEN;
             fc |= DOT11_FC_ORDER;
         }
-
-        /* Set Qos control fields. */
-        uQosControl = (TI_UINT16)(pPktCtrlBlk->tTxDescriptor.tid);
-        if ( TI_UNLIKELY(eAckPolicy == ACK_POLICY_NO_ACK) )
-            uQosControl |= DOT11_QOS_CONTROL_DONT_ACK;
-        COPY_WLAN_WORD(&pDot11Header->qosControl, &uQosControl); /* copy with endianess handling. */
     }
     else  /* No QoS (legacy header, padding is not needed). */
     {
-        pDot11Header = (dot11_header_t *)&(pPktCtrlBlk->aPktHdr[uHdrAlignPad]);
         uHdrLen += WLAN_HDR_LEN;
+        fc |= DOT11_FC_DATA;
     }
     uHdrLen += uHdrAlignPad;
 
+    pDot11Header = (dot11_header_t *)&(pHdr[uHdrAlignPad]);
+
+    /* Set the BSSID address: address3 in Independent-BSS, address1 (to DS) in Infrastructure-BSS. */
+    if ( TI_UNLIKELY(pTxCtrl->currBssType == BSS_INDEPENDENT) )
+    {
+        MAC_COPY (pDot11Header->address3, pTxCtrl->currBssId);
+    }
+    else
+    {
+        MAC_COPY (pDot11Header->address1, pTxCtrl->currBssId);
+        fc |= DOT11_FC_TO_DS;
+    }
+
+    COPY_WLAN_WORD(&pDot11Header->fc, &fc); /* copy with endianess handling. */
+
+    *pHdrLen = uHdrLen;
+    return uHdrAlignPad;
+}
+
+
+/***************************************************************************
+*                   txCtrl_BuildDataPktHdr                                 *
+****************************************************************************
+* DESCRIPTION:  this function builds the WLAN header from ethernet format,
+*               including 802.11-MAC, LLC/SNAP, security padding, alignment padding.
+*               For data packets the BSS common part is copied from the header
+*               template (rebuilt if invalidated by a parameters change).
+*
+* INPUTS:       hTxCtrl - the object
+*               pPktCtrlBlk - data packet control block (Ethernet header)
+*
+* RETURNS:      uHdrAlignPad - Num of bytes (0 or 2) added at the header's beginning for 4-bytes alignment.
+***************************************************************************/
+
+TI_UINT32 txCtrl_BuildDataPktHdr (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, AckPolicy_e eAckPolicy)
+{
+    txCtrl_t   *pTxCtrl  = (txCtrl_t *)  hTxCtrl;
+
+    TTxDataHdrTemplate  *pTemplate = &pTxCtrl->tDataHdrTemplate;
+    TEthernetHeader     *pEthHeader;
+    dot11_header_t      *pDot11Header;
+    Wlan_LlcHeader_T    *pWlanSnapHeader;
+    TI_UINT32			uHdrLen;
+    TI_UINT32			uHdrAlignPad;
+    TI_UINT16			uQosControl;
+    TI_UINT16           typeLength;
+
+
+    if (TI_LIKELY(pPktCtrlBlk->tTxPktParams.uPktType != TX_PKT_TYPE_EAPOL))
+    {
+        /* Rebuild the template if invalidated (encrypt data packets if privacy is invoked) */
+        if (TI_UNLIKELY(!pTemplate->bValid))
+        {
+            os_memoryZero (pTxCtrl->hOs, pTemplate->aHdr, MAX_HEADER_SIZE);
+            pTemplate->uHdrAlignPad = txCtrl_BuildDataHdrBase (pTxCtrl, pTemplate->aHdr,
+                                                               pTxCtrl->currentPrivacyInvokedMode, &pTemplate->uHdrLen);
+            pTemplate->bValid = TI_TRUE;
+        }
+
+        os_memoryCopy (pTxCtrl->hOs, pPktCtrlBlk->aPktHdr, pTemplate->aHdr, pTemplate->uHdrLen);
+        uHdrLen      = pTemplate->uHdrLen;
+        uHdrAlignPad = pTemplate->uHdrAlignPad;
+    }
+    else
+    {
+        /*
+         * Encrypt Eapols only when eapolEncryptionStatus is true and station is connected (during re-key).
+         *   - In connection and roaming do not encrypt Eapols.
+         *   - This condition will cost us an extra clock tick in the Data Path ONLY in case of an Eapol.
+         *     This is not the common case in the Data Path.
+         */
+        uHdrAlignPad = txCtrl_BuildDataHdrBase (pTxCtrl, pPktCtrlBlk->aPktHdr,
+                                                (pTxCtrl->eapolEncryptionStatus &&
+                                                 (txMgmtQ_GetConnState(pTxCtrl->hTxMgmtQ) == TX_CONN_STATE_OPEN)),
+                                                &uHdrLen);
+    }
+
+    pDot11Header = (dot11_header_t *)&(pPktCtrlBlk->aPktHdr[uHdrAlignPad]);
+
+    /* Set Qos control fields. */
+    if (pTxCtrl->headerConverMode == HDR_CONVERT_QOS)
+    {
+        uQosControl = (TI_UINT16)(pPktCtrlBlk->tTxDescriptor.tid);
+        if ( TI_UNLIKELY(eAckPolicy == ACK_POLICY_NO_ACK) )
+            uQosControl |= DOT11_QOS_CONTROL_DONT_ACK;
+        COPY_WLAN_WORD(&pDot11Header->qosControl, &uQosControl); /* copy with endianess handling. */
+    }
+
     /* Before the header translation the first buf-pointer points to the Ethernet header. */
     pEthHeader = (TEthernetHeader *)(pPktCtrlBlk->tTxnStruct.aBuf[0]);
 
@@ -831,34 +1192,18 @@ TI_UINT32 txCtrl_BuildDataPktHdr (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, Ac
         }
     }
 
-    /* Set MAC header fields for Independent-BSS case. */
+    /* Set MAC header addresses from the Ethernet header (the BSSID is already set). */
     if ( TI_UNLIKELY(pTxCtrl->currBssType == BSS_INDEPENDENT) )
     {
         MAC_COPY (pDot11Header->address1, pEthHeader->dst);
         MAC_COPY (pDot11Header->address2, pEthHeader->src);
-        MAC_COPY (pDot11Header->address3, pTxCtrl->currBssId);
-
-        if (eQosMode == HDR_CONVERT_QOS)
-            fc |= DOT11_FC_DATA_QOS;
-        else
-            fc |= DOT11_FC_DATA;
     }
-
-    /* Set MAC header fields for Infrastructure-BSS case. */
     else
     {
-        MAC_COPY (pDot11Header->address1, pTxCtrl->currBssId);
         MAC_COPY (pDot11Header->address2, pEthHeader->src);
         MAC_COPY (pDot11Header->address3, pEthHeader->dst);
-
-        if (eQosMode == HDR_CONVERT_QOS)
-            fc |= DOT11_FC_DATA_QOS | DOT11_FC_TO_DS;
-        else
-            fc |= DOT11_FC_DATA | DOT11_FC_TO_DS;
     }
 
-    COPY_WLAN_WORD(&pDot11Header->fc, &fc); /* copy with endianess handling. */
-
     /* Set the SNAP header pointer right after the other header parts handled above. */
     pWlanSnapHeader = (Wlan_LlcHeader_T *)&(pPktCtrlBlk->aPktHdr[uHdrLen]);
 
@@ -1245,21 +1590,56 @@ static void txCtrl_UpdatePriorityMap(txCtrl_t *pTxCtrl, TI_UINT32 priorityBitMap
 
 }
 
+/* Get the log2 histogram bucket of a latency in usec: [2^i, 2^(i+1)) is bucket i (0 is also in bucket 0) */
+static inline TI_UINT32 txCtrl_LatencyBucket (TI_UINT32 uLatencyUs)
+{
+    TI_UINT32 uBucket = 0;
+
+    if (uLatencyUs >= 0x10000) { uBucket += 16; uLatencyUs >>= 16; }
+    if (uLatencyUs >= 0x100)   { uBucket += 8;  uLatencyUs >>= 8;  }
+    if (uLatencyUs >= 0x10)    { uBucket += 4;  uLatencyUs >>= 4;  }
+    if (uLatencyUs >= 0x4)     { uBucket += 2;  uLatencyUs >>= 2;  }
+    if (uLatencyUs >= 0x2)     { uBucket += 1; }
+
+    return (uBucket < TX_LATENCY_HIST_BUCKETS) ? uBucket : (TX_LATENCY_HIST_BUCKETS - 1);
+}
+
 /****************************************************************************
- *                      txCtrl_SetTxDelayCounters()
+ *                      txCtrl_UpdateLatencyHist()
  ****************************************************************************
- * DESCRIPTION:          Update transmission path delay counters.
-*
-* INPUTS:       hTxCtrl - the object
-*               ac - the AC to count delay for
-*				fwDelay - the time consumed in FW for packet transmission
-*				driverDelay - the time consumed in driver for packet transmission
-*
-* OUTPUT:
-*
-* RETURNS:
+ * DESCRIPTION:  Update the Tx latency histograms of the packet's AC.
+ *               The packet latency is split to:
+ *               - Host queueing: from wlanDrvIf_Xmit until the Xfer to the FW (uDriverDelay, msec granularity)
+ *               - FW queueing:   from the Xfer until the first medium access (totalDelay - mediumDelay)
+ *               - Medium time:   from the first medium access until Tx complete (mediumDelay)
+ *               and the end to end latency is their sum.
+ *
+ * INPUTS:       pTxCtrl - the object
+ *               pTxResultInfo - the packet's Tx result information
+ *               pPktCtrlBlk - the packet's control block
+ *               ac - the AC to count the latency for
+ *
+ * OUTPUT:
+ *
+ * RETURNS:
  ****************************************************************************/
-
+static void txCtrl_UpdateLatencyHist (txCtrl_t *pTxCtrl,
+                                      TxResultDescriptor_t *pTxResultInfo,
+                                      TTxCtrlBlk *pPktCtrlBlk,
+                                      TI_UINT32 ac)
+{
+    TTxLatencyHist *pHist        = &pTxCtrl->tTxLatency.tAcHist[ac];
+    TI_UINT32       uHostDelay   = pPktCtrlBlk->tTxPktParams.uDriverDelay * 1000;
+    TI_UINT32       uTotalDelay  = ENDIAN_HANDLE_LONG(pTxResultInfo->totalDelay);
+    TI_UINT32       uMediumDelay = ENDIAN_HANDLE_LONG(pTxResultInfo->mediumDelay);
+    TI_UINT32       uFwDelay     = (uTotalDelay > uMediumDelay) ? (uTotalDelay - uMediumDelay) : 0;
+
+    pHist->uNumPackets++;
+    pHist->aHist[TX_LATENCY_HOST][txCtrl_LatencyBucket (uHostDelay)]++;
+    pHist->aHist[TX_LATENCY_FW_QUEUE][txCtrl_LatencyBucket (uFwDelay)]++;
+    pHist->aHist[TX_LATENCY_MEDIUM][txCtrl_LatencyBucket (uMediumDelay)]++;
+    pHist->aHist[TX_LATENCY_TOTAL][txCtrl_LatencyBucket (uHostDelay + uTotalDelay)]++;
+}
 
 
 
@@ -1451,8 +1831,10 @@ static void txCtrl_UpdateTxCounters (txCtrl_t *pTxCtrl,
                                      TxResultDescriptor_t *pTxResultInfo,
                                      TTxCtrlBlk *pPktCtrlBlk,
                                      TI_UINT32 ac,
-                                     TI_BOOL bIsDataPkt)
+                                     TI_BOOL bIsDataPkt,
+                                     TTxCmpltCounters *pCounters)
 {
+    TTxCmpltAcCounters *pAcCounters = &pCounters->aAc[ac];
     TI_UINT32 pktLen;
     TI_UINT32 dataLen;
     TI_UINT32 retryHistogramIndex;
@@ -1464,15 +1846,15 @@ static void txCtrl_UpdateTxCounters (txCtrl_t *pTxCtrl,
 #ifdef TI_DBG
 
     /* update debug counters. */
-    pTxCtrl->dbgCounters.dbgNumTxCmplt[ac]++;
+    pAcCounters->uDbgNumTxCmplt++;
     if (pTxResultInfo->status == TX_SUCCESS)
     {
-        pTxCtrl->dbgCounters.dbgNumTxCmpltOk[ac]++;
-        pTxCtrl->dbgCounters.dbgNumTxCmpltOkBytes[ac] += pktLen;
+        pAcCounters->uDbgNumTxCmpltOk++;
+        pAcCounters->uDbgNumTxCmpltOkBytes += pktLen;
     }
     else
     {
-        pTxCtrl->dbgCounters.dbgNumTxCmpltError[ac]++;
+        pAcCounters->uDbgNumTxCmpltError++;
 
         if (pTxResultInfo->status == TX_HW_ERROR        ||
                 pTxResultInfo->status == TX_KEY_NOT_FOUND   ||
@@ -1515,34 +1897,34 @@ static void txCtrl_UpdateTxCounters (txCtrl_t *pTxCtrl,
             if (pPktCtrlBlk->tTxPktParams.uFlags & TX_CTRL_FLAG_BROADCAST)
             {
                 /* Broadcast frame */
-                pTxCtrl->txDataCounters[ac].BroadcastFramesXmit++;
-                pTxCtrl->txDataCounters[ac].BroadcastBytesXmit += dataLen;
+                pAcCounters->uBroadcastFrames++;
+                pAcCounters->uBroadcastBytes += dataLen;
                 EventMask |= BROADCAST_BYTES_XFER;
                 EventMask |= BROADCAST_FRAMES_XFER;
             }
             else
             {
                 /* Multicast Address */
-                pTxCtrl->txDataCounters[ac].MulticastFramesXmit++;
-                pTxCtrl->txDataCounters[ac].MulticastBytesXmit += dataLen;
+                pAcCounters->uMulticastFrames++;
+                pAcCounters->uMulticastBytes += dataLen;
                 EventMask |= MULTICAST_BYTES_XFER;
                 EventMask |= MULTICAST_FRAMES_XFER;
             }
         }
         else
         {
-            /* Save last data Tx rate for applications' query */
-            EHwBitRate eHwTxRate = ENDIAN_HANDLE_LONG((EHwBitRate)(pTxResultInfo->rate));
-            rate_PolicyToDrv (eHwTxRate, &pTxCtrl->eCurrentTxRate);
+            /* Save last data Tx rate for applications' query (converted once per list) */
+            pCounters->uLastHwTxRate = (TI_UINT32)ENDIAN_HANDLE_LONG(pTxResultInfo->rate);
+            pCounters->bLastHwTxRateValid = TI_TRUE;
 
             /* Directed frame statistics */
-            pTxCtrl->txDataCounters[ac].DirectedFramesXmit++;
-            pTxCtrl->txDataCounters[ac].DirectedBytesXmit += dataLen;
+            pAcCounters->uDirectedFrames++;
+            pAcCounters->uDirectedBytes += dataLen;
             EventMask |= DIRECTED_BYTES_XFER;
             EventMask |= DIRECTED_FRAMES_XFER;
         }
 
-        pTxCtrl->txDataCounters[ac].XmitOk++;
+        pAcCounters->uXmitOk++;
         EventMask |= XFER_OK;
 
         /* update the max consecutive retry failures (if needed) */
@@ -85,6 +85,52 @@ typedef struct
 } txDataDbgCounters_t;
 
 
+/*
+ * TTxCmpltCounters - the Tx-complete counters of a Tx results list, accumulated per AC while
+ *                    the list is handled and added to the module counters once (txCtrl_CommitTxCounters).
+ *                    An AC entry is valid only if its bit is set in uAcBitmap.
+ */
+typedef struct
+{
+    TI_UINT32  uUsedTime;                          /* Medium usage time (usec) */
+    TI_UINT32  uXmitOk;
+    TI_UINT32  uDirectedFrames;
+    TI_UINT32  uDirectedBytes;
+    TI_UINT32  uMulticastFrames;
+    TI_UINT32  uMulticastBytes;
+    TI_UINT32  uBroadcastFrames;
+    TI_UINT32  uBroadcastBytes;
+#ifdef TI_DBG
+    TI_UINT32  uDbgNumTxCmplt;
+    TI_UINT32  uDbgNumTxCmpltOk;
+    TI_UINT32  uDbgNumTxCmpltError;
+    TI_UINT32  uDbgNumTxCmpltOkBytes;
+#endif
+} TTxCmpltAcCounters;
+
+typedef struct
+{
+    TTxCmpltAcCounters aAc[MAX_NUM_OF_AC];
+    TI_UINT32          uAcBitmap;              /* The ACs that have results in the list */
+    TI_UINT32          uLastHwTxRate;          /* The rate of the last directed data packet sent */
+    TI_BOOL            bLastHwTxRateValid;     /* A directed data packet was sent (uLastHwTxRate is valid) */
+} TTxCmpltCounters;
+
+
+/*
+ * TTxDataHdrTemplate - the 802.11 header part which is common to all data packets of the BSS
+ *                      (alignment pad, frame control, BSSID, QoS and HT-control space, security pad).
+ *                      Invalidated on QoS, HT, privacy and BSS changes and rebuilt on the next packet.
+ */
+typedef struct
+{
+    TI_UINT8        aHdr[MAX_HEADER_SIZE]; /* Copied as is to the packet aPktHdr (the SNAP is written after it) */
+    TI_UINT32       uHdrLen;               /* The header length up to the LLC/SNAP, including the alignment pad */
+    TI_UINT32       uHdrAlignPad;          /* Bytes (0 or 2) added at the header's beginning for 4-bytes alignment */
+    TI_BOOL         bValid;                /* The template matches the current parameters */
+} TTxDataHdrTemplate;
+
+
 typedef struct
 {
     TI_HANDLE       hRequestTimer;
@@ -163,11 +209,13 @@ typedef struct
     TI_UINT16           txSessionCount;     /* Current Tx-Session index as configured to FW in last Join command. */
     TI_UINT16           dataPktDescAttrib;  /* A prototype of Tx-desc attrib bitmap for data pkts. */
     TI_UINT8            dbgPktSeqNum;       /* Increment every tx-pkt, insert in descriptor for debug. */
+    TTxDataHdrTemplate  tDataHdrTemplate;   /* The data packets 802.11 header template. */
 
     /* Counters */
     TTxDataCounters     txDataCounters[MAX_NUM_OF_AC]; /* Save Tx statistics per Tx-queue. */
     TI_UINT32           SumTotalDelayUs[MAX_NUM_OF_AC]; /* Store pkt delay sum in Usecs to avoid divide per
                                                             pkt, and covert to msec on user request. */
+    TIWLN_TX_LATENCY_STATISTICS tTxLatency;            /* Tx latency log2 histograms per Tx-queue (if enabled). */
     TI_UINT32           currentConsecutiveRetryFail; /* current consecutive number of tx failures due to max retry */
     ERate               eCurrentTxRate;                 /* Save last data Tx rate for applications' query */
 
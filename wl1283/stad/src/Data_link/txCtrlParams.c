@@ -198,6 +198,7 @@ void txCtrlParams_resetCounters(TI_HANDLE hTxCtrl)
 
     os_memoryZero(pTxCtrl->hOs, &pTxCtrl->txDataCounters, sizeof(TTxDataCounters) * MAX_NUM_OF_AC);
     os_memoryZero(pTxCtrl->hOs, &pTxCtrl->SumTotalDelayUs, sizeof(pTxCtrl->SumTotalDelayUs));
+    os_memoryZero(pTxCtrl->hOs, &pTxCtrl->tTxLatency.tAcHist, sizeof(pTxCtrl->tTxLatency.tAcHist));
 	pTxCtrl->currentConsecutiveRetryFail = 0;
 }
 
@@ -361,6 +362,12 @@ TI_STATUS txCtrlParams_getParam(TI_HANDLE hTxCtrl, paramInfo_t *pParamInfo)
 		pParamInfo->paramLength = sizeof(TTxDataCounters) * MAX_NUM_OF_AC;
         break;
 
+    case TX_CTRL_LATENCY_STATS_PARAM:
+        os_memoryCopy( pTxCtrl->hOs, pParamInfo->content.pTxLatencyStats, &(pTxCtrl->tTxLatency),
+                       sizeof(TIWLN_TX_LATENCY_STATISTICS));
+		pParamInfo->paramLength = sizeof(TIWLN_TX_LATENCY_STATISTICS);
+        break;
+
 	case TX_CTRL_GET_DATA_FRAME_COUNTER:
 		pParamInfo->content.txPacketsCount = 0;
 		for (ac = 0; ac < MAX_NUM_OF_AC; ac++)
@@ -471,6 +478,7 @@ void txCtrlParams_setBssId (TI_HANDLE hTxCtrl, TMacAddr *pCurrBssId)
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	MAC_COPY (pTxCtrl->currBssId, *pCurrBssId);
+	pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
 }
 
 
@@ -484,6 +492,7 @@ void txCtrlParams_setBssType (TI_HANDLE hTxCtrl, ScanBssType_e currBssType)
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	pTxCtrl->currBssType = currBssType;
+	pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
 }
 
 
@@ -497,6 +506,7 @@ void txCtrlParams_setQosHeaderConverMode (TI_HANDLE hTxCtrl, EHeaderConvertMode
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	pTxCtrl->headerConverMode = headerConverMode;
+	pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
 
 	updateDataPktPrototype(pTxCtrl);  /* Needed due to QoS mode change. */
 }
@@ -516,6 +526,7 @@ TI_STATUS txCtrlParams_SetHtControl (TI_HANDLE hTxCtrl, TtxCtrlHtControl *pHtCon
     txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
  
     pTxCtrl->tTxCtrlHtControl.bHtEnable = pHtControl->bHtEnable;
+    pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
 
     return TI_OK;
 }
@@ -530,6 +541,7 @@ void txCtrlParams_setCurrentPrivacyInvokedMode (TI_HANDLE hTxCtrl, TI_BOOL curre
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	pTxCtrl->currentPrivacyInvokedMode = currentPrivacyInvokedMode;
+	pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
 }
 
 
@@ -556,6 +568,7 @@ void txCtrlParams_setEncryptionFieldSizes (TI_HANDLE hTxCtrl, TI_UINT8 encryptio
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	pTxCtrl->encryptionFieldSize = encryptionFieldSize;
+	pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
 }
 
 
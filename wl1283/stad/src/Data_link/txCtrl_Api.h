@@ -168,6 +168,7 @@ void      txCtrl_Init (TStadHandlesList *pStadHandles);
 TI_STATUS txCtrl_SetDefaults (TI_HANDLE hTxCtrl, TInitTable *pInitTable);
 TI_STATUS txCtrl_Unload (TI_HANDLE hTxCtrl);
 EStatusXmit txCtrl_XmitData (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk);
+EStatusXmit txCtrl_XmitDataBurst (TI_HANDLE hTxCtrl, TTxCtrlBlk *aPktsCtrlBlk[], TI_UINT32 uNumPkts, TI_UINT32 *pNumHandled);
 TI_STATUS txCtrl_XmitMgmt (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk);
 void      txCtrl_UpdateQueuesMapping (TI_HANDLE hTxCtrl);
 void *    txCtrl_AllocPacketBuffer (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_UINT32 uPacketLen);
@@ -44,7 +44,7 @@
 #include "osApi.h"
 #include "report.h"
 #include "timer.h"
-#include "queue.h"
+#include "ringQueue.h"
 #include "context.h"
 #include "Ethernet.h"
 #include "TWDriver.h"
@@ -115,7 +115,6 @@ TI_HANDLE txDataQ_Create(TI_HANDLE hOs)
 void txDataQ_Init (TStadHandlesList *pStadHandles)
 {
     TTxDataQ  *pTxDataQ = (TTxDataQ *)(pStadHandles->hTxDataQ);
-    TI_UINT32  uNodeHeaderOffset = TI_FIELD_OFFSET(TTxnStruct, tTxnQNode);
     TI_UINT8   uQueId;
 	
     /* save modules handles */
@@ -142,13 +141,12 @@ void txDataQ_Init (TStadHandlesList *pStadHandles)
 	pTxDataQ->aQueueMaxSize[QOS_AC_VI] = DATA_QUEUE_DEPTH_VI;
 	pTxDataQ->aQueueMaxSize[QOS_AC_VO] = DATA_QUEUE_DEPTH_VO;
 
-    /* Create the tx data queues */
+    /* Create the tx data queues (filled in the network stack context and emptied in the driver context) */
 	for (uQueId = 0; uQueId < pTxDataQ->uNumQueues; uQueId++)
     {
-        pTxDataQ->aQueues[uQueId] = que_Create (pTxDataQ->hOs, 
-                                                pTxDataQ->hReport, 
-                                                pTxDataQ->aQueueMaxSize[uQueId], 
-                                                uNodeHeaderOffset);
+        pTxDataQ->aQueues[uQueId] = ringQue_Create (pTxDataQ->hOs, 
+                                                    pTxDataQ->hReport, 
+                                                    pTxDataQ->aQueueMaxSize[uQueId]);
 		
 		/* If any Queues' allocation failed, print error, free TxDataQueue module and exit */
 		if (pTxDataQ->aQueues[uQueId] == NULL)
@@ -179,6 +177,8 @@ void txDataQ_Init (TStadHandlesList *pStadHandles)
                                                    TI_TRUE,
                                                    "TX_DATA",
                                                    sizeof("TX_DATA"));
+    /* Data path client: invoked before the management clients */
+    context_SetClientPriority (pTxDataQ->hContext, pTxDataQ->uContextId, CONTEXT_PRIORITY_HIGH);
 	
 }
 
@@ -216,6 +216,17 @@ TI_STATUS txDataQ_SetDefaults (TI_HANDLE  hTxDataQ, txDataInitParams_t *pTxDataI
 	pTxDataQ->aTxSendPaceThresh[QOS_AC_BK] = pTxDataInitParams->uTxSendPaceThresh;
 	pTxDataQ->aTxSendPaceThresh[QOS_AC_VI] = pTxDataInitParams->uTxSendPaceThresh;
 	pTxDataQ->aTxSendPaceThresh[QOS_AC_VO] = 1;     /* Don't delay voice packts! */
+
+    /* Size the scheduler bursts to the configured Tx aggregation limit (0 or 1 disable aggregation) */
+    pTxDataQ->uBurstSize = pTxDataInitParams->uTxBurstPktsLimit;
+    if (pTxDataQ->uBurstSize == 0)
+    {
+        pTxDataQ->uBurstSize = 1;
+    }
+    else if (pTxDataQ->uBurstSize > DATA_QUEUE_MAX_BURST_SIZE)
+    {
+        pTxDataQ->uBurstSize = DATA_QUEUE_MAX_BURST_SIZE;
+    }
     
     TRACE0(pTxDataQ->hReport, REPORT_SEVERITY_INIT, ".....Tx Data Queue configured successfully\n");
 	
@@ -244,7 +255,7 @@ TI_STATUS txDataQ_Destroy (TI_HANDLE hTxDataQ)
     /* Free Data queues */
     for (uQueId = 0 ; uQueId < pTxDataQ->uNumQueues ; uQueId++)
     {
-        if (que_Destroy(pTxDataQ->aQueues[uQueId]) != TI_OK)
+        if (ringQue_Destroy(pTxDataQ->aQueues[uQueId]) != TI_OK)
 		{
             TRACE1(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "txDataQueue_unLoad: fail to free Data Queue number: %d\n",uQueId);
 			status = TI_NOK;
@@ -285,9 +296,7 @@ void txDataQ_ClearQueues (TI_HANDLE hTxDataQ)
     for (uQueId = 0 ; uQueId < pTxDataQ->uNumQueues ; uQueId++)
     {
         do {
-            context_EnterCriticalSection (pTxDataQ->hContext);
-            pPktCtrlBlk = (TTxCtrlBlk *) que_Dequeue (pTxDataQ->aQueues[uQueId]);
-            context_LeaveCriticalSection (pTxDataQ->hContext);
+            pPktCtrlBlk = (TTxCtrlBlk *) ringQue_Dequeue (pTxDataQ->aQueues[uQueId]);
             if (pPktCtrlBlk != NULL) {
             txCtrl_FreePacket (pTxDataQ->hTxCtrl, pPktCtrlBlk, TI_NOK);
         }
@@ -338,7 +347,7 @@ TI_STATUS txDataQ_InsertPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk, TI_
     
     pPktCtrlBlk->tTxPktParams.uPktType = TX_PKT_TYPE_ETHER;
 
-    /* Enter critical section to protect classifier data and queue access */
+    /* Enter critical section to protect classifier data */
     context_EnterCriticalSection (pTxDataQ->hContext);
 
 	/* Call the Classify function to set the TID field */
@@ -350,12 +359,15 @@ TI_STATUS txDataQ_InsertPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk, TI_
 #endif /* TI_DBG */
 	}
 
-	/* Enqueue the packet in the appropriate Queue */
+    /* Leave critical section */
+    context_LeaveCriticalSection (pTxDataQ->hContext);
+
+	/* Enqueue the packet in the appropriate Queue (no lock needed, this is the only producer) */
     uQueId = aTidToQueueTable[pPktCtrlBlk->tTxDescriptor.tid];
-    eStatus = que_Enqueue (pTxDataQ->aQueues[uQueId], (TI_HANDLE)pPktCtrlBlk);
+    eStatus = ringQue_Enqueue (pTxDataQ->aQueues[uQueId], (TI_HANDLE)pPktCtrlBlk);
 
-    /* Get number of packets in current queue */
-    uQueSize = que_Size (pTxDataQ->aQueues[uQueId]);
+    /* Get number of packets in current queue (the scheduler may have already dequeued some) */
+    uQueSize = ringQue_Size (pTxDataQ->aQueues[uQueId]);
 
     /* If the current queue is not stopped */
     if (((pTxDataQ->uQueueBusyBitMap >> uQueId) & 1) == TI_FALSE)
@@ -378,17 +390,16 @@ TI_STATUS txDataQ_InsertPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk, TI_
     }
 
     /* If allowed to stop network stack and the queue is full, indicate to stop network and 
-          to schedule Tx handling (both are executed below, outside the critical section!) */
-	if ((pTxDataQ->bStopNetStackTx) && (uQueSize == pTxDataQ->aQueueMaxSize[uQueId]))
+          to schedule Tx handling (both are executed below).
+       Note that the queue may be found full only upon overflow if the scheduler dequeued concurrently. */
+	if ((pTxDataQ->bStopNetStackTx) && 
+        ((uQueSize >= pTxDataQ->aQueueMaxSize[uQueId]) || (eStatus != TI_OK)))
 	{
 		pTxDataQ->aNetStackQueueStopped[uQueId] = TI_TRUE;
         bRequestSchedule = TI_TRUE;
         bStopNetStack = TI_TRUE;
     }
 
-    /* Leave critical section */
-    context_LeaveCriticalSection (pTxDataQ->hContext);
-
     /* If needed, schedule Tx handling */
 	if (bRequestSchedule)
 	{
@@ -590,7 +601,7 @@ void txDataQ_PrintModuleParams (TI_HANDLE hTxDataQ)
 	for (qIndex = 0; qIndex < MAX_NUM_OF_AC; qIndex++)
     {
         WLAN_OS_REPORT(("Que %d:\n", qIndex));
-        que_Print (pTxDataQ->aQueues[qIndex]);
+        ringQue_Print (pTxDataQ->aQueues[qIndex]);
     }
 
 	WLAN_OS_REPORT(("--------------------------------------------------\n\n"));
@@ -616,30 +627,32 @@ void txDataQ_PrintQueueStatistics (TI_HANDLE hTxDataQ)
 
 	WLAN_OS_REPORT(("-------------- txDataQueue_printStatistics -------\n\n"));
 
-	WLAN_OS_REPORT(("uClsfrMismatchCount      = %d\n",pTxDataQ->uClsfrMismatchCount));
+    WLAN_OS_REPORT(("uClsfrMismatchCount      = %d\n",pTxDataQ->uClsfrMismatchCount));
     WLAN_OS_REPORT(("uTxSendPaceTimeoutsCount = %d\n",pTxDataQ->uTxSendPaceTimeoutsCount));
+    WLAN_OS_REPORT(("uClsfrFlowCacheHits      = %d\n",pTxDataQ->tClsfrLookup.uFlowCacheHits));
+    WLAN_OS_REPORT(("uClsfrFlowCacheMisses    = %d\n",pTxDataQ->tClsfrLookup.uFlowCacheMisses));
 	
-	WLAN_OS_REPORT(("-------------- Enqueue to queues -----------------\n"));
+    WLAN_OS_REPORT(("-------------- Enqueue to queues -----------------\n"));
     for(qIndex = 0; qIndex < MAX_NUM_OF_AC; qIndex++)
         WLAN_OS_REPORT(("Que[%d]: = %d\n",qIndex, pTxDataQ->aQueueCounters[qIndex].uEnqueuePacket));
 	
-	WLAN_OS_REPORT(("-------------- Dequeue from queues ---------------\n"));
+    WLAN_OS_REPORT(("-------------- Dequeue from queues ---------------\n"));
     for(qIndex = 0; qIndex < MAX_NUM_OF_AC; qIndex++)
         WLAN_OS_REPORT(("Que[%d]: = %d\n",qIndex, pTxDataQ->aQueueCounters[qIndex].uDequeuePacket));
 
-	WLAN_OS_REPORT(("-------------- Requeue to queues -----------------\n"));
+    WLAN_OS_REPORT(("-------------- Requeue to queues -----------------\n"));
     for(qIndex = 0; qIndex < MAX_NUM_OF_AC; qIndex++)
         WLAN_OS_REPORT(("Que[%d]: = %d\n",qIndex, pTxDataQ->aQueueCounters[qIndex].uRequeuePacket));
 
-	WLAN_OS_REPORT(("-------------- Sent to TxCtrl --------------------\n"));
+    WLAN_OS_REPORT(("-------------- Sent to TxCtrl --------------------\n"));
     for(qIndex = 0; qIndex < MAX_NUM_OF_AC; qIndex++)
         WLAN_OS_REPORT(("Que[%d]: = %d\n",qIndex, pTxDataQ->aQueueCounters[qIndex].uXmittedPacket));
 
-	WLAN_OS_REPORT(("-------------- Dropped - Queue Full --------------\n"));
+    WLAN_OS_REPORT(("-------------- Dropped - Queue Full --------------\n"));
     for(qIndex = 0; qIndex < MAX_NUM_OF_AC; qIndex++)
         WLAN_OS_REPORT(("Que[%d]: = %d\n",qIndex, pTxDataQ->aQueueCounters[qIndex].uDroppedPacket));
 
-	WLAN_OS_REPORT(("--------------------------------------------------\n\n"));
+    WLAN_OS_REPORT(("--------------------------------------------------\n\n"));
 #endif
 }
 
@@ -661,6 +674,8 @@ void txDataQ_ResetQueueStatistics (TI_HANDLE hTxDataQ)
 
     os_memoryZero(pTxDataQ->hOs, &pTxDataQ->aQueueCounters, sizeof(pTxDataQ->aQueueCounters));
     pTxDataQ->uTxSendPaceTimeoutsCount = 0;
+    pTxDataQ->tClsfrLookup.uFlowCacheHits = 0;
+    pTxDataQ->tClsfrLookup.uFlowCacheMisses = 0;
 }
 
 
@@ -737,8 +752,12 @@ static void runSchedulerOnPriorityList(TTxDataQ   *pTxDataQ, TI_UINT32 uSchList,
 {
     TI_UINT32  uIdleIterationsCount = 0;  /* Count iterations without packet transmission (for exit criteria) */
     TI_UINT32  uQueId = pTxDataQ->uLastQueId[uSchList];  /* The last iteration queue */
-    EStatusXmit eStatus;  /* The return status of the txCtrl_xmitData function */
-    TTxCtrlBlk *pPktCtrlBlk; /* Pointer to the packet to be dequeued and sent */
+#ifdef TI_DBG
+    EStatusXmit eStatus;  /* The return status of the txCtrl_XmitDataBurst function */
+#endif
+    TTxCtrlBlk *aPktsCtrlBlk[DATA_QUEUE_MAX_BURST_SIZE]; /* The packets burst to be dequeued and sent */
+    TI_UINT32  uNumPkts;     /* Number of packets in the current burst */
+    TI_UINT32  uNumHandled;  /* Number of packets of the burst handled by the TxCtrl */
 
 
     while (1) {
@@ -769,13 +788,11 @@ static void runSchedulerOnPriorityList(TTxDataQ   *pTxDataQ, TI_UINT32 uSchList,
             uIdleIterationsCount--;
             continue;
         }
-        /* Dequeue a packet in a critical section */
-        context_EnterCriticalSection (pTxDataQ->hContext);
-        pPktCtrlBlk = (TTxCtrlBlk *) que_Dequeue (pTxDataQ->aQueues[uQueId]);
-        context_LeaveCriticalSection (pTxDataQ->hContext);
+        /* Get a burst of packets without dequeuing them (no lock needed, this is the only consumer) */
+        uNumPkts = ringQue_Peek (pTxDataQ->aQueues[uQueId], (TI_HANDLE *)aPktsCtrlBlk, pTxDataQ->uBurstSize);
 
         /* If the queue was empty, continue to the next queue */
-        if (pPktCtrlBlk == NULL) {
+        if (uNumPkts == 0) {
             if ((pTxDataQ->bStopNetStackTx) && pTxDataQ->aNetStackQueueStopped[uQueId]) {
                 pTxDataQ->aNetStackQueueStopped[uQueId] = TI_FALSE;
                 /*Resume the TX process as our date queues are empty*/
@@ -785,38 +802,25 @@ static void runSchedulerOnPriorityList(TTxDataQ   *pTxDataQ, TI_UINT32 uSchList,
             continue;
         }
 
+        /* Send the burst (one burst per queue in each round-robin turn). The status is only counted. */
 #ifdef TI_DBG
-        pTxDataQ->aQueueCounters[uQueId].uDequeuePacket++;
-#endif /* TI_DBG */
+        eStatus = txCtrl_XmitDataBurst (pTxDataQ->hTxCtrl, aPktsCtrlBlk, uNumPkts, &uNumHandled);
+#else
+        txCtrl_XmitDataBurst (pTxDataQ->hTxCtrl, aPktsCtrlBlk, uNumPkts, &uNumHandled);
+#endif
 
-        /* Send the packet */
-        eStatus = txCtrl_XmitData (pTxDataQ->hTxCtrl, pPktCtrlBlk);
-
-        /* 
-         * If the return status is busy it means that the packet was not sent
-         *   so we need to requeue it for future try.
-         */
-        if (eStatus == STATUS_XMIT_BUSY) {
-            TI_STATUS eQueStatus;
-
-            /* Requeue the packet in a critical section */
-            context_EnterCriticalSection (pTxDataQ->hContext);
-            eQueStatus = que_Requeue (pTxDataQ->aQueues[uQueId], (TI_HANDLE)pPktCtrlBlk);
-            if (eQueStatus != TI_OK) {
-                /* If the packet can't be queued drop it */
-                /* Note: may happen only if this thread was preempted between the   
-                   dequeue and requeue and new packets were inserted into this quque */
-                txCtrl_FreePacket (pTxDataQ->hTxCtrl, pPktCtrlBlk, TI_NOK);
-#ifdef TI_DBG
-                pTxDataQ->aQueueCounters[uQueId].uDroppedPacket++;
-#endif /* TI_DBG */
-            }
-            context_LeaveCriticalSection (pTxDataQ->hContext);
+        /* Dequeue only the handled packets, so the rest are kept first in queue for future try */
+        ringQue_Remove (pTxDataQ->aQueues[uQueId], uNumHandled);
 
 #ifdef TI_DBG
+        pTxDataQ->aQueueCounters[uQueId].uDequeuePacket += uNumHandled;
+        if (eStatus == STATUS_XMIT_BUSY) {
             pTxDataQ->aQueueCounters[uQueId].uRequeuePacket++;
+        }
 #endif /* TI_DBG */
 
+        /* If no packet was sent (busy), continue to next queue. */
+        if (uNumHandled == 0) {
             continue;
         }
 
@@ -824,7 +828,7 @@ static void runSchedulerOnPriorityList(TTxDataQ   *pTxDataQ, TI_UINT32 uSchList,
         uIdleIterationsCount = 0;
 
 #ifdef TI_DBG
-        pTxDataQ->aQueueCounters[uQueId].uXmittedPacket++;
+        pTxDataQ->aQueueCounters[uQueId].uXmittedPacket += uNumHandled;
 #endif /* TI_DBG */
 
     } /* End of while */
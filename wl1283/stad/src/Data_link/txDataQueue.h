@@ -56,6 +56,9 @@
 
 #define DATA_QUEUE_DEPTH_TOTAL  (DATA_QUEUE_DEPTH_BE + DATA_QUEUE_DEPTH_BK + DATA_QUEUE_DEPTH_VI + DATA_QUEUE_DEPTH_VO)
 
+/* Max number of packets sent from one queue in each scheduler turn (aggregated by the TxXfer) */
+#define DATA_QUEUE_MAX_BURST_SIZE   TWD_TX_AGGREG_PKTS_LIMIT_MAX
+
 /* Verify that there are enough TxCtrlBlks for all users that are queueing packets (driver + FW) */
 #if ((DATA_QUEUE_DEPTH_TOTAL + (MGMT_QUEUES_DEPTH * 2) + NUM_TX_DESCRIPTORS) > (CTRL_BLK_ENTRIES_NUM - 2))
     #error  Not enough TxCtrlBlks for all users !!
@@ -71,6 +74,40 @@ typedef struct
 	TI_UINT32 uDroppedPacket;
 } TTxDataQueueDebugCnt;
 
+/* Classifier lookup structures (derived from tClsfrParams.ClsfrTable, rebuilt on every table change) */
+#define CLSFR_HASH_SIZE             32      /* Port / IP&Port hash slots - power of 2, at least twice the table size */
+#define CLSFR_HASH_EMPTY            0xFF    /* Free hash slot */
+#define CLSFR_TOS_TABLE_SIZE        256     /* DSCP table is indexed by the whole IP TOS byte (DSCP + ECN bits) */
+#define CLSFR_DTAG_NONE             0xFF    /* No DSCP entry - the packet gets the default TID */
+#define CLSFR_FLOW_CACHE_SIZE       32      /* Flow cache entries - power of 2 */
+#define CLSFR_FLOW_IP_VER_IHL       0x45    /* Only IPv4 packets without IP options are cached (fixed header offsets) */
+#define CLSFR_FLOW_KEY_LEN          24      /* The IP header and the TCP/UDP ports */
+
+#if (CLSFR_HASH_SIZE < (2 * NUM_OF_CLSFR_TABLE_ENTRIES))
+    #error  Classifier hash is too small for the classifier table !!
+#endif
+
+/* Flow cache entry - the classification result of a recently transmitted IP flow */
+typedef struct
+{
+    TI_UINT32   uSrcIpAddr;     /* IP source address as read from the header */
+    TI_UINT32   uDstIpAddr;     /* IP destination address as read from the header */
+    TI_UINT32   uPorts;         /* Source and destination ports as read from the TCP/UDP header */
+    TI_UINT32   uGeneration;    /* The classifier table generation the entry was filled in (0 = invalid) */
+    TI_UINT8    uProtocol;      /* IP protocol */
+    TI_UINT8    uDTag;          /* The classification result */
+} TClsfrFlowEntry;
+
+typedef struct
+{
+    TI_UINT8        aHash[CLSFR_HASH_SIZE];             /* Open-addressing (linear probing) index into ClsfrTable */
+    TI_UINT8        aTosToDtag[CLSFR_TOS_TABLE_SIZE];   /* Direct-mapped IP TOS byte to D-Tag table */
+    TClsfrFlowEntry aFlowCache[CLSFR_FLOW_CACHE_SIZE];  /* Direct-mapped 5-tuple flow cache */
+    TI_UINT32       uGeneration;                        /* Incremented on any table change to invalidate the flow cache */
+    TI_UINT32       uFlowCacheHits;
+    TI_UINT32       uFlowCacheMisses;
+} TClsfrLookup;
+
 #define HIGH_PRIORITY_QUEUE_LIST    0
 #define LOW_PRIORITY_QUEUE_LIST     1
 #define MAX_QUEUE_LIST      2
@@ -86,6 +123,7 @@ typedef struct
 	TI_HANDLE            hTWD;
 			             
 	TClsfrParams		 tClsfrParams;  /* The classifier sub-module parameters */
+	TClsfrLookup		 tClsfrLookup;  /* The classifier lookup structures (hash, DSCP table and flow cache) */
 
 	TI_BOOL              bDataPortEnable; /* Data port open or not */
     TI_UINT32            uContextId;  /* ID allocated to this module on registration to context module */
@@ -101,6 +139,7 @@ typedef struct
 	TI_UINT32            uLastQueId[MAX_QUEUE_LIST]; /* the last queue processed by the scheduler */				
 	TI_BOOL				 aNetStackQueueStopped[MAX_NUM_OF_AC];/*indicate if the current queue was full and caused Tx network stack stop*/
 	TI_BOOL				 bStopNetStackTx;/*Flag to enable/disable Tx stop*/
+	TI_UINT32            uBurstSize; /* Max packets sent from one queue in each scheduler turn */
 
 	/* Counters */
 	TTxDataQueueDebugCnt aQueueCounters[MAX_NUM_OF_AC]; /* Save Tx statistics per Tx-queue. */
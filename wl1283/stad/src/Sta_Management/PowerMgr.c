@@ -73,6 +73,11 @@
 
 #define POWER_SAVE_GUARD_TIME_MS            5000       /* The gaurd time used to protect from FW stuck */
 
+/* Timers slack (Msec) - allowed expiry delay, so the expiry may share a wakeup with other timers */
+#define RETRY_PS_TIMER_SLACK_MS             10
+#define PS_POLL_FAILURE_TIMER_SLACK_MS      100
+#define ENTER_PS_GUARD_TIMER_SLACK_MS       500
+
 #define invokeCallback(fCb, hCb)		\
 	do {								\
 		if (fCb) {						\
@@ -391,6 +396,10 @@ TI_STATUS PowerMgr_SetDefaults (TI_HANDLE hPowerMgr, PowerMgrInitParams_t* pPowe
 		return TI_NOK;
     }
 
+    tmr_SetTimerSlack (pPowerMgr->hRetryPsTimer, RETRY_PS_TIMER_SLACK_MS);
+    tmr_SetTimerSlack (pPowerMgr->hPsPollFailureTimer, PS_POLL_FAILURE_TIMER_SLACK_MS);
+    tmr_SetTimerSlack (pPowerMgr->hEnterPsGuardTimer, ENTER_PS_GUARD_TIMER_SLACK_MS);
+
 
 	/* Register and Enable the PS report event */
     TWD_RegisterEvent (pPowerMgr->hTWD,
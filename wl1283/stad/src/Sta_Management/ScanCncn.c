@@ -284,6 +284,7 @@ TI_STATUS scanCncn_SetDefaults (TI_HANDLE hScanCncn, TScanCncnInitParams *pScanC
                                                              "ABROTING init!\n", uIndex);
     		return TI_NOK;
         }
+        tmr_SetTimerSlack (pScanCncn->pScanClients[uIndex]->hScanClientGuardTimer, SCAN_GUARD_SLACK_MS);
     }
 
     /* register SCR callbacks */
@@ -703,6 +704,9 @@ void scanCncn_ScanCompleteNotification (TI_HANDLE hScanCncn, EScanResultTag eTag
         return;
     }
 
+    /* the next scan should report again all the BSSs, including unchanged ones */
+    mlmeParser_ResetFrameCache (pScanCncn->hMlme);
+
     /* update scan result if scan SRV reported error (and no error occured so far) */
     if ((TI_OK != scanStatus) && (SCAN_CRS_SCAN_COMPLETE_OK == pScanCncn->pScanClients[ eClient ]->eScanResult))
     {
@@ -45,7 +45,7 @@
 #include "scrApi.h"
 #include "mlmeApi.h"
 
-#define SCAN_CNCN_APP_SCAN_TABLE_ENTRIES 64
+#define SCAN_CNCN_APP_SCAN_TABLE_ENTRIES 256 /* Sites are looked up by a BSSID hash, so the table size only costs memory */
 
 /** \enum EScanCncnClient
  * \brief	Scan Concentrator Client
@@ -47,6 +47,7 @@
 
 
 #define SCAN_GUARD_TIME_MS	62000
+#define SCAN_GUARD_SLACK_MS	1000    /* allowed guard timer expiry delay, to share wakeups */
 
 
 /** \enum EConnectionStatus
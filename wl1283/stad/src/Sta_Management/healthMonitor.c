@@ -59,6 +59,7 @@
 #include "DrvMain.h"
 #include "DrvMainModules.h"
 #include "TWDriverInternal.h"
+#include "context.h"
 
 
 typedef struct
@@ -479,7 +480,26 @@ RETURN:     TI_OK on success, TI_NOK otherwise
 ************************************************************************/
 TI_STATUS healthMonitor_GetParam (TI_HANDLE hHealthMonitor, paramInfo_t *pParam)
 { 
-	return TI_OK;
+    THealthMonitor *pHealthMonitor = (THealthMonitor*)hHealthMonitor;
+	TI_STATUS eStatus = TI_OK;
+
+	switch(pParam->paramType)
+	{
+
+	case HEALTH_MONITOR_RECOVERY_STATS:
+        drvMain_GetRecoveryStats (pHealthMonitor->hDrvMain, &pParam->content.tRecoveryStats);
+		break;
+
+	case HEALTH_MONITOR_CONTEXT_STATS:
+        eStatus = context_GetClientStats (pHealthMonitor->hContext, &pParam->content.tContextClientStats);
+		break;
+
+	default:
+        TRACE1(pHealthMonitor->hReport, REPORT_SEVERITY_ERROR, "healthMonitor_GetParam(): Params is not supported, %d\n", pParam->paramType);
+        eStatus = PARAM_NOT_SUPPORTED;
+	}
+
+	return eStatus;
 }
 
 
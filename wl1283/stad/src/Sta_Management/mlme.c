@@ -192,6 +192,8 @@ void mlme_SetDefaults (TI_HANDLE hMlme, TMlmeInitParams *pMlmeInitParams)
 
 	/* set default values */
     pMlme->bParseBeaconWSC = pMlmeInitParams->parseWSCInBeacons;
+    pMlme->bLightweightParse = pMlmeInitParams->lightweightParse;
+    pMlme->uFrameCacheGeneration = 1;
 	pMlme->authInfo.timeout = pMlmeInitParams->authResponseTimeout;
 	pMlme->authInfo.maxCount = pMlmeInitParams->authMaxRetryCount;
 	pMlme->assocInfo.timeout = pMlmeInitParams->assocResponseTimeout;
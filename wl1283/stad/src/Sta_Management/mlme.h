@@ -63,7 +63,23 @@
 #define MAX_EXTRA_IES_LEN       (MAX_RSN_IE_LEN + MD_IE_LEN + FT_IE_LEN + RIC_REQUEST_LEN)
 #define MAX_ASSOC_MSG_LENGTH	(512 + MAX_EXTRA_IES_LEN)
 
+#define MLME_FRAME_CACHE_SIZE   32      /* Must be a power of 2 */
+#define MLME_FRAME_CACHE_TTL_MS 300     /* A cached frame is parsed again after this time */
+
 /* Data structures */
+
+/* The last parsed scan result (beacon or probe response) of a BSSID */
+typedef struct
+{
+    TMacAddr            tBssid;
+    TI_UINT8            uSubType;
+    TI_UINT8            uChannel;
+    TI_UINT8            uScanTag;
+    TI_UINT32           uChecksum;
+    TI_UINT32           uTimeStamp;
+    TI_UINT32           uGeneration;    /* Valid only if equal to the cache generation */
+} TMlmeFrameCacheEntry;
+
 typedef struct
 {
 	TI_UINT16			status;
@@ -132,6 +148,14 @@ typedef struct
     /* temporary frame info */
     mlmeIEParsingParams_t tempFrameInfo;
 
+    /* scan results IEs index and unchanged frames cache */
+    TMlmeIeIndex        tIeIndex;
+    TI_BOOL             bLightweightParse;
+    TI_UINT32           uFrameCacheGeneration;
+    TMlmeFrameCacheEntry aFrameCache[MLME_FRAME_CACHE_SIZE];
+    TI_UINT32           uFrameCacheHits;
+    TI_UINT32           uFrameCacheMisses;
+
     TI_UINT8            assocMsg[MAX_ASSOC_MSG_LENGTH];
 
     /* debug info - start */
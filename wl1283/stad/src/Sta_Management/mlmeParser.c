@@ -88,6 +88,18 @@
 
 #define CHECK_PARSING_ERROR_CONDITION_PRINT 0
 
+#define MLME_IE_SLOTS_RSN_VENDOR    (MLME_IE_SLOT_BIT(MLME_IE_SLOT_RSN) | MLME_IE_SLOT_BIT(MLME_IE_SLOT_VENDOR))
+#define MLME_FRAME_CACHE_HASH(bssid) (((bssid)[3] ^ (bssid)[4] ^ (bssid)[5]) & (MLME_FRAME_CACHE_SIZE - 1))
+
+/* The parsing state carried between the IEs of one frame */
+typedef struct
+{
+    TI_UINT8            uRsnIeIdx;      /* The next RSN IE index */
+} TMlmeParseState;
+
+static TI_STATUS mlmeParser_parseScanResultIEs(mlme_t *pHandle, TI_UINT8 *pData, TI_INT32 bodyDataLen,
+                                               TRxAttr *pRxAttr, TI_BOOL *pbUnchanged);
+
 extern int WMEQosTagToACTable[MAX_NUM_OF_802_1d_TAGS];
 
 TI_STATUS mlmeParser_recv(TI_HANDLE hMlme, void *pBuffer, TRxAttr* pRxAttr)
@@ -106,6 +118,8 @@ TI_STATUS mlmeParser_recv(TI_HANDLE hMlme, void *pBuffer, TRxAttr* pRxAttr)
     TI_UINT8               rsnIeIdx = 0;
     TI_UINT8               wpaIeOuiIe[] = WPA_IE_OUI;
     TI_BOOL				   cIEPresent = TI_FALSE;
+    TI_BOOL                bScanResult;
+    TI_BOOL                bUnchanged = TI_FALSE;
 
     if ((hMlme == NULL) || (pBuffer == NULL))
     {
@@ -480,7 +494,17 @@ TRACE1(pHandle->hReport, REPORT_SEVERITY_SM, "MLME_PARSER: recieved ASSOC_RESPON
             goto mlme_recv_end;
         }
 
-        if (mlmeParser_parseIEs(hMlme, pData, bodyDataLen, &(pHandle->tempFrameInfo)) != TI_OK)
+        bScanResult = (pRxAttr->eScanTag > SCAN_RESULT_TAG_CURENT_BSS) && (pRxAttr->eScanTag != SCAN_RESULT_TAG_MEASUREMENT);
+        if (bScanResult)
+        {
+            status = mlmeParser_parseScanResultIEs(pHandle, pData, bodyDataLen, pRxAttr, &bUnchanged);
+        }
+        else
+        {
+            status = mlmeParser_parseIEs(hMlme, pData, bodyDataLen, &(pHandle->tempFrameInfo));
+        }
+
+        if (status != TI_OK)
         {
             TRACE0(pHandle->hReport, REPORT_SEVERITY_ERROR, "mlmeParser_recv: Error in parsing Probe response packet\n");
 
@@ -494,6 +518,14 @@ TRACE1(pHandle->hReport, REPORT_SEVERITY_SM, "MLME_PARSER: recieved ASSOC_RESPON
             goto mlme_recv_end;
         }
 
+        /* Unchanged since the last result of this BSS - only update the scan result counter */
+        if (bUnchanged)
+        {
+            scanCncn_MlmeResultCB( pHandle->hScanCncn, NULL, NULL, pRxAttr, NULL, 0);
+            switchChannel_recvCmd(pHandle->hSwitchChannel, NULL, pRxAttr->channel);
+            break;
+        }
+
         /* updating CountryIE  */
         if ((pHandle->tempFrameInfo.frame.content.iePacket.country != NULL) && 
             (pHandle->tempFrameInfo.frame.content.iePacket.country->hdr[1] != 0))
@@ -627,7 +659,17 @@ TRACE1(pHandle->hReport, REPORT_SEVERITY_SM, "MLME_PARSER: recieved ASSOC_RESPON
 		pHandle->tempFrameInfo.band = pRxAttr->band;
 		pHandle->tempFrameInfo.rxChannel = pRxAttr->channel;
 
-        if (mlmeParser_parseIEs(hMlme, pData, bodyDataLen, &(pHandle->tempFrameInfo)) != TI_OK)
+        bScanResult = (pRxAttr->eScanTag > SCAN_RESULT_TAG_CURENT_BSS) && (pRxAttr->eScanTag != SCAN_RESULT_TAG_MEASUREMENT);
+        if (bScanResult)
+        {
+            status = mlmeParser_parseScanResultIEs(pHandle, pData, bodyDataLen, pRxAttr, &bUnchanged);
+        }
+        else
+        {
+            status = mlmeParser_parseIEs(hMlme, pData, bodyDataLen, &(pHandle->tempFrameInfo));
+        }
+
+        if (status != TI_OK)
         {
             TRACE0(pHandle->hReport, REPORT_SEVERITY_WARNING, "mlmeParser_parseIEs - Error in parsing Beacon \n");
             /* Error in parsing Probe response packet - exit */
@@ -640,6 +682,15 @@ TRACE1(pHandle->hReport, REPORT_SEVERITY_SM, "MLME_PARSER: recieved ASSOC_RESPON
             goto mlme_recv_end;
         }
 
+        /* Unchanged since the last result of this BSS - only update the scan result counter */
+        if (bUnchanged)
+        {
+            scanCncn_MlmeResultCB( pHandle->hScanCncn, NULL, NULL, pRxAttr, NULL, 0);
+            pHandle->BeaconsCounterPS++;
+            switchChannel_recvCmd(pHandle->hSwitchChannel, NULL, pRxAttr->channel);
+            break;
+        }
+
         /* updating CountryIE  */
         if ((pHandle->tempFrameInfo.frame.content.iePacket.country != NULL) && 
             (pHandle->tempFrameInfo.frame.content.iePacket.country->hdr[1] != 0))
@@ -1525,39 +1576,37 @@ TI_STATUS mlmeParser_readTPCReport(mlme_t *pMlme,TI_UINT8 *pData, TI_UINT32 data
          if ((x)) return TI_NOK;
 #endif
 
-TI_STATUS mlmeParser_parseIEs(TI_HANDLE hMlme, 
-							  TI_UINT8 *pData,
-							  TI_INT32 bodyDataLen,
-							  mlmeIEParsingParams_t *params)
+/**
+ * \fn     mlmeParser_parseIE
+ * \brief  Parse one IE to the frame parsing structure
+ *
+ * \note   The RSN IEs are stored in their order, according to the parsing state.
+ * \param  pHandle - the MLME object
+ * \param  pData - the IE start
+ * \param  bodyDataLen - the IEs length from the IE start
+ * \param  params - the parsing structure
+ * \param  pState - in/out: the frame parsing state
+ * \param  pReadLen - out: the length to skip to the next IE
+ * \return TI_OK if the IE is valid (or ignored), TI_NOK if the frame should be dropped
+ * \sa     mlmeParser_parseIEs, mlmeParser_DecodeIndexedIEs
+ */
+static TI_STATUS mlmeParser_parseIE(mlme_t *pHandle,
+                                    TI_UINT8 *pData,
+                                    TI_INT32 bodyDataLen,
+                                    mlmeIEParsingParams_t *params,
+                                    TMlmeParseState *pState,
+                                    TI_UINT32 *pReadLen)
 {
-    dot11_eleHdr_t 		*pEleHdr;
-    TI_UINT32 			 readLen;
+    dot11_eleHdr_t 		*pEleHdr = (dot11_eleHdr_t *)pData;
+    TI_UINT32 			 readLen = 0;
 	TI_STATUS			 status = TI_NOK;
-    TI_UINT8 			 rsnIeIdx = 0;
     TI_UINT8 			 wpaIeOuiIe[4] = { 0x00, 0x50, 0xf2, 0x01};
 	beacon_probeRsp_t 	*frame = &(params->frame.content.iePacket);
-	mlme_t 				*pHandle = (mlme_t *)hMlme;
 #if CHECK_PARSING_ERROR_CONDITION_PRINT
 	TI_INT32				packetLength = bodyDataLen;
 	TI_UINT8				*pPacketBody = pData;
 #endif
 
-	params->recvChannelSwitchAnnoncIE = TI_FALSE;
-
-	while (bodyDataLen > 1)
-	{
-		pEleHdr = (dot11_eleHdr_t *)pData;
-	
-#if CHECK_PARSING_ERROR_CONDITION_PRINT
-		/* CHECK_PARSING_ERROR_CONDITION(((*pEleHdr)[1] > (bodyDataLen - 2)), ("MLME_PARSER: IE %d with length %d out of bounds %d\n", (*pEleHdr)[0], (*pEleHdr)[1], (bodyDataLen - 2)), TI_TRUE); */
-		if ((*pEleHdr)[1] > (bodyDataLen - 2))
-		{
-			TRACE3(pHandle->hReport, REPORT_SEVERITY_ERROR, "MLME_PARSER: IE %d with length %d out of bounds %d\n", (*pEleHdr)[0], (*pEleHdr)[1], (bodyDataLen - 2));
-		
-			TRACE1(pHandle->hReport, REPORT_SEVERITY_ERROR, "Buff len = %d \n", packetLength);
-			report_PrintDump (pPacketBody, packetLength); 
-		}
-#endif
         switch ((*pEleHdr)[0])
 		{
 		/* read SSID */
@@ -1682,20 +1731,20 @@ TI_STATUS mlmeParser_parseIEs(TI_HANDLE hMlme,
 
 		case kkk_EXT_1_IE_ID:
 			frame->pRsnIe   = &params->rsnIe[0];
-			status = mlmeParser_readRsnIe(pHandle, pData, bodyDataLen, &readLen, &params->rsnIe[rsnIeIdx]);
+			status = mlmeParser_readRsnIe(pHandle, pData, bodyDataLen, &readLen, &params->rsnIe[pState->uRsnIeIdx]);
 			CHECK_PARSING_ERROR_CONDITION((status != TI_OK), ("MLME_PARSER: error reading RSN IE\n"),TI_TRUE);
 
 			frame->rsnIeLen += readLen;
-			rsnIeIdx ++;
+			pState->uRsnIeIdx ++;
 			break;
 
 		case RSN_IE_ID:
 			frame->pRsnIe = &params->rsnIe[0];
-			status = mlmeParser_readRsnIe(pHandle, pData, bodyDataLen, &readLen, &params->rsnIe[rsnIeIdx]);
+			status = mlmeParser_readRsnIe(pHandle, pData, bodyDataLen, &readLen, &params->rsnIe[pState->uRsnIeIdx]);
 			CHECK_PARSING_ERROR_CONDITION((status != TI_OK), ("MLME_PARSER: error reading RSN IE\n"),TI_TRUE);
 
 			frame->rsnIeLen += readLen;
-			rsnIeIdx ++;
+			pState->uRsnIeIdx ++;
 			break;
 
 		case QOS_CAPABILITY_IE_ID:
@@ -1739,9 +1788,9 @@ TI_STATUS mlmeParser_parseIEs(TI_HANDLE hMlme,
 					/* If we are here - the following is WPA IE */
 					frame->pRsnIe = &params->rsnIe[0];
 					status = mlmeParser_readRsnIe(pHandle, pData, bodyDataLen,
-												  &readLen, &params->rsnIe[rsnIeIdx]);
+												  &readLen, &params->rsnIe[pState->uRsnIeIdx]);
 					frame->rsnIeLen += readLen;
-					rsnIeIdx ++;
+					pState->uRsnIeIdx ++;
 
 					CHECK_PARSING_ERROR_CONDITION((status != TI_OK), ("MLME_PARSER: error reading RSN IE\n"),TI_TRUE);
 				}
@@ -1800,6 +1849,47 @@ TI_STATUS mlmeParser_parseIEs(TI_HANDLE hMlme,
 			break;
 		}   // switch
 
+    *pReadLen = readLen;
+
+	return TI_OK;
+}
+
+TI_STATUS mlmeParser_parseIEs(TI_HANDLE hMlme, 
+							  TI_UINT8 *pData,
+							  TI_INT32 bodyDataLen,
+							  mlmeIEParsingParams_t *params)
+{
+    TI_UINT32 			 readLen;
+    TMlmeParseState 	 tState;
+	mlme_t 				*pHandle = (mlme_t *)hMlme;
+#if CHECK_PARSING_ERROR_CONDITION_PRINT
+    dot11_eleHdr_t 		*pEleHdr;
+	TI_INT32				packetLength = bodyDataLen;
+	TI_UINT8				*pPacketBody = pData;
+#endif
+
+	params->recvChannelSwitchAnnoncIE = TI_FALSE;
+    tState.uRsnIeIdx = 0;
+
+	while (bodyDataLen > 1)
+	{
+#if CHECK_PARSING_ERROR_CONDITION_PRINT
+		pEleHdr = (dot11_eleHdr_t *)pData;
+	
+		/* CHECK_PARSING_ERROR_CONDITION(((*pEleHdr)[1] > (bodyDataLen - 2)), ("MLME_PARSER: IE %d with length %d out of bounds %d\n", (*pEleHdr)[0], (*pEleHdr)[1], (bodyDataLen - 2)), TI_TRUE); */
+		if ((*pEleHdr)[1] > (bodyDataLen - 2))
+		{
+			TRACE3(pHandle->hReport, REPORT_SEVERITY_ERROR, "MLME_PARSER: IE %d with length %d out of bounds %d\n", (*pEleHdr)[0], (*pEleHdr)[1], (bodyDataLen - 2));
+		
+			TRACE1(pHandle->hReport, REPORT_SEVERITY_ERROR, "Buff len = %d \n", packetLength);
+			report_PrintDump (pPacketBody, packetLength); 
+		}
+#endif
+        if (mlmeParser_parseIE(pHandle, pData, bodyDataLen, params, &tState, &readLen) != TI_OK)
+        {
+            return TI_NOK;
+        }
+
 		pData += readLen;
 		bodyDataLen -= readLen;
 
@@ -1819,6 +1909,302 @@ TI_STATUS mlmeParser_parseIEs(TI_HANDLE hMlme,
 	return TI_OK;
 }
 
+/**
+ * \fn     mlmeParser_ieSlot
+ * \brief  Get the index slot of an IE
+ *
+ * \note   The slots group the IEs the same way mlmeParser_parseIE handles them.
+ * \param  uIeId - the IE ID
+ * \return The IE slot (EMlmeIeSlot)
+ * \sa     mlmeParser_IndexIEs
+ */
+static TI_UINT8 mlmeParser_ieSlot(TI_UINT8 uIeId)
+{
+    switch (uIeId)
+    {
+    case SSID_IE_ID:                        return MLME_IE_SLOT_SSID;
+    case SUPPORTED_RATES_IE_ID:             return MLME_IE_SLOT_RATES;
+    case EXT_SUPPORTED_RATES_IE_ID:         return MLME_IE_SLOT_EXT_RATES;
+    case ERP_IE_ID:                         return MLME_IE_SLOT_ERP;
+    case FH_PARAMETER_SET_IE_ID:            return MLME_IE_SLOT_FH_PARAMS;
+    case DS_PARAMETER_SET_IE_ID:            return MLME_IE_SLOT_DS_PARAMS;
+    case CF_PARAMETER_SET_IE_ID:            return MLME_IE_SLOT_CF_PARAMS;
+    case IBSS_PARAMETER_SET_IE_ID:          return MLME_IE_SLOT_IBSS_PARAMS;
+    case TIM_IE_ID:                         return MLME_IE_SLOT_TIM;
+    case COUNTRY_IE_ID:                     return MLME_IE_SLOT_COUNTRY;
+    case POWER_CONSTRAINT_IE_ID:            return MLME_IE_SLOT_POWER_CONSTRAINT;
+    case CHANNEL_SWITCH_ANNOUNCEMENT_IE_ID: return MLME_IE_SLOT_CHANNEL_SWITCH;
+    case QUIET_IE_ID:                       return MLME_IE_SLOT_QUIET;
+    case TPC_REPORT_IE_ID:                  return MLME_IE_SLOT_TPC_REPORT;
+    case kkk_EXT_1_IE_ID:
+    case RSN_IE_ID:                         return MLME_IE_SLOT_RSN;
+    case QOS_CAPABILITY_IE_ID:              return MLME_IE_SLOT_QOS_CAPABILITY;
+    case HT_CAPABILITIES_IE_ID:             return MLME_IE_SLOT_HT_CAPABILITIES;
+    case HT_INFORMATION_IE_ID:              return MLME_IE_SLOT_HT_INFORMATION;
+    case RRM_ENABLED_CAPABILITIES_IE_ID:    return MLME_IE_SLOT_RRM_CAPABILITIES;
+    case WPA_IE_ID:                         return MLME_IE_SLOT_VENDOR;
+    default:                                return MLME_IE_SLOT_UNKNOWN;
+    }
+}
+
+/**
+ * \fn     mlmeParser_checksum
+ * \brief  Accumulate a checksum of a buffer
+ *
+ * \note   Used only to detect frames changes, so a rotate-xor of 32 bit words is enough.
+ *         Two words are accumulated in parallel, to halve the dependency chain.
+ * \param  uSum - the checksum so far
+ * \param  pData - the buffer (any alignment)
+ * \param  uLen - the buffer length
+ * \return The updated checksum
+ * \sa     mlmeParser_IndexIEs
+ */
+#define MLME_CHECKSUM_WORD(p)   ((TI_UINT32)(p)[0] | ((TI_UINT32)(p)[1] << 8) | ((TI_UINT32)(p)[2] << 16) | ((TI_UINT32)(p)[3] << 24))
+#define MLME_CHECKSUM_ROT(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+static TI_UINT32 mlmeParser_checksum(TI_UINT32 uSum, TI_UINT8 *pData, TI_UINT32 uLen)
+{
+    TI_UINT32 uSum2 = 0;
+
+    for (; uLen >= 8; uLen -= 8, pData += 8)
+    {
+        uSum  = MLME_CHECKSUM_ROT(uSum, 7)  ^ MLME_CHECKSUM_WORD(pData);
+        uSum2 = MLME_CHECKSUM_ROT(uSum2, 7) ^ MLME_CHECKSUM_WORD(pData + 4);
+    }
+    for (; uLen > 0; uLen--, pData++)
+    {
+        uSum = MLME_CHECKSUM_ROT(uSum, 7) ^ *pData;
+    }
+
+    return uSum ^ MLME_CHECKSUM_ROT(uSum2, 16);
+}
+
+/**
+ * \fn     mlmeParser_IndexIEs
+ * \brief  Index the IEs of a frame in one pass
+ *
+ * Records only the offset and slot of each IE (no IE is decoded), and computes a checksum of the
+ *     fixed fields and the IEs, excluding the TIM (which changes in each beacon).
+ * The IEs are then decoded by mlmeParser_DecodeIndexedIEs, only for the slots actually needed.
+ *
+ * \note   Fails on an IE exceeding the frame or too many IEs, so the caller can fall back to
+ *         mlmeParser_parseIEs (which handles such frames as before).
+ * \param  hMlme - the MLME object
+ * \param  pData - the IEs start
+ * \param  bodyDataLen - the IEs length
+ * \param  uFixedFields - the frame fixed fields (besides the timestamp) to include in the checksum
+ * \param  pIndex - out: the IEs index
+ * \return TI_OK if indexed, TI_NOK otherwise
+ * \sa     mlmeParser_DecodeIndexedIEs
+ */
+TI_STATUS mlmeParser_IndexIEs(TI_HANDLE hMlme, 
+                              TI_UINT8 *pData,
+                              TI_INT32 bodyDataLen,
+                              TI_UINT32 uFixedFields,
+                              TMlmeIeIndex *pIndex)
+{
+    TI_INT32  iOffset = 0;
+    TI_INT32  iTimOffset = bodyDataLen;
+    TI_UINT32 uTimLen = 0;
+    TI_UINT32 uIeLen;
+    TI_UINT8  uSlot;
+
+    pIndex->pIEs = pData;
+    pIndex->iIEsLen = bodyDataLen;
+    pIndex->uSlotsMap = 0;
+    pIndex->uDecodedMap = 0;
+    pIndex->uNumIEs = 0;
+
+    while (bodyDataLen - iOffset > 1)
+    {
+        uIeLen = pData[iOffset + 1] + 2;
+        if ((uIeLen > (TI_UINT32)(bodyDataLen - iOffset)) || (pIndex->uNumIEs == MLME_IE_INDEX_MAX_IES))
+        {
+            return TI_NOK;
+        }
+
+        uSlot = mlmeParser_ieSlot(pData[iOffset]);
+        pIndex->aIEs[pIndex->uNumIEs].uOffset = (TI_UINT16)iOffset;
+        pIndex->aIEs[pIndex->uNumIEs].uSlot = uSlot;
+        pIndex->uNumIEs++;
+        pIndex->uSlotsMap |= MLME_IE_SLOT_BIT(uSlot);
+
+        if ((uSlot == MLME_IE_SLOT_TIM) && (uTimLen == 0))
+        {
+            iTimOffset = iOffset;
+            uTimLen = uIeLen;
+        }
+
+        iOffset += uIeLen;
+    }
+
+    /* Checksum the IEs before and after the TIM */
+    pIndex->uChecksum = mlmeParser_checksum(uFixedFields ^ (TI_UINT32)bodyDataLen, pData, (TI_UINT32)iTimOffset);
+    if (uTimLen != 0)
+    {
+        pIndex->uChecksum = mlmeParser_checksum(pIndex->uChecksum, 
+                                                pData + iTimOffset + uTimLen, 
+                                                (TI_UINT32)(bodyDataLen - iTimOffset) - uTimLen);
+    }
+
+    return TI_OK;
+}
+
+/**
+ * \fn     mlmeParser_DecodeIndexedIEs
+ * \brief  Decode the indexed IEs of the required slots
+ *
+ * The IEs are decoded in the frame order, as in mlmeParser_parseIEs, so decoding all slots
+ *     gives the same result. Slots already decoded are not decoded again.
+ *
+ * \note   The index points to the frame, so it may be used only while the frame is handled.
+ * \param  hMlme - the MLME object
+ * \param  pIndex - the IEs index
+ * \param  uSlotsMask - the slots to decode (bitmap of EMlmeIeSlot)
+ * \param  params - the parsing structure
+ * \return TI_OK if all the decoded IEs are valid, TI_NOK otherwise
+ * \sa     mlmeParser_IndexIEs
+ */
+TI_STATUS mlmeParser_DecodeIndexedIEs(TI_HANDLE hMlme, 
+                                      TMlmeIeIndex *pIndex,
+                                      TI_UINT32 uSlotsMask,
+                                      mlmeIEParsingParams_t *params)
+{
+    mlme_t    *pHandle = (mlme_t *)hMlme;
+    TI_UINT32 readLen;
+    TI_UINT32 uOffset;
+    TI_UINT32 i;
+    TMlmeParseState tState;
+
+    /* The RSN and WPA IEs share the RSN IEs array, so they are always decoded together */
+    if (uSlotsMask & MLME_IE_SLOTS_RSN_VENDOR)
+    {
+        uSlotsMask |= MLME_IE_SLOTS_RSN_VENDOR;
+    }
+
+    uSlotsMask &= pIndex->uSlotsMap & ~pIndex->uDecodedMap;
+    if (uSlotsMask == 0)
+    {
+        return TI_OK;
+    }
+
+    if (pIndex->uDecodedMap == 0)
+    {
+        params->recvChannelSwitchAnnoncIE = TI_FALSE;
+    }
+    tState.uRsnIeIdx = 0;
+
+    for (i = 0; i < pIndex->uNumIEs; i++)
+    {
+        if (uSlotsMask & MLME_IE_SLOT_BIT(pIndex->aIEs[i].uSlot))
+        {
+            uOffset = pIndex->aIEs[i].uOffset;
+            if (mlmeParser_parseIE(pHandle, pIndex->pIEs + uOffset, pIndex->iIEsLen - uOffset, params, &tState, &readLen) != TI_OK)
+            {
+                return TI_NOK;
+            }
+        }
+    }
+
+    pIndex->uDecodedMap |= uSlotsMask;
+
+    return TI_OK;
+}
+
+/**
+ * \fn     mlmeParser_parseScanResultIEs
+ * \brief  Parse the IEs of a scan result (beacon or probe response)
+ *
+ * In the lightweight mode the IEs are indexed in one pass, and only the IEs used by the scan
+ *     result consumers are decoded (the rest may be decoded on demand from the index).
+ * A frame identical (by checksum) to the last one received from the same BSSID in the current
+ *     scan, within MLME_FRAME_CACHE_TTL_MS, is not decoded at all.
+ *
+ * \note   Frames from the current BSSID are always parsed, to handle channel switch IEs.
+ * \param  pHandle - the MLME object
+ * \param  pData - the IEs start
+ * \param  bodyDataLen - the IEs length
+ * \param  pRxAttr - the frame Rx attributes
+ * \param  pbUnchanged - out: TI_TRUE if the frame was not parsed since it's unchanged
+ * \return TI_OK if parsed (or unchanged), TI_NOK if the frame is invalid
+ * \sa     mlmeParser_recv, mlmeParser_ResetFrameCache
+ */
+static TI_STATUS mlmeParser_parseScanResultIEs(mlme_t *pHandle, TI_UINT8 *pData, TI_INT32 bodyDataLen,
+                                               TRxAttr *pRxAttr, TI_BOOL *pbUnchanged)
+{
+    mlmeIEParsingParams_t *params = &(pHandle->tempFrameInfo);
+    beacon_probeRsp_t     *frame = &(params->frame.content.iePacket);
+    TMlmeFrameCacheEntry  *pEntry;
+    TI_UINT32              uNow;
+
+    *pbUnchanged = TI_FALSE;
+
+    if ((!pHandle->bLightweightParse) || 
+        (mlmeParser_IndexIEs(pHandle, pData, bodyDataLen, 
+                             ((TI_UINT32)frame->beaconInerval << 16) | frame->capabilities, 
+                             &(pHandle->tIeIndex)) != TI_OK))
+    {
+        return mlmeParser_parseIEs(pHandle, pData, bodyDataLen, params);
+    }
+
+    pEntry = &(pHandle->aFrameCache[MLME_FRAME_CACHE_HASH(params->bssid)]);
+    uNow = os_timeStampMs(pHandle->hOs);
+
+    if ((!params->myBssid) &&
+        (pEntry->uGeneration == pHandle->uFrameCacheGeneration) &&
+        (pEntry->uChecksum == pHandle->tIeIndex.uChecksum) &&
+        (pEntry->uSubType == (TI_UINT8)params->frame.subType) &&
+        (pEntry->uChannel == pRxAttr->channel) &&
+        (pEntry->uScanTag == (TI_UINT8)pRxAttr->eScanTag) &&
+        (uNow - pEntry->uTimeStamp < MLME_FRAME_CACHE_TTL_MS) &&
+        MAC_EQUAL(pEntry->tBssid, params->bssid))
+    {
+        pHandle->uFrameCacheHits++;
+        *pbUnchanged = TI_TRUE;
+        return TI_OK;
+    }
+
+    pHandle->uFrameCacheMisses++;
+
+    if (mlmeParser_DecodeIndexedIEs(pHandle, &(pHandle->tIeIndex), MLME_IE_SLOTS_SCAN, params) != TI_OK)
+    {
+        return TI_NOK;
+    }
+
+    if (!params->myBssid)
+    {
+        MAC_COPY(pEntry->tBssid, params->bssid);
+        pEntry->uSubType    = (TI_UINT8)params->frame.subType;
+        pEntry->uChannel    = pRxAttr->channel;
+        pEntry->uScanTag    = (TI_UINT8)pRxAttr->eScanTag;
+        pEntry->uChecksum   = pHandle->tIeIndex.uChecksum;
+        pEntry->uTimeStamp  = uNow;
+        pEntry->uGeneration = pHandle->uFrameCacheGeneration;
+    }
+
+    return TI_OK;
+}
+
+/**
+ * \fn     mlmeParser_ResetFrameCache
+ * \brief  Invalidate the unchanged frames cache
+ *
+ * Called when a scan is completed, so each scan reports all the BSSs it found.
+ *
+ * \note
+ * \param  hMlme - the MLME object
+ * \return void
+ * \sa     mlmeParser_parseScanResultIEs
+ */
+void mlmeParser_ResetFrameCache(TI_HANDLE hMlme)
+{
+    mlme_t *pHandle = (mlme_t *)hMlme;
+
+    pHandle->uFrameCacheGeneration++;
+
+    TRACE2(pHandle->hReport, REPORT_SEVERITY_INFORMATION, "mlmeParser_ResetFrameCache: hits=%d, misses=%d\n", pHandle->uFrameCacheHits, pHandle->uFrameCacheMisses);
+}
+
 mlmeIEParsingParams_t *mlmeParser_getParseIEsBuffer(TI_HANDLE *hMlme)
 {
 	return (&(((mlme_t *)hMlme)->tempFrameInfo));
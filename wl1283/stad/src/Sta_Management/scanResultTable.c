@@ -47,6 +47,7 @@
 #include "StaCap.h"
 
 //#define TABLE_ENTRIES_NUMBER    32
+#define SCAN_RESULT_HASH_NONE   0xFFFF  /* Empty hash bucket / end of bucket chain */
 #define DELTA_RSSI 10  /*use in scanResultTable_CheckRxSignalValidity */
 #define MILISECONDS(seconds)                            (seconds * 1000)
 #define UPDATE_LOCAL_TIMESTAMP(pSite, hOs)              pSite->localTimeStamp = os_timeStampMs(hOs);
@@ -132,6 +133,9 @@ typedef struct
     TSiteEntry      *pTable;                /**< site table */
     TI_UINT32       uCurrentSiteNumber;     /**< number of sites currently in the table */
     TI_UINT32       uEntriesNumber;         /**< max size of the table */
+    TI_UINT16       *pHashBuckets;          /**< BSSID hash: index of the first site in each bucket */
+    TI_UINT16       *pHashNext;             /**< BSSID hash: index of the next site in the same bucket (per site) */
+    TI_UINT32       uHashSize;              /**< number of BSSID hash buckets (power of 2) */
     TI_UINT32       uIterator;              /**< table iterator used for getFirst / getNext */
     TI_UINT32       uSraThreshold;          /**< Rssi threshold for frame filtering */
     TI_BOOL         bStable;                /**< table status (updating / stable) */
@@ -144,6 +148,9 @@ static void         scanResultTable_updateRates(TI_HANDLE hScanResultTable, TSit
 static void         scanResultTable_UpdateWSCParams (TSiteEntry *pSite, TScanFrameInfo *pFrame);
 static TI_STATUS    scanResultTable_CheckRxSignalValidity(TScanResultTable *pScanResultTable, siteEntry_t *pSite, TI_INT8 rxLevel, TI_UINT8 channel);
 static void         scanResultTable_RemoveEntry(TI_HANDLE hScanResultTable, TI_UINT32 uIndex);
+static void         scanResultTable_HashReset (TScanResultTable *pScanResultTable);
+static void         scanResultTable_HashLink (TScanResultTable *pScanResultTable, TI_UINT32 uIndex);
+static void         scanResultTable_HashUnlink (TScanResultTable *pScanResultTable, TI_UINT32 uIndex);
 
 
 /** 
@@ -170,8 +177,18 @@ TI_HANDLE scanResultTable_Create (TI_HANDLE hOS, TI_UINT32 uEntriesNumber)
 			  sizeof (TScanResultTable)));
         return NULL;  /* this is done similarly to the next error case */
     }
+    os_memoryZero(hOS, pScanResultTable, sizeof(TScanResultTable));
 
     pScanResultTable->hOS = hOS;
+
+    /* the BSSID hash holds 16 bits site indexes */
+    if (uEntriesNumber >= SCAN_RESULT_HASH_NONE)
+    {
+        WLAN_OS_REPORT(("scanResultTable_Create: %d entries exceed the limit %d\n", uEntriesNumber, SCAN_RESULT_HASH_NONE - 1));
+        os_memoryFree(pScanResultTable->hOS, pScanResultTable, sizeof(TScanResultTable));
+        return NULL;
+    }
+
     /* allocate memory for sites' data */
     pScanResultTable->pTable = 
         (TSiteEntry *)os_memoryAlloc (pScanResultTable->hOS, sizeof (TSiteEntry) * uEntriesNumber);
@@ -185,6 +202,25 @@ TI_HANDLE scanResultTable_Create (TI_HANDLE hOS, TI_UINT32 uEntriesNumber)
     }
     pScanResultTable->uEntriesNumber = uEntriesNumber;
     os_memoryZero(pScanResultTable->hOS, pScanResultTable->pTable, sizeof(TSiteEntry) * uEntriesNumber);
+
+    /* allocate the BSSID hash - at least one bucket per site, so the average chain is shorter than one */
+    pScanResultTable->uHashSize = 1;
+    while (pScanResultTable->uHashSize < uEntriesNumber)
+    {
+        pScanResultTable->uHashSize <<= 1;
+    }
+    pScanResultTable->pHashBuckets = 
+        (TI_UINT16 *)os_memoryAlloc (pScanResultTable->hOS, sizeof (TI_UINT16) * pScanResultTable->uHashSize);
+    pScanResultTable->pHashNext = 
+        (TI_UINT16 *)os_memoryAlloc (pScanResultTable->hOS, sizeof (TI_UINT16) * uEntriesNumber);
+    if ((NULL == pScanResultTable->pHashBuckets) || (NULL == pScanResultTable->pHashNext))
+    {
+        WLAN_OS_REPORT(("scanResultTable_Create: Unable to allocate memory for the BSSID hash of %d entries\n", uEntriesNumber));
+        scanResultTable_Destroy ((TI_HANDLE)pScanResultTable);
+        return NULL;
+    }
+    scanResultTable_HashReset (pScanResultTable);
+
     return (TI_HANDLE)pScanResultTable;
 }
 
@@ -211,6 +247,7 @@ void        scanResultTable_Init (TI_HANDLE hScanResultTable, TStadHandlesList *
 
     /* initialize other parameters */
     pScanResultTable->uCurrentSiteNumber = 0;
+    scanResultTable_HashReset (pScanResultTable);
     pScanResultTable->bStable = TI_TRUE;
     pScanResultTable->uIterator = 0;
     pScanResultTable->eClearTable = eClearTable;
@@ -241,6 +278,18 @@ void        scanResultTable_Destroy (TI_HANDLE hScanResultTable)
                        sizeof (TSiteEntry) * pScanResultTable->uEntriesNumber);
     }
 
+    /* free the BSSID hash memory */
+    if (NULL != pScanResultTable->pHashBuckets)
+    {
+        os_memoryFree (pScanResultTable->hOS, (void*)pScanResultTable->pHashBuckets, 
+                       sizeof (TI_UINT16) * pScanResultTable->uHashSize);
+    }
+    if (NULL != pScanResultTable->pHashNext)
+    {
+        os_memoryFree (pScanResultTable->hOS, (void*)pScanResultTable->pHashNext, 
+                       sizeof (TI_UINT16) * pScanResultTable->uEntriesNumber);
+    }
+
     /* free scan result table object memeory */
     os_memoryFree (pScanResultTable->hOS, (void*)hScanResultTable, sizeof (TScanResultTable));
 }
@@ -293,6 +342,7 @@ TI_STATUS scanResultTable_UpdateEntry (TI_HANDLE hScanResultTable, TMacAddr *pBs
         {
             /* clear table contents */
             pScanResultTable->uCurrentSiteNumber = 0;
+            scanResultTable_HashReset (pScanResultTable);
         }
     }
 
@@ -346,6 +396,9 @@ TI_STATUS scanResultTable_UpdateEntry (TI_HANDLE hScanResultTable, TMacAddr *pBs
         scanResultTable_UpdateSiteData (hScanResultTable, 
                                         pSite,
                                         pFrame);
+
+        /* add the site to the BSSID hash (its BSSID is set by the data update) */
+        scanResultTable_HashLink (pScanResultTable, (TI_UINT32)(pSite - pScanResultTable->pTable));
     }
 
     return TI_OK;
@@ -375,6 +428,7 @@ void    scanResultTable_SetStableState (TI_HANDLE hScanResultTable)
         TRACE0(pScanResultTable->hReport, REPORT_SEVERITY_INFORMATION , "scanResultTable_SetStableState: also clearing table contents\n");
 
         pScanResultTable->uCurrentSiteNumber = 0;
+        scanResultTable_HashReset (pScanResultTable);
     }
 
     /* set stable state */
@@ -427,6 +481,83 @@ TSiteEntry  *scanResultTable_GetNext (TI_HANDLE hScanResultTable)
     return &(pScanResultTable->pTable[ pScanResultTable->uIterator++ ]);
 }
 
+/** 
+ * \fn     scanResultTable_HashBssid
+ * \brief  Get the BSSID hash bucket of a BSSID
+ * 
+ * \note   Mixes the NIC specific (last) bytes of the BSSID with the OUI bytes.
+ * \param  pScanResultTable - the scan result table object
+ * \param  pBssid - the BSSID
+ * \return The bucket index
+ */ 
+static inline TI_UINT32 scanResultTable_HashBssid (TScanResultTable *pScanResultTable, TMacAddr *pBssid)
+{
+    TI_UINT8  *pAddr = (TI_UINT8 *)pBssid;
+    TI_UINT32 uKey;
+
+    uKey  = ((TI_UINT32)pAddr[ 2 ] << 24) | ((TI_UINT32)pAddr[ 3 ] << 16) | ((TI_UINT32)pAddr[ 4 ] << 8) | pAddr[ 5 ];
+    uKey ^= ((TI_UINT32)pAddr[ 0 ] << 8) | pAddr[ 1 ];
+
+    return ((uKey * 0x9E3779B1) >> 16) & (pScanResultTable->uHashSize - 1);
+}
+
+/** 
+ * \fn     scanResultTable_HashReset
+ * \brief  Empty the BSSID hash
+ * 
+ * \param  pScanResultTable - the scan result table object
+ * \return None
+ */ 
+static void scanResultTable_HashReset (TScanResultTable *pScanResultTable)
+{
+    os_memorySet (pScanResultTable->hOS, pScanResultTable->pHashBuckets, 0xFF, 
+                  sizeof (TI_UINT16) * pScanResultTable->uHashSize);
+}
+
+/** 
+ * \fn     scanResultTable_HashLink
+ * \brief  Add a site to the BSSID hash
+ * 
+ * \param  pScanResultTable - the scan result table object
+ * \param  uIndex - the site index in the table (its BSSID must already be set)
+ * \return None
+ * \sa     scanResultTable_HashUnlink
+ */ 
+static void scanResultTable_HashLink (TScanResultTable *pScanResultTable, TI_UINT32 uIndex)
+{
+    TI_UINT32 uBucket = scanResultTable_HashBssid (pScanResultTable, &(pScanResultTable->pTable[ uIndex ].bssid));
+
+    pScanResultTable->pHashNext[ uIndex ] = pScanResultTable->pHashBuckets[ uBucket ];
+    pScanResultTable->pHashBuckets[ uBucket ] = (TI_UINT16)uIndex;
+}
+
+/** 
+ * \fn     scanResultTable_HashUnlink
+ * \brief  Remove a site from the BSSID hash
+ * 
+ * \param  pScanResultTable - the scan result table object
+ * \param  uIndex - the site index in the table (its BSSID must not have changed since it was linked)
+ * \return None
+ * \sa     scanResultTable_HashLink
+ */ 
+static void scanResultTable_HashUnlink (TScanResultTable *pScanResultTable, TI_UINT32 uIndex)
+{
+    TI_UINT16 *pLink;
+
+    pLink = &(pScanResultTable->pHashBuckets[ scanResultTable_HashBssid (pScanResultTable, &(pScanResultTable->pTable[ uIndex ].bssid)) ]);
+    while (*pLink != SCAN_RESULT_HASH_NONE)
+    {
+        if (*pLink == uIndex)
+        {
+            *pLink = pScanResultTable->pHashNext[ uIndex ];
+            return;
+        }
+        pLink = &(pScanResultTable->pHashNext[ *pLink ]);
+    }
+
+    TRACE1(pScanResultTable->hReport, REPORT_SEVERITY_ERROR , "scanResultTable_HashUnlink: entry %d not found in the BSSID hash\n", uIndex);
+}
+
 /** 
  * \fn     scanResultTable_GetByBssid
  * \brief  retreives an entry according to its SSID and BSSID
@@ -445,8 +576,10 @@ TSiteEntry  *scanResultTable_GetBySsidBssidPair (TI_HANDLE hScanResultTable, TSs
 
     TRACE6(pScanResultTable->hReport, REPORT_SEVERITY_INFORMATION , "scanResultTable_GetBySsidBssidPair: Searching for SSID  BSSID %02x:%02x:%02x:%02x:%02x:%02x\n", (*pBssid)[ 0 ], (*pBssid)[ 1 ], (*pBssid)[ 2 ], (*pBssid)[ 3 ], (*pBssid)[ 4 ], (*pBssid)[ 5 ]);
     
-    /* check all entries in the table */
-    for (uIndex = 0; uIndex < pScanResultTable->uCurrentSiteNumber; uIndex++)
+    /* check all entries in the BSSID hash bucket (all sites with this BSSID are in the same bucket) */
+    for (uIndex = pScanResultTable->pHashBuckets[ scanResultTable_HashBssid (pScanResultTable, pBssid) ]; 
+         uIndex != SCAN_RESULT_HASH_NONE; 
+         uIndex = pScanResultTable->pHashNext[ uIndex ])
     {
         /* if the BSSID and SSID match */
         if (MAC_EQUAL (*pBssid, pScanResultTable->pTable[ uIndex ].bssid) &&
@@ -551,13 +684,17 @@ void   scanResultTable_RemoveEntry(TI_HANDLE hScanResultTable, TI_UINT32 uIndex)
         return;
     }
 
+    scanResultTable_HashUnlink (pScanResultTable, uIndex);
+
     /* if uIndex is not the last entry, then copy the last entry in the table to the uIndex entry */
     if (uIndex < (pScanResultTable->uCurrentSiteNumber - 1))
     {
+        scanResultTable_HashUnlink (pScanResultTable, pScanResultTable->uCurrentSiteNumber - 1);
         os_memoryCopy(pScanResultTable->hOS, 
                       &(pScanResultTable->pTable[uIndex]), 
                       &(pScanResultTable->pTable[pScanResultTable->uCurrentSiteNumber - 1]),
                       sizeof(TSiteEntry));
+        scanResultTable_HashLink (pScanResultTable, uIndex);
     }
 
     /* clear the last entry */
@@ -588,6 +725,9 @@ TSiteEntry *scanResultTbale_AllocateNewEntry (TI_HANDLE hScanResultTable)
         {
             TRACE1(pScanResultTable->hReport, REPORT_SEVERITY_INFORMATION , "scanResultTbale_AllocateNewEntry: Table is full, found hidden SSID at index %d to replace with\n", uHiddenSsidIndex);
             
+            /* Remove the replaced site from the BSSID hash (the new site is added once its BSSID is set) */
+            scanResultTable_HashUnlink (pScanResultTable, uHiddenSsidIndex);
+
             /* Nullify new site data */
             os_memoryZero(pScanResultTable->hOS, &(pScanResultTable->pTable[ uHiddenSsidIndex ]), sizeof (TSiteEntry));
 
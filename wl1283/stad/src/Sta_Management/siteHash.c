@@ -55,14 +55,11 @@
 
 /****************************************************************************************************************
 	
-	This file implements the site hash mechanism. This mechanism is used for faster access to the sites information.
-	It is compound of the following:
-		1.	hash function	-	which maps the 4 last bits of the BSSID to an entry in the hash table.
-		2.	hash table		-	each entry in the table points to a linked list of site entries
-		3.	site table		-	each entry holds a site information
-															
-	In order to find a site in the site table, we operate the hash function on the site's BSSID.
-	We receive a hash entry. We go over the linked list pointed by this hash entry until we find the site entry.
+	This file implements the site table management. Each band has a site table, in which each entry holds a site information.
+	
+	In order to find a site, the site tables are searched by the site's BSSID.
+	The site tables only hold a few entries (MAX_SITES_BG_BAND / MAX_SITES_A_BAND), so they are searched linearly.
+	The scan results, which may hold hundreds of sites, are looked up through a BSSID hash (see scanResultTable.c).
 *****************************************************************************************************************/
 
 #define WLAN_NUM_OF_MISSED_SACNS_BEFORE_AGING 2
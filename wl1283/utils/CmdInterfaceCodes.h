@@ -252,6 +252,33 @@ typedef enum
 																									* GET Bit: ON	\n
 																									* SET Bit: OFF	\n
 																									*/
+    DRIVER_CMD_BATCH_PARAM                      =	SET_BIT | GET_BIT | DRIVER_MODULE_PARAM | 0x05, /**< Driver Commands Batch Parameter (Driver General Set/Get Command): \n
+																									* Used for executing up to PRIVATE_CMD_MAX_BATCH private commands (in buffer) in one driver-task pass, and getting their return codes (out buffer). Done Sync\n 
+																									* Parameter Number:	0x05\n
+																									* Module Number: Driver Module Number \n
+																									* Async Bit: OFF	\n
+																									* Allocate Bit: OFF	\n
+																									* GET Bit: ON	\n
+																									* SET Bit: ON	\n
+																									*/
+    DRIVER_CMD_BATCH_ASYNC_PARAM                =	SET_BIT | GET_BIT | DRIVER_MODULE_PARAM | 0x06, /**< Driver Async Commands Batch Parameter (Driver General Set/Get Command): \n
+																									* Used for queueing a commands batch and getting its batch ID (out buffer) without waiting. IPC_EVENT_CMD_BATCH_DONE is sent on its completion\n 
+																									* Parameter Number:	0x06\n
+																									* Module Number: Driver Module Number \n
+																									* Async Bit: OFF	\n
+																									* Allocate Bit: OFF	\n
+																									* GET Bit: ON	\n
+																									* SET Bit: ON	\n
+																									*/
+    DRIVER_CMD_BATCH_RESULT_PARAM               =	          GET_BIT | DRIVER_MODULE_PARAM | 0x07, /**< Driver Async Commands Batch Result Parameter (Driver General Get Command): \n
+																									* Used for getting the completed async batch results: the commands outputs and return codes (out buffer). The in buffer is the batch commands\n 
+																									* Parameter Number:	0x07\n
+																									* Module Number: Driver Module Number \n
+																									* Async Bit: OFF	\n
+																									* Allocate Bit: OFF	\n
+																									* GET Bit: ON	\n
+																									* SET Bit: OFF	\n
+																									*/
 
 	/* Site manager section */	
 	SITE_MGR_DESIRED_CHANNEL_PARAM				=	SET_BIT | GET_BIT | SITE_MGR_MODULE_PARAM | 0x01,	/**< Site Manager Desired Channel Parameter (Site Manager Module Set/Get Command):\n 
@@ -1436,6 +1463,17 @@ typedef enum
 																															* SET Bit: ON	\n
 																															*/
 
+    TX_CTRL_LATENCY_STATS_PARAM					=			  GET_BIT | TX_CTRL_MODULE_PARAM | 0x11 | ALLOC_NEEDED_PARAM,	/**< TX Control Latency Statistics Parameter (TX Control Module Get Command): \n  
+																															* Used for getting the Tx latency histograms per Tx-queue\n
+																															* Done Sync with memory allocation\n 
+																															* Parameter Number:	0x11	\n
+																															* Module Number: TX Control Module Number \n
+																															* Async Bit: OFF	\n
+																															* Allocate Bit: ON	\n
+																															* GET Bit: ON	\n
+																															* SET Bit: OFF	\n
+																															*/
+
     /* RX data section */
     RX_DATA_ENABLE_DISABLE_RX_DATA_FILTERS     	=   SET_BIT | GET_BIT | RX_DATA_MODULE_PARAM | 0x04,						/**< RX Data Enable/Disable Filters Parameter (RX Data Module Set/Get Command): \n  
 																															* Used for Enabling/Disabling Filters in FW or getting the  Filters Enabling/Disabling current Status\n
@@ -1536,6 +1574,26 @@ typedef enum
 																											* GET Bit: OFF	\n
 																											* SET Bit: ON	\n
 																											*/
+    HEALTH_MONITOR_RECOVERY_STATS               =   GET_BIT |           HEALTH_MONITOR_MODULE_PARAM | 0x02,	/**< Health Monitoring Recovery Statistics Parameter (Health Monitoring Module Get Command): \n  
+																											* Used for getting the phases duration of the last recovery and its configuration journal replay\n
+																											* Done Sync with no memory allocation\n 
+																											* Parameter Number:	0x02	\n
+																											* Module Number: Health Monitoring Module Number \n
+																											* Async Bit: OFF	\n
+																											* Allocate Bit: OFF	\n
+																											* GET Bit: ON	\n
+																											* SET Bit: OFF	\n
+																											*/
+    HEALTH_MONITOR_CONTEXT_STATS                =   GET_BIT |           HEALTH_MONITOR_MODULE_PARAM | 0x03,	/**< Health Monitoring Context Statistics Parameter (Health Monitoring Module Get Command): \n  
+																											* Used for getting the invocations, run time and schedule-to-run latency of a driver context client\n
+																											* Done Sync with no memory allocation\n 
+																											* Parameter Number:	0x03	\n
+																											* Module Number: Health Monitoring Module Number \n
+																											* Async Bit: OFF	\n
+																											* Allocate Bit: OFF	\n
+																											* GET Bit: ON	\n
+																											* SET Bit: OFF	\n
+																											*/
 
 	/* TWD CoexActivity table */
     TWD_COEX_ACTIVITY_PARAM                			=   SET_BIT | TWD_MODULE_PARAM | TWD_COEX_ACTIVITY_PARAM_ID,		/**< TWD Control CoexActivity Parameter (TWD Control Module Set/Get Command): \n  
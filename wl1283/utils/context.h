@@ -47,6 +47,18 @@
 /* The callback function type for context clients */
 typedef void (*TContextCbFunc)(TI_HANDLE hCbHndl);
 
+/* The clients dispatch priority (higher priority pending clients are invoked first) */
+typedef enum
+{
+    CONTEXT_PRIORITY_HIGH,      /* Data path clients (Tx/Rx) */
+    CONTEXT_PRIORITY_NORMAL,    /* Default */
+    CONTEXT_PRIORITY_LOW,       /* Management commands */
+    CONTEXT_NUM_PRIORITIES
+
+} EContextPriority;
+
+struct _TContextClientStats;
+
 
 
 /* External Functions Prototypes */
@@ -62,6 +74,7 @@ TI_UINT32 context_RegisterClient (TI_HANDLE       hContext,
                                   char           *sName,
                                   TI_UINT32       uNameSize);
 
+void      context_SetClientPriority (TI_HANDLE hContext, TI_UINT32 uClientId, EContextPriority ePriority);
 void      context_RequestSchedule (TI_HANDLE hContext, TI_UINT32 uClientId);
 void      context_RequestScheduleWithinWlanThread (TI_HANDLE hContext, TI_UINT32 uClientId);
 void      context_DriverTask      (TI_HANDLE hContext);
@@ -72,6 +85,7 @@ void      context_EnterCriticalSection (TI_HANDLE hContext);
 void      context_LeaveCriticalSection (TI_HANDLE hContext);
 void      context_DisableClient   (TI_HANDLE hContext, TI_UINT32 uClientId);
 void      context_EnableClient    (TI_HANDLE hContext, TI_UINT32 uClientId);
+TI_STATUS context_GetClientStats  (TI_HANDLE hContext, struct _TContextClientStats *pStats);
 #ifdef TI_DBG
 void      context_Print           (TI_HANDLE hContext);
 #endif /* TI_DBG */
@@ -303,10 +303,8 @@ TI_HANDLE que_Dequeue (TI_HANDLE hQue)
          DelFromTail (pQue->tHead.pPrev);    /* remove node from the queue */
          pQue->uCount--;
 
-#ifdef TI_DBG
         /* Clear the pNext so we can do a sanity check when enqueuing this structre in the future */
         ((TQueNodeHdr *)((TI_UINT8*)hItem + pQue->uNodeHeaderOffset))->pNext = NULL;
-#endif
 
          return (hItem);
         }
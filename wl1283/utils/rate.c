@@ -358,7 +358,8 @@ RETURN:     TI_OK if valid, otherwise TI_NOK
 ************************************************************************/
 static TI_STATUS rate_ValidateNet (ENetRate eRate)
 {
-    switch (eRate)
+    /* The _BASIC values are flagged rates outside the ENetRate enumeration */
+    switch ((TI_UINT32)eRate)
     {
         case NET_RATE_1M:
         case NET_RATE_1M_BASIC:
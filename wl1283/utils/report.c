@@ -212,6 +212,9 @@ TI_HANDLE report_Create (TI_HANDLE hOs)
     os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_138]),  "WlanDrvIf               "  ,  sizeof("WlanDrvIf               "));
     os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_139]),  "rrmMgr                  "  ,  sizeof("rrmMgr                  "));
     os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_140]),  "pwrState                "  ,  sizeof("pwrState                "));
+    os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_141]),  "SimBusDrv               "  ,  sizeof("SimBusDrv               "));
+    os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_142]),  "ringQueue               "  ,  sizeof("ringQueue               "));
+    os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_143]),  "SimBench                "  ,  sizeof("SimBench                "));
 #endif  /* PRINTF_ROLLBACK */
 
 	/* Severity table description */
@@ -212,6 +212,9 @@ typedef enum
     FILE_ID_138	   ,    /*   wlandrvif                */
     FILE_ID_139	   ,    /*   rrmMgr                   */
     FILE_ID_140	   ,    /*   pwrState                 */
+    FILE_ID_141	   ,    /*   SimBusDrv                */
+    FILE_ID_142	   ,    /*   ringQueue                */
+    FILE_ID_143	   ,    /*   SimBench                 */
     
 	REPORT_FILES_NUM	/*   Number of files with trace reports   */
 
@@ -352,202 +355,204 @@ typedef struct
 
 #define TRACE1(hReport, level, str, p1) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 1, (TI_UINT32)p1); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 1, (TI_UINT32)(uintptr_t)(p1)); } } while(0)
 
 #define TRACE2(hReport, level, str, p1, p2) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 2, (TI_UINT32)p1, (TI_UINT32)p2); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 2, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2)); } } while(0)
 
 #define TRACE3(hReport, level, str, p1, p2, p3) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 3, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 3, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3)); } } while(0)
 
 #define TRACE4(hReport, level, str, p1, p2, p3, p4) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 4, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 4, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4)); } } while(0)
 
 #define TRACE5(hReport, level, str, p1, p2, p3, p4, p5) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 5, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 5, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5)); } } while(0)
 
 #define TRACE6(hReport, level, str, p1, p2, p3, p4, p5, p6) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 6, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 6, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6)); } } while(0)
 
 #define TRACE7(hReport, level, str, p1, p2, p3, p4, p5, p6, p7) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 7, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 7, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7)); } } while(0)
 
 #define TRACE8(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 8, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 8, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8)); } } while(0)
 
 #define TRACE9(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 9, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 9, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9)); } } while(0)
 
 #define TRACE10(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 10, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 10, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10)); } } while(0)
 
 #define TRACE11(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 11, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 11, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11)); } } while(0)
 
 #define TRACE12(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 12, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 12, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12)); } } while(0)
 
 #define TRACE13(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 13, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 13, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13)); } } while(0)
 
 #define TRACE14(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 14, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 14, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14)); } } while(0)
 
 #define TRACE15(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 15, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 15, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15)); } } while(0)
 
 #define TRACE16(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 16, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 16, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16)); } } while(0)
 
 #define TRACE17(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 17, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16, (TI_UINT32)p17); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 17, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17)); } } while(0)
 
 #define TRACE18(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 18, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16, (TI_UINT32)p17, (TI_UINT32)p18); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 18, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18)); } } while(0)
 
 #define TRACE19(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 19, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16, (TI_UINT32)p17, (TI_UINT32)p18, (TI_UINT32)p19); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 19, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19)); } } while(0)
 
 #define TRACE20(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 20, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16, (TI_UINT32)p17, (TI_UINT32)p18, (TI_UINT32)p19, (TI_UINT32)p20); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 20, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20)); } } while(0)
 
 #define TRACE21(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 21, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16, (TI_UINT32)p17, (TI_UINT32)p18, (TI_UINT32)p19, (TI_UINT32)p20, (TI_UINT32)p21); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 21, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20), (TI_UINT32)(uintptr_t)(p21)); } } while(0)
 
 #define TRACE22(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16, (TI_UINT32)p17, (TI_UINT32)p18, (TI_UINT32)p19, (TI_UINT32)p20, (TI_UINT32)p21, (TI_UINT32)p22); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20), (TI_UINT32)(uintptr_t)(p21), (TI_UINT32)(uintptr_t)(p22)); } } while(0)
 
 #define TRACE25(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16, (TI_UINT32)p17, (TI_UINT32)p18, (TI_UINT32)p19, (TI_UINT32)p20, (TI_UINT32)p21, (TI_UINT32)p22, (TI_UINT32)p23, (TI_UINT32)p24, (TI_UINT32)p25); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20), (TI_UINT32)(uintptr_t)(p21), (TI_UINT32)(uintptr_t)(p22), (TI_UINT32)(uintptr_t)(p23), (TI_UINT32)(uintptr_t)(p24), (TI_UINT32)(uintptr_t)(p25)); } } while(0)
 
 #define TRACE31(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)p1, (TI_UINT32)p2, (TI_UINT32)p3, (TI_UINT32)p4, (TI_UINT32)p5, (TI_UINT32)p6, (TI_UINT32)p7, (TI_UINT32)p8, (TI_UINT32)p9, (TI_UINT32)p10, (TI_UINT32)p11, (TI_UINT32)p12, (TI_UINT32)p13, (TI_UINT32)p14, (TI_UINT32)p15, (TI_UINT32)p16, (TI_UINT32)p17, (TI_UINT32)p18, (TI_UINT32)p19, (TI_UINT32)p20, (TI_UINT32)p21, (TI_UINT32)p22, (TI_UINT32)p23, (TI_UINT32)p24, (TI_UINT32)p25, (TI_UINT32)p26, (TI_UINT32)p27, (TI_UINT32)p28, (TI_UINT32)p29, (TI_UINT32)p30, (TI_UINT32)p31); } } while(0)
+{ os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20), (TI_UINT32)(uintptr_t)(p21), (TI_UINT32)(uintptr_t)(p22), (TI_UINT32)(uintptr_t)(p23), (TI_UINT32)(uintptr_t)(p24), (TI_UINT32)(uintptr_t)(p25), (TI_UINT32)(uintptr_t)(p26), (TI_UINT32)(uintptr_t)(p27), (TI_UINT32)(uintptr_t)(p28), (TI_UINT32)(uintptr_t)(p29), (TI_UINT32)(uintptr_t)(p30), (TI_UINT32)(uintptr_t)(p31)); } } while(0)
 
 
 #else /* PRINTF_ROLLBACK */
 
+/* The message is printed by os_printf, and is also passed to os_Trace for the trace ring (see osTraceRing.h) */
+
 #define TRACE0(hReport, level, str) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 0); } } while(0)
 
 #define TRACE1(hReport, level, str, p1) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 1, (TI_UINT32)(uintptr_t)(p1)); } } while(0)
 
 #define TRACE2(hReport, level, str, p1, p2) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 2, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2)); } } while(0)
 
 #define TRACE3(hReport, level, str, p1, p2, p3) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 3, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3)); } } while(0)
 
 #define TRACE4(hReport, level, str, p1, p2, p3, p4) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 4, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4)); } } while(0)
 
 #define TRACE5(hReport, level, str, p1, p2, p3, p4, p5) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 5, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5)); } } while(0)
 
 #define TRACE6(hReport, level, str, p1, p2, p3, p4, p5, p6) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 6, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6)); } } while(0)
 
 #define TRACE7(hReport, level, str, p1, p2, p3, p4, p5, p6, p7) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 7, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7)); } } while(0)
 
 #define TRACE8(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 8, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8)); } } while(0)
 
 #define TRACE9(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 9, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9)); } } while(0)
 
 #define TRACE10(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 10, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10)); } } while(0)
 
 #define TRACE11(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 11, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11)); } } while(0)
 
 #define TRACE12(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 12, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12)); } } while(0)
 
 #define TRACE13(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 13, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13)); } } while(0)
 
 #define TRACE14(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 14, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14)); } } while(0)
 
 #define TRACE15(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 15, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15)); } } while(0)
 
 #define TRACE16(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 16, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16)); } } while(0)
 
 #define TRACE17(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 17, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17)); } } while(0)
 
 #define TRACE18(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 18, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18)); } } while(0)
 
 #define TRACE19(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 19, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19)); } } while(0)
 
 #define TRACE20(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 20, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20)); } } while(0)
 
 #define TRACE21(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 21, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20), (TI_UINT32)(uintptr_t)(p21)); } } while(0)
 
 #define TRACE22(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20), (TI_UINT32)(uintptr_t)(p21), (TI_UINT32)(uintptr_t)(p22)); } } while(0)
 
 #define TRACE25(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20), (TI_UINT32)(uintptr_t)(p21), (TI_UINT32)(uintptr_t)(p22), (TI_UINT32)(uintptr_t)(p23), (TI_UINT32)(uintptr_t)(p24), (TI_UINT32)(uintptr_t)(p25)); } } while(0)
 
 #define TRACE31(hReport, level, str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31) \
 	do { if (hReport && (((TReport *)hReport)->aSeverityTable[level]) && (((TReport *)hReport)->aFileEnable[__FILE_ID__])) \
-{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p27, p27, p28, p29, p30, p31); } } while(0)
+{ os_printf ("%s, %s:", ((TReport *)hReport)->aFileName[__FILE_ID__], ((TReport *)hReport)->aSeverityDesc[level]); os_printf (str, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p27, p27, p28, p29, p30, p31); os_Trace((((TReport *)hReport)->hOs), level, __FILE_ID__, __LINE__, 22, (TI_UINT32)(uintptr_t)(p1), (TI_UINT32)(uintptr_t)(p2), (TI_UINT32)(uintptr_t)(p3), (TI_UINT32)(uintptr_t)(p4), (TI_UINT32)(uintptr_t)(p5), (TI_UINT32)(uintptr_t)(p6), (TI_UINT32)(uintptr_t)(p7), (TI_UINT32)(uintptr_t)(p8), (TI_UINT32)(uintptr_t)(p9), (TI_UINT32)(uintptr_t)(p10), (TI_UINT32)(uintptr_t)(p11), (TI_UINT32)(uintptr_t)(p12), (TI_UINT32)(uintptr_t)(p13), (TI_UINT32)(uintptr_t)(p14), (TI_UINT32)(uintptr_t)(p15), (TI_UINT32)(uintptr_t)(p16), (TI_UINT32)(uintptr_t)(p17), (TI_UINT32)(uintptr_t)(p18), (TI_UINT32)(uintptr_t)(p19), (TI_UINT32)(uintptr_t)(p20), (TI_UINT32)(uintptr_t)(p21), (TI_UINT32)(uintptr_t)(p22), (TI_UINT32)(uintptr_t)(p23), (TI_UINT32)(uintptr_t)(p24), (TI_UINT32)(uintptr_t)(p25), (TI_UINT32)(uintptr_t)(p26), (TI_UINT32)(uintptr_t)(p27), (TI_UINT32)(uintptr_t)(p28), (TI_UINT32)(uintptr_t)(p29), (TI_UINT32)(uintptr_t)(p30), (TI_UINT32)(uintptr_t)(p31)); } } while(0)
 
 #endif /* #ifdef PRINTF_ROLLBACK */
 
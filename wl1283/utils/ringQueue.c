@@ -0,0 +1,431 @@
+/*
+ * ringQueue.c
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+/** \file   ringQueue.c 
+ *  \brief  This module provides a bounded single-producer/single-consumer ring queue,
+ *            with the enqueue, dequeue and requeue semantics of the queue module.
+ *
+ *  The producer context only calls ringQue_Enqueue() and the consumer context only calls
+ *    ringQue_Dequeue(), ringQue_Requeue(), ringQue_Peek() and ringQue_Remove(), 
+ *    so no lock is needed between them.
+ *  The producer owns the head index and the consumer owns the tail index and the requeue slot.
+ *  Unlike the queue module, the items don't need to contain a TQueNodeHdr.
+ *
+ *  \see    ringQueue.h, queue.c
+ */
+
+
+
+#define __FILE_ID__  FILE_ID_142
+#include "osApi.h"
+#include "report.h"
+#include "ringQueue.h"
+
+
+#define RING_QUE_MAX_LIMIT      0x8000      /* Maximum queue limit (the ring size is rounded up to a power of 2) */
+
+
+/* Ring queue structure */
+typedef struct 
+{
+    volatile TI_UINT32  uHead;      /* Number of items enqueued since creation (written only by the producer) */
+    volatile TI_UINT32  uTail;      /* Number of items dequeued since creation (written only by the consumer) */
+    TI_HANDLE           hRequeued;  /* Item returned by the consumer, dequeued before the ring items */
+    TI_UINT32           uMask;      /* Ring size minus 1 */
+    TI_UINT32           uLimit;     /* Upper limit of items in queue */
+    TI_UINT32           uMaxCount;  /* Maximum items count (for debug) */
+    TI_UINT32           uOverflow;  /* Number of overflow occurences - couldn't insert item (always counted) */
+    TI_UINT32           uAllocSize; /* The object size including the ring */
+    TI_HANDLE          *aRing;      /* The ring entries (allocated right after the object) */
+    TI_HANDLE           hOs;
+    TI_HANDLE           hReport; 
+} TRingQue;
+
+
+
+/*
+ *              EXTERNAL  FUNCTIONS 
+ *        =============================== 
+ */
+
+
+/** 
+ * \fn     ringQue_Create 
+ * \brief  Create a ring queue. 
+ * 
+ * Allocate and init a ring queue object, with a ring large enough for uLimit items.
+ * 
+ * \note    
+ * \param  hOs     - Handle to Os Abstraction Layer
+ * \param  hReport - Handle to report module
+ * \param  uLimit  - Maximum items to store in queue (up to RING_QUE_MAX_LIMIT)
+ * \return Handle to the allocated queue 
+ * \sa     ringQue_Destroy
+ */ 
+TI_HANDLE ringQue_Create (TI_HANDLE hOs, TI_HANDLE hReport, TI_UINT32 uLimit)
+{
+    TRingQue  *pQue;
+    TI_UINT32  uRingSize;
+    TI_UINT32  uAllocSize;
+
+    if ((uLimit == 0) || (uLimit > RING_QUE_MAX_LIMIT))
+    {
+        WLAN_OS_REPORT (("ringQue_Create: Illegal queue limit %d\n", uLimit));
+        return NULL;
+    }
+
+    /* The ring size is the smallest power of 2 that can hold uLimit items */
+    for (uRingSize = 1; uRingSize < uLimit; uRingSize <<= 1) {}
+
+    /* allocate queue module and its ring */
+    uAllocSize = sizeof(TRingQue) + uRingSize * sizeof(TI_HANDLE);
+    pQue = os_memoryAlloc (hOs, uAllocSize);
+
+    if (!pQue)
+    {
+        WLAN_OS_REPORT (("Error allocating the Ring Queue Module\n"));
+        return NULL;
+    }
+
+    os_memoryZero (hOs, pQue, uAllocSize);
+
+    /* Set the Queue parameters */
+    pQue->hOs        = hOs;
+    pQue->hReport    = hReport;
+    pQue->uLimit     = uLimit;
+    pQue->uMask      = uRingSize - 1;
+    pQue->uAllocSize = uAllocSize;
+    pQue->aRing      = (TI_HANDLE *)(pQue + 1);
+
+    return (TI_HANDLE)pQue;
+}
+
+
+/** 
+ * \fn     ringQue_Destroy
+ * \brief  Destroy the ring queue. 
+ * 
+ * Free the queue memory.
+ * 
+ * \note   The queue's owner should first free the queued items!
+ * \param  hRingQue - The queue object
+ * \return TI_OK on success or TI_NOK on failure 
+ * \sa     ringQue_Create
+ */ 
+TI_STATUS ringQue_Destroy (TI_HANDLE hRingQue)
+{
+    TRingQue *pQue = (TRingQue *)hRingQue;
+
+    if (pQue)
+    {
+        /* Alert if the queue is unloaded before it was cleared from items */
+        if (ringQue_Size (hRingQue))
+        {
+            TRACE0(pQue->hReport, REPORT_SEVERITY_WARNING, "ringQue_Destroy() Queue Not Empty!!");
+        }
+        /* free Queue object */
+        os_memoryFree (pQue->hOs, pQue, pQue->uAllocSize);
+    }
+
+    return TI_OK;
+}
+
+
+/** 
+ * \fn     ringQue_Enqueue
+ * \brief  Enqueue an item 
+ * 
+ * Enqueue an item at the queue's head (last in queue).
+ * 
+ * \note   Called only from the producer context!
+ * \param  hRingQue - The queue object
+ * \param  hItem    - Handle to queued item
+ * \return TI_OK if item was queued, or TI_NOK if not queued due to overflow
+ * \sa     ringQue_Dequeue, ringQue_Requeue
+ */ 
+TI_STATUS ringQue_Enqueue (TI_HANDLE hRingQue, TI_HANDLE hItem)
+{
+    TRingQue  *pQue  = (TRingQue *)hRingQue;
+    TI_UINT32  uHead = pQue->uHead;
+    TI_UINT32  uCount;
+
+    /* Check queue limit (the requeued item is counted, though it doesn't use a ring entry) */
+    uCount = uHead - pQue->uTail;
+    if (pQue->hRequeued)
+    {
+        uCount++;
+    }
+
+    if (uCount < pQue->uLimit)
+    {
+        /* Fill the entry and only then publish it to the consumer */
+        pQue->aRing[uHead & pQue->uMask] = hItem;
+        TI_SMP_WMB();
+        pQue->uHead = uHead + 1;
+
+#ifdef TI_DBG
+        if (uCount + 1 > pQue->uMaxCount)
+        {
+            pQue->uMaxCount = uCount + 1;
+        }
+        TRACE0(pQue->hReport, REPORT_SEVERITY_INFORMATION , "ringQue_Enqueue(): Enqueued Successfully\n");
+#endif
+
+        return TI_OK;
+    }
+
+    /* 
+     *  Queue is overflowed, return TI_NOK.
+     */
+    pQue->uOverflow++;
+#ifdef TI_DBG
+    TRACE0(pQue->hReport, REPORT_SEVERITY_WARNING , "ringQue_Enqueue(): Queue Overflow\n");
+#endif
+
+    return TI_NOK;
+}
+
+
+/** 
+ * \fn     ringQue_Dequeue
+ * \brief  Dequeue an item 
+ * 
+ * Dequeue an item from the queue's tail (first in queue).
+ * A requeued item, if any, is dequeued first.
+ * 
+ * \note   Called only from the consumer context!
+ * \param  hRingQue - The queue object
+ * \return pointer to dequeued item or NULL if queue is empty
+ * \sa     ringQue_Enqueue, ringQue_Requeue
+ */ 
+TI_HANDLE ringQue_Dequeue (TI_HANDLE hRingQue)
+{
+    TRingQue  *pQue  = (TRingQue *)hRingQue;
+    TI_UINT32  uTail = pQue->uTail;
+    TI_HANDLE  hItem;
+
+    /* A requeued item is the first in queue */
+    if (pQue->hRequeued)
+    {
+        hItem = pQue->hRequeued;
+        pQue->hRequeued = NULL;
+        return hItem;
+    }
+
+    if (uTail != pQue->uHead)
+    {
+        /* Read the entry only after seeing it published, and release it only after reading it */
+        TI_SMP_RMB();
+        hItem = pQue->aRing[uTail & pQue->uMask];
+        TI_SMP_MB();
+        pQue->uTail = uTail + 1;
+
+        return hItem;
+    }
+
+    /* Queue is empty */
+    TRACE0(pQue->hReport, REPORT_SEVERITY_INFORMATION , "ringQue_Dequeue(): Queue is empty\n");
+    return NULL;
+}
+
+
+/** 
+ * \fn     ringQue_Peek
+ * \brief  Get the first items without dequeuing them 
+ * 
+ * Copy up to uMaxItems items from the queue's tail (first in queue) to aItems, 
+ *   leaving them in the queue. A requeued item, if any, is the first one.
+ * Used with ringQue_Remove() to dequeue a burst of items, when it is not yet known 
+ *   how many of them will be consumed.
+ * 
+ * \note   Called only from the consumer context!
+ * \param  hRingQue  - The queue object
+ * \param  aItems    - Array to fill with the items handles
+ * \param  uMaxItems - Maximum items to copy (aItems size)
+ * \return Number of items copied to aItems (0 if queue is empty)
+ * \sa     ringQue_Remove
+ */ 
+TI_UINT32 ringQue_Peek (TI_HANDLE hRingQue, TI_HANDLE *aItems, TI_UINT32 uMaxItems)
+{
+    TRingQue  *pQue  = (TRingQue *)hRingQue;
+    TI_UINT32  uTail = pQue->uTail;
+    TI_UINT32  uHead = pQue->uHead;
+    TI_UINT32  uNumItems = 0;
+
+    /* A requeued item is the first in queue */
+    if (pQue->hRequeued && uMaxItems)
+    {
+        aItems[uNumItems++] = pQue->hRequeued;
+    }
+
+    /* Read the entries only after seeing them published */
+    TI_SMP_RMB();
+    while ((uNumItems < uMaxItems) && (uTail != uHead))
+    {
+        aItems[uNumItems++] = pQue->aRing[uTail & pQue->uMask];
+        uTail++;
+    }
+
+    return uNumItems;
+}
+
+
+/** 
+ * \fn     ringQue_Remove
+ * \brief  Remove the first items from the queue 
+ * 
+ * Remove uNumItems items from the queue's tail, following a ringQue_Peek() call 
+ *   that returned at least uNumItems items.
+ * 
+ * \note   Called only from the consumer context!
+ * \param  hRingQue  - The queue object
+ * \param  uNumItems - Number of items to remove
+ * \return void
+ * \sa     ringQue_Peek
+ */ 
+void ringQue_Remove (TI_HANDLE hRingQue, TI_UINT32 uNumItems)
+{
+    TRingQue  *pQue = (TRingQue *)hRingQue;
+
+    if (uNumItems == 0)
+    {
+        return;
+    }
+
+    if (pQue->hRequeued)
+    {
+        pQue->hRequeued = NULL;
+        uNumItems--;
+    }
+
+    /* Release the entries to the producer only after they were read */
+    TI_SMP_MB();
+    pQue->uTail += uNumItems;
+}
+
+
+/** 
+ * \fn     ringQue_Requeue
+ * \brief  Requeue an item 
+ * 
+ * Requeue an item at the queue's tail (first in queue).
+ * 
+ * \note   Called only from the consumer context, and only to return the last dequeued item!
+ *         The item is kept aside and not in the ring, so it can't overflow the queue 
+ *           even if the producer has filled it in the meantime.
+ * \param  hRingQue - The queue object
+ * \param  hItem    - Handle to queued item
+ * \return TI_OK if item was queued, or TI_NOK if an item was already requeued
+ * \sa     ringQue_Enqueue, ringQue_Dequeue
+ */ 
+TI_STATUS ringQue_Requeue (TI_HANDLE hRingQue, TI_HANDLE hItem)
+{
+    TRingQue *pQue = (TRingQue *)hRingQue;
+
+    if (pQue->hRequeued == NULL)
+    {
+        pQue->hRequeued = hItem;
+
+#ifdef TI_DBG
+        TRACE0(pQue->hReport, REPORT_SEVERITY_INFORMATION , "ringQue_Requeue(): Requeued successfully\n");
+#endif
+
+        return TI_OK;
+    }
+
+    /* 
+     *  Only the last dequeued item may be requeued, so this is not expected.
+     */
+    pQue->uOverflow++;
+#ifdef TI_DBG
+    TRACE0(pQue->hReport, REPORT_SEVERITY_ERROR , "ringQue_Requeue(): Requeue slot is occupied\n");
+#endif
+
+    return TI_NOK;
+}
+
+
+/** 
+ * \fn     ringQue_Size
+ * \brief  Return queue size 
+ * 
+ * Return number of items in queue.
+ * 
+ * \note   If called from one context while the other updates the queue, 
+ *           the result may be already outdated by one or more items.
+ * \param  hRingQue - The queue object
+ * \return TI_UINT32 - the items count
+ * \sa     
+ */ 
+TI_UINT32 ringQue_Size (TI_HANDLE hRingQue)
+{
+    TRingQue  *pQue = (TRingQue *)hRingQue;
+    TI_UINT32  uCount = pQue->uHead - pQue->uTail;
+
+    if (pQue->hRequeued)
+    {
+        uCount++;
+    }
+
+    return uCount;
+}
+
+	
+/** 
+ * \fn     ringQue_Print
+ * \brief  Print queue status
+ * 
+ * Print the queue's parameters (not the content).
+ * 
+ * \note   
+ * \param  hRingQue - The queue object
+ * \return void
+ * \sa     
+ */ 
+
+#ifdef TI_DBG
+
+void ringQue_Print (TI_HANDLE hRingQue)
+{
+#ifdef REPORT_LOG
+    TRingQue *pQue = (TRingQue *)hRingQue;
+
+    WLAN_OS_REPORT(("ringQue_Print: Count=%u MaxCount=%u Limit=%u RingSize=%u Overflow=%u Head=%u Tail=%u Requeued=0x%x\n",
+                    ringQue_Size (hRingQue), pQue->uMaxCount, pQue->uLimit, pQue->uMask + 1, pQue->uOverflow, 
+                    pQue->uHead, pQue->uTail, pQue->hRequeued));
+#endif
+}
+
+#endif /* TI_DBG */
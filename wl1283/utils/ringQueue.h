@@ -0,0 +1,64 @@
+/*
+ * ringQueue.h
+ *
+ * Copyright(c) 1998 - 2010 Texas Instruments. All rights reserved.      
+ * All rights reserved.                                                  
+ *                                                                       
+ * Redistribution and use in source and binary forms, with or without    
+ * modification, are permitted provided that the following conditions    
+ * are met:                                                              
+ *                                                                       
+ *  * Redistributions of source code must retain the above copyright     
+ *    notice, this list of conditions and the following disclaimer.      
+ *  * Redistributions in binary form must reproduce the above copyright  
+ *    notice, this list of conditions and the following disclaimer in    
+ *    the documentation and/or other materials provided with the         
+ *    distribution.                                                      
+ *  * Neither the name Texas Instruments nor the names of its            
+ *    contributors may be used to endorse or promote products derived    
+ *    from this software without specific prior written permission.      
+ *                                                                       
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS   
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT     
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT  
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT      
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT   
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** \file   ringQueue.h 
+ *  \brief  Single-producer/single-consumer ring queue module header file.
+ *
+ *  \see    ringQueue.c
+ */
+
+
+#ifndef _RING_QUEUE_H_
+#define _RING_QUEUE_H_
+
+
+
+/* External Functions Prototypes */
+/* ============================= */
+TI_HANDLE ringQue_Create  (TI_HANDLE hOs, TI_HANDLE hReport, TI_UINT32 uLimit);
+TI_STATUS ringQue_Destroy (TI_HANDLE hRingQue);
+TI_STATUS ringQue_Enqueue (TI_HANDLE hRingQue, TI_HANDLE hItem);
+TI_HANDLE ringQue_Dequeue (TI_HANDLE hRingQue);
+TI_STATUS ringQue_Requeue (TI_HANDLE hRingQue, TI_HANDLE hItem);
+TI_UINT32 ringQue_Peek    (TI_HANDLE hRingQue, TI_HANDLE *aItems, TI_UINT32 uMaxItems);
+void      ringQue_Remove  (TI_HANDLE hRingQue, TI_UINT32 uNumItems);
+TI_UINT32 ringQue_Size    (TI_HANDLE hRingQue);
+
+#ifdef TI_DBG
+void      ringQue_Print   (TI_HANDLE hRingQue);
+#endif /* TI_DBG */
+
+
+
+#endif  /* _RING_QUEUE_H_ */
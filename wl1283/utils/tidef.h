@@ -153,7 +153,7 @@
  * \def TI_FIELD_OFFSET
  * \brief Macro which returns a field offset from structure begine
  */
-#define TI_FIELD_OFFSET(type,field)    ((TI_UINT32)(&(((type*)0)->field)))
+#define TI_FIELD_OFFSET(type,field)    ((TI_UINT32)(uintptr_t)(&(((type*)0)->field)))
 #endif                                 
 
 
@@ -46,6 +46,17 @@
 /* The callback function type for timer clients */
 typedef void (*TTimerCbFunc)(TI_HANDLE hCbHndl, TI_BOOL bTwdInitOccured);
 
+/* The timer module statistics (see tmr_GetStats) */
+typedef struct
+{
+    TI_UINT32   uOsTimerWakeups;     /* Expiries of the timers' own OS timers */
+    TI_UINT32   uWheelWakeups;       /* Expiries of the OS timer shared by the timers with slack */
+    TI_UINT32   uWakeupsPerSec;      /* OS timers wakeups per second (both kinds, since init) */
+    TI_UINT32   uWheelExpiries;      /* Timers with slack that expired */
+    TI_UINT32   uCoalescedExpiries;  /* Timers with slack that expired without a wakeup of their own */
+    TI_UINT32   uWheelTimers;        /* Timers with slack currently running */
+} TTimerStats;
+
 
 /* External Functions Prototypes */
 /* ============================= */
@@ -64,6 +75,8 @@ void      tmr_StartTimer (TI_HANDLE     hTimerInfo,
                           TI_UINT32     uIntervalMsec,
                           TI_BOOL       bPeriodic);
 void      tmr_StopTimer (TI_HANDLE hTimerInfo);
+void      tmr_SetTimerSlack (TI_HANDLE hTimerInfo, TI_UINT32 uSlackMsec);
+void      tmr_GetStats (TI_HANDLE hTimerModule, TTimerStats *pStats);
 void      tmr_GetExpiry (TI_HANDLE hTimerInfo);
 void      tmr_HandleExpiry (TI_HANDLE hTimerModule);
 
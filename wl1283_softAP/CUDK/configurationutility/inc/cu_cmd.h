@@ -98,8 +98,11 @@ VOID CuCmd_GetRxDataFiltersStatistics(THandle hCuCmd, ConParm_t parm[], U16 nPar
 
 VOID CuCmd_ShowStatistics(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ShowTxStatistics(THandle hCuCmd, ConParm_t parm[], U16 nParms);
+VOID CuCmd_ShowTxLatency(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ShowLinkStatistics(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ShowAdvancedParams(THandle hCuCmd, ConParm_t parm[], U16 nParms);
+VOID CuCmd_ShowRecoveryStats(THandle hCuCmd, ConParm_t parm[], U16 nParms);
+VOID CuCmd_ShowContextStats(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 
 VOID CuCmd_ScanAppGlobalConfig(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ScanAppChannelConfig(THandle hCuCmd, ConParm_t parm[], U16 nParms);
@@ -182,6 +185,7 @@ VOID CuCmd_SetReport(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_AddReport(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ClearReport(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_ReportSeverityLevel(THandle hCuCmd, ConParm_t parm[], U16 nParms);
+VOID CuCmd_TraceRingDump(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 VOID CuCmd_SetReportLevelCLI(THandle hCuCmd, ConParm_t parm[], U16 nParms);
 
 VOID CuCmd_PrintDriverDebug(THandle hCuCmd, ConParm_t parm[], U16 nParms);
@@ -45,6 +45,7 @@
 #include "cu_cmd.h"
 #include "cu_hostapd.h"
 #include "oserr.h"
+#include "osTraceRing.h"
 #include "hostapd_cli.h"
 
 /* defines */
@@ -162,7 +163,8 @@ static named_value_t event_type[] = {
     { IPC_EVENT_SCAN_FAILED,			(PS8)"ScanFailed" },
     { IPC_EVENT_WPS_SESSION_OVERLAP,    (PS8)"IPC_EVENT_WPS_SESSION_OVERLAP" },
     { IPC_EVENT_RSSI_SNR_TRIGGER,       (PS8)"IPC_EVENT_RSSI_SNR_TRIGGER" },
-    { IPC_EVENT_TIMEOUT,                (PS8)"Timeout" }
+    { IPC_EVENT_TIMEOUT,                (PS8)"Timeout" },
+    { IPC_EVENT_CMD_BATCH_DONE,         (PS8)"IPC_EVENT_CMD_BATCH_DONE" }
 };
 
 static named_value_t report_module[] =
@@ -310,6 +312,7 @@ static named_value_t report_module[] =
     { FILE_ID_140 ,  (PS8)"roleAP                  " },              
     { FILE_ID_141 ,  (PS8)"wlanLinks               " },           
     { FILE_ID_142 ,  (PS8)"ApCmd                   " },		          
+    { FILE_ID_143 ,  (PS8)"ringQueue               " },
 
 };
 
@@ -2217,6 +2220,102 @@ VOID CuCmd_ShowLinkStatistics(THandle hCuCmd, ConParm_t parm[], U16 nParms)
 	}       
 }
 
+/* Get the upper bound in usec of the histogram bucket which includes the given percentile of the packets */
+static U32 CuCmd_TxLatencyPercentile(PU32 pHist, U32 uNumPackets, U32 uPercent)
+{
+    U32 uThreshold = (uNumPackets * uPercent + 99) / 100;
+    U32 uSum = 0;
+    U32 i;
+
+    for (i = 0; i < TX_LATENCY_HIST_BUCKETS - 1; i++)
+    {
+        uSum += pHist[i];
+        if (uSum >= uThreshold)
+        {
+            break;
+        }
+    }
+
+    return 1 << (i + 1);
+}
+
+/* Print the percentiles and the buckets of one Tx latency histogram */
+static VOID CuCmd_PrintTxLatencyHist(TTxLatencyHist *pHist)
+{
+    U32 Segment;
+    U32 Bucket;
+    static const char *SegmentStr[TX_LATENCY_SEGMENTS_NUM] = { "Host", "FW queue", "Medium", "Total" };
+
+    os_error_printf(CU_MSG_INFO2, (PS8)"  Segment   :      p50      p90      p99\n");
+    for (Segment = 0; Segment < TX_LATENCY_SEGMENTS_NUM; Segment++)
+    {
+        os_error_printf(CU_MSG_INFO2, (PS8)"  %-9s : %8d %8d %8d\n", SegmentStr[Segment],
+                        CuCmd_TxLatencyPercentile(pHist->aHist[Segment], pHist->uNumPackets, 50),
+                        CuCmd_TxLatencyPercentile(pHist->aHist[Segment], pHist->uNumPackets, 90),
+                        CuCmd_TxLatencyPercentile(pHist->aHist[Segment], pHist->uNumPackets, 99));
+    }
+
+    os_error_printf(CU_MSG_INFO2, (PS8)"\n  Below [usec] :     Host FW queue   Medium    Total\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"  ------------ : -------- -------- -------- --------\n");
+    for (Bucket = 0; Bucket < TX_LATENCY_HIST_BUCKETS; Bucket++)
+    {
+        if (Bucket == TX_LATENCY_HIST_BUCKETS - 1)
+        {
+            os_error_printf(CU_MSG_INFO2, (PS8)"  Above %6d :", 1 << Bucket);
+        }
+        else
+        {
+            os_error_printf(CU_MSG_INFO2, (PS8)"  %12d :", 1 << (Bucket + 1));
+        }
+        os_error_printf(CU_MSG_INFO2, (PS8)" %8d %8d %8d %8d\n",
+                        pHist->aHist[TX_LATENCY_HOST][Bucket],
+                        pHist->aHist[TX_LATENCY_FW_QUEUE][Bucket],
+                        pHist->aHist[TX_LATENCY_MEDIUM][Bucket],
+                        pHist->aHist[TX_LATENCY_TOTAL][Bucket]);
+    }
+}
+
+VOID CuCmd_ShowTxLatency(THandle hCuCmd, ConParm_t parm[], U16 nParms)
+{
+    CuCmd_t* pCuCmd = (CuCmd_t*)hCuCmd;
+    TIWLN_TX_LATENCY_STATISTICS txLatency;
+    U32 TxQid;
+    U32 linkId;
+
+    if(OK != CuCommon_GetTxLatencyStatistics(pCuCmd->hCuCommon, &txLatency, (nParms == 0) ? 0 : parm[0].value)) return;
+
+    os_error_printf(CU_MSG_INFO2, (PS8)"*************************\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"Tx Queues Latency [usec]:\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"*************************\n");
+
+    if (!txLatency.bEnabled)
+    {
+        os_error_printf(CU_MSG_INFO2, (PS8)"Tx latency histograms are disabled (TxLatencyStats = 0)\n");
+        return;
+    }
+
+    for (TxQid = 0; TxQid < MAX_NUM_OF_AC; TxQid++)
+    {
+        os_error_printf(CU_MSG_INFO2, (PS8)"\nTx Queue %d: %d packets\n", TxQid, txLatency.tAcHist[TxQid].uNumPackets);
+        os_error_printf(CU_MSG_INFO2, (PS8)"===========\n");
+        if (txLatency.tAcHist[TxQid].uNumPackets)
+        {
+            CuCmd_PrintTxLatencyHist(&txLatency.tAcHist[TxQid]);
+        }
+    }
+
+    /* Print only the links that transmitted since the last reset */
+    for (linkId = 0; linkId < WLANLINKS_MAX_LINKS; linkId++)
+    {
+        if (txLatency.tLinkHist[linkId].uNumPackets)
+        {
+            os_error_printf(CU_MSG_INFO2, (PS8)"\nLink %d: %d packets\n", linkId, txLatency.tLinkHist[linkId].uNumPackets);
+            os_error_printf(CU_MSG_INFO2, (PS8)"=======\n");
+            CuCmd_PrintTxLatencyHist(&txLatency.tLinkHist[linkId]);
+        }
+    }
+}
+
 VOID CuCmd_ShowAdvancedParams(THandle hCuCmd, ConParm_t parm[], U16 nParms)
 {
     CuCmd_t* pCuCmd = (CuCmd_t*)hCuCmd;
@@ -2274,6 +2373,71 @@ VOID CuCmd_ShowAdvancedParams(THandle hCuCmd, ConParm_t parm[], U16 nParms)
     
 }
 
+VOID CuCmd_ShowRecoveryStats(THandle hCuCmd, ConParm_t parm[], U16 nParms)
+{
+    CuCmd_t* pCuCmd = (CuCmd_t*)hCuCmd;
+    TRecoveryStats tStats;
+
+    if(OK != CuCommon_GetBuffer(pCuCmd->hCuCommon, HEALTH_MONITOR_RECOVERY_STATS, &tStats, sizeof(TRecoveryStats))) return;
+
+    os_error_printf(CU_MSG_INFO2, (PS8)"********************\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"Recovery Statistics:\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"********************\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"  Recoveries : %u\n", tStats.uNumOfRecoveries);
+    if (tStats.uNumOfRecoveries == 0)
+    {
+        return;
+    }
+    os_error_printf(CU_MSG_INFO2, (PS8)"  Last recovery (msec) : %u (max %u)\n", tStats.uTotalTime, tStats.uMaxTotalTime);
+    os_error_printf(CU_MSG_INFO2, (PS8)"    Stop        : %u\n", tStats.uStopTime);
+    os_error_printf(CU_MSG_INFO2, (PS8)"    FW reload   : %u\n", tStats.uFwReloadTime);
+    os_error_printf(CU_MSG_INFO2, (PS8)"    FW config   : %u\n", tStats.uConfigTime);
+    os_error_printf(CU_MSG_INFO2, (PS8)"    Reconnect   : %u\n", tStats.uReconnectTime);
+    os_error_printf(CU_MSG_INFO2, (PS8)"  Config replay : <%s>\n", (tStats.bJournalReplay) ? "journal" : "full");
+    os_error_printf(CU_MSG_INFO2, (PS8)"    Journaled steps : %u\n", tStats.uJournalSteps);
+    os_error_printf(CU_MSG_INFO2, (PS8)"    Replayed steps  : %u\n", tStats.uReplayedSteps);
+    os_error_printf(CU_MSG_INFO2, (PS8)"    Skipped steps   : %u\n", tStats.uSkippedSteps);
+}
+
+VOID CuCmd_ShowContextStats(THandle hCuCmd, ConParm_t parm[], U16 nParms)
+{
+    CuCmd_t* pCuCmd = (CuCmd_t*)hCuCmd;
+    TContextClientStats tStats;
+    U32 uClientId = 0;
+    U32 uNumClients;
+
+    os_error_printf(CU_MSG_INFO2, (PS8)"**************************\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"Driver Context Statistics:\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"**************************\n");
+    os_error_printf(CU_MSG_INFO2, (PS8)"ID Name         Prio   Requests    Invokes  Run(ms)  AvgRun(us) MaxRun(us) AvgLat(us) MaxLat(us)\n");
+
+    do
+    {
+        os_memset(&tStats, 0, sizeof(TContextClientStats));
+        tStats.uClientId = uClientId;
+
+        if(OK != CuCommon_GetSetBuffer(pCuCmd->hCuCommon, HEALTH_MONITOR_CONTEXT_STATS, &tStats, sizeof(TContextClientStats))) return;
+
+        uNumClients = tStats.uNumClients;
+        if (uClientId >= uNumClients)
+        {
+            break;
+        }
+
+        os_error_printf(CU_MSG_INFO2, (PS8)"%2u %-12s %4u %10u %10u %8u %11u %10u %10u %10u\n",
+                        uClientId,
+                        tStats.sName,
+                        tStats.uPriority,
+                        tStats.uRequests,
+                        tStats.uInvokes,
+                        (U32)(tStats.uRunTimeUs / 1000),
+                        (tStats.uInvokes) ? (U32)(tStats.uRunTimeUs / tStats.uInvokes) : 0,
+                        tStats.uMaxRunTimeUs,
+                        (tStats.uInvokes) ? (U32)(tStats.uLatencyUs / tStats.uInvokes) : 0,
+                        tStats.uMaxLatencyUs);
+    } while (++uClientId < uNumClients);
+}
+
 
 VOID Cucmd_ShowPowerConsumptionStats(THandle hCuCmd,ConParm_t parm[],U16 nParms)
 {
@@ -4273,6 +4437,91 @@ VOID CuCmd_ReportSeverityLevel(THandle hCuCmd, ConParm_t parm[], U16 nParms)
     }
 }
 
+VOID CuCmd_TraceRingDump(THandle hCuCmd, ConParm_t parm[], U16 nParms)
+{
+    TTraceRingMapHdr *pMap;
+    U32 uMapSize;
+    U32 uMaxRecs = (nParms == 0) ? 0 : (U32)parm[0].value;
+    U32 uRing;
+
+    /* Map the header first, to learn the rings layout */
+    pMap = (TTraceRingMapHdr *)os_mapFile((PS8)TRACE_RING_DEV_PATH, sizeof(TTraceRingMapHdr));
+    if (pMap == NULL)
+    {
+        return;
+    }
+    if ((pMap->uMagic != TRACE_RING_MAGIC) || (pMap->uVersion != TRACE_RING_VERSION) || 
+        (pMap->uRecSize != sizeof(TTraceRingRec)))
+    {
+        os_error_printf(CU_MSG_ERROR, (PS8)"Error - CuCmd_TraceRingDump - unknown trace ring format (magic 0x%x, version %d)\n", 
+                        pMap->uMagic, pMap->uVersion);
+        os_unmapFile(pMap, sizeof(TTraceRingMapHdr));
+        return;
+    }
+    uMapSize = pMap->uTotalSize;
+    os_unmapFile(pMap, sizeof(TTraceRingMapHdr));
+
+    pMap = (TTraceRingMapHdr *)os_mapFile((PS8)TRACE_RING_DEV_PATH, uMapSize);
+    if (pMap == NULL)
+    {
+        return;
+    }
+
+    for (uRing = 0; uRing < pMap->uNumRings; uRing++)
+    {
+        TTraceRingHdr *pRing = TRACE_RING_HDR(pMap, uRing);
+        U32 uTail = pRing->uTail;
+        U32 uHead = *(volatile U32 *)&pRing->uHead;
+        U32 uRecs = 0;
+
+        /* Consume the committed records, a record that is still being written ends the ring */
+        while ((uTail != uHead) && ((uMaxRecs == 0) || (uRecs < uMaxRecs)))
+        {
+            TTraceRingRec *pRec = TRACE_RING_REC(pRing, uTail, pMap->uRingRecs);
+            S8  aParams[TRACE_RING_MAX_PARAMS * 11 + 1];
+            U32 uLen = 0;
+            U32 i, j, k;
+
+            if (*(volatile U32 *)&pRec->uSeq != uTail + 1)
+            {
+                break;
+            }
+            TI_SMP_RMB();
+
+            aParams[0] = '\0';
+            for (i = 0; i < pRec->uParamsNum; i++)
+            {
+                uLen += os_sprintf(&aParams[uLen], (PS8)" 0x%x", pRec->aParams[i]);
+            }
+
+            CU_CMD_FIND_NAME_ARRAY(j, report_module, pRec->uFileId);
+            CU_CMD_FIND_NAME_ARRAY(k, report_severity, pRec->uLevel);
+            os_error_printf(CU_MSG_INFO2, (PS8)"%d %u.%06u %s(%d) %s:%s%s\n", 
+                            uRing, 
+                            (U32)(pRec->uTimeStamp / 1000000), (U32)(pRec->uTimeStamp % 1000000),
+                            (j < SIZE_ARR(report_module)) ? report_module[j].name : (PS8)"?", 
+                            pRec->uLineNum,
+                            (k < SIZE_ARR(report_severity)) ? report_severity[k].name : (PS8)"?", 
+                            aParams, 
+                            (pRec->uParamsTotal > pRec->uParamsNum) ? " ..." : "");
+
+            uTail++;
+            uRecs++;
+        }
+
+        /* Free the read records to the driver */
+        TI_SMP_MB();
+        pRing->uTail = uTail;
+
+        if (pRing->uDrops)
+        {
+            os_error_printf(CU_MSG_INFO2, (PS8)"CPU %d: %d records dropped\n", uRing, pRing->uDrops);
+        }
+    }
+
+    os_unmapFile(pMap, uMapSize);
+}
+
 VOID CuCmd_SetReportLevelCLI(THandle hCuCmd, ConParm_t parm[], U16 nParms)
 {
 #if 0 /* need to create debug logic for CLI */
@@ -218,6 +218,50 @@ S32 CuCommon_GetSetBuffer(THandle hCuCommon, U32 PrivateIoctlId, PVOID pBuffer,
     return OK;
 }
 
+/* Commands batch - the batch commands are given as an array of private commands, each with its own buffers */
+S32 CuCommon_ExecBatch(THandle hCuCommon, ti_private_cmd_t* pCmds, U32 NumCmds, PU32 pRetCodes)
+{
+    CuCommon_t* pCuCommon = (CuCommon_t*)hCuCommon;
+    S32 res;
+
+    res = IPC_STA_Private_Send(pCuCommon->hIpcSta, DRIVER_CMD_BATCH_PARAM, pCmds, NumCmds * sizeof(ti_private_cmd_t),
+                               pRetCodes, NumCmds * sizeof(U32));
+
+    if(res == EOALERR_IPC_STA_ERROR_SENDING_WEXT)
+        return ECUERR_CU_COMMON_ERROR;
+
+    return OK;
+}
+
+S32 CuCommon_SubmitBatch(THandle hCuCommon, ti_private_cmd_t* pCmds, U32 NumCmds, PU32 pBatchId)
+{
+    CuCommon_t* pCuCommon = (CuCommon_t*)hCuCommon;
+    S32 res;
+
+    res = IPC_STA_Private_Send(pCuCommon->hIpcSta, DRIVER_CMD_BATCH_ASYNC_PARAM, pCmds, NumCmds * sizeof(ti_private_cmd_t),
+                               pBatchId, sizeof(U32));
+
+    if(res == EOALERR_IPC_STA_ERROR_SENDING_WEXT)
+        return ECUERR_CU_COMMON_ERROR;
+
+    return OK;
+}
+
+S32 CuCommon_GetBatchResult(THandle hCuCommon, ti_private_cmd_t* pCmds, U32 NumCmds, PU32 pRetCodes)
+{
+    CuCommon_t* pCuCommon = (CuCommon_t*)hCuCommon;
+    S32 res;
+
+    /* call after IPC_EVENT_CMD_BATCH_DONE, with the same commands array given to CuCommon_SubmitBatch */
+    res = IPC_STA_Private_Send(pCuCommon->hIpcSta, DRIVER_CMD_BATCH_RESULT_PARAM, pCmds, NumCmds * sizeof(ti_private_cmd_t),
+                               pRetCodes, NumCmds * sizeof(U32));
+
+    if(res == EOALERR_IPC_STA_ERROR_SENDING_WEXT)
+        return ECUERR_CU_COMMON_ERROR;
+
+    return OK;
+}
+
 S32 CuCommon_Get_BssidList_Size(THandle hCuCommon, PU32 pSizeOfBssiList)
 {
     CuCommon_t* pCuCommon = (CuCommon_t*)hCuCommon;
@@ -303,6 +347,29 @@ S32 CuCommon_GetTxRxLinkStatistics(THandle hCuCommon, TLinkDataCounters *pLinkCo
     return OK;
 }
 
+S32 CuCommon_GetTxLatencyStatistics(THandle hCuCommon, TIWLN_TX_LATENCY_STATISTICS* pTxLatency, U32 doReset)
+{
+    CuCommon_t* pCuCommon = (CuCommon_t*)hCuCommon; 
+    S32 res;
+
+    res = IPC_STA_Private_Send(pCuCommon->hIpcSta, TIWLN_802_11_TX_LATENCY_STATISTICS, pTxLatency, sizeof(TIWLN_TX_LATENCY_STATISTICS),
+                                                pTxLatency, sizeof(TIWLN_TX_LATENCY_STATISTICS));
+
+    if(res == EOALERR_IPC_STA_ERROR_SENDING_WEXT)
+        return ECUERR_CU_COMMON_ERROR;
+
+    /* The Tx latency histograms are reset with the other Tx counters */
+    if(doReset)
+    {
+        res = IPC_STA_Private_Send(pCuCommon->hIpcSta, TX_CTRL_RESET_COUNTERS_PARAM, NULL, 0, 
+                                                NULL, 0);
+        if(res == EOALERR_IPC_STA_ERROR_SENDING_WEXT)
+            return ECUERR_CU_COMMON_ERROR;
+    }
+
+    return OK;      
+}
+
 S32 CuCommon_Radio_Test(THandle hCuCommon,TTestCmd* data)
 {
     CuCommon_t* pCuCommon = (CuCommon_t*)hCuCommon;
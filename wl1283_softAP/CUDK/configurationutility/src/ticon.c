@@ -340,11 +340,14 @@ static S32 TiCon_Init_Console_Menu(TiCon_t* pTiCon)
 	{
 		ConParm_t aaa[]  = { {(PS8)"Clear stats on read", CON_PARM_OPTIONAL | CON_PARM_RANGE, 0, 1, 0 }, CON_LAST_PARM };
 		Console_AddToken(pTiCon->hConsole,h, (PS8)"Txstatistics", (PS8)"Show tx statistics", (FuncToken_t) CuCmd_ShowTxStatistics, aaa );
+		Console_AddToken(pTiCon->hConsole,h, (PS8)"tXlatency", (PS8)"Show tx latency histograms", (FuncToken_t) CuCmd_ShowTxLatency, aaa );
 	}
 
 	Console_AddToken(pTiCon->hConsole, h, (PS8)"Link statistics", (PS8)"Show per link statistics", (FuncToken_t) CuCmd_ShowLinkStatistics, NULL );
 
     Console_AddToken(pTiCon->hConsole,h, (PS8)"Advanced", (PS8)"Show advanced params", (FuncToken_t) CuCmd_ShowAdvancedParams, NULL );
+    Console_AddToken(pTiCon->hConsole,h, (PS8)"Recovery", (PS8)"Show recovery statistics", (FuncToken_t) CuCmd_ShowRecoveryStats, NULL );
+    Console_AddToken(pTiCon->hConsole,h, (PS8)"Context", (PS8)"Show driver context clients statistics", (FuncToken_t) CuCmd_ShowContextStats, NULL );
 
     Console_AddToken(pTiCon->hConsole,h, (PS8)"Power consumption",  (PS8)"Show power consumption statistics", (FuncToken_t) Cucmd_ShowPowerConsumptionStats, NULL );
 	
@@ -971,6 +974,10 @@ static S32 TiCon_Init_Console_Menu(TiCon_t* pTiCon)
 		ConParm_t aaa[]  = { {(PS8)"level", CON_PARM_OPTIONAL , 0, 0, 0 }, CON_LAST_PARM };
 		Console_AddToken(pTiCon->hConsole,h1, (PS8)"Level", (PS8)"set report severity level", (FuncToken_t) CuCmd_ReportSeverityLevel, aaa );
 	}
+	{
+		ConParm_t aaa[]  = { {(PS8)"max records per CPU (0 - all)", CON_PARM_OPTIONAL , 0, 0, 0 }, CON_LAST_PARM };
+		Console_AddToken(pTiCon->hConsole,h1, (PS8)"Trace ring", (PS8)"read the driver trace rings", (FuncToken_t) CuCmd_TraceRingDump, aaa );
+	}
 	/* -------------------------------------------- Debug -------------------------------------------- */
 	
     CHK_NULL(h = (THandle) Console_AddDirExt(pTiCon->hConsole,  (THandle) NULL, (PS8)"dEbug", (PS8)"Debug features" ) );	
@@ -93,6 +93,49 @@ static TI_STATUS cmdBld_GetCurrentAssociationId (TI_HANDLE hCmdBld, TI_UINT16 *p
 static TI_STATUS cmdBld_GetArpIpAddressesTable  (TI_HANDLE hCmdBld, TIpAddr *pIpAddr, TI_UINT8 *pEnabled , EIpVer *pIpVer);
 static TI_STATUS cmdBld_JoinCmpltForReconfigCb  (TI_HANDLE hCmdBld);
 static TI_STATUS cmdBld_DummyCb                 (TI_HANDLE hCmdBld);
+static TI_BOOL   cmdBld_ConfigSeqBurst          (TCmdBld *pCmdBld);
+
+
+/* 
+ * The init sequence steps that keep the FW default unless their setting is changed at runtime,
+ *     which records them in the configuration journal (see CMD_BLD_MARK_INIT_SEQUENCE_CMD_AS_VALID): 
+ *     templates, rates, BA sessions, keys, PS, Rx data filters (classifier), triggers and join state.
+ * On recovery, these steps are replayed only if journaled.
+ */
+static const EInitSeqCmds aJournalStepsList [] =
+{
+    __CFG_RSSI_SNR_TRIGGER_0,
+    __CFG_RSSI_SNR_TRIGGER_1,
+    __CFG_RSSI_SNR_TRIGGER_2,
+    __CFG_RSSI_SNR_TRIGGER_3,
+    __CFG_RSSI_SNR_TRIGGER_4,
+    __CFG_RSSI_SNR_TRIGGER_5,
+    __CFG_RSSI_SNR_TRIGGER_6,
+    __CFG_RSSI_SNR_TRIGGER_7,
+    __CFG_MAX_TX_RETRY,
+    __CFG_TX_RATE_POLICY,
+    __CMD_BEACON_JOIN,
+    __CMD_PROBE_RESP_JOIN,
+    __CMD_PROBE_REQ_JOIN,
+    __CMD_NULL_DATA_JOIN,
+    __CMD_DISCONN_JOIN,
+    __CMD_PS_POLL_JOIN,
+    __CMD_KEEP_ALIVE_TMPL_JOIN,
+    __CFG_PREAMBLE_JOIN,
+    __CFG_HT_CAPABILITIES,
+    __CFG_HT_INFORMATION,
+    __CFG_AID,
+    __CFG_BA_SET_SESSION,
+    __CFG_KEYS,
+    __CMD_KEEP_ALIVE_PARAMS,
+    __CFG_CONN_MONIT_PARAMS,
+    __CFG_BET,
+    __CFG_CTS_PROTECTION,
+    __CFG_PS_RX_STREAMING,
+    __CFG_RX_DATA_FILTER,
+    __CMD_STA_STATE,
+    __CMD_ARP_RSP_JOIN
+};
 
 
 
@@ -113,6 +156,12 @@ TI_HANDLE cmdBld_Create (TI_HANDLE hOs)
 
     pCmdBld->hOs = hOs;
 
+    /* Mark the steps that are replayed on recovery only if journaled */
+    for (i = 0; i < sizeof(aJournalStepsList) / sizeof(aJournalStepsList[0]); i++)
+    {
+        CMD_BLD_JOURNAL_SET(pCmdBld->aJournalSteps, aJournalStepsList[i]);
+    }
+
     /* Create the Params object */
     /* make this code flat, move it to configure */
     {
@@ -325,6 +374,15 @@ static void cmdBld_ConfigFwCb (TI_HANDLE hCmdBld, TI_STATUS status, void *pData)
 
     pDmaParams->PacketMemoryPoolStart = (TI_UINT32)pMemMap->packetMemoryPoolStart;
 
+    /* Save the sequence duration, and the part since the start/join command if issued */
+    pCmdBld->tConfigFwStats.uConfigTime = os_timeStampMs (pCmdBld->hOs) - pCmdBld->uConfigStartTime;
+    if (pCmdBld->tConfigFwStats.bJoin)
+    {
+        pCmdBld->tConfigFwStats.uJoinTime = os_timeStampMs (pCmdBld->hOs) - pCmdBld->uJoinStartTime;
+    }
+
+    TRACE5(pCmdBld->hReport, REPORT_SEVERITY_INIT, "cmdBld_ConfigFwCb: %d steps, %d skipped (%d journaled), %d msec, join %d msec\n", pCmdBld->tConfigFwStats.uSteps, pCmdBld->tConfigFwStats.uSkippedSteps, pCmdBld->tConfigFwStats.uJournalSteps, pCmdBld->tConfigFwStats.uConfigTime, pCmdBld->tConfigFwStats.uJoinTime);
+
     /* Call the upper layer callback */
     (*((TConfigFwCb)pCmdBld->fConfigFwCb)) (pCmdBld->hConfigFwCb, TI_OK);
 }
@@ -335,19 +393,37 @@ static void cmdBld_ConfigFwCb (TI_HANDLE hCmdBld, TI_STATUS status, void *pData)
  ****************************************************************************
  * DESCRIPTION: Configure the WLAN firmware
  * 
- * INPUTS: None 
+ *              On recovery with the journal enabled, the steps that keep the FW default 
+ *                  are replayed only if journaled, and the steps are issued as one burst.
+ * 
+ * INPUTS: bRecovery - Indicates that the FW is configured after a recovery FW reload
  * 
  * OUTPUT: None
  * 
  * RETURNS: TI_OK or TI_NOK
  ****************************************************************************/
-TI_STATUS cmdBld_ConfigFw (TI_HANDLE hCmdBld, void *fConfigFwCb, TI_HANDLE hConfigFwCb)
+TI_STATUS cmdBld_ConfigFw (TI_HANDLE hCmdBld, TI_BOOL bRecovery, void *fConfigFwCb, TI_HANDLE hConfigFwCb)
 {
     TCmdBld        *pCmdBld = (TCmdBld *)hCmdBld;
+    TI_UINT32       uStep;
 
     pCmdBld->fConfigFwCb = fConfigFwCb;
     pCmdBld->hConfigFwCb = hConfigFwCb; 
     pCmdBld->uIniSeq = 0;
+    pCmdBld->uIniSeqPending = 0;
+    pCmdBld->bJournalReplay = bRecovery && pCmdBld->bRecoveryJournal;
+    pCmdBld->uConfigStartTime = os_timeStampMs (pCmdBld->hOs);
+
+    os_memoryZero (pCmdBld->hOs, (void *)&pCmdBld->tConfigFwStats, sizeof(TConfigFwStats));
+    pCmdBld->tConfigFwStats.bJournalReplay = pCmdBld->bJournalReplay;
+    for (uStep = 0; uStep < MAX_NUM_OF_CMDS_IN_SEQUENCE; uStep++)
+    {
+        if (CMD_BLD_JOURNAL_TST(pCmdBld->aJournalSteps, uStep) && 
+            CMD_BLD_JOURNAL_TST(pCmdBld->aConfigJournal, uStep))
+        {
+            pCmdBld->tConfigFwStats.uJournalSteps++;
+        }
+    }
     /* should be re-initialized for recovery,   pCmdBld->uLastElpCtrlMode = ELPCTRL_MODE_KEEP_AWAKE; */
 
     /* Start configuration sequence */
@@ -1830,6 +1906,9 @@ static TI_STATUS __cmd_start_join (TI_HANDLE hCmdBld)
 
     if (DB_WLAN(hCmdBld).bJoin)
     {
+        pCmdBld->tConfigFwStats.bJoin = TI_TRUE;
+        pCmdBld->uJoinStartTime = os_timeStampMs (pCmdBld->hOs);
+
         /* 
          * Replace the Join-Complete event CB by a local function.
          * Thus, the reconfig sequence will not continue until the Join is completed!
@@ -2363,6 +2442,10 @@ static const TCmdCfgFunc aCmdIniSeq [] =
  ****************************************************************************
  * DESCRIPTION: Configuration sequence engine
  * 
+ *              Each step is called back when its commands are completed.
+ *              Following steps may be issued before that (see cmdBld_ConfigSeqBurst).
+ *                  The sequence then continues when the last issued step is called back.
+ * 
  * INPUTS: None 
  * 
  * OUTPUT: None
@@ -2373,19 +2456,130 @@ TI_STATUS cmdBld_ConfigSeq (TI_HANDLE hCmdBld)
 {
     TCmdBld   *pCmdBld = (TCmdBld *)hCmdBld;
 
-    do 
+    /* Wait for all issued steps to complete (they are called back in order) */
+    if (pCmdBld->uIniSeqPending > 1)
+    {
+        pCmdBld->uIniSeqPending--;
+        return TI_OK;
+    }
+    pCmdBld->uIniSeqPending = 0;
+
+    do
     {
-        if (aCmdIniSeq [pCmdBld->uIniSeq++] == NULL)
+        do 
         {
-            return TI_NOK; 
-        }
+            if (aCmdIniSeq [pCmdBld->uIniSeq++] == NULL)
+            {
+                return TI_NOK; 
+            }
+        } 
+        while ((*aCmdIniSeq [pCmdBld->uIniSeq - 1])(hCmdBld) != TI_OK);
 
-    } 
-    while ((*aCmdIniSeq [pCmdBld->uIniSeq - 1])(hCmdBld) != TI_OK);
+        pCmdBld->uIniSeqPending++;
+        pCmdBld->tConfigFwStats.uSteps++;
+    }
+    while (cmdBld_ConfigSeqBurst (pCmdBld));
 
     return TI_OK;
 }
 
+
+/****************************************************************************
+ *                      cmdBld_ConfigSeqBurst()
+ ****************************************************************************
+ * DESCRIPTION: Check if the next sequence step may be issued without waiting
+ * 
+ *              On journal replay (recovery), all the steps are issued as one burst 
+ *                  while the CmdQueue has room, except that the steps following the
+ *                  start/join command must wait for the Join-Complete event.
+ *              Otherwise, if the FW supports multi-IE commands, the steps are issued 
+ *                  while only configure commands are queued, so the CmdQueue packs them.
+ * 
+ * INPUTS: pCmdBld - The module object 
+ * 
+ * OUTPUT: None
+ * 
+ * RETURNS: TI_TRUE if the next step may be issued
+ ****************************************************************************/
+static TI_BOOL cmdBld_ConfigSeqBurst (TCmdBld *pCmdBld)
+{
+    if (pCmdBld->bJournalReplay)
+    {
+        return (aCmdIniSeq [pCmdBld->uIniSeq - 1] != __cmd_start_join) && 
+               cmdQueue_CanQueueBurst (pCmdBld->hCmdQueue);
+    }
+
+    return cmdQueue_CanPackConfig (pCmdBld->hCmdQueue);
+}
+
+
+/****************************************************************************
+ *                      cmdBld_JournalSkipStep()
+ ****************************************************************************
+ * DESCRIPTION: Check if an init sequence step is skipped by the journal replay
+ * 
+ *              On journal replay (recovery), a step that keeps the FW default unless 
+ *                  changed (see aJournalStepsList) is skipped if it isn't journaled.
+ * 
+ * INPUTS: uStep - The init sequence step (EInitSeqCmds) 
+ * 
+ * OUTPUT: None
+ * 
+ * RETURNS: TI_TRUE if the step is skipped
+ ****************************************************************************/
+TI_BOOL cmdBld_JournalSkipStep (TI_HANDLE hCmdBld, TI_UINT32 uStep)
+{
+    TCmdBld   *pCmdBld = (TCmdBld *)hCmdBld;
+
+    if (!pCmdBld->bJournalReplay || 
+        !CMD_BLD_JOURNAL_TST(pCmdBld->aJournalSteps, uStep) || 
+        CMD_BLD_JOURNAL_TST(pCmdBld->aConfigJournal, uStep))
+    {
+        return TI_FALSE;
+    }
+
+    pCmdBld->tConfigFwStats.uSkippedSteps++;
+    return TI_TRUE;
+}
+
+
+/****************************************************************************
+ *                      cmdBld_SetRecoveryJournal()
+ ****************************************************************************
+ * DESCRIPTION: Enable or disable the journal replay on recovery
+ * 
+ * INPUTS: bEnable - If TI_TRUE, the recovery replays only the journaled settings 
+ * 
+ * OUTPUT: None
+ * 
+ * RETURNS: void
+ ****************************************************************************/
+void cmdBld_SetRecoveryJournal (TI_HANDLE hCmdBld, TI_BOOL bEnable)
+{
+    TCmdBld   *pCmdBld = (TCmdBld *)hCmdBld;
+
+    pCmdBld->bRecoveryJournal = bEnable;
+}
+
+
+/****************************************************************************
+ *                      cmdBld_GetConfigFwStats()
+ ****************************************************************************
+ * DESCRIPTION: Get the last FW configuration sequence statistics
+ * 
+ * INPUTS: None 
+ * 
+ * OUTPUT: pStats - The statistics
+ * 
+ * RETURNS: void
+ ****************************************************************************/
+void cmdBld_GetConfigFwStats (TI_HANDLE hCmdBld, TConfigFwStats *pStats)
+{
+    TCmdBld   *pCmdBld = (TCmdBld *)hCmdBld;
+
+    os_memoryCopy (pCmdBld->hOs, (void *)pStats, (void *)&pCmdBld->tConfigFwStats, sizeof(TConfigFwStats));
+}
+
 /****************************************************************************
  *                      cmdBld_FinalizeDownload()
  ****************************************************************************
@@ -246,6 +246,46 @@ TI_STATUS cmdQueue_EnableMbox (TI_HANDLE hCmdQueue);
 TI_STATUS cmdQueue_DisableMbox (TI_HANDLE hCmdQueue);
 
 
+/*
+ * \brief	Enables or disables packing consecutive configure commands
+ * 
+ * \param  hCmdQueue - Handle to CmdQueue
+ * \param  bMultiIe - TI_TRUE if the FW supports CMD_CONFIGURE_MULTI
+ * \return void
+ * 
+ * \par Description
+ * 
+ * \sa cmdQueue_CanPackConfig
+ */
+void cmdQueue_SetMultiIe (TI_HANDLE hCmdQueue, TI_BOOL bMultiIe);
+
+
+/*
+ * \brief	Check if configure commands can be queued to be packed together
+ * 
+ * \param  hCmdQueue - Handle to CmdQueue
+ * \return TI_TRUE if more configure commands may be queued without waiting
+ * 
+ * \par Description
+ * 
+ * \sa cmdQueue_SetMultiIe
+ */
+TI_BOOL cmdQueue_CanPackConfig (TI_HANDLE hCmdQueue);
+
+
+/*
+ * \brief	Check if commands can be queued as a burst
+ * 
+ * \param  hCmdQueue - Handle to CmdQueue
+ * \return TI_TRUE if more commands may be queued without waiting
+ * 
+ * \par Description
+ * 
+ * \sa cmdQueue_CanPackConfig
+ */
+TI_BOOL cmdQueue_CanQueueBurst (TI_HANDLE hCmdQueue);
+
+
 /*
  * \brief	Called when a command timeout occur
  * 
@@ -48,10 +48,14 @@
  */
 TI_HANDLE RxQueue_Create        (TI_HANDLE hOs);
 TI_STATUS RxQueue_Destroy       (TI_HANDLE hRxQueue);
-TI_STATUS RxQueue_Init          (TI_HANDLE hRxQueue, TI_HANDLE hReport);
+TI_STATUS RxQueue_Init          (TI_HANDLE hRxQueue, TI_HANDLE hReport, TI_HANDLE hTimerModule);
 void      RxQueue_CloseBaSession(TI_HANDLE hRxQueue, TI_UINT8 uFrameTid);
 void      RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void *aFrame);
 void      RxQueue_Register_CB   (TI_HANDLE hRxQueue, TI_UINT32 CallBackID, void *CBFunc, TI_HANDLE CBObj);
+#ifdef TI_DBG
+void      RxQueue_PrintStats    (TI_HANDLE hRxQueue);
+void      RxQueue_ClearStats    (TI_HANDLE hRxQueue);
+#endif
 
 
 #endif  /* _STA_CAP_H_ */
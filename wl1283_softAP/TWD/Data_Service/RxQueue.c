@@ -44,19 +44,29 @@
 #include "RxBuf.h"
 #include "TWDriver.h"
 #include "public_descriptors.h"
+#include "timer.h"
+
 
 /************************ static definition declaration *****************************/
-#define RX_QUEUE_ARRAY_SIZE		                            8
-#define RX_QUEUE_ARRAY_SIZE_BIT_MASK                        0x7 /* RX_QUEUE_ARRAY_SIZE -1 */
-#define RX_QUEUE_WIN_SIZE		                            RX_QUEUE_ARRAY_SIZE
 
-#define BA_SESSION_IS_A_BIGGER_THAN_B(A,B)       (((((A)-(B)) & 0xFFF) < 0x7FF) && ((A)!=(B)))
-#define BA_SESSION_IS_A_BIGGER_EQUAL_THAN_B(A,B) (((((A)-(B)) & 0xFFF) < 0x7FF))
-#define SEQ_NUM_WRAP 0x1000
-#define SEQ_NUM_MASK 0xFFF
+#define RX_QUEUE_ARRAY_SIZE		                            64  /* The reorder window bitmap width (TI_UINT64) */
+#define RX_QUEUE_ARRAY_SIZE_BIT_MASK                        0x3F /* RX_QUEUE_ARRAY_SIZE -1 */
+#define RX_QUEUE_WIN_SIZE		                            8   /* The ADDBA responder window set by the driver and FW (see qosMngr.h) */
+#define BA_SESSION_TIME_TO_SLEEP		                    (50)
+
+
+#define BA_SESSION_IS_A_BIGGER_THAN_B(A,B)                  (((((A)-(B)) & 0xFFF) < 0x7FF) && ((A)!=(B)))
+#define BA_SESSION_IS_A_BIGGER_EQUAL_THAN_B(A,B)            (((((A)-(B)) & 0xFFF) < 0x7FF))
+#define SEQ_NUM_WRAP                                        0x1000
+#define SEQ_NUM_MASK                                        0xFFF
+
+/* The window bitmap of the first uNum entries, and the window bitmap shifted by uNum entries (uNum may exceed the bitmap) */
+#define RX_QUEUE_WIN_MAP(uNum)                              (((uNum) >= RX_QUEUE_ARRAY_SIZE) ? ~(TI_UINT64)0 : (((TI_UINT64)1 << (uNum)) - 1))
+#define RX_QUEUE_SHIFT_MAP(uMap, uNum)                      (((uNum) >= RX_QUEUE_ARRAY_SIZE) ? 0 : ((uMap) >> (uNum)))
 
 
 /************************ static structures declaration *****************************/
+
 /* structure describe one entry of save packet information in the packet queue array */
 typedef struct 
 {
@@ -65,19 +75,38 @@ typedef struct
     TI_UINT16           uFrameSn;
 } TRxQueuePacketEntry;	
 
+/* Reorder statistics of one TID */
+typedef struct
+{
+    TI_UINT32           uStoredPkts;                /* Packets stored for reorder (received out of order) */
+    TI_UINT32           uMaxDepth;                  /* Max packets stored at once */
+    TI_UINT32           uHoles;                     /* Missing SNs skipped (by a later SN beyond the window, a BAR or a timeout) */
+    TI_UINT32           uTimeoutFlushes;            /* Reorder timeouts that released stored packets */
+    TI_UINT32           uReleasedRuns;              /* In-order packet chains passed to the upper layer */
+    TI_UINT32           uDuplicates;                /* Stored SNs received again (discarded) */
+} TRxQueueTidStats;
+
 /* structure describe set of data that one Tid, also including the arras himself */
 typedef struct 
 {
-    /* array packets Entries */
+    /* array packets Entries - the packet with sequence number SN is saved at index (SN % RX_QUEUE_ARRAY_SIZE) */
     TRxQueuePacketEntry aPaketsQueue [RX_QUEUE_ARRAY_SIZE];	
+    /* bit i is set if the packet with SN = ESN + i is saved */
+    TI_UINT64           uStoredMap;
+    /* number of saved packets */
+    TI_UINT32           uNumStored;
     /* TID BA state */
     TI_BOOL	            aTidBaEstablished;	              
-    /* index that winStar point on */
-    TI_UINT32 	        aWinStartArrayInex;	                    
     /* windows size */
     TI_UINT32	        aTidWinSize;
 	/* expected sequence number (ESN) */ 
     TI_UINT16	        aTidExpectedSn;
+    /* reorder timeout - runs while packets are saved, so a lost packet doesn't hold the window */
+    TI_HANDLE           hTimer;
+    TI_BOOL             bTimerRunning;
+    /* the RxQueue object (for the timer callback) */
+    TI_HANDLE           hRxQueue;
+    TRxQueueTidStats    tStats;
 } TRxQueueTidDataBase;	
 
 /* structure describe set of data that assist of manage one SA RxQueue arrays */
@@ -86,6 +115,7 @@ typedef struct
     TRxQueueTidDataBase tSa1ArrayMng [MAX_NUM_OF_802_1d_TAGS];
 } TRxQueueArraysMng;	
 
+
 /* main RxQueue structure in order to management the packets disordered array. */
 typedef struct 
 {
@@ -94,11 +124,24 @@ typedef struct
     TRxQueueArraysMng   tRxQueueArraysMng;          /* manage each Source Address RxQueue arrays */
     TPacketReceiveCb    tReceivePacketCB;           /* Receive packets CB address */
     TI_HANDLE           hReceivePacketCB_handle;    /* Receive packets CB handler */
-
+    TPacketReceiveListCb tReceivePacketListCB;      /* Receive packets chain CB address (optional) */
+    TI_HANDLE           hReceivePacketListCB_handle;/* Receive packets chain CB handler */
+    void               *aRunPackets[RX_QUEUE_ARRAY_SIZE + 1]; /* The in-order packets chain to pass up */
+    TI_UINT32           uRunLen;                    /* The number of packets in aRunPackets */
 } TRxQueue;	
 
+
 /************************ static function declaration *****************************/
+
 static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, const void *pBuffer);
+static void RxQueue_PreparePacket (TRxQueue *pRxQueue, TI_STATUS tStatus, const void *pBuffer);
+static void RxQueue_AddToRun (TRxQueue *pRxQueue, const void *pBuffer, TI_STATUS tStatus);
+static void RxQueue_PassRun (TRxQueue *pRxQueue, TRxQueueTidDataBase *pTidDataBase);
+static void RxQueue_MoveWindow (TRxQueue *pRxQueue, TRxQueueTidDataBase *pTidDataBase, TI_UINT16 uNewWinStartSn);
+static void RxQueue_UpdateTimer (TRxQueueTidDataBase *pTidDataBase, TI_BOOL bWinStartMoved);
+static TI_UINT32 RxQueue_TrailingOnes (TI_UINT64 uMap);
+static void RxQueue_PacketTimeOut (TI_HANDLE hTidDataBase, TI_BOOL bTwdInitOccured);
+
 
 /** 
  * \fn     RxQueue_Create() 
@@ -143,12 +186,31 @@ TI_HANDLE RxQueue_Create (TI_HANDLE hOs)
  */ 
 TI_STATUS RxQueue_Destroy (TI_HANDLE hRxQueue)
 {
-    TRxQueue *pRxQueue = (TRxQueue *)hRxQueue;
+    TRxQueue *pRxQueue;
+    TI_UINT32 uTid;
+    
+    if (hRxQueue)
+    {
+        pRxQueue = (TRxQueue *)hRxQueue;
 
-    /* free module object */
-	os_memoryFree (pRxQueue->hOs, pRxQueue, sizeof(TRxQueue));
-	
-    return TI_OK;
+        for (uTid = 0; uTid < MAX_NUM_OF_802_1d_TAGS; uTid++)
+        {
+            TRxQueueTidDataBase *pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uTid]);
+
+            if (pTidDataBase->hTimer) 
+            {
+                tmr_DestroyTimer (pTidDataBase->hTimer);
+                pTidDataBase->hTimer = NULL;
+            }
+        }
+
+        /* free module object */
+        os_memoryFree (pRxQueue->hOs, pRxQueue, sizeof(TRxQueue));
+
+        return TI_OK;
+    }
+    
+    return TI_NOK;
 }
 
 
@@ -156,19 +218,35 @@ TI_STATUS RxQueue_Destroy (TI_HANDLE hRxQueue)
  * \fn     RxQueue_Init() 
  * \brief  Init required handles 
  * 
- * Init required handles and module variables.
+ * Init required handles and module variables, and create the TIDs reorder timers.
  * 
  * \note    
  * \param  hRxQueue - The module object
  * \param  hReport - Report module Handles
+ * \param  hTimerModule - Timer module Handles
  * \return TI_OK on success or TI_NOK on failure  
  * \sa     
  */ 
-TI_STATUS RxQueue_Init (TI_HANDLE hRxQueue, TI_HANDLE hReport)
+TI_STATUS RxQueue_Init (TI_HANDLE hRxQueue, TI_HANDLE hReport, TI_HANDLE hTimerModule)
 {
 	TRxQueue *pRxQueue = (TRxQueue *)hRxQueue;
-    
-    pRxQueue->hReport   = hReport;
+    TI_UINT32 uTid;
+
+
+    pRxQueue->hReport = hReport;
+
+    for (uTid = 0; uTid < MAX_NUM_OF_802_1d_TAGS; uTid++)
+    {
+        TRxQueueTidDataBase *pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uTid]);
+
+        pTidDataBase->hRxQueue = hRxQueue;
+        pTidDataBase->hTimer   = tmr_CreateTimer (hTimerModule);
+        if (pTidDataBase->hTimer == NULL)
+        {
+            TRACE1(pRxQueue->hReport, REPORT_SEVERITY_ERROR , "RxQueue_Init: Failed to create timer for TID %d\n", uTid);
+            return TI_NOK;
+        }
+    }
 
 	return TI_OK;
 }
@@ -178,7 +256,8 @@ TI_STATUS RxQueue_Init (TI_HANDLE hRxQueue, TI_HANDLE hReport)
  * \fn     RxQueue_Register_CB()
  * \brief  Register the function to be called for received Rx.
  * 
- * \note   
+ * \note   If TWD_INT_RECEIVE_PACKET_LIST is registered, the in-order packets chains released 
+ *         from the reorder window are passed to it in one call.
  * \param  hRxQueue - The module object
  * \param  CallBackID - event ID
  * \param  CBFunc - function address.
@@ -199,12 +278,18 @@ void RxQueue_Register_CB (TI_HANDLE hRxQueue, TI_UINT32 uCallBackID, void *CBFun
         pRxQueue->hReceivePacketCB_handle = CBObj;
         break;
 
+    case TWD_INT_RECEIVE_PACKET_LIST:
+        pRxQueue->tReceivePacketListCB = (TPacketReceiveListCb)CBFunc;
+        pRxQueue->hReceivePacketListCB_handle = CBObj;
+        break;
+
     default:
         TRACE0(pRxQueue->hReport, REPORT_SEVERITY_ERROR , "RxQueue_Register_CB: Illegal value\n");
         break;
     }
 }
 
+
 /**
  * \fn     RxQueue_CloseBaSession ()
  * \brief  Close BA session receiver and pass all packets in the TID queue to upper layer.
@@ -217,11 +302,10 @@ void RxQueue_Register_CB (TI_HANDLE hRxQueue, TI_UINT32 uCallBackID, void *CBFun
  */ 
 void RxQueue_CloseBaSession(TI_HANDLE hRxQueue, TI_UINT8 uFrameTid)
 {
-    TRxQueue            *pRxQueue     = (TRxQueue *)hRxQueue;
-    TI_UINT32            i;
-    /*set the SA Tid pointer */
-    TRxQueueTidDataBase *pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uFrameTid]);
-    
+    TRxQueue            *pRxQueue = (TRxQueue *)hRxQueue;
+    TRxQueueTidDataBase *pTidDataBase;
+    TI_UINT32            uHoles;
+
     /* TID illegal value ? */
     if (uFrameTid >= MAX_NUM_OF_802_1d_TAGS)
     {
@@ -230,67 +314,79 @@ void RxQueue_CloseBaSession(TI_HANDLE hRxQueue, TI_UINT8 uFrameTid)
         return;
     }
 
+    /* Set the SA Tid pointer */
+    pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uFrameTid]);
+
     if(pTidDataBase->aTidBaEstablished == TI_TRUE)
     {
-        /* clean BA session */
+        /* Clean BA session */
         pTidDataBase->aTidBaEstablished = TI_FALSE;
 
-        /* pass all valid entries at the array */ 
-        for (i = 0; (i < RX_QUEUE_ARRAY_SIZE) && (i < RX_QUEUE_WIN_SIZE); i++)
-        {
-            if (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)
-            {
-                RxQueue_PassPacket (pRxQueue, 
-                                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
+        /* Pass all saved packets in order (the window is moved beyond the last one) */ 
+        /* The session is closed, so the missing packets are not counted as holes */
+        uHoles = pTidDataBase->tStats.uHoles;
+        RxQueue_MoveWindow (pRxQueue, pTidDataBase, (TI_UINT16)((pTidDataBase->aTidExpectedSn + RX_QUEUE_ARRAY_SIZE) & SEQ_NUM_MASK));
+        RxQueue_PassRun (pRxQueue, pTidDataBase);
+        pTidDataBase->tStats.uHoles = uHoles;
 
-                pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-            }
-
-            pTidDataBase->aWinStartArrayInex ++;
-
-            /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-            pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-        }
+        /* If timer is started - stop it */
+        RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
     }
 }
 
 
 /** 
- * \fn     RxQueue_PassPacket()
- * \brief  Responsible on decode packet parameters and pass it to upper layer.
+ * \fn     RxQueue_PreparePacket()
+ * \brief  Decode packet parameters before passing it to upper layer.
  *
  * \note   
- * \param  hRxQueue - RxQueue handle.
- * \param  aStatus - RxXfer status that indicate if the upper layer should free the packet or use it.
- * \param  pFrame - paket address of the packet
- * \param  pRxParams - address to structure of the Rx Descriptor received by FW.
- * \return TI_OK on success or TI_NOK on failure 
- * \sa     
+ * \param  pRxQueue  - RxQueue handle.
+ * \param  aStatus   - RxXfer status that indicate if the upper layer should free the packet or use it.
+ * \param  pBuffer   - paket address of the packet
+ * \return void
+ * \sa     RxQueue_PassPacket
  */ 
-static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, const void *pBuffer)
+static void RxQueue_PreparePacket (TRxQueue *pRxQueue, TI_STATUS tStatus, const void *pBuffer)
 {
-
-    TRxQueue            *pRxQueue   = (TRxQueue *)hRxQueue;
-
     if (tStatus == TI_OK)
     {
         /* Get the mac header location in the packet Buffer */
         dot11_header_t *pMacHdr = (dot11_header_t *)(TI_UINT8*)RX_BUF_DATA(pBuffer);
 
         /* Handle endian for the frame control fields */
-        pMacHdr->fc  = ENDIAN_HANDLE_WORD(pMacHdr->fc);
+        pMacHdr->fc       = ENDIAN_HANDLE_WORD(pMacHdr->fc);
         pMacHdr->duration = ENDIAN_HANDLE_WORD(pMacHdr->duration);
-        pMacHdr->seqCtrl = ENDIAN_HANDLE_WORD(pMacHdr->seqCtrl);
+        pMacHdr->seqCtrl  = ENDIAN_HANDLE_WORD(pMacHdr->seqCtrl);
 
     }
     else
     {
-        RxIfDescriptor_t    *pRxParams  = (RxIfDescriptor_t*)pBuffer;
+        RxIfDescriptor_t *pRxParams = (RxIfDescriptor_t*)pBuffer;
 
         pRxParams->status &= ~RX_DESC_STATUS_MASK;
         pRxParams->status |= RX_DESC_STATUS_DRIVER_RX_Q_FAIL;
     }
+}
+
+
+/** 
+ * \fn     RxQueue_PassPacket()
+ * \brief  Responsible on decode packet parameters and pass it to upper layer.
+ *
+ * \note   
+ * \param  hRxQueue  - RxQueue handle.
+ * \param  aStatus   - RxXfer status that indicate if the upper layer should free the packet or use it.
+ * \param  pFrame    - paket address of the packet
+ * \param  pRxParams - address to structure of the Rx Descriptor received by FW.
+ * \return TI_OK on success or TI_NOK on failure 
+ * \sa     
+ */ 
+static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, const void *pBuffer)
+{
+    TRxQueue *pRxQueue = (TRxQueue *)hRxQueue;
+
+
+    RxQueue_PreparePacket (pRxQueue, tStatus, pBuffer);
 
     TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION , "RxQueue_PassPacket: call TWD_OWNER_RX_QUEUE CB. In std rxData_ReceivePacket()\n");
   
@@ -303,40 +399,225 @@ static TI_STATUS RxQueue_PassPacket (TI_HANDLE hRxQueue, TI_STATUS tStatus, cons
 }
 
 
+/** 
+ * \fn     RxQueue_AddToRun()
+ * \brief  Add a packet to the in-order packets chain
+ *
+ * The chain is passed to the upper layer by RxQueue_PassRun.
+ *
+ * \note   
+ * \param  pRxQueue     - RxQueue handle.
+ * \param  pBuffer      - paket address of the packet
+ * \param  aStatus      - RxXfer status that indicate if the upper layer should free the packet or use it.
+ * \return void
+ * \sa     RxQueue_PassRun
+ */ 
+static void RxQueue_AddToRun (TRxQueue *pRxQueue, const void *pBuffer, TI_STATUS tStatus)
+{
+    RxQueue_PreparePacket (pRxQueue, tStatus, pBuffer);
+
+    pRxQueue->aRunPackets[pRxQueue->uRunLen++] = (void *)pBuffer;
+}
+
+
+/** 
+ * \fn     RxQueue_PassRun()
+ * \brief  Pass the in-order packets chain to the upper layer
+ *
+ * Release the window head run of saved packets (found by the trailing ones of the window bitmap),
+ *     and pass it with any packets added before in one call.
+ *
+ * \note   If the packets chain CB is not registered, the packets are passed one by one
+ * \param  pRxQueue     - RxQueue handle.
+ * \param  pTidDataBase - The TID
+ * \return void
+ * \sa     RxQueue_AddToRun
+ */ 
+static void RxQueue_PassRun (TRxQueue *pRxQueue, TRxQueueTidDataBase *pTidDataBase)
+{
+    TI_UINT32 uRun = RxQueue_TrailingOnes (pTidDataBase->uStoredMap);
+    TI_UINT32 uNumPkts;
+    TI_UINT32 i;
+
+    /* Release the saved packets run at the window head */
+    for (i = 0; i < uRun; i++)
+    {
+        TRxQueuePacketEntry *pEntry = &pTidDataBase->aPaketsQueue[(pTidDataBase->aTidExpectedSn + i) & RX_QUEUE_ARRAY_SIZE_BIT_MASK];
+
+        RxQueue_AddToRun (pRxQueue, pEntry->pPacket, pEntry->tStatus);
+        pEntry->pPacket = NULL;
+    }
+    pTidDataBase->uStoredMap      = RX_QUEUE_SHIFT_MAP (pTidDataBase->uStoredMap, uRun);
+    pTidDataBase->uNumStored     -= uRun;
+    pTidDataBase->aTidExpectedSn  = (pTidDataBase->aTidExpectedSn + uRun) & SEQ_NUM_MASK;
+
+    uNumPkts = pRxQueue->uRunLen;
+    if (uNumPkts == 0)
+    {
+        return;
+    }
+    pRxQueue->uRunLen = 0;
+    pTidDataBase->tStats.uReleasedRuns++;
+
+    TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_PassRun: pass %d packets, aTidExpectedSn = %d\n", uNumPkts, pTidDataBase->aTidExpectedSn);
+
+    /* if the packet status not success it will be discarded */
+    if ((uNumPkts > 1) && (pRxQueue->tReceivePacketListCB != NULL))
+    {
+        pRxQueue->tReceivePacketListCB (pRxQueue->hReceivePacketListCB_handle, pRxQueue->aRunPackets, uNumPkts);
+    }
+    else
+    {
+        for (i = 0; i < uNumPkts; i++)
+        {
+            pRxQueue->tReceivePacketCB (pRxQueue->hReceivePacketCB_handle, pRxQueue->aRunPackets[i]);
+        }
+    }
+}
+
+
+/** 
+ * \fn     RxQueue_MoveWindow()
+ * \brief  Move the window start forward, and add the saved packets before it to the in-order chain
+ *
+ * The missing packets before the new window start are counted as holes.
+ *
+ * \note   The chain is passed by RxQueue_PassRun (with the run at the new window start)
+ * \param  pRxQueue       - RxQueue handle.
+ * \param  pTidDataBase   - The TID
+ * \param  uNewWinStartSn - The new window start (higher than the ESN)
+ * \return void
+ * \sa     RxQueue_PassRun
+ */ 
+static void RxQueue_MoveWindow (TRxQueue *pRxQueue, TRxQueueTidDataBase *pTidDataBase, TI_UINT16 uNewWinStartSn)
+{
+    TI_UINT32 uDelta = (uNewWinStartSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK;
+    TI_UINT64 uMap   = pTidDataBase->uStoredMap & RX_QUEUE_WIN_MAP(uDelta);
+    TI_UINT32 uNumPkts = 0;
+
+    /* Add the saved packets before the new window start in order (their offsets are the set bits) */
+    while (uMap)
+    {
+        TI_UINT32 uOffset = RxQueue_TrailingOnes (~uMap);
+        TRxQueuePacketEntry *pEntry = &pTidDataBase->aPaketsQueue[(pTidDataBase->aTidExpectedSn + uOffset) & RX_QUEUE_ARRAY_SIZE_BIT_MASK];
+
+        RxQueue_AddToRun (pRxQueue, pEntry->pPacket, pEntry->tStatus);
+        pEntry->pPacket = NULL;
+        uMap &= uMap - 1;
+        uNumPkts++;
+    }
+
+    /* The holes within the window (a BAR may move the window much further) */
+    pTidDataBase->tStats.uHoles  += ((uDelta < pTidDataBase->aTidWinSize) ? uDelta : pTidDataBase->aTidWinSize) - uNumPkts;
+
+    pTidDataBase->uStoredMap      = RX_QUEUE_SHIFT_MAP (pTidDataBase->uStoredMap, uDelta);
+    pTidDataBase->uNumStored     -= uNumPkts;
+    pTidDataBase->aTidExpectedSn  = uNewWinStartSn;
+}
+
+
+/** 
+ * \fn     RxQueue_UpdateTimer()
+ * \brief  Start, restart or stop the TID reorder timer
+ *
+ * The timer runs while packets are saved. It is restarted when the window start moves.
+ *
+ * \note   
+ * \param  pTidDataBase   - The TID
+ * \param  bWinStartMoved - TI_TRUE if the window start moved since the timer was started
+ * \return void
+ * \sa     RxQueue_PacketTimeOut
+ */ 
+static void RxQueue_UpdateTimer (TRxQueueTidDataBase *pTidDataBase, TI_BOOL bWinStartMoved)
+{
+    if (pTidDataBase->uStoredMap == 0)
+    {
+        if (pTidDataBase->bTimerRunning)
+        {
+            tmr_StopTimer (pTidDataBase->hTimer);
+            pTidDataBase->bTimerRunning = TI_FALSE;
+        }
+    }
+    else if (!pTidDataBase->bTimerRunning || bWinStartMoved)
+    {
+        if (pTidDataBase->bTimerRunning)
+        {
+            tmr_StopTimer (pTidDataBase->hTimer);
+        }
+        tmr_StartTimer (pTidDataBase->hTimer, RxQueue_PacketTimeOut, (TI_HANDLE)pTidDataBase, BA_SESSION_TIME_TO_SLEEP, TI_FALSE);
+        pTidDataBase->bTimerRunning = TI_TRUE;
+    }
+}
+
+
+/** 
+ * \fn     RxQueue_TrailingOnes()
+ * \brief  Count the trailing (least significant) set bits of a window bitmap
+ *
+ * \note   For the trailing zeros use the inverted bitmap
+ * \param  uMap - The bitmap
+ * \return The number of consecutive set bits from bit 0 (0 - 64)
+ * \sa     
+ */ 
+static TI_UINT32 RxQueue_TrailingOnes (TI_UINT64 uMap)
+{
+#if defined(__GNUC__)
+    return (~uMap) ? (TI_UINT32)__builtin_ctzll (~uMap) : RX_QUEUE_ARRAY_SIZE;
+#else
+    /* The trailing ones of each 4 bits value */
+    static const TI_UINT8 aTrailingOnes[16] = { 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0, 4 };
+    TI_UINT32 uCount = 0;
+
+    while (((uMap & 0xF) == 0xF) && (uCount < RX_QUEUE_ARRAY_SIZE))
+    {
+        uMap >>= 4;
+        uCount += 4;
+    }
+    return (uCount < RX_QUEUE_ARRAY_SIZE) ? uCount + aTrailingOnes[uMap & 0xF] : uCount;
+#endif
+}
+
+
 /** 
  * \fn     RxQueue_ReceivePacket()
  * \brief  Main function of the RxQueue module. 
  * Responsible on reorder of the packets from the RxXfer to the RX module.
  * Call from RxXfer in order to pass packet to uppers layers.
  * In order to save disordered packets the module use array of structures per TID 
- * that each entry describe a packet. The array elements is sorted in the way that 
- * the winStart array index represent always the winStar packet and the lowest SN. 
- * Each increment index represent index at the BA window. Array index winEnd  always 
- * represent winEnd packet. The indexes of winStart and winEnd handled in cyclic manner.
+ * that each entry describe a packet. The packet with sequence number SN is saved at 
+ * array index (SN % RX_QUEUE_ARRAY_SIZE), and a 64 bits bitmap per TID holds the saved
+ * packets relative to the window start (bit 0 is the expected SN). The in-order run at the
+ * window start is the bitmap trailing ones, and it is passed to the upper layers as one chain.
+ *
+ * SN range      :  0 - 4095
+ * winSize       :  Determined by the BA session. We limit it to maximum 8 [RX_QUEUE_WIN_SIZE]
+ * winEnd        :  = winStart + winSize - 1
+ *
  * The function functionality devided to parts:
  *   Part 1: 
- * in case the modulo receive packet with SN equal to winStart: 
- * "	pass it to upper layers
- * "	increases winStart and array index winStart
- * "	validate that all sequential queue packet are pass to the upper layers.
+ * In case the module received a packet with SN equal to the expected SN: 
+ * "	pass it to upper layers with all sequential saved packets, and move winStart after them.
  *   Part 2: 
- * in case the modulo receive packet that SN between winStart to winEnd: 
- * "	Save it sorted at the array at index: Save index = ((SN - winStart) + index array winStart) % arraySize.
+ * In case the module received a packet with SN between winStart to winEnd: 
+ * "	Save it at the array and set its bit.
  *   Part 3: 
- * in case the modulo receive packet that SN higher then winEnd: 
+ * In case the module received a packet with SN higher than winEnd: 
  * "	Update winStart and WinEnd. 
- * "	Save it sorted at the array in index winEnd index.
- * "	Pass to the upper layers all packets at the array indexes from old winStart index to the updated winStart index.
+ * "	Pass to the upper layers all packets saved before the updated winStart.
+ * "	Save it at winEnd and pass the sequential saved packets from the updated winStart.
  *   Part 4 + 5: 
- * in case the modulo receive BA event packet: 
+ * In case the module received a BA event packet: [Remember: This is an Rx module - We expect BAR and not BA (as well as ADDBE / DELBA]
  * "	Update winStart and WinEnd 
- * "	Pass to the upper layers all packets at the array indexes from old winStart index to the updated winStart index.
+ * "	Pass to the upper layers all packets saved before the updated winStart.
  * "	Free BA event packet via pass it to upper layers with error status.
  *
+ * If packets are saved for BA_SESSION_TIME_TO_SLEEP msec without the window start moving,
+ *     the TID timer skips the missing packets and passes the next run (see RxQueue_PacketTimeOut).
+ *
  * \note   
  * \param  hRxQueue - RxQueue handle.
  * \param  aStatus - RxXfer status that indicate if the upper layer should free the packet or use it.
- * \param  pBuffer - paket address of the packet
+ * \param  pBuffer - paket address of the packet [contains the RxIfDescriptor_t added by the FW].
  * \return None 
  * \sa     
  */ 
@@ -345,19 +626,26 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
     TRxQueue            *pRxQueue   = (TRxQueue *)hRxQueue;
     RxIfDescriptor_t    *pRxParams  = (RxIfDescriptor_t*)pBuffer;
     TI_UINT8            *pFrame     = RX_BUF_DATA((TI_UINT8 *)pBuffer);
-    TI_STATUS           tStatus     = TI_OK;
+    TI_STATUS            tStatus    = TI_OK;
     dot11_header_t      *pHdr       = (dot11_header_t *)pFrame;
-    TI_UINT16		    uQosControl;
+    TI_UINT16		     uQosControl;
+
 
     COPY_WLAN_WORD(&uQosControl, &pHdr->qosControl); /* copy with endianess handling. */
 
+    TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: packet_class_tag = 0x%x(%d)",pRxParams->packet_class_tag,pRxParams->packet_class_tag);
+
+
     /* 
-     * Retrieving the TAG from the packet itself and not from the Rx Descriptor since by now it is not correct  
+     * Retrieving the TAG from the packet itself and not from the Rx Descriptor since by now it is not correct.
+     * If the packet is a QoS packet but the tag is not TAG_CLASS_QOS_DATA or TAG_CLASS_AMSDU - force TAG_CLASS_QOS_DATA or TAG_CLASS_AMSDU.
+     *
      * Note: in the DR TAG_CLASS_EAPOL packet handled as TAG_CLASS_QOS_DATA   
      */
     if (IS_QOS_FRAME(*(TI_UINT16*)pFrame) && (pRxParams->packet_class_tag != TAG_CLASS_QOS_DATA) && (pRxParams->packet_class_tag != TAG_CLASS_AMSDU))
 	{
-        TRACE1(pRxQueue->hReport, REPORT_SEVERITY_WARNING, "RxQueue_ReceivePacket: BAD CLASS TAG =0x%x from FW.\n", pRxParams->packet_class_tag);
+        TRACE1(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: BAD CLASS TAG =0x%x from FW.\n", pRxParams->packet_class_tag);
+
 		
         /* Get AMSDU bit from frame */
         if( uQosControl & DOT11_QOS_CONTROL_FIELD_A_MSDU_BITS)
@@ -370,22 +658,27 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
         }
 	}
 
+
+
     /* 
      * packet doesn't need reorder ? 
      */
+
     if ((pRxParams->packet_class_tag != TAG_CLASS_QOS_DATA) && (pRxParams->packet_class_tag != TAG_CLASS_BA_EVENT) && (pRxParams->packet_class_tag != TAG_CLASS_AMSDU))
     {
         TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION , "RxQueue_ReceivePacket: pass packet without reorder.\n");
         
-        RxQueue_PassPacket (pRxQueue, tStatus, pBuffer);
+        RxQueue_PassPacket (pRxQueue, TI_OK, pBuffer);
 
         return;
     }
 
 
+
     /* 
      * pRxParams->type == TAG_CLASS_QOS_DATA ? 
      */
+    
     if ((pRxParams->packet_class_tag == TAG_CLASS_QOS_DATA) || (pRxParams->packet_class_tag == TAG_CLASS_AMSDU))
     {
         TI_UINT8            uFrameTid;
@@ -397,6 +690,9 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
         /* Get TID from frame */
         uFrameTid = uQosControl & DOT11_QOS_CONTROL_FIELD_TID_BITS;
 
+        TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: QoS Packet received");
+        TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: uFrameTid = 0x%x(%d)",uFrameTid,uFrameTid);
+
         /* TID illegal value ? */
         if (uFrameTid >= MAX_NUM_OF_802_1d_TAGS)
         {
@@ -407,70 +703,57 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
             return;
         }
 
-        /*set the SA Tid pointer */
+        /* Set the SA Tid pointer */
         pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uFrameTid]);
 
         /* TID legal value */
-        /* packet TID BA not established ? */ 
+        /* Packet TID BA session not established ? */ 
         if (pTidDataBase->aTidBaEstablished != TI_TRUE)
         {
             TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: pass packet without reorder.\n");
 
-            RxQueue_PassPacket (pRxQueue, tStatus, pBuffer);
+            RxQueue_PassPacket (pRxQueue, TI_OK, pBuffer);
 
             return;
         }
 
-        /* packet TID BA established */
+
+        /* If we got here - Packet TID BA established */
+
         /* Get Sequence Number from frame */
         COPY_WLAN_WORD(&uSequenceControl, &pHdr->seqCtrl); /* copy with endianess handling. */
         uFrameSn = (uSequenceControl & DOT11_SC_SEQ_NUM_MASK) >> 4;
 
+        TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: uFrameSn = 0x%x(%d)", uFrameSn, uFrameSn);
+        TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aTidExpectedSn = 0x%x(%d)",pTidDataBase->aTidExpectedSn, pTidDataBase->aTidExpectedSn);
+
         /* 
-         * note: 
-         * the FW never send paket, in establish TID BA, that the SN less then ESN !!! 
+         * Note: 
+         * The FW never sends packet, in establish TID BA, with SN less than ESN !!! 
          */
 
-        /* frame Sequence Number is the expected one ? */
+
+
+        /* Part 1 - Received Frame Sequence Number is the expected one ? */
         if (uFrameSn == pTidDataBase->aTidExpectedSn)
         {
             TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: frame Sequence Number == expected one Sequence Number.\n");
 
-            /* pass the packet */
-            RxQueue_PassPacket (pRxQueue, tStatus, pBuffer);
+            /* Pass the packet with all saved queue consecutive packets with SN higher than the expected one */
+            RxQueue_AddToRun (pRxQueue, pBuffer, tStatus);
+            pTidDataBase->aTidExpectedSn = (pTidDataBase->aTidExpectedSn + 1) & SEQ_NUM_MASK;
+            pTidDataBase->uStoredMap >>= 1;
+            RxQueue_PassRun (pRxQueue, pTidDataBase);
 
-            pTidDataBase->aTidExpectedSn++;
-            pTidDataBase->aTidExpectedSn &= 0xfff;
-
-            /* increase the ArrayInex to the next */
-            pTidDataBase->aWinStartArrayInex++;
-
-            /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-            pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-
-            /* pass all saved queue packets with SN higher then the expected one */
-            while (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)
-            {
-                RxQueue_PassPacket (pRxQueue, 
-                                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
-
-                pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-
-                pTidDataBase->aWinStartArrayInex++;
-
-                /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-                pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-
-                 pTidDataBase->aTidExpectedSn++;
-				 pTidDataBase->aTidExpectedSn &= 0xfff;
-            }
+            /* If there are still packets stored in the queue - restart the timer, else stop it */
+            RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
 
             return;
         }
 
-        /* frame Sequence Number is lower then Expected sequence number (ISN) ? */ 
-        if (! BA_SESSION_IS_A_BIGGER_THAN_B (uFrameSn, pTidDataBase->aTidExpectedSn))
+
+        /* Frame Sequence Number is lower than Expected sequence number (ISN) ? */ 
+        if (! BA_SESSION_IS_A_BIGGER_THAN_B (uFrameSn, pTidDataBase->aTidExpectedSn))			
         {
 			/* WLAN_OS_REPORT(("%s: ERROR - SN=%u is less than ESN=%u\n", __FUNCTION__, uFrameSn, pTidDataBase->aTidExpectedSn)); */
 			
@@ -482,157 +765,128 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
             return;
         }
 
-        /* frame Sequence Number between winStart and winEnd ? */
-        if ((BA_SESSION_IS_A_BIGGER_THAN_B (uFrameSn, pTidDataBase->aTidExpectedSn)) &&
-            /* mean: uFrameSn <= pTidDataBase->aTidExpectedSn + pTidDataBase->aTidWinSize) */
-            ( ! BA_SESSION_IS_A_BIGGER_THAN_B (uFrameSn,(pTidDataBase->aTidExpectedSn + pTidDataBase->aTidWinSize - 1))))
+
+        /* Part 2 - Frame Sequence Number between winStart and winEnd ? */
+        /* mean: uFrameSn <= pTidDataBase->aTidExpectedSn + pTidDataBase->aTidWinSize - 1) [the offset handles the SN wrap around] */
+        if (((uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK) < pTidDataBase->aTidWinSize)
         {
-            TI_UINT16 uSaveInex = pTidDataBase->aWinStartArrayInex + (TI_UINT16)((uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK);  
-            /* uSaveInex % RX_QUEUE_ARRAY_SIZE */
-            uSaveInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK; 
-
-          
-			if (pTidDataBase->aPaketsQueue[uSaveInex].pPacket == NULL)
-			{
-                /* save the packet in the queue */
-                pTidDataBase->aPaketsQueue[uSaveInex].tStatus = tStatus;
-                pTidDataBase->aPaketsQueue[uSaveInex].pPacket = (void *)pBuffer;
-                pTidDataBase->aPaketsQueue[uSaveInex].uFrameSn = uFrameSn;
-			}
-			else
-			{
- 				 TRACE1(pRxQueue->hReport, REPORT_SEVERITY_ERROR, "RxQueue_ReceivePacket: frame Sequence has allready saved. uFrameSn = %d\n",uFrameSn);
-
-				 RxQueue_PassPacket (pRxQueue, TI_NOK, pBuffer);
-				 return;
-			}
-            return;
-        }
+            TI_UINT32 uOffset    = (uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK;
+            TI_UINT64 uBit       = (TI_UINT64)1 << uOffset;
+            TI_UINT32 uSaveIndex = uFrameSn & RX_QUEUE_ARRAY_SIZE_BIT_MASK;
 
+            TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: frame Sequence Number between winStart and winEnd.\n");
+            TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: uSaveIndex = 0x%x(%d)",uSaveIndex,uSaveIndex);
 
-        /* 
-        frame Sequence Number higher then winEnd ? 
-        */
-        if ( BA_SESSION_IS_A_BIGGER_THAN_B (uFrameSn, (pTidDataBase->aTidExpectedSn + pTidDataBase->aTidWinSize - 1)) )
-        {
-            TI_UINT32 i;
-            TI_UINT16 uNewWinStartSn = (uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidWinSize + 1) & SEQ_NUM_MASK;
-            TI_UINT16 uSaveInex;
-            
-			TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: frame Sequence Number higher then winEnd.\n");
+            /* Before storing packet in queue, make sure the place in the queue is vacant */
+            if (pTidDataBase->uStoredMap & uBit)
+            {
+                TRACE1(pRxQueue->hReport, REPORT_SEVERITY_ERROR, "RxQueue_ReceivePacket: frame Sequence has already saved. uFrameSn = %d\n", uFrameSn);
 
-            /* increase the ArrayInex to the next */
-            pTidDataBase->aWinStartArrayInex++;
+                pTidDataBase->tStats.uDuplicates++;
+                RxQueue_PassPacket (pRxQueue, TI_NOK, pBuffer);
+                return;
+            }
 
-            /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-            pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
+            TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Enter packet to Reorder Queue");
 
-            /* update the Expected SN since the current one is lost */
-            pTidDataBase->aTidExpectedSn++;
-            pTidDataBase->aTidExpectedSn &= 0xFFF;
+            /* Store the packet in the queue */
+            pTidDataBase->aPaketsQueue[uSaveIndex].tStatus  = tStatus;
+            pTidDataBase->aPaketsQueue[uSaveIndex].pPacket  = (void *)pBuffer;
+            pTidDataBase->aPaketsQueue[uSaveIndex].uFrameSn = uFrameSn;
+            pTidDataBase->uStoredMap |= uBit;
+            pTidDataBase->uNumStored++;
 
-            /* pass all saved queue packets with SN lower then the new win start */
-            for (i = 0;
-                 BA_SESSION_IS_A_BIGGER_THAN_B(uNewWinStartSn,pTidDataBase->aTidExpectedSn) && 
-                  (i < RX_QUEUE_ARRAY_SIZE) && 
-                  (i < pTidDataBase->aTidWinSize);
-                 i++)
+            pTidDataBase->tStats.uStoredPkts++;
+            if (pTidDataBase->uNumStored > pTidDataBase->tStats.uMaxDepth)
             {
-                if (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)
-                {
-                    RxQueue_PassPacket (pRxQueue, 
-                                        pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                        pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
+                pTidDataBase->tStats.uMaxDepth = pTidDataBase->uNumStored;
+            }
 
-                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-                }
+            /* Start Timer [only if timer is not already started] */
+            RxQueue_UpdateTimer (pTidDataBase, TI_FALSE);
+
+            return;
+        }
 
-                pTidDataBase->aWinStartArrayInex++;
 
-                /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-                pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
+        /* 
+        Part 3 - Frame Sequence Number higher than winEnd ? 
+        */
+        {
+            TI_UINT16 uNewWinStartSn = (uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidWinSize + 1) & SEQ_NUM_MASK;
+            TI_UINT32 uSaveIndex     = uFrameSn & RX_QUEUE_ARRAY_SIZE_BIT_MASK;
 
-                pTidDataBase->aTidExpectedSn++;
-                pTidDataBase->aTidExpectedSn &= 0xFFF;
+            TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: frame Sequence Number higher than winEnd.\n");
+            TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: uNewWinStartSn = 0x%x(%d)",uNewWinStartSn,uNewWinStartSn);
 
-            }
+            /* Pass all saved queue packets with SN lower than the new win start (the missing ones are lost) */
+            RxQueue_MoveWindow (pRxQueue, pTidDataBase, uNewWinStartSn);
 
-            /* Calculate the new Expected SN */
-            if (i == pTidDataBase->aTidWinSize)
+            if (pTidDataBase->aTidExpectedSn == uFrameSn)
             {
-                pTidDataBase->aTidExpectedSn = uNewWinStartSn;
+                /* Window of one packet - pass the current packet */
+                RxQueue_AddToRun (pRxQueue, pBuffer, tStatus);
+                pTidDataBase->aTidExpectedSn = (pTidDataBase->aTidExpectedSn + 1) & SEQ_NUM_MASK;
             }
             else
             {
-                /* Incase the uWinStartDelta lower than aTidWinSize check if ther are packets stored in Array */
-                while (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL) {
-                    RxQueue_PassPacket (pRxQueue, 
-                                            pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                            pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
-    
-                    pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-    
-                    pTidDataBase->aWinStartArrayInex++;
-    
-                    /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-                    pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-    
-                    pTidDataBase->aTidExpectedSn++;
-                    pTidDataBase->aTidExpectedSn &= 0xFFF;
+                TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: Enter current packet to Reorder Queue, uSaveIndex = 0x%x(%d)", uSaveIndex, uSaveIndex);
+
+                /* Save the packet in the last entry of the window */
+                pTidDataBase->aPaketsQueue[uSaveIndex].tStatus  = tStatus;
+                pTidDataBase->aPaketsQueue[uSaveIndex].pPacket  = (void *)pBuffer;
+                pTidDataBase->aPaketsQueue[uSaveIndex].uFrameSn = uFrameSn;
+                pTidDataBase->uStoredMap |= (TI_UINT64)1 << (pTidDataBase->aTidWinSize - 1);
+                pTidDataBase->uNumStored++;
+
+                pTidDataBase->tStats.uStoredPkts++;
+                if (pTidDataBase->uNumStored > pTidDataBase->tStats.uMaxDepth)
+                {
+                    pTidDataBase->tStats.uMaxDepth = pTidDataBase->uNumStored;
                 }
             }
 
-            if(pTidDataBase->aTidExpectedSn == uFrameSn)
-            {
-                /* pass the packet */
-                RxQueue_PassPacket (pRxQueue, tStatus, pBuffer);
-                pTidDataBase->aTidExpectedSn++;
-				pTidDataBase->aTidExpectedSn &= 0xfff; 
-            }
-            else
-            {
-                uSaveInex = pTidDataBase->aWinStartArrayInex + (TI_UINT16)((uFrameSn + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK);  
+            /* Pass the packets before the new win start with the saved run at it */
+            RxQueue_PassRun (pRxQueue, pTidDataBase);
 
-				/* uSaveInex % RX_QUEUE_ARRAY_SIZE */
-				uSaveInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK; 
+            TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: aTidExpectedSn = 0x%x(%d)",pTidDataBase->aTidExpectedSn,pTidDataBase->aTidExpectedSn);
 
-				/* save the packet in the last entry of the queue */
-				pTidDataBase->aPaketsQueue[uSaveInex].tStatus = tStatus;
-				pTidDataBase->aPaketsQueue[uSaveInex].pPacket = (void *)pBuffer;
-				pTidDataBase->aPaketsQueue[uSaveInex].pPacket = (void *)pBuffer;
-            }
+            /* If there are still packets stored in the queue - restart the timer, else stop it */
+            RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
 
             return;
         }
     }
 
 
+
     /* 
      * BA event ? 
      */
+    
     if (pRxParams->packet_class_tag == TAG_CLASS_BA_EVENT)
     {
+
         TRxQueueTidDataBase *pTidDataBase;
         TI_UINT8            *pDataFrameBody;
         TI_UINT16           ufc;
         TI_UINT8            uFrameTid;
         TI_UINT16           uStartingSequenceNumber;
-        TI_UINT16           uWinStartDelta;
         TI_UINT16           uBarControlField;
         TI_UINT16           uBaStartingSequenceControlField;
         TI_UINT16           uBAParameterField;         
-        TI_UINT32           i;
 
-        /* Get sub type from frame */
+        
+        /* Get the frame's sub type from its header */
         COPY_WLAN_WORD(&ufc, &pHdr->fc); /* copy with endianess handling. */
 
-        /* get the type to BA event */
+        /* Get the type to BA event */
         switch ((dot11_Fc_Sub_Type_e)(ufc & DOT11_FC_SUB_MASK))
         {
         case DOT11_FC_SUB_BAR:
 
             TRACE0(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION , "RxQueue_ReceivePacket: BA event - BAR frame.\n");
-
+            
             /* get pointer to the frame body */
             pDataFrameBody = pFrame + sizeof(dot11_BarFrameHeader_t);
 
@@ -650,7 +904,7 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
                 return;
             }
 
-            /* set the SA Tid pointer */
+            /* Set the SA Tid pointer */
             pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uFrameTid]);
 
             /* TID legal value */
@@ -669,33 +923,16 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
             COPY_WLAN_WORD (&uBaStartingSequenceControlField, (TI_UINT16 *)pDataFrameBody); /* copy with endianess handling. */
             uStartingSequenceNumber = (uBaStartingSequenceControlField & DOT11_SC_SEQ_NUM_MASK) >> 4;
 
-            /* Starting Sequence Number is higher then winStart ? */
+            
+            /* Starting Sequence Number is higher than Expcted SN ? */
             if ( BA_SESSION_IS_A_BIGGER_THAN_B (uStartingSequenceNumber, pTidDataBase->aTidExpectedSn) )
             {
-                uWinStartDelta = (uStartingSequenceNumber + SEQ_NUM_WRAP - pTidDataBase->aTidExpectedSn) & SEQ_NUM_MASK;
-
-                /* pass all saved queue packets with SN lower then the new win start */
-                for (i = 0;
-                     ((i < uWinStartDelta) || (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)) &&
-                      (i < RX_QUEUE_ARRAY_SIZE) && 
-                      (i < RX_QUEUE_WIN_SIZE);
-                     i++)
-                {
-                    if (pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket != NULL)
-                    {
-                        RxQueue_PassPacket (pRxQueue, 
-                                            pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].tStatus,
-                                            pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket);
-
-                        pTidDataBase->aPaketsQueue[pTidDataBase->aWinStartArrayInex].pPacket = NULL;
-                    }
+                /* Pass all saved queue packets with SN lower than the new win start, and the saved run at it */
+                RxQueue_MoveWindow (pRxQueue, pTidDataBase, uStartingSequenceNumber);
+                RxQueue_PassRun (pRxQueue, pTidDataBase);
 
-                    pTidDataBase->aWinStartArrayInex++;
-
-                    /* aWinStartArrayInex % RX_QUEUE_ARRAY_SIZE */
-                    pTidDataBase->aWinStartArrayInex &= RX_QUEUE_ARRAY_SIZE_BIT_MASK;
-                }
-                pTidDataBase->aTidExpectedSn = uStartingSequenceNumber;
+                /* If there are still packets stored - restart the timer, else stop it */
+                RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
             }
             break;
 
@@ -704,19 +941,20 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
             /* get pointer to the frame body */
             pDataFrameBody = pFrame + sizeof(dot11_mgmtHeader_t);
 
+            
             /* get Action field from BA action frame */
             pDataFrameBody++;
             switch(*pDataFrameBody)
             {
             case DOT11_BA_ACTION_ADDBA:
 
-                TRACE0( pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: BA event - ADDBA frame.\n");
-
+                
                 /* get TID field and winSize from ADDBA action frame */
                 pDataFrameBody = pDataFrameBody + 2;
                 COPY_WLAN_WORD(&uBAParameterField, (TI_UINT16 *)pDataFrameBody); /* copy with endianess handling. */
                 uFrameTid = (uBAParameterField & DOT11_BA_PARAMETER_SET_FIELD_TID_BITS) >> 2;
 
+                
                 /* TID illegal value ? */
                 if (uFrameTid >= MAX_NUM_OF_802_1d_TAGS)
                 {
@@ -741,13 +979,14 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
                     return;
                 }
 
+                /* get winSize from ADDBA action frame */
                 /* get winSize from ADDBA action frame */
                 pTidDataBase->aTidWinSize = (uBAParameterField & DOT11_BA_PARAMETER_SET_FIELD_WINSIZE_BITS) >> 6; 
 
                 /* winSize illegal value ? */ 
-                if (pTidDataBase->aTidWinSize > RX_QUEUE_WIN_SIZE)
+                if ((pTidDataBase->aTidWinSize > RX_QUEUE_WIN_SIZE) || (pTidDataBase->aTidWinSize == 0))
                 {
-                    /* In case the win Size is higher then 8 the driver and the FW set it to 8 and inform the AP in ADDBA respond */
+                    /* In case the win Size is higher than 8 (or not set) the driver and the FW set it to 8 and inform the AP in ADDBA respond */
                     pTidDataBase->aTidWinSize = RX_QUEUE_WIN_SIZE;
                 }
 
@@ -759,15 +998,15 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
                 pDataFrameBody = pDataFrameBody + 4;
                 COPY_WLAN_WORD (&uStartingSequenceNumber, (TI_UINT16 *)pDataFrameBody); /* copy with endianess handling. */
                 pTidDataBase->aTidExpectedSn = (uStartingSequenceNumber & DOT11_SC_SEQ_NUM_MASK) >> 4;
-                pTidDataBase->aWinStartArrayInex = 0;
+                pTidDataBase->uStoredMap = 0;
+                pTidDataBase->uNumStored = 0;
                 os_memoryZero (pRxQueue->hOs, pTidDataBase->aPaketsQueue, sizeof (TRxQueuePacketEntry) * RX_QUEUE_ARRAY_SIZE);
 
                 break;
 
             case DOT11_BA_ACTION_DELBA:
 
-                TRACE0( pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_ReceivePacket: BA event - DELBA frame.\n");
-
+                
                 /* get TID field and winSize from ADDBA action frame */
                 pDataFrameBody = pDataFrameBody + 2;
                 COPY_WLAN_WORD(&uBAParameterField, (TI_UINT16 *)pDataFrameBody); /* copy with endianess handling. */
@@ -819,10 +1058,106 @@ void RxQueue_ReceivePacket (TI_HANDLE hRxQueue, const void * pBuffer)
 
     }
 
-    TRACE1(pRxQueue->hReport, REPORT_SEVERITY_ERROR, "RxQueue_ReceivePacket: unknow type tag. tag = %d\n", pRxParams->packet_class_tag);
-
     RxQueue_PassPacket (pRxQueue, tStatus, pBuffer);
 
     return;
 }
 
+
+/*
+Function Name : RxQueue_PacketTimeOut
+
+Description   : This function sends all consecutive old packets stored in a specific TID queue to the upper layer.
+
+                This function is called on the TID timer wake up. 
+                [The timer is started when we have stored packets in the TID queue].
+                The missing packets before the first stored one are considered lost (counted as holes).
+                
+
+Parameters    : hTidDataBase    - A handle to the TID queue structure.
+                bTwdInitOccured - Not used.
+
+Returned Value: void
+*/
+static void RxQueue_PacketTimeOut (TI_HANDLE hTidDataBase, TI_BOOL bTwdInitOccured)
+{
+    TRxQueueTidDataBase *pTidDataBase = (TRxQueueTidDataBase *)hTidDataBase;
+    TRxQueue            *pRxQueue     = (TRxQueue *)pTidDataBase->hRxQueue;
+    TI_UINT32            uNumMissing;
+
+    pTidDataBase->bTimerRunning = TI_FALSE;
+
+    if (pTidDataBase->uStoredMap) 
+    {
+        /* Skip to the first stored packet */
+        uNumMissing = RxQueue_TrailingOnes (~pTidDataBase->uStoredMap);
+        pTidDataBase->uStoredMap    >>= uNumMissing;
+        pTidDataBase->aTidExpectedSn  = (pTidDataBase->aTidExpectedSn + uNumMissing) & SEQ_NUM_MASK;
+        pTidDataBase->tStats.uHoles  += uNumMissing;
+        pTidDataBase->tStats.uTimeoutFlushes++;
+
+        TRACE2(pRxQueue->hReport, REPORT_SEVERITY_INFORMATION, "RxQueue_PacketTimeOut: skipped %d missing packets, aTidExpectedSn = %d\n", uNumMissing, pTidDataBase->aTidExpectedSn);
+
+        /* Send all consecutive packets in order */
+        RxQueue_PassRun (pRxQueue, pTidDataBase);
+    }
+
+    /* If there are still packets stored in the queue - restart the timer */
+    RxQueue_UpdateTimer (pTidDataBase, TI_TRUE);
+}
+
+
+#ifdef TI_DBG
+/** 
+ * \fn     RxQueue_PrintStats
+ * \brief  Print the reorder statistics of the TIDs with BA session
+ * 
+ * \note   
+ * \param  hRxQueue - The module object
+ * \return void
+ * \sa     RxQueue_ClearStats
+ */ 
+void RxQueue_PrintStats (TI_HANDLE hRxQueue)
+{
+#ifdef REPORT_LOG
+    TRxQueue  *pRxQueue = (TRxQueue *)hRxQueue;
+    TI_UINT32  uTid;
+
+    WLAN_OS_REPORT(("Print RX Reorder Statistics\n"));
+    WLAN_OS_REPORT(("===========================\n"));
+    WLAN_OS_REPORT(("TID BA WinSize ESN  Stored Queued MaxDepth Holes  Timeouts Runs   Duplicates\n"));
+
+    for (uTid = 0; uTid < MAX_NUM_OF_802_1d_TAGS; uTid++)
+    {
+        TRxQueueTidDataBase *pTidDataBase = &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uTid]);
+        TRxQueueTidStats    *pStats       = &pTidDataBase->tStats;
+
+        WLAN_OS_REPORT(("%-3d %-2d %-7d %-4d %-6d %-6d %-8d %-6d %-8d %-6d %d\n", 
+                        uTid, pTidDataBase->aTidBaEstablished, pTidDataBase->aTidWinSize, pTidDataBase->aTidExpectedSn,
+                        pStats->uStoredPkts, pTidDataBase->uNumStored, pStats->uMaxDepth, pStats->uHoles,
+                        pStats->uTimeoutFlushes, pStats->uReleasedRuns, pStats->uDuplicates));
+    }
+#endif
+}
+
+
+/** 
+ * \fn     RxQueue_ClearStats
+ * \brief  Clear the reorder statistics
+ * 
+ * \note   
+ * \param  hRxQueue - The module object
+ * \return void
+ * \sa     RxQueue_PrintStats
+ */ 
+void RxQueue_ClearStats (TI_HANDLE hRxQueue)
+{
+    TRxQueue  *pRxQueue = (TRxQueue *)hRxQueue;
+    TI_UINT32  uTid;
+
+    for (uTid = 0; uTid < MAX_NUM_OF_802_1d_TAGS; uTid++)
+    {
+        os_memoryZero (pRxQueue->hOs, &(pRxQueue->tRxQueueArraysMng.tSa1ArrayMng[uTid].tStats), sizeof(TRxQueueTidStats));
+    }
+}
+#endif /* TI_DBG */
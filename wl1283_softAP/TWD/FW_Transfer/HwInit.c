@@ -120,6 +120,9 @@ extern void cmdBld_FinalizeDownload (TI_HANDLE hCmdBld, TBootAttr *pBootAttr, Fw
 #define MAX_SDIO_BLOCK					(500)	
 #endif
 
+/* Max length of a multi-block firmware download transaction (further limited by the bus DMA buffer) */
+#define MAX_FW_DL_TXN_LEN               (16 * MAX_SDIO_BLOCK)
+
 #define ACX_EEPROMLESS_IND_REG        (SCR_PAD4)
 #define USE_EEPROM                    (0)
 #define SOFT_RESET_MAX_TIME           (1000000)
@@ -260,6 +263,7 @@ extern void cmdBld_FinalizeDownload (TI_HANDLE hCmdBld, TBootAttr *pBootAttr, Fw
              return TXN_STATUS_PENDING;                         \
         default:                                                \
              phwinit->DownloadStatus = status;                  \
+             hwInit_FreeFwTmpBufs (phwinit);                    \
              TWD_FinalizeOnFailure (phwinit->hTWD);             \
              return TXN_STATUS_ERROR;                           \
     }
@@ -368,8 +372,13 @@ typedef struct
     TI_UINT32               uInitSeqStage;
     TI_STATUS               uInitSeqStatus;
     TI_UINT32               uLoadStage;
-    TI_UINT32               uBlockReadNum;
-    TI_UINT32               uBlockWriteNum;
+    TI_UINT32               uFwDlOffset;        /* Image offset of the next FW download transaction */
+    TI_UINT32               uFwDlReadyLen;      /* Length already copied to the next Txn buffer (0 if not prepared yet) */
+    TI_UINT32               uFwDlBufIndex;      /* Which of aFwTmpBuf is used by the next Txn */
+    TI_UINT32               uFwDlMaxTxnLen;     /* Max FW download Txn length, from the bus DMA buffer length */
+    TI_UINT32               uFwDlStartTime;     /* Download start time in msec, for the init trace */
+    TI_UINT32               uFwDlBytes;         /* Bytes downloaded so far (over all image portions) */
+    TI_UINT32               uFwDlTxnNum;        /* Download transactions issued so far */
     TI_UINT32               uPartitionLimit;
     TI_UINT32               uFinStage;
     TI_UINT32               uFinData;
@@ -389,7 +398,7 @@ typedef struct
     TI_STATUS               uTopStatus;
 
 
-    TI_UINT8                auFwTmpBuf [WSPI_PAD_LEN_WRITE + MAX_SDIO_BLOCK];
+    TI_UINT8                *aFwTmpBuf[2];  /* Double buffer: one Txn on the bus while the next is copied */
 
     TFinalizeCb             fFinalizeDownload;
     TI_HANDLE               hFinalizeDownload;
@@ -421,6 +430,8 @@ static TI_STATUS hwInit_BootSm                      (TI_HANDLE hHwInit);
 static TI_STATUS hwInit_ResetSm                     (TI_HANDLE hHwInit);
 static TI_STATUS hwInit_EepromlessStartBurstSm      (TI_HANDLE hHwInit);                                                   
 static TI_STATUS hwInit_LoadFwImageSm               (TI_HANDLE hHwInit);
+static TI_UINT32 hwInit_PrepareFwTxn                (THwInit *pHwInit);
+static void      hwInit_FreeFwTmpBufs               (THwInit *pHwInit);
 static TI_STATUS hwInit_FinalizeDownloadSm          (TI_HANDLE hHwInit);                                             
 #ifndef FPGA_SKIP_TOP_INIT
 static TI_STATUS hwInit_TopRegisterRead(TI_HANDLE hHwInit);
@@ -525,6 +536,9 @@ TI_STATUS hwInit_Init (TI_HANDLE      hHwInit,
     pHwInit->hTwIf      = ((TTwd *)hTWD)->hTwIf;
     pHwInit->hOs        = ((TTwd *)hTWD)->hOs;
     pHwInit->fInitHwCb  = fInitHwCb;
+    pHwInit->aFwTmpBuf[0] = NULL;
+    pHwInit->aFwTmpBuf[1] = NULL;
+    pHwInit->uFwDlMaxTxnLen = MAX_SDIO_BLOCK;
     pHwInit->fFinalizeDownload 	= fFinalizeDownload;
     pHwInit->hFinalizeDownload 	= hFinalizeDownload;
 
@@ -550,6 +564,30 @@ TI_STATUS hwInit_Init (TI_HANDLE      hHwInit,
 }
 
 
+/** 
+ * \fn     hwInit_SetBusParams
+ * \brief  Set the FW download transactions length
+ * 
+ * The firmware is downloaded with multi-block transactions of up to MAX_FW_DL_TXN_LEN,
+ *     limited by the bus driver DMA buffer length (which holds a whole write transaction).
+ * 
+ * \note   Must be called before hwInit_LoadFw. If not called, a single block is used per Txn.
+ * \param  hHwInit    - The module's object
+ * \param  uDmaBufLen - The bus driver Tx DMA-able buffer length
+ * \return void
+ * \sa     hwInit_LoadFwImageSm
+ */ 
+void hwInit_SetBusParams (TI_HANDLE hHwInit, TI_UINT32 uDmaBufLen)
+{
+    THwInit *pHwInit = (THwInit *)hHwInit;
+    TI_UINT32 uTxnLen = (uDmaBufLen < MAX_FW_DL_TXN_LEN) ? uDmaBufLen : MAX_FW_DL_TXN_LEN;
+
+    /* Use whole blocks, and at least one */
+    uTxnLen -= uTxnLen % MAX_SDIO_BLOCK;
+    pHwInit->uFwDlMaxTxnLen = (uTxnLen > MAX_SDIO_BLOCK) ? uTxnLen : MAX_SDIO_BLOCK;
+}
+
+
 TI_STATUS hwInit_SetNvsImage (TI_HANDLE hHwInit, TI_UINT8 *pbuf, TI_UINT32 length)
 {
     THwInit   *pHwInit = (THwInit *)hHwInit;
@@ -636,6 +674,8 @@ TI_STATUS hwInit_Boot (TI_HANDLE hHwInit)
      * It will be set to TXN_STATUS_COMPLETE at the FinalizeDownload function 
      */
     pHwInit->DownloadStatus = TXN_STATUS_PENDING;
+    pHwInit->uFwDlBytes     = 0;
+    pHwInit->uFwDlTxnNum    = 0;
 
     /* Call the boot sequence state machine */
     pHwInit->uInitStage = 0;
@@ -2038,12 +2078,17 @@ static TI_STATUS hwInit_EepromlessStartBurstSm (TI_HANDLE hHwInit)
 /****************************************************************************
  *                      hwInit_LoadFwImageSm()
  ****************************************************************************
- * DESCRIPTION: Load image from the host and download into the hardware 
- * 
- * INPUTS:  None    
- * 
+ * DESCRIPTION: Load image from the host and download into the hardware
+ *
+ * The image portion is written with multi-block transactions, each filling as much
+ *     as possible of the current partition window (up to uFwDlMaxTxnLen).
+ * Two temporary buffers are used, so while a transaction is pending on the bus
+ *     the next one is already copied, and is sent as soon as the SM is called back.
+ *
+ * INPUTS:  None
+ *
  * OUTPUT:  None
- * 
+ *
  * RETURNS: TI_OK or TI_NOK
  ****************************************************************************/
 
@@ -2055,8 +2100,9 @@ static TI_STATUS hwInit_LoadFwImageSm (TI_HANDLE hHwInit)
     THwInit *pHwInit 			= (THwInit *)hHwInit;
     TI_STATUS status 			= TI_OK;
 	ETxnStatus	TxnStatus;
-	TI_UINT32 uMaxPartitionSize	= PARTITION_DOWN_MEM_SIZE;
     TTxnStruct* pTxn;
+    TI_UINT32   uHwAddr;
+    TI_UINT32   uTxnLen;
 
     pHwInit->uTxnIndex = 0;
 
@@ -2065,7 +2111,7 @@ static TI_STATUS hwInit_LoadFwImageSm (TI_HANDLE hHwInit)
         switch (pHwInit->uLoadStage)
         {
 		case 0:
-            pHwInit->uLoadStage = 1; 
+            pHwInit->uLoadStage = 1;
 
 			/* Check the Downloaded FW alignment */
 			if ((pHwInit->uFwLength % ADDRESS_SIZE) != 0)
@@ -2074,127 +2120,102 @@ static TI_STATUS hwInit_LoadFwImageSm (TI_HANDLE hHwInit)
 				EXCEPT_L (pHwInit, TXN_STATUS_ERROR);
 			}
 
-			TRACE2(pHwInit->hReport, REPORT_SEVERITY_INIT , "Image addr=0x%x, Len=0x%x\n", pHwInit->pFwBuf, pHwInit->uFwLength);
+			TRACE3(pHwInit->hReport, REPORT_SEVERITY_INIT , "Image addr=0x%x, Len=0x%x, TxnLen=%d\n", pHwInit->pFwBuf, pHwInit->uFwLength, pHwInit->uFwDlMaxTxnLen);
+
+            /* The first image portion starts the download time */
+            if (pHwInit->uFwDlBytes == 0)
+            {
+                pHwInit->uFwDlStartTime = os_timeStampMs (pHwInit->hOs);
+            }
 
 	/* Set bus memory partition to current download area */
            SET_FW_LOAD_PARTITION(pHwInit->aPartition,pHwInit->uFwAddress)
            hwInit_SetPartition (pHwInit,pHwInit->aPartition);
-            status = TI_OK;
-			break;
+           pHwInit->uPartitionLimit = pHwInit->uFwAddress + PARTITION_DOWN_MEM_SIZE;
 
-        case 1:
+           pHwInit->aFwTmpBuf[0] = os_memoryAlloc (pHwInit->hOs, WSPI_PAD_LEN_WRITE + pHwInit->uFwDlMaxTxnLen);
+           pHwInit->aFwTmpBuf[1] = os_memoryAlloc (pHwInit->hOs, WSPI_PAD_LEN_WRITE + pHwInit->uFwDlMaxTxnLen);
 
-			pHwInit->uLoadStage = 2;
-			/* if initial size is smaller than MAX_SDIO_BLOCK - go strait to stage 4 to write partial block */
-			if (pHwInit->uFwLength < MAX_SDIO_BLOCK)
-			{
-				pHwInit->uLoadStage = 4; 
-			}
+           if ((NULL == pHwInit->aFwTmpBuf[0]) || (NULL == pHwInit->aFwTmpBuf[1]))
+           {
+                TRACE0(pHwInit->hReport, REPORT_SEVERITY_ERROR , "hwInit_LoadFwImageSm(): Can not allocate buffers for pHwInit->aFwTmpBuf\n" );
+                EXCEPT_L (pHwInit, TXN_STATUS_ERROR);
+           }
 
-			pHwInit->uBlockReadNum 		= 0;
-			pHwInit->uBlockWriteNum 	= 0;
-			pHwInit->uPartitionLimit 	= pHwInit->uFwAddress + uMaxPartitionSize;
+           pHwInit->uFwDlOffset   = 0;
+           pHwInit->uFwDlReadyLen = 0;
+           pHwInit->uFwDlBufIndex = 0;
 
-            continue;
-                    
-        case 2:
+           status = TI_OK;
+			break;
 
-            /* Load firmware by blocks */
- 			if (pHwInit->uBlockReadNum < (pHwInit->uFwLength / MAX_SDIO_BLOCK))
-            {            
-                pHwInit->uLoadStage = 3;
-
-                /* Change partition */
-				/* The +2 is for the last block and the block remainder */  
-				if ( ((pHwInit->uBlockWriteNum + 2) * MAX_SDIO_BLOCK + pHwInit->uFwAddress) > pHwInit->uPartitionLimit)
-                {                					
-					pHwInit->uFwAddress += pHwInit->uBlockWriteNum * MAX_SDIO_BLOCK;
-					/* update uPartitionLimit */
-					pHwInit->uPartitionLimit = pHwInit->uFwAddress + uMaxPartitionSize;
-                    /* Set bus memory partition to current download area */
-                    SET_FW_LOAD_PARTITION(pHwInit->aPartition,pHwInit->uFwAddress)
-                    hwInit_SetPartition (pHwInit,pHwInit->aPartition);
-                    TxnStatus = TXN_STATUS_OK;
-					pHwInit->uBlockWriteNum = 0;
-                    TRACE1(pHwInit->hReport, REPORT_SEVERITY_INIT , "Change partition to address offset = 0x%x\n", 									   pHwInit->uFwAddress + pHwInit->uBlockWriteNum * MAX_SDIO_BLOCK);
-                    EXCEPT_L (pHwInit, TxnStatus);                                                     
-                }
+        case 1:
+
+            /* Load firmware by multi-block transactions */
+            uHwAddr = pHwInit->uFwAddress + pHwInit->uFwDlOffset;
+
+            /* Change partition when the current window is full */
+            if (uHwAddr >= pHwInit->uPartitionLimit)
+            {
+                pHwInit->uPartitionLimit = uHwAddr + PARTITION_DOWN_MEM_SIZE;
+                /* Set bus memory partition to current download area */
+                SET_FW_LOAD_PARTITION(pHwInit->aPartition, uHwAddr)
+                hwInit_SetPartition (pHwInit,pHwInit->aPartition);
+                TRACE1(pHwInit->hReport, REPORT_SEVERITY_INIT , "Change partition to address offset = 0x%x\n", uHwAddr);
             }
-            else
+
+            /* Copy the chunk, unless it was already copied while the previous Txn was pending */
+            if (pHwInit->uFwDlReadyLen == 0)
             {
-                pHwInit->uLoadStage = 4;
-                TRACE0(pHwInit->hReport, REPORT_SEVERITY_INIT , "Load firmware with Portions\n");
+                pHwInit->uFwDlReadyLen = hwInit_PrepareFwTxn (pHwInit);
             }
-            continue;
+            uTxnLen = pHwInit->uFwDlReadyLen;
 
-        case 3:        
-            pHwInit->uLoadStage = 2;
+            /* Load the chunk. Save WSPI_PAD_LEN_WRITE space for WSPI bus command */
+             BUILD_HW_INIT_FW_DL_TXN(pHwInit, pTxn, uHwAddr,
+                                     (pHwInit->aFwTmpBuf[pHwInit->uFwDlBufIndex] + WSPI_PAD_LEN_WRITE), uTxnLen, TXN_DIRECTION_WRITE,
+                                     (TTxnDoneCb)hwInit_LoadFwImageSm, hHwInit)
 
-            pHwInit->uTxnIndex = 0;
+            pHwInit->uFwDlOffset   += uTxnLen;
+            pHwInit->uFwDlReadyLen  = 0;
+            pHwInit->uFwDlBufIndex ^= 1;
+            pHwInit->uFwDlBytes    += uTxnLen;
+            pHwInit->uFwDlTxnNum++;
 
-            /* Copy image block to temporary buffer */
-            os_memoryCopy (pHwInit->hOs,
-                           (void *)&pHwInit->auFwTmpBuf[WSPI_PAD_LEN_WRITE],
-						   (void *)(pHwInit->pFwBuf + pHwInit->uBlockReadNum * MAX_SDIO_BLOCK),
-						   MAX_SDIO_BLOCK);
+            /* After the last chunk is completed, finish the portion */
+            if (pHwInit->uFwDlOffset >= pHwInit->uFwLength)
+            {
+                pHwInit->uLoadStage = 2;
+            }
 
-            /* Load the block. Save WSPI_PAD_LEN_WRITE space for WSPI bus command */
-             BUILD_HW_INIT_FW_DL_TXN(pHwInit, pTxn, (pHwInit->uFwAddress + pHwInit->uBlockWriteNum * MAX_SDIO_BLOCK),
-                                     (pHwInit->auFwTmpBuf + WSPI_PAD_LEN_WRITE), MAX_SDIO_BLOCK, TXN_DIRECTION_WRITE,
-                                     (TTxnDoneCb)hwInit_LoadFwImageSm, hHwInit)
             TxnStatus = twIf_Transact(pHwInit->hTwIf, pTxn);
 
             /* Log ERROR if the transaction returned ERROR */
             if (TxnStatus == TXN_STATUS_ERROR)
             {
                 TRACE1(pHwInit->hReport, REPORT_SEVERITY_ERROR , "hwInit_LoadFwImageSm: twIf_Transact retruned status=0x%x\n", TxnStatus);
-            } 
-
-			pHwInit->uBlockWriteNum ++;
-			pHwInit->uBlockReadNum ++;
-            EXCEPT_L (pHwInit, TxnStatus);
-            continue;
-
-        case 4:    
-			pHwInit->uLoadStage 	= 5;
-
-            pHwInit->uTxnIndex = 0;
-
-			/* If No Last block to write */
-			if ( pHwInit->uFwLength % MAX_SDIO_BLOCK == 0 )
-			{
-				continue;
-			}
-
-
-            /* Copy the last image block */
-             os_memoryCopy (pHwInit->hOs,
-                           (void *)&pHwInit->auFwTmpBuf[WSPI_PAD_LEN_WRITE],
-						   (void *)(pHwInit->pFwBuf + pHwInit->uBlockReadNum * MAX_SDIO_BLOCK),
-						   pHwInit->uFwLength % MAX_SDIO_BLOCK);
-
-            /* Load the last block */
-             BUILD_HW_INIT_FW_DL_TXN(pHwInit, pTxn, (pHwInit->uFwAddress + pHwInit->uBlockWriteNum * MAX_SDIO_BLOCK),
-                                     (pHwInit->auFwTmpBuf + WSPI_PAD_LEN_WRITE), (pHwInit->uFwLength % MAX_SDIO_BLOCK), TXN_DIRECTION_WRITE,
-                                     (TTxnDoneCb)hwInit_LoadFwImageSm, hHwInit)
-            TxnStatus = twIf_Transact(pHwInit->hTwIf, pTxn);
+            }
 
-            if (TxnStatus == TXN_STATUS_ERROR)
-			{
-                TRACE1(pHwInit->hReport, REPORT_SEVERITY_ERROR , "hwInit_LoadFwImageSm: last block retruned status=0x%x\n", TxnStatus);
-			}
+            /* While the Txn is on the bus, copy the next chunk to the other buffer */
+            else if ((TxnStatus == TXN_STATUS_PENDING) && (pHwInit->uLoadStage == 1))
+            {
+                pHwInit->uFwDlReadyLen = hwInit_PrepareFwTxn (pHwInit);
+            }
 
             EXCEPT_L (pHwInit, TxnStatus);
             continue;
 
-        case 5:
+        case 2:
             pHwInit->uLoadStage = 0;
 
+            hwInit_FreeFwTmpBufs (pHwInit);
+
 			/*If end of overall FW Download Process: Finalize download (run firmware)*/
 			if ( pHwInit->bFwBufLast == TI_TRUE )
-			{			
-				/* The download has completed */ 
+			{
+				/* The download has completed */
 				WLAN_OS_REPORT (("Finished downloading firmware.\n"));
+                TRACE3(pHwInit->hReport, REPORT_SEVERITY_INIT , "FW download: %d bytes in %d transactions, %d msec\n", pHwInit->uFwDlBytes, pHwInit->uFwDlTxnNum, os_timeStampMs (pHwInit->hOs) - pHwInit->uFwDlStartTime);
 				status = hwInit_FinalizeDownloadSm (hHwInit);
 			}
 			/* Have to wait to more FW Portions */
@@ -2216,6 +2237,66 @@ static TI_STATUS hwInit_LoadFwImageSm (TI_HANDLE hHwInit)
 
 } /* hwInit_LoadFwImageSm() */
 
+
+/**
+ * \fn     hwInit_PrepareFwTxn
+ * \brief  Copy the next FW download chunk to its Txn buffer
+ *
+ * The chunk starts at uFwDlOffset and is limited by the max Txn length, the image portion end
+ *     and the partition window end (a new window starts where the current one is full).
+ *
+ * \note   The chunk is copied to aFwTmpBuf[uFwDlBufIndex], after WSPI_PAD_LEN_WRITE bytes.
+ * \param  pHwInit - The module's object
+ * \return The chunk length
+ * \sa     hwInit_LoadFwImageSm
+ */
+static TI_UINT32 hwInit_PrepareFwTxn (THwInit *pHwInit)
+{
+    TI_UINT32 uHwAddr = pHwInit->uFwAddress + pHwInit->uFwDlOffset;
+    TI_UINT32 uLimit  = (uHwAddr < pHwInit->uPartitionLimit) ? pHwInit->uPartitionLimit : uHwAddr + PARTITION_DOWN_MEM_SIZE;
+    TI_UINT32 uTxnLen = pHwInit->uFwDlMaxTxnLen;
+
+    if (uTxnLen > pHwInit->uFwLength - pHwInit->uFwDlOffset)
+    {
+        uTxnLen = pHwInit->uFwLength - pHwInit->uFwDlOffset;
+    }
+    if (uTxnLen > uLimit - uHwAddr)
+    {
+        uTxnLen = uLimit - uHwAddr;
+    }
+
+    os_memoryCopy (pHwInit->hOs,
+                   (void *)&pHwInit->aFwTmpBuf[pHwInit->uFwDlBufIndex][WSPI_PAD_LEN_WRITE],
+                   (void *)(pHwInit->pFwBuf + pHwInit->uFwDlOffset),
+                   uTxnLen);
+
+    return uTxnLen;
+}
+
+
+/**
+ * \fn     hwInit_FreeFwTmpBufs
+ * \brief  Free the FW download Txn buffers
+ *
+ * \note
+ * \param  pHwInit - The module's object
+ * \return void
+ * \sa     hwInit_LoadFwImageSm
+ */
+static void hwInit_FreeFwTmpBufs (THwInit *pHwInit)
+{
+    TI_UINT32 i;
+
+    for (i = 0; i < 2; i++)
+    {
+        if (NULL != pHwInit->aFwTmpBuf[i])
+        {
+            os_memoryFree (pHwInit->hOs, pHwInit->aFwTmpBuf[i], WSPI_PAD_LEN_WRITE + pHwInit->uFwDlMaxTxnLen);
+            pHwInit->aFwTmpBuf[i] = NULL;
+        }
+    }
+}
+
 #define READ_TOP_REG_LOOP  32
 #ifdef TNETW1283
 #define TOP_REG_ADDR_MASK    0x1FFF
@@ -68,6 +68,9 @@
 /* Callback function definition for Tx sendPacketComplete */
 typedef void (* TSendPacketCompleteCb)(TI_HANDLE hCbObj, TxResultDescriptor_t *pTxResultInfo);
 
+/* Callback function definition for Tx sendPacketComplete of a results list (consecutive in the results queue) */
+typedef void (* TSendPacketCompleteListCb)(TI_HANDLE hCbObj, TxResultDescriptor_t *aTxResults, TI_UINT32 uNumResults);
+
 /* Tx-Result SM states */
 typedef enum
 {
@@ -102,6 +105,8 @@ typedef struct
     ETxResultState          eState;                  /* Current eState of SM */
     TSendPacketCompleteCb   fSendPacketCompleteCb;   /* Tx-Complete callback function */
     TI_HANDLE               hSendPacketCompleteHndl; /* Tx-Complete callback function handle */
+    TSendPacketCompleteListCb fSendPacketCompleteListCb; /* Tx-Complete results list callback function (optional) */
+    TI_HANDLE               hSendPacketCompleteListHndl; /* Tx-Complete results list callback function handle */
     THostCounterWriteTxn    tHostCounterWriteTxn;    /* The structure used for writing host results counter to FW */
     TResultsInfoReadTxn     tResultsInfoReadTxn;     /* The structure used for reading Tx-results counters and table from  FW */
 #ifdef TI_DBG
@@ -349,7 +354,7 @@ static void txResult_StateMachine (TI_HANDLE hTxResult)
  * ============
  *	We now have the Tx Result table info from the FW so do as follows:
  *	1.	Find the number of new results (FW counter minus host counter), and if 0 exit.
- *  2.	Call the upper layers callback per Tx result. 
+ *  2.	Call the upper layers callback per Tx result (or per list of consecutive results, if registered). 
  *	3.	Update Host-Counter to be equal to the FW-Counter, and write it to the FW.
  ***************************************************************************/
 static void txResult_HandleNewResults (TTxResultObj *pTxResult)
@@ -357,6 +362,7 @@ static void txResult_HandleNewResults (TTxResultObj *pTxResult)
 	TI_UINT32 uNumNewResults;    /* The number of new Tx-Result entries to be processed. */
 	TI_UINT32 uFwResultsCounter; /* The FW current results counter (accumulated). */
 	TI_UINT32 uTableIndex;
+	TI_UINT32 uNumListResults;
 	TI_UINT32 i;
 	TxResultDescriptor_t *pCurrentResult;
     TTxnStruct *pTxn = &(pTxResult->tHostCounterWriteTxn.tTxnStruct);
@@ -386,6 +392,30 @@ TRACE2(pTxResult->hReport, REPORT_SEVERITY_WARNING, ": No New Results although i
 
     TRACE3(pTxResult->hReport, REPORT_SEVERITY_INFORMATION, ": NumResults=%d, OriginalHostCount=%d, FwCount=%d\n", uNumNewResults, pTxResult->uHostResultsCounter, uFwResultsCounter);
 
+    /* If registered, pass the new results to the Tx-complete list callback (one call, or two if the queue wraps around) */
+    /* NOTE: THIS SHOULD COME LAST because it may lead to driver-stop process!! */
+    if (pTxResult->fSendPacketCompleteListCb != NULL)
+    {
+        while (uNumNewResults > 0)
+        {
+            uTableIndex = pTxResult->uHostResultsCounter & TX_RESULT_QUEUE_DEPTH_MASK;
+            uNumListResults = TRQ_DEPTH - uTableIndex;
+            if (uNumListResults > uNumNewResults)
+            {
+                uNumListResults = uNumNewResults;
+            }
+            pTxResult->uHostResultsCounter += uNumListResults;
+            uNumNewResults -= uNumListResults;
+
+            TRACE2(pTxResult->hReport, REPORT_SEVERITY_INFORMATION , ": call upper layer list CB, Index = %d, Num = %d\n", uTableIndex, uNumListResults);
+
+            pTxResult->fSendPacketCompleteListCb (pTxResult->hSendPacketCompleteListHndl,
+                                                  &(pTxResult->tResultsInfoReadTxn.tTxResultInfo.TxResultQueue[uTableIndex]),
+                                                  uNumListResults);
+        }
+        return;
+    }
+
 	/* Loop over all new Tx-results and call Tx-complete callback with current entry pointer. */
     /* NOTE: THIS SHOULD COME LAST because it may lead to driver-stop process!! */
 	for (i = 0; i < uNumNewResults; i++)
@@ -418,6 +448,12 @@ void txResult_RegisterCb (TI_HANDLE hTxResult, TI_UINT32 uCallBackId, void *CBFu
             pTxResult->hSendPacketCompleteHndl = hCbObj;
             break;
 
+        /* Set Tx-Complete results list callback */
+        case TWD_INT_SEND_PACKET_COMPLETE_LIST:
+            pTxResult->fSendPacketCompleteListCb   = (TSendPacketCompleteListCb)CBFunc;
+            pTxResult->hSendPacketCompleteListHndl = hCbObj;
+            break;
+
         default:
             TRACE0(pTxResult->hReport, REPORT_SEVERITY_ERROR, ": Illegal value\n");
             return;
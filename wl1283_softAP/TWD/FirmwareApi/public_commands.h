@@ -94,6 +94,7 @@ typedef enum
     CMD_START_PERIODIC_SCAN        = 50,
     CMD_STOP_PERIODIC_SCAN         = 51,
     CMD_SET_STA_STATE              = 52,
+    CMD_CONFIGURE_MULTI            = 53,    /* configure several information elements (see below) */
 
     /* Access point commands */
     CMD_BSS_START                  = 60,
@@ -229,6 +230,35 @@ offset  length  source  description
 */
 
 
+/******************************************************************************
+
+    ID:       CMD_CONFIGURE_MULTI
+    Desc:     This command configures several information elements in the WiLink,
+              in the given order. It is sent only to firmware that supports it
+              (enabled by the CmdMboxMultiIe ini parameter).
+    Params:   ConfigureMulti_t followed by the information elements.
+    Return:   The status of each information element (CommandStatus_e), in
+              place of the parameters. The command status is CMD_STATUS_SUCCESS
+              if all elements were configured, otherwise the first failure.
+
+******************************************************************************/
+/*
+offset  length  source  description
+======  ======  ======  ===========
+0       2       host    Number of information elements (N).
+2       2       host    Reserved.
+4       ...     host    N InfoElement_t structures (see CMD_CONFIGURE), each one
+                        padded to a 32 bit boundary.
+0       2*N     wilink  The status of each information element.
+*/
+
+typedef struct
+{
+    uint16  numOfIEs;
+    uint16  reserved;
+} ConfigureMulti_t;
+
+
 /******************************************************************************
 
     ID:       CMD_ENABLE_RX
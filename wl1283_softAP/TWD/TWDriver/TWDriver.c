@@ -448,7 +448,7 @@ void TWD_Init (TI_HANDLE    hTWD,
 
     rxXfer_Init (pTWD->hRxXfer, pTWD->hFwEvent, pTWD->hReport, pTWD->hTwIf, pTWD->hRxQueue);
 
-    RxQueue_Init (pTWD->hRxQueue, pTWD->hReport);
+    RxQueue_Init (pTWD->hRxQueue, pTWD->hReport, pTWD->hTimer);
 
 #ifdef TI_DBG
     fwDbg_Init (pTWD->hFwDbg, pTWD->hReport, pTWD->hTwIf);
@@ -492,6 +492,7 @@ TI_STATUS TWD_InitHw (TI_HANDLE hTWD,
     /* Provide bus related parameters to Xfer modules before any usage of the bus! */
     rxXfer_SetBusParams (pTWD->hRxXfer, uRxDmaBufLen);
     txXfer_SetBusParams (pTWD->hTxXfer, uTxDmaBufLen);
+    hwInit_SetBusParams (pTWD->hHwInit, uTxDmaBufLen);
 
     hwInit_SetNvsImage (pTWD->hHwInit, pbuf, length);
 
@@ -817,6 +818,8 @@ TI_STATUS TWD_SetDefaults (TI_HANDLE hTWD, TTwdInitParams *pInitParams)
     rxXfer_SetDefaults (pTWD->hRxXfer, pInitParams);
     txXfer_SetDefaults (pTWD->hTxXfer, pInitParams);
     txHwQueue_Config (pTWD->hTxHwQueue, pInitParams);
+    cmdQueue_SetMultiIe (pTWD->hCmdQueue, pInitParams->tGeneral.bCmdMboxMultiIe);
+    cmdBld_SetRecoveryJournal (pTWD->hCmdBld, pInitParams->tGeneral.bRecoveryConfigJournal);
     /* Configure the rxXfer module */
     rxXfer_Config (pTWD->hRxXfer, pInitParams);
     MacServices_config (pTWD->hMacServices, pInitParams);
@@ -946,16 +949,16 @@ void TWD_CheckSRConfigParams(TTwd  *pTWD, ACXSmartReflexConfigParams_t *tSmartRe
 } */
 
 
-TI_STATUS TWD_ConfigFw (TI_HANDLE hTWD)
+TI_STATUS TWD_ConfigFw (TI_HANDLE hTWD, TI_BOOL bRecovery)
 {
     TTwd *pTWD = (TTwd *)hTWD;
 
-    TRACE0(pTWD->hReport, REPORT_SEVERITY_INIT , "TWD_ConfigFw: called\n");
+    TRACE1(pTWD->hReport, REPORT_SEVERITY_INIT , "TWD_ConfigFw: called, bRecovery=%d\n", bRecovery);
 
     /*
      * Configure the WLAN firmware after config all the hardware objects
      */
-    if (cmdBld_ConfigFw (pTWD->hCmdBld, (void *)TWD_ConfigFwCb, hTWD) != TI_OK)
+    if (cmdBld_ConfigFw (pTWD->hCmdBld, bRecovery, (void *)TWD_ConfigFwCb, hTWD) != TI_OK)
     {
         return TI_NOK;
     }
@@ -963,6 +966,13 @@ TI_STATUS TWD_ConfigFw (TI_HANDLE hTWD)
     return TI_OK;
 }
 
+void TWD_GetConfigFwStats (TI_HANDLE hTWD, TConfigFwStats *pStats)
+{
+    TTwd *pTWD = (TTwd *)hTWD;
+
+    cmdBld_GetConfigFwStats (pTWD->hCmdBld, pStats);
+}
+
 void TWD_FinalizeDownload (TI_HANDLE hTWD)
 {
     TTwd *pTWD = (TTwd *)hTWD;
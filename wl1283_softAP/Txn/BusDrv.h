@@ -53,6 +53,7 @@
 #define WSPI_PAD_LEN_WRITE          4
 #define WSPI_PAD_LEN_READ           8                    
 #define MAX_XFER_BUFS               5
+#define MAX_XFER_EXT_BUFS           32   /* Max buffers in an extended Txn (see TTxnStructExt) */
 
 #define TXN_PARAM_STATUS_OK         0
 #define TXN_PARAM_STATUS_ERROR      1
@@ -89,6 +90,7 @@
 #define TXN_PARAM_GET_STATUS(pTxn)              ( (pTxn->uTxnParams & 0x00000F00) >> 8 )
 #define TXN_PARAM_GET_AGGREGATE(pTxn)           ( (pTxn->uTxnParams & 0x00001000) >> 12 )
 #define TXN_PARAM_GET_END_OF_BURST(pTxn)        ( (pTxn->uTxnParams & 0x00002000) >> 13 )
+#define TXN_PARAM_GET_EXT_BUFS(pTxn)            ( (pTxn->uTxnParams & 0x00004000) >> 14 )
 
 
 
@@ -102,6 +104,7 @@
 #define TXN_PARAM_SET_STATUS(pTxn, uValue)      ( pTxn->uTxnParams = (pTxn->uTxnParams & ~0x00000F00) | (uValue << 8 ) )
 #define TXN_PARAM_SET_AGGREGATE(pTxn, uValue)   ( pTxn->uTxnParams = (pTxn->uTxnParams & ~0x00001000) | (uValue << 12 ) )
 #define TXN_PARAM_SET_END_OF_BURST(pTxn, uValue)( pTxn->uTxnParams = (pTxn->uTxnParams & ~0x00002000) | (uValue << 13 ) )
+#define TXN_PARAM_SET_EXT_BUFS(pTxn, uValue)    ( pTxn->uTxnParams = (pTxn->uTxnParams & ~0x00004000) | (uValue << 14 ) )
 
 
 #define TXN_PARAM_SET(pTxn, uPriority, uId, uDirection, uAddrMode) \
@@ -110,6 +113,25 @@
         TXN_PARAM_SET_DIRECTION(pTxn, uDirection); \
         TXN_PARAM_SET_FIXED_ADDR(pTxn, uAddrMode);
 
+/* Access the Txn buffers list, which continues in the TTxnStructExt if the Txn EXT_BUFS param is set */
+#define TXN_MAX_BUFS(pTxn)                      ( TXN_PARAM_GET_EXT_BUFS(pTxn) ? MAX_XFER_EXT_BUFS : MAX_XFER_BUFS )
+#define TXN_BUF_LEN(pTxn, uBufNum)              ( ((uBufNum) < MAX_XFER_BUFS) ? (pTxn)->aLen[uBufNum] : \
+                                                  ((TTxnStructExt *)(pTxn))->aExtLen[(uBufNum) - MAX_XFER_BUFS] )
+#define TXN_BUF_PTR(pTxn, uBufNum)              ( ((uBufNum) < MAX_XFER_BUFS) ? (pTxn)->aBuf[uBufNum] : \
+                                                  ((TTxnStructExt *)(pTxn))->aExtBuf[(uBufNum) - MAX_XFER_BUFS] )
+#define TXN_SET_BUF(pTxn, uBufNum, pBuf, uLen) do { \
+        if ((uBufNum) < MAX_XFER_BUFS) \
+        { \
+            (pTxn)->aBuf[uBufNum] = (TI_UINT8*)(pBuf); \
+            (pTxn)->aLen[uBufNum] = (TI_UINT16)(uLen); \
+        } \
+        else \
+        { \
+            ((TTxnStructExt *)(pTxn))->aExtBuf[(uBufNum) - MAX_XFER_BUFS] = (TI_UINT8*)(pBuf); \
+            ((TTxnStructExt *)(pTxn))->aExtLen[(uBufNum) - MAX_XFER_BUFS] = (TI_UINT16)(uLen); \
+        } \
+    } while (0)
+
 #define BUILD_TTxnStruct(pTxn, uAddr, pBuf, uLen, fCB, hCB) \
     pTxn->aBuf[0] = (TI_UINT8*)(pBuf); \
     pTxn->aLen[0] = (TI_UINT16)(uLen); \
@@ -143,8 +165,23 @@ typedef struct
                                               Zero length marks last used buffer, or MAX_XFER_BUFS of all are used. */
     TI_UINT8*    aBuf[MAX_XFER_BUFS];      /* Host data buffers to be written to or read from the device */
     TI_UINT8     aWspiPad[WSPI_PAD_LEN_READ]; /* Padding used by WSPI bus driver for its header or fixed-busy bytes */
+#ifdef TI_DBG
+    TI_UINT32    uTimeStampUs;             /* TxnQ latency statistics: time queued, and then time passed to the bus driver */
+#endif
 } TTxnStruct; 
 
+/* 
+ * The extended transactions structure - a Txn with a scatter-gather list of up to MAX_XFER_EXT_BUFS buffers.
+ * Used only with the EXT_BUFS Txn param set, and its buffers are accessed by the TXN_BUF_xxx macros.
+ * The list continues from the TTxnStruct aLen/aBuf, and ends with a zero length or after MAX_XFER_EXT_BUFS buffers.
+ */
+typedef struct
+{
+    TTxnStruct   tTxnStruct;
+    TI_UINT16    aExtLen[MAX_XFER_EXT_BUFS - MAX_XFER_BUFS];   /* Lengths of the buffers following the TTxnStruct aBuf */
+    TI_UINT8*    aExtBuf[MAX_XFER_EXT_BUFS - MAX_XFER_BUFS];   /* Host data buffers following the TTxnStruct aBuf */
+} TTxnStructExt;
+
 /* Parameters for all bus types configuration in ConnectBus process */
 
 typedef struct
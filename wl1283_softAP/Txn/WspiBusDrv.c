@@ -53,6 +53,8 @@
  ************************************************************************/
 #define WSPI_FIXED_BUSY_LEN     1
 #define WSPI_INIT_CMD_MASK      0
+#define WSPI_MAX_AGGREG_LEN     8192    /* Max length of an aggregated (multi-buffer) transaction */
+#define WSPI_AGGREG_BUF_LEN     (WSPI_PAD_LEN_READ + WSPI_MAX_AGGREG_LEN)   /* The gather buffer including the WSPI padding */
 
 
 /************************************************************************
@@ -71,7 +73,10 @@ typedef struct _TBusDrvObj
 	TI_HANDLE       hCbHandle;          /* The callback handle */
     TTxnStruct *    pCurrTxn;           /* The transaction currently being processed */
     TI_STATUS       eCurrTxnStatus;     /* COMPLETE, PENDING or ERROR */
-    TI_UINT32       uCurrTxnBufsCount;
+    TI_UINT32       uCurrTxnBufsCount;  /* Number of the current Txn buffers already transfered */
+    TI_UINT32       uCurrHwAddr;        /* The HW address for the next buffer of the current Txn */
+    TI_BOOL         bCurrTxnGathered;   /* If TI_TRUE, the current Txn buffers are transfered at once through pAggregBuf */
+    TI_UINT8 *      pAggregBuf;         /* DMA-able buffer for gathering a multi-buffer Txn to one WSPI transfer */
     TI_BOOL         bPendingByte;
     TTxnDoneCb      fTxnConnectDoneCb;         /* The callback to call upon full transaction completion. */    
     
@@ -84,6 +89,9 @@ typedef struct _TBusDrvObj
  ************************************************************************/
 
 static void asyncEnded_CB(TI_HANDLE hBusTxn, int status);
+static ETxnStatus busDrv_SendTxnBufs (TBusDrvObj *pBusDrv);
+static ETxnStatus busDrv_SendTxnGathered (TBusDrvObj *pBusDrv, TI_UINT32 uTxnLen);
+static void       busDrv_ScatterRxBufs (TBusDrvObj *pBusDrv);
 static void ConnectDone_CB(TI_HANDLE hBusDrv, int status);
 
 /************************************************************************
@@ -122,6 +130,15 @@ TI_HANDLE busDrv_Create (TI_HANDLE hOs)
 
     pBusDrv->hWspi= WSPI_Open(hOs); 
 
+    /* Allocate the buffer for gathering multi-buffer transactions (e.g. Rx and Tx aggregations) */
+    pBusDrv->pAggregBuf = os_memoryAlloc4HwDma (hOs, WSPI_AGGREG_BUF_LEN);
+    if (pBusDrv->pAggregBuf == NULL)
+    {
+        WSPI_Close(pBusDrv->hWspi);
+        os_memoryFree (hOs, pBusDrv, sizeof(TBusDrvObj));
+        return NULL;
+    }
+
     return pBusDrv;
 }
 
@@ -145,6 +162,10 @@ TI_STATUS busDrv_Destroy (TI_HANDLE hBusDrv)
     {
         // addapt to WSPI
         WSPI_Close(pBusDrv->hWspi);
+        if (pBusDrv->pAggregBuf)
+        {
+            os_memory4HwDmaFree (pBusDrv->hOs, pBusDrv->pAggregBuf, WSPI_AGGREG_BUF_LEN);
+        }
         os_memoryFree (pBusDrv->hOs, pBusDrv, sizeof(TBusDrvObj));     
     }
     return TI_OK;
@@ -197,6 +218,8 @@ void busDrv_Init (TI_HANDLE    hBusDrv,
  * \param  pBusDrvCfg - A union used for per-bus specific configuration. 
  * \param  fCbFunc    - CB function for Async transaction completion (after all txn parts are completed).
  * \param  hCbArg     - The CB function handle
+ * \param  pRxDmaBufLen - The max Rx transaction length in bytes (needed as a limit of the Rx aggregation length)
+ * \param  pTxDmaBufLen - The max Tx transaction length in bytes (needed as a limit of the Tx aggregation length)
  * \return TI_OK / TI_NOK
  * \sa     
  */ 
@@ -204,7 +227,9 @@ TI_STATUS busDrv_ConnectBus (TI_HANDLE        hBusDrv,
                              TBusDrvCfg       *pBusDrvCfg,
                              TBusDrvTxnDoneCb fCbFunc,
                              TI_HANDLE        hCbArg,
-                             TBusDrvTxnDoneCb fConnectCbFunc
+                             TBusDrvTxnDoneCb fConnectCbFunc,
+                             TI_UINT32        *pRxDmaBufLen,
+                             TI_UINT32        *pTxDmaBufLen
                              )
 {
     TBusDrvObj *pBusDrv = (TBusDrvObj*)hBusDrv;
@@ -216,6 +241,10 @@ TI_STATUS busDrv_ConnectBus (TI_HANDLE        hBusDrv,
     pBusDrv->fTxnDoneCb    = fCbFunc;
     pBusDrv->hCbHandle     = hCbArg;
     pBusDrv->fTxnConnectDoneCb = fConnectCbFunc;
+
+    /* Multi-buffer transactions are gathered to the aggregation buffer, so it limits the aggregation length */
+    *pRxDmaBufLen = WSPI_MAX_AGGREG_LEN;
+    *pTxDmaBufLen = WSPI_MAX_AGGREG_LEN;
    
     /* Configure the WSPI driver parameters  */
    
@@ -235,12 +264,12 @@ TI_STATUS busDrv_ConnectBus (TI_HANDLE        hBusDrv,
         TRACE1 (pBusDrv->hReport, REPORT_SEVERITY_INIT, "busDrv_ConnectBus: called Status %d\n",iStatus);
 
     
-        TRACE2 (pBusDrv->hReport, REPORT_SEVERITY_INFORMATION, "busDrv_ConnectBus: Successful Status %d\n",iStatus);
+        TRACE1 (pBusDrv->hReport, REPORT_SEVERITY_INFORMATION, "busDrv_ConnectBus: Successful Status %d\n",iStatus);
         return TI_OK;
     }
     else 
     {
-        TRACE2(pBusDrv->hReport, REPORT_SEVERITY_ERROR, "busDrv_ConnectBus: Status = %d,\n", iStatus);
+        TRACE1(pBusDrv->hReport, REPORT_SEVERITY_ERROR, "busDrv_ConnectBus: Status = %d,\n", iStatus);
         return TI_NOK;
     }
 }
@@ -266,66 +295,219 @@ TI_STATUS   busDrv_DisconnectBus   (TI_HANDLE hBusDrv)
  * \brief  Process transaction 
  * 
  * Called by the TxnQ module to initiate a new transaction.
- * Call either write or read functions according to Txn direction field.
+ * A single buffer Txn is transfered directly from its buffer (using its WSPI padding).
+ * A multi-buffer Txn (including an extended Txn buffers list) is gathered to one WSPI transfer 
+ *     through the aggregation buffer, like the SDIO bus driver does with its DMA buffer.
  * 
  * \note   It's assumed that this function is called only when idle (i.e. previous Txn is done).
  * \param  hBusDrv - The module's object
  * \param  pTxn    - The transaction object 
  * \return COMPLETE if Txn completed in this context, PENDING if not, ERROR if failed
- * \sa     busDrv_PrepareTxnParts, busDrv_SendTxnParts
+ * \sa     busDrv_SendTxnGathered, busDrv_SendTxnBufs
  */ 
 ETxnStatus busDrv_Transact (TI_HANDLE hBusDrv, TTxnStruct *pTxn)
 {
     TBusDrvObj *pBusDrv = (TBusDrvObj*)hBusDrv;
-    WSPI_CB_T cb;
-    TI_UINT8 * tempReadBuff;
-    TI_UINT8 * tempWriteBuff; 
-    pBusDrv->pCurrTxn       = pTxn;
-    pBusDrv->eCurrTxnStatus = TXN_STATUS_COMPLETE;  /* The Txn is Sync as long as it continues in this context */
+    TI_UINT32   uBufNum;
+    TI_UINT32   uTxnLen = 0;
+    ETxnStatus  eStatus;
+
+    pBusDrv->pCurrTxn          = pTxn;
+    pBusDrv->uCurrTxnBufsCount = 0;
+    pBusDrv->uCurrHwAddr       = pTxn->uHwAddr;
+    pBusDrv->bCurrTxnGathered  = TI_FALSE;
+
+    /* Find the total transaction length (the list ends with a zero length or after the max buffers) */
+    for (uBufNum = 0; uBufNum < TXN_MAX_BUFS(pTxn); uBufNum++)
+    {
+        if (TXN_BUF_LEN(pTxn, uBufNum) == 0)
+        {
+            break;
+        }
+        uTxnLen += TXN_BUF_LEN(pTxn, uBufNum);
+    }
+
+    /* If multiple buffers that fit in the aggregation buffer, transfer them at once */
+    if ((uBufNum > 1) && (uTxnLen <= WSPI_MAX_AGGREG_LEN))
+    {
+        eStatus = busDrv_SendTxnGathered (pBusDrv, uTxnLen);
+
+        /* If a read completed in this context, copy the data to the Txn buffers */
+        if ((eStatus == TXN_STATUS_COMPLETE) && (TXN_PARAM_GET_DIRECTION(pTxn) == TXN_DIRECTION_READ))
+        {
+            busDrv_ScatterRxBufs (pBusDrv);
+        }
+        return eStatus;
+    }
+
+    /* Send the Txn buffers and return transaction status - COMPLETE, PENDING or ERROR */
+    return busDrv_SendTxnBufs (pBusDrv);
+}
+
+
+/** 
+ * \fn     busDrv_SendTxnGathered
+ * \brief  Send the current Txn buffers in one WSPI transfer
+ * 
+ * Called by busDrv_Transact() for a multi-buffer Txn.
+ * For write, copy all the Txn buffers to the aggregation buffer after the WSPI padding, 
+ *     and transfer it at once. For read, transfer the whole length to the aggregation 
+ *     buffer (the data is copied to the Txn buffers upon completion).
+ * 
+ * \note   
+ * \param  pBusDrv - The module's object
+ * \param  uTxnLen - The total length of the Txn buffers
+ * \return COMPLETE if completed in this context, PENDING if not, ERROR if failed
+ * \sa     busDrv_Transact, busDrv_ScatterRxBufs
+ */ 
+static ETxnStatus busDrv_SendTxnGathered (TBusDrvObj *pBusDrv, TI_UINT32 uTxnLen)
+{
+    TTxnStruct *pTxn  = pBusDrv->pCurrTxn;
+    TI_UINT8   *pData = pBusDrv->pAggregBuf + WSPI_PAD_LEN_READ;  /* Leave room for the WSPI padding of both directions */
+    WSPI_CB_T   cb;
+    TI_UINT32   uBufNum;
+    TI_UINT32   uOffset = 0;
+    TI_UINT32   uBufLen;
+
     cb.CBFunc = asyncEnded_CB;  /* The BusTxn callback called upon Async transaction end. */
-    cb.CBArg  = hBusDrv;   /* The handle for the BusTxnCB. */
-  
-    /* If write command */
+    cb.CBArg  = (TI_HANDLE)pBusDrv;   /* The handle for the BusTxnCB. */
+
+    pBusDrv->bCurrTxnGathered = TI_TRUE;
+
     if (TXN_PARAM_GET_DIRECTION(pTxn) == TXN_DIRECTION_WRITE)
     {
+        /* Gather the Txn buffers to the aggregation buffer */
+        for (uBufNum = 0; uOffset < uTxnLen; uBufNum++)
+        {
+            uBufLen = TXN_BUF_LEN(pTxn, uBufNum);
+            os_memoryCopy (pBusDrv->hOs, pData + uOffset, TXN_BUF_PTR(pTxn, uBufNum), uBufLen);
+            uOffset += uBufLen;
+        }
+
+        pBusDrv->eCurrTxnStatus = WSPI_WriteAsync(pBusDrv->hWspi, pTxn->uHwAddr, pData - WSPI_PAD_LEN_WRITE, uTxnLen, &cb, TI_TRUE, TI_TRUE, TXN_PARAM_GET_FIXED_ADDR(pTxn));
+    }
+    else
+    {
+        pBusDrv->eCurrTxnStatus = WSPI_ReadAsync(pBusDrv->hWspi, pTxn->uHwAddr, pData - WSPI_PAD_LEN_READ, uTxnLen, &cb, TI_TRUE, TI_TRUE, TXN_PARAM_GET_FIXED_ADDR(pTxn));
+    }
 
-        //WLAN_REPORT_INIT(pBusDrv->hReport, TNETW_DRV_MODULE_LOG,
-        //    ("busDrv_Transact:  Write to pTxn->uHwAddr %x\n", pTxn->uHwAddr ));
-    
+    if (pBusDrv->eCurrTxnStatus == WSPI_TXN_PENDING)
+    {
+        return TXN_STATUS_PENDING;
+    }
+    if (pBusDrv->eCurrTxnStatus != WSPI_TXN_COMPLETE)
+    {
+        TRACE2(pBusDrv->hReport, REPORT_SEVERITY_ERROR, "busDrv_SendTxnGathered: Status = %d, Len = %d\n", pBusDrv->eCurrTxnStatus, uTxnLen);
+        return TXN_STATUS_ERROR;
+    }
 
-         /*WLAN_REPORT_ERROR(pBusDrv->hReport, BUS_DRV_MODULE_LOG,
-            ("busDrv_Transact: Buff= %x, Len=%d\n", pTxn->aBuf[0], pTxn->aLen[0]));*/
-        /*1.write memory*/
-          /* Decrease the data pointer to the beginning of the WSPI padding */
-          tempWriteBuff = pTxn->aBuf[0];
-          tempWriteBuff -= WSPI_PAD_LEN_WRITE;
+    return TXN_STATUS_COMPLETE;
+}
 
-          /* Write the data to the WSPI in Aync mode (not completed in the current context). */
-          pBusDrv->eCurrTxnStatus = WSPI_WriteAsync(pBusDrv->hWspi, pTxn->uHwAddr,tempWriteBuff,pTxn->aLen[0], &cb, TI_TRUE, TI_TRUE,TXN_PARAM_GET_FIXED_ADDR(pTxn));      
-          
-    }
 
-    /* If read command */
-    else 
+/** 
+ * \fn     busDrv_ScatterRxBufs
+ * \brief  Copy a gathered read data to the Txn buffers
+ * 
+ * \note   
+ * \param  pBusDrv - The module's object
+ * \return void
+ * \sa     busDrv_SendTxnGathered
+ */ 
+static void busDrv_ScatterRxBufs (TBusDrvObj *pBusDrv)
+{
+    TTxnStruct *pTxn  = pBusDrv->pCurrTxn;
+    TI_UINT8   *pData = pBusDrv->pAggregBuf + WSPI_PAD_LEN_READ;
+    TI_UINT32   uBufNum;
+    TI_UINT32   uBufLen;
+
+    for (uBufNum = 0; uBufNum < TXN_MAX_BUFS(pTxn); uBufNum++)
     {
-        //WLAN_REPORT_INIT(pBusDrv->hReport, TNETW_DRV_MODULE_LOG,
-        //    ("busDrv_Transact:  Read from pTxn->uHwAddr %x pTxn %x \n", pTxn->uHwAddr,pTxn));
+        uBufLen = TXN_BUF_LEN(pTxn, uBufNum);
 
-        /*1. Read mem */
-         /* Decrease the tempReadBuff pointer to the beginning of the WSPI padding */
-        tempReadBuff = pTxn->aBuf[0];
-        tempReadBuff -= WSPI_PAD_LEN_READ;
-        /* Read the required data from the WSPI in Aync mode (not completed in the current context). */
-        pBusDrv->eCurrTxnStatus  = WSPI_ReadAsync(pBusDrv->hWspi, pTxn->uHwAddr,tempReadBuff,pTxn->aLen[0], &cb, TI_TRUE, TI_TRUE,TXN_PARAM_GET_FIXED_ADDR(pTxn));
+        /* If no more buffers, exit the loop */
+        if (uBufLen == 0)
+        {
+            break;
+        }
 
-        
+        os_memoryCopy (pBusDrv->hOs, TXN_BUF_PTR(pTxn, uBufNum), pData, uBufLen);
+        pData += uBufLen;
     }
+}
 
-    /* return transaction status - COMPLETE, PENDING or ERROR */
-    return (pBusDrv->eCurrTxnStatus == WSPI_TXN_COMPLETE ? TXN_STATUS_COMPLETE : 
-			(pBusDrv->eCurrTxnStatus == WSPI_TXN_PENDING ? TXN_STATUS_PENDING : TXN_STATUS_ERROR));
 
-    
+/** 
+ * \fn     busDrv_SendTxnBufs
+ * \brief  Send the current Txn buffers
+ * 
+ * Called by busDrv_Transact() and by asyncEnded_CB() upon Async buffer transfer completion.
+ * Transfer the remaining buffers of the current Txn one by one (consecutive in the HW 
+ *     address space, unless fixed address), until all are done or one is pending.
+ * The WSPI header is written in the padding before each buffer.
+ * 
+ * \note   
+ * \param  pBusDrv - The module's object
+ * \return COMPLETE if all buffers completed in this context, PENDING if not, ERROR if failed
+ * \sa     busDrv_Transact, asyncEnded_CB
+ */ 
+static ETxnStatus busDrv_SendTxnBufs (TBusDrvObj *pBusDrv)
+{
+    TTxnStruct *pTxn   = pBusDrv->pCurrTxn;
+    TI_BOOL     bWrite = (TXN_PARAM_GET_DIRECTION(pTxn) == TXN_DIRECTION_WRITE) ? TI_TRUE : TI_FALSE;
+    WSPI_CB_T   cb;
+    TI_UINT8   *pBuf;
+    TI_UINT32   uBufLen;
+
+    cb.CBFunc = asyncEnded_CB;  /* The BusTxn callback called upon Async transaction end. */
+    cb.CBArg  = (TI_HANDLE)pBusDrv;   /* The handle for the BusTxnCB. */
+
+    while (pBusDrv->uCurrTxnBufsCount < TXN_MAX_BUFS(pTxn))
+    {
+        uBufLen = TXN_BUF_LEN(pTxn, pBusDrv->uCurrTxnBufsCount);
+
+        /* If no more buffers, exit the loop */
+        if (uBufLen == 0)
+        {
+            break;
+        }
+
+        pBuf = TXN_BUF_PTR(pTxn, pBusDrv->uCurrTxnBufsCount);
+        pBusDrv->uCurrTxnBufsCount++;
+        pBusDrv->eCurrTxnStatus = WSPI_TXN_COMPLETE;  /* The Txn is Sync as long as it continues in this context */
+
+        /* If write command */
+        if (bWrite)
+        {
+            /* Write the data (preceded by the WSPI padding) to the WSPI in Aync mode (not completed in the current context). */
+            pBusDrv->eCurrTxnStatus = WSPI_WriteAsync(pBusDrv->hWspi, pBusDrv->uCurrHwAddr, pBuf - WSPI_PAD_LEN_WRITE, uBufLen, &cb, TI_TRUE, TI_TRUE, TXN_PARAM_GET_FIXED_ADDR(pTxn));
+        }
+
+        /* If read command */
+        else 
+        {
+            /* Read the required data (preceded by the WSPI padding) from the WSPI in Aync mode (not completed in the current context). */
+            pBusDrv->eCurrTxnStatus = WSPI_ReadAsync(pBusDrv->hWspi, pBusDrv->uCurrHwAddr, pBuf - WSPI_PAD_LEN_READ, uBufLen, &cb, TI_TRUE, TI_TRUE, TXN_PARAM_GET_FIXED_ADDR(pTxn));
+        }
+
+        /* If not fixed HW address, the next buffer continues after this one */
+        if (!TXN_PARAM_GET_FIXED_ADDR(pTxn))
+        {
+            pBusDrv->uCurrHwAddr += uBufLen;
+        }
+
+        if (pBusDrv->eCurrTxnStatus == WSPI_TXN_PENDING)
+        {
+            return TXN_STATUS_PENDING;
+        }
+        if (pBusDrv->eCurrTxnStatus != WSPI_TXN_COMPLETE)
+        {
+            TRACE2(pBusDrv->hReport, REPORT_SEVERITY_ERROR, "busDrv_SendTxnBufs: Status = %d, BufNum = %d\n", pBusDrv->eCurrTxnStatus, pBusDrv->uCurrTxnBufsCount - 1);
+            return TXN_STATUS_ERROR;
+        }
+    }
+
+    return TXN_STATUS_COMPLETE;
 }
 
 
@@ -354,7 +536,31 @@ static void asyncEnded_CB(TI_HANDLE hBusDrv, int status)
     }
 	else
 	{
-		TRACE2(pBusDrv->hReport, REPORT_SEVERITY_INFORMATION,"asyncEnded_CB: Successful async cb done pBusDrv->pCurrTxn %x\n", pBusDrv->pCurrTxn);
+		TRACE1(pBusDrv->hReport, REPORT_SEVERITY_INFORMATION,"asyncEnded_CB: Successful async cb done pBusDrv->pCurrTxn %x\n", pBusDrv->pCurrTxn);
+
+        /* If a gathered Txn, it's done (copy the read data to the Txn buffers) */
+        if (pBusDrv->bCurrTxnGathered)
+        {
+            if (TXN_PARAM_GET_DIRECTION(pBusDrv->pCurrTxn) == TXN_DIRECTION_READ)
+            {
+                busDrv_ScatterRxBufs (pBusDrv);
+            }
+        }
+
+        /* Else, continue with the Txn remaining buffers, and exit if pending again */
+        else
+        {
+            switch (busDrv_SendTxnBufs (pBusDrv))
+            {
+                case TXN_STATUS_PENDING:
+                    return;
+                case TXN_STATUS_ERROR:
+                    TXN_PARAM_SET_STATUS(pBusDrv->pCurrTxn, TXN_PARAM_STATUS_ERROR);
+                    break;
+                default:
+                    break;
+            }
+        }
 	}
 
     /* Call the upper layer CB */
@@ -388,7 +594,7 @@ static void ConnectDone_CB(TI_HANDLE hBusDrv, int status)
     }
 	else
 	{
-		TRACE1 (pBusDrv->hReport, REPORT_SEVERITY_INIT, "ConnectDone_CB: Successful Connect Async cb done \n");
+		TRACE0 (pBusDrv->hReport, REPORT_SEVERITY_INIT, "ConnectDone_CB: Successful Connect Async cb done \n");
 	}
 
     /* Call the upper layer CB */
@@ -77,12 +77,12 @@ typedef void BUF, *PBUF;
  * \def RX_ETH_PKT_DATA
  * \brief Macro which gets a pointer to BUF packet header and returns the pointer to the start address of the ETH packet's data
  */
-#define RX_ETH_PKT_DATA(pBuf)   *((void **)(((TI_UINT32)pBuf + sizeof(RxIfDescriptor_t) + 2) & ~3))
+#define RX_ETH_PKT_DATA(pBuf)   *((void **)(((uintptr_t)pBuf + sizeof(RxIfDescriptor_t) + 2) & ~3))
 /**
  * \def RX_ETH_PKT_LEN
  * \brief Macro which gets a pointer to BUF packet header and returns the buffer length (without Rx Descriptor) of the ETH packet
  */
-#define RX_ETH_PKT_LEN(pBuf)    *((TI_UINT32 *)(((TI_UINT32)pBuf + sizeof(RxIfDescriptor_t) + 6) & ~3))
+#define RX_ETH_PKT_LEN(pBuf)    *((TI_UINT32 *)(((uintptr_t)pBuf + sizeof(RxIfDescriptor_t) + 2 + sizeof(void *)) & ~3))
 
 
 /** \brief BUF Allocation
@@ -106,6 +106,7 @@
 #define TIWLN_RATE_MNG_GET                              SITE_MGRT_GET_RATE_MANAGMENT
 #define TIWLN_802_11_GET_SELECTED_BSSID_INFO            SITE_MGR_GET_SELECTED_BSSID_INFO
 #define TIWLN_802_11_TX_STATISTICS                      TX_CTRL_COUNTERS_PARAM
+#define TIWLN_802_11_TX_LATENCY_STATISTICS              TX_CTRL_LATENCY_STATS_PARAM
 #define TIWLN_802_11_SET_TRAFFIC_INTENSITY_THRESHOLDS   CTRL_DATA_TRAFFIC_INTENSITY_THRESHOLD
 #define TIWLN_802_11_GET_TRAFFIC_INTENSITY_THRESHOLDS   CTRL_DATA_TRAFFIC_INTENSITY_THRESHOLD
 #define TIWLN_802_11_TOGGLE_TRAFFIC_INTENSITY_EVENTS    CTRL_DATA_TOGGLE_TRAFFIC_INTENSITY_EVENTS
@@ -528,6 +528,40 @@ void os_protectLock (TI_HANDLE OsContext, TI_HANDLE ProtectContext);
  * \sa
  */
 void os_protectUnlock (TI_HANDLE OsContext, TI_HANDLE ProtectContext);
+
+
+/****************************************************************************************
+ *							Atomic bitmap services API									*
+ ****************************************************************************************/
+
+/** \brief  OS Atomic Set Bits
+ * 
+ * \param  OsContext 	- Handle to the OS object
+ * \param  pBitmap 		- Pointer to the bitmap word
+ * \param  uBits 		- The bits to set
+ * \return void
+ * 
+ * \par Description
+ * This function sets the given bits in the bitmap word atomically (without a lock),
+ * so it may be called from any context concurrently with the driver context.
+ * 
+ * \sa	os_atomicClearBits
+ */
+void os_atomicSetBits (TI_HANDLE OsContext, TI_UINT32 *pBitmap, TI_UINT32 uBits);
+
+/** \brief  OS Atomic Clear Bits
+ * 
+ * \param  OsContext 	- Handle to the OS object
+ * \param  pBitmap 		- Pointer to the bitmap word
+ * \param  uBits 		- The bits to clear
+ * \return void
+ * 
+ * \par Description
+ * This function clears the given bits in the bitmap word atomically (without a lock).
+ * 
+ * \sa	os_atomicSetBits
+ */
+void os_atomicClearBits (TI_HANDLE OsContext, TI_UINT32 *pBitmap, TI_UINT32 uBits);
 /** \brief  Prevent system suspend
  *
  * \param  OsContext - Handle to the OS object
@@ -135,6 +135,8 @@ NDIS_STRING STRRxInterruptTimeout           = NDIS_STRING_CONST( "RxInterruptTim
 
 NDIS_STRING STRRxAggregationPktsLimit       = NDIS_STRING_CONST( "RxAggregationPktsLimit" );
 NDIS_STRING STRTxAggregationPktsLimit       = NDIS_STRING_CONST( "TxAggregationPktsLimit" );
+NDIS_STRING STRCmdMboxMultiIe               = NDIS_STRING_CONST( "CmdMboxMultiIe" );
+NDIS_STRING STRRecoveryConfigJournal        = NDIS_STRING_CONST( "RecoveryConfigJournal" );
 
 NDIS_STRING STRdot11FragThreshold           = NDIS_STRING_CONST( "dot11FragmentationThreshold" );
 NDIS_STRING STRdot11MaxTxMSDULifetime       = NDIS_STRING_CONST( "dot11MaxTransmitMSDULifetime" );
@@ -150,6 +152,8 @@ NDIS_STRING STRWiFiWmmPS                    = NDIS_STRING_CONST( "WiFiWmmPS" );
 NDIS_STRING STRWiFiMode                     = NDIS_STRING_CONST( "WiFiMode" );
 NDIS_STRING STRStopNetStackTx               = NDIS_STRING_CONST( "StopNetStackTx" );
 NDIS_STRING STRTxSendPaceThresh             = NDIS_STRING_CONST( "TxSendPaceThresh" );
+NDIS_STRING STRTxDataSchedulerMode          = NDIS_STRING_CONST( "TxDataSchedulerMode" );
+NDIS_STRING STRTxDataDrrQuantum             = NDIS_STRING_CONST( "TxDataDrrQuantum" );
 NDIS_STRING STRdot11DesiredChannel          = NDIS_STRING_CONST( "dot11DesiredChannel");
 NDIS_STRING STRdot11DesiredSSID             = NDIS_STRING_CONST( "dot11DesiredSSID" );
 NDIS_STRING STRdot11DesiredBSSType          = NDIS_STRING_CONST( "dot11DesiredBSSType" );
@@ -201,6 +205,7 @@ NDIS_STRING STRConnSelfTimeout              = NDIS_STRING_CONST( "ConnSelfTimeou
 
 NDIS_STRING STRCreditCalcTimout             = NDIS_STRING_CONST( "CreditCalcTimout" );
 NDIS_STRING STRCreditCalcTimerEnabled       = NDIS_STRING_CONST( "CreditCalcTimerEnabled" );
+NDIS_STRING STRTxLatencyStats               = NDIS_STRING_CONST( "TxLatencyStats" );
 
 NDIS_STRING STRTrafficAdmControlTimeout     = NDIS_STRING_CONST("TrafficAdmControlTimeout");
 NDIS_STRING STRTrafficAdmControlUseFixedMsduSize = NDIS_STRING_CONST("TrafficAdmCtrlUseFixedMsduSize");
@@ -497,6 +502,7 @@ NDIS_STRING STRTrafficIntensityThresLow         = NDIS_STRING_CONST("TrafficInte
 NDIS_STRING STRTrafficIntensityTestInterval     = NDIS_STRING_CONST("TrafficIntensityTestInterval");
 NDIS_STRING STRTrafficIntensityThresholdEnabled = NDIS_STRING_CONST("TrafficIntensityThresholdEnabled");
 NDIS_STRING STRTrafficMonitorMinIntervalPercentage = NDIS_STRING_CONST("TrafficMonitorMinIntervalPercent");
+NDIS_STRING STRTrafficMonitorBatch              = NDIS_STRING_CONST("TrafficMonitorBatch");
 
 
 /* Packet Burst parameters */
@@ -702,6 +708,7 @@ NDIS_STRING STRDfsPassiveDwellTimeMs             = NDIS_STRING_CONST( "DfsPassiv
 NDIS_STRING STRScanPushMode                      = NDIS_STRING_CONST( "ScanPushMode" );
 
 NDIS_STRING STRParseWSCInBeacons      = NDIS_STRING_CONST( "ParseWSCInBeacons" );
+NDIS_STRING STRMlmeLightweightParse  = NDIS_STRING_CONST( "MlmeLightweightParse" );
 
 /*-----------------------------------*/
 /*      Current BSS parameters       */
@@ -1711,6 +1718,18 @@ regFillInitTable(
                             sizeof p->twdInitParams.tGeneral.uTxAggregPktsLimit, 
                             (TI_UINT8*)&(p->twdInitParams.tGeneral.uTxAggregPktsLimit));
 
+    regReadIntegerParameter(pAdapter, &STRCmdMboxMultiIe,
+                            TWD_CMD_MBOX_MULTI_IE_DEF, TWD_CMD_MBOX_MULTI_IE_MIN,
+                            TWD_CMD_MBOX_MULTI_IE_MAX,
+                            sizeof p->twdInitParams.tGeneral.bCmdMboxMultiIe, 
+                            (TI_UINT8*)&(p->twdInitParams.tGeneral.bCmdMboxMultiIe));
+
+    regReadIntegerParameter(pAdapter, &STRRecoveryConfigJournal,
+                            TWD_RECOVERY_CONFIG_JOURNAL_DEF, TWD_RECOVERY_CONFIG_JOURNAL_MIN,
+                            TWD_RECOVERY_CONFIG_JOURNAL_MAX,
+                            sizeof p->twdInitParams.tGeneral.bRecoveryConfigJournal, 
+                            (TI_UINT8*)&(p->twdInitParams.tGeneral.bRecoveryConfigJournal));
+
     regReadIntegerParameter(pAdapter, &STRdot11DesiredChannel,
                         SITE_MGR_CHANNEL_DEF, SITE_MGR_CHANNEL_MIN, SITE_MGR_CHANNEL_MAX,
                         sizeof p->siteMgrInitParams.siteMgrDesiredChannel, 
@@ -1941,6 +1960,11 @@ regFillInitTable(
 							sizeof p->txDataInitParams.bCreditCalcTimerEnabled,
 							(TI_UINT8*)&p->txDataInitParams.bCreditCalcTimerEnabled);
 
+    regReadIntegerParameter(pAdapter, &STRTxLatencyStats,
+                            TX_DATA_LATENCY_STATS_DEF, TX_DATA_LATENCY_STATS_MIN, TX_DATA_LATENCY_STATS_MAX,
+                            sizeof p->txDataInitParams.bTxLatencyStats,
+                            (TI_UINT8*)&p->txDataInitParams.bTxLatencyStats);
+
     regReadIntegerParameter(pAdapter, &STRTrafficAdmControlTimeout,
                     TRAFFIC_ADM_CONTROL_TIMEOUT_DEF, TRAFFIC_ADM_CONTROL_TIMEOUT_MIN,
                     TRAFFIC_ADM_CONTROL_TIMEOUT_MAX,
@@ -3566,6 +3590,13 @@ regFillInitTable(
                             sizeof p->trafficMonitorMinIntervalPercentage,
                             (TI_UINT8*)&p->trafficMonitorMinIntervalPercentage);
 
+    regReadIntegerParameter(pAdapter, &STRTrafficMonitorBatch,
+                            TRAFFIC_MONITOR_BATCH_DEF,
+                            TRAFFIC_MONITOR_BATCH_MIN,
+                            TRAFFIC_MONITOR_BATCH_MAX,
+                            sizeof p->bTrafficMonitorBatch,
+                            (TI_UINT8*)&p->bTrafficMonitorBatch);
+
     regReadIntegerParameter(pAdapter, &STRWMEEnable,
                             WME_ENABLED_DEF, WME_ENABLED_MIN,
                             WME_ENABLED_MAX,
@@ -3703,6 +3734,18 @@ regFillInitTable(
 							sizeof p->txDataInitParams.uTxSendPaceThresh,
                             (TI_UINT8*)&p->txDataInitParams.uTxSendPaceThresh);
 
+	regReadIntegerParameter(pAdapter, &STRTxDataSchedulerMode,
+                            TX_DATA_SCHEDULER_MODE_DEF, TX_DATA_SCHEDULER_MODE_MIN,
+                            TX_DATA_SCHEDULER_MODE_MAX,
+							sizeof p->txDataInitParams.uSchedulerMode,
+                            (TI_UINT8*)&p->txDataInitParams.uSchedulerMode);
+
+	regReadIntegerParameter(pAdapter, &STRTxDataDrrQuantum,
+                            TX_DATA_DRR_QUANTUM_DEF, TX_DATA_DRR_QUANTUM_MIN,
+                            TX_DATA_DRR_QUANTUM_MAX,
+							sizeof p->txDataInitParams.uDrrQuantumUs,
+                            (TI_UINT8*)&p->txDataInitParams.uDrrQuantumUs);
+
 
     /* special numbers for WiFi mode! */
     if (uWiFiMode)
@@ -4064,6 +4107,14 @@ regFillInitTable(
                              sizeof p->tMlmeInitParams.parseWSCInBeacons,
                              (TI_UINT8*)&p->tMlmeInitParams.parseWSCInBeacons );
 
+/*----------------------------------
+ MLME
+------------------------------------*/
+    regReadIntegerParameter( pAdapter, &STRMlmeLightweightParse,
+                             MLME_LIGHTWEIGHT_PARSE_DEF, MLME_LIGHTWEIGHT_PARSE_MIN, MLME_LIGHTWEIGHT_PARSE_MAX,
+                             sizeof p->tMlmeInitParams.lightweightParse,
+                             (TI_UINT8*)&p->tMlmeInitParams.lightweightParse );
+
 /*----------------------------------
  Current BSS
 ------------------------------------*/
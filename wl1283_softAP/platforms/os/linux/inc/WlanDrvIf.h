@@ -127,6 +127,8 @@ typedef struct
     NDIS_HANDLE		         ConfigHandle;/* Temp - For Windows compatibility */
 
     TI_BOOL                  bSuspendInProgress; /* true if driver currently suspending/suspended; false if suspend not started or already resumed */
+    TI_HANDLE                hAsyncBatch; /* The async commands batch pending or awaiting its results fetch (see WlanDrvWext.c) */
+    TI_UINT32                uBatchId;    /* The last async commands batch ID */
 } TWlanDrvIfObj, *TWlanDrvIfObjPtr;
 
 
@@ -192,6 +194,21 @@ void wlanDrvIf_DisableTx (TI_HANDLE hOs);
  */
 extern TI_BOOL wlanDrvIf_receivePacket(TI_HANDLE OsContext, void *pRxDesc ,void *pPacket, TI_UINT16 Length, TIntraBssBridge *pIntraBssBridgeDecision);
 
+/**
+ * \fn     wlanDrvIf_RxBufToTxPacket
+ * \brief  Turn an Rx buffer into an OS Tx packet (for the intra-BSS bridge)
+ *
+ * \note
+ * \param   TI_HANDLE OsContext - Handle to OS context (WlanDrv)
+ * \param   void * pRxDesc      - pointer to Rx Descriptor
+ * \param   void * pPacket      - pointer to ethernet packet
+ * \param   TI_UINT16 Length    - packet length
+ *
+ * \return  The OS packet, freed by wlanDrvIf_FreeTxPacket
+ * \sa      txDataQ_ForwardRxPacket
+ */
+extern void *wlanDrvIf_RxBufToTxPacket (TI_HANDLE OsContext, void *pRxDesc, void *pPacket, TI_UINT16 Length);
+
 /**
  * \fn		wlanDrvIf_IsIoctlEnabled
  *
@@ -74,6 +74,7 @@
 #include <linux/netdevice.h>
 #include <linux/inetdevice.h>
 #include "RxBuf_linux.h"
+#include "osTraceRing.h"
 
 #ifdef TI_DBG
 #include "tracebuf_api.h"
@@ -979,6 +980,8 @@ static int wlanDrvIf_Create (void)
 #ifdef TI_DBG
     tb_init(TB_OPTION_NONE);
 #endif
+    /* The trace rings are not mandatory, so a failure is only reported */
+    osTraceRing_Init ();
     pDrvStaticHandle = drv;  /* save for module destroy */
 #ifdef TI_MEM_ALLOC_TRACE
     os_printf ("MTT:%s:%d ::kmalloc(%lu, %x) : %lu\n", __FUNCTION__, __LINE__, sizeof(TWlanDrvIfObj), GFP_KERNEL, sizeof(TWlanDrvIfObj));
@@ -1105,6 +1108,7 @@ drv_create_end_2:
     }
 
 drv_create_end_1:
+    osTraceRing_Destroy ();
 	kfree (drv);
 	printk ("%s: Fail, rc = %d\n", __func__, rc);
 	return rc;
@@ -1162,6 +1166,9 @@ static void wlanDrvIf_Destroy (TWlanDrvIfObj *drv)
         drvMain_Destroy (drv->tCommon.hDrvMain);
     }
 
+    /* Free the async commands batch if its results were not fetched */
+    wlanDrvWext_DestroyBatch (drv);
+
     /* close the ipc_kernel socket*/
     if (drv && drv->wl_sock)
     {
@@ -1221,6 +1228,7 @@ static void wlanDrvIf_Destroy (TWlanDrvIfObj *drv)
 #ifdef TI_DBG
     tb_destroy();
 #endif
+    osTraceRing_Destroy ();
     kfree (drv);
 }
 
@@ -1388,6 +1396,31 @@ TI_BOOL wlanDrvIf_receivePacket(TI_HANDLE OsContext, void *pRxDesc ,void *pPacke
     return TI_TRUE;
 }
 
+/**
+ * \fn     wlanDrvIf_RxBufToTxPacket
+ * \brief  Turn an Rx buffer into an OS Tx packet (for the intra-BSS bridge)
+ *
+ * The packet skips the network stack, so both the Rx and Tx statistics are updated here.
+ */
+void *wlanDrvIf_RxBufToTxPacket (TI_HANDLE OsContext, void *pRxDesc, void *pPacket, TI_UINT16 Length)
+{
+    TWlanDrvIfObj  *drv     = (TWlanDrvIfObj *)OsContext;
+    unsigned char  *pdata   = (unsigned char *)((TI_UINT32)pRxDesc & ~(TI_UINT32)0x3);
+    rx_head_t      *rx_head = (rx_head_t *)(pdata -  WSPI_PAD_BYTES - RX_HEAD_LEN_ALIGNED);
+    struct sk_buff *skb     = rx_head->skb;
+
+    skb->data = pPacket;
+    skb_put(skb, Length);
+    skb->dev  = drv->netdev;
+
+    drv->stats.rx_packets++;
+    drv->stats.rx_bytes += skb->len;
+    drv->stats.tx_packets++;
+    drv->stats.tx_bytes += skb->len;
+
+    return skb;
+}
+
 /*
  * \brief	suspend the driver
  *
@@ -49,6 +49,8 @@
 #include "privateCmd.h"
 #include "DrvMain.h"
 #include "APExternalIf.h"
+#include "TI_IPC_Api.h"
+#include "EvHandler.h"
 
 /* Routine prototypes */
 
@@ -63,6 +65,23 @@ extern int wlanDrvIf_LoadFiles (TWlanDrvIfObj *drv, TLoaderFilesData *pInitInfo)
 extern int wlanDrvIf_Start (struct net_device *dev);
 extern int wlanDrvIf_Stop (struct net_device *dev);
 
+/* A private commands batch, with driver copies of the commands buffers */
+typedef struct
+{
+    ti_private_cmd_t  aCmds[PRIVATE_CMD_MAX_BATCH];     /* The commands (in/out buffers are driver buffers) */
+    TI_UINT32         aRetCodes[PRIVATE_CMD_MAX_BATCH]; /* The commands return codes */
+    TI_UINT32         uNumCmds;                         /* Number of commands in the batch */
+    TI_UINT32         uBatchId;                         /* The batch ID (async batch) */
+    TI_BOOL           bDone;                            /* All commands completed (async batch) */
+    TWlanDrvIfObj    *pDrv;                             /* The driver object */
+} TWlanDrvBatch;
+
+static TWlanDrvBatch *wlanDrvWext_BatchCreate (TWlanDrvIfObj *drv, ti_private_cmd_t *pBatchCmd);
+static int  wlanDrvWext_BatchCopyOut (TWlanDrvIfObj *drv, TWlanDrvBatch *pBatch, ti_private_cmd_t *pBatchCmd);
+static void wlanDrvWext_BatchFree (TWlanDrvIfObj *drv, TWlanDrvBatch *pBatch);
+static void wlanDrvWext_BatchDoneCb (TI_HANDLE hBatch);
+static TI_BOOL wlanDrvWext_BatchIsDone (TWlanDrvBatch *pBatch);
+
 
 /* callbacks for WEXT commands */
 static const iw_handler aWextHandlers[] = {
@@ -158,6 +177,267 @@ static struct iw_statistics *wlanDrvWext_GetWirelessStats(struct net_device *dev
     return (struct iw_statistics *) cmdHndlr_GetStat (drv->tCommon.hCmdHndlr);
 }
 
+/**
+ * \fn     wlanDrvWext_BatchCreate
+ * \brief  Create a private commands batch
+ *
+ * Copy the batch commands array from the user (the batch command in buffer),
+ *     check that all commands are allowed, and copy their buffers to driver buffers.
+ * The batch is created with all its commands or not at all.
+ *
+ * \note   Driver-level commands can't be batched
+ * \param  drv       - The driver object
+ * \param  pBatchCmd - The batch private command (with user buffers)
+ * \return The batch, or NULL on failure
+ * \sa     wlanDrvWext_BatchFree
+ */
+static TWlanDrvBatch *wlanDrvWext_BatchCreate (TWlanDrvIfObj *drv, ti_private_cmd_t *pBatchCmd)
+{
+    TWlanDrvBatch    *pBatch;
+    ti_private_cmd_t *pCmd;
+    void             *pUserIn;
+    TI_UINT32         uNumCmds = pBatchCmd->in_buffer_len / sizeof(ti_private_cmd_t);
+    TI_UINT32         i, j;
+
+    if ((pBatchCmd->in_buffer == NULL) ||
+        (pBatchCmd->in_buffer_len != uNumCmds * sizeof(ti_private_cmd_t)) ||
+        (uNumCmds == 0) || (uNumCmds > PRIVATE_CMD_MAX_BATCH))
+    {
+        os_printf ("wlanDrvWext_BatchCreate() invalid batch length %d\n", pBatchCmd->in_buffer_len);
+        return NULL;
+    }
+
+    pBatch = (TWlanDrvBatch *)os_memoryAlloc (drv, sizeof(TWlanDrvBatch));
+    if (pBatch == NULL)
+    {
+        os_printf ("wlanDrvWext_BatchCreate() os_memoryAlloc FAILED !!!\n");
+        return NULL;
+    }
+    os_memoryZero (drv, pBatch, sizeof(TWlanDrvBatch));
+    pBatch->pDrv     = drv;
+    pBatch->uNumCmds = uNumCmds;
+
+    if (os_memoryCopyFromUser (drv, pBatch->aCmds, pBatchCmd->in_buffer, pBatchCmd->in_buffer_len))
+    {
+        os_printf ("wlanDrvWext_BatchCreate() os_memoryCopyFromUser FAILED !!!\n");
+        os_memoryFree (drv, pBatch, sizeof(TWlanDrvBatch));
+        return NULL;
+    }
+
+    /* check all commands before allocating their buffers */
+    for (i = 0; i < uNumCmds; i++)
+    {
+        pCmd = &pBatch->aCmds[i];
+        if (IS_PARAM_FOR_MODULE(pCmd->cmd, DRIVER_MODULE_PARAM) ||
+            (!wlanDrvIf_IsCmdEnabled (drv, pCmd->cmd)))
+        {
+            os_printf ("wlanDrvWext_BatchCreate() cmd 0x%x can't be batched\n", pCmd->cmd);
+            os_memoryFree (drv, pBatch, sizeof(TWlanDrvBatch));
+            return NULL;
+        }
+    }
+
+    for (i = 0; i < uNumCmds; i++)
+    {
+        pCmd = &pBatch->aCmds[i];
+
+        /* as set in IPC_STA_Private_Send() for a single command */
+        pCmd->flags = (pCmd->out_buffer) ? PRIVATE_CMD_GET_FLAG : PRIVATE_CMD_SET_FLAG;
+
+        pUserIn = pCmd->in_buffer;
+        pCmd->in_buffer = NULL;
+        if (pUserIn && pCmd->in_buffer_len)
+        {
+            pCmd->in_buffer = os_memoryAlloc (drv, pCmd->in_buffer_len);
+            if ((pCmd->in_buffer == NULL) ||
+                os_memoryCopyFromUser (drv, pCmd->in_buffer, pUserIn, pCmd->in_buffer_len))
+            {
+                break;
+            }
+        }
+
+        /* the user out buffer is taken again from the user commands array when the results are copied */
+        if (pCmd->out_buffer && pCmd->out_buffer_len)
+        {
+            pCmd->out_buffer = os_memoryAlloc (drv, pCmd->out_buffer_len);
+            if (pCmd->out_buffer == NULL)
+            {
+                break;
+            }
+            os_memoryZero (drv, pCmd->out_buffer, pCmd->out_buffer_len);
+        }
+        else
+        {
+            pCmd->out_buffer = NULL;
+        }
+    }
+
+    if (i < uNumCmds)
+    {
+        os_printf ("wlanDrvWext_BatchCreate() cmd %d buffers copy FAILED !!!\n", i);
+
+        /* the failed command out buffer and the next commands buffers are still user buffers */
+        pBatch->aCmds[i].out_buffer = NULL;
+        for (j = i + 1; j < uNumCmds; j++)
+        {
+            pBatch->aCmds[j].in_buffer  = NULL;
+            pBatch->aCmds[j].out_buffer = NULL;
+        }
+        wlanDrvWext_BatchFree (drv, pBatch);
+        return NULL;
+    }
+
+    return pBatch;
+}
+
+/**
+ * \fn     wlanDrvWext_BatchCopyOut
+ * \brief  Copy a completed batch results to the user
+ *
+ * Copy each command output to the user out buffer given in the user commands array
+ *     (the batch command in buffer), and the commands return codes to the batch command out buffer.
+ *
+ * \note
+ * \param  drv       - The driver object
+ * \param  pBatch    - The completed batch
+ * \param  pBatchCmd - The batch private command (with user buffers)
+ * \return TI_OK, or TI_NOK if a copy failed
+ * \sa     wlanDrvWext_BatchCreate
+ */
+static int wlanDrvWext_BatchCopyOut (TWlanDrvIfObj *drv, TWlanDrvBatch *pBatch, ti_private_cmd_t *pBatchCmd)
+{
+    ti_private_cmd_t  tUserCmd;
+    ti_private_cmd_t *pCmd;
+    TI_UINT32         uLen;
+    TI_UINT32         i;
+
+    for (i = 0; i < pBatch->uNumCmds; i++)
+    {
+        pCmd = &pBatch->aCmds[i];
+        if (pCmd->out_buffer == NULL)
+        {
+            continue;
+        }
+
+        if (os_memoryCopyFromUser (drv, &tUserCmd, &((ti_private_cmd_t *)pBatchCmd->in_buffer)[i], sizeof(ti_private_cmd_t)))
+        {
+            return TI_NOK;
+        }
+
+        uLen = (tUserCmd.out_buffer_len < pCmd->out_buffer_len) ? tUserCmd.out_buffer_len : pCmd->out_buffer_len;
+        if (tUserCmd.out_buffer && uLen &&
+            os_memoryCopyToUser (drv, tUserCmd.out_buffer, pCmd->out_buffer, uLen))
+        {
+            os_printf ("wlanDrvWext_BatchCopyOut() os_memoryCopyToUser FAILED !!!\n");
+            return TI_NOK;
+        }
+    }
+
+    if (os_memoryCopyToUser (drv, pBatchCmd->out_buffer, pBatch->aRetCodes, pBatch->uNumCmds * sizeof(TI_UINT32)))
+    {
+        os_printf ("wlanDrvWext_BatchCopyOut() os_memoryCopyToUser FAILED !!!\n");
+        return TI_NOK;
+    }
+
+    return TI_OK;
+}
+
+/**
+ * \fn     wlanDrvWext_BatchFree
+ * \brief  Free a batch and its commands driver buffers
+ *
+ * \note
+ * \param  drv    - The driver object
+ * \param  pBatch - The batch
+ * \return void
+ * \sa     wlanDrvWext_BatchCreate
+ */
+static void wlanDrvWext_BatchFree (TWlanDrvIfObj *drv, TWlanDrvBatch *pBatch)
+{
+    ti_private_cmd_t *pCmd;
+    TI_UINT32         i;
+
+    for (i = 0; i < pBatch->uNumCmds; i++)
+    {
+        pCmd = &pBatch->aCmds[i];
+        if (pCmd->in_buffer)
+        {
+            os_memoryFree (drv, pCmd->in_buffer, pCmd->in_buffer_len);
+        }
+        if (pCmd->out_buffer)
+        {
+            os_memoryFree (drv, pCmd->out_buffer, pCmd->out_buffer_len);
+        }
+    }
+
+    os_memoryFree (drv, pBatch, sizeof(TWlanDrvBatch));
+}
+
+/**
+ * \fn     wlanDrvWext_BatchDoneCb
+ * \brief  Async batch completion callback
+ *
+ * Called by the CmdHndlr in the driver context when the async batch last command is completed
+ *     (or aborted). Mark the batch as done and notify the user with IPC_EVENT_CMD_BATCH_DONE.
+ *
+ * \note   The results are kept until fetched with DRIVER_CMD_BATCH_RESULT_PARAM
+ * \param  hBatch - The batch
+ * \return void
+ * \sa     cmdHndlr_InsertBatch
+ */
+static void wlanDrvWext_BatchDoneCb (TI_HANDLE hBatch)
+{
+    TWlanDrvBatch *pBatch = (TWlanDrvBatch *)hBatch;
+    TWlanDrvIfObj *drv    = pBatch->pDrv;
+    unsigned long  flags;
+
+    spin_lock_irqsave (&drv->lock, flags);
+    pBatch->bDone = TI_TRUE;
+    spin_unlock_irqrestore (&drv->lock, flags);
+
+    EvHandlerSendEvent (drv->tCommon.hEvHandler, IPC_EVENT_CMD_BATCH_DONE, (TI_UINT8 *)&pBatch->uBatchId, sizeof(TI_UINT32));
+}
+
+/**
+ * \fn     wlanDrvWext_BatchIsDone
+ * \brief  Check if the async batch was completed (see wlanDrvWext_BatchDoneCb)
+ *
+ * \note   Called from user context
+ * \param  pBatch - The batch
+ * \return TI_TRUE if all the batch commands were completed
+ */
+static TI_BOOL wlanDrvWext_BatchIsDone (TWlanDrvBatch *pBatch)
+{
+    TWlanDrvIfObj *drv = pBatch->pDrv;
+    unsigned long  flags;
+    TI_BOOL        bDone;
+
+    spin_lock_irqsave (&drv->lock, flags);
+    bDone = pBatch->bDone;
+    spin_unlock_irqrestore (&drv->lock, flags);
+
+    return bDone;
+}
+
+/**
+ * \fn     wlanDrvWext_DestroyBatch
+ * \brief  Free the async batch if not fetched by the user
+ *
+ * \note   Called on driver destroy, after the commands queue was cleared
+ * \param  hWlanDrvIf - The driver object
+ * \return void
+ */
+void wlanDrvWext_DestroyBatch (TI_HANDLE hWlanDrvIf)
+{
+    TWlanDrvIfObj *drv = (TWlanDrvIfObj *)hWlanDrvIf;
+
+    if (drv->hAsyncBatch)
+    {
+        wlanDrvWext_BatchFree (drv, (TWlanDrvBatch *)drv->hAsyncBatch);
+        drv->hAsyncBatch = NULL;
+    }
+}
+
 /* Generic callback for WEXT commands */
 
 int wlanDrvWext_Handler (struct net_device *dev,
@@ -222,6 +502,118 @@ int wlanDrvWext_Handler (struct net_device *dev,
                *(TI_UINT32 *)my_command.out_buffer = 
                    (drv->tCommon.eDriverState == DRV_STATE_RUNNING) ? TI_TRUE : TI_FALSE;
                return TI_OK;
+
+           case DRIVER_CMD_BATCH_PARAM:
+           {
+               /* execute all the batch commands in one driver-task pass and wait for their completion */
+
+               TWlanDrvBatch *pBatch;
+               TI_UINT32 rc;
+
+               /* as for a single command, the batch commands are executed only if the driver is running */
+               if (drv->tCommon.eDriverState != DRV_STATE_RUNNING)
+               {
+                   return TI_NOK;
+               }
+
+               if ((my_command.out_buffer == NULL) ||
+                   (my_command.out_buffer_len < (my_command.in_buffer_len / sizeof(ti_private_cmd_t)) * sizeof(TI_UINT32)))
+               {
+                   return TI_NOK;
+               }
+
+               pBatch = wlanDrvWext_BatchCreate (drv, &my_command);
+               if (pBatch == NULL)
+               {
+                   return TI_NOK;
+               }
+
+               rc = cmdHndlr_InsertBatch (drv->tCommon.hCmdHndlr, SIOCIWFIRSTPRIV, pBatch->aCmds, pBatch->uNumCmds,
+                                          pBatch->aRetCodes, NULL, NULL);
+               if (rc == TI_OK)
+               {
+                   rc = wlanDrvWext_BatchCopyOut (drv, pBatch, &my_command);
+               }
+
+               wlanDrvWext_BatchFree (drv, pBatch);
+               return rc;
+           }
+
+           case DRIVER_CMD_BATCH_ASYNC_PARAM:
+           {
+               /* queue all the batch commands and return its ID. IPC_EVENT_CMD_BATCH_DONE is sent on its completion */
+
+               TWlanDrvBatch *pBatch = (TWlanDrvBatch *)drv->hAsyncBatch;
+               TI_UINT32 rc;
+
+               if (drv->tCommon.eDriverState != DRV_STATE_RUNNING)
+               {
+                   return TI_NOK;
+               }
+
+               if ((my_command.out_buffer == NULL) || (my_command.out_buffer_len < sizeof(TI_UINT32)))
+               {
+                   return TI_NOK;
+               }
+
+               /* only one async batch at a time. A completed batch which results were not fetched is dropped */
+               if (pBatch != NULL)
+               {
+                   if (!wlanDrvWext_BatchIsDone (pBatch))
+                   {
+                       os_printf ("wlanDrvWext: async batch %d is still pending\n", pBatch->uBatchId);
+                       return TI_NOK;
+                   }
+                   drv->hAsyncBatch = NULL;
+                   wlanDrvWext_BatchFree (drv, pBatch);
+               }
+
+               pBatch = wlanDrvWext_BatchCreate (drv, &my_command);
+               if (pBatch == NULL)
+               {
+                   return TI_NOK;
+               }
+               pBatch->uBatchId = ++drv->uBatchId;
+
+               if (os_memoryCopyToUser (drv, my_command.out_buffer, &pBatch->uBatchId, sizeof(TI_UINT32)))
+               {
+                   wlanDrvWext_BatchFree (drv, pBatch);
+                   return TI_NOK;
+               }
+
+               drv->hAsyncBatch = (TI_HANDLE)pBatch;
+               rc = cmdHndlr_InsertBatch (drv->tCommon.hCmdHndlr, SIOCIWFIRSTPRIV, pBatch->aCmds, pBatch->uNumCmds,
+                                          pBatch->aRetCodes, wlanDrvWext_BatchDoneCb, (TI_HANDLE)pBatch);
+               if (rc != TI_OK)
+               {
+                   drv->hAsyncBatch = NULL;
+                   wlanDrvWext_BatchFree (drv, pBatch);
+               }
+
+               return rc;
+           }
+
+           case DRIVER_CMD_BATCH_RESULT_PARAM:
+           {
+               /* copy the completed async batch outputs and return codes, and free it */
+
+               TWlanDrvBatch *pBatch = (TWlanDrvBatch *)drv->hAsyncBatch;
+               TI_UINT32 rc;
+
+               if ((pBatch == NULL) || (!wlanDrvWext_BatchIsDone (pBatch)) ||
+                   (my_command.in_buffer_len != pBatch->uNumCmds * sizeof(ti_private_cmd_t)) ||
+                   (my_command.out_buffer == NULL) ||
+                   (my_command.out_buffer_len < pBatch->uNumCmds * sizeof(TI_UINT32)))
+               {
+                   return TI_NOK;
+               }
+
+               rc = wlanDrvWext_BatchCopyOut (drv, pBatch, &my_command);
+
+               drv->hAsyncBatch = NULL;
+               wlanDrvWext_BatchFree (drv, pBatch);
+               return rc;
+           }
            }
        }
 	   /* if we are still here handle a normal private command*/
@@ -40,3 +40,4 @@
  */
 
 void wlanDrvWext_Init (struct net_device *dev);
+void wlanDrvWext_DestroyBatch (TI_HANDLE hWlanDrvIf);
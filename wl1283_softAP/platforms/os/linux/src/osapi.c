@@ -66,6 +66,7 @@
 #include "osApi.h"
 #include "txMgmtQueue_Api.h"
 #include "EvHandler.h"
+#include "osTraceRing.h"
 
 #ifdef ESTA_TIMER_DEBUG
 #define esta_timer_log(fmt,args...)  printk(fmt, ## args)
@@ -451,6 +452,60 @@ void os_protectUnlock (TI_HANDLE OsContext, TI_HANDLE ProtectContext)
 
     spin_unlock_irqrestore (&drv->lock, drv->flags);
 }
+
+
+/****************************************************************************************
+ *                        os_atomicSetBits()                                 
+ ****************************************************************************************
+DESCRIPTION:	Set bits in a bitmap word atomically (lock free, using the kernel set_bit).
+
+ARGUMENTS:		OsContext - our adapter context.
+				pBitmap   - the bitmap word.
+				uBits     - the bits to set.
+
+RETURN:			None
+
+NOTES:         	The driver is 32 bit only, so the bitmap word is the native bitops word.
+*****************************************************************************************/
+void os_atomicSetBits (TI_HANDLE OsContext, TI_UINT32 *pBitmap, TI_UINT32 uBits)
+{
+    unsigned long uMap = uBits;
+
+    BUILD_BUG_ON (sizeof(unsigned long) != sizeof(TI_UINT32));
+
+    while (uMap)
+    {
+        set_bit (__ffs (uMap), (volatile unsigned long *)pBitmap);
+        uMap &= uMap - 1;
+    }
+}
+
+
+/****************************************************************************************
+ *                        os_atomicClearBits()                                 
+ ****************************************************************************************
+DESCRIPTION:	Clear bits in a bitmap word atomically (lock free, using the kernel clear_bit).
+
+ARGUMENTS:		OsContext - our adapter context.
+				pBitmap   - the bitmap word.
+				uBits     - the bits to clear.
+
+RETURN:			None
+
+NOTES:         	The driver is 32 bit only, so the bitmap word is the native bitops word.
+*****************************************************************************************/
+void os_atomicClearBits (TI_HANDLE OsContext, TI_UINT32 *pBitmap, TI_UINT32 uBits)
+{
+    unsigned long uMap = uBits;
+
+    BUILD_BUG_ON (sizeof(unsigned long) != sizeof(TI_UINT32));
+
+    while (uMap)
+    {
+        clear_bit (__ffs (uMap), (volatile unsigned long *)pBitmap);
+        uMap &= uMap - 1;
+    }
+}
 /****************************************************************************************
  *                        os_receivePacket()
  ****************************************************************************************
@@ -855,7 +910,11 @@ int os_SignalObjectFree (TI_HANDLE OsContext, void *signalObject)
 
 /**
  * \fn     os_Trace
- * \brief  Prepare and send trace message to the logger.
+ * \brief  Write the trace message to the trace ring, and send it to the logger if enabled.
+ *
+ * The trace ring is always written (see osTraceRing.c), and is read through its mapping.
+ * The logger IPC path is used only if the output was redirected to the logger, and not
+ *   when the TRACE macros print the message text (PRINTF_ROLLBACK).
  *
  * \param  OsContext    - The OS handle
  * \param  uLevel       - Severity level of the trace message
@@ -877,6 +936,15 @@ void os_Trace (TI_HANDLE OsContext, TI_UINT32 uLevel, TI_UINT32 uFileId, TI_UINT
     TI_UINT8    *pMsgData = &aMsg[0] + sizeof(TTraceMsg);
     va_list     list;
 
+    va_start(list, uParamsNum);
+    osTraceRing_Write (uLevel, uFileId, uLineNum, uParamsNum, list);
+    va_end(list);
+
+#ifdef PRINTF_ROLLBACK
+    /* The message text was already printed by the TRACE macro (see report.h) */
+    return;
+#endif
+
     if (!bRedirectOutputToLogger)
     {
         return;
@@ -108,6 +108,7 @@ enum
     IPC_EVENT_TIMEOUT,
     IPC_EVENT_GWSI,
     IPC_EVENT_AP_EVENT, /* custom AP events */
+    IPC_EVENT_CMD_BATCH_DONE,
     IPC_EVENT_MAX
 };
 
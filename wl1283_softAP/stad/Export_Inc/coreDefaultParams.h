@@ -387,6 +387,16 @@ IP&Port classification table  */
 #define  TX_SEND_PACE_THRESH_MAX                16
 #define  TX_SEND_PACE_THRESH_DEF_WIFI_MODE      1
 
+/* Tx data scheduler: 0 - round robin, 1 - deficit round-robin over the links by estimated airtime */
+#define  TX_DATA_SCHEDULER_MODE_DEF             1
+#define  TX_DATA_SCHEDULER_MODE_MIN             0
+#define  TX_DATA_SCHEDULER_MODE_MAX             1
+
+/* Airtime quantum granted to a link per deficit round-robin round (usec) */
+#define  TX_DATA_DRR_QUANTUM_DEF                2000
+#define  TX_DATA_DRR_QUANTUM_MIN                100
+#define  TX_DATA_DRR_QUANTUM_MAX                20000
+
 #define  QOS_TX_BLKS_THRESHOLD_MIN              0
 #define  QOS_TX_BLKS_THRESHOLD_MAX              200
 
@@ -666,6 +676,10 @@ IP&Port classification table  */
 #define TX_DATA_CREDIT_CALC_TIMOEUT_MIN         20
 #define TX_DATA_CREDIT_CALC_TIMOEUT_MAX         1000
 
+#define TX_DATA_LATENCY_STATS_DEF               TI_TRUE
+#define TX_DATA_LATENCY_STATS_MIN               TI_FALSE
+#define TX_DATA_LATENCY_STATS_MAX               TI_TRUE
+
 #define TRAFFIC_ADM_CONTROL_TIMEOUT_MIN         10
 #define TRAFFIC_ADM_CONTROL_TIMEOUT_MAX         10000
 #define TRAFFIC_ADM_CONTROL_TIMEOUT_DEF         5000
@@ -693,6 +707,10 @@ IP&Port classification table  */
 #define TRAFFIC_MONITOR_MIN_INTERVAL_PERCENT_MAX   90
 #define TRAFFIC_MONITOR_MIN_INTERVAL_PERCENT_DEF   50
 
+#define TRAFFIC_MONITOR_BATCH_MIN   TI_FALSE
+#define TRAFFIC_MONITOR_BATCH_MAX   TI_TRUE
+#define TRAFFIC_MONITOR_BATCH_DEF   TI_FALSE
+
 #define CTRL_DATA_CONT_TX_THRESHOLD_MIN  2
 #define CTRL_DATA_CONT_TX_THRESHOLD_MAX  256
 #define CTRL_DATA_CONT_TX_THRESHOLD_DEF  30
@@ -943,6 +961,11 @@ IP&Port classification table  */
 #define WSC_PARSE_IN_BEACON_MIN 0
 #define WSC_PARSE_IN_BEACON_MAX 1
 
+/* MLME - index the scan results IEs, decode only the used ones and skip unchanged frames */
+#define MLME_LIGHTWEIGHT_PARSE_DEF 1
+#define MLME_LIGHTWEIGHT_PARSE_MIN 0
+#define MLME_LIGHTWEIGHT_PARSE_MAX 1
+
 #define WSC_INCLUDE_IN_BEACON_DEF 0
 #define WSC_INCLUDE_IN_BEACON_MIN 0
 #define WSC_INCLUDE_IN_BEACON_MAX 1
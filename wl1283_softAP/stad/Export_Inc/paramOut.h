@@ -563,6 +563,8 @@ typedef struct{
         signal_t                			siteMgrCurrentSignal;
         TI_UINT8                			siteMgrNumberOfSites;
         TIWLN_COUNTERS          			siteMgrTiWlanCounters;
+        TRecoveryStats          			tRecoveryStats;
+        TContextClientStats     			tContextClientStats;
         TI_BOOL                 			siteMgrBuiltInTestStatus;
         TI_UINT8                			siteMgrFwVersion[FW_VERSION_LEN]; /* Firmware version - null terminated string*/
         TI_UINT32               			siteMgrDisAssocReason;
@@ -647,6 +649,7 @@ typedef struct{
         /* Tx Data section */
         portStatus_e            			txDataPortStatus;
         TTxDataCounters        				*pTxDataCounters;
+        TIWLN_TX_LATENCY_STATISTICS         *pTxLatencyStats;
 		TI_UINT32 							txPacketsCount;
 		reportTsStatisticsReq_t 			tsMetricsCounters;
         OS_802_11_THRESHOLD_CROSS_PARAMS  	txDataMediumUsageThreshold;
@@ -944,6 +947,7 @@ typedef struct
 typedef struct
 {
     TI_UINT8                    parseWSCInBeacons;
+    TI_UINT8                    lightweightParse;
 } TMlmeInitParams;
 
 typedef struct
@@ -1017,9 +1021,12 @@ typedef struct
     /* TxCtrl Parameters */
 	TI_UINT32					creditCalculationTimeout;
 	TI_BOOL					    bCreditCalcTimerEnabled;
+    TI_BOOL					    bTxLatencyStats;
     /* TxDataQueue Parameters */
 	TI_BOOL					    bStopNetStackTx;
 	TI_UINT32					uTxSendPaceThresh;
+	TI_UINT32					uSchedulerMode;
+	TI_UINT32					uDrrQuantumUs;
 	TClsfrParams				ClsfrInitParam;
     /* Tx Data resources parameters */
 	TTxDataResourcesParams_t    tDataRsrcParam;
@@ -1211,6 +1218,7 @@ typedef struct
 	TI_BOOL							SendINIBufferToUser;
     /* Traffic Monitor */
     TI_UINT8                        trafficMonitorMinIntervalPercentage;
+    TI_BOOL                         bTrafficMonitorBatch;
     TReportInitParams               tReport;
     TCurrBssInitParams              tCurrBssInitParams;
     TMlmeInitParams                 tMlmeInitParams;
@@ -64,6 +64,10 @@
  * \brief Bitmaks of bit which indicates that the Command is GET Command
  */
 #define PRIVATE_CMD_GET_FLAG	0x00000002
+/** \def PRIVATE_CMD_MAX_BATCH
+ * \brief Max number of Private Commands in one commands batch (see DRIVER_CMD_BATCH_PARAM)
+ */
+#define PRIVATE_CMD_MAX_BATCH	32
 
 
 /*********/
@@ -57,6 +57,7 @@ TI_STATUS drvMain_Create 			(TI_HANDLE  hOs,
 TI_STATUS drvMain_Destroy           (TI_HANDLE  hDrvMain);
 TI_STATUS drvMain_InsertAction      (TI_HANDLE  hDrvMain, EActionType eAction);
 TI_STATUS drvMain_Recovery          (TI_HANDLE  hDrvMain);
+void      drvMain_GetRecoveryStats  (TI_HANDLE  hDrvMain, TRecoveryStats *pStats);
 void      drvMain_SmeStop           (TI_HANDLE hDrvMain);
 void      drvMain_Disconnected      (TI_HANDLE hDrvMain);
 #endif
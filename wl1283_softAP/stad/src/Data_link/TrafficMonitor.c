@@ -50,6 +50,12 @@
 /* Percentage of max down events test interval to use in our "traffic down" timer */ 
 #define MIN_INTERVAL_PERCENT 50
 
+/* Allowed delay (Msec) of the periodic "traffic down" timer, so it may share wakeups with other timers */
+#define TRAFFIC_MON_TIMER_SLACK_MS 100
+
+/* Allowed delay (Msec) of the batch mode window tick */
+#define TRAFFIC_MON_BATCH_SLACK_MS 25
+
 /*#define TRAFF_TEST*/
 #ifdef TRAFF_TEST
 /*for TEST Function*/
@@ -68,8 +74,13 @@ void TestEventFunc (TI_HANDLE hTrafficMonitor, TI_BOOL bTwdInitOccured);
 /*           Function prototype                                         */
 /************************************************************************/
 static void TimerMonitor_TimeOut (TI_HANDLE hTrafficMonitor, TI_BOOL bTwdInitOccured);
-static void TrafficMonitor_updateBW(BandWidth_t *pBandWidth, TI_UINT32 uCurrentTS);
+static void TrafficMonitor_updateBW(BandWidth_t *pBandWidth, TI_UINT32 uCurrentTS, TI_UINT32 uCount);
 static TI_UINT32 TrafficMonitor_calcBW(BandWidth_t *pBandWidth, TI_UINT32 uCurrentTS);
+static void TrafficMonitor_BatchEvent (TrafficMonitor_t *TrafficMonitor, int Count, TI_UINT16 Mask, TI_UINT32 MonitorModuleType);
+static void TrafficMonitor_BatchFlush (TrafficMonitor_t *TrafficMonitor);
+static void TrafficMonitor_BatchSetLimits (TrafficMonitor_t *TrafficMonitor);
+static void TrafficMonitor_BatchSync (TrafficMonitor_t *TrafficMonitor);
+static void TrafficMonitor_BatchTimeout (TI_HANDLE hTrafficMonitor, TI_BOOL bTwdInitOccured);
 static TI_BOOL isThresholdDown(TrafficAlertElement_t *AlertElement,TI_UINT32 CurrentTime);
 static TI_BOOL isThresholdUp(TrafficAlertElement_t *AlertElement , TI_UINT32 CurrentTime);
 static void SimpleByteAggregation(TI_HANDLE TraffElem,int Count);
@@ -121,6 +132,10 @@ static TI_HANDLE TrafficMonitor_ExitFunc(TrafficMonitor_t *TrafficMonitor,TI_HAN
         {
             tmr_DestroyTimer (TrafficMonitor->hTrafficMonTimer);
         }
+        if(TrafficMonitor->hBatchTimer)
+        {
+            tmr_DestroyTimer (TrafficMonitor->hBatchTimer);
+        }
         os_memoryFree(hOs, TrafficMonitor, sizeof(TrafficMonitor_t));            
     }
     return NULL;
@@ -138,6 +153,11 @@ void TrafficMonitor_Init (TStadHandlesList *pStadHandles, TI_UINT32 BWwindowMs)
         
     /* Create the base threshold timer that will serve all the down thresholds*/
     TrafficMonitor->hTrafficMonTimer = tmr_CreateTimer (pStadHandles->hTimer);
+    tmr_SetTimerSlack (TrafficMonitor->hTrafficMonTimer, TRAFFIC_MON_TIMER_SLACK_MS);
+
+    /* Create the batch mode window tick timer */
+    TrafficMonitor->hBatchTimer = tmr_CreateTimer (pStadHandles->hTimer);
+    tmr_SetTimerSlack (TrafficMonitor->hBatchTimer, TRAFFIC_MON_BATCH_SLACK_MS);
 
     TrafficMonitor->Active = TI_FALSE;
 
@@ -168,6 +188,8 @@ void TrafficMonitor_Init (TStadHandlesList *pStadHandles, TI_UINT32 BWwindowMs)
     TrafficMonitor->DownTimerEnabled = TI_FALSE;
     TrafficMonitor->trafficDownTestIntervalPercent = MIN_INTERVAL_PERCENT;
 
+    TrafficMonitor->bBatchMode = TI_FALSE;
+
 #ifdef TRAFF_TEST
     TestTrafficMonitor = TrafficMonitor;
     TestEventTimer = tmr_CreateTimer (pStadHandles->hTimer);
@@ -188,6 +210,8 @@ TI_STATUS TrafficMonitor_Start(TI_HANDLE hTrafficMonitor)
     if(TrafficMonitor == NULL)
         return TI_NOK;
 
+    TrafficMonitor_BatchSync (TrafficMonitor);
+
     /*starts the bandwidth TIMER*/
     if(!TrafficMonitor->Active) /*To prevent double call to timer start*/
     {
@@ -226,6 +250,9 @@ TI_STATUS TrafficMonitor_Stop(TI_HANDLE hTrafficMonitor)
     {
         return TI_NOK;
     }
+
+    /* Evaluate the batched events before stopping (while the alerts are still active) */
+    TrafficMonitor_BatchSync (pTrafficMonitor);
     
     if (pTrafficMonitor->Active) /*To prevent double call to timer stop*/
     {
@@ -236,6 +263,12 @@ TI_STATUS TrafficMonitor_Stop(TI_HANDLE hTrafficMonitor)
         tmr_StopTimer (pTrafficMonitor->hTrafficMonTimer);
     }  
 
+    if (pTrafficMonitor->bBatchTimerRunning)
+    {
+        pTrafficMonitor->bBatchTimerRunning = TI_FALSE;
+        tmr_StopTimer (pTrafficMonitor->hBatchTimer);
+    }
+
     /* Set all events state to ALERT_OFF to enable them to "kick" again once after TrafficMonitor is started */
     AlertElement = (TrafficAlertElement_t*)List_GetFirst(pTrafficMonitor->NotificationRegList);
     
@@ -272,6 +305,11 @@ TI_STATUS TrafficMonitor_Destroy(TI_HANDLE hTrafficMonitor)
         {
             tmr_DestroyTimer (TrafficMonitor->hTrafficMonTimer);
         }
+
+        if(TrafficMonitor->hBatchTimer)
+        {
+            tmr_DestroyTimer (TrafficMonitor->hBatchTimer);
+        }
         
 #ifdef TRAFF_TEST
 		if (TestEventTimer)
@@ -321,6 +359,8 @@ TI_HANDLE TrafficMonitor_RegEvent(TI_HANDLE hTrafficMonitor,TrafficAlertRegParm_
     if(TrafficMonitor == NULL)
        return NULL;
 
+    TrafficMonitor_BatchSync (TrafficMonitor);
+
     CurentTime = os_timeStampMs(TrafficMonitor->hOs);
 
     /*Gets a TrafficAlertElement_t memory from the list to assign to the registered request*/
@@ -523,6 +563,7 @@ TI_STATUS TrafficMonitor_SetRstCondition(TI_HANDLE hTrafficMonitor, TI_HANDLE Ev
     if((TrafficMonitor == NULL) || (EventHandle == NULL) || (TrafficResetAlertElement == NULL)) 
         return TI_NOK;
 
+    TrafficMonitor_BatchSync (TrafficMonitor);
     
     CurentTime = os_timeStampMs(TrafficMonitor->hOs);
 
@@ -618,6 +659,8 @@ void TrafficMonitor_StopEventNotif(TI_HANDLE hTrafficMonitor,TI_HANDLE EventHand
     if(TrafficAlertElement == NULL)
         return ;
 
+    TrafficMonitor_BatchSync (TrafficMonitor);
+
     TrafficAlertElement->Enabled = TI_FALSE;
     TrafficMonitor_UpdateDownTrafficTimerState (hTrafficMonitor);
 
@@ -639,6 +682,8 @@ void TrafficMonitor_StartEventNotif(TI_HANDLE hTrafficMonitor, TI_HANDLE EventHa
     if(TrafficAlertElement == NULL)
         return ;
 
+    TrafficMonitor_BatchSync (TrafficMonitor);
+
     TrafficAlertElement->Enabled = TI_TRUE;
     TrafficMonitor_UpdateDownTrafficTimerState (hTrafficMonitor);
 }
@@ -659,6 +704,8 @@ void TrafficMonitor_ResetEvent(TI_HANDLE hTrafficMonitor, TI_HANDLE EventHandle)
     if(TrafficAlertElement == NULL)
         return ;
 
+    TrafficMonitor_BatchSync (TrafficMonitor);
+
     TrafficAlertElement->CurrentState = ALERT_OFF;
 
     TrafficMonitor_UpdateDownTrafficTimerState (TrafficMonitor);
@@ -676,6 +723,8 @@ void TrafficMonitor_UnregEvent(TI_HANDLE hTrafficMonitor, TI_HANDLE EventHandle)
 
     if(TrafficMonitor == NULL)
         return ;
+
+    TrafficMonitor_BatchSync (TrafficMonitor);
     
     /*If it was an edge alert then there can be one more alert element to free.*/
     /*one is the alert, and the second is the reset element that corresponds to this alert*/
@@ -872,6 +921,12 @@ static void TimerMonitor_TimeOut (TI_HANDLE hTrafficMonitor, TI_BOOL bTwdInitOcc
     if(TrafficMonitor == NULL)
         return;
 
+    /* The down alerts are evaluated with all the events of their window */
+    if (TrafficMonitor->bBatchMode)
+    {
+        TrafficMonitor_BatchFlush (TrafficMonitor);
+    }
+
     AlertElement  = (TrafficAlertElement_t*)List_GetFirst(TrafficMonitor->NotificationRegList);
     CurentTime = os_timeStampMs(TrafficMonitor->hOs);
     
@@ -954,6 +1009,11 @@ int TrafficMonitor_GetFrameBandwidth(TI_HANDLE hTrafficMonitor)
 	if(pTrafficMonitor == NULL)
         return TI_NOK;
 
+	if (pTrafficMonitor->bBatchMode)
+	{
+		TrafficMonitor_BatchFlush (pTrafficMonitor);
+	}
+
 	uCurentTS = os_timeStampMs(pTrafficMonitor->hOs);  
 
 	/* Calculate BW for Rx & Tx */
@@ -970,23 +1030,24 @@ DESCRIPTION: Upon receiving an event of Tx/Rx (a packet was sent or received), T
 INPUT:          
 				pBandWidth		- BW of Rx or Tx	
 				uCurrentTS		- current TS of the recent event
+				uCount			- number of frames (more than one for batched events)
 
 OUTPUT:         pBandWidth		- updated counters and TS
 
 ************************************************************************/
-void TrafficMonitor_updateBW(BandWidth_t *pBandWidth, TI_UINT32 uCurrentTS)
+void TrafficMonitor_updateBW(BandWidth_t *pBandWidth, TI_UINT32 uCurrentTS, TI_UINT32 uCount)
 {
 	/* Check if we should move to the next window */
 	if ( (uCurrentTS - pBandWidth->auFirstEventsTS[pBandWidth->uCurrentWindow]) < (SIZE_OF_WINDOW_MS) )
 	{	
-		pBandWidth->auWindowCounter[pBandWidth->uCurrentWindow]++;
+		pBandWidth->auWindowCounter[pBandWidth->uCurrentWindow] += uCount;
 	}
 	else	/* next window */
 	{	
 		/* increment current window and mark the first event received */	
 		pBandWidth->uCurrentWindow = (pBandWidth->uCurrentWindow + 1) & CYCLIC_COUNTER_ELEMENT;
 		pBandWidth->auFirstEventsTS[pBandWidth->uCurrentWindow] = uCurrentTS;
-		pBandWidth->auWindowCounter[pBandWidth->uCurrentWindow] = 1;
+		pBandWidth->auWindowCounter[pBandWidth->uCurrentWindow] = uCount;
 	}
 }
 /***********************************************************************
@@ -1062,6 +1123,13 @@ void TrafficMonitor_Event(TI_HANDLE hTrafficMonitor,int Count,TI_UINT16 Mask,TI_
     if(!TrafficMonitor->Active)   
         return;
 
+    /* In batch mode only accumulate the event, the alerts are evaluated later */
+    if (TrafficMonitor->bBatchMode)
+    {
+        TrafficMonitor_BatchEvent (TrafficMonitor, Count, Mask, MonitorModuleType);
+        return;
+    }
+
 	uCurentTS = os_timeStampMs(TrafficMonitor->hOs);
 
     /* for BW calculation */
@@ -1069,14 +1137,14 @@ void TrafficMonitor_Event(TI_HANDLE hTrafficMonitor,int Count,TI_UINT16 Mask,TI_
     {
         if(Mask & DIRECTED_FRAMES_RECV)
 		{
-            TrafficMonitor_updateBW(&TrafficMonitor->DirectRxFrameBW, uCurentTS); 
+            TrafficMonitor_updateBW(&TrafficMonitor->DirectRxFrameBW, uCurentTS, 1); 
 		} 
     }
     else if (MonitorModuleType == TX_TRAFF_MODULE)
     {
         if(Mask & DIRECTED_FRAMES_XFER)
 		{
-            TrafficMonitor_updateBW(&TrafficMonitor->DirectTxFrameBW, uCurentTS);
+            TrafficMonitor_updateBW(&TrafficMonitor->DirectTxFrameBW, uCurentTS, 1);
 		}
     }
     else  
@@ -1119,6 +1187,314 @@ void TrafficMonitor_Event(TI_HANDLE hTrafficMonitor,int Count,TI_UINT16 Mask,TI_
 }
 
 
+/**
+ * \fn     TrafficMonitor_SetBatchMode
+ * \brief  Enable or disable the batch mode
+ *
+ * In batch mode the Tx/Rx events only update per module and event-mask counters.
+ * The alerts and BW are evaluated once per window tick (SIZE_OF_WINDOW_MS), on the "traffic down" timer,
+ *     or as soon as the accumulated events may cross the threshold of an active "up" alert.
+ *
+ * \note   The alerts callbacks and states are as in the per-event mode, but the start of a new alert
+ *         window is resolved to the evaluation time, so all events since the previous evaluation are
+ *         counted in the new window.
+ * \param  hTrafficMonitor - The module's object
+ * \param  bBatchMode      - TI_TRUE to accumulate the events, TI_FALSE to evaluate each event
+ * \return void
+ * \sa     TrafficMonitor_Event, TrafficMonitor_BatchFlush
+ */
+void TrafficMonitor_SetBatchMode (TI_HANDLE hTrafficMonitor, TI_BOOL bBatchMode)
+{
+    TrafficMonitor_t *TrafficMonitor = (TrafficMonitor_t*)hTrafficMonitor;
+
+    if (TrafficMonitor == NULL)
+        return;
+
+    /* Evaluate the events accumulated so far before changing the mode */
+    TrafficMonitor_BatchSync (TrafficMonitor);
+
+    TrafficMonitor->bBatchMode = bBatchMode;
+
+    TrafficMonitor_BatchSync (TrafficMonitor);
+}
+
+
+/**
+ * \fn     TrafficMonitor_BatchEvent
+ * \brief  Accumulate a Tx/Rx event in batch mode
+ *
+ * Add the event to its module and event-mask counters, and evaluate the alerts if the
+ *     accumulated events reached the flush limits. Otherwise start the window tick timer.
+ *
+ * \note   Called from TrafficMonitor_Event in batch mode
+ * \param  TrafficMonitor    - The module's object
+ * \param  Count             - The event length in bytes
+ * \param  Mask              - The event mask
+ * \param  MonitorModuleType - TX_TRAFF_MODULE or RX_TRAFF_MODULE
+ * \return void
+ * \sa     TrafficMonitor_BatchFlush
+ */
+static void TrafficMonitor_BatchEvent (TrafficMonitor_t *TrafficMonitor, int Count, TI_UINT16 Mask, TI_UINT32 MonitorModuleType)
+{
+    TrafficBatch_t *pBatch;
+    TI_UINT32       i;
+
+    if (MonitorModuleType >= MAX_NUM_MONITORED_MODULES)
+    {
+        return; /* module type does not exist, error return */
+    }
+
+    pBatch = &TrafficMonitor->aBatch[MonitorModuleType];
+
+    /* Find the event mask entry (the modules use only few masks) */
+    for (i = 0; i < pBatch->uNumEntries; i++)
+    {
+        if (pBatch->aEntries[i].uMask == Mask)
+        {
+            break;
+        }
+    }
+
+    if (i == pBatch->uNumEntries)
+    {
+        /* If all entries are used, evaluate them to free the table */
+        if (i == TRAFF_BATCH_MAX_MASKS)
+        {
+            TrafficMonitor_BatchFlush (TrafficMonitor);
+            i = 0;
+        }
+        pBatch->aEntries[i].uMask   = Mask;
+        pBatch->aEntries[i].uFrames = 0;
+        pBatch->aEntries[i].uBytes  = 0;
+        pBatch->uNumEntries = i + 1;
+    }
+
+    pBatch->aEntries[i].uFrames++;
+    pBatch->aEntries[i].uBytes += (TI_UINT32)Count;
+    TrafficMonitor->uPendingFrames++;
+    TrafficMonitor->uPendingBytes += (TI_UINT32)Count;
+
+    /* If an "up" alert threshold may be crossed, evaluate now as done per event */
+    if ((TrafficMonitor->uPendingFrames >= TrafficMonitor->uFlushFrames) ||
+        (TrafficMonitor->uPendingBytes  >= TrafficMonitor->uFlushBytes))
+    {
+        TrafficMonitor_BatchFlush (TrafficMonitor);
+    }
+    else if (!TrafficMonitor->bBatchTimerRunning)
+    {
+        TrafficMonitor->bBatchTimerRunning = TI_TRUE;
+        tmr_StartTimer (TrafficMonitor->hBatchTimer, TrafficMonitor_BatchTimeout, (TI_HANDLE)TrafficMonitor, SIZE_OF_WINDOW_MS, TI_FALSE);
+    }
+}
+
+
+/**
+ * \fn     TrafficMonitor_BatchTimeout
+ * \brief  The batch mode window tick
+ *
+ * \note   The timer is started by the first event accumulated after an evaluation
+ * \param  hTrafficMonitor  - The module's object
+ * \param  bTwdInitOccured  - Indicates if TWDriver recovery occured since timer started
+ * \return void
+ * \sa     TrafficMonitor_BatchEvent
+ */
+static void TrafficMonitor_BatchTimeout (TI_HANDLE hTrafficMonitor, TI_BOOL bTwdInitOccured)
+{
+    TrafficMonitor_t *TrafficMonitor = (TrafficMonitor_t*)hTrafficMonitor;
+
+    TrafficMonitor->bBatchTimerRunning = TI_FALSE;
+
+    TrafficMonitor_BatchFlush (TrafficMonitor);
+}
+
+
+/**
+ * \fn     TrafficMonitor_BatchFlush
+ * \brief  Evaluate the alerts and BW with the events accumulated in batch mode
+ *
+ * Update the BW and each alert with the sum of its matching events (frames or bytes, according to
+ *     its aggregation function), check the "up" thresholds and update the "traffic down" timer,
+ *     as TrafficMonitor_Event does for a single event.
+ *
+ * \note   Uses a single time stamp for the whole batch
+ * \param  TrafficMonitor - The module's object
+ * \return void
+ * \sa     TrafficMonitor_Event, TrafficMonitor_BatchSetLimits
+ */
+static void TrafficMonitor_BatchFlush (TrafficMonitor_t *TrafficMonitor)
+{
+    TrafficAlertElement_t *AlertElement;
+    TrafficBatch_t         aBatch[MAX_NUM_MONITORED_MODULES];
+    TI_UINT32              activeTrafDownEventsNum = 0;
+    TI_UINT32              trafficDownMinTimeout = 0xFFFFFFFF;
+    TI_UINT32              uCurentTS;
+    TI_UINT32              uModule;
+    TI_UINT32              uCount;
+    TI_UINT32              i;
+
+    if (TrafficMonitor->uPendingFrames == 0)
+    {
+        return;
+    }
+
+    /* Take the accumulated events, so events reported from the callbacks start a new batch */
+    os_memoryCopy (TrafficMonitor->hOs, (void *)aBatch, (void *)TrafficMonitor->aBatch, sizeof(aBatch));
+    for (uModule = 0; uModule < MAX_NUM_MONITORED_MODULES; uModule++)
+    {
+        TrafficMonitor->aBatch[uModule].uNumEntries = 0;
+    }
+    TrafficMonitor->uPendingFrames = 0;
+    TrafficMonitor->uPendingBytes  = 0;
+
+    uCurentTS = os_timeStampMs(TrafficMonitor->hOs);
+
+    /* for BW calculation */
+    for (i = 0; i < aBatch[RX_TRAFF_MODULE].uNumEntries; i++)
+    {
+        if (aBatch[RX_TRAFF_MODULE].aEntries[i].uMask & DIRECTED_FRAMES_RECV)
+        {
+            TrafficMonitor_updateBW(&TrafficMonitor->DirectRxFrameBW, uCurentTS, aBatch[RX_TRAFF_MODULE].aEntries[i].uFrames);
+        }
+    }
+    for (i = 0; i < aBatch[TX_TRAFF_MODULE].uNumEntries; i++)
+    {
+        if (aBatch[TX_TRAFF_MODULE].aEntries[i].uMask & DIRECTED_FRAMES_XFER)
+        {
+            TrafficMonitor_updateBW(&TrafficMonitor->DirectTxFrameBW, uCurentTS, aBatch[TX_TRAFF_MODULE].aEntries[i].uFrames);
+        }
+    }
+
+    AlertElement  = (TrafficAlertElement_t*)List_GetFirst(TrafficMonitor->NotificationRegList);
+
+    /* go over all the elements and check for alert */
+    while(AlertElement)
+    {
+        if(AlertElement->CurrentState != ALERT_WAIT_FOR_RESET)
+        {
+            TI_BOOL bMatch = TI_FALSE;
+
+            /* Sum the alert's events, counted as its aggregation function does */
+            uCount = 0;
+            for (uModule = 0; uModule < MAX_NUM_MONITORED_MODULES; uModule++)
+            {
+                for (i = 0; i < aBatch[uModule].uNumEntries; i++)
+                {
+                    if (AlertElement->MonitorMask[uModule] & aBatch[uModule].aEntries[i].uMask)
+                    {
+                        bMatch = TI_TRUE;
+                        uCount += (AlertElement->ActionFunc == SimpleByteAggregation) ?
+                                  aBatch[uModule].aEntries[i].uBytes : aBatch[uModule].aEntries[i].uFrames;
+                    }
+                }
+            }
+
+            if (bMatch)
+            {
+                AlertElement->EventCounter += uCount;
+                AlertElement->LastCounte = uCount;
+                if (AlertElement->Direction == TRAFF_UP)
+                {
+                    isThresholdUp(AlertElement, uCurentTS);
+                }
+            }
+
+            if ((AlertElement->Direction == TRAFF_DOWN) && (AlertElement->Trigger == TRAFF_EDGE) && (AlertElement->CurrentState == ALERT_OFF) && (AlertElement->Enabled == TI_TRUE))
+            {
+               /* Increase counter of active traffic down events */
+               activeTrafDownEventsNum++;
+
+               /* Search for the alert with the most short Interval time - will be used to start timer */
+               if ((AlertElement->TimeIntervalMs) < (trafficDownMinTimeout))
+                  trafficDownMinTimeout = AlertElement->TimeIntervalMs;
+            }
+        }
+        AlertElement = (TrafficAlertElement_t*)List_GetNext(TrafficMonitor->NotificationRegList);
+    }
+
+    TrafficMonitor_ChangeDownTimerStatus (TrafficMonitor,activeTrafDownEventsNum,trafficDownMinTimeout);
+
+    TrafficMonitor_BatchSetLimits (TrafficMonitor);
+}
+
+
+/**
+ * \fn     TrafficMonitor_BatchSetLimits
+ * \brief  Set the batch flush limits
+ *
+ * The limits are the least number of frames and bytes that may cross the threshold of an
+ *     active "up" alert, so its callback is called on the same event as in the per-event mode.
+ *
+ * \note   The limits are conservative, since the accumulated events may not match the alert's mask
+ * \param  TrafficMonitor - The module's object
+ * \return void
+ * \sa     TrafficMonitor_BatchEvent
+ */
+static void TrafficMonitor_BatchSetLimits (TrafficMonitor_t *TrafficMonitor)
+{
+    TrafficAlertElement_t *AlertElement;
+    TI_UINT32              uLimit;
+
+    TrafficMonitor->uFlushFrames = 0xFFFFFFFF;
+    TrafficMonitor->uFlushBytes  = 0xFFFFFFFF;
+
+    AlertElement  = (TrafficAlertElement_t*)List_GetFirst(TrafficMonitor->NotificationRegList);
+
+    while(AlertElement)
+    {
+        if ((AlertElement->CurrentState != ALERT_WAIT_FOR_RESET) && (AlertElement->Direction == TRAFF_UP))
+        {
+            /* The alert is crossed when its counter exceeds the threshold */
+            if (AlertElement->EventCounter > AlertElement->Threshold)
+            {
+                uLimit = 1;
+            }
+            else
+            {
+                uLimit = AlertElement->Threshold - AlertElement->EventCounter + 1;
+            }
+
+            if (AlertElement->ActionFunc == SimpleByteAggregation)
+            {
+                if (uLimit < TrafficMonitor->uFlushBytes)
+                    TrafficMonitor->uFlushBytes = uLimit;
+            }
+            else
+            {
+                if (uLimit < TrafficMonitor->uFlushFrames)
+                    TrafficMonitor->uFlushFrames = uLimit;
+            }
+        }
+        AlertElement = (TrafficAlertElement_t*)List_GetNext(TrafficMonitor->NotificationRegList);
+    }
+}
+
+
+/**
+ * \fn     TrafficMonitor_BatchSync
+ * \brief  Evaluate the batched events before the alerts list or state is changed
+ *
+ * Until the next evaluation every event is evaluated, since the flush limits are not
+ *     valid for the changed alerts.
+ *
+ * \note   Does nothing if not in batch mode
+ * \param  TrafficMonitor - The module's object
+ * \return void
+ * \sa     TrafficMonitor_BatchFlush
+ */
+static void TrafficMonitor_BatchSync (TrafficMonitor_t *TrafficMonitor)
+{
+    if (!TrafficMonitor->bBatchMode)
+    {
+        return;
+    }
+
+    TrafficMonitor_BatchFlush (TrafficMonitor);
+
+    TrafficMonitor->uFlushFrames = 1;
+    TrafficMonitor->uFlushBytes  = 1;
+}
+
+
 /*
  *      Used as the aggregation function that is used by the alerts for counting the events. 
  */
@@ -99,6 +99,7 @@ typedef struct
 
 TI_HANDLE TrafficMonitor_create(TI_HANDLE hOs);
 void TrafficMonitor_Init (TStadHandlesList *pStadHandles, TI_UINT32 BWwindowMs);
+void TrafficMonitor_SetBatchMode (TI_HANDLE hTrafficMonitor, TI_BOOL bBatchMode);
 TI_STATUS TrafficMonitor_Destroy(TI_HANDLE hTrafficMonitor);
 TI_HANDLE TrafficMonitor_RegEvent(TI_HANDLE hTrafficMonitor, TrafficAlertRegParm_t *TrafficAlertRegParm, TI_BOOL AutoResetCreate);
 TI_STATUS TrafficMonitor_SetRstCondition(TI_HANDLE hTrafficMonitor,TI_HANDLE EventHandle,TI_HANDLE ResetEventHandle,TI_BOOL MutualRst);
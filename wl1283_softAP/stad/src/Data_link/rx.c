@@ -82,8 +82,14 @@
 
 #define PADDING_ETH_PACKET_SIZE                 2
 
+/* Packets chain (rxData_ReceivePacketList): the classes forwarded to the data dispatcher, and no rate converted yet */
+#define RX_DATA_IS_DATA_CLASS(eTag)             (((eTag) == TAG_CLASS_QOS_DATA) || ((eTag) == TAG_CLASS_DATA) || \
+                                                 ((eTag) == TAG_CLASS_AMSDU)    || ((eTag) == TAG_CLASS_EAPOL))
+#define RX_DATA_NO_HW_RATE                      0xFFFFFFFF
+
 /* CallBack for recieving packet from rxXfer */
 static void rxData_ReceivePacket (TI_HANDLE   hRxData,  void  *pBuffer);
+static void rxData_ReceivePacketList (TI_HANDLE   hRxData,  void  **apBuffers, TI_UINT32 uNumBuffers);
 
 static ERxBufferStatus rxData_RequestForBuffer (TI_HANDLE   hRxData, void **pBuf, TI_UINT16 aLength, TI_UINT32 uEncryptionFlag,PacketClassTag_e ePacketClassTag);
 
@@ -252,6 +258,11 @@ void rxData_init (TStadHandlesList *pStadHandles)
                     (void *)rxData_ReceivePacket, 
                     pStadHandles->hRxData);
 
+    TWD_RegisterCb (pRxData->hTWD,
+                    TWD_EVENT_RX_RECEIVE_PACKET_LIST,
+                    (void *)rxData_ReceivePacketList, 
+                    pStadHandles->hRxData);
+
     TWD_RegisterCb (pRxData->hTWD,
                     TWD_EVENT_RX_REQUEST_FOR_BUFFER,
                     (void*)rxData_RequestForBuffer, 
@@ -1562,6 +1573,14 @@ static void rxData_rcvPacketData(TI_HANDLE hRxData, void *pBuffer, TRxAttr* pRxA
     }
 
     rxData_DistributorRxEvent (pRxData, EventMask, RX_ETH_PKT_LEN(pBuffer));
+
+    /* Forward a unicast packet to its station directly, without passing through the OS */
+    if ((pBssBridgeParam != NULL) && (pBssBridgeParam->eDecision == INTRA_BSS_BRIDGE_UNICAST))
+    {
+        txDataQ_ForwardRxPacket (pRxData->hTxDataQueue, pBuffer, RX_ETH_PKT_DATA(pBuffer), (TI_UINT16)RX_ETH_PKT_LEN(pBuffer), pBssBridgeParam->uParam);
+        return;
+    }
+
     /* deliver packet to os */
     wlanDrvIf_receivePacket(pRxData->hOs, (struct RxIfDescriptor_t*)pBuffer, RX_ETH_PKT_DATA(pBuffer), (TI_UINT16)RX_ETH_PKT_LEN(pBuffer), pBssBridgeParam);
 }
@@ -1877,6 +1896,46 @@ static TI_STATUS rxData_ConvertAmsduToEthPackets (TI_HANDLE hRxData, void *pBuff
     return TI_OK;
 }
 
+/****************************************************************************************
+ *                        rxData_SetRxAttr                                                  *
+ ****************************************************************************************
+DESCRIPTION:    Set the Rx attributes of a received packet from its RxInfo descriptor.
+                
+INPUT:          pRxParams - the packet RxInfo descriptor
+                eRate     - the packet rate, converted to the driver rate
+                pRxAttr   - the attributes to set
+
+OUTPUT:
+
+RETURN:         
+
+************************************************************************/
+static inline void rxData_SetRxAttr (rxData_t *pRxData, RxIfDescriptor_t *pRxParams, ERate eRate, TRxAttr *pRxAttr)
+{
+    pRxAttr->hlid       = pRxParams->hlid;
+    pRxAttr->channel    = pRxParams->channel;
+    pRxAttr->packetInfo = pRxParams->flags;
+    pRxAttr->ePacketType= pRxParams->packet_class_tag;
+    pRxAttr->Rate       = eRate;
+    pRxAttr->Rssi       = pRxParams->rx_level;
+    pRxAttr->SNR        = pRxParams->rx_snr;
+    pRxAttr->status     = pRxParams->status & RX_DESC_STATUS_MASK;
+    /* for now J band not implemented */
+    pRxAttr->band       = ((pRxParams->flags & RX_DESC_BAND_MASK) == RX_DESC_BAND_A) ? 
+                          RADIO_BAND_5_0_GHZ : RADIO_BAND_2_4_GHZ ;
+    /* Add hlid: process_id_tag field moved into status fileds bits [3..5] */
+    pRxAttr->eScanTag   = (pRxParams->status << RX_DESC_STATUS_PROC_ID_TAG_SHFT ) & RX_DESC_STATUS_PROC_ID_TAG_MASK;
+
+    /* timestamp is 32 bit so do bytes copy to avoid exception in case the RxInfo is in 2 bytes offset */
+    os_memoryCopy (pRxData->hOs, 
+                   (void *)&(pRxAttr->TimeStamp), 
+                   (void *)&(pRxParams->timestamp), 
+                   sizeof(pRxParams->timestamp) );
+    pRxAttr->TimeStamp = ENDIAN_HANDLE_LONG(pRxAttr->TimeStamp);
+
+    TRACE8(pRxData->hReport, REPORT_SEVERITY_INFORMATION, "rxData_SetRxAttr: channel=%d, info=0x%x, type=%d, rate=0x%x, RSSI=%d, SNR=%d, status=%d, scan tag=%d\n", pRxAttr->channel, pRxAttr->packetInfo, pRxAttr->ePacketType, pRxAttr->Rate, pRxAttr->Rssi, pRxAttr->SNR, pRxAttr->status, pRxAttr->eScanTag);
+}
+
 /****************************************************************************************
  *                        rxData_ReceivePacket                                              *
  ****************************************************************************************
@@ -1993,28 +2052,7 @@ static void rxData_ReceivePacket (TI_HANDLE   hRxData,
         /*
          * Set rx attributes 
          */ 
-        RxAttr.hlid       = pRxParams->hlid;
-        RxAttr.channel    = pRxParams->channel;
-        RxAttr.packetInfo = pRxParams->flags;
-        RxAttr.ePacketType= pRxParams->packet_class_tag;
-        RxAttr.Rate       = appRate;
-        RxAttr.Rssi       = pRxParams->rx_level;
-        RxAttr.SNR        = pRxParams->rx_snr;
-        RxAttr.status     = pRxParams->status & RX_DESC_STATUS_MASK;
-        /* for now J band not implemented */
-        RxAttr.band       = ((pRxParams->flags & RX_DESC_BAND_MASK) == RX_DESC_BAND_A) ? 
-                            RADIO_BAND_5_0_GHZ : RADIO_BAND_2_4_GHZ ;
-        /* Add hlid: process_id_tag field moved into status fileds bits [3..5] */
-        RxAttr.eScanTag   = (pRxParams->status << RX_DESC_STATUS_PROC_ID_TAG_SHFT ) & RX_DESC_STATUS_PROC_ID_TAG_MASK;
-
-        /* timestamp is 32 bit so do bytes copy to avoid exception in case the RxInfo is in 2 bytes offset */
-        os_memoryCopy (pRxData->hOs, 
-                       (void *)&(RxAttr.TimeStamp), 
-                       (void *)&(pRxParams->timestamp), 
-                       sizeof(pRxParams->timestamp) );
-        RxAttr.TimeStamp = ENDIAN_HANDLE_LONG(RxAttr.TimeStamp);
-
-        TRACE8(pRxData->hReport, REPORT_SEVERITY_INFORMATION, "rxData_ReceivePacket: channel=%d, info=0x%x, type=%d, rate=0x%x, RSSI=%d, SNR=%d, status=%d, scan tag=%d\n", RxAttr.channel, RxAttr.packetInfo, RxAttr.ePacketType, RxAttr.Rate, RxAttr.Rssi, RxAttr.SNR, RxAttr.status, RxAttr.eScanTag);
+        rxData_SetRxAttr (pRxData, pRxParams, appRate, &RxAttr);
 
         rxData_receivePacketFromWlan (hRxData, pBuffer, &RxAttr);
 
@@ -2029,6 +2067,93 @@ static void rxData_ReceivePacket (TI_HANDLE   hRxData,
 }
 
 
+/****************************************************************************************
+ *                        rxData_ReceivePacketList                                          *
+ ****************************************************************************************
+DESCRIPTION:    receive packets chain CB from RxQueue.
+                The chain holds in-order data packets of one BA session (one link), released
+                together from the reorder window. So the link and the Rx port are checked once
+                for the chain, the rate is converted only when it changes, the link counters are
+                updated once, and the good data packets go straight to the data dispatcher.
+                Other packets are handled by rxData_ReceivePacket().
+                
+INPUT:          apBuffers   - the packets, in order
+                uNumBuffers - the number of packets
+
+OUTPUT:
+
+RETURN:         
+
+************************************************************************/
+static void rxData_ReceivePacketList (TI_HANDLE   hRxData,
+                                      void  **apBuffers,
+                                      TI_UINT32 uNumBuffers)
+{
+    rxData_t          *pRxData = (rxData_t *)hRxData;
+    RxIfDescriptor_t  *pRxParams = (RxIfDescriptor_t *)apBuffers[0];
+    TRxAttr            RxAttr;
+    ERate              appRate = DRV_RATE_AUTO;
+    TI_UINT32          uHwRate = RX_DATA_NO_HW_RATE;
+    TI_UINT32          uNumPkts = 0;
+    TI_UINT32          uNumBytes = 0;
+    TI_UINT8           uHlid;
+    TI_UINT32          i;
+
+    /* 
+     * Packets of an illegal or closed link, or received while the Rx data port is closed,
+     *   take the regular path (discarded or reported)
+     */
+    if ((pRxParams == NULL) ||
+        (pRxParams->hlid >= WLANLINKS_MAX_LINKS) ||
+        (pRxData->aRxLinkInfo[pRxParams->hlid].eState == RX_CONN_STATE_CLOSE) ||
+        (pRxData->rxDataPortStatus == CLOSE))
+    {
+        for (i = 0; i < uNumBuffers; i++)
+        {
+            rxData_ReceivePacket (hRxData, apBuffers[i]);
+        }
+        return;
+    }
+    uHlid = pRxParams->hlid;
+
+    for (i = 0; i < uNumBuffers; i++)
+    {
+        pRxParams = (RxIfDescriptor_t *)apBuffers[i];
+
+        /* Packets with an error status, a non data class or another link take the regular path */
+        if ((pRxParams == NULL) ||
+            ((pRxParams->status & RX_DESC_STATUS_MASK) != RX_DESC_STATUS_SUCCESS) ||
+            !RX_DATA_IS_DATA_CLASS(pRxParams->packet_class_tag) ||
+            (pRxParams->hlid != uHlid))
+        {
+            rxData_ReceivePacket (hRxData, apBuffers[i]);
+            continue;
+        }
+
+        /* The chain packets are usually received in the same rate */
+        if (pRxParams->rate != uHwRate)
+        {
+            uHwRate = pRxParams->rate;
+            if (rate_PolicyToDrv (uHwRate, &appRate) != TI_OK)
+            {
+                TRACE1(pRxData->hReport, REPORT_SEVERITY_ERROR , "rxData_ReceivePacketList: can't convert hwRate=0x%x\n", uHwRate);
+            }
+        }
+
+        rxData_SetRxAttr (pRxData, pRxParams, appRate, &RxAttr);
+
+        uNumPkts++;
+        uNumBytes += RX_BUF_LEN(apBuffers[i]);
+
+        rxData_dataPacketDisptcher (hRxData, apBuffers[i], &RxAttr);
+    }
+
+    pRxData->rxDataLinkCounters[uHlid].recvFromWlan         += uNumPkts;
+    pRxData->rxDataLinkCounters[uHlid].recvBytesFromWlan    += uNumBytes;
+    pRxData->rxDataLinkCounters[uHlid].sendToDataDispatcher += uNumPkts;
+}
+
+
 /****************************************************************************************
  *                        rxData_RequestForBuffer                                              *
  ****************************************************************************************
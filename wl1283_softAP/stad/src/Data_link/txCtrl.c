@@ -72,6 +72,11 @@
 /* Note: put here and not in txCtrl.h to avoid warning in the txCtrl submodules that include txCtrl.h */ 
  
 static void   txCtrl_TxCompleteCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *pTxResultInfo);
+static void   txCtrl_TxCompleteListCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *aTxResults, TI_UINT32 uNumResults);
+static TTxCtrlBlk *txCtrl_HandleTxResult (txCtrl_t *pTxCtrl, TxResultDescriptor_t *pTxResultInfo,
+                                          TTxCmpltCounters *pCounters);
+static void   txCtrl_CommitTxCounters (txCtrl_t *pTxCtrl, TTxCmpltCounters *pCounters);
+static void   txCtrl_FreePacketBuf (txCtrl_t *pTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eStatus);
 static void   txCtrl_BuildDataPkt (txCtrl_t *pTxCtrl, TTxCtrlBlk *pPktCtrlBlk,
                                    TI_UINT32 uAc, TI_UINT32 uBackpressure);
 static void	  txCtrl_BuildMgmtPkt (txCtrl_t *pTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_UINT32 uAc);
@@ -82,7 +87,12 @@ static void   txCtrl_UpdateTxCounters (txCtrl_t *pTxCtrl,
                                        TxResultDescriptor_t *pTxResultInfo,
                                        TTxCtrlBlk *pPktCtrlBlk, 
                                        TI_UINT32 ac, 
-                                       TI_BOOL bIsDataPkt);
+                                       TI_BOOL bIsDataPkt,
+                                       TTxCmpltCounters *pCounters);
+static void   txCtrl_UpdateLatencyHist (txCtrl_t *pTxCtrl,
+                                      TxResultDescriptor_t *pTxResultInfo,
+                                      TTxCtrlBlk *pPktCtrlBlk,
+                                      TI_UINT32 ac);
 #ifdef XCC_MODULE_INCLUDED  /* Needed only for XCC-V4 */
 static void   txCtrl_SetTxDelayCounters (txCtrl_t *pTxCtrl, 
                                          TI_UINT32 ac, 
@@ -230,6 +240,7 @@ void txCtrl_Init (TStadHandlesList *pStadHandles)
     pTxCtrl->eapolEncryptionStatus = DEF_EAPOL_ENCRYPTION_STATUS;
     pTxCtrl->encryptionFieldSize = 0;
     pTxCtrl->currBssType = BSS_INFRASTRUCTURE;
+    txCtrlParams_InvalidateHdrTemplates (pStadHandles->hTxCtrl);
     pTxCtrl->busyAcBitmap = 0;
 	pTxCtrl->dbgPktSeqNum = 0;		
 	pTxCtrl->bCreditCalcTimerRunning = TI_FALSE;
@@ -258,6 +269,12 @@ void txCtrl_Init (TStadHandlesList *pStadHandles)
 					(void*)txCtrl_TxCompleteCb, 
                     pStadHandles->hTxCtrl);
 
+    /* Register the Tx-Complete results list callback function (used for all Tx results). */
+    TWD_RegisterCb (pTxCtrl->hTWD,
+                    TWD_EVENT_TX_RESULT_SEND_PKT_COMPLETE_LIST,
+                    (void*)txCtrl_TxCompleteListCb,
+                    pStadHandles->hTxCtrl);
+
 	/* Register the Update-Busy-Map callback function. */
 	TWD_RegisterCb (pTxCtrl->hTWD, 
                     TWD_EVENT_TX_HW_QUEUE_UPDATE_BUSY_MAP, 
@@ -286,6 +303,7 @@ TI_STATUS txCtrl_SetDefaults (TI_HANDLE hTxCtrl, TInitTable *pInitTable)
 
     pTxCtrl->creditCalculationTimeout = pInitTable->txDataInitParams.creditCalculationTimeout;
     pTxCtrl->bCreditCalcTimerEnabled  = pInitTable->txDataInitParams.bCreditCalcTimerEnabled;
+    pTxCtrl->tTxLatency.bEnabled      = pInitTable->txDataInitParams.bTxLatencyStats;
 
     /* Update queues mapping (AC/TID/Backpressure) after module init. */
 	txCtrl_UpdateQueuesMapping (hTxCtrl); 
@@ -651,6 +669,24 @@ void txCtrl_FreePacket (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eS
 {
     txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
     
+    /* Free the packet buffer */
+    txCtrl_FreePacketBuf (pTxCtrl, pPktCtrlBlk, eStatus);
+
+    /* Free TxData resources before freeing the tx ctrl block */
+    txDataQ_FreeResources (pTxCtrl->hTxDataQ, pPktCtrlBlk);
+
+    /* Free the CtrlBlk */
+    TWD_txCtrlBlk_Free (pTxCtrl->hTWD, pPktCtrlBlk);
+}
+
+
+/***************************************************************************
+*                           txCtrl_FreePacketBuf
+****************************************************************************
+* DESCRIPTION:  Free the packet buffer (raw buffer or OS packet), but not the CtrlBlk
+***************************************************************************/
+static void txCtrl_FreePacketBuf (txCtrl_t *pTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eStatus)
+{
     TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_FreePacket(): RawBufFlag = 0x%x, pBuf = 0x%x, Len = %d\n", (pPktCtrlBlk->tTxPktParams.uFlags & TX_CTRL_FLAG_PKT_IN_RAW_BUF), pPktCtrlBlk->tTxPktParams.pInputPkt, pPktCtrlBlk->tTxPktParams.uInputPktLen);
 
         /* If the packet is in a raw buffer, free its memory */
@@ -665,12 +701,6 @@ void txCtrl_FreePacket (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eS
     {
         wlanDrvIf_FreeTxPacket (pTxCtrl->hOs, pPktCtrlBlk, eStatus);
     }
-
-    /* Free TxData resources before freeing the tx ctrl block */
-    txDataQ_FreeResources (pTxCtrl->hTxDataQ, pPktCtrlBlk);
-
-    /* Free the CtrlBlk */
-    TWD_txCtrlBlk_Free (pTxCtrl->hTWD, pPktCtrlBlk);
 }
 
 
@@ -697,10 +727,112 @@ void txCtrl_FreePacket (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, TI_STATUS eS
 static void txCtrl_TxCompleteCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *pTxResultInfo)
 {
     txCtrl_t    *pTxCtrl = (txCtrl_t *)hTxCtrl;
+    TTxCtrlBlk  *pPktCtrlBlk;
+    TTxCmpltCounters tCounters;
+    CL_TRACE_START_L3();
+
+    /* Update the TKIP/AES sequence-number according to the Tx data packet security-seq-num. */
+    /* Note: The FW always provides the last used seq-num so no need to check if the current
+		packet is data and WEP is on. */
+    TWD_SetSecuritySeqNum (pTxCtrl->hTWD, pTxResultInfo->lsbSecuritySequenceNumber);
+
+    tCounters.uAcBitmap = 0;
+    tCounters.uLinkBitmap = 0;
+    tCounters.bLastHwTxRateValid = TI_FALSE;
+    pPktCtrlBlk = txCtrl_HandleTxResult (pTxCtrl, pTxResultInfo, &tCounters);
+    txCtrl_CommitTxCounters (pTxCtrl, &tCounters);
+
+    /* Free the packet resources (packet and CtrlBlk)  */
+    if (pPktCtrlBlk != NULL)
+    {
+        txCtrl_FreePacket (pTxCtrl, pPktCtrlBlk, TI_OK);
+    }
+
+    CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
+}
+
+
+/*************************************************************************
+*                        txCtrl_TxCompleteListCb		                         *
+**************************************************************************
+* DESCRIPTION:  Called by the TWD upon Tx-complete of a list of packets
+*				  (the new results, consecutive in the FW results queue).
+*				Handle the packets results as txCtrl_TxCompleteCb, except:
+*				- The security sequence number is updated once, by the last result
+*				    (the FW provides the last used one, and a list is shorter than 
+*				    its 8 LSB wrap around)
+*				- All TxData resources and CtrlBlks are freed together, with one lock each
+*				- The counters are accumulated per AC and link and added once, after the list
+*				    (see txCtrl_CommitTxCounters)
+*
+* INPUT:    hTxCtrl -  The module object.
+*		    aTxResults - The packets Tx results information.
+*		    uNumResults - The number of results.
+*
+*************************************************************************/
+static void txCtrl_TxCompleteListCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *aTxResults, TI_UINT32 uNumResults)
+{
+    txCtrl_t    *pTxCtrl = (txCtrl_t *)hTxCtrl;
+    TTxCtrlBlk  *apFreeCtrlBlks[TRQ_DEPTH];
+    TTxCtrlBlk  *pPktCtrlBlk;
+    TTxCmpltCounters tCounters;
+    TI_UINT32    uNumFree = 0;
+    TI_UINT32    i;
+    CL_TRACE_START_L3();
+
+    if (uNumResults == 0)
+    {
+        CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
+        return;
+    }
+
+    TWD_SetSecuritySeqNum (pTxCtrl->hTWD, aTxResults[uNumResults - 1].lsbSecuritySequenceNumber);
+
+    tCounters.uAcBitmap = 0;
+    tCounters.uLinkBitmap = 0;
+    tCounters.bLastHwTxRateValid = TI_FALSE;
+
+    for (i = 0; i < uNumResults; i++)
+    {
+        pPktCtrlBlk = txCtrl_HandleTxResult (pTxCtrl, &aTxResults[i], &tCounters);
+        if (pPktCtrlBlk != NULL)
+        {
+            /* Free the packet now, and keep the CtrlBlk for the common free */
+            txCtrl_FreePacketBuf (pTxCtrl, pPktCtrlBlk, TI_OK);
+            apFreeCtrlBlks[uNumFree++] = pPktCtrlBlk;
+        }
+    }
+
+    /* Free TxData resources before freeing the tx ctrl blocks */
+    txDataQ_FreeResourcesList (pTxCtrl->hTxDataQ, apFreeCtrlBlks, uNumFree);
+
+    txCtrl_CommitTxCounters (pTxCtrl, &tCounters);
+
+    TWD_txCtrlBlk_FreeList (pTxCtrl->hTWD, apFreeCtrlBlks, uNumFree);
+
+    CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
+}
+
+
+/*************************************************************************
+*                        txCtrl_HandleTxResult		                         *
+**************************************************************************
+* DESCRIPTION:  Handle one packet Tx result:
+*				- Update counters (statistics and medium-usage)
+*				- Update the link airtime estimation
+*
+* INPUT:    pTxCtrl -  The module object.
+*		    pTxResultInfo - The packet's Tx result information.
+*		    pCounters - The list counters (committed by the caller with txCtrl_CommitTxCounters).
+*
+* RETURN:   The packet CtrlBlk to free, or NULL if it is already free (not expected).
+*************************************************************************/
+static TTxCtrlBlk *txCtrl_HandleTxResult (txCtrl_t *pTxCtrl, TxResultDescriptor_t *pTxResultInfo,
+                                          TTxCmpltCounters *pCounters)
+{
 	TTxCtrlBlk  *pPktCtrlBlk;
 	TI_UINT32	ac;
 	TI_BOOL	    bIsDataPkt;
-	CL_TRACE_START_L3();
 
 	/* Get packet ctrl-block by desc-ID. */
 	pPktCtrlBlk = TWD_txCtrlBlk_GetPointer (pTxCtrl->hTWD, pTxResultInfo->descID);
@@ -710,16 +842,11 @@ static void txCtrl_TxCompleteCb (TI_HANDLE hTxCtrl, TxResultDescriptor_t *pTxRes
 	/* If the pointed entry is already free, print error and exit (not expected to happen). */
 	if (pPktCtrlBlk->pNextFreeEntry != NULL)
 	{
-TRACE2(pTxCtrl->hReport, REPORT_SEVERITY_ERROR, "txCtrl_TxCompleteCb(): Pkt already free!!, DescID=%d, AC=%d\n", pTxResultInfo->descID, ac);
-		CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
-		return;
+TRACE2(pTxCtrl->hReport, REPORT_SEVERITY_ERROR, "txCtrl_HandleTxResult(): Pkt already free!!, DescID=%d, AC=%d\n", pTxResultInfo->descID, ac);
+		return NULL;
 	}
-TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_TxCompleteCb(): Pkt Tx Complete, DescID=%d, AC=%d, Status=%d\n", pTxResultInfo->descID, ac, pTxResultInfo->status);
+TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_HandleTxResult(): Pkt Tx Complete, DescID=%d, AC=%d, Status=%d\n", pTxResultInfo->descID, ac, pTxResultInfo->status);
 #endif
-	/* Update the TKIP/AES sequence-number according to the Tx data packet security-seq-num. */
-	/* Note: The FW always provides the last used seq-num so no need to check if the current 
-			 packet is data and WEP is on. */
-	TWD_SetSecuritySeqNum (pTxCtrl->hTWD, pTxResultInfo->lsbSecuritySequenceNumber);
 
 	bIsDataPkt = ( (pPktCtrlBlk->tTxPktParams.uPktType == TX_PKT_TYPE_ETHER) || 
 		           (pPktCtrlBlk->tTxPktParams.uPktType == TX_PKT_TYPE_WLAN_DATA) );
@@ -734,20 +861,195 @@ TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_TxCompleteCb(): Pk
     }
 #endif
 
+	/* Start the AC and link list counters on their first result */
+	if ((pCounters->uAcBitmap & (1 << ac)) == 0)
+	{
+	    os_memoryZero (pTxCtrl->hOs, &pCounters->aAc[ac], sizeof(TTxCmpltAcCounters));
+	    pCounters->uAcBitmap |= (1 << ac);
+	}
+	if ((pCounters->uLinkBitmap & (1 << pPktCtrlBlk->tTxDescriptor.hlid)) == 0)
+	{
+	    os_memoryZero (pTxCtrl->hOs, &pCounters->aLink[pPktCtrlBlk->tTxDescriptor.hlid], sizeof(TTxCmpltLinkCounters));
+	    pCounters->uLinkBitmap |= (1 << pPktCtrlBlk->tTxDescriptor.hlid);
+	}
+
 	/* Add the medium usage time for the specific queue. */
-	pTxCtrl->totalUsedTime[ac] += (TI_UINT32)ENDIAN_HANDLE_WORD(pTxResultInfo->mediumUsage);
+	pCounters->aAc[ac].uUsedTime += (TI_UINT32)ENDIAN_HANDLE_WORD(pTxResultInfo->mediumUsage);
 
 	/* update TX counters for txDistributer */
     {
         CL_TRACE_START_L4();
-        txCtrl_UpdateTxCounters (pTxCtrl, pTxResultInfo, pPktCtrlBlk, ac, bIsDataPkt);
+        txCtrl_UpdateTxCounters (pTxCtrl, pTxResultInfo, pPktCtrlBlk, ac, bIsDataPkt, pCounters);
         CL_TRACE_END_L4("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", ".Cntrs");
     }
 
-    /* Free the packet resources (packet and CtrlBlk)  */
-    txCtrl_FreePacket (pTxCtrl, pPktCtrlBlk, TI_OK);
+    /* Update the link airtime estimation for the Tx scheduler (a failed packet has no valid rate) */
+    if (bIsDataPkt)
+    {
+        ERate     eRate;
+        TI_UINT32 uRateMbps = 0;
+
+        if ((pTxResultInfo->status == TX_SUCCESS) && 
+            (rate_PolicyToDrv ((ETxRateClassId)ENDIAN_HANDLE_LONG(pTxResultInfo->rate), &eRate) == TI_OK))
+        {
+            uRateMbps = rate_DrvToNumber (eRate);
+        }
+        txDataQ_UpdateLinkAirtime (pTxCtrl->hTxDataQ, pPktCtrlBlk->tTxDescriptor.hlid, uRateMbps, pTxResultInfo->ackFailures);
+
+        /* Update the Tx latency histograms of successfully transmitted packets (if enabled) */
+        if (pTxCtrl->tTxLatency.bEnabled && (pTxResultInfo->status == TX_SUCCESS))
+        {
+            txCtrl_UpdateLatencyHist (pTxCtrl, pTxResultInfo, pPktCtrlBlk, ac);
+        }
+    }
+
+    return pPktCtrlBlk;
+}
+
+
+/*************************************************************************
+*                        txCtrl_CommitTxCounters		                         *
+**************************************************************************
+* DESCRIPTION:  Add the counters accumulated over a Tx results list (per AC and link)
+*				  to the module counters, and save the last data Tx rate.
+*
+* INPUT:    pTxCtrl -  The module object.
+*		    pCounters - The list counters.
+*
+*************************************************************************/
+static void txCtrl_CommitTxCounters (txCtrl_t *pTxCtrl, TTxCmpltCounters *pCounters)
+{
+    TTxCmpltAcCounters   *pAcCounters;
+    TTxCmpltLinkCounters *pLinkCounters;
+    TTxDataCounters      *pDataCounters;
+    TI_UINT32             uAcBitmap = pCounters->uAcBitmap;
+    TI_UINT32             uLinkBitmap = pCounters->uLinkBitmap;
+    TI_UINT32             ac;
+    TI_UINT32             uHlid;
+
+    for (ac = 0; uAcBitmap != 0; ac++, uAcBitmap >>= 1)
+    {
+        if ((uAcBitmap & 1) == 0)
+        {
+            continue;
+        }
+
+        pAcCounters   = &pCounters->aAc[ac];
+        pDataCounters = &pTxCtrl->txDataCounters[ac];
+
+        pTxCtrl->totalUsedTime[ac]         += pAcCounters->uUsedTime;
+        pDataCounters->XmitOk              += pAcCounters->uXmitOk;
+        pDataCounters->DirectedFramesXmit  += pAcCounters->uDirectedFrames;
+        pDataCounters->DirectedBytesXmit   += pAcCounters->uDirectedBytes;
+        pDataCounters->MulticastFramesXmit += pAcCounters->uMulticastFrames;
+        pDataCounters->MulticastBytesXmit  += pAcCounters->uMulticastBytes;
+        pDataCounters->BroadcastFramesXmit += pAcCounters->uBroadcastFrames;
+        pDataCounters->BroadcastBytesXmit  += pAcCounters->uBroadcastBytes;
+        pTxCtrl->dbgCounters.dbgNumTxCmplt[ac]        += pAcCounters->uDbgNumTxCmplt;
+        pTxCtrl->dbgCounters.dbgNumTxCmpltOk[ac]      += pAcCounters->uDbgNumTxCmpltOk;
+        pTxCtrl->dbgCounters.dbgNumTxCmpltError[ac]   += pAcCounters->uDbgNumTxCmpltError;
+        pTxCtrl->dbgCounters.dbgNumTxCmpltOkBytes[ac] += pAcCounters->uDbgNumTxCmpltOkBytes;
+    }
+
+    for (uHlid = 0; uLinkBitmap != 0; uHlid++, uLinkBitmap >>= 1)
+    {
+        if (uLinkBitmap & 1)
+        {
+            pLinkCounters = &pCounters->aLink[uHlid];
+            pTxCtrl->dbgLinkCounters.dbgNumTxCmplt[uHlid]        += pLinkCounters->uDbgNumTxCmplt;
+            pTxCtrl->dbgLinkCounters.dbgNumTxCmpltOk[uHlid]      += pLinkCounters->uDbgNumTxCmpltOk;
+            pTxCtrl->dbgLinkCounters.dbgNumTxCmpltError[uHlid]   += pLinkCounters->uDbgNumTxCmpltError;
+            pTxCtrl->dbgLinkCounters.dbgNumTxCmpltOkBytes[uHlid] += pLinkCounters->uDbgNumTxCmpltOkBytes;
+        }
+    }
+
+    if (pCounters->bLastHwTxRateValid)
+    {
+        rate_PolicyToDrv ((ETxRateClassId)pCounters->uLastHwTxRate, &pTxCtrl->eCurrentTxRate);
+    }
+}
+
+
+/***************************************************************************
+*                   txCtrl_BuildDataHdrBase                                *
+****************************************************************************
+* DESCRIPTION:  Build the 802.11 header part which is common to all data packets
+*               of the BSS (or AP link): alignment pad, frame control, BSSID address, 
+*               and the lengths of the QoS, HT-control and security fields.
+*               The per packet fields (addresses from the Ethernet header and
+*               QoS control) are set later by txCtrl_BuildDataPktHdr.
+*
+* INPUTS:       pTxCtrl - the object
+*               pHdr - the header buffer (MAX_HEADER_SIZE bytes)
+*               bApRole - build the AP role header (from DS)
+*               bEncrypt - set the WEP bit and add the security pad
+*               encryptionFieldSize - the security pad size (4 bytes for TKIP, 8 for AES)
+*
+* OUTPUT:       pHdrLen - the header length up to the LLC/SNAP, including the alignment pad
+*
+* RETURNS:      uHdrAlignPad - Num of bytes (0 or 2) added at the header's beginning for 4-bytes alignment.
+***************************************************************************/
+static TI_UINT32 txCtrl_BuildDataHdrBase (txCtrl_t *pTxCtrl, TI_UINT8 *pHdr, TI_BOOL bApRole, 
+                                          TI_BOOL bEncrypt, TI_UINT8 encryptionFieldSize, TI_UINT32 *pHdrLen)
+{
+    dot11_header_t      *pDot11Header;
+	TI_UINT32			uHdrLen = 0;
+	TI_UINT32			uHdrAlignPad = 0;
+	TI_UINT16			fc = 0;
+
+	/* Set WEP bit in header and add padding for FW security overhead: 4 bytes for TKIP, 8 for AES. */
+    if (bEncrypt)
+    {
+        fc |= DOT11_FC_WEP;
+        uHdrLen += encryptionFieldSize;
+        uHdrAlignPad = encryptionFieldSize % 4;
+    }
+
+	/* 
+	 * Handle QoS if needed:
+	 */
+    if (pTxCtrl->headerConverMode == HDR_CONVERT_QOS)
+	{
+        uHdrAlignPad = (uHdrAlignPad + HEADER_PAD_SIZE) % 4; /* Add 2 bytes pad at the header beginning for 4 bytes alignment. */
+		uHdrLen += WLAN_QOS_HDR_LEN;
+        fc |= DOT11_FC_DATA_QOS;
+
+        /* add empty 4Byte for HT control field set via the FW */
+        if (pTxCtrl->tTxCtrlHtControl.bHtEnable == TI_TRUE)
+        {
+            uHdrLen += WLAN_QOS_HT_CONTROL_FIELD_LEN;
+            fc |= DOT11_FC_ORDER;
+        }
+	}
+	else  /* No QoS (legacy header, padding is not needed). */
+	{
+		uHdrLen += WLAN_HDR_LEN;
+        fc |= DOT11_FC_DATA;
+    }
+	uHdrLen += uHdrAlignPad;
+
+    pDot11Header = (dot11_header_t *)&(pHdr[uHdrAlignPad]);
 
-	CL_TRACE_END_L3("tiwlan_drv.ko", "INHERIT", "TX_Cmplt", "");
+	/* Set the BSSID address: address3 in Independent-BSS, address2 (from DS) in AP role, address1 (to DS) in STA role. */
+    if ( TI_UNLIKELY(pTxCtrl->currBssType == BSS_INDEPENDENT) )
+    {
+        MAC_COPY (pDot11Header->address3, pTxCtrl->currBssId);
+    }
+    else if (bApRole)
+    {
+        MAC_COPY (pDot11Header->address2, pTxCtrl->currBssId);
+        fc |= DOT11_FC_FROM_DS;
+    }
+    else
+    {
+        MAC_COPY (pDot11Header->address1, pTxCtrl->currBssId);
+        fc |= DOT11_FC_TO_DS;
+    }
+
+	COPY_WLAN_WORD(&pDot11Header->fc, &fc); /* copy with endianess handling. */
+
+    *pHdrLen = uHdrLen;
+    return uHdrAlignPad;
 }
 
 
@@ -756,6 +1058,8 @@ TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_TxCompleteCb(): Pk
 ****************************************************************************
 * DESCRIPTION:  this function builds the WLAN header from ethernet format, 
 *               including 802.11-MAC, LLC/SNAP, security padding, alignment padding.
+*               The BSS common part is copied from the header template of the AP link
+*               or of the STA role data packets (rebuilt if invalidated by a parameters change).
 *
 * INPUTS:       hTxCtrl - the object
 *               pPktCtrlBlk - data packet control block (Ethernet header)
@@ -766,89 +1070,75 @@ TRACE3(pTxCtrl->hReport, REPORT_SEVERITY_INFORMATION, "txCtrl_TxCompleteCb(): Pk
 TI_UINT32 txCtrl_BuildDataPktHdr (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, AckPolicy_e eAckPolicy)
 {
     txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;    
+    TTxDataHdrTemplate  *pTemplate;
     TEthernetHeader     *pEthHeader;
     dot11_header_t      *pDot11Header;
     Wlan_LlcHeader_T    *pWlanSnapHeader;
-	EHeaderConvertMode	eQosMode = pTxCtrl->headerConverMode;
-	TI_UINT32			uHdrLen = 0;
-	TI_UINT32			uHdrAlignPad = 0;
+	TI_UINT32			uHdrLen;
+	TI_UINT32			uHdrAlignPad;
 	TI_UINT16			uQosControl;
-	TI_UINT16			fc = 0;
  	TI_UINT16           typeLength;
     TI_UINT8            encryptionFieldSize;
+    TI_BOOL             bApRole = IS_PKT_TYPE_IF_ROLE_AP(pPktCtrlBlk) ? TI_TRUE : TI_FALSE;
+    TI_BOOL             bEncrypt;
 
 
-	
     /*  
-	 * Handle encryption if needed, for data or EAPOL (decision was done by Hostapd):
-     * txMgmtQ will set the encrypt bit for eapol, txdataQ will set the encrypt bit for data.
-	 *   - Set WEP bit in header, 
-     *   - Add padding for FW security overhead: 4 bytes for TKIP, 8 for AES.  
+	 * Handle encryption if needed, for data or EAPOL:
+     *   - AP role: the decision was done by Hostapd (txMgmtQ sets the encrypt bit for eapol, 
+     *              txdataQ for data), and the security pad size is per link.
+	 *   - STA role: the decision was done at RSN.
 	 */
-
-    
-    if (IS_PKT_TYPE_IF_ROLE_AP(pPktCtrlBlk))
+    if (bApRole)
     {
-      if (IS_PKT_TYPE_ENCRYPT(pPktCtrlBlk))
-        {
-          encryptionFieldSize = TxDataQ_getEncryptionFieldSizes(pTxCtrl->hTxDataQ,pPktCtrlBlk->tTxDescriptor.hlid);
-          fc |= DOT11_FC_WEP;
-          uHdrLen += encryptionFieldSize;
-          uHdrAlignPad = encryptionFieldSize % 4;
-        }
+        bEncrypt  = IS_PKT_TYPE_ENCRYPT(pPktCtrlBlk) ? TI_TRUE : TI_FALSE;
+        pTemplate = &pTxCtrl->aLinkHdrTemplate[pPktCtrlBlk->tTxDescriptor.hlid];
+    }
+    else if (TI_LIKELY(pPktCtrlBlk->tTxPktParams.uPktType != TX_PKT_TYPE_EAPOL))
+    {
+        bEncrypt  = pTxCtrl->currentPrivacyInvokedMode;
+        pTemplate = &pTxCtrl->tDataHdrTemplate;
     }
     else
-    /* 
-	 * Handle encryption if needed, for data or EAPOL (decision was done at RSN):
-	 *   - Set WEP bit in header.
-	 *   - Add padding for FW security overhead: 4 bytes for TKIP, 8 for AES.  
-	 */
+    {
+        bEncrypt  = pTxCtrl->eapolEncryptionStatus;
+        pTemplate = NULL;
+    }
 
+    if (TI_LIKELY(pTemplate != NULL))
     {
-        
-      	if (( (pPktCtrlBlk->tTxPktParams.uPktType == TX_PKT_TYPE_EAPOL)
-			  &&
-			  pTxCtrl->eapolEncryptionStatus) 
-		 ||
-			((pPktCtrlBlk->tTxPktParams.uPktType != TX_PKT_TYPE_EAPOL)
-			  &&
-			  pTxCtrl->currentPrivacyInvokedMode ))
+        /* Rebuild the template if invalidated or if the packet encryption differs */
+        if (TI_UNLIKELY(!pTemplate->bValid || (pTemplate->bEncrypt != bEncrypt)))
         {
-        
-			fc |= DOT11_FC_WEP;
-			uHdrLen += pTxCtrl->encryptionFieldSize;
-            uHdrAlignPad = pTxCtrl->encryptionFieldSize % 4;
-	    }
+            encryptionFieldSize = bApRole ? TxDataQ_getEncryptionFieldSizes(pTxCtrl->hTxDataQ, pPktCtrlBlk->tTxDescriptor.hlid) 
+                                          : pTxCtrl->encryptionFieldSize;
+            os_memoryZero (pTxCtrl->hOs, pTemplate->aHdr, MAX_HEADER_SIZE);
+            pTemplate->uHdrAlignPad = txCtrl_BuildDataHdrBase (pTxCtrl, pTemplate->aHdr, bApRole, bEncrypt, 
+                                                               encryptionFieldSize, &pTemplate->uHdrLen);
+            pTemplate->bEncrypt = bEncrypt;
+            pTemplate->bValid   = TI_TRUE;
         }
 
-	/* 
-	 * Handle QoS if needed:
-	 */
-    if (eQosMode == HDR_CONVERT_QOS)
-	{
-        uHdrAlignPad = (uHdrAlignPad + HEADER_PAD_SIZE) % 4; /* Add 2 bytes pad at the header beginning for 4 bytes alignment. */
-		pDot11Header = (dot11_header_t *)&(pPktCtrlBlk->aPktHdr[uHdrAlignPad]);
-		uHdrLen += WLAN_QOS_HDR_LEN;
+        os_memoryCopy (pTxCtrl->hOs, pPktCtrlBlk->aPktHdr, pTemplate->aHdr, pTemplate->uHdrLen);
+        uHdrLen      = pTemplate->uHdrLen;
+        uHdrAlignPad = pTemplate->uHdrAlignPad;
+    }
+    else
+    {
+        uHdrAlignPad = txCtrl_BuildDataHdrBase (pTxCtrl, pPktCtrlBlk->aPktHdr, TI_FALSE, bEncrypt, 
+                                                pTxCtrl->encryptionFieldSize, &uHdrLen);
+    }
 
-        /* add empty 4Byte for HT control field set via the FW */
-        if (pTxCtrl->tTxCtrlHtControl.bHtEnable == TI_TRUE)
-        {
-            uHdrLen += WLAN_QOS_HT_CONTROL_FIELD_LEN;
-            fc |= DOT11_FC_ORDER;
-        }
+    pDot11Header = (dot11_header_t *)&(pPktCtrlBlk->aPktHdr[uHdrAlignPad]);
 
-		/* Set Qos control fields. */
+	/* Set Qos control fields. */
+    if (pTxCtrl->headerConverMode == HDR_CONVERT_QOS)
+	{
 		uQosControl = (TI_UINT16)(pPktCtrlBlk->tTxDescriptor.tid); 
 		if ( TI_UNLIKELY(eAckPolicy == ACK_POLICY_NO_ACK) )
 			uQosControl |= DOT11_QOS_CONTROL_DONT_ACK;
 		COPY_WLAN_WORD(&pDot11Header->qosControl, &uQosControl); /* copy with endianess handling. */
 	}
-	else  /* No QoS (legacy header, padding is not needed). */
-	{
-        pDot11Header = (dot11_header_t *)&(pPktCtrlBlk->aPktHdr[uHdrAlignPad]);
-		uHdrLen += WLAN_HDR_LEN;
-    }
-	uHdrLen += uHdrAlignPad;
 
     /* Before the header translation the first buf-pointer points to the Ethernet header. */	
 	pEthHeader = (TEthernetHeader *)(pPktCtrlBlk->tTxnStruct.aBuf[0]);
@@ -862,48 +1152,23 @@ TI_UINT32 txCtrl_BuildDataPktHdr (TI_HANDLE hTxCtrl, TTxCtrlBlk *pPktCtrlBlk, Ac
         }
     }
 
-	/* Set MAC header fields for Independent-BSS case. */
+	/* Set MAC header addresses from the Ethernet header (the BSSID is already set). */
     if ( TI_UNLIKELY(pTxCtrl->currBssType == BSS_INDEPENDENT) )
     {
         MAC_COPY (pDot11Header->address1, pEthHeader->dst);
         MAC_COPY (pDot11Header->address2, pEthHeader->src);
-        MAC_COPY (pDot11Header->address3, pTxCtrl->currBssId);
-
-        if (eQosMode == HDR_CONVERT_QOS)
-            fc |= DOT11_FC_DATA_QOS;
-        else
-            fc |= DOT11_FC_DATA;
     }
-
-	/* Set MAC header fields for Infrastructure-BSS case. */
+    else if (bApRole) 
+    {
+        MAC_COPY (pDot11Header->address1, pEthHeader->dst);
+        MAC_COPY (pDot11Header->address3, pEthHeader->src);
+    }
     else
     {
-        if (IS_PKT_TYPE_IF_ROLE_AP(pPktCtrlBlk)) 
-        {
-            MAC_COPY (pDot11Header->address1, pEthHeader->dst);
-            MAC_COPY (pDot11Header->address2, pTxCtrl->currBssId);
-            MAC_COPY (pDot11Header->address3, pEthHeader->src);
-            if (eQosMode == HDR_CONVERT_QOS)
-                fc |= DOT11_FC_DATA_QOS | DOT11_FC_FROM_DS;
-            else
-                fc |= DOT11_FC_DATA | DOT11_FC_FROM_DS;
-        }
-        else
-        {
-         
-        MAC_COPY (pDot11Header->address1, pTxCtrl->currBssId);
         MAC_COPY (pDot11Header->address2, pEthHeader->src);
         MAC_COPY (pDot11Header->address3, pEthHeader->dst);
-
-        if (eQosMode == HDR_CONVERT_QOS)
-            fc |= DOT11_FC_DATA_QOS | DOT11_FC_TO_DS;
-        else
-            fc |= DOT11_FC_DATA | DOT11_FC_TO_DS;
-		}
     }
 
-	COPY_WLAN_WORD(&pDot11Header->fc, &fc); /* copy with endianess handling. */
-	
     /* Set the SNAP header pointer right after the other header parts handled above. */
     pWlanSnapHeader = (Wlan_LlcHeader_T *)&(pPktCtrlBlk->aPktHdr[uHdrLen]);
     
@@ -1317,6 +1582,71 @@ static void txCtrl_SetTxDelayCounters (txCtrl_t *pTxCtrl,
 #endif /* XCC_MODULE_INCLUDED */
 
 
+/* Get the log2 histogram bucket of a latency in usec: [2^i, 2^(i+1)) is bucket i (0 is also in bucket 0) */
+static inline TI_UINT32 txCtrl_LatencyBucket (TI_UINT32 uLatencyUs)
+{
+    TI_UINT32 uBucket = 0;
+
+    if (uLatencyUs >= 0x10000) { uBucket += 16; uLatencyUs >>= 16; }
+    if (uLatencyUs >= 0x100)   { uBucket += 8;  uLatencyUs >>= 8;  }
+    if (uLatencyUs >= 0x10)    { uBucket += 4;  uLatencyUs >>= 4;  }
+    if (uLatencyUs >= 0x4)     { uBucket += 2;  uLatencyUs >>= 2;  }
+    if (uLatencyUs >= 0x2)     { uBucket += 1; }
+
+    return (uBucket < TX_LATENCY_HIST_BUCKETS) ? uBucket : (TX_LATENCY_HIST_BUCKETS - 1);
+}
+
+/****************************************************************************
+ *                      txCtrl_UpdateLatencyHist()
+ ****************************************************************************
+ * DESCRIPTION:  Update the Tx latency histograms of the packet's AC and link.
+ *               The packet latency is split to:
+ *               - Host queueing: from wlanDrvIf_Xmit until the Xfer to the FW (uDriverDelay, msec granularity)
+ *               - FW queueing:   from the Xfer until the first medium access (fwHandlingTime - mediumDelay)
+ *               - Medium time:   from the first medium access until Tx complete (mediumDelay)
+ *               and the end to end latency is their sum.
+ *
+ * INPUTS:       pTxCtrl - the object
+ *               pTxResultInfo - the packet's Tx result information
+ *               pPktCtrlBlk - the packet's control block
+ *               ac - the AC to count the latency for
+ *
+ * OUTPUT:
+ *
+ * RETURNS:
+ ****************************************************************************/
+static void txCtrl_UpdateLatencyHist (txCtrl_t *pTxCtrl,
+                                      TxResultDescriptor_t *pTxResultInfo,
+                                      TTxCtrlBlk *pPktCtrlBlk,
+                                      TI_UINT32 ac)
+{
+    TTxLatencyHist *pAcHist      = &pTxCtrl->tTxLatency.tAcHist[ac];
+    TTxLatencyHist *pLinkHist    = &pTxCtrl->tTxLatency.tLinkHist[pPktCtrlBlk->tTxDescriptor.hlid];
+    TI_UINT32       uHostDelay   = pPktCtrlBlk->tTxPktParams.uDriverDelay * 1000;
+    TI_UINT32       uTotalDelay  = ENDIAN_HANDLE_LONG(pTxResultInfo->fwHandlingTime);
+    TI_UINT32       uMediumDelay = ENDIAN_HANDLE_LONG(pTxResultInfo->mediumDelay);
+    TI_UINT32       uFwDelay     = (uTotalDelay > uMediumDelay) ? (uTotalDelay - uMediumDelay) : 0;
+    TI_UINT32       aBucket[TX_LATENCY_SEGMENTS_NUM];
+
+    aBucket[TX_LATENCY_HOST]     = txCtrl_LatencyBucket (uHostDelay);
+    aBucket[TX_LATENCY_FW_QUEUE] = txCtrl_LatencyBucket (uFwDelay);
+    aBucket[TX_LATENCY_MEDIUM]   = txCtrl_LatencyBucket (uMediumDelay);
+    aBucket[TX_LATENCY_TOTAL]    = txCtrl_LatencyBucket (uHostDelay + uTotalDelay);
+
+    pAcHist->uNumPackets++;
+    pAcHist->aHist[TX_LATENCY_HOST][aBucket[TX_LATENCY_HOST]]++;
+    pAcHist->aHist[TX_LATENCY_FW_QUEUE][aBucket[TX_LATENCY_FW_QUEUE]]++;
+    pAcHist->aHist[TX_LATENCY_MEDIUM][aBucket[TX_LATENCY_MEDIUM]]++;
+    pAcHist->aHist[TX_LATENCY_TOTAL][aBucket[TX_LATENCY_TOTAL]]++;
+
+    pLinkHist->uNumPackets++;
+    pLinkHist->aHist[TX_LATENCY_HOST][aBucket[TX_LATENCY_HOST]]++;
+    pLinkHist->aHist[TX_LATENCY_FW_QUEUE][aBucket[TX_LATENCY_FW_QUEUE]]++;
+    pLinkHist->aHist[TX_LATENCY_MEDIUM][aBucket[TX_LATENCY_MEDIUM]]++;
+    pLinkHist->aHist[TX_LATENCY_TOTAL][aBucket[TX_LATENCY_TOTAL]]++;
+}
+
+
 
 /***************************************************************************
 *                       txCtrl_UpdateTxCounters                            
@@ -1327,31 +1657,33 @@ static void txCtrl_UpdateTxCounters (txCtrl_t *pTxCtrl,
                                      TxResultDescriptor_t *pTxResultInfo,
                                      TTxCtrlBlk *pPktCtrlBlk, 
                                      TI_UINT32 ac, 
-                                     TI_BOOL bIsDataPkt)
+                                     TI_BOOL bIsDataPkt,
+                                     TTxCmpltCounters *pCounters)
 {
+    TTxCmpltAcCounters   *pAcCounters = &pCounters->aAc[ac];
+    TTxCmpltLinkCounters *pLinkCounters = &pCounters->aLink[pPktCtrlBlk->tTxDescriptor.hlid];
 	TI_UINT32 pktLen;
     TI_UINT32 dataLen;
 	TI_UINT32 retryHistogramIndex;
     TI_UINT16 EventMask = 0;
-	TI_UINT32 uHlid = pPktCtrlBlk->tTxDescriptor.hlid;
 
     pktLen = (TI_UINT32)ENDIAN_HANDLE_WORD(pPktCtrlBlk->tTxDescriptor.length);
     pktLen = pktLen << 2;
 
 	/* update debug counters. */
-	pTxCtrl->dbgCounters.dbgNumTxCmplt[ac]++;
-	pTxCtrl->dbgLinkCounters.dbgNumTxCmplt[uHlid]++;
+	pAcCounters->uDbgNumTxCmplt++;
+	pLinkCounters->uDbgNumTxCmplt++;
 	if (pTxResultInfo->status == TX_SUCCESS) 
 	{
-		pTxCtrl->dbgCounters.dbgNumTxCmpltOk[ac]++;
-		pTxCtrl->dbgCounters.dbgNumTxCmpltOkBytes[ac] += pktLen;
-		pTxCtrl->dbgLinkCounters.dbgNumTxCmpltOk[uHlid]++;
-		pTxCtrl->dbgLinkCounters.dbgNumTxCmpltOkBytes[uHlid] += pktLen;
+		pAcCounters->uDbgNumTxCmpltOk++;
+		pAcCounters->uDbgNumTxCmpltOkBytes += pktLen;
+		pLinkCounters->uDbgNumTxCmpltOk++;
+		pLinkCounters->uDbgNumTxCmpltOkBytes += pktLen;
 	}
 	else
 	{
-		pTxCtrl->dbgCounters.dbgNumTxCmpltError[ac]++;
-		pTxCtrl->dbgLinkCounters.dbgNumTxCmpltError[uHlid]++;
+		pAcCounters->uDbgNumTxCmpltError++;
+		pLinkCounters->uDbgNumTxCmpltError++;
 
 		if (pTxResultInfo->status == TX_HW_ERROR        ||
 			pTxResultInfo->status == TX_KEY_NOT_FOUND   ||
@@ -1400,34 +1732,34 @@ TRACE1(pTxCtrl->hReport, REPORT_SEVERITY_WARNING, "txCtrl_UpdateTxCounters(): Tx
             if (pPktCtrlBlk->tTxPktParams.uFlags & TX_CTRL_FLAG_BROADCAST)
             {
                 /* Broadcast frame */
-                pTxCtrl->txDataCounters[ac].BroadcastFramesXmit++;
-                pTxCtrl->txDataCounters[ac].BroadcastBytesXmit += dataLen;
+                pAcCounters->uBroadcastFrames++;
+                pAcCounters->uBroadcastBytes += dataLen;
                 EventMask |= BROADCAST_BYTES_XFER;
                 EventMask |= BROADCAST_FRAMES_XFER;
             }
             else 
             {
                 /* Multicast Address */
-                pTxCtrl->txDataCounters[ac].MulticastFramesXmit++;
-                pTxCtrl->txDataCounters[ac].MulticastBytesXmit += dataLen;
+                pAcCounters->uMulticastFrames++;
+                pAcCounters->uMulticastBytes += dataLen;
                 EventMask |= MULTICAST_BYTES_XFER;
                 EventMask |= MULTICAST_FRAMES_XFER;
             }
         }
         else 
         {
-            /* Save last data Tx rate for applications' query */
-            EHwBitRate eHwTxRate = ENDIAN_HANDLE_LONG(pTxResultInfo->rate); 
-            rate_PolicyToDrv ((TI_UINT32)eHwTxRate, &pTxCtrl->eCurrentTxRate);
+            /* Save last data Tx rate for applications' query (converted once per list) */
+            pCounters->uLastHwTxRate = (TI_UINT32)ENDIAN_HANDLE_LONG(pTxResultInfo->rate);
+            pCounters->bLastHwTxRateValid = TI_TRUE;
 
             /* Directed frame statistics */
-            pTxCtrl->txDataCounters[ac].DirectedFramesXmit++;
-            pTxCtrl->txDataCounters[ac].DirectedBytesXmit += dataLen;
+            pAcCounters->uDirectedFrames++;
+            pAcCounters->uDirectedBytes += dataLen;
             EventMask |= DIRECTED_BYTES_XFER;
             EventMask |= DIRECTED_FRAMES_XFER;
         }
 
-        pTxCtrl->txDataCounters[ac].XmitOk++;
+        pAcCounters->uXmitOk++;
         EventMask |= XFER_OK;
 
 		/* update the max consecutive retry failures (if needed) */
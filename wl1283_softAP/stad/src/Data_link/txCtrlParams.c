@@ -201,6 +201,8 @@ void txCtrlParams_resetCounters(TI_HANDLE hTxCtrl)
 
     os_memoryZero(pTxCtrl->hOs, &pTxCtrl->txDataCounters, sizeof(TTxDataCounters) * MAX_NUM_OF_AC);
     os_memoryZero(pTxCtrl->hOs, &pTxCtrl->SumTotalDelayUs, sizeof(pTxCtrl->SumTotalDelayUs));
+    os_memoryZero(pTxCtrl->hOs, &pTxCtrl->tTxLatency.tAcHist, sizeof(pTxCtrl->tTxLatency.tAcHist));
+    os_memoryZero(pTxCtrl->hOs, &pTxCtrl->tTxLatency.tLinkHist, sizeof(pTxCtrl->tTxLatency.tLinkHist));
 	pTxCtrl->currentConsecutiveRetryFail = 0;
 }
 
@@ -354,6 +356,12 @@ TI_STATUS txCtrlParams_getParam(TI_HANDLE hTxCtrl, paramInfo_t *pParamInfo)
 		pParamInfo->paramLength = sizeof(TTxDataCounters) * MAX_NUM_OF_AC;
         break;
 
+    case TX_CTRL_LATENCY_STATS_PARAM:
+        os_memoryCopy( pTxCtrl->hOs, pParamInfo->content.pTxLatencyStats, &(pTxCtrl->tTxLatency),
+                       sizeof(TIWLN_TX_LATENCY_STATISTICS));
+		pParamInfo->paramLength = sizeof(TIWLN_TX_LATENCY_STATISTICS);
+        break;
+
 	case TX_CTRL_GET_DATA_FRAME_COUNTER:
 		pParamInfo->content.txPacketsCount = 0;
 		for (ac = 0; ac < MAX_NUM_OF_AC; ac++)
@@ -465,6 +473,42 @@ TRACE1(pTxCtrl->hReport, REPORT_SEVERITY_ERROR, ": Wrong AC (AC=%d > 3)\n", acID
 }
 
 
+/***********************************************************************
+ *                        txCtrlParams_InvalidateHdrTemplates
+ ***********************************************************************
+DESCRIPTION:    Invalidate the data header templates of the STA role and
+                of all AP links (rebuilt on their next packet).
+************************************************************************/
+void txCtrlParams_InvalidateHdrTemplates (TI_HANDLE hTxCtrl)
+{
+	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
+	TI_UINT32 uHlid;
+
+	pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
+	for (uHlid = 0; uHlid < WLANLINKS_MAX_LINKS; uHlid++)
+	{
+		pTxCtrl->aLinkHdrTemplate[uHlid].bValid = TI_FALSE;
+	}
+}
+
+
+/***********************************************************************
+ *                        txCtrlParams_InvalidateLinkHdrTemplate
+ ***********************************************************************
+DESCRIPTION:    Invalidate the AP link data header template (on link 
+                encryption changes).
+************************************************************************/
+void txCtrlParams_InvalidateLinkHdrTemplate (TI_HANDLE hTxCtrl, TI_UINT32 uHlid)
+{
+	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
+
+	if (uHlid < WLANLINKS_MAX_LINKS)
+	{
+		pTxCtrl->aLinkHdrTemplate[uHlid].bValid = TI_FALSE;
+	}
+}
+
+
 /***********************************************************************
  *                        txCtrlParams_setBssId
  ***********************************************************************
@@ -475,6 +519,7 @@ void txCtrlParams_setBssId (TI_HANDLE hTxCtrl, TMacAddr *pCurrBssId)
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	MAC_COPY (pTxCtrl->currBssId, *pCurrBssId);
+	txCtrlParams_InvalidateHdrTemplates (hTxCtrl);
 }
 
 
@@ -488,6 +533,7 @@ void txCtrlParams_setBssType (TI_HANDLE hTxCtrl, ScanBssType_e currBssType)
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	pTxCtrl->currBssType = currBssType;
+	txCtrlParams_InvalidateHdrTemplates (hTxCtrl);
 }
 
 
@@ -501,6 +547,7 @@ void txCtrlParams_setQosHeaderConverMode (TI_HANDLE hTxCtrl, EHeaderConvertMode
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	pTxCtrl->headerConverMode = headerConverMode;
+	txCtrlParams_InvalidateHdrTemplates (hTxCtrl);
 
 	updateDataPktPrototype(pTxCtrl);  /* Needed due to QoS mode change. */
 }
@@ -520,6 +567,7 @@ TI_STATUS txCtrlParams_SetHtControl (TI_HANDLE hTxCtrl, TtxCtrlHtControl *pHtCon
     txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
  
     pTxCtrl->tTxCtrlHtControl.bHtEnable = pHtControl->bHtEnable;
+    txCtrlParams_InvalidateHdrTemplates (hTxCtrl);
 
     return TI_OK;
 }
@@ -534,6 +582,7 @@ void txCtrlParams_setCurrentPrivacyInvokedMode (TI_HANDLE hTxCtrl, TI_BOOL curre
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	pTxCtrl->currentPrivacyInvokedMode = currentPrivacyInvokedMode;
+	pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
 }
 
 
@@ -560,6 +609,7 @@ void txCtrlParams_setEncryptionFieldSizes (TI_HANDLE hTxCtrl, TI_UINT8 encryptio
 	txCtrl_t *pTxCtrl = (txCtrl_t *)hTxCtrl;
 
 	pTxCtrl->encryptionFieldSize = encryptionFieldSize;
+	pTxCtrl->tDataHdrTemplate.bValid = TI_FALSE;
 }
 
 
@@ -111,6 +111,8 @@ TI_STATUS txCtrlParams_getParam(TI_HANDLE hTxCtrl, paramInfo_t *pParamInfo);
 TI_STATUS txCtrlParams_setParam(TI_HANDLE hTxCtrl, paramInfo_t *pParamInfo);
 TI_STATUS txCtrlParams_SetHtControl (TI_HANDLE hTxCtrl, TtxCtrlHtControl *pHtControl);
 void txCtrlParams_setBssId (TI_HANDLE hTxCtrl, TMacAddr *pCurrBssId);
+void txCtrlParams_InvalidateHdrTemplates (TI_HANDLE hTxCtrl);
+void txCtrlParams_InvalidateLinkHdrTemplate (TI_HANDLE hTxCtrl, TI_UINT32 uHlid);
 void txCtrlParams_setBssType (TI_HANDLE hTxCtrl, ScanBssType_e currBssType);
 void txCtrlParams_setQosHeaderConverMode (TI_HANDLE hTxCtrl, EHeaderConvertMode  headerConverMode);
 void txCtrlParams_setCurrentPrivacyInvokedMode (TI_HANDLE hTxCtrl, TI_BOOL currentPrivacyInvokedMode);
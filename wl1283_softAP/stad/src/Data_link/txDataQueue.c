@@ -44,7 +44,7 @@
 #include "osApi.h"
 #include "report.h"
 #include "timer.h"
-#include "queue.h"
+#include "ringQueue.h"
 #include "context.h"
 #include "Ethernet.h"
 #include "TWDriver.h"
@@ -54,10 +54,20 @@
 #include "DrvMainModules.h"
 #include "bmtrace_api.h"
 #include "report.h"
+#include "RxBuf.h"
+#include "WlanDrvIf.h"
 
 
 /* Internal Functions prototypes */
 static void txDataQ_RunScheduler (TI_HANDLE hTxDataQ);
+static void txDataQ_RunDrrScheduler (TTxDataQ *pTxDataQ);
+static TI_BOOL txDataQ_DrrSkipIdleRounds (TTxDataQ *pTxDataQ);
+static void txDataQ_ResetLinkAirtime (TDataLinkQ *pLinkQ);
+static TI_UINT32 txDataQ_LinkMacHash (TMacAddr tMacAddr);
+static TI_UINT32 txDataQ_LinkMacHashFind (TTxDataQ *pTxDataQ, TMacAddr tMacAddr);
+static void txDataQ_LinkMacHashRemove (TTxDataQ *pTxDataQ, TI_UINT32 uSlot);
+static void txDataQ_LinkMacUnindex (TTxDataQ *pTxDataQ, TI_UINT32 uHlid);
+static void txDataQ_ReleaseResources (TTxDataQ *pTxDataQ, TTxCtrlBlk *pPktCtrlBlk);
 static void txDataQ_UpdateQueuesBusyState (TTxDataQ *pTxDataQ, TI_UINT32 uTidBitMap);
 static void txDataQ_UpdateLinksBusyState (TTxDataQ *pTxDataQ, TI_UINT32 uLinkBitMap);
 static void txDataQ_TxSendPaceTimeout (TI_HANDLE hTxDataQ, TI_BOOL bTwdInitOccured);
@@ -116,7 +126,6 @@ TI_HANDLE txDataQ_Create(TI_HANDLE hOs)
 void txDataQ_Init (TStadHandlesList *pStadHandles)
 {
     TTxDataQ  *pTxDataQ = (TTxDataQ *)(pStadHandles->hTxDataQ);
-    TI_UINT32  uNodeHeaderOffset = TI_FIELD_OFFSET(TTxnStruct, tTxnQNode);
     TI_UINT8   uQueId;
     TDataLinkQ *pLinkQ;
     TI_UINT32  uHlid;
@@ -158,14 +167,14 @@ void txDataQ_Init (TStadHandlesList *pStadHandles)
         pLinkQ = &pTxDataQ->aDataLinkQ[uHlid]; /* Link queues */
         pLinkQ->bBusy = TI_FALSE; /* default is not busy */
         pLinkQ->bEnabled = TI_FALSE; /* default is not enabled */
+        txDataQ_ResetLinkAirtime (pLinkQ);
     
-        /* Create the tx data queues */
+        /* Create the tx data queues (emptied only in the driver context) */
         for (uQueId = 0; uQueId < pTxDataQ->uNumQueues; uQueId++)
         {
-            pLinkQ->aQueues[uQueId] = que_Create (pTxDataQ->hOs, 
-                                                pTxDataQ->hReport, 
-                                                pTxDataQ->aQueueMaxSize[uQueId], 
-                                                uNodeHeaderOffset);
+            pLinkQ->aQueues[uQueId] = ringQue_Create (pTxDataQ->hOs, 
+                                                      pTxDataQ->hReport, 
+                                                      pTxDataQ->aQueueMaxSize[uQueId]);
         
             /* If any Queues' allocation failed, print error, free TxDataQueue module and exit */
             if (pLinkQ->aQueues[uQueId] == NULL)
@@ -180,6 +189,9 @@ void txDataQ_Init (TStadHandlesList *pStadHandles)
             pLinkQ->aNetStackQueueStopped[uQueId] = TI_FALSE;  
         }
     }
+    /* No stations yet */
+    os_memorySet (pTxDataQ->hOs, pTxDataQ->aLinkMacHash, LINK_MAC_HASH_EMPTY, sizeof(pTxDataQ->aLinkMacHash));
+
     /* Init busy flag per AC (not also per link) */
     for (uQueId = 0; uQueId < pTxDataQ->uNumQueues; uQueId++)
     {
@@ -199,6 +211,8 @@ void txDataQ_Init (TStadHandlesList *pStadHandles)
                                                    TI_TRUE,
                                                    "TX_DATA",
                                                    sizeof("TX_DATA"));
+    /* Data path client: invoked before the management clients */
+    context_SetClientPriority (pTxDataQ->hContext, pTxDataQ->uContextId, CONTEXT_PRIORITY_HIGH);
 	
 }
 
@@ -236,6 +250,8 @@ TI_STATUS txDataQ_SetDefaults (TI_HANDLE  hTxDataQ, txDataInitParams_t *pTxDataI
 	pTxDataQ->aTxSendPaceThresh[QOS_AC_BK] = pTxDataInitParams->uTxSendPaceThresh;
 	pTxDataQ->aTxSendPaceThresh[QOS_AC_VI] = pTxDataInitParams->uTxSendPaceThresh;
 	pTxDataQ->aTxSendPaceThresh[QOS_AC_VO] = 1;     /* Don't delay voice packts! */
+	pTxDataQ->uSchedulerMode               = pTxDataInitParams->uSchedulerMode;
+	pTxDataQ->uDrrQuantumUs                = pTxDataInitParams->uDrrQuantumUs;
     
     /* configure the classifier sub-module */
     txDataQ_InitResources (pTxDataQ, &pTxDataInitParams->tDataRsrcParam);
@@ -278,7 +294,7 @@ TI_STATUS txDataQ_Destroy (TI_HANDLE hTxDataQ)
         /* Free Data queues */
         for (uQueId = 0 ; uQueId < pTxDataQ->uNumQueues ; uQueId++)
         {
-            if (que_Destroy(pLinkQ->aQueues[uQueId]) != TI_OK)
+            if (ringQue_Destroy(pLinkQ->aQueues[uQueId]) != TI_OK)
             {
                 TRACE1(pTxDataQ->hReport, REPORT_SEVERITY_ERROR, "txDataQueue_unLoad: fail to free Data Queue number: %d\n",uQueId);
     			status = TI_NOK;
@@ -350,9 +366,7 @@ void txDataQ_FlushLinkQueues (TI_HANDLE hTxDataQ, TI_UINT32 uHlid)
     {
         while (1)
         {
-            context_EnterCriticalSection (pTxDataQ->hContext);
-            pPktCtrlBlk = (TTxCtrlBlk *) que_Dequeue (pLinkQ->aQueues[uQueId]);
-            context_LeaveCriticalSection (pTxDataQ->hContext);
+            pPktCtrlBlk = (TTxCtrlBlk *) ringQue_Dequeue (pLinkQ->aQueues[uQueId]);
             if (pPktCtrlBlk == NULL) 
             {
                 break;
@@ -495,11 +509,15 @@ TI_STATUS txDataQ_InsertPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk, TI_
         return TI_NOK;
     }
 
-    /* Enqueue the packet in the appropriate Queue */
-    eStatus = que_Enqueue (pLinkQ->aQueues[uQueId], (TI_HANDLE)pPktCtrlBlk);
+    /* Enqueue the packet in the appropriate Queue.
+     * Note: The ring queue has a single producer, so the enqueue is kept in the critical section,
+     *       which serializes the network stack Tx with the intra-BSS bridge Tx (driver context).
+     *       The scheduler dequeues without a lock. 
+     */
+    eStatus = ringQue_Enqueue (pLinkQ->aQueues[uQueId], (TI_HANDLE)pPktCtrlBlk);
 
-    /* Get number of packets in current queue */
-    uQueSize = que_Size (pLinkQ->aQueues[uQueId]);
+    /* Get number of packets in current queue (the scheduler may have already dequeued some) */
+    uQueSize = ringQue_Size (pLinkQ->aQueues[uQueId]);
 
     /* If the current queue is not stopped */
     if (pTxDataQ->aQueueBusy[uQueId] == TI_FALSE)
@@ -522,8 +540,10 @@ TI_STATUS txDataQ_InsertPacket (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk, TI_
     }
 
     /* If allowed to stop network stack and the queue is full, indicate to stop network and 
-          to schedule Tx handling (both are executed below, outside the critical section!) */
-    if ((pTxDataQ->bStopNetStackTx) && (uQueSize == pTxDataQ->aQueueMaxSize[uQueId]))
+          to schedule Tx handling (both are executed below, outside the critical section!)
+       Note that the queue may be found full only upon overflow if the scheduler dequeued concurrently. */
+    if ((pTxDataQ->bStopNetStackTx) && 
+        ((uQueSize >= pTxDataQ->aQueueMaxSize[uQueId]) || (eStatus != TI_OK)))
     {
         pLinkQ->aNetStackQueueStopped[uQueId] = TI_TRUE;
         bRequestSchedule = TI_TRUE;
@@ -735,12 +755,15 @@ void txDataQ_EnableLink (TI_HANDLE hTxDataQ, TI_UINT32 uHlid)
  * \fn     txDataQ_LinkMacAdd
  * \brief  Set MAC address for the link id.
  * 
+ * The MAC address is also indexed in the MAC to HLID hash used by txDataQ_LinkMacFind.
+ *
   * \return void 
  * \sa     txDataQ_LinkMacAdd
  */ 
 TI_STATUS txDataQ_LinkMacAdd (TI_HANDLE hTxDataQ, TI_UINT32 uHlid, TMacAddr tMacAddr)
 {
     TTxDataQ *pTxDataQ = (TTxDataQ *)hTxDataQ;
+    TI_UINT32 uSlot;
 
     if (uHlid >= LINK_MAC_TABLE_SIZE)
     {
@@ -750,14 +773,74 @@ TI_STATUS txDataQ_LinkMacAdd (TI_HANDLE hTxDataQ, TI_UINT32 uHlid, TMacAddr tMac
     /* Enter critical section to protect links data */
     context_EnterCriticalSection (pTxDataQ->hContext);
 
+    /* If the link had another station, remove its MAC from the hash */
+    if (pTxDataQ->aLinkMac[uHlid].uValid)
+    {
+        txDataQ_LinkMacUnindex (pTxDataQ, uHlid);
+    }
+
     pTxDataQ->aLinkMac[uHlid].uValid = TI_TRUE;
     MAC_COPY (pTxDataQ->aLinkMac[uHlid].tMacAddr, tMacAddr);
 
+    /* Index the MAC (if the station is still known on another link, the new link replaces it) */
+    uSlot = txDataQ_LinkMacHashFind (pTxDataQ, tMacAddr);
+    if (uSlot == LINK_MAC_HASH_SIZE)
+    {
+        /* The hash is at least twice the table size, so a free slot is always found */
+        uSlot = txDataQ_LinkMacHash (tMacAddr);
+        while (pTxDataQ->aLinkMacHash[uSlot] != LINK_MAC_HASH_EMPTY)
+        {
+            uSlot = (uSlot + 1) & (LINK_MAC_HASH_SIZE - 1);
+        }
+    }
+    pTxDataQ->aLinkMacHash[uSlot] = (TI_UINT8)uHlid;
+
+    /* A new station on the link - start its airtime estimation over */
+    txDataQ_ResetLinkAirtime (&pTxDataQ->aDataLinkQ[uHlid]);
+
     context_LeaveCriticalSection (pTxDataQ->hContext);
 
     return TI_OK;
 }
 
+/** 
+ * \fn     txDataQ_UpdateLinkAirtime
+ * \brief  Update the link airtime estimation by a Tx result
+ * 
+ * The airtime of 1024 bytes is estimated by the Tx rate, multiplied by the number of
+ *   transmissions (1 + ACK failures), and averaged over the recent Tx results.
+ * A failed packet has no valid rate, so it is counted at the last successful rate of the link.
+ *
+ * \note   Called by the TxCtrl upon data packet Tx-complete (driver context)
+ * \param  hTxDataQ     - The object                                          
+ * \param  uHlid        - The packet's link ID
+ * \param  uRateMbps    - The Tx rate in Mbps, or 0 if the packet failed
+ * \param  uAckFailures - Number of transmissions without ACK
+ * \return void 
+ * \sa     txDataQ_RunDrrScheduler
+ */ 
+void txDataQ_UpdateLinkAirtime (TI_HANDLE hTxDataQ, TI_UINT32 uHlid, TI_UINT32 uRateMbps, TI_UINT32 uAckFailures)
+{
+    TTxDataQ   *pTxDataQ = (TTxDataQ *)hTxDataQ;
+    TDataLinkQ *pLinkQ;
+    TI_INT32    iSample;
+
+    if (uHlid >= WLANLINKS_MAX_LINKS)
+    {
+        return;
+    }
+    pLinkQ = &pTxDataQ->aDataLinkQ[uHlid];
+
+    if (uRateMbps != 0)
+    {
+        pLinkQ->uLastRateMbps = uRateMbps;
+    }
+
+    iSample = (TI_INT32)((TX_AIRTIME_KBYTE_BITS / pLinkQ->uLastRateMbps) * (1 + uAckFailures));
+    pLinkQ->uAirtimePerKbyte += (iSample - (TI_INT32)pLinkQ->uAirtimePerKbyte) >> TX_AIRTIME_EWMA_SHIFT;
+}
+
+
 /** 
  * \fn     txDataQ_LinkMacRemove
  * \brief  Set LinkMac table entry as invalid
@@ -776,6 +859,10 @@ void txDataQ_LinkMacRemove (TI_HANDLE hTxDataQ, TI_UINT32 uHlid)
     }
     /* Enter critical section to protect links data */
     context_EnterCriticalSection (pTxDataQ->hContext);
+    if (pTxDataQ->aLinkMac[uHlid].uValid)
+    {
+        txDataQ_LinkMacUnindex (pTxDataQ, uHlid);
+    }
     pTxDataQ->aLinkMac[uHlid].uValid = TI_FALSE;
     context_LeaveCriticalSection (pTxDataQ->hContext);
 }
@@ -791,39 +878,146 @@ void txDataQ_LinkMacRemove (TI_HANDLE hTxDataQ, TI_UINT32 uHlid)
 TI_STATUS txDataQ_LinkMacFind (TI_HANDLE hTxDataQ, TI_UINT32 *uHlid, TMacAddr tMacAddr)
 {
     TTxDataQ *pTxDataQ = (TTxDataQ *)hTxDataQ;
-	int i;
-	int j;
+    TI_UINT32 uSlot;
 
-	/* Enter critical section to protect links data */
-	context_EnterCriticalSection (pTxDataQ->hContext);
-	for (i=0; i<LINK_MAC_TABLE_SIZE; i++) 
-	{
-		if (!pTxDataQ->aLinkMac[i].uValid)
-		{
-			/* entry not valid, skip to next entry */
-			continue;
-		}
-		for (j=MAC_ADDR_LEN-1; j>=0; j--) 
-		{
-			if (pTxDataQ->aLinkMac[i].tMacAddr[j] != tMacAddr[j])
-			{
-				/* different MAC, skip to next entry */
-				break;
-			}
-		}
-		if (j < 0) 
-		{
-			/* Found, return index */
-			*uHlid = i;
-			context_LeaveCriticalSection (pTxDataQ->hContext);
-			return TI_OK;
-		}
-	}
-	context_LeaveCriticalSection (pTxDataQ->hContext);
+    /* Enter critical section to protect links data */
+    context_EnterCriticalSection (pTxDataQ->hContext);
+    uSlot = txDataQ_LinkMacHashFind (pTxDataQ, tMacAddr);
+    if (uSlot != LINK_MAC_HASH_SIZE)
+    {
+        /* Found, return index */
+        *uHlid = pTxDataQ->aLinkMacHash[uSlot];
+        context_LeaveCriticalSection (pTxDataQ->hContext);
+        return TI_OK;
+    }
+    context_LeaveCriticalSection (pTxDataQ->hContext);
 
-	/* Not found */
-	*uHlid = 0xff; /* for debug */
-	return TI_NOK;
+    /* Not found */
+    *uHlid = 0xff; /* for debug */
+    return TI_NOK;
+}
+
+
+/** 
+ * \fn     txDataQ_LinkMacHash
+ * \brief  Get the home slot of a MAC address in the MAC to HLID hash
+ *
+ * \note   A local inline function! The NIC specific bytes differ the most between stations,
+ *         and the OUI last byte high nibble is mixed in for vendors with a few OUIs.
+ * \param  tMacAddr - The MAC address
+ * \return The hash slot
+ * \sa     txDataQ_LinkMacHashFind
+ */
+static INLINE TI_UINT32 txDataQ_LinkMacHash (TMacAddr tMacAddr)
+{
+    return (tMacAddr[5] ^ (tMacAddr[4] << 1) ^ (tMacAddr[3] << 2) ^ (tMacAddr[2] >> 4)) & (LINK_MAC_HASH_SIZE - 1);
+}
+
+
+/** 
+ * \fn     txDataQ_LinkMacHashFind
+ * \brief  Find the MAC to HLID hash slot of a MAC address
+ *
+ * \note   Called within the critical section.
+ * \param  pTxDataQ - The object
+ * \param  tMacAddr - The MAC address
+ * \return The slot index, or LINK_MAC_HASH_SIZE if the MAC address is not in the hash
+ * \sa     txDataQ_LinkMacFind
+ */
+static TI_UINT32 txDataQ_LinkMacHashFind (TTxDataQ *pTxDataQ, TMacAddr tMacAddr)
+{
+    TI_UINT8  *pHash = pTxDataQ->aLinkMacHash;
+    TI_UINT32  uSlot = txDataQ_LinkMacHash (tMacAddr);
+    TI_UINT32  i;
+
+    for (i = 0; (i < LINK_MAC_HASH_SIZE) && (pHash[uSlot] != LINK_MAC_HASH_EMPTY); i++)
+    {
+        if (MAC_EQUAL (pTxDataQ->aLinkMac[pHash[uSlot]].tMacAddr, tMacAddr))
+        {
+            return uSlot;
+        }
+        uSlot = (uSlot + 1) & (LINK_MAC_HASH_SIZE - 1);
+    }
+
+    return LINK_MAC_HASH_SIZE;
+}
+
+
+/** 
+ * \fn     txDataQ_LinkMacHashRemove
+ * \brief  Free a MAC to HLID hash slot
+ *
+ * Free the given slot, and move back the following entries of its probe sequence
+ *   that would otherwise become unreachable (backward shift deletion).
+ *
+ * \note   Called within the critical section.
+ * \param  pTxDataQ - The object
+ * \param  uSlot    - The slot to free
+ * \return void
+ * \sa     txDataQ_LinkMacRemove
+ */
+static void txDataQ_LinkMacHashRemove (TTxDataQ *pTxDataQ, TI_UINT32 uSlot)
+{
+    TI_UINT8  *pHash = pTxDataQ->aLinkMacHash;
+    TI_UINT32  uNext = uSlot;
+    TI_UINT32  uHome;
+
+    while (1)
+    {
+        uNext = (uNext + 1) & (LINK_MAC_HASH_SIZE - 1);
+        if (pHash[uNext] == LINK_MAC_HASH_EMPTY)
+        {
+            break;
+        }
+
+        uHome = txDataQ_LinkMacHash (pTxDataQ->aLinkMac[pHash[uNext]].tMacAddr);
+
+        /* Move the entry to the free slot unless its home slot lies cyclically in (uSlot, uNext] */
+        if (((uNext - uHome) & (LINK_MAC_HASH_SIZE - 1)) >= ((uNext - uSlot) & (LINK_MAC_HASH_SIZE - 1)))
+        {
+            pHash[uSlot] = pHash[uNext];
+            uSlot = uNext;
+        }
+    }
+
+    pHash[uSlot] = LINK_MAC_HASH_EMPTY;
+}
+
+
+/** 
+ * \fn     txDataQ_LinkMacUnindex
+ * \brief  Remove the MAC address of a link from the MAC to HLID hash
+ *
+ * If the MAC address is indexed to another link, the hash is left unchanged.
+ * If another valid link has the same MAC address, the slot is moved to that link.
+ *
+ * \note   Called within the critical section, for a valid link.
+ * \param  pTxDataQ - The object
+ * \param  uHlid    - The link
+ * \return void
+ * \sa     txDataQ_LinkMacRemove
+ */
+static void txDataQ_LinkMacUnindex (TTxDataQ *pTxDataQ, TI_UINT32 uHlid)
+{
+    TI_UINT8  *pMacAddr = pTxDataQ->aLinkMac[uHlid].tMacAddr;
+    TI_UINT32  uSlot = txDataQ_LinkMacHashFind (pTxDataQ, pMacAddr);
+    TI_UINT32  i;
+
+    if ((uSlot == LINK_MAC_HASH_SIZE) || (pTxDataQ->aLinkMacHash[uSlot] != uHlid))
+    {
+        return;
+    }
+
+    for (i = 0; i < LINK_MAC_TABLE_SIZE; i++)
+    {
+        if ((i != uHlid) && pTxDataQ->aLinkMac[i].uValid && MAC_EQUAL (pTxDataQ->aLinkMac[i].tMacAddr, pMacAddr))
+        {
+            pTxDataQ->aLinkMacHash[uSlot] = (TI_UINT8)i;
+            return;
+        }
+    }
+
+    txDataQ_LinkMacHashRemove (pTxDataQ, uSlot);
 }
 
 /** 
@@ -910,6 +1104,60 @@ TI_STATUS txDataQ_AllocCheckResources (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlB
 void txDataQ_FreeResources (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk)
 {
     TTxDataQ *pTxDataQ = (TTxDataQ *)hTxDataQ;
+
+    /* Enter critical section to protect classifier data and queue access */
+    context_EnterCriticalSection (pTxDataQ->hContext);
+
+    txDataQ_ReleaseResources (pTxDataQ, pPktCtrlBlk);
+
+    /* Leave critical section */
+    context_LeaveCriticalSection (pTxDataQ->hContext);
+}
+
+
+/** 
+ * \fn     txDataQ_FreeResourcesList
+ * \brief  Free the TxData resources of a list of packets
+ * 
+ * As txDataQ_FreeResources, with one critical section for all packets (upon Tx-complete of multiple packets).
+ *
+ * \note   
+ * \param  hTxDataQ    - The object                                          
+ * \param  apPktCtrlBlks - The packets
+ * \param  uNumPkts    - Number of packets
+ * \return void 
+ * \sa     txDataQ_FreeResources
+ */ 
+void txDataQ_FreeResourcesList (TI_HANDLE hTxDataQ, TTxCtrlBlk **apPktCtrlBlks, TI_UINT32 uNumPkts)
+{
+    TTxDataQ *pTxDataQ = (TTxDataQ *)hTxDataQ;
+    TI_UINT32 i;
+
+    /* Enter critical section to protect classifier data and queue access */
+    context_EnterCriticalSection (pTxDataQ->hContext);
+
+    for (i = 0; i < uNumPkts; i++)
+    {
+        txDataQ_ReleaseResources (pTxDataQ, apPktCtrlBlks[i]);
+    }
+
+    /* Leave critical section */
+    context_LeaveCriticalSection (pTxDataQ->hContext);
+}
+
+
+/** 
+ * \fn     txDataQ_ReleaseResources
+ * \brief  Free the TxData resources of a packet
+ * 
+ * \note   Called within the critical section.
+ * \param  pTxDataQ    - The object                                          
+ * \param  pPktCtrlBlk - The packet
+ * \return void 
+ * \sa     txDataQ_FreeResources
+ */ 
+static void txDataQ_ReleaseResources (TTxDataQ *pTxDataQ, TTxCtrlBlk *pPktCtrlBlk)
+{
     TDataResources *pDataRsrc = &pTxDataQ->tDataRsrc;
     TI_UINT32 uHlid = pPktCtrlBlk->tTxDescriptor.hlid;
     TI_UINT32 uAc;
@@ -920,9 +1168,6 @@ void txDataQ_FreeResources (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk)
         return;
     }
 
-    /* Enter critical section to protect classifier data and queue access */
-    context_EnterCriticalSection (pTxDataQ->hContext);
-
     /* Extract original AC (saved by txDataQ_AllocCheckResources) from tx ctrl block */
     uAc = GET_TX_CTRL_FLAG_RSRC_AC(pPktCtrlBlk);
 
@@ -957,9 +1202,6 @@ void txDataQ_FreeResources (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk)
         }
 #endif
     }
-
-    /* Leave critical section */
-    context_LeaveCriticalSection (pTxDataQ->hContext);
 }
 
 /** 
@@ -1014,6 +1256,58 @@ void txDataQ_GetBcastLink  (TI_HANDLE hTxDataQ, TI_UINT32 *uHlid)
 
     *uHlid = pTxDataQ->uBcastHlid;
 }
+
+
+/** 
+ * \fn     txDataQ_ForwardRxPacket
+ * \brief  Forward a received packet to a station in the BSS (intra-BSS bridge)
+ * 
+ * The Rx buffer is turned into a Tx packet as is, and inserted to the destination link
+ *   queues (already found by the Rx), instead of passing through the network interface Rx and Tx.
+ *
+ * \note   Called by the RxData in the driver context. The packet is freed on failure.
+ * \param  hTxDataQ - The object                                          
+ * \param  pRxBuf   - The Rx buffer
+ * \param  pPacket  - The Ethernet packet in the Rx buffer
+ * \param  uLength  - The packet length
+ * \param  uHlid    - The destination link
+ * \return TI_OK - if the packet was queued, TI_NOK - if the packet was dropped. 
+ * \sa     txDataQ_InsertPacket
+ */ 
+TI_STATUS txDataQ_ForwardRxPacket (TI_HANDLE hTxDataQ, void *pRxBuf, void *pPacket, TI_UINT16 uLength, TI_UINT32 uHlid)
+{
+    TTxDataQ        *pTxDataQ = (TTxDataQ *)hTxDataQ;
+    TTxCtrlBlk      *pPktCtrlBlk;
+    TIntraBssBridge  tBridge;
+
+    /* Allocate a TxCtrlBlk for the packet, and drop the packet if none is available */
+    pPktCtrlBlk = TWD_txCtrlBlk_Alloc (pTxDataQ->hTWD);
+    if (pPktCtrlBlk == NULL)
+    {
+        RxBufFree (pTxDataQ->hOs, pRxBuf);
+        pTxDataQ->uNoResourcesCount++;
+        return TI_NOK;
+    }
+
+    SET_PKT_TYPE_IF_ROLE_AP(pPktCtrlBlk);
+    pPktCtrlBlk->tTxDescriptor.startTime = os_timeStampMs (pTxDataQ->hOs);
+    pPktCtrlBlk->tTxDescriptor.length    = uLength;
+    pPktCtrlBlk->tTxPktParams.pInputPkt  = wlanDrvIf_RxBufToTxPacket (pTxDataQ->hOs, pRxBuf, pPacket, uLength);
+
+    /* Point the first BDL buffer to the Ethernet header, and the second buffer to the rest of the packet */
+    pPktCtrlBlk->tTxnStruct.aBuf[0] = (TI_UINT8 *)pPacket;
+    pPktCtrlBlk->tTxnStruct.aLen[0] = ETHERNET_HDR_LEN;
+    pPktCtrlBlk->tTxnStruct.aBuf[1] = (TI_UINT8 *)pPacket + ETHERNET_HDR_LEN;
+    pPktCtrlBlk->tTxnStruct.aLen[1] = uLength - ETHERNET_HDR_LEN;
+    pPktCtrlBlk->tTxnStruct.aLen[2] = 0;
+
+    pTxDataQ->uBridgeFwdCount++;
+
+    /* The link is known, so the packet is queued without a MAC lookup */
+    tBridge.eDecision = INTRA_BSS_BRIDGE_UNICAST;
+    tBridge.uParam    = uHlid;
+    return txDataQ_InsertPacket (hTxDataQ, pPktCtrlBlk, 0, &tBridge);
+}
 /***************************************************************************
 *                       DEBUG  FUNCTIONS  IMPLEMENTATION			       *
 ****************************************************************************/
@@ -1045,9 +1339,12 @@ void txDataQ_PrintModuleParams (TI_HANDLE hTxDataQ)
     WLAN_OS_REPORT(("uNumQueues      = %d\n",pTxDataQ->uNumQueues));
     WLAN_OS_REPORT(("uNextQueId      = %d\n",pTxDataQ->uNextQueId));
     WLAN_OS_REPORT(("uContextId      = %d\n",pTxDataQ->uContextId));
+    WLAN_OS_REPORT(("uSchedulerMode  = %d\n",pTxDataQ->uSchedulerMode));
+    WLAN_OS_REPORT(("uDrrQuantumUs   = %d\n",pTxDataQ->uDrrQuantumUs));
 
     WLAN_OS_REPORT(("uLinkNotFound   = %d\n",pTxDataQ->uLinkNotFoundCount));
     WLAN_OS_REPORT(("uNoResources    = %d\n",pTxDataQ->uNoResourcesCount));
+    WLAN_OS_REPORT(("uBridgeFwd      = %d\n",pTxDataQ->uBridgeFwdCount));
     WLAN_OS_REPORT(("aQueueMaxSize     %2d %2d %2d %2d\n", pTxDataQ->aQueueMaxSize[0], pTxDataQ->aQueueMaxSize[1], pTxDataQ->aQueueMaxSize[2], pTxDataQ->aQueueMaxSize[3]));
     WLAN_OS_REPORT(("aTxSendPaceThresh %2d %2d %2d %2d\n", pTxDataQ->aTxSendPaceThresh[0], pTxDataQ->aTxSendPaceThresh[1], pTxDataQ->aTxSendPaceThresh[2], pTxDataQ->aTxSendPaceThresh[3]));
     WLAN_OS_REPORT(("aQueueBusy        %2d %2d %2d %2d\n", pTxDataQ->aQueueBusy[0], pTxDataQ->aQueueBusy[1], pTxDataQ->aQueueBusy[2], pTxDataQ->aQueueBusy[3]));
@@ -1069,7 +1366,7 @@ void txDataQ_PrintModuleParams (TI_HANDLE hTxDataQ)
         for (qIndex = 0; qIndex < MAX_NUM_OF_AC; qIndex++)
         {
             WLAN_OS_REPORT(("  Que %d: ", qIndex));
-            que_Print (pLinkQ->aQueues[qIndex]);
+            ringQue_Print (pLinkQ->aQueues[qIndex]);
         }
     }
 }
@@ -1096,6 +1393,8 @@ void txDataQ_PrintQueueStatistics (TI_HANDLE hTxDataQ)
     
     WLAN_OS_REPORT(("uClsfrMismatchCount      = %d\n",pTxDataQ->uClsfrMismatchCount));
     WLAN_OS_REPORT(("uTxSendPaceTimeoutsCount = %d\n",pTxDataQ->uTxSendPaceTimeoutsCount));
+    WLAN_OS_REPORT(("uClsfrFlowCacheHits      = %d\n",pTxDataQ->tClsfrLookup.uFlowCacheHits));
+    WLAN_OS_REPORT(("uClsfrFlowCacheMisses    = %d\n",pTxDataQ->tClsfrLookup.uFlowCacheMisses));
     
     /* 
      * init all queues in all links 
@@ -1114,6 +1413,10 @@ void txDataQ_PrintQueueStatistics (TI_HANDLE hTxDataQ)
         WLAN_OS_REPORT(("  uRequeuePacket: %8d %8d %8d %8d\n", pLinkQ->aQueueCounters[0].uRequeuePacket, pLinkQ->aQueueCounters[1].uRequeuePacket, pLinkQ->aQueueCounters[2].uRequeuePacket, pLinkQ->aQueueCounters[3].uRequeuePacket ));
         WLAN_OS_REPORT(("  uXmittedPacket: %8d %8d %8d %8d\n", pLinkQ->aQueueCounters[0].uXmittedPacket, pLinkQ->aQueueCounters[1].uXmittedPacket, pLinkQ->aQueueCounters[2].uXmittedPacket, pLinkQ->aQueueCounters[3].uXmittedPacket ));
         WLAN_OS_REPORT(("  uDroppedPacket: %8d %8d %8d %8d\n", pLinkQ->aQueueCounters[0].uDroppedPacket, pLinkQ->aQueueCounters[1].uDroppedPacket, pLinkQ->aQueueCounters[2].uDroppedPacket, pLinkQ->aQueueCounters[3].uDroppedPacket ));
+        WLAN_OS_REPORT(("  Airtime: %d usec/KB (last rate %d Mbps), deficit %d, charged %d usec, quanta %d\n", pLinkQ->uAirtimePerKbyte, pLinkQ->uLastRateMbps, pLinkQ->iDeficit, pLinkQ->tAirtimeCounters.uAirtimeUsec, pLinkQ->tAirtimeCounters.uQuanta));
+        WLAN_OS_REPORT(("  Queue delay: avg %d ms, max %d ms (%d packets)\n", 
+                        pLinkQ->tAirtimeCounters.uDequeuedPackets ? pLinkQ->tAirtimeCounters.uQueueDelaySumMs / pLinkQ->tAirtimeCounters.uDequeuedPackets : 0,
+                        pLinkQ->tAirtimeCounters.uQueueDelayMaxMs, pLinkQ->tAirtimeCounters.uDequeuedPackets));
     }
 
     /* Print data resouces counters */
@@ -1145,8 +1448,11 @@ void txDataQ_ResetQueueStatistics (TI_HANDLE hTxDataQ)
             pLinkQ = &pTxDataQ->aDataLinkQ[uHlid]; /* Link queues */
 
             os_memoryZero(pTxDataQ->hOs, &pLinkQ->aQueueCounters, sizeof(pLinkQ->aQueueCounters));
+            os_memoryZero(pTxDataQ->hOs, &pLinkQ->tAirtimeCounters, sizeof(pLinkQ->tAirtimeCounters));
 	}
     pTxDataQ->uTxSendPaceTimeoutsCount = 0;
+    pTxDataQ->tClsfrLookup.uFlowCacheHits = 0;
+    pTxDataQ->tClsfrLookup.uFlowCacheMisses = 0;
 }
 
 /** 
@@ -1192,7 +1498,7 @@ static void txDataQ_PrintResources (TTxDataQ *pTxDataQ)
  * 
  * This function is the Data-Queue scheduler.
  * It selects a packet to transmit from the tx queues and sends it to the TxCtrl.
- * The queues are selected in a round-robin order.
+ * The queues are selected in a round-robin order, or by the airtime DRR scheduler if configured.
  * The function is called by one of:
  *     txDataQ_Run()
  *     txDataQ_UpdateBusyMap()
@@ -1215,6 +1521,12 @@ static void txDataQ_RunScheduler (TI_HANDLE hTxDataQ)
 	TDataLinkQ *pLinkQ;
     TI_BOOL bStopScheduler = TI_FALSE;
 
+    if (pTxDataQ->uSchedulerMode == TX_DATA_SCHED_AIRTIME_DRR)
+    {
+        txDataQ_RunDrrScheduler (pTxDataQ);
+        return;
+    }
+
     while(!bStopScheduler) 
     {
         bStopScheduler = TI_TRUE;
@@ -1257,10 +1569,8 @@ static void txDataQ_RunScheduler (TI_HANDLE hTxDataQ)
                     uQueId++;
                     continue;
                 }
-                    		/* Dequeue a packet in a critical section */
-                context_EnterCriticalSection (pTxDataQ->hContext);
-        		pPktCtrlBlk = (TTxCtrlBlk *) que_Dequeue (pLinkQ->aQueues[uQueId]);
-                context_LeaveCriticalSection (pTxDataQ->hContext);
+                /* Dequeue a packet (no lock needed, this is the only consumer) */
+        		pPktCtrlBlk = (TTxCtrlBlk *) ringQue_Dequeue (pLinkQ->aQueues[uQueId]);
         
         		/* If the queue was empty, continue to the next queue */
         		if (pPktCtrlBlk == NULL)
@@ -1289,20 +1599,16 @@ static void txDataQ_RunScheduler (TI_HANDLE hTxDataQ)
                 {
                     TI_STATUS eQueStatus;
     
-                    /* Requeue the packet in a critical section */
-                    context_EnterCriticalSection (pTxDataQ->hContext);
-                    eQueStatus = que_Requeue (pLinkQ->aQueues[uQueId], (TI_HANDLE)pPktCtrlBlk);
+                    /* Requeue the packet at the queue tail (can't overflow since the queue keeps it aside) */
+                    eQueStatus = ringQue_Requeue (pLinkQ->aQueues[uQueId], (TI_HANDLE)pPktCtrlBlk);
                     if (eQueStatus != TI_OK) 
                     {
-                        /* If the packet can't be queued drop it */
-                        /* Note: may happen only if this thread was preempted between the   
-                           dequeue and requeue and new packets were inserted into this quque */
+                        /* If the packet can't be queued drop it (not expected) */
                         txCtrl_FreePacket (pTxDataQ->hTxCtrl, pPktCtrlBlk, TI_NOK);
 #ifdef TI_DBG
                         pLinkQ->aQueueCounters[uQueId].uDroppedPacket++;
 #endif /* TI_DBG */
                     }
-                    context_LeaveCriticalSection (pTxDataQ->hContext);
     
 #ifdef TI_DBG
                     pLinkQ->aQueueCounters[uQueId].uRequeuePacket++;
@@ -1332,6 +1638,259 @@ static void txDataQ_RunScheduler (TI_HANDLE hTxDataQ)
 
 }
 
+
+/** 
+ * \fn     txDataQ_RunDrrScheduler
+ * \brief  The airtime deficit round-robin Tx scheduler
+ * 
+ * The links are visited in a round-robin order, and each visit grants the link an airtime
+ *   quantum. The link sends packets while it has credit, and each packet is charged by its
+ *   estimated airtime (length and the link airtime estimation), so a slow link sends fewer
+ *   packets per round and all links get about the same share of the medium.
+ * Within a link the queues are served in strict priority order (VO, VI, BE, BK).
+ * A link that is emptied loses its credit, and the credit kept between visits is limited
+ *   to one quantum (the deficit may be negative, and is then paid back in the next rounds).
+ * If a whole round passes without sending a packet while links still wait only for credit,
+ *   the rounds they need are granted at once (see txDataQ_DrrSkipIdleRounds).
+ * The scheduler stops only when every enabled link is empty or busy.
+ *
+ * \note   
+ * \param  pTxDataQ - The object                                          
+ * \return void 
+ * \sa     txDataQ_RunScheduler, txDataQ_UpdateLinkAirtime
+ */
+static void txDataQ_RunDrrScheduler (TTxDataQ *pTxDataQ)
+{
+    TI_UINT32   uNow = os_timeStampMs (pTxDataQ->hOs);   /* One time stamp per run, for the queue delay */
+    TI_UINT32   uHlid = pTxDataQ->uNextHlid;
+    TI_UINT32   uIdleLinkCount = 0;  /* Links visited since the last sent packet (for exit criteria) */
+    TI_INT32    iQuantum = (TI_INT32)pTxDataQ->uDrrQuantumUs;
+    TDataLinkQ *pLinkQ;
+    TTxCtrlBlk *pPktCtrlBlk;
+    EStatusXmit eStatus;
+    TI_UINT32   uQueId = 0;
+    TI_UINT32   uPrio;
+    TI_UINT32   uAirtime;
+    TI_UINT32   uDelay;
+
+    while ((uIdleLinkCount < WLANLINKS_MAX_LINKS) || txDataQ_DrrSkipIdleRounds (pTxDataQ))
+    {
+        if (uIdleLinkCount >= WLANLINKS_MAX_LINKS)
+        {
+            /* Skipped the idle rounds, start a new round from the current link */
+            uIdleLinkCount = 0;
+        }
+        if (uHlid >= WLANLINKS_MAX_LINKS)
+        {
+            uHlid = 0;
+        }
+        pLinkQ = &pTxDataQ->aDataLinkQ[uHlid];
+        uIdleLinkCount++;
+
+        if ((!pLinkQ->bEnabled) || (pLinkQ->bBusy))
+        {
+            uHlid++;
+            continue;
+        }
+
+        /* Grant the link its quantum for this visit */
+        pLinkQ->iDeficit += iQuantum;
+        if (pLinkQ->iDeficit > iQuantum)
+        {
+            pLinkQ->iDeficit = iQuantum;
+        }
+
+        while (pLinkQ->iDeficit > 0)
+        {
+            /* If the Data port is closed, indicate end of current packets burst and exit */
+            if ( !pTxDataQ->bDataPortEnable )
+            {
+                pTxDataQ->uNextHlid = uHlid;
+                TWD_txXfer_EndOfBurst (pTxDataQ->hTWD);
+                return;
+            }
+
+            /* Dequeue from the highest priority queue that has a packet and is not busy */
+            pPktCtrlBlk = NULL;
+            for (uPrio = 0; uPrio < pTxDataQ->uNumQueues; uPrio++)
+            {
+                uQueId = aQueuePriorityTable[uPrio];
+                if (pTxDataQ->aQueueBusy[uQueId])
+                {
+                    continue;
+                }
+
+                /* No lock needed, this is the only consumer */
+                pPktCtrlBlk = (TTxCtrlBlk *) ringQue_Dequeue (pLinkQ->aQueues[uQueId]);
+                if (pPktCtrlBlk != NULL)
+                {
+                    break;
+                }
+
+                if ((pTxDataQ->bStopNetStackTx) && pLinkQ->aNetStackQueueStopped[uQueId])
+                {
+                    pLinkQ->aNetStackQueueStopped[uQueId] = TI_FALSE;
+                    /*Resume the TX process as our date queues are empty*/
+                    wlanDrvIf_ResumeTx (pTxDataQ->hOs);
+                }
+            }
+
+            /* Nothing to send - an emptied link doesn't keep its credit */
+            if (pPktCtrlBlk == NULL)
+            {
+                if ((ringQue_Size (pLinkQ->aQueues[QOS_AC_BE]) + ringQue_Size (pLinkQ->aQueues[QOS_AC_BK]) +
+                     ringQue_Size (pLinkQ->aQueues[QOS_AC_VI]) + ringQue_Size (pLinkQ->aQueues[QOS_AC_VO])) == 0)
+                {
+                    pLinkQ->iDeficit = 0;
+                }
+                break;
+            }
+
+#ifdef TI_DBG
+            pLinkQ->aQueueCounters[uQueId].uDequeuePacket++;
+#endif /* TI_DBG */
+            /* Get the packet cost before it is sent (the length is still the Ethernet length in bytes,
+             *   and the start time is translated to FW time)
+             */
+            uAirtime = (pPktCtrlBlk->tTxDescriptor.length * pLinkQ->uAirtimePerKbyte) >> 10;
+            uDelay   = uNow - pPktCtrlBlk->tTxDescriptor.startTime;
+
+            /* Send the packet */
+            eStatus = txCtrl_XmitData (pTxDataQ->hTxCtrl, pPktCtrlBlk);
+
+            /* If the packet was not sent, requeue it and end the link visit (the link or queue is busy) */
+            if (eStatus == STATUS_XMIT_BUSY)
+            {
+                if (ringQue_Requeue (pLinkQ->aQueues[uQueId], (TI_HANDLE)pPktCtrlBlk) != TI_OK)
+                {
+                    /* If the packet can't be queued drop it (not expected) */
+                    txCtrl_FreePacket (pTxDataQ->hTxCtrl, pPktCtrlBlk, TI_NOK);
+#ifdef TI_DBG
+                    pLinkQ->aQueueCounters[uQueId].uDroppedPacket++;
+#endif /* TI_DBG */
+                }
+#ifdef TI_DBG
+                pLinkQ->aQueueCounters[uQueId].uRequeuePacket++;
+#endif /* TI_DBG */
+                break;
+            }
+
+            /* Charge the link by the packet airtime */
+            pLinkQ->iDeficit -= (TI_INT32)uAirtime;
+            uIdleLinkCount = 0;
+
+            pLinkQ->tAirtimeCounters.uAirtimeUsec     += uAirtime;
+            pLinkQ->tAirtimeCounters.uQueueDelaySumMs += uDelay;
+            pLinkQ->tAirtimeCounters.uDequeuedPackets++;
+            if (uDelay > pLinkQ->tAirtimeCounters.uQueueDelayMaxMs)
+            {
+                pLinkQ->tAirtimeCounters.uQueueDelayMaxMs = uDelay;
+            }
+#ifdef TI_DBG
+            pLinkQ->aQueueCounters[uQueId].uXmittedPacket++;
+#endif /* TI_DBG */
+        }
+
+        pLinkQ->tAirtimeCounters.uQuanta++;
+        uHlid++;
+    }
+
+    pTxDataQ->uNextHlid = uHlid;
+    TWD_txXfer_EndOfBurst (pTxDataQ->hTWD);
+}
+
+
+/** 
+ * \fn     txDataQ_DrrSkipIdleRounds
+ * \brief  Grant at once the DRR rounds that the waiting links need for credit
+ * 
+ * Called when a whole DRR round passed without sending a packet.
+ * A link waits only for credit if it is enabled and not busy, has a packet in a queue
+ *   that is not busy, and its deficit is still not positive after its last visit.
+ * Such a link needs (-deficit / quantum) + 1 more quanta for a positive credit, and since
+ *   the next visit grants one, the fewest rounds needed by any waiting link minus one are
+ *   granted to all of them.
+ * Without this, a link that is more than one quantum negative would stall the scheduler
+ *   (nothing is sent, so no Tx-complete or net-stack resume would run it again).
+ *
+ * \note   
+ * \param  pTxDataQ - The object                                          
+ * \return TI_TRUE if some link waits for credit (so another round is needed), TI_FALSE if all links are empty or busy
+ * \sa     txDataQ_RunDrrScheduler
+ */
+static TI_BOOL txDataQ_DrrSkipIdleRounds (TTxDataQ *pTxDataQ)
+{
+    TI_INT32    iQuantum = (TI_INT32)pTxDataQ->uDrrQuantumUs;
+    TI_UINT32   uMinRounds = 0xFFFFFFFF;
+    TI_UINT32   uRounds;
+    TI_UINT32   uHlid;
+    TI_UINT32   uQueId;
+    TDataLinkQ *pLinkQ;
+    TI_BOOL     aWaiting[WLANLINKS_MAX_LINKS];
+
+    for (uHlid = 0; uHlid < WLANLINKS_MAX_LINKS; uHlid++)
+    {
+        pLinkQ = &pTxDataQ->aDataLinkQ[uHlid];
+        aWaiting[uHlid] = TI_FALSE;
+
+        if ((!pLinkQ->bEnabled) || (pLinkQ->bBusy) || (pLinkQ->iDeficit > 0))
+        {
+            continue;
+        }
+        for (uQueId = 0; uQueId < pTxDataQ->uNumQueues; uQueId++)
+        {
+            if ((!pTxDataQ->aQueueBusy[uQueId]) && (ringQue_Size (pLinkQ->aQueues[uQueId]) != 0))
+            {
+                aWaiting[uHlid] = TI_TRUE;
+                break;
+            }
+        }
+        if (aWaiting[uHlid])
+        {
+            /* The rounds needed besides the next visit */
+            uRounds = (TI_UINT32)(-pLinkQ->iDeficit) / (TI_UINT32)iQuantum;
+            if (uRounds < uMinRounds)
+            {
+                uMinRounds = uRounds;
+            }
+        }
+    }
+
+    if (uMinRounds == 0xFFFFFFFF)
+    {
+        return TI_FALSE;
+    }
+
+    for (uHlid = 0; uHlid < WLANLINKS_MAX_LINKS; uHlid++)
+    {
+        if (aWaiting[uHlid])
+        {
+            pLinkQ = &pTxDataQ->aDataLinkQ[uHlid];
+            pLinkQ->iDeficit += (TI_INT32)uMinRounds * iQuantum;
+            pLinkQ->tAirtimeCounters.uQuanta += uMinRounds;
+        }
+    }
+
+    return TI_TRUE;
+}
+
+
+/** 
+ * \fn     txDataQ_ResetLinkAirtime
+ * \brief  Reset the link airtime estimation and DRR credit
+ * 
+ * \note   
+ * \param  pLinkQ - The link queues object                                          
+ * \return void 
+ * \sa     txDataQ_UpdateLinkAirtime
+ */
+static void txDataQ_ResetLinkAirtime (TDataLinkQ *pLinkQ)
+{
+    pLinkQ->iDeficit         = 0;
+    pLinkQ->uLastRateMbps    = TX_AIRTIME_INIT_RATE_MBPS;
+    pLinkQ->uAirtimePerKbyte = TX_AIRTIME_KBYTE_BITS / TX_AIRTIME_INIT_RATE_MBPS;
+}
+
 /** 
  * \fn     txDataQ_UpdateLinksBusyState
  * \brief  Update links' busy state
@@ -1456,7 +2015,9 @@ void TxDataQ_setEncryptionFieldSizes(TI_HANDLE hTxDataQ, TI_UINT32  uHlid,TI_UIN
 
     pLinkQ = &pTxDataQ->aDataLinkQ[uHlid]; /* Link queues */
     pLinkQ->cEncryptSize = encryptionFieldSize;
-   
+
+    /* The link header template includes the security pad */
+    txCtrlParams_InvalidateLinkHdrTemplate (pTxDataQ->hTxCtrl, uHlid);
 }
 
 /** 
@@ -70,6 +70,59 @@ typedef struct
 	TI_UINT32 uDroppedPacket;
 } TTxDataQueueDebugCnt;
 
+/* Tx scheduler modes */
+#define TX_DATA_SCHED_ROUND_ROBIN       0       /* One packet per link and AC in turn */
+#define TX_DATA_SCHED_AIRTIME_DRR       1       /* Deficit round-robin over the links by estimated airtime */
+
+/* Airtime estimation (per link, from the Tx results) */
+#define TX_AIRTIME_KBYTE_BITS           (1024 * 8)  /* Bits per airtime unit of data */
+#define TX_AIRTIME_INIT_RATE_MBPS       24          /* Assumed rate until the first Tx result of the link */
+#define TX_AIRTIME_EWMA_SHIFT           3           /* Each Tx result weighs 1/8 of the estimation */
+
+/* Per link airtime and queue-delay counters */
+typedef struct
+{
+    TI_UINT32 uAirtimeUsec;         /* Estimated airtime of the dequeued packets */
+    TI_UINT32 uQueueDelaySumMs;     /* Sum of the dequeued packets time in the queues */
+    TI_UINT32 uQueueDelayMaxMs;     /* Max packet time in the queues */
+    TI_UINT32 uDequeuedPackets;     /* Dequeued packets (for the average delay) */
+    TI_UINT32 uQuanta;              /* Quanta granted to the link */
+} TTxDataLinkAirtimeCnt;
+
+/* Classifier lookup structures (derived from tClsfrParams.ClsfrTable, rebuilt on every table change) */
+#define CLSFR_HASH_SIZE             32      /* Port / IP&Port hash slots - power of 2, at least twice the table size */
+#define CLSFR_HASH_EMPTY            0xFF    /* Free hash slot */
+#define CLSFR_TOS_TABLE_SIZE        256     /* DSCP table is indexed by the whole IP TOS byte (DSCP + ECN bits) */
+#define CLSFR_DTAG_NONE             0xFF    /* No DSCP entry - the packet gets the default TID */
+#define CLSFR_FLOW_CACHE_SIZE       32      /* Flow cache entries - power of 2 */
+#define CLSFR_FLOW_IP_VER_IHL       0x45    /* Only IPv4 packets without IP options are cached (fixed header offsets) */
+#define CLSFR_FLOW_KEY_LEN          24      /* The IP header and the TCP/UDP ports */
+
+#if (CLSFR_HASH_SIZE < (2 * NUM_OF_CLSFR_TABLE_ENTRIES))
+    #error  Classifier hash is too small for the classifier table !!
+#endif
+
+/* Flow cache entry - the classification result of a recently transmitted IP flow */
+typedef struct
+{
+    TI_UINT32   uSrcIpAddr;     /* IP source address as read from the header */
+    TI_UINT32   uDstIpAddr;     /* IP destination address as read from the header */
+    TI_UINT32   uPorts;         /* Source and destination ports as read from the TCP/UDP header */
+    TI_UINT32   uGeneration;    /* The classifier table generation the entry was filled in (0 = invalid) */
+    TI_UINT8    uProtocol;      /* IP protocol */
+    TI_UINT8    uDTag;          /* The classification result */
+} TClsfrFlowEntry;
+
+typedef struct
+{
+    TI_UINT8        aHash[CLSFR_HASH_SIZE];             /* Open-addressing (linear probing) index into ClsfrTable */
+    TI_UINT8        aTosToDtag[CLSFR_TOS_TABLE_SIZE];   /* Direct-mapped IP TOS byte to D-Tag table */
+    TClsfrFlowEntry aFlowCache[CLSFR_FLOW_CACHE_SIZE];  /* Direct-mapped 5-tuple flow cache */
+    TI_UINT32       uGeneration;                        /* Incremented on any table change to invalidate the flow cache */
+    TI_UINT32       uFlowCacheHits;
+    TI_UINT32       uFlowCacheMisses;
+} TClsfrLookup;
+
 /* The LinkQ object. */
 typedef struct 
 {
@@ -81,6 +134,11 @@ typedef struct
 	TTxDataQueueDebugCnt aQueueCounters[MAX_NUM_OF_AC];        /* Save Tx statistics per Tx-queue. */
 	TI_BOOL	             aNetStackQueueStopped[MAX_NUM_OF_AC]; /* indicate if the current queue was full and caused Tx network stack stop*/
     TI_UINT8             cEncryptSize;
+    /* Airtime deficit round-robin (see txDataQ_RunDrrScheduler) */
+    TI_INT32             iDeficit;                             /* Airtime credit left for the link (usec, may be negative) */
+    TI_UINT32            uAirtimePerKbyte;                     /* Estimated airtime of 1024 bytes (usec), from the Tx results */
+    TI_UINT32            uLastRateMbps;                        /* Last successful Tx rate of the link */
+    TTxDataLinkAirtimeCnt tAirtimeCounters;                    /* Airtime and queue-delay counters */
 } TDataLinkQ;
 
 /* The DataResources object */
@@ -102,6 +160,13 @@ typedef struct
 
 /* The LinkMac object. */
 #define LINK_MAC_TABLE_SIZE  WLANLINKS_MAX_LINKS
+#define LINK_MAC_HASH_SIZE   32      /* MAC to HLID hash slots - power of 2, at least twice the table size */
+#define LINK_MAC_HASH_EMPTY  0xFF    /* Free hash slot */
+
+#if (LINK_MAC_HASH_SIZE < (2 * LINK_MAC_TABLE_SIZE))
+    #error  Link MAC hash is too small for the links table !!
+#endif
+
 typedef struct 
 {
 	TI_BOOL              uValid;
@@ -119,6 +184,7 @@ typedef struct
 	TI_HANDLE            hTWD;
 			             
 	TClsfrParams		 tClsfrParams;  /* The classifier sub-module parameters */
+	TClsfrLookup		 tClsfrLookup;  /* The classifier lookup structures (hash, DSCP table and flow cache) */
 
 	TI_BOOL              bDataPortEnable; /* Data port open or not */
 	TI_UINT32            uContextId;  /* ID allocated to this module on registration to context module */
@@ -132,6 +198,8 @@ typedef struct
 	TI_BOOL				 aNetStackQueueStopped[MAX_NUM_OF_AC];/*indicate if the current queue was full and caused Tx network stack stop*/
 	TI_BOOL	             aQueueBusy[MAX_NUM_OF_AC];            /* per queue busy indication */
 	TI_BOOL				 bStopNetStackTx;/*Flag to enable/disable Tx stop*/
+	TI_UINT32            uSchedulerMode;  /* TX_DATA_SCHED_ROUND_ROBIN or TX_DATA_SCHED_AIRTIME_DRR */
+	TI_UINT32            uDrrQuantumUs;   /* Airtime quantum granted to a link per DRR round (usec) */
 
 	/* Tx Link Queues */	    	
 	TDataLinkQ           aDataLinkQ[WLANLINKS_MAX_LINKS];   /* Link queues handles. */
@@ -139,6 +207,7 @@ typedef struct
 	TI_UINT32            uNextHlid;               /* Next HLID should be processed by scheduler */
 
 	TLinkMac             aLinkMac[WLANLINKS_MAX_LINKS];     /* Link queues handles. */
+	TI_UINT8             aLinkMacHash[LINK_MAC_HASH_SIZE];  /* Open-addressing (linear probing) MAC to HLID index into aLinkMac */
 
 	/* Data resources */	    	
 	TDataResources       tDataRsrc; /* Resources object DB */
@@ -148,6 +217,7 @@ typedef struct
 	TI_UINT32			 uTxSendPaceTimeoutsCount;
 	TI_UINT32			 uLinkNotFoundCount;
 	TI_UINT32			 uNoResourcesCount;
+	TI_UINT32			 uBridgeFwdCount;   /* Intra-BSS packets forwarded from Rx to Tx */
 
 } TTxDataQ;
 
@@ -155,4 +225,7 @@ typedef struct
 /* TIDs Mapping to Queues */
 static const TI_UINT32 aTidToQueueTable[MAX_NUM_OF_802_1d_TAGS] = {0, 1, 1, 0, 2, 2, 3, 3};
 
+/* Queues in strict priority order (used within a link by the DRR scheduler) */
+static const TI_UINT32 aQueuePriorityTable[MAX_NUM_OF_AC] = {QOS_AC_VO, QOS_AC_VI, QOS_AC_BE, QOS_AC_BK};
+
 #endif /* _TX_DATA_QUEUE_H_ */
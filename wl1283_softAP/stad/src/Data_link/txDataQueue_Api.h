@@ -72,16 +72,19 @@ void      txDataQ_SetLinkType   (TI_HANDLE hTxDataQ, TI_UINT32 uHlid, EWlanLinkT
 TI_STATUS txDataQ_LinkMacAdd (TI_HANDLE hTxDataQ, TI_UINT32 uHlid, TMacAddr tMacAddr);
 void      txDataQ_LinkMacRemove (TI_HANDLE hTxDataQ, TI_UINT32 uHlid);
 TI_STATUS txDataQ_LinkMacFind   (TI_HANDLE hTxDataQ, TI_UINT32 *uHlid, TMacAddr tMacAddr);
+void      txDataQ_UpdateLinkAirtime (TI_HANDLE hTxDataQ, TI_UINT32 uHlid, TI_UINT32 uRateMbps, TI_UINT32 uAckFailures);
 void TxDataQ_SetEncryptFlag(TI_HANDLE hTxDataQ, TI_UINT32  uHlid,int flag);
 void TxDataQ_setEncryptionFieldSizes(TI_HANDLE hTxDataQ, TI_UINT32  uHlid,TI_UINT8 encryptionFieldSize);
 TI_UINT8 TxDataQ_getEncryptionFieldSizes(TI_HANDLE hTxDataQ, TI_UINT32  uHlid);
 
 void      txDataQ_GetBcastLink  (TI_HANDLE hTxDataQ, TI_UINT32 *uHlid);
+TI_STATUS txDataQ_ForwardRxPacket (TI_HANDLE hTxDataQ, void *pRxBuf, void *pPacket, TI_UINT16 uLength, TI_UINT32 uHlid);
 /*
  * Tx data resources functions:
  */
 TI_STATUS txDataQ_AllocCheckResources (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk);
 void      txDataQ_FreeResources       (TI_HANDLE hTxDataQ, TTxCtrlBlk *pPktCtrlBlk);
+void      txDataQ_FreeResourcesList   (TI_HANDLE hTxDataQ, TTxCtrlBlk **apPktCtrlBlks, TI_UINT32 uNumPkts);
 void      txDataQ_FlushLinkQueues     (TI_HANDLE hTxDataQ, TI_UINT32 uHlid);
 
 #ifdef TI_DBG
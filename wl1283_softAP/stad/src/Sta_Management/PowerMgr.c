@@ -69,6 +69,10 @@
 #define BET_DISABLE 0
 #define BET_ENABLE  1
 
+/* Timers slack (Msec) - allowed expiry delay, so the expiry may share a wakeup with other timers */
+#define RETRY_PS_TIMER_SLACK_MS             10
+#define PS_POLL_FAILURE_TIMER_SLACK_MS      100
+
 
 /*****************************************************************************
  **         Private Function prototypes                                      **
@@ -346,6 +350,9 @@ TRACE0(pPowerMgr->hReport, REPORT_SEVERITY_INIT, "PowerMgr_SetDefaults - ERROR c
         return TI_NOK;
     }
 
+    tmr_SetTimerSlack (pPowerMgr->hRetryPsTimer, RETRY_PS_TIMER_SLACK_MS);
+    tmr_SetTimerSlack (pPowerMgr->hPsPollFailureTimer, PS_POLL_FAILURE_TIMER_SLACK_MS);
+
     /* Register and Enable the PsPoll failure */
     TWD_RegisterEvent (pPowerMgr->hTWD,
         TWD_OWN_EVENT_PSPOLL_DELIVERY_FAILURE,
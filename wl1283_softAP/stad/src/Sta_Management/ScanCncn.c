@@ -578,6 +578,9 @@ void scanCncn_ScanCompleteNotificationCB (TI_HANDLE hScanCncn, EScanResultTag eT
     /* get the scan client value from the scan tag */
     eClient = SCAN_CLIENT_FROM_TAG (eTag);
 
+    /* the next scan should report again all the BSSs, including unchanged ones */
+    mlmeParser_ResetFrameCache (pScanCncn->hMlme);
+
     /* update scan result if scan SRV reported error (and no error occured so far) */
     if ((TI_OK != scanStatus) && (SCAN_CRS_SCAN_COMPLETE_OK == pScanCncn->pScanClients[ eClient ]->eScanResult))
     {
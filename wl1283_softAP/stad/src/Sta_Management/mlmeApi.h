@@ -241,6 +241,63 @@ typedef struct
     mlmeFrameInfo_t         frame;
 }mlmeIEParsingParams_t;
 
+/* IE index slots - the IEs are indexed and decoded by these groups */
+typedef enum
+{
+    MLME_IE_SLOT_SSID               = 0,
+    MLME_IE_SLOT_RATES,
+    MLME_IE_SLOT_EXT_RATES,
+    MLME_IE_SLOT_ERP,
+    MLME_IE_SLOT_FH_PARAMS,
+    MLME_IE_SLOT_DS_PARAMS,
+    MLME_IE_SLOT_CF_PARAMS,
+    MLME_IE_SLOT_IBSS_PARAMS,
+    MLME_IE_SLOT_TIM,
+    MLME_IE_SLOT_COUNTRY,
+    MLME_IE_SLOT_POWER_CONSTRAINT,
+    MLME_IE_SLOT_CHANNEL_SWITCH,
+    MLME_IE_SLOT_QUIET,
+    MLME_IE_SLOT_TPC_REPORT,
+    MLME_IE_SLOT_RSN,               /* RSN and kkk extension IEs */
+    MLME_IE_SLOT_QOS_CAPABILITY,
+    MLME_IE_SLOT_HT_CAPABILITIES,
+    MLME_IE_SLOT_HT_INFORMATION,
+    MLME_IE_SLOT_VENDOR,            /* WPA, WME and WSC IEs */
+    MLME_IE_SLOT_UNKNOWN,
+    MLME_IE_SLOT_NUM
+
+} EMlmeIeSlot;
+
+#define MLME_IE_SLOT_BIT(eSlot)     (1 << (eSlot))
+#define MLME_IE_SLOTS_ALL           (MLME_IE_SLOT_BIT(MLME_IE_SLOT_NUM) - 1)
+/* The IEs used by the scan result consumers (the rest are decoded only on demand) */
+#define MLME_IE_SLOTS_SCAN          (MLME_IE_SLOTS_ALL & ~(MLME_IE_SLOT_BIT(MLME_IE_SLOT_FH_PARAMS)        | \
+                                                           MLME_IE_SLOT_BIT(MLME_IE_SLOT_CF_PARAMS)        | \
+                                                           MLME_IE_SLOT_BIT(MLME_IE_SLOT_POWER_CONSTRAINT) | \
+                                                           MLME_IE_SLOT_BIT(MLME_IE_SLOT_QUIET)            | \
+                                                           MLME_IE_SLOT_BIT(MLME_IE_SLOT_QOS_CAPABILITY)))
+
+#define MLME_IE_INDEX_MAX_IES       48
+
+/* One indexed IE */
+typedef struct
+{
+    TI_UINT16               uOffset;    /* IE offset from the IEs start */
+    TI_UINT8                uSlot;      /* EMlmeIeSlot */
+} TMlmeIeIndexEntry;
+
+/* Offsets index of a frame IEs, built in one pass by mlmeParser_IndexIEs */
+typedef struct
+{
+    TI_UINT8                *pIEs;                          /* IEs start (valid while the frame is handled) */
+    TI_INT32                iIEsLen;
+    TI_UINT32               uSlotsMap;                      /* The slots found in the frame */
+    TI_UINT32               uDecodedMap;                    /* The slots already decoded */
+    TI_UINT32               uChecksum;                      /* All fields except the timestamp and TIM */
+    TI_UINT32               uNumIEs;
+    TMlmeIeIndexEntry       aIEs[MLME_IE_INDEX_MAX_IES];    /* In the frame order */
+} TMlmeIeIndex;
+
 typedef void (*mlme_resultCB_t)( TI_HANDLE hObj, TMacAddr* bssid, mlmeFrameInfo_t* pFrameInfo,
                                  TRxAttr* pRxAttr, TI_UINT8* frame, TI_UINT16 frameLength );
 
@@ -282,6 +339,16 @@ TI_STATUS mlmeParser_parseIEs(TI_HANDLE hMlme,
                               TI_UINT8 *pData,
                               TI_INT32 bodyDataLen,
                               mlmeIEParsingParams_t *params);
+TI_STATUS mlmeParser_IndexIEs(TI_HANDLE hMlme, 
+                              TI_UINT8 *pData,
+                              TI_INT32 bodyDataLen,
+                              TI_UINT32 uFixedFields,
+                              TMlmeIeIndex *pIndex);
+TI_STATUS mlmeParser_DecodeIndexedIEs(TI_HANDLE hMlme, 
+                                      TMlmeIeIndex *pIndex,
+                                      TI_UINT32 uSlotsMask,
+                                      mlmeIEParsingParams_t *params);
+void mlmeParser_ResetFrameCache(TI_HANDLE hMlme);
 TI_BOOL mlmeParser_ParseIeBuffer (TI_HANDLE hMlme, TI_UINT8 *pIeBuffer, TI_UINT32 length, TI_UINT8 desiredIeId, TI_UINT8 **pDesiredIe, TI_UINT8 *pMatchBuffer, TI_UINT32 matchBufferLen);
 
 #ifdef XCC_MODULE_INCLUDED
@@ -266,6 +266,8 @@ void mlme_SetDefaults (TI_HANDLE hMlmeSm, TMlmeInitParams *pMlmeInitParams)
 
     /* set default values */
     pMlme->bParseBeaconWSC = pMlmeInitParams->parseWSCInBeacons;
+    pMlme->bLightweightParse = pMlmeInitParams->lightweightParse;
+    pMlme->uFrameCacheGeneration = 1;
 }
 
 TI_STATUS mlme_setParam(TI_HANDLE           hMlmeSm,
@@ -83,8 +83,23 @@ typedef enum
 
 
 
+#define MLME_FRAME_CACHE_SIZE   32      /* Must be a power of 2 */
+#define MLME_FRAME_CACHE_TTL_MS 300     /* A cached frame is parsed again after this time */
+
 /* Typedefs */
 
+/* The last parsed scan result (beacon or probe response) of a BSSID */
+typedef struct
+{
+    TMacAddr            tBssid;
+    TI_UINT8            uSubType;
+    TI_UINT8            uChannel;
+    TI_UINT8            uScanTag;
+    TI_UINT32           uChecksum;
+    TI_UINT32           uTimeStamp;
+    TI_UINT32           uGeneration;    /* Valid only if equal to the cache generation */
+} TMlmeFrameCacheEntry;
+
 typedef struct
 {
     mgmtStatus_e mgmtStatus;
@@ -105,6 +120,14 @@ typedef struct
 
     /* temporary frame info */
     mlmeIEParsingParams_t tempFrameInfo;
+
+    /* scan results IEs index and unchanged frames cache */
+    TMlmeIeIndex        tIeIndex;
+    TI_BOOL             bLightweightParse;
+    TI_UINT32           uFrameCacheGeneration;
+    TMlmeFrameCacheEntry aFrameCache[MLME_FRAME_CACHE_SIZE];
+    TI_UINT32           uFrameCacheHits;
+    TI_UINT32           uFrameCacheMisses;
     
     /* debug info - start */
     TI_UINT32           debug_lastProbeRspTSFTime;
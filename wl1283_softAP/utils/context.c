@@ -49,19 +49,23 @@
 #include "report.h"
 #include "context.h"
 #include "bmtrace_api.h"
+#include "STADExternalIf.h"
 
 
 
 #define MAX_CLIENTS     8   /* Maximum number of clients using context services */
 #define MAX_NAME_SIZE   16  /* Maximum client's name string size */
 
-#ifdef TI_DBG
+#define CONTEXT_CLIENT_BIT(uClientId)   (1 << (uClientId))
+
+/* The lowest client ID in a non empty clients bitmap (a nibble lookup, since MAX_CLIENTS is 8) */
+#define CONTEXT_FIRST_CLIENT(uMap)      (((uMap) & 0xF) ? aFirstClientInNibble[(uMap) & 0xF] : (4 + aFirstClientInNibble[((uMap) >> 4) & 0xF]))
+
 typedef struct 
 {
     TI_UINT32       uSize;                  /* Clients' name string size */
     char            sName [MAX_NAME_SIZE];  /* Clients' name string      */
 } TClientName;	
-#endif /* TI_DBG */
 
 /* context module structure */
 typedef struct 
@@ -73,18 +77,28 @@ typedef struct
     TI_UINT32        uNumClients;                  /* Number of registered clients      */
     TContextCbFunc   aClientCbFunc [MAX_CLIENTS];  /* Clients' callback functions       */
     TI_HANDLE        aClientCbHndl [MAX_CLIENTS];  /* Clients' callback handles         */
-    TI_BOOL          aClientEnabled[MAX_CLIENTS];  /* Clients' enable/disable flags     */
-    TI_BOOL          aClientPending[MAX_CLIENTS];  /* Clients' pending flags            */
-
-#ifdef TI_DBG
+    TI_UINT32        uEnabledMap;                  /* Clients' enabled bitmap (updated atomically) */
+    TI_UINT32        uPendingMap;                  /* Clients' pending bitmap (updated atomically) */
+    TI_UINT32        aPriorityMap  [CONTEXT_NUM_PRIORITIES]; /* Clients bitmap per priority    */
+    EContextPriority aClientPriority[MAX_CLIENTS]; /* Clients' priority                 */
     TClientName      aClientName   [MAX_CLIENTS];  /* Clients' name string              */
+
+    /* Clients' statistics */
     TI_UINT32        aRequestCount [MAX_CLIENTS];  /* Clients' schedule requests counter*/
     TI_UINT32        aInvokeCount  [MAX_CLIENTS];  /* Clients' invocations counter      */
-#endif
+    TI_UINT32        aRequestTime  [MAX_CLIENTS];  /* Time (usec) the client became pending */
+    TI_UINT64        aRunTime      [MAX_CLIENTS];  /* Clients' total callbacks run time (usec) */
+    TI_UINT32        aMaxRunTime   [MAX_CLIENTS];  /* Clients' longest callback run time (usec) */
+    TI_UINT64        aLatency      [MAX_CLIENTS];  /* Clients' total schedule-to-run latency (usec) */
+    TI_UINT32        aMaxLatency   [MAX_CLIENTS];  /* Clients' longest schedule-to-run latency (usec) */
 
 } TContext;	
 
 
+/* The first set bit index in each 4 bits value */
+static const TI_UINT8 aFirstClientInNibble[16] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+
+static void context_SetPending (TContext *pContext, TI_UINT32 uClientId);
 
 
 /** 
@@ -175,7 +189,7 @@ void context_Init (TI_HANDLE hContext, TI_HANDLE hOs, TI_HANDLE hReport)
  * This includes their callback function that should be invoked from the driver context
  *   when they are pending. 
  * 
- * \note   
+ * \note   The client gets the normal priority (see context_SetClientPriority).
  * \param  hContext - The module handle
  * \param  fCbFunc  - The client's callback function.
  * \param  hCbHndl  - The client's callback function handle.
@@ -201,12 +215,16 @@ TI_UINT32 context_RegisterClient (TI_HANDLE       hContext,
     }
 
     /* Save the new client's parameters. */
-    pContext->aClientCbFunc[uClientId]  = fCbFunc;
-    pContext->aClientCbHndl[uClientId]  = hCbHndl;
-    pContext->aClientEnabled[uClientId] = bEnable;
-    pContext->aClientPending[uClientId] = TI_FALSE;
+    pContext->aClientCbFunc[uClientId]   = fCbFunc;
+    pContext->aClientCbHndl[uClientId]   = hCbHndl;
+    pContext->aClientPriority[uClientId] = CONTEXT_PRIORITY_NORMAL;
+    pContext->aPriorityMap[CONTEXT_PRIORITY_NORMAL] |= CONTEXT_CLIENT_BIT(uClientId);
+    os_atomicClearBits (pContext->hOs, &pContext->uPendingMap, CONTEXT_CLIENT_BIT(uClientId));
+    if (bEnable)
+    {
+        os_atomicSetBits (pContext->hOs, &pContext->uEnabledMap, CONTEXT_CLIENT_BIT(uClientId));
+    }
 
-#ifdef TI_DBG
     if (uNameSize <= MAX_NAME_SIZE) 
     {
         os_memoryCopy(pContext->hOs, 
@@ -219,7 +237,6 @@ TI_UINT32 context_RegisterClient (TI_HANDLE       hContext,
     {
         TRACE0(pContext->hReport, REPORT_SEVERITY_ERROR , "context_RegisterClient() MAX_NAME_SIZE limit exceeded!\n");
     }
-#endif /* TI_DBG */
 
     /* Increment clients number and return new client ID. */
     pContext->uNumClients++;
@@ -230,15 +247,76 @@ TI_UINT32 context_RegisterClient (TI_HANDLE       hContext,
 }
 
 
+/** 
+ * \fn     context_SetClientPriority
+ * \brief  Set client's dispatch priority
+ * 
+ * When several clients are pending, the driver task invokes the higher priority clients first.
+ * Clients of the same priority are invoked by their index order.
+ * Used by the data path clients (Tx/Rx) so they are not delayed by management work.
+ * 
+ * \note   Called in the clients init process, after context_RegisterClient.
+ * \param  hContext   - The module handle
+ * \param  uClientId  - The client's index
+ * \param  ePriority  - The client's priority
+ * \return void 
+ * \sa     context_DriverTask
+ */ 
+void context_SetClientPriority (TI_HANDLE hContext, TI_UINT32 uClientId, EContextPriority ePriority)
+{
+	TContext *pContext = (TContext *)hContext;
+
+    if ((uClientId >= pContext->uNumClients) || (ePriority >= CONTEXT_NUM_PRIORITIES))
+    {
+        TRACE2(pContext->hReport, REPORT_SEVERITY_ERROR , "context_SetClientPriority(): Invalid client %d or priority %d\n", uClientId, ePriority);
+        return;
+    }
+
+    pContext->aPriorityMap[pContext->aClientPriority[uClientId]] &= ~CONTEXT_CLIENT_BIT(uClientId);
+    pContext->aPriorityMap[ePriority] |= CONTEXT_CLIENT_BIT(uClientId);
+    pContext->aClientPriority[uClientId] = ePriority;
+
+    TRACE2(pContext->hReport, REPORT_SEVERITY_INIT , "context_SetClientPriority(): Client ID=%d, priority=%d\n", uClientId, ePriority);
+}
+
+
+/** 
+ * \fn     context_SetPending
+ * \brief  Set client's Pending bit
+ * 
+ * Set the client's bit in the pending bitmap (atomic, no lock needed).
+ * If the client was not pending, save the request time for the schedule-to-run latency.
+ * 
+ * \note   The time is saved before the bit is set, so the driver task never reads an older time.
+ * \param  pContext   - The module object
+ * \param  uClientId  - The client's index
+ * \return void 
+ * \sa     context_DriverTask
+ */ 
+static void context_SetPending (TContext *pContext, TI_UINT32 uClientId)
+{
+    TI_UINT32 uClientBit = CONTEXT_CLIENT_BIT(uClientId);
+
+    pContext->aRequestCount[uClientId]++; 
+
+    if (!(pContext->uPendingMap & uClientBit))
+    {
+        pContext->aRequestTime[uClientId] = os_timeStampUs (pContext->hOs);
+    }
+
+    os_atomicSetBits (pContext->hOs, &pContext->uPendingMap, uClientBit);
+}
+
+
 /** 
  * \fn     context_RequestSchedule
  * \brief  Handle client's switch to driver's context.
  * 
  * This function is called by a client from external context event.
- * It sets the client's Pending flag and requests the driver's task scheduling.
+ * It sets the client's Pending bit and requests the driver's task scheduling.
  * Thus, the client's callback will be called afterwards from the driver context.
  * 
- * \note   
+ * \note   The Pending bit is set atomically, so no lock is taken here.
  * \param  hContext   - The module handle
  * \param  uClientId  - The client's index
  * \return void 
@@ -247,14 +325,12 @@ TI_UINT32 context_RegisterClient (TI_HANDLE       hContext,
 void context_RequestSchedule (TI_HANDLE hContext, TI_UINT32 uClientId)
 {
 	TContext *pContext = (TContext *)hContext;
-	TI_BOOL bContextSwitchRequired;
-#ifdef TI_DBG
-    pContext->aRequestCount[uClientId]++; 
-    TRACE3(pContext->hReport, REPORT_SEVERITY_INFORMATION , "context_RequestSchedule(): Client=, ID=%d, enabled=%d, pending=%d\n", uClientId, pContext->aClientEnabled[uClientId], pContext->aClientPending[uClientId]);
-#endif /* TI_DBG */
+    TI_BOOL bContextSwitchRequired;
 
-    /* Set client's Pending flag */
-    pContext->aClientPending[uClientId] = TI_TRUE;
+    TRACE3(pContext->hReport, REPORT_SEVERITY_INFORMATION , "context_RequestSchedule(): Client=, ID=%d, EnabledMap=0x%x, PendingMap=0x%x\n", uClientId, pContext->uEnabledMap, pContext->uPendingMap);
+
+    /* Set client's Pending bit */
+    context_SetPending (pContext, uClientId);
 
     /* Disable system suspend (enabled again after task completion) */
     os_wake_lock(pContext->hOs);
@@ -265,15 +341,14 @@ void context_RequestSchedule (TI_HANDLE hContext, TI_UINT32 uClientId)
      */
     if (os_RequestSchedule (pContext->hOs, &bContextSwitchRequired) != TI_OK)
     {
-	os_wake_unlock (pContext->hOs);
+       os_wake_unlock(pContext->hOs);
     }
     if (!bContextSwitchRequired)
     {
-	context_DriverTask (hContext);
+        context_DriverTask (hContext);
     }
 }
 
-
 /** 
  * \fn     context_DriverTask
  * \brief  The driver task
@@ -282,6 +357,13 @@ void context_RequestSchedule (TI_HANDLE hContext, TI_UINT32 uClientId)
  * single context, scheduled through the OS (the driver's workqueue in Linux). 
  * Only one instantiation of this task may run at a time!
  * 
+ * The pending and enabled clients are selected by their bitmaps: the highest priority
+ *   present first, and within it the lowest client index.
+ * The selection is repeated after each callback, so a data path client that becomes
+ *   pending meanwhile is invoked before the remaining lower priority clients.
+ * Each client is invoked at most once per task (a client that is pending again is
+ *   handled by the next task, which its request has already scheduled).
+ * 
  * \note   
  * \param  hContext   - The module handle
  * \return void 
@@ -292,29 +374,58 @@ void context_DriverTask (TI_HANDLE hContext)
 	TContext       *pContext = (TContext *)hContext;
     TContextCbFunc  fCbFunc;
     TI_HANDLE       hCbHndl;
-    TI_UINT32       i;
+    TI_UINT32       uServedMap = 0;
+    TI_UINT32       uReadyMap;
+    TI_UINT32       uPrioReadyMap;
+    TI_UINT32       uClientId;
+    TI_UINT32       uPriority;
+    TI_UINT32       uStartTime;
+    TI_UINT32       uRunTime;
+    TI_UINT32       uLatency;
     CL_TRACE_START_L1();
 
     TRACE0(pContext->hReport, REPORT_SEVERITY_INFORMATION , "context_DriverTask():\n");
 
-    /* For all registered clients do: */
-	for (i = 0; i < pContext->uNumClients; i++)
+    /* While there are pending and enabled clients, which were not invoked yet in this task */
+    while ((uReadyMap = pContext->uPendingMap & pContext->uEnabledMap & ~uServedMap) != 0)
     {
-        /* If client is pending and enabled */
-        if (pContext->aClientPending[i]  &&  pContext->aClientEnabled[i])
+        /* Find the highest priority that has ready clients, and its lowest client index */
+        for (uPriority = 0; uPriority < CONTEXT_NUM_PRIORITIES - 1; uPriority++)
+        {
+            if (uReadyMap & pContext->aPriorityMap[uPriority])
+            {
+                break;
+            }
+        }
+        uPrioReadyMap = uReadyMap & pContext->aPriorityMap[uPriority];
+        uClientId = CONTEXT_FIRST_CLIENT(uPrioReadyMap);
+
+        TRACE1(pContext->hReport, REPORT_SEVERITY_INFORMATION , "Invoking - Client=, ID=%d\n", uClientId);
+
+        /* Clear client's pending bit and update its latency statistics */
+        os_atomicClearBits (pContext->hOs, &pContext->uPendingMap, CONTEXT_CLIENT_BIT(uClientId));
+        uServedMap |= CONTEXT_CLIENT_BIT(uClientId);
+
+        uStartTime = os_timeStampUs (pContext->hOs);
+        uLatency   = uStartTime - pContext->aRequestTime[uClientId];
+        pContext->aLatency[uClientId] += uLatency;
+        if (uLatency > pContext->aMaxLatency[uClientId])
+        {
+            pContext->aMaxLatency[uClientId] = uLatency;
+        }
+        pContext->aInvokeCount[uClientId]++; 
+
+        /* Call client's callback function */
+        fCbFunc = pContext->aClientCbFunc[uClientId];
+        hCbHndl = pContext->aClientCbHndl[uClientId];
+        fCbFunc(hCbHndl);
+
+        /* Update the client's run time statistics */
+        uRunTime = os_timeStampUs (pContext->hOs) - uStartTime;
+        pContext->aRunTime[uClientId] += uRunTime;
+        if (uRunTime > pContext->aMaxRunTime[uClientId])
         {
-            #ifdef TI_DBG
-                pContext->aInvokeCount[i]++; 
-                TRACE1(pContext->hReport, REPORT_SEVERITY_INFORMATION , "Invoking - Client=, ID=%d\n", i);
-            #endif /* TI_DBG */
-
-            /* Clear client's pending flag */
-            pContext->aClientPending[i] = TI_FALSE;
-
-            /* Call client's callback function */
-            fCbFunc = pContext->aClientCbFunc[i];
-            hCbHndl = pContext->aClientCbHndl[i];
-            fCbFunc(hCbHndl);
+            pContext->aMaxRunTime[uClientId] = uRunTime;
         }
     }
 
@@ -338,24 +449,24 @@ void context_DriverTask (TI_HANDLE hContext)
 void context_EnableClient (TI_HANDLE hContext, TI_UINT32 uClientId)
 {
 	TContext *pContext = (TContext *)hContext;
-	TI_BOOL bContextSwitchRequired;
+    TI_BOOL bContextSwitchRequired;
 #ifdef TI_DBG
-    if (pContext->aClientEnabled[uClientId])
+    if (pContext->uEnabledMap & CONTEXT_CLIENT_BIT(uClientId))
     {
         TRACE0(pContext->hReport, REPORT_SEVERITY_ERROR , "context_EnableClient() Client  already enabled!!\n");
         return;
     }
-    TRACE3(pContext->hReport, REPORT_SEVERITY_INFORMATION , "context_EnableClient(): Client=, ID=%d, enabled=%d, pending=%d\n", uClientId, pContext->aClientEnabled[uClientId], pContext->aClientPending[uClientId]);
+    TRACE3(pContext->hReport, REPORT_SEVERITY_INFORMATION , "context_EnableClient(): Client=, ID=%d, EnabledMap=0x%x, PendingMap=0x%x\n", uClientId, pContext->uEnabledMap, pContext->uPendingMap);
 #endif /* TI_DBG */
 
     /* Enable client */
-    pContext->aClientEnabled[uClientId] = TI_TRUE;
+    os_atomicSetBits (pContext->hOs, &pContext->uEnabledMap, CONTEXT_CLIENT_BIT(uClientId));
 
     /* If client is pending, schedule driver task */
-    if (pContext->aClientPending[uClientId])
+    if (pContext->uPendingMap & CONTEXT_CLIENT_BIT(uClientId))
     {
         /* Disable system suspend (enabled again after task completion) */
-        os_wake_lock (pContext->hOs);
+        os_wake_lock(pContext->hOs);
 
         /* 
          * If configured to switch context, request driver task scheduling.
@@ -363,11 +474,11 @@ void context_EnableClient (TI_HANDLE hContext, TI_UINT32 uClientId)
          */
         if (os_RequestSchedule (pContext->hOs, &bContextSwitchRequired) != TI_OK)
         {
-		os_wake_unlock (pContext->hOs);
+            os_wake_unlock(pContext->hOs);
         }
         if (!bContextSwitchRequired)
         {
-		context_DriverTask (hContext);
+            context_DriverTask (hContext);
         }
     }
 }
@@ -377,16 +488,16 @@ void context_DisableClient (TI_HANDLE hContext, TI_UINT32 uClientId)
 	TContext *pContext = (TContext *)hContext;
 
 #ifdef TI_DBG
-    if (!pContext->aClientEnabled[uClientId])
+    if (!(pContext->uEnabledMap & CONTEXT_CLIENT_BIT(uClientId)))
     {
         TRACE0(pContext->hReport, REPORT_SEVERITY_ERROR , "context_DisableClient() Client  already disabled!!\n");
         return;
     }
-    TRACE3(pContext->hReport, REPORT_SEVERITY_INFORMATION , "context_DisableClient(): Client=, ID=%d, enabled=%d, pending=%d\n", uClientId, pContext->aClientEnabled[uClientId], pContext->aClientPending[uClientId]);
+    TRACE3(pContext->hReport, REPORT_SEVERITY_INFORMATION , "context_DisableClient(): Client=, ID=%d, EnabledMap=0x%x, PendingMap=0x%x\n", uClientId, pContext->uEnabledMap, pContext->uPendingMap);
 #endif /* TI_DBG */
 
     /* Disable client */
-    pContext->aClientEnabled[uClientId] = TI_FALSE;
+    os_atomicClearBits (pContext->hOs, &pContext->uEnabledMap, CONTEXT_CLIENT_BIT(uClientId));
 }
 
 
@@ -423,6 +534,46 @@ void context_LeaveCriticalSection (TI_HANDLE hContext)
 }
 
 
+/** 
+ * \fn     context_GetClientStats
+ * \brief  Get a client's statistics
+ * 
+ * Get the client's name, priority, requests and invocations counters, its callbacks
+ *   run time and its schedule-to-run latency.
+ * Used to find which client occupies the driver context.
+ * 
+ * \note   pStats->uClientId is the input (the client's index).
+ * \param  hContext - The module handle
+ * \param  pStats   - The client's statistics (output)
+ * \return TI_OK, or TI_NOK if the client index is not registered
+ * \sa     context_Print
+ */ 
+TI_STATUS context_GetClientStats (TI_HANDLE hContext, TContextClientStats *pStats)
+{
+	TContext *pContext = (TContext *)hContext;
+    TI_UINT32 uClientId = pStats->uClientId;
+
+    pStats->uNumClients = pContext->uNumClients;
+
+    if (uClientId >= pContext->uNumClients)
+    {
+        return TI_NOK;
+    }
+
+    os_memoryCopy (pContext->hOs, (void *)pStats->sName, (void *)pContext->aClientName[uClientId].sName, MAX_NAME_SIZE);
+    pStats->sName[MAX_NAME_SIZE - 1] = '\0';
+    pStats->uPriority     = (TI_UINT32)pContext->aClientPriority[uClientId];
+    pStats->uRequests     = pContext->aRequestCount[uClientId];
+    pStats->uInvokes      = pContext->aInvokeCount[uClientId];
+    pStats->uRunTimeUs    = pContext->aRunTime[uClientId];
+    pStats->uMaxRunTimeUs = pContext->aMaxRunTime[uClientId];
+    pStats->uLatencyUs    = pContext->aLatency[uClientId];
+    pStats->uMaxLatencyUs = pContext->aMaxLatency[uClientId];
+
+    return TI_OK;
+}
+
+
 /** 
  * \fn     context_Print
  * \brief  Print module information
@@ -442,23 +593,25 @@ void context_Print(TI_HANDLE hContext)
 	TContext *pContext = (TContext *)hContext;
     TI_UINT32 i;
 
-    WLAN_OS_REPORT(("context_Print():  %d Clients Registered:\n", pContext->uNumClients));
+    WLAN_OS_REPORT(("context_Print():  %d Clients Registered, EnabledMap=0x%x, PendingMap=0x%x:\n", pContext->uNumClients, pContext->uEnabledMap, pContext->uPendingMap));
     WLAN_OS_REPORT(("=======================================\n"));
 
 	for (i = 0; i < pContext->uNumClients; i++)
 	{
-		WLAN_OS_REPORT(("Client %d - %s: CbFunc=0x%x, CbHndl=0x%x, Enabled=%d, Pending=%d, Requests=%d, Invoked=%d\n",
+		WLAN_OS_REPORT(("Client %d - %s: CbFunc=0x%x, CbHndl=0x%x, Priority=%d, Requests=%d, Invoked=%d, RunTime=%u us (max %u), Latency=%u us (max %u)\n",
                         i,
                         pContext->aClientName[i].sName,
                         (TI_UINT32)pContext->aClientCbFunc[i],
                         (TI_UINT32)pContext->aClientCbHndl[i],
-                        pContext->aClientEnabled[i],
-                        pContext->aClientPending[i],
+                        pContext->aClientPriority[i],
                         pContext->aRequestCount[i],
-                        pContext->aInvokeCount[i] ));
+                        pContext->aInvokeCount[i],
+                        (TI_UINT32)pContext->aRunTime[i],
+                        pContext->aMaxRunTime[i],
+                        (TI_UINT32)pContext->aLatency[i],
+                        pContext->aMaxLatency[i] ));
 	}
 }
 
 #endif /* TI_DBG */
 
-
@@ -213,6 +213,7 @@ TI_HANDLE report_Create (TI_HANDLE hOs)
     os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_140]),  "roleAP                  "  ,  sizeof("roleAP                  "));
     os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_141]),  "wlanLinks               "  ,  sizeof("wlanLinks               "));
     os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_142]),  "ApCmd                   "  ,  sizeof("ApCmd                   "));
+    os_memoryCopy(hOs, (void *)(pReport->aFileName[FILE_ID_143]),  "ringQueue               "  ,  sizeof("ringQueue               "));
 
 
 #endif  /* PRINTF_ROLLBACK */
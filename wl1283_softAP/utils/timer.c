@@ -49,6 +49,43 @@
 
 #define EXPIRY_QUE_SIZE  QUE_UNLIMITED_SIZE
 
+/* 
+ * Timer wheel - serves the timers that have a slack (see tmr_SetTimerSlack).
+ * A hierarchical wheel of TMR_WHEEL_LEVELS levels, each with TMR_WHEEL_SLOTS slots
+ *   (level 0 slot = 1 tick, level 1 slot = 64 ticks, level 2 slot = 4096 ticks).
+ * A single OS timer is armed for the next wheel expiry, so timers that expire on the same
+ *   tick share one wakeup.
+ */
+#define TMR_WHEEL_TICK_MSEC         10
+#define TMR_WHEEL_LEVELS            3
+#define TMR_WHEEL_SLOT_BITS         6
+#define TMR_WHEEL_SLOTS             (1 << TMR_WHEEL_SLOT_BITS)
+#define TMR_WHEEL_SLOT_MASK         (TMR_WHEEL_SLOTS - 1)
+#define TMR_WHEEL_LEVEL_SHIFT(uLevel)  ((uLevel) * TMR_WHEEL_SLOT_BITS)
+#define TMR_WHEEL_MAX_DELTA         ((1 << TMR_WHEEL_LEVEL_SHIFT(TMR_WHEEL_LEVELS)) - 1)
+#define TMR_WHEEL_SLOT_BIT(uSlot)   (((TI_UINT64)1) << (uSlot))
+
+/* Per timer structure */
+typedef struct _TTimerInfo
+{
+    TI_HANDLE    hTimerModule;             /* The timer module handle (see TTimerModule, needed on expiry) */
+    TI_HANDLE    hOsTimerObj;              /* The OS-API timer object handle */
+    TQueNodeHdr  tQueNodeHdr;              /* The header used for queueing the timer */
+    TTimerCbFunc fExpiryCbFunc;            /* The CB-function provided by the timer user for expiration */
+    TI_HANDLE    hExpiryCbHndl;            /* The CB-function handle */
+    TI_UINT32    uIntervalMsec;            /* The timer duration in Msec */
+    TI_BOOL      bPeriodic;                /* If TRUE, restarted after each expiry */
+    TI_BOOL      bOperStateWhenStarted;    /* The bOperState value when the timer was started */
+    TI_UINT32    uTwdInitCountWhenStarted; /* The uTwdInitCount value when the timer was started */
+    TI_UINT32    uSlackMsec;               /* Allowed expiry delay for coalescing (if not 0 the timer is in the wheel) */
+    TI_UINT32    uWheelExpiry;             /* The wheel tick the timer expires on */
+    TI_UINT32    uWheelLevel;              /* The wheel level the timer is linked to */
+    TI_UINT32    uWheelSlot;               /* The wheel slot the timer is linked to */
+    TI_BOOL      bInWheel;                 /* TRUE while the timer is linked to the wheel */
+    struct _TTimerInfo *pWheelNext;        /* The next timer in the wheel slot */
+    struct _TTimerInfo *pWheelPrev;        /* The previous timer in the wheel slot */
+} TTimerInfo;
+
 /* The timer module structure (common to all timers) */
 typedef struct
 {
@@ -61,21 +98,38 @@ typedef struct
     TI_BOOL     bOperState;     /* TRUE when the driver is in operational state (not init or recovery) */
     TI_UINT32   uTwdInitCount;  /* Increments on each TWD init (i.e. recovery) */
     TI_UINT32   uTimersCount;   /* Number of created timers */
+
+    /* Timer wheel */
+    TI_HANDLE   hWheelOsTimer;  /* The OS-API timer shared by the wheel timers */
+    TTimerInfo *aWheelSlots[TMR_WHEEL_LEVELS][TMR_WHEEL_SLOTS]; /* The timers list of each slot */
+    TI_UINT64   aWheelMap[TMR_WHEEL_LEVELS];  /* Non empty slots bitmap per level */
+    TI_UINT32   uWheelTimers;   /* Number of timers in the wheel */
+    TI_UINT32   uWheelNow;      /* The last tick processed (its expired timers were queued) */
+    TI_UINT32   uWheelBaseTick; /* The last tick read from the OS time */
+    TI_UINT32   uWheelBaseMs;   /* The OS time (Msec) when uWheelBaseTick started */
+    TI_UINT32   uWheelArmedTick;/* The tick the wheel OS timer is armed for */
+    TI_BOOL     bWheelArmed;    /* TRUE while the wheel OS timer is running */
+    TI_BOOL     bWheelWakeup;   /* TRUE if the wheel OS timer expired since the wheel was last advanced */
+
+    /* Statistics */
+    TI_UINT32   uStatsStartMs;       /* The OS time (Msec) the statistics started */
+    TI_UINT32   uOsTimerWakeups;     /* Expiries of the timers' own OS timers */
+    TI_UINT32   uWheelWakeups;       /* Expiries of the wheel OS timer */
+    TI_UINT32   uWheelExpiries;      /* Timers expired from the wheel */
+    TI_UINT32   uCoalescedExpiries;  /* Wheel timers that expired without a wakeup of their own */
 } TTimerModule;
 
-/* Per timer structure */
-typedef struct
-{
-    TI_HANDLE    hTimerModule;             /* The timer module handle (see TTimerModule, needed on expiry) */
-    TI_HANDLE    hOsTimerObj;              /* The OS-API timer object handle */
-    TQueNodeHdr  tQueNodeHdr;              /* The header used for queueing the timer */
-    TTimerCbFunc fExpiryCbFunc;            /* The CB-function provided by the timer user for expiration */
-    TI_HANDLE    hExpiryCbHndl;            /* The CB-function handle */
-    TI_UINT32    uIntervalMsec;            /* The timer duration in Msec */
-    TI_BOOL      bPeriodic;                /* If TRUE, restarted after each expiry */
-    TI_BOOL      bOperStateWhenStarted;    /* The bOperState value when the timer was started */
-    TI_UINT32    uTwdInitCountWhenStarted; /* The uTwdInitCount value when the timer was started */
-} TTimerInfo;
+
+/* The first set bit index in each 4 bits value */
+static const TI_UINT8 aFirstSlotInNibble[16] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+
+static void tmr_QueueExpiry (TTimerModule *pTimerModule, TTimerInfo *pTimerInfo);
+static void tmr_WheelStart (TTimerModule *pTimerModule, TTimerInfo *pTimerInfo);
+static void tmr_WheelInsert (TTimerModule *pTimerModule, TTimerInfo *pTimerInfo);
+static void tmr_WheelRemove (TTimerModule *pTimerModule, TTimerInfo *pTimerInfo);
+static void tmr_WheelAdvance (TTimerModule *pTimerModule);
+static void tmr_WheelArm (TTimerModule *pTimerModule);
+static void tmr_GetWheelExpiry (TI_HANDLE hTimerModule);
 
 
 
@@ -136,6 +190,12 @@ TI_STATUS tmr_Destroy (TI_HANDLE hTimerModule)
         WLAN_OS_REPORT (("tmr_Destroy():  ERROR - Destroying Timer module but not all timers were destroyed!!\n"));
     }
 
+    /* Free the wheel OS-API timer */
+    if (pTimerModule->hWheelOsTimer)
+    {
+        os_timerDestroy (pTimerModule->hOs, pTimerModule->hWheelOsTimer);
+    }
+
     /* Clear queues (critical section is used inside these functions) */
 
     /* Destroy the module's queues (protect in critical section)) */
@@ -212,7 +272,7 @@ void tmr_ClearOperQueue (TI_HANDLE hTimerModule)
  * \brief  Init required handles
  *
  * Init required handles and module variables, create the init-queue and
- *     operational-queue, and register as the context-engine client.
+ *     operational-queue and the timer wheel OS timer, and register as the context-engine client.
  *
  * \note
  * \param  hTimerModule  - The queue object
@@ -240,6 +300,15 @@ void tmr_Init (TI_HANDLE hTimerModule, TI_HANDLE hOs, TI_HANDLE hReport, TI_HAND
     pTimerModule->uTimersCount  = 0;
     pTimerModule->uTwdInitCount = 0;
 
+    /* Allocate the OS-API timer shared by the wheel timers, and start the wheel time */
+    pTimerModule->hWheelOsTimer = os_timerCreate (hOs, tmr_GetWheelExpiry, hTimerModule);
+    if (!pTimerModule->hWheelOsTimer)
+    {
+        WLAN_OS_REPORT (("tmr_Init(): ERROR - Wheel OS-API timer allocation failed!\n"));
+    }
+    pTimerModule->uWheelBaseMs  = os_timeStampMs (hOs);
+    pTimerModule->uStatsStartMs = pTimerModule->uWheelBaseMs;
+
     /* The offset of the queue-node-header from timer structure entry is needed by the queue */
     uNodeHeaderOffset = TI_FIELD_OFFSET(TTimerInfo, tQueNodeHdr);
 
@@ -400,6 +469,14 @@ TI_STATUS tmr_DestroyTimer (TI_HANDLE hTimerInfo)
         return TI_NOK;
     }
 
+    /* Remove the timer from the wheel if it is running there */
+    if (pTimerInfo->bInWheel)
+    {
+        context_EnterCriticalSection (pTimerModule->hContext);
+        tmr_WheelRemove (pTimerModule, pTimerInfo);
+        context_LeaveCriticalSection (pTimerModule->hContext);
+    }
+
     /* Free the OS-API timer */
     if (pTimerInfo->hOsTimerObj)
     {
@@ -457,8 +534,23 @@ void tmr_StartTimer (TI_HANDLE     hTimerInfo,
     pTimerInfo->bOperStateWhenStarted    = pTimerModule->bOperState;
     pTimerInfo->uTwdInitCountWhenStarted = pTimerModule->uTwdInitCount;
 
-    /* Start OS-API timer running */
-    os_timerStart(pTimerModule->hOs, pTimerInfo->hOsTimerObj, uIntervalMsec);
+    /* If the timer has no slack, start its own OS-API timer running */
+    if (pTimerInfo->uSlackMsec == 0 || !pTimerModule->hWheelOsTimer)
+    {
+        os_timerStart(pTimerModule->hOs, pTimerInfo->hOsTimerObj, uIntervalMsec);
+        return;
+    }
+
+    /* Else, insert it to the timer wheel (replacing its previous expiry if running) and update the wheel OS timer */
+    context_EnterCriticalSection (pTimerModule->hContext);
+    if (pTimerInfo->bInWheel)
+    {
+        tmr_WheelRemove (pTimerModule, pTimerInfo);
+    }
+    tmr_WheelStart (pTimerModule, pTimerInfo);
+    context_LeaveCriticalSection (pTimerModule->hContext);
+
+    tmr_WheelArm (pTimerModule);
 }
 
 
@@ -485,8 +577,19 @@ void tmr_StopTimer (TI_HANDLE hTimerInfo)
         WLAN_OS_REPORT (("tmr_StopTimer(): ERROR - NULL timer!\n"));
         return;
     }
-    /* Stop OS-API timer running */
-    os_timerStop(pTimerModule->hOs, pTimerInfo->hOsTimerObj);
+    /* If the timer is in the wheel remove it and update the wheel OS timer, else stop its OS-API timer running */
+    if (pTimerInfo->bInWheel)
+    {
+        context_EnterCriticalSection (pTimerModule->hContext);
+        tmr_WheelRemove (pTimerModule, pTimerInfo);
+        context_LeaveCriticalSection (pTimerModule->hContext);
+
+        tmr_WheelArm (pTimerModule);
+    }
+    else
+    {
+        os_timerStop(pTimerModule->hOs, pTimerInfo->hOsTimerObj);
+    }
 
     /* Clear periodic flag to prevent timer restart if we are in tmr_HandleExpiry context. */
     pTimerInfo->bPeriodic = TI_FALSE;
@@ -519,24 +622,10 @@ void tmr_GetExpiry (TI_HANDLE hTimerInfo)
     /* Enter critical section */
     context_EnterCriticalSection (pTimerModule->hContext);
 
-    /*
-     * If the expired timer was started when the driver's state was Operational,
-     *   insert it to the Operational-queue
-     */
-    if (pTimerInfo->bOperStateWhenStarted)
-    {
-        que_Enqueue (pTimerModule->hOperQueue, hTimerInfo);
-    }
+    pTimerModule->uOsTimerWakeups++;
 
-    /*
-     * Else (started when driver's state was NOT-Operational), if now the state is still
-     *   NOT Operational insert it to the Init-queue.
-     *   (If state changed from non-operational to operational the event is ignored)
-     */
-    else if (!pTimerModule->bOperState)
-    {
-        que_Enqueue (pTimerModule->hInitQueue, hTimerInfo);
-    }
+    /* Insert the timer to the queue that correlates to the driver state */
+    tmr_QueueExpiry (pTimerModule, pTimerInfo);
 
     /* Leave critical section */
     context_LeaveCriticalSection (pTimerModule->hContext);
@@ -546,14 +635,43 @@ void tmr_GetExpiry (TI_HANDLE hTimerInfo)
 }
 
 
+/** 
+ * \fn     tmr_QueueExpiry
+ * \brief  Queue an expired timer for handling in driver context
+ * 
+ * If the expired timer was started when the driver's state was Operational, insert it to
+ *   the Operational-queue.
+ * Else (started when driver's state was NOT-Operational), if now the state is still
+ *   NOT Operational insert it to the Init-queue.
+ *   (If state changed from non-operational to operational the event is ignored)
+ * 
+ * \note   Called within the critical section.
+ * \param  pTimerModule - The module object
+ * \param  pTimerInfo   - The expired timer
+ * \return void
+ * \sa     tmr_GetExpiry, tmr_WheelAdvance
+ */ 
+static void tmr_QueueExpiry (TTimerModule *pTimerModule, TTimerInfo *pTimerInfo)
+{
+    if (pTimerInfo->bOperStateWhenStarted)
+    {
+        que_Enqueue (pTimerModule->hOperQueue, (TI_HANDLE)pTimerInfo);
+    }
+    else if (!pTimerModule->bOperState)
+    {
+        que_Enqueue (pTimerModule->hInitQueue, (TI_HANDLE)pTimerInfo);
+    }
+}
+
+
 /**
  * \fn     tmr_HandleExpiry
  * \brief  Handles queued expiry events in driver context
  *
  * This is the Timer module's callback that is registered to the ContextEngine module to be invoked
  *   from the driver task (after requested by tmr_GetExpiry through context_RequestSchedule ()).
- * It dequeues all expiry events from the queue that correlates to the current driver state,
- *   and calls their users callbacks.
+ * It first queues the expired wheel timers, then dequeues all expiry events from the queue
+ *   that correlates to the current driver state, and calls their users callbacks.
  *
  * \note
  * \param  hTimerModule - The module object
@@ -571,6 +689,13 @@ void tmr_HandleExpiry (TI_HANDLE hTimerModule)
         WLAN_OS_REPORT (("tmr_HandleExpiry(): ERROR - NULL timer!\n"));
         return;
     }
+
+    /* Queue the wheel timers that expired until now (also on other timers' wakeups) */
+    if (pTimerModule->uWheelTimers || pTimerModule->bWheelWakeup)
+    {
+        tmr_WheelAdvance (pTimerModule);
+    }
+
     while (1)
     {
         /* Enter critical section */
@@ -616,6 +741,493 @@ void tmr_HandleExpiry (TI_HANDLE hTimerModule)
 }
 
 
+/** 
+ * \fn     tmr_SetTimerSlack
+ * \brief  Set the timer's allowed expiry delay
+ * 
+ * A timer with a slack is served by the timer wheel instead of its own OS timer.
+ * Its expiry may be delayed by up to the slack (plus the wheel tick), to the tick within
+ *   that window that other timers are most likely to share, so they expire on one wakeup.
+ * Used for periodic and guard timers, that don't need an exact expiry time.
+ * 
+ * \note   Should be called while the timer is not running (e.g. after tmr_CreateTimer).
+ * \param  hTimerInfo - The specific timer handle
+ * \param  uSlackMsec - The allowed expiry delay in Msec (0 = exact expiry, by the timer's own OS timer)
+ * \return void
+ * \sa     tmr_StartTimer
+ */ 
+void tmr_SetTimerSlack (TI_HANDLE hTimerInfo, TI_UINT32 uSlackMsec)
+{
+    TTimerInfo *pTimerInfo = (TTimerInfo *)hTimerInfo;
+
+    if (!pTimerInfo)
+    {
+        WLAN_OS_REPORT (("tmr_SetTimerSlack(): ERROR - NULL timer!\n"));
+        return;
+    }
+
+    pTimerInfo->uSlackMsec = uSlackMsec;
+}
+
+
+/** 
+ * \fn     tmr_GetStats
+ * \brief  Get the timer module statistics
+ * 
+ * Get the OS timers wakeups (of timers' own OS timers and of the wheel OS timer),
+ *   their rate, and the wheel expiries that were coalesced into other wakeups.
+ * 
+ * \note   
+ * \param  hTimerModule - The module object
+ * \param  pStats       - The statistics (output)
+ * \return void
+ * \sa     tmr_SetTimerSlack
+ */ 
+void tmr_GetStats (TI_HANDLE hTimerModule, TTimerStats *pStats)
+{
+	TTimerModule *pTimerModule = (TTimerModule *)hTimerModule;
+    TI_UINT32     uElapsedMs   = os_timeStampMs (pTimerModule->hOs) - pTimerModule->uStatsStartMs;
+    TI_UINT64     uWakeups;
+
+    pStats->uOsTimerWakeups    = pTimerModule->uOsTimerWakeups;
+    pStats->uWheelWakeups      = pTimerModule->uWheelWakeups;
+    pStats->uWheelExpiries     = pTimerModule->uWheelExpiries;
+    pStats->uCoalescedExpiries = pTimerModule->uCoalescedExpiries;
+    pStats->uWheelTimers       = pTimerModule->uWheelTimers;
+
+    uWakeups = (TI_UINT64)(pTimerModule->uOsTimerWakeups + pTimerModule->uWheelWakeups) * 1000;
+    pStats->uWakeupsPerSec = (uElapsedMs) ? (TI_UINT32)(uWakeups / uElapsedMs) : 0;
+}
+
+
+/** 
+ * \fn     tmr_WheelCurrentTick
+ * \brief  Get the current wheel tick
+ * 
+ * The ticks are counted from the OS time (Msec) differences, so the OS time wrap-around
+ *   has no effect.
+ * 
+ * \note   
+ * \param  pTimerModule - The module object
+ * \param  pNowMs       - The current OS time in Msec (output)
+ * \return The current tick
+ * \sa     
+ */ 
+static TI_UINT32 tmr_WheelCurrentTick (TTimerModule *pTimerModule, TI_UINT32 *pNowMs)
+{
+    TI_UINT32 uNowMs   = os_timeStampMs (pTimerModule->hOs);
+    TI_UINT32 uElapsed = uNowMs - pTimerModule->uWheelBaseMs;
+
+    if (uElapsed >= TMR_WHEEL_TICK_MSEC)
+    {
+        uElapsed /= TMR_WHEEL_TICK_MSEC;
+        pTimerModule->uWheelBaseTick += uElapsed;
+        pTimerModule->uWheelBaseMs   += uElapsed * TMR_WHEEL_TICK_MSEC;
+    }
+
+    *pNowMs = uNowMs;
+    return pTimerModule->uWheelBaseTick;
+}
+
+
+/** 
+ * \fn     tmr_WheelStart
+ * \brief  Insert a started timer to the wheel
+ * 
+ * The expiry tick is the first tick that starts after the timer interval.
+ * Within the slack window [expiry, expiry + slack], the tick with the most trailing zero bits
+ *   is selected, so timers with overlapping windows get the same tick (one wakeup).
+ * 
+ * \note   Called within the critical section.
+ * \param  pTimerModule - The module object
+ * \param  pTimerInfo   - The started timer
+ * \return void
+ * \sa     tmr_StartTimer
+ */ 
+static void tmr_WheelStart (TTimerModule *pTimerModule, TTimerInfo *pTimerInfo)
+{
+    TI_UINT32 uNowMs;
+    TI_UINT32 uTick  = tmr_WheelCurrentTick (pTimerModule, &uNowMs);
+    TI_UINT32 uExpiry;
+    TI_UINT32 uLimit;
+    TI_UINT32 uMask;
+    TI_UINT32 uBit;
+
+    uExpiry = uTick + (uNowMs - pTimerModule->uWheelBaseMs + pTimerInfo->uIntervalMsec + TMR_WHEEL_TICK_MSEC - 1) / TMR_WHEEL_TICK_MSEC;
+
+    /* Apply the slack: keep the window's upper bound bits above its highest bit that differs from the expiry */
+    uLimit = uExpiry + pTimerInfo->uSlackMsec / TMR_WHEEL_TICK_MSEC;
+    uMask  = uLimit ^ uExpiry;
+    if (uMask)
+    {
+        for (uBit = 31; !(uMask & ((TI_UINT32)1 << uBit)); uBit--) {}
+        uExpiry = uLimit & ~(((TI_UINT32)1 << uBit) - 1);
+    }
+
+    /* An empty wheel has nothing to cascade, so it may skip directly to the current tick */
+    if (!pTimerModule->uWheelTimers)
+    {
+        pTimerModule->uWheelNow = uTick;
+    }
+
+    /* The ticks up to uWheelNow were already processed */
+    if ((TI_INT32)(uExpiry - pTimerModule->uWheelNow) <= 0)
+    {
+        uExpiry = pTimerModule->uWheelNow + 1;
+    }
+
+    pTimerInfo->uWheelExpiry = uExpiry;
+    tmr_WheelInsert (pTimerModule, pTimerInfo);
+}
+
+
+/** 
+ * \fn     tmr_WheelInsert / tmr_WheelRemove
+ * \brief  Link / unlink a timer to / from its wheel slot
+ * 
+ * The level is selected by the distance from uWheelNow to the timer expiry tick (level 0 up
+ *   to 63 ticks, level 1 up to 4095 ticks, else level 2), and the slot by the expiry tick bits
+ *   of that level. Longer timers are kept in the farthest level 2 slot until cascaded.
+ * 
+ * \note   Called within the critical section. O(1).
+ * \param  pTimerModule - The module object
+ * \param  pTimerInfo   - The timer
+ * \return void
+ * \sa     tmr_WheelCascade
+ */ 
+static void tmr_WheelInsert (TTimerModule *pTimerModule, TTimerInfo *pTimerInfo)
+{
+    TI_UINT32 uDelta = pTimerInfo->uWheelExpiry - pTimerModule->uWheelNow;
+    TI_UINT32 uLevel = 0;
+    TI_UINT32 uSlot;
+
+    if (uDelta > TMR_WHEEL_MAX_DELTA)
+    {
+        uDelta = TMR_WHEEL_MAX_DELTA;
+    }
+    while ((uLevel < TMR_WHEEL_LEVELS - 1) && (uDelta >> TMR_WHEEL_LEVEL_SHIFT(uLevel + 1)))
+    {
+        uLevel++;
+    }
+    uSlot = ((pTimerModule->uWheelNow + uDelta) >> TMR_WHEEL_LEVEL_SHIFT(uLevel)) & TMR_WHEEL_SLOT_MASK;
+
+    pTimerInfo->uWheelLevel = uLevel;
+    pTimerInfo->uWheelSlot  = uSlot;
+    pTimerInfo->pWheelPrev  = NULL;
+    pTimerInfo->pWheelNext  = pTimerModule->aWheelSlots[uLevel][uSlot];
+    if (pTimerInfo->pWheelNext)
+    {
+        pTimerInfo->pWheelNext->pWheelPrev = pTimerInfo;
+    }
+    pTimerModule->aWheelSlots[uLevel][uSlot] = pTimerInfo;
+    pTimerModule->aWheelMap[uLevel] |= TMR_WHEEL_SLOT_BIT(uSlot);
+    pTimerInfo->bInWheel = TI_TRUE;
+    pTimerModule->uWheelTimers++;
+}
+
+static void tmr_WheelRemove (TTimerModule *pTimerModule, TTimerInfo *pTimerInfo)
+{
+    TI_UINT32 uLevel = pTimerInfo->uWheelLevel;
+    TI_UINT32 uSlot  = pTimerInfo->uWheelSlot;
+
+    if (pTimerInfo->pWheelPrev)
+    {
+        pTimerInfo->pWheelPrev->pWheelNext = pTimerInfo->pWheelNext;
+    }
+    else
+    {
+        pTimerModule->aWheelSlots[uLevel][uSlot] = pTimerInfo->pWheelNext;
+    }
+    if (pTimerInfo->pWheelNext)
+    {
+        pTimerInfo->pWheelNext->pWheelPrev = pTimerInfo->pWheelPrev;
+    }
+    if (!pTimerModule->aWheelSlots[uLevel][uSlot])
+    {
+        pTimerModule->aWheelMap[uLevel] &= ~TMR_WHEEL_SLOT_BIT(uSlot);
+    }
+    pTimerInfo->bInWheel = TI_FALSE;
+    pTimerModule->uWheelTimers--;
+}
+
+
+/** 
+ * \fn     tmr_WheelFirstSlot
+ * \brief  Find the first non empty slot of a level, from the specified slot onwards (cyclic)
+ * 
+ * \note   The level bitmap must not be empty.
+ * \param  uMap   - The level non empty slots bitmap
+ * \param  uStart - The slot to start from
+ * \return The found slot distance from uStart
+ * \sa     tmr_WheelNextTick
+ */ 
+static TI_UINT32 tmr_WheelFirstSlot (TI_UINT64 uMap, TI_UINT32 uStart)
+{
+    TI_UINT32 uDist = 0;
+
+    if (uStart)
+    {
+        uMap = (uMap >> uStart) | (uMap << (TMR_WHEEL_SLOTS - uStart));
+    }
+    while (!(uMap & 0xF))
+    {
+        uMap  >>= 4;
+        uDist  += 4;
+    }
+
+    return uDist + aFirstSlotInNibble[uMap & 0xF];
+}
+
+
+/** 
+ * \fn     tmr_WheelNextTick
+ * \brief  Find the earliest expiry tick of the wheel timers
+ * 
+ * In level 0 all the timers of a slot expire on the same tick, so the first non empty slot
+ *   is the earliest expiry. In the upper levels the first non empty slot timers are searched
+ *   (a timer that expires after its slot end is counted at its cascade tick).
+ * 
+ * \note   Called within the critical section. The wheel must not be empty.
+ * \param  pTimerModule - The module object
+ * \return The earliest expiry tick
+ * \sa     tmr_WheelArm
+ */ 
+static TI_UINT32 tmr_WheelNextTick (TTimerModule *pTimerModule)
+{
+    TI_UINT32   uNow   = pTimerModule->uWheelNow;
+    TI_UINT32   uNext  = uNow + TMR_WHEEL_MAX_DELTA;
+    TI_UINT32   uLevel;
+    TI_UINT32   uStart;
+    TI_UINT32   uSlot;
+    TI_UINT32   uDist;
+    TI_UINT32   uSlotEnd;
+    TI_UINT32   uExpiry;
+    TTimerInfo *pTimerInfo;
+
+    if (pTimerModule->aWheelMap[0])
+    {
+        uStart = (uNow + 1) & TMR_WHEEL_SLOT_MASK;
+        uNext  = uNow + 1 + tmr_WheelFirstSlot (pTimerModule->aWheelMap[0], uStart);
+    }
+
+    for (uLevel = 1; uLevel < TMR_WHEEL_LEVELS; uLevel++)
+    {
+        if (pTimerModule->aWheelMap[uLevel])
+        {
+            uStart = ((uNow >> TMR_WHEEL_LEVEL_SHIFT(uLevel)) + 1) & TMR_WHEEL_SLOT_MASK;
+            uDist  = tmr_WheelFirstSlot (pTimerModule->aWheelMap[uLevel], uStart);
+            uSlot  = (uStart + uDist) & TMR_WHEEL_SLOT_MASK;
+            uSlotEnd = ((uNow >> TMR_WHEEL_LEVEL_SHIFT(uLevel)) + 2 + uDist) << TMR_WHEEL_LEVEL_SHIFT(uLevel);
+
+            for (pTimerInfo = pTimerModule->aWheelSlots[uLevel][uSlot]; pTimerInfo; pTimerInfo = pTimerInfo->pWheelNext)
+            {
+                /* A timer inserted with a clamped distance expires after its slot, so wake up for its cascade */
+                uExpiry = pTimerInfo->uWheelExpiry;
+                if ((TI_INT32)(uExpiry - uSlotEnd) >= 0)
+                {
+                    uExpiry = uSlotEnd - (1 << TMR_WHEEL_LEVEL_SHIFT(uLevel));
+                }
+                if ((TI_INT32)(uExpiry - uNext) < 0)
+                {
+                    uNext = uExpiry;
+                }
+            }
+        }
+    }
+
+    return uNext;
+}
+
+
+/** 
+ * \fn     tmr_WheelCascade
+ * \brief  Move the timers of an upper level slot to the lower levels
+ * 
+ * Called when uWheelNow reaches the start of the slot's ticks range.
+ * 
+ * \note   Called within the critical section.
+ * \param  pTimerModule - The module object
+ * \param  uLevel       - The slot level (1 or above)
+ * \param  uSlot        - The slot index
+ * \return void
+ * \sa     tmr_WheelAdvance
+ */ 
+static void tmr_WheelCascade (TTimerModule *pTimerModule, TI_UINT32 uLevel, TI_UINT32 uSlot)
+{
+    TTimerInfo *pTimerInfo = pTimerModule->aWheelSlots[uLevel][uSlot];
+    TTimerInfo *pNext;
+
+    pTimerModule->aWheelSlots[uLevel][uSlot] = NULL;
+    pTimerModule->aWheelMap[uLevel] &= ~TMR_WHEEL_SLOT_BIT(uSlot);
+
+    for (; pTimerInfo; pTimerInfo = pNext)
+    {
+        pNext = pTimerInfo->pWheelNext;
+        pTimerModule->uWheelTimers--;
+        tmr_WheelInsert (pTimerModule, pTimerInfo);
+    }
+}
+
+
+/** 
+ * \fn     tmr_WheelAdvance
+ * \brief  Queue the wheel timers that expired until the current tick
+ * 
+ * Process the ticks from uWheelNow to the current tick: cascade the upper levels slots
+ *   on their boundaries and queue the level 0 slot timers of each tick.
+ * Ticks are skipped to the next level 0 boundary while level 0 is empty.
+ * Then arm the wheel OS timer for the next expiry.
+ * 
+ * \note   Called in driver context (tmr_HandleExpiry).
+ * \param  pTimerModule - The module object
+ * \return void
+ * \sa     tmr_HandleExpiry, tmr_WheelArm
+ */ 
+static void tmr_WheelAdvance (TTimerModule *pTimerModule)
+{
+    TTimerInfo *pTimerInfo;
+    TI_UINT32   uNowMs;
+    TI_UINT32   uTarget;
+    TI_UINT32   uSkip;
+    TI_UINT32   uLevel;
+    TI_UINT32   uExpired = 0;
+
+    context_EnterCriticalSection (pTimerModule->hContext);
+
+    uTarget = tmr_WheelCurrentTick (pTimerModule, &uNowMs);
+
+    while ((TI_INT32)(uTarget - pTimerModule->uWheelNow) > 0)
+    {
+        /* If level 0 is empty, skip to the tick before its next boundary */
+        if (!pTimerModule->aWheelMap[0] && ((pTimerModule->uWheelNow & TMR_WHEEL_SLOT_MASK) != TMR_WHEEL_SLOT_MASK))
+        {
+            uSkip = pTimerModule->uWheelNow | TMR_WHEEL_SLOT_MASK;
+            pTimerModule->uWheelNow = ((TI_INT32)(uTarget - uSkip) < 0) ? uTarget : uSkip;
+            continue;
+        }
+
+        pTimerModule->uWheelNow++;
+
+        /* On a level 0 boundary, cascade the upper levels slots that start on this tick (highest level first) */
+        if (!(pTimerModule->uWheelNow & TMR_WHEEL_SLOT_MASK))
+        {
+            for (uLevel = TMR_WHEEL_LEVELS - 1; uLevel > 0; uLevel--)
+            {
+                if (!(pTimerModule->uWheelNow & ((1 << TMR_WHEEL_LEVEL_SHIFT(uLevel)) - 1)))
+                {
+                    tmr_WheelCascade (pTimerModule, uLevel, (pTimerModule->uWheelNow >> TMR_WHEEL_LEVEL_SHIFT(uLevel)) & TMR_WHEEL_SLOT_MASK);
+                }
+            }
+        }
+
+        /* Queue the timers that expire on this tick */
+        while ((pTimerInfo = pTimerModule->aWheelSlots[0][pTimerModule->uWheelNow & TMR_WHEEL_SLOT_MASK]) != NULL)
+        {
+            tmr_WheelRemove (pTimerModule, pTimerInfo);
+            tmr_QueueExpiry (pTimerModule, pTimerInfo);
+            uExpired++;
+        }
+    }
+
+    /* Count the expiries that didn't need a wakeup of their own (all but one if the wheel timer woke us) */
+    pTimerModule->uWheelExpiries += uExpired;
+    if (uExpired)
+    {
+        pTimerModule->uCoalescedExpiries += (pTimerModule->bWheelWakeup) ? (uExpired - 1) : uExpired;
+    }
+    pTimerModule->bWheelWakeup = TI_FALSE;
+
+    context_LeaveCriticalSection (pTimerModule->hContext);
+
+    tmr_WheelArm (pTimerModule);
+}
+
+
+/** 
+ * \fn     tmr_WheelArm
+ * \brief  Arm the wheel OS timer for the next wheel expiry
+ * 
+ * The OS timer is restarted only if the next expiry tick changed, and stopped if the wheel is empty.
+ * 
+ * \note   Called in driver context, out of the critical section (the OS timer stop may wait
+ *           for a running expiry callback, which takes the critical section).
+ * \param  pTimerModule - The module object
+ * \return void
+ * \sa     tmr_GetWheelExpiry
+ */ 
+static void tmr_WheelArm (TTimerModule *pTimerModule)
+{
+    TI_UINT32 uNowMs;
+    TI_UINT32 uNextTick;
+    TI_INT32  iDelayMs = 0;
+    TI_BOOL   bStart   = TI_FALSE;
+    TI_BOOL   bStop    = TI_FALSE;
+
+    context_EnterCriticalSection (pTimerModule->hContext);
+
+    if (pTimerModule->uWheelTimers)
+    {
+        uNextTick = tmr_WheelNextTick (pTimerModule);
+
+        if (!pTimerModule->bWheelArmed || (uNextTick != pTimerModule->uWheelArmedTick))
+        {
+            tmr_WheelCurrentTick (pTimerModule, &uNowMs);
+            iDelayMs = (TI_INT32)(uNextTick - pTimerModule->uWheelBaseTick) * TMR_WHEEL_TICK_MSEC 
+                       - (TI_INT32)(uNowMs - pTimerModule->uWheelBaseMs);
+            if (iDelayMs < 1)
+            {
+                iDelayMs = 1;
+            }
+            pTimerModule->uWheelArmedTick = uNextTick;
+            pTimerModule->bWheelArmed     = TI_TRUE;
+            bStart = TI_TRUE;
+        }
+    }
+    else if (pTimerModule->bWheelArmed)
+    {
+        pTimerModule->bWheelArmed = TI_FALSE;
+        bStop = TI_TRUE;
+    }
+
+    context_LeaveCriticalSection (pTimerModule->hContext);
+
+    if (bStart)
+    {
+        os_timerStart (pTimerModule->hOs, pTimerModule->hWheelOsTimer, (TI_UINT32)iDelayMs);
+    }
+    else if (bStop)
+    {
+        os_timerStop (pTimerModule->hOs, pTimerModule->hWheelOsTimer);
+    }
+}
+
+
+/** 
+ * \fn     tmr_GetWheelExpiry
+ * \brief  Called by OS-API upon the wheel timer expiry
+ * 
+ * Request switch to the driver's context, where the expired wheel timers are handled
+ *   (see tmr_HandleExpiry).
+ * 
+ * \note   
+ * \param  hTimerModule - The module object
+ * \return void
+ * \sa     tmr_WheelAdvance
+ */ 
+static void tmr_GetWheelExpiry (TI_HANDLE hTimerModule)
+{
+	TTimerModule *pTimerModule = (TTimerModule *)hTimerModule;
+
+    context_EnterCriticalSection (pTimerModule->hContext);
+    pTimerModule->bWheelArmed  = TI_FALSE;
+    pTimerModule->bWheelWakeup = TI_TRUE;
+    pTimerModule->uWheelWakeups++;
+    context_LeaveCriticalSection (pTimerModule->hContext);
+
+    context_RequestSchedule (pTimerModule->hContext, pTimerModule->uContextId);
+}
+
+
 /**
  * \fn     tmr_PrintModule / tmr_PrintTimer
  * \brief  Print module / timer information
@@ -644,6 +1256,13 @@ void tmr_PrintModule (TI_HANDLE hTimerModule)
                     pTimerModule->uContextId, pTimerModule->bOperState,
                     pTimerModule->uTwdInitCount, pTimerModule->uTimersCount));
 
+    /* Print timer wheel Info */
+    WLAN_OS_REPORT(("tmr_PrintModule(): Wheel: uWheelTimers=%d, uWheelNow=%d, bWheelArmed=%d, uWheelArmedTick=%d\n", 
+        pTimerModule->uWheelTimers, pTimerModule->uWheelNow, pTimerModule->bWheelArmed, pTimerModule->uWheelArmedTick));
+    WLAN_OS_REPORT(("tmr_PrintModule(): Wakeups: OS timers=%d, wheel=%d, wheel expiries=%d, coalesced=%d\n", 
+        pTimerModule->uOsTimerWakeups, pTimerModule->uWheelWakeups, 
+        pTimerModule->uWheelExpiries, pTimerModule->uCoalescedExpiries));
+
     /* Print Init Queue Info */
     WLAN_OS_REPORT(("tmr_PrintModule(): Init-Queue:\n"));
     que_Print(pTimerModule->hInitQueue);
@@ -657,9 +1276,10 @@ void tmr_PrintTimer (TI_HANDLE hTimerInfo)
 {
     TTimerInfo   *pTimerInfo   = (TTimerInfo *)hTimerInfo;                 /* The timer handle */
 
-    WLAN_OS_REPORT(("tmr_PrintTimer(): uIntervalMs=%d, bPeriodic=%d, bOperStateWhenStarted=%d, uTwdInitCountWhenStarted=%d, hOsTimerObj=0x%x, fExpiryCbFunc=0x%x\n",
+    WLAN_OS_REPORT(("tmr_PrintTimer(): uIntervalMs=%d, bPeriodic=%d, bOperStateWhenStarted=%d, uTwdInitCountWhenStarted=%d, hOsTimerObj=0x%x, fExpiryCbFunc=0x%x, uSlackMsec=%d, bInWheel=%d, uWheelExpiry=%d\n",
                     pTimerInfo->uIntervalMsec, pTimerInfo->bPeriodic, pTimerInfo->bOperStateWhenStarted,
-                    pTimerInfo->uTwdInitCountWhenStarted, pTimerInfo->hOsTimerObj, pTimerInfo->fExpiryCbFunc));
+                    pTimerInfo->uTwdInitCountWhenStarted, pTimerInfo->hOsTimerObj, pTimerInfo->fExpiryCbFunc,
+                    pTimerInfo->uSlackMsec, pTimerInfo->bInWheel, pTimerInfo->uWheelExpiry));
 }
 
 #endif /* TI_DBG */